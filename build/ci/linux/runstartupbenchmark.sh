@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2023 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Launches MuseScore several times without a display and saves a startup trace of each launch
+# (see the --startup-trace option), so the startup durations can be compared between builds
+
+MSCORE_BIN=""
+OUTPUT_DIR="startup-traces"
+RUNS=5
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+        --mscore) MSCORE_BIN="$2"; shift ;;
+        --output) OUTPUT_DIR="$2"; shift ;;
+        --runs) RUNS="$2"; shift ;;
+        *) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+if [ -z "$MSCORE_BIN" ]; then echo "error: not set mscore binary, use --mscore <path>"; exit 1; fi
+
+mkdir -p $OUTPUT_DIR
+
+# run in "offscreen" platform for headless systems, it still renders the frames
+export QT_QPA_PLATFORM=offscreen
+
+for ((i = 1; i <= RUNS; i++)); do
+    echo "Startup run $i of $RUNS"
+    $MSCORE_BIN --startup-trace "$OUTPUT_DIR/startup-$i.json" --exit-after-startup
+    if [ ! -f "$OUTPUT_DIR/startup-$i.json" ]; then
+        echo "error: no startup trace was saved, run: $i"
+        exit 1
+    fi
+done
+
+echo "Startup traces saved to $OUTPUT_DIR"
@@ -16,6 +16,10 @@ endif()
 
 add_definitions(-DHAW_PROFILER_ENABLED)
 
+if (NOT LOGGER_DEBUGLEVEL_COMPILED)
+    add_definitions(-DHAW_LOGGER_MAX_LEVEL=1)
+endif()
+
 if (NOT BUILD_ALLOCATOR)
     add_definitions(-DCUSTOM_ALLOCATOR_DISABLED)
 endif()
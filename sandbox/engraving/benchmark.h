@@ -0,0 +1,68 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace mu::engraving::bench {
+struct BenchmarkResult
+{
+    std::string name;
+    uint64_t iterations = 0;
+    double nsPerOp = 0.0;
+    double totalMs = 0.0;
+};
+
+//! NOTE Keeps the result of a kernel alive, so the compiler can't drop the measured code
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+    static volatile const void* sink = nullptr;
+    sink = &value;
+    (void)sink;
+}
+
+//! NOTE Runs the kernel in rounds of the given count until minTime passed,
+//! the first round is a warm-up and isn't counted
+template<typename Kernel>
+BenchmarkResult measure(const std::string& name, uint64_t roundIterations, Kernel kernel,
+                        std::chrono::milliseconds minTime = std::chrono::milliseconds(200))
+{
+    using Clock = std::chrono::steady_clock;
+
+    for (uint64_t i = 0; i < roundIterations; ++i) {
+        kernel();
+    }
+
+    BenchmarkResult result;
+    result.name = name;
+
+    Clock::duration elapsed = Clock::duration::zero();
+    while (elapsed < minTime) {
+        Clock::time_point start = Clock::now();
+        for (uint64_t i = 0; i < roundIterations; ++i) {
+            kernel();
+        }
+        elapsed += Clock::now() - start;
+        result.iterations += roundIterations;
+    }
+
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+    result.totalMs = ns / 1e6;
+    result.nsPerOp = result.iterations ? ns / double(result.iterations) : 0.0;
+
+    return result;
+}
+
+//! NOTE One JSON object per line, so the results of several runs can be compared with any tool
+inline void printJson(const BenchmarkResult& r, FILE* out = stdout)
+{
+    std::fprintf(out, "{\"name\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.3f,\"total_ms\":%.3f}\n",
+                 r.name.c_str(), static_cast<unsigned long long>(r.iterations), r.nsPerOp, r.totalMs);
+}
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,176 @@
+#include "benchmarks.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include "engraving/types/fraction.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/measure.h"
+#include "engraving/libmscore/segment.h"
+#include "engraving/libmscore/shape.h"
+#include "engraving/libmscore/skyline.h"
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/compat/mscxcompat.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::bench;
+
+static constexpr unsigned DATASET_SEED = 20230101;
+static constexpr size_t SHAPE_ELEMENTS = 64;
+static constexpr size_t SKYLINE_RECTS = 256;
+static constexpr size_t TICK_QUERIES = 1024;
+
+static Shape makeShape(std::mt19937& gen, double xOffset)
+{
+    std::uniform_real_distribution<double> pos(0.0, 20.0);
+    std::uniform_real_distribution<double> size(0.5, 4.0);
+
+    Shape shape;
+    for (size_t i = 0; i < SHAPE_ELEMENTS; ++i) {
+        shape.add(RectF(xOffset + pos(gen), pos(gen) - 10.0, size(gen), size(gen)));
+    }
+
+    return shape;
+}
+
+static void makeSkyline(std::mt19937& gen, SkylineLine& line)
+{
+    std::uniform_real_distribution<double> x(0.0, 500.0);
+    std::uniform_real_distribution<double> y(-20.0, 20.0);
+    std::uniform_real_distribution<double> size(1.0, 10.0);
+
+    for (size_t i = 0; i < SKYLINE_RECTS; ++i) {
+        line.add(RectF(x(gen), y(gen), size(gen), size(gen)));
+    }
+}
+
+std::vector<BenchmarkResult> mu::engraving::bench::runKernelBenchmarks()
+{
+    std::vector<BenchmarkResult> results;
+    std::mt19937 gen(DATASET_SEED);
+
+    // Fraction
+    {
+        std::uniform_int_distribution<int> num(1, 15);
+        std::vector<Fraction> fractions;
+        for (size_t i = 0; i < 256; ++i) {
+            fractions.emplace_back(num(gen), 1 << (num(gen) % 6));
+        }
+
+        results.push_back(measure("fraction/add", 1000, [&fractions]() {
+            Fraction sum(0, 1);
+            for (const Fraction& f : fractions) {
+                sum += f;
+            }
+            doNotOptimize(sum);
+        }));
+
+        results.push_back(measure("fraction/compare", 1000, [&fractions]() {
+            size_t less = 0;
+            for (size_t i = 1; i < fractions.size(); ++i) {
+                less += fractions[i - 1] < fractions[i] ? 1 : 0;
+            }
+            doNotOptimize(less);
+        }));
+
+        results.push_back(measure("fraction/multiply", 1000, [&fractions]() {
+            Fraction product(1, 1);
+            for (const Fraction& f : fractions) {
+                product = (product * f).reduced() * Fraction(1, f.numerator());
+            }
+            doNotOptimize(product);
+        }));
+
+        results.push_back(measure("fraction/ticks", 1000, [&fractions]() {
+            int ticks = 0;
+            for (const Fraction& f : fractions) {
+                ticks += Fraction::fromTicks(f.ticks()).ticks();
+            }
+            doNotOptimize(ticks);
+        }));
+    }
+
+    // Shape
+    {
+        std::unique_ptr<MasterScore> score(compat::ScoreAccess::createMasterScoreWithBaseStyle());
+        Shape a = makeShape(gen, 0.0);
+        Shape b = makeShape(gen, 15.0);
+
+        results.push_back(measure("shape/minHorizontalDistance", 1000, [&a, &b, &score]() {
+            doNotOptimize(a.minHorizontalDistance(b, score.get()));
+        }));
+
+        results.push_back(measure("shape/minVerticalDistance", 1000, [&a, &b]() {
+            doNotOptimize(a.minVerticalDistance(b));
+        }));
+
+        results.push_back(measure("shape/translate", 1000, [&a]() {
+            Shape c = a;
+            c.translate(PointF(1.0, 1.0));
+            doNotOptimize(c);
+        }));
+    }
+
+    // Skyline
+    {
+        SkylineLine north(true);
+        SkylineLine south(false);
+        makeSkyline(gen, north);
+        makeSkyline(gen, south);
+
+        results.push_back(measure("skyline/minDistance", 1000, [&north, &south]() {
+            doNotOptimize(south.minDistance(north));
+        }));
+
+        std::mt19937 addGen(DATASET_SEED);
+        results.push_back(measure("skyline/add", 100, [&addGen]() {
+            SkylineLine line(true);
+            makeSkyline(addGen, line);
+            doNotOptimize(line);
+        }));
+    }
+
+    return results;
+}
+
+std::vector<BenchmarkResult> mu::engraving::bench::runScoreBenchmarks(const std::string& scorePath)
+{
+    std::vector<BenchmarkResult> results;
+    const String path = String::fromStdString(scorePath);
+
+    results.push_back(measure("score/read", 1, [&path]() {
+        std::unique_ptr<MasterScore> score(compat::ScoreAccess::createMasterScoreWithBaseStyle());
+        doNotOptimize(compat::loadMsczOrMscx(score.get(), path, true));
+    }, std::chrono::milliseconds(1000)));
+
+    std::unique_ptr<MasterScore> score(compat::ScoreAccess::createMasterScoreWithBaseStyle());
+    if (compat::loadMsczOrMscx(score.get(), path, true) != Err::NoError || !score->firstMeasure()) {
+        std::fprintf(stderr, "failed to read score: %s\n", scorePath.c_str());
+        return results;
+    }
+
+    std::mt19937 gen(DATASET_SEED);
+    std::uniform_int_distribution<int> tick(0, std::max(0, score->endTick().ticks() - 1));
+    std::vector<Fraction> ticks;
+    for (size_t i = 0; i < TICK_QUERIES; ++i) {
+        ticks.push_back(Fraction::fromTicks(tick(gen)));
+    }
+
+    results.push_back(measure("score/tick2measure", 100, [&ticks, &score]() {
+        for (const Fraction& t : ticks) {
+            doNotOptimize(score->tick2measure(t));
+        }
+    }));
+
+    results.push_back(measure("score/segmentIteration", 10, [&score]() {
+        size_t count = 0;
+        for (Segment* s = score->firstSegment(SegmentType::All); s; s = s->next1()) {
+            ++count;
+        }
+        doNotOptimize(count);
+    }));
+
+    return results;
+}
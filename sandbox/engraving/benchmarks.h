@@ -0,0 +1,22 @@
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+
+namespace mu::engraving {
+class MasterScore;
+}
+
+namespace mu::engraving::bench {
+//! NOTE The kernels that don't need a score run on fixed generated datasets,
+//! so the numbers of two builds are comparable
+std::vector<BenchmarkResult> runKernelBenchmarks();
+
+//! NOTE The kernels that walk a score, the score is loaded from the given file
+std::vector<BenchmarkResult> runScoreBenchmarks(const std::string& scorePath);
+}
+
+#endif // BENCHMARKS_H
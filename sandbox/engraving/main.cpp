@@ -1,22 +1,38 @@
 #include <QCoreApplication>
-#include <QDebug>
+
+#include <cstring>
 
 #include "modularity/ioc.h"
 
 #include "fontproviderstub.h"
+#include "benchmarks.h"
 
-#include "engraving/libmscore/score.h"
-#include "engraving/compat/scoreaccess.h"
+using namespace mu::engraving::bench;
 
+//! NOTE Usage: engraving_app [--score <path.mscz|path.mscx>]
+//! Prints one JSON object per benchmark to stdout
 int main(int argc, char* argv[])
 {
     QCoreApplication a(argc, argv);
 
     mu::modularity::ioc()->registerExport<mu::draw::IFontProvider>("test", new mu::draw::FontProviderStub());
 
-    Ms::MasterScore* s = mu::engraving::compat::ScoreAccess::createMasterScore();
-    qDebug() << "score: " << s;
+    std::string scorePath;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--score") == 0 && i + 1 < argc) {
+            scorePath = argv[++i];
+        }
+    }
+
+    for (const BenchmarkResult& r : runKernelBenchmarks()) {
+        printJson(r);
+    }
 
+    if (!scorePath.empty()) {
+        for (const BenchmarkResult& r : runScoreBenchmarks(scorePath)) {
+            printJson(r);
+        }
+    }
 
-    return a.exec();
+    return 0;
 }
@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+var Score = require("steps/Score.js")
+
+//! NOTE The recorded input, replayed one action per step,
+//! so that the score view is painted after each of them, as when typing
+var recordedInput = [
+    "pad-note-8",
+    "note-c", "note-d", "note-e", "note-f", "note-g", "note-a", "note-b", "note-c",
+    "pad-note-4",
+    "note-c", "note-g", "note-e", "note-c",
+    "pad-note-16",
+    "note-d", "note-e", "note-f", "note-g", "note-a", "note-b", "note-c", "note-d",
+    "pad-note-2",
+    "note-e", "note-c"
+]
+
+var testCase = {
+    name: "TC10: Note input latency",
+    description: "Replay a recorded note input on a big score and print the input latency statistic",
+    steps: [
+        {name: "Close score (if opened) and go to home to start", func: function() {
+            api.dispatcher.dispatch("file-close")
+            api.navigation.triggerControl("TopTool", "MainToolBar", "Home")
+        }},
+        {name: "Open Big Score", func: function() {
+            api.autobot.openProject("Big_Score.mscz")
+        }},
+        {name: "Start note input", func: function() {
+            Score.focusIn()
+            api.dispatcher.dispatch("note-input")
+        }}
+    ]
+};
+
+recordedInput.forEach(function(action) {
+    testCase.steps.push({name: "Input: " + action, func: function() {
+        api.dispatcher.dispatch(action)
+    }})
+})
+
+testCase.steps.push({name: "Stop note input", func: function() {
+    api.dispatcher.dispatch("notation-escape")
+}})
+
+testCase.steps.push({name: "Print input latency", func: function() {
+    api.dispatcher.dispatch("diagnostic-input-latency-dump")
+}})
+
+function main()
+{
+    api.autobot.setInterval(200)
+    api.autobot.runTestCase(testCase)
+}
@@ -27,6 +27,7 @@ var Palette = require("steps/Palette.js")
 var testCase = {
     name: "TC9: Big Score (perfomance)",
     description: "Let's check perfomance",
+    performance: true,
     steps: [
         {name: "Close score (if opened) and go to home to start", func: function() {
             api.dispatcher.dispatch("file-close")
@@ -41,6 +42,27 @@ var testCase = {
         }},
         {name: "Add Slur", func: function() {
             api.shortcuts.activate("S")
+        }},
+        {name: "Undo Slur", func: function() {
+            api.dispatcher.dispatch("undo")
+        }},
+        {name: "Note input burst", func: function() {
+            api.dispatcher.dispatch("notation-escape")
+            api.dispatcher.dispatch("note-input")
+            var notes = ["note-c", "note-d", "note-e", "note-f", "note-g", "note-a", "note-b", "note-c"]
+            notes.forEach(function(note) {
+                api.dispatcher.dispatch(note)
+            })
+            api.dispatcher.dispatch("notation-escape")
+        }},
+        {name: "Start playback", func: function() {
+            api.dispatcher.dispatch("play")
+        }},
+        {name: "Stop playback", func: function() {
+            api.dispatcher.dispatch("stop")
+        }},
+        {name: "Save", func: function() {
+            api.autobot.saveProject("TC9_BigScore.mscz")
         }}
     ]
 };
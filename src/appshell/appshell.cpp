@@ -24,12 +24,20 @@
 
 #include "config.h"
 
+#include <future>
+#include <memory>
+#include <vector>
+
 #include <QApplication>
 #include <QQmlApplicationEngine>
 #include <QQuickWindow>
 #include <QStyleHints>
 #ifndef Q_OS_WASM
 #include <QThreadPool>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #endif
 
 #include "view/internal/splashscreen.h"
@@ -37,6 +45,7 @@
 #include "view/dockwindow/docksetup.h"
 
 #include "modularity/ioc.h"
+#include "allocator.h"
 #include "ui/internal/uiengine.h"
 #include "version.h"
 
@@ -55,9 +64,72 @@ AppShell::AppShell()
 {
 }
 
-void AppShell::addModule(modularity::IModuleSetup* module)
+void AppShell::addModule(modularity::IModuleSetup* module, bool editorOnly)
 {
     m_modules.push_back(module);
+
+    if (editorOnly) {
+        m_editorOnlyModules.insert(module);
+    }
+}
+
+QList<mu::modularity::IModuleSetup*> AppShell::modulesForRunMode(const framework::IApplication::RunMode& mode) const
+{
+    if (mode == framework::IApplication::RunMode::Editor) {
+        return m_modules;
+    }
+
+    QList<modularity::IModuleSetup*> modules;
+    for (modularity::IModuleSetup* m : m_modules) {
+        if (!m_editorOnlyModules.contains(m)) {
+            modules.push_back(m);
+        }
+    }
+
+    return modules;
+}
+
+void AppShell::traceFirstFrame(QQuickWindow* window, const CommandLineController::StartupTraceOptions& options)
+{
+    auto finish = [this, options]() {
+        m_startupTrace.save(options.filePath);
+
+        if (options.exitAfterStartup) {
+            QCoreApplication::exit(0);
+        }
+    };
+
+    if (!window) {
+        m_startupTrace.mark("mainQmlCreated");
+        finish();
+        return;
+    }
+
+    //! NOTE frameSwapped comes from the render thread, so a few may be queued before the disconnect
+    auto connection = std::make_shared<QMetaObject::Connection>();
+    *connection = QObject::connect(window, &QQuickWindow::frameSwapped, qApp, [this, connection, finish]() {
+        if (!*connection) {
+            return;
+        }
+
+        QObject::disconnect(*connection);
+
+        m_startupTrace.mark("firstFrame");
+        finish();
+    }, Qt::QueuedConnection);
+}
+
+static void saveTraceEvents(const QString& filePath)
+{
+#ifdef HAW_PROFILER_ENABLED
+    using namespace haw::profiler;
+    Profiler::setFuncsEventsEnabled(false);
+    if (!Profiler::instance()->saveFuncsEvents(filePath.toStdString())) {
+        LOGE() << "failed save trace to " << filePath;
+    }
+#else
+    LOGW() << "profiler is disabled, nothing to save to " << filePath;
+#endif
 }
 
 int AppShell::run(int argc, char** argv)
@@ -123,17 +195,19 @@ int AppShell::run(int argc, char** argv)
     globalModule.registerUiTypes();
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerResources();
+        m_startupTrace.measure("registerResources", m->moduleName(), [m]() { m->registerResources(); });
     }
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerExports();
+        m_startupTrace.measure("registerExports", m->moduleName(), [m]() { m->registerExports(); });
     }
 
     globalModule.resolveImports();
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerUiTypes();
-        m->resolveImports();
+        m_startupTrace.measure("registerUiTypes", m->moduleName(), [m]() {
+            m->registerUiTypes();
+            m->resolveImports();
+        });
     }
 
     // ====================================================
@@ -144,12 +218,26 @@ int AppShell::run(int argc, char** argv)
     commandLine.apply();
     framework::IApplication::RunMode runMode = muapplication()->runMode();
 
+    //! NOTE The modules that are not needed in this run mode are not set up at all
+    const QList<modularity::IModuleSetup*> activeModules = modulesForRunMode(runMode);
+
+    const CommandLineController::StartupTraceOptions traceOptions = commandLine.startupTraceOptions();
+
     // ====================================================
     // Setup modules: onPreInit
     // ====================================================
     globalModule.onPreInit(runMode);
-    for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onPreInit(runMode);
+
+    //! NOTE After the profiler setup of the global module
+    const QString traceOutputPath = commandLine.traceOutputPath();
+#ifdef HAW_PROFILER_ENABLED
+    if (!traceOutputPath.isEmpty()) {
+        haw::profiler::Profiler::setFuncsEventsEnabled(true);
+    }
+#endif
+
+    for (mu::modularity::IModuleSetup* m : activeModules) {
+        m_startupTrace.measure("onPreInit", m->moduleName(), [m, runMode]() { m->onPreInit(runMode); });
     }
 
     SplashScreen* splashScreen = nullptr;
@@ -162,25 +250,40 @@ int AppShell::run(int argc, char** argv)
     // Setup modules: onInit
     // ====================================================
     globalModule.onInit(runMode);
-    for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onInit(runMode);
+
+    std::vector<std::future<void> > concurrentInits;
+    for (mu::modularity::IModuleSetup* m : activeModules) {
+        m_startupTrace.measure("onInit", m->moduleName(), [m, runMode]() { m->onInit(runMode); });
+#ifndef Q_OS_WASM
+        //! NOTE Each concurrent init gets its own lane in the trace
+        int lane = static_cast<int>(concurrentInits.size()) + 1;
+        concurrentInits.push_back(std::async(std::launch::async, [this, m, runMode, lane]() {
+            m_startupTrace.measure("onInitConcurrent", m->moduleName(), [m, runMode]() { m->onInitConcurrent(runMode); }, lane);
+        }));
+#else
+        m_startupTrace.measure("onInitConcurrent", m->moduleName(), [m, runMode]() { m->onInitConcurrent(runMode); });
+#endif
+    }
+
+    for (std::future<void>& init : concurrentInits) {
+        init.get();
     }
 
     // ====================================================
     // Setup modules: onAllInited
     // ====================================================
     globalModule.onAllInited(runMode);
-    for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onAllInited(runMode);
+    for (mu::modularity::IModuleSetup* m : activeModules) {
+        m_startupTrace.measure("onAllInited", m->moduleName(), [m, runMode]() { m->onAllInited(runMode); });
     }
 
     // ====================================================
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
-    QMetaObject::invokeMethod(qApp, [this]() {
+    QMetaObject::invokeMethod(qApp, [this, activeModules]() {
         globalModule.onStartApp();
-        for (mu::modularity::IModuleSetup* m : m_modules) {
-            m->onStartApp();
+        for (mu::modularity::IModuleSetup* m : activeModules) {
+            m_startupTrace.measure("onStartApp", m->moduleName(), [m]() { m->onStartApp(); });
         }
     }, Qt::QueuedConnection);
 
@@ -194,7 +297,13 @@ int AppShell::run(int argc, char** argv)
         // Process Converter
         // ====================================================
         auto task = commandLine.converterTask();
-        QMetaObject::invokeMethod(qApp, [this, task]() {
+        QMetaObject::invokeMethod(qApp, [this, task, traceOptions]() {
+                //! NOTE The startup is over when the conversion begins
+                if (!traceOptions.filePath.isEmpty()) {
+                    m_startupTrace.mark("conversionStarted");
+                    m_startupTrace.save(traceOptions.filePath);
+                }
+
                 int code = processConverter(task);
                 qApp->exit(code);
             }, Qt::QueuedConnection);
@@ -226,7 +335,7 @@ int AppShell::run(int argc, char** argv)
 #endif
 
         QObject::connect(engine, &QQmlApplicationEngine::objectCreated,
-                         &app, [this, url](QObject* obj, const QUrl& objUrl) {
+                         &app, [this, activeModules, url, traceOptions](QObject* obj, const QUrl& objUrl) {
                 if (!obj && url == objUrl) {
                     LOGE() << "failed Qml load\n";
                     QCoreApplication::exit(-1);
@@ -238,8 +347,12 @@ int AppShell::run(int argc, char** argv)
                     // ====================================================
 
                     globalModule.onDelayedInit();
-                    for (mu::modularity::IModuleSetup* m : m_modules) {
-                        m->onDelayedInit();
+                    for (mu::modularity::IModuleSetup* m : activeModules) {
+                        m_startupTrace.measure("onDelayedInit", m->moduleName(), [m]() { m->onDelayedInit(); });
+                    }
+
+                    if (!traceOptions.filePath.isEmpty()) {
+                        traceFirstFrame(qobject_cast<QQuickWindow*>(obj), traceOptions);
                     }
                 }
             }, Qt::QueuedConnection);
@@ -258,7 +371,7 @@ int AppShell::run(int argc, char** argv)
         //! Needs to be called before any QQuickWindows are shown.
         QQuickWindow::setDefaultAlphaBuffer(true);
 
-        engine->load(url);
+        m_startupTrace.measure("qml", "loadMainQml", [engine, url]() { engine->load(url); });
 
         if (splashScreen) {
             splashScreen->close();
@@ -278,6 +391,10 @@ int AppShell::run(int argc, char** argv)
 
     PROFILER_PRINT;
 
+    if (!traceOutputPath.isEmpty()) {
+        saveTraceEvents(traceOutputPath);
+    }
+
     // Wait Thread Poll
 #ifndef Q_OS_WASM
     QThreadPool* globalThreadPool = QThreadPool::globalInstance();
@@ -291,13 +408,13 @@ int AppShell::run(int argc, char** argv)
 
     // Deinit
 
-    for (mu::modularity::IModuleSetup* m : m_modules) {
+    for (mu::modularity::IModuleSetup* m : activeModules) {
         m->onDeinit();
     }
 
     globalModule.onDeinit();
 
-    for (mu::modularity::IModuleSetup* m : m_modules) {
+    for (mu::modularity::IModuleSetup* m : activeModules) {
         m->onDestroy();
     }
 
@@ -311,15 +428,89 @@ int AppShell::run(int argc, char** argv)
     return retCode;
 }
 
+static QJsonArray allocatorsData()
+{
+    QJsonArray allocators;
+    for (const mu::ObjectAllocator::Info& info : mu::AllocatorsRegister::instance()->stateInfos()) {
+        if (info.peakCount == 0) {
+            continue;
+        }
+
+        QJsonObject obj;
+        obj["module"] = QString::fromStdString(info.module);
+        obj["name"] = QString::fromStdString(info.name);
+        obj["chunkSize"] = static_cast<qint64>(info.chunkSize);
+        obj["liveCount"] = static_cast<qint64>(info.liveCount);
+        obj["peakCount"] = static_cast<qint64>(info.peakCount);
+        obj["peakBytes"] = static_cast<qint64>(info.peakBytes());
+        obj["allocatedBytes"] = static_cast<qint64>(info.allocatedBytes());
+        allocators.append(obj);
+    }
+
+    return allocators;
+}
+
+static void saveProfilerData(const QString& filePath)
+{
+    QJsonObject root;
+
+#ifdef HAW_PROFILER_ENABLED
+    using namespace haw::profiler;
+    const Profiler::Data data = Profiler::instance()->threadsData();
+
+    QJsonArray threads;
+    for (const auto& thread : data.threads) {
+        QJsonArray funcs;
+        for (const auto& func : thread.second.funcs) {
+            QJsonObject funcObj;
+            funcObj["func"] = QString::fromStdString(func.second.func);
+            funcObj["callcount"] = static_cast<qint64>(func.second.callcount);
+            funcObj["sumtimeMs"] = func.second.sumtimeMs;
+            funcs.append(funcObj);
+        }
+
+        QJsonObject threadObj;
+        threadObj["main"] = thread.first == data.mainThread;
+        threadObj["funcs"] = funcs;
+        threads.append(threadObj);
+    }
+
+    root["threads"] = threads;
+#else
+    LOGW() << "profiler is disabled, only the memory is saved to " << filePath;
+#endif
+
+    //! NOTE The converted score is closed by now, so the peaks are of interest here
+    root["allocators"] = allocatorsData();
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open file: " << filePath;
+        return;
+    }
+    file.write(QJsonDocument(root).toJson());
+}
+
 int AppShell::processConverter(const CommandLineController::ConverterTask& task)
 {
     Ret ret = make_ret(Ret::Code::Ok);
     io::path_t stylePath = task.params[CommandLineController::ParamKey::StylePath].toString();
     bool forceMode = task.params[CommandLineController::ParamKey::ForceMode].toBool();
+    QString profileOutputPath = task.params[CommandLineController::ParamKey::ProfileOutputPath].toString();
+
+    if (!profileOutputPath.isEmpty()) {
+        //! NOTE Only the conversion itself is of interest
+        PROFILER_CLEAR;
+    }
 
     switch (task.type) {
     case CommandLineController::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode,
+                                        task.params.value(CommandLineController::ParamKey::JobWorkers, 1).toUInt(),
+                                        task.params.value(CommandLineController::ParamKey::JobIncremental, false).toBool());
+        break;
+    case CommandLineController::ConvertType::JobServer:
+        ret = converter()->serveJobs(stylePath, forceMode);
         break;
     case CommandLineController::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
@@ -351,11 +542,23 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
         std::string scoreSource = task.params[CommandLineController::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, forceMode);
     } break;
+    case CommandLineController::ConvertType::VisualTest: {
+        QString referencePath = task.params[CommandLineController::ParamKey::VisualTestReferencePath].toString();
+        ret = converter()->visualTest(task.inputFile, task.outputFile, referencePath, stylePath);
+    } break;
+    case CommandLineController::ConvertType::ScoreDiff: {
+        QString otherFile = task.params[CommandLineController::ParamKey::ScoreDiffOtherFile].toString();
+        ret = converter()->scoreDiff(task.inputFile, otherFile, task.outputFile, stylePath, forceMode);
+    } break;
     }
 
     if (!ret) {
         LOGE() << "failed convert, error: " << ret.toString();
     }
 
+    if (!profileOutputPath.isEmpty()) {
+        saveProfilerData(profileOutputPath);
+    }
+
     return ret.code();
 }
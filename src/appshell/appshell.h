@@ -24,6 +24,7 @@
 #define MU_APPSHELL_APPSHELL_H
 
 #include <QList>
+#include <QSet>
 
 #include "modularity/imodulesetup.h"
 #include "modularity/ioc.h"
@@ -31,6 +32,9 @@
 #include "converter/iconvertercontroller.h"
 
 #include "commandlinecontroller.h"
+#include "startuptrace.h"
+
+class QQuickWindow;
 
 namespace mu::appshell {
 class AppShell
@@ -41,15 +45,23 @@ class AppShell
 public:
     AppShell();
 
-    void addModule(modularity::IModuleSetup* module);
+    //! NOTE The exports of all modules are registered, because the run mode is known only after that,
+    //! but an editorOnly module is not inited (and deinited) in the other run modes
+    void addModule(modularity::IModuleSetup* module, bool editorOnly = false);
 
     int run(int argc, char** argv);
 
 private:
 
     int processConverter(const CommandLineController::ConverterTask& task);
+    void traceFirstFrame(QQuickWindow* window, const CommandLineController::StartupTraceOptions& options);
+
+    QList<modularity::IModuleSetup*> modulesForRunMode(const framework::IApplication::RunMode& mode) const;
 
     QList<modularity::IModuleSetup*> m_modules;
+    QSet<modularity::IModuleSetup*> m_editorOnlyModules;
+
+    StartupTrace m_startupTrace;
 };
 }
 
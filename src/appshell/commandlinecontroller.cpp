@@ -54,6 +54,12 @@ void CommandLineController::parse(const QStringList& args)
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("job-workers", "Use with '-j <file>', run the jobs in the given number of converter processes",
+                                          "count"));
+    m_parser.addOption(QCommandLineOption("job-incremental",
+                                          "Use with '-j <file>', skip the jobs whose input, style and app version haven't changed since the last conversion"));
+    m_parser.addOption(QCommandLineOption("job-server",
+                                          "Read conversion jobs from stdin, one JSON object per line, and print the result of each to stdout"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -74,7 +80,21 @@ void CommandLineController::parse(const QStringList& args)
                                           "options"));
     m_parser.addOption(QCommandLineOption("source-update", "Update the source in the given score"));
 
+    m_parser.addOption(QCommandLineOption("vtest", "Paint the scores of the directory into draw data for the visual tests", "dir"));
+    m_parser.addOption(QCommandLineOption("vtest-output", "Use with '--vtest <dir>', the directory for the draw data", "dir"));
+    m_parser.addOption(QCommandLineOption("vtest-reference",
+                                          "Use with '--vtest <dir>', compare the draw data with the one in the directory", "dir"));
+
+    m_parser.addOption(QCommandLineOption("score-diff",
+                                          "Compare the given score with the other one measure by measure "
+                                          "and print the differences to stdout, or save them with '-o <file>'",
+                                          "other"));
+
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
+    m_parser.addOption(QCommandLineOption("profile-output",
+                                          "Use with converter options, save function timings, call counts "
+                                          "and object memory peaks of the conversion to a JSON file",
+                                          "file"));
 
     // Video export
     m_parser.addOption(QCommandLineOption("score-video", "Generate video for the given score and export it to file"));
@@ -94,6 +114,16 @@ void CommandLineController::parse(const QStringList& args)
     //! NOTE Currently only implemented `full` mode
     m_parser.addOption(QCommandLineOption("migration", "Whether to do migration with given mode, `full` - full migration", "mode"));
 
+    // Startup tracing
+    m_parser.addOption(QCommandLineOption("startup-trace",
+                                          "Save the durations of the startup stages of each module and the startup milestones "
+                                          "to a file in the Trace Event Format", "file"));
+    m_parser.addOption(QCommandLineOption("exit-after-startup",
+                                          "Use with '--startup-trace <file>', exit once the first frame of the main window is shown"));
+    m_parser.addOption(QCommandLineOption("trace-output",
+                                          "Record every call of the traced functions on all threads and save them on exit "
+                                          "to a file in the Trace Event Format", "file"));
+
     m_parser.process(args);
 }
 
@@ -137,6 +167,15 @@ void CommandLineController::apply()
         haw::logger::Logger::instance()->setLevel(haw::logger::Debug);
     }
 
+    if (m_parser.isSet("startup-trace")) {
+        m_startupTraceOptions.filePath = m_parser.value("startup-trace");
+        m_startupTraceOptions.exitAfterStartup = m_parser.isSet("exit-after-startup");
+    }
+
+    if (m_parser.isSet("trace-output")) {
+        m_traceOutputPath = m_parser.value("trace-output");
+    }
+
     if (m_parser.isSet("D")) {
         std::optional<double> val = doubleValue("D");
         if (val) {
@@ -212,6 +251,24 @@ void CommandLineController::apply()
         application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = m_parser.value("j");
+
+        if (m_parser.isSet("job-workers")) {
+            std::optional<int> val = intValue("job-workers");
+            if (val && val.value() > 0) {
+                m_converterTask.params[CommandLineController::ParamKey::JobWorkers] = val.value();
+            } else {
+                LOGE() << "Option: --job-workers not recognized count value: " << m_parser.value("job-workers");
+            }
+        }
+
+        if (m_parser.isSet("job-incremental")) {
+            m_converterTask.params[CommandLineController::ParamKey::JobIncremental] = true;
+        }
+    }
+
+    if (m_parser.isSet("job-server")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::JobServer;
     }
 
     if (m_parser.isSet("score-media")) {
@@ -262,6 +319,24 @@ void CommandLineController::apply()
         }
     }
 
+    if (m_parser.isSet("vtest")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::VisualTest;
+        m_converterTask.inputFile = m_parser.value("vtest");
+        m_converterTask.outputFile = m_parser.isSet("vtest-output") ? m_parser.value("vtest-output") : QString("vtest_drawdata");
+        if (m_parser.isSet("vtest-reference")) {
+            m_converterTask.params[CommandLineController::ParamKey::VisualTestReferencePath] = m_parser.value("vtest-reference");
+        }
+    }
+
+    if (m_parser.isSet("score-diff")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::ScoreDiff;
+        m_converterTask.inputFile = scorefiles[0];
+        m_converterTask.outputFile = m_parser.value("o");
+        m_converterTask.params[CommandLineController::ParamKey::ScoreDiffOtherFile] = m_parser.value("score-diff");
+    }
+
     // Video
 #ifdef BUILD_VIDEOEXPORT_MODULE
     if (m_parser.isSet("score-video")) {
@@ -331,6 +406,10 @@ void CommandLineController::apply()
         m_converterTask.params[CommandLineController::ParamKey::StylePath] = m_parser.value("S");
     }
 
+    if (m_parser.isSet("profile-output")) {
+        m_converterTask.params[CommandLineController::ParamKey::ProfileOutputPath] = m_parser.value("profile-output");
+    }
+
     if (application()->runMode() == IApplication::RunMode::Converter) {
         project::MigrationOptions migration;
         migration.appVersion = mu::engraving::MSCVERSION;
@@ -374,6 +453,16 @@ CommandLineController::ConverterTask CommandLineController::converterTask() cons
     return m_converterTask;
 }
 
+CommandLineController::StartupTraceOptions CommandLineController::startupTraceOptions() const
+{
+    return m_startupTraceOptions;
+}
+
+QString CommandLineController::traceOutputPath() const
+{
+    return m_traceOutputPath;
+}
+
 void CommandLineController::printLongVersion() const
 {
     if (Version::unstable()) {
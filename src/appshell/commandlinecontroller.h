@@ -59,6 +59,7 @@ public:
     enum class ConvertType {
         File,
         Batch,
+        JobServer,
         ConvertScoreParts,
         ExportScoreMedia,
         ExportScoreMeta,
@@ -66,7 +67,9 @@ public:
         ExportScorePartsPdf,
         ExportScoreTranspose,
         SourceUpdate,
-        ExportScoreVideo
+        ExportScoreVideo,
+        VisualTest,
+        ScoreDiff
     };
 
     enum class ParamKey {
@@ -75,6 +78,11 @@ public:
         ScoreSource,
         ScoreTransposeOptions,
         ForceMode,
+        ProfileOutputPath,
+        JobWorkers,
+        JobIncremental,
+        VisualTestReferencePath,
+        ScoreDiffOtherFile,
 
         // Video
     };
@@ -88,16 +96,25 @@ public:
         QMap<ParamKey, QVariant> params;
     };
 
+    struct StartupTraceOptions {
+        QString filePath;
+        bool exitAfterStartup = false;
+    };
+
     void parse(const QStringList& args);
     void apply();
 
     ConverterTask converterTask() const;
+    StartupTraceOptions startupTraceOptions() const;
+    QString traceOutputPath() const;
 
 private:
     void printLongVersion() const;
 
     QCommandLineParser m_parser;
     ConverterTask m_converterTask;
+    StartupTraceOptions m_startupTraceOptions;
+    QString m_traceOutputPath;
 };
 }
 
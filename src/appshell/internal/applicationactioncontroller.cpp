@@ -100,8 +100,16 @@ void ApplicationActionController::onDropEvent(QDropEvent* event)
         bool shouldBeHandled = false;
 
         if (projectFilesController()->isFileSupported(filePath)) {
-            async::Async::call(this, [this, filePath]() {
-                Ret ret = projectFilesController()->openProject(filePath);
+            std::vector<io::path_t> projectPaths;
+            for (const QUrl& url : urls) {
+                io::path_t path = io::path_t(url.toLocalFile());
+                if (projectFilesController()->isFileSupported(path)) {
+                    projectPaths.push_back(path);
+                }
+            }
+
+            async::Async::call(this, [this, projectPaths]() {
+                Ret ret = projectFilesController()->openProjects(projectPaths);
                 if (!ret) {
                     LOGE() << ret.toString();
                 }
@@ -28,9 +28,14 @@ DockPanelView {
 
     default property alias contentComponent : contentLoader.sourceComponent
 
+    //! NOTE The content of a panel is created only when the panel is shown,
+    //! and it is incubated asynchronously, so that it does not block the first frame of the window
+    property bool loadAsynchronously: true
+
     Loader {
         id: contentLoader
 
         active: root.visible
+        asynchronous: root.loadAsynchronously
     }
 }
@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "startuptrace.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "log.h"
+
+using namespace mu::appshell;
+
+StartupTrace::StartupTrace()
+    : m_start(Clock::now())
+{
+}
+
+void StartupTrace::mark(const std::string& name)
+{
+    const Clock::time_point now = Clock::now();
+
+    std::lock_guard lock(m_mutex);
+    m_events.push_back({ "milestone", name, sinceStartUs(now), -1, 0 });
+}
+
+void StartupTrace::addEvent(const std::string& stage, const std::string& name, Clock::time_point start, Clock::time_point end,
+                            int lane)
+{
+    const int64_t startUs = sinceStartUs(start);
+    const int64_t durationUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::lock_guard lock(m_mutex);
+    m_events.push_back({ stage, name, startUs, durationUs, lane });
+}
+
+int64_t StartupTrace::sinceStartUs(Clock::time_point time) const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - m_start).count();
+}
+
+bool StartupTrace::save(const QString& filePath) const
+{
+    QJsonArray traceEvents;
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        for (const Event& event : m_events) {
+            QJsonObject obj;
+            obj["name"] = QString::fromStdString(event.name);
+            obj["cat"] = QString::fromStdString(event.stage);
+            obj["ts"] = static_cast<qint64>(event.startUs);
+            obj["pid"] = 0;
+            obj["tid"] = event.lane;
+
+            if (event.durationUs < 0) {
+                obj["ph"] = "i";
+                obj["s"] = "g";
+            } else {
+                obj["ph"] = "X";
+                obj["dur"] = static_cast<qint64>(event.durationUs);
+            }
+
+            traceEvents.append(obj);
+        }
+    }
+
+    QJsonObject root;
+    root["traceEvents"] = traceEvents;
+    root["displayTimeUnit"] = "ms";
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open file: " << filePath;
+        return false;
+    }
+
+    file.write(QJsonDocument(root).toJson());
+    return true;
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_APPSHELL_STARTUPTRACE_H
+#define MU_APPSHELL_STARTUPTRACE_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <QString>
+
+namespace mu::appshell {
+//! NOTE Collects the durations of the startup stages (per module) and the time points of the startup milestones.
+//! Saved in the Trace Event Format, so it can be opened in chrome://tracing or Perfetto
+class StartupTrace
+{
+public:
+    StartupTrace();
+
+    template<typename Func>
+    void measure(const std::string& stage, const std::string& name, Func func, int lane = 0)
+    {
+        const Clock::time_point start = Clock::now();
+        func();
+        addEvent(stage, name, start, Clock::now(), lane);
+    }
+
+    void mark(const std::string& name);
+
+    bool save(const QString& filePath) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Event {
+        std::string stage;
+        std::string name;
+        int64_t startUs = 0;
+        int64_t durationUs = -1; // -1 for a milestone
+        int lane = 0;
+    };
+
+    void addEvent(const std::string& stage, const std::string& name, Clock::time_point start, Clock::time_point end, int lane);
+    int64_t sinceStartUs(Clock::time_point time) const;
+
+    const Clock::time_point m_start;
+
+    //! NOTE The concurrent stages are recorded from worker threads
+    mutable std::mutex m_mutex;
+    std::vector<Event> m_events;
+};
+}
+
+#endif // MU_APPSHELL_STARTUPTRACE_H
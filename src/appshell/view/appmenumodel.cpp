@@ -346,6 +346,8 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
     MenuItemList systemItems {
         makeMenuItem("diagnostic-show-paths"),
         makeMenuItem("diagnostic-show-profiler"),
+        makeMenuItem("diagnostic-input-latency-dump"),
+        makeMenuItem("diagnostic-memory-dump"),
     };
 
     MenuItemList accessibilityItems {
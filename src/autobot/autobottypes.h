@@ -109,6 +109,8 @@ struct TestCase
 
     QString name() const { return val.property("name").toString(); }
     QString description() const { return val.property("description").toString(); }
+    //! NOTE The step durations of a performance test case are compared against the baseline
+    bool isPerformance() const { return val.property("performance").toBool(); }
     Steps steps() const { return Steps(val.property("steps")); }
 
 private:
@@ -40,6 +40,11 @@ public:
     virtual io::path_t reportsPath() const = 0;
     virtual io::path_t drawDataPath() const = 0;
     virtual io::path_t fileDrawDataPath(const io::path_t& filePath) const = 0;
+
+    //! NOTE Step durations of the performance test cases to compare the runs against
+    virtual io::path_t perfBaselinesPath() const = 0;
+    //! NOTE Relative slowdown of a step over its baseline that fails the test case (0.2 is 20%)
+    virtual double perfRegressionThreshold() const = 0;
 };
 }
 
@@ -50,7 +50,11 @@ void Autobot::init()
     });
 
     m_runner.allFinished().onReceive(this, [this](bool aborted) {
-        m_report.endReport(aborted);
+        Ret ret = m_report.endReport(aborted);
+        if (!ret) {
+            LOGE() << ret.toString();
+            setStatus(Status::Error);
+        }
     });
 
     setStatus(Status::Undefined);
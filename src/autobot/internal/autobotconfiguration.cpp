@@ -84,3 +84,18 @@ mu::io::path_t AutobotConfiguration::fileDrawDataPath(const io::path_t& filePath
 {
     return drawDataPath() + "/" + io::basename(filePath) + ".json";
 }
+
+mu::io::path_t AutobotConfiguration::perfBaselinesPath() const
+{
+    return dataPath() + "/perf_baselines";
+}
+
+double AutobotConfiguration::perfRegressionThreshold() const
+{
+    const char* threshold = std::getenv("MU_AUTOBOT_PERF_THRESHOLD");
+    if (threshold) {
+        return std::atof(threshold);
+    }
+
+    return 0.2;
+}
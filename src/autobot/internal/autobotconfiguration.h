@@ -43,6 +43,9 @@ public:
     io::path_t reportsPath() const override;
     io::path_t drawDataPath() const override;
     io::path_t fileDrawDataPath(const io::path_t& filePath) const override;
+
+    io::path_t perfBaselinesPath() const override;
+    double perfRegressionThreshold() const override;
 };
 }
 
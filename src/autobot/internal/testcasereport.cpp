@@ -22,6 +22,9 @@
 #include "testcasereport.h"
 
 #include <QDateTime>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
 
 #include "io/path.h"
 #include "log.h"
@@ -34,6 +37,9 @@ inline QTextStream& operator<<(QTextStream& s, const std::string& v)
     return s;
 }
 
+//! NOTE Smaller slowdowns are measurement noise, however big the relative difference is
+static constexpr int MIN_PERF_REGRESSION_MSEC = 20;
+
 static QString formatVal(const ITestCaseContext::Val& val)
 {
     return val.toString();
@@ -65,6 +71,10 @@ mu::Ret TestCaseReport::beginReport(const TestCase& testCase)
 
     m_stream.setDevice(&m_file);
 
+    m_testCaseName = tcname;
+    m_isPerformance = testCase.isPerformance();
+    m_stepDurations.clear();
+
     m_stream << "Test: " << tcname << Qt::endl;
     m_stream << "date: " << now.toString("yyyy.MM.dd hh:mm") << Qt::endl;
     m_stream << "steps: ";
@@ -84,18 +94,83 @@ mu::Ret TestCaseReport::beginReport(const TestCase& testCase)
     return make_ret(Ret::Code::Ok);
 }
 
-void TestCaseReport::endReport(bool aborted)
+mu::Ret TestCaseReport::endReport(bool aborted)
 {
     if (!m_opened) {
-        return;
+        return make_ok();
     }
 
+    Ret ret = make_ok();
     if (aborted) {
         m_stream << "Test case aborted!" << Qt::endl;
+    } else if (m_isPerformance) {
+        ret = compareWithPerfBaseline();
     }
 
     m_stream.flush();
     m_file.close();
+
+    return ret;
+}
+
+mu::Ret TestCaseReport::compareWithPerfBaseline()
+{
+    QString fileName = m_testCaseName;
+    fileName.replace(QRegularExpression("[^A-Za-z0-9_.-]"), "_");
+    io::path_t baselinePath = configuration()->perfBaselinesPath() + "/" + io::path_t(fileName) + ".json";
+
+    QJsonObject durations;
+    for (const auto& step : m_stepDurations) {
+        durations[step.first] = step.second;
+    }
+
+    m_stream << Qt::endl;
+
+    if (!fileSystem()->exists(baselinePath)) {
+        m_stream << "No performance baseline, this run is saved as the baseline: " << baselinePath.toStdString() << Qt::endl;
+
+        Ret ret = fileSystem()->makePath(configuration()->perfBaselinesPath());
+        if (ret) {
+            QByteArray json = QJsonDocument(durations).toJson();
+            ret = fileSystem()->writeFile(baselinePath, ByteArray::fromQByteArrayNoCopy(json));
+        }
+
+        return ret;
+    }
+
+    RetVal<ByteArray> baselineData = fileSystem()->readFile(baselinePath);
+    if (!baselineData.ret) {
+        return baselineData.ret;
+    }
+
+    QJsonObject baseline = QJsonDocument::fromJson(baselineData.val.toQByteArrayNoCopy()).object();
+    double threshold = configuration()->perfRegressionThreshold();
+
+    m_stream << "Performance against the baseline (threshold: " << qRound(threshold * 100) << "%):" << Qt::endl;
+
+    int regressions = 0;
+    for (const auto& step : m_stepDurations) {
+        if (!baseline.contains(step.first)) {
+            m_stream << "  new step: " << step.first << " [" << step.second << " msec]" << Qt::endl;
+            continue;
+        }
+
+        int baselineMsec = baseline.value(step.first).toInt();
+        bool isRegression = step.second > baselineMsec * (1.0 + threshold)
+                            && (step.second - baselineMsec) > MIN_PERF_REGRESSION_MSEC;
+        if (isRegression) {
+            ++regressions;
+        }
+
+        m_stream << (isRegression ? "  regression: " : "  ok: ") << step.first
+                 << " [" << step.second << " msec, baseline: " << baselineMsec << " msec]" << Qt::endl;
+    }
+
+    if (regressions > 0) {
+        return make_ret(Ret::Code::UnknownError, QString("%1 step(s) slower than the performance baseline").arg(regressions));
+    }
+
+    return make_ok();
 }
 
 void TestCaseReport::onStepStatusChanged(const StepInfo& stepInfo, const ITestCaseContextPtr& ctx)
@@ -116,6 +191,7 @@ void TestCaseReport::onStepStatusChanged(const StepInfo& stepInfo, const ITestCa
         }
 
         m_stream << "  finished step: " << stepInfo.name << " [" << stepInfo.durationMsec << " msec]" << Qt::endl;
+        m_stepDurations.push_back({ stepInfo.name, stepInfo.durationMsec });
     } break;
     case StepStatus::Skipped: {
         m_stream << "  skipped step: " << stepInfo.name << Qt::endl;
@@ -22,6 +22,7 @@
 #ifndef MU_AUTOBOT_TESTCASEREPORT_H
 #define MU_AUTOBOT_TESTCASEREPORT_H
 
+#include <vector>
 #include <QFile>
 #include <QTextStream>
 
@@ -42,15 +43,21 @@ public:
     TestCaseReport() = default;
 
     Ret beginReport(const TestCase& testCase);
-    void endReport(bool aborted);
+    Ret endReport(bool aborted);
 
     void onStepStatusChanged(const StepInfo& stepInfo, const ITestCaseContextPtr& ctx);
 
 private:
 
+    Ret compareWithPerfBaseline();
+
     QFile m_file;
     QTextStream m_stream;
     bool m_opened = false;
+
+    QString m_testCaseName;
+    bool m_isPerformance = false;
+    std::vector<std::pair<QString, int> > m_stepDurations;
 };
 }
 
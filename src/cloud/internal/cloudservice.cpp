@@ -28,6 +28,7 @@
 #include <QJsonObject>
 #include <QUrlQuery>
 #include <QBuffer>
+#include <QCryptographicHash>
 #include <QHttpMultiPart>
 #include <QRandomGenerator>
 
@@ -85,6 +86,15 @@ static int generateFileNameNumber()
     return QRandomGenerator::global()->generate() % 100000;
 }
 
+static QByteArray contentHash(QIODevice& data)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    bool ok = hash.addData(&data);
+    data.seek(0);
+
+    return ok ? hash.result() : QByteArray();
+}
+
 static void printServerReply(const QBuffer& reply)
 {
     const QByteArray& data = reply.data();
@@ -674,6 +684,15 @@ mu::Ret CloudService::doUploadAudio(network::INetworkManagerPtr uploadManager, Q
         return uploadUrl.ret;
     }
 
+    //! NOTE The audio is generated from the score, so it often stays the same between two uploads of the score.
+    //! The same audio as the last one uploaded for the score is not uploaded again
+    int scoreId = scoreIdFromSourceUrl(sourceUrl);
+    QByteArray audioHash = contentHash(audioData);
+    if (!audioHash.isEmpty() && mu::value(m_uploadedAudioHashes, scoreId) == audioHash) {
+        LOGD() << "The audio of the score " << scoreId << " is unchanged, skip uploading";
+        return make_ok();
+    }
+
     QHttpMultiPart multiPart(QHttpMultiPart::FormDataType);
 
     QHttpPart audioPart;
@@ -687,7 +706,7 @@ mu::Ret CloudService::doUploadAudio(network::INetworkManagerPtr uploadManager, Q
 
     QHttpPart scoreIdPart;
     scoreIdPart.setHeader(QNetworkRequest::ContentDispositionHeader, QVariant("form-data; name=\"score_id\""));
-    scoreIdPart.setBody(QString::number(scoreIdFromSourceUrl(sourceUrl)).toLatin1());
+    scoreIdPart.setBody(QString::number(scoreId).toLatin1());
     multiPart.append(scoreIdPart);
 
     QBuffer receivedData;
@@ -697,8 +716,11 @@ mu::Ret CloudService::doUploadAudio(network::INetworkManagerPtr uploadManager, Q
 
     if (!ret) {
         printServerReply(receivedData);
+        return ret;
     }
 
+    m_uploadedAudioHashes[scoreId] = audioHash;
+
     return ret;
 }
 
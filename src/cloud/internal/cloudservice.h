@@ -22,6 +22,8 @@
 #ifndef MU_CLOUD_CLOUDSERVICE_H
 #define MU_CLOUD_CLOUDSERVICE_H
 
+#include <map>
+
 #include <QObject>
 
 class QOAuth2AuthorizationCodeFlow;
@@ -114,6 +116,8 @@ private:
     QString m_refreshToken;
 
     OnUserAuthorizedCallback m_onUserAuthorizedCallback;
+
+    std::map<int, QByteArray> m_uploadedAudioHashes;
 };
 }
 
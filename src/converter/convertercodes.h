@@ -32,6 +32,7 @@ enum class Err {
 
     BatchJobFileFailedOpen = 1301,
     BatchJobFileFailedParse = 1302,
+    BatchJobWorkerFailed = 1303,
 
     ConvertTypeUnknown = 1310,
 
@@ -39,6 +40,9 @@ enum class Err {
 
     OutFileFailedOpen = 1330,
     OutFileFailedWrite = 1331,
+
+    VisualTestDiffFound = 1340,
+    ScoreDiffFound = 1341,
 };
 
 inline Ret make_ret(Err e)
@@ -35,7 +35,11 @@ public:
 
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                             bool forceMode = false) = 0;
-    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    //! NOTE In the incremental mode, a hash of the input, the style and the app version is saved
+    //! next to the output of each job (<out>.hash) and the jobs with an unchanged hash are skipped
+    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                             size_t workerCount = 1, bool incremental = false) = 0;
+    virtual Ret serveJobs(const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
 
@@ -53,6 +57,15 @@ public:
 
     virtual Ret exportScoreVideo(const io::path_t& in, const io::path_t& out) = 0;
 
+    //! NOTE Paints the pages of the scores in scoresDir into draw data (<outDir>/<score>-<page>.drawdata)
+    //! and compares them with the draw data in referenceDir, if it's set
+    virtual Ret visualTest(const io::path_t& scoresDir, const io::path_t& outDir, const io::path_t& referenceDir = io::path_t(),
+                           const io::path_t& stylePath = io::path_t()) = 0;
+
+    //! NOTE Writes the measures that differ between the two scores to out (or prints them to stdout if out is empty)
+    virtual Ret scoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out = io::path_t(),
+                          const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+
     virtual Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) = 0;
 };
 }
@@ -23,6 +23,7 @@
 
 #include <stdio.h>
 
+#include <QBuffer>
 #include <QString>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -285,25 +286,32 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
 
     PageList notationPages = pages(notation);
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        QByteArray pngData;
-        QBuffer pngDevice(&pngData);
-        pngDevice.open(QIODevice::ReadWrite);
+    std::vector<QByteArray> pngData(notationPages.size());
+    std::vector<std::unique_ptr<QBuffer> > pngDevices;
+    std::vector<QIODevice*> devices;
+    for (QByteArray& data : pngData) {
+        pngDevices.push_back(std::make_unique<QBuffer>(&data));
+        pngDevices.back()->open(QIODevice::ReadWrite);
+        devices.push_back(pngDevices.back().get());
+    }
 
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
-        };
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
+    };
 
-        Ret writeRet = pngWriter->write(notation, pngDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    //! NOTE The pages are written together, the writer may process several of them at a time
+    bool result = true;
+    Ret writeRet = pngWriter->writePages(notation, devices, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+        result = false;
+    }
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(pngData.toBase64(), !lastArrayValue);
+    pngDevices.clear();
+
+    for (size_t i = 0; i < pngData.size(); ++i) {
+        bool lastArrayValue = ((pngData.size() - 1) == i);
+        jsonWriter.addBase64Value(std::move(pngData[i]), !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
@@ -346,8 +354,10 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path_t& h
             result = false;
         }
 
+        svgDevice.close();
+
         bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(svgData.toBase64(), !lastArrayValue);
+        jsonWriter.addBase64Value(std::move(svgData), !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
@@ -360,13 +370,13 @@ Ret BackendApi::exportScoreElementsPositions(const std::string& elementsPosition
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(elementsPositionsWriterName, notation);
+    RetVal<QByteArray> writerRetVal = processWriterRaw(elementsPositionsWriterName, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(elementsPositionsWriterName.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator, false);
+    jsonWriter.addBase64Value(std::move(writerRetVal.val), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -375,13 +385,13 @@ Ret BackendApi::exportScorePdf(const INotationPtr notation, BackendJsonWriter& j
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(PDF_WRITER_NAME, notation);
+    RetVal<QByteArray> writerRetVal = processWriterRaw(PDF_WRITER_NAME, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(PDF_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addBase64Value(std::move(writerRetVal.val), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -405,13 +415,13 @@ Ret BackendApi::exportScoreMidi(const INotationPtr notation, BackendJsonWriter&
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(MIDI_WRITER_NAME, notation);
+    RetVal<QByteArray> writerRetVal = processWriterRaw(MIDI_WRITER_NAME, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(MIDI_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addBase64Value(std::move(writerRetVal.val), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -420,13 +430,13 @@ Ret BackendApi::exportScoreMusicXML(const INotationPtr notation, BackendJsonWrit
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(MUSICXML_WRITER_NAME, notation);
+    RetVal<QByteArray> writerRetVal = processWriterRaw(MUSICXML_WRITER_NAME, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(MUSICXML_JSON_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addBase64Value(std::move(writerRetVal.val), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -463,6 +473,16 @@ Ret BackendApi::devInfo(const notation::INotationPtr notation, BackendJsonWriter
 }
 
 mu::RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtr notation)
+{
+    RetVal<QByteArray> result = processWriterRaw(writerName, notation);
+    if (result.ret) {
+        result.val = result.val.toBase64();
+    }
+
+    return result;
+}
+
+mu::RetVal<QByteArray> BackendApi::processWriterRaw(const std::string& writerName, const INotationPtr notation)
 {
     auto writer = writers()->writer(writerName);
     if (!writer) {
@@ -480,11 +500,11 @@ mu::RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName,
         return writeRet;
     }
 
+    device.close();
+
     RetVal<QByteArray> result;
     result.ret = make_ret(Ret::Code::Ok);
-    result.val = data.toBase64();
-
-    device.close();
+    result.val = std::move(data);
 
     return result;
 }
@@ -566,29 +586,62 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
 
     INotationPtrList notations;
 
-    QJsonArray partsArray;
+    // The parts that are closed may have never been laid out, lay them out all at once
+    std::vector<mu::engraving::Score*> closedScores;
+    for (IExcerptNotationPtr e : masterNotation->excerpts().val) {
+        mu::engraving::Score* score = e->notation()->elements()->msScore();
+        if (!score->isOpen()) {
+            closedScores.push_back(score);
+        }
+    }
+    mu::engraving::Score::doLayoutScores(closedScores);
+
     QJsonArray partsNamesArray;
     for (IExcerptNotationPtr e : masterNotation->excerpts().val) {
         QJsonValue partNameVal(e->name());
         partsNamesArray.append(partNameVal);
 
-        QByteArray partBin = processWriter(PDF_WRITER_NAME, e->notation()).val;
-        QJsonValue partVal(QString::fromLatin1(partBin));
-        partsArray.append(partVal);
-
         notations.push_back(e->notation());
     }
 
+    //! NOTE The parts PDFs and the PDF of all the parts are written in one pass
+    std::vector<QByteArray> partsData(notations.size());
+    std::vector<std::unique_ptr<QBuffer> > partsBuffers;
+    std::vector<QIODevice*> partsDevices;
+    for (QByteArray& partData : partsData) {
+        auto buffer = std::make_unique<QBuffer>(&partData);
+        buffer->open(QIODevice::WriteOnly);
+        partsDevices.push_back(buffer.get());
+        partsBuffers.push_back(std::move(buffer));
+    }
+
+    QByteArray fullScoreData;
+    QBuffer fullScoreBuffer(&fullScoreData);
+    fullScoreBuffer.open(QIODevice::WriteOnly);
+
+    if (!notations.empty()) {
+        auto writer = writers()->writer(PDF_WRITER_NAME);
+        if (!writer) {
+            LOGW() << "Not found writer " << PDF_WRITER_NAME;
+            return make_ret(Ret::Code::InternalError);
+        }
+
+        Ret ret = writer->writeEachAndList(notations, partsDevices, fullScoreBuffer);
+        if (!ret) {
+            LOGW() << ret.toString();
+            return ret;
+        }
+    }
+
+    QJsonArray partsArray;
+    for (const QByteArray& partData : partsData) {
+        partsArray.append(QJsonValue(QString::fromLatin1(partData.toBase64())));
+    }
+
     jsonForPdfs["parts"] = partsNamesArray;
     jsonForPdfs["partsBin"] = partsArray;
 
     jsonForPdfs["scoreFullPostfix"] = QString("-Score_and_parts") + ".pdf";
-
-    INotationWriter::Options options {
-        { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::MULTI_PART) }
-    };
-
-    QByteArray fullScoreData = processWriter(PDF_WRITER_NAME, notations, options).val;
     jsonForPdfs["scoreFullBin"] = QString::fromLatin1(fullScoreData.toBase64());
 
     QJsonDocument jsonDoc(jsonForPdfs);
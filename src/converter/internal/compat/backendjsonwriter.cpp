@@ -21,53 +21,151 @@
  */
 #include "backendjsonwriter.h"
 
+#include <algorithm>
+
 using namespace mu::converter;
 using namespace mu::io;
 
+//! NOTE A multiple of 3, so that the encoded pieces join without padding in between
+static constexpr int BASE64_PIECE_SIZE = 3 * 16 * 1024;
+
+//! NOTE If the data is produced faster than written, the producer waits
+//! rather than keeping all of it in memory
+static constexpr size_t MAX_QUEUED_SIZE = 256 * 1024 * 1024;
+
 BackendJsonWriter::BackendJsonWriter(QIODevice* destinationDevice)
 {
     m_destinationDevice = destinationDevice;
     m_destinationDevice->open(QIODevice::WriteOnly);
     m_destinationDevice->write("{\n");
+
+    m_thread = std::thread([this]() {
+        writeLoop();
+    });
 }
 
 BackendJsonWriter::~BackendJsonWriter()
 {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished = true;
+    }
+    m_chunkAdded.notify_one();
+    m_thread.join();
+
     m_destinationDevice->write("\n}\n");
     m_destinationDevice->close();
 }
 
 void BackendJsonWriter::addKey(const char* arrayName)
 {
-    m_destinationDevice->write("\"");
-    m_destinationDevice->write(arrayName);
-    m_destinationDevice->write("\": ");
+    QByteArray key = QByteArray("\"") + arrayName + "\": ";
+    Chunk chunk;
+    chunk.size = key.size();
+    chunk.write = [key](QIODevice* device) {
+        device->write(key);
+    };
+
+    write(std::move(chunk));
 }
 
 void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool isJson)
 {
-    if (!isJson) {
-        m_destinationDevice->write("\"");
-    }
-    m_destinationDevice->write(data);
-    if (!isJson) {
-        m_destinationDevice->write("\"");
-    }
-    if (addSeparator) {
-        m_destinationDevice->write(",\n");
-    }
+    Chunk chunk;
+    chunk.size = data.size();
+    chunk.write = [data, addSeparator, isJson](QIODevice* device) {
+        if (!isJson) {
+            device->write("\"");
+        }
+        device->write(data);
+        if (!isJson) {
+            device->write("\"");
+        }
+        if (addSeparator) {
+            device->write(",\n");
+        }
+    };
+
+    write(std::move(chunk));
+}
+
+void BackendJsonWriter::addBase64Value(QByteArray rawData, bool addSeparator)
+{
+    Chunk chunk;
+    chunk.size = rawData.size();
+    chunk.write = [rawData = std::move(rawData), addSeparator](QIODevice* device) {
+        device->write("\"");
+        for (int pos = 0; pos < rawData.size(); pos += BASE64_PIECE_SIZE) {
+            int pieceSize = std::min(BASE64_PIECE_SIZE, static_cast<int>(rawData.size()) - pos);
+            device->write(QByteArray::fromRawData(rawData.constData() + pos, pieceSize).toBase64());
+        }
+        device->write("\"");
+        if (addSeparator) {
+            device->write(",\n");
+        }
+    };
+
+    write(std::move(chunk));
 }
 
 void BackendJsonWriter::openArray()
 {
-    m_destinationDevice->write(" [");
+    write(" [");
 }
 
 void BackendJsonWriter::closeArray(bool addSeparator)
 {
-    m_destinationDevice->write("]");
-    if (addSeparator) {
-        m_destinationDevice->write(",");
+    write(addSeparator ? "],\n" : "]\n");
+}
+
+void BackendJsonWriter::write(const char* data)
+{
+    Chunk chunk;
+    chunk.write = [data](QIODevice* device) {
+        device->write(data);
+    };
+
+    write(std::move(chunk));
+}
+
+void BackendJsonWriter::write(Chunk chunk)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_chunkWritten.wait(lock, [this]() {
+            return m_queuedSize < MAX_QUEUED_SIZE;
+        });
+
+        m_queuedSize += chunk.size;
+        m_chunks.push_back(std::move(chunk));
+    }
+    m_chunkAdded.notify_one();
+}
+
+void BackendJsonWriter::writeLoop()
+{
+    for (;;) {
+        Chunk chunk;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_chunkAdded.wait(lock, [this]() {
+                return !m_chunks.empty() || m_finished;
+            });
+
+            if (m_chunks.empty()) {
+                return;
+            }
+
+            chunk = std::move(m_chunks.front());
+            m_chunks.pop_front();
+        }
+
+        chunk.write(m_destinationDevice);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queuedSize -= chunk.size;
+        }
+        m_chunkWritten.notify_one();
     }
-    m_destinationDevice->write("\n");
 }
@@ -22,9 +22,17 @@
 #ifndef MU_CONVERTER_BACKENDJSONWRITER_H
 #define MU_CONVERTER_BACKENDJSONWRITER_H
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include "io/path.h"
 
 namespace mu::converter {
+//! NOTE The output is written in a separate thread, in the order of the calls,
+//! so that the next data can be prepared while the previous one is being encoded and written
 class BackendJsonWriter
 {
 public:
@@ -33,12 +41,33 @@ public:
 
     void addKey(const char* arrayName);
     void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false);
+    //! NOTE Adds the data as a base64 string. It is encoded in the writing thread,
+    //! piece by piece straight into the output, without a full size encoded copy
+    void addBase64Value(QByteArray rawData, bool addSeparator = false);
 
     void openArray();
     void closeArray(bool addSeparator = false);
 
 private:
+    struct Chunk
+    {
+        std::function<void(QIODevice*)> write;
+        size_t size = 0;
+    };
+
+    void write(Chunk chunk);
+    void write(const char* data);
+    void writeLoop();
+
     QIODevice* m_destinationDevice = nullptr;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_chunkAdded;
+    std::condition_variable m_chunkWritten;
+    std::deque<Chunk> m_chunks;
+    size_t m_queuedSize = 0;
+    bool m_finished = false;
 };
 }
 
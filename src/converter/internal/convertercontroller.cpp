@@ -21,16 +21,39 @@
  */
 #include "convertercontroller.h"
 
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDir>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QProcess>
+#include <QThread>
+#include <QtConcurrent>
 
 #include "convertercodes.h"
 #include "stringutils.h"
 #include "compat/backendapi.h"
 
+#include "draw/bufferedpaintprovider.h"
+#include "draw/painter.h"
+#include "draw/utils/drawbinary.h"
+#include "draw/utils/drawjson.h"
+#include "engraving/libmscore/mscore.h"
+#include "engraving/libmscore/scorediff.h"
+
+#include "version.h"
+
 #include "log.h"
 
 using namespace mu::converter;
@@ -40,7 +63,10 @@ using namespace mu::notation;
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 
-mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
+static const QString JOB_SERVER_OPTION = "--job-server";
+
+mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode,
+                                          size_t workerCount, bool incremental)
 {
     TRACEFUNC;
 
@@ -50,6 +76,41 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
         return batchJob.ret;
     }
 
+    std::map<const Job*, QByteArray> jobHashes;
+    if (incremental) {
+        for (auto it = batchJob.val.begin(); it != batchJob.val.end();) {
+            RetVal<QByteArray> hash = jobHash(*it, stylePath);
+            if (!hash.ret) {
+                ++it;
+                continue;
+            }
+
+            if (isJobUpToDate(*it, hash.val)) {
+                LOGI() << "up to date, skipped: " << it->out;
+                it = batchJob.val.erase(it);
+                continue;
+            }
+
+            jobHashes[&(*it)] = hash.val;
+            ++it;
+        }
+    }
+
+    auto saveJobHashes = [this, &jobHashes]() {
+        for (const auto& pair : jobHashes) {
+            saveJobHash(*pair.first, pair.second);
+        }
+    };
+
+    if (workerCount > 1 && batchJob.val.size() > 1) {
+        //! NOTE The results of the single jobs are not known here, so the hashes are only saved if all of them succeeded
+        Ret ret = batchConvertInWorkers(batchJob.val, workerCount);
+        if (ret) {
+            saveJobHashes();
+        }
+        return ret;
+    }
+
     Ret ret = make_ret(Ret::Code::Ok);
     for (const Job& job : batchJob.val) {
         ret = fileConvert(job.in, job.out, stylePath, forceMode);
@@ -57,20 +118,193 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
             LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
             break;
         }
+
+        auto hash = jobHashes.find(&job);
+        if (hash != jobHashes.end()) {
+            saveJobHash(job, hash->second);
+        }
     }
 
+    m_loadedProject = LoadedProject();
+
     return ret;
 }
 
+mu::RetVal<QByteArray> ConverterController::jobHash(const Job& job, const io::path_t& stylePath) const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+
+    QFile in(job.in.toQString());
+    if (!in.open(QIODevice::ReadOnly) || !hash.addData(&in)) {
+        return make_ret(Err::InFileFailedLoad);
+    }
+
+    if (!stylePath.empty()) {
+        QFile style(stylePath.toQString());
+        if (style.open(QIODevice::ReadOnly)) {
+            hash.addData(&style);
+        }
+    }
+
+    hash.addData(QByteArray::fromStdString(framework::Version::fullVersion() + framework::Version::revision()));
+
+    return RetVal<QByteArray>::make_ok(hash.result().toHex());
+}
+
+mu::io::path_t ConverterController::jobHashFilePath(const Job& job) const
+{
+    return job.out + ".hash";
+}
+
+bool ConverterController::isJobUpToDate(const Job& job, const QByteArray& hash) const
+{
+    QFile file(jobHashFilePath(job).toQString());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    return file.readAll() == hash;
+}
+
+void ConverterController::saveJobHash(const Job& job, const QByteArray& hash) const
+{
+    QFile file(jobHashFilePath(job).toQString());
+    if (!file.open(QIODevice::WriteOnly) || file.write(hash) != hash.size()) {
+        LOGW() << "failed save the job hash: " << file.fileName();
+    }
+}
+
+//! NOTE The conversion isn't thread safe (the engraving has global state),
+//! so the jobs are shared out among converter processes running in the job server mode.
+//! Each process loads the fonts, styles and so on once and then converts all of its jobs
+mu::Ret ConverterController::batchConvertInWorkers(const BatchJob& batchJob, size_t workerCount) const
+{
+    TRACEFUNC;
+
+    QStringList args = QCoreApplication::arguments();
+    const QString program = QCoreApplication::applicationFilePath();
+    if (!args.isEmpty()) {
+        args.removeFirst();
+    }
+
+    //! NOTE The workers get the same options, but take the jobs from the stdin
+    auto removeOption = [&args](const QString& option) {
+        for (int i = 0; i < args.size();) {
+            if (args[i] == option) {
+                args.erase(args.begin() + i, args.begin() + std::min(i + 2, int(args.size())));
+            } else if (args[i].startsWith(option + "=")) {
+                args.removeAt(i);
+            } else {
+                ++i;
+            }
+        }
+    };
+
+    removeOption("-j");
+    removeOption("--job");
+    removeOption("--job-workers");
+    args << JOB_SERVER_OPTION;
+
+    workerCount = std::min(workerCount, batchJob.size());
+
+    //! NOTE The jobs of an input go to one worker, one after another,
+    //! so that the worker loads the input once for all of them
+    std::vector<QByteArray> workerJobs(workerCount);
+    std::map<io::path_t, size_t> inputWorkers;
+    for (const Job& job : batchJob) {
+        auto it = inputWorkers.find(job.in);
+        if (it == inputWorkers.end()) {
+            it = inputWorkers.emplace(job.in, inputWorkers.size() % workerCount).first;
+        }
+
+        QJsonObject obj;
+        obj["in"] = job.in.toQString();
+        obj["out"] = job.out.toQString();
+
+        QByteArray& jobs = workerJobs[it->second];
+        jobs += QJsonDocument(obj).toJson(QJsonDocument::Compact);
+        jobs += '\n';
+    }
+
+    std::vector<std::unique_ptr<QProcess> > workers;
+    for (const QByteArray& jobs : workerJobs) {
+        auto worker = std::make_unique<QProcess>();
+        worker->setProcessChannelMode(QProcess::ForwardedChannels);
+        worker->start(program, args);
+        if (!worker->waitForStarted()) {
+            LOGE() << "failed start converter worker: " << worker->errorString();
+            continue;
+        }
+
+        //! NOTE All the jobs are written at once, otherwise this worker
+        //! would wait for the input while the others are waited for
+        worker->write(jobs);
+        while (worker->bytesToWrite() > 0 && worker->waitForBytesWritten(-1)) {
+        }
+        worker->closeWriteChannel();
+
+        workers.push_back(std::move(worker));
+    }
+
+    bool ok = workers.size() == workerCount;
+    for (std::unique_ptr<QProcess>& worker : workers) {
+        worker->waitForFinished(-1);
+        if (worker->exitStatus() != QProcess::NormalExit || worker->exitCode() != 0) {
+            LOGE() << "converter worker failed, exit code: " << worker->exitCode();
+            ok = false;
+        }
+    }
+
+    return ok ? make_ret(Ret::Code::Ok) : make_ret(Err::BatchJobWorkerFailed);
+}
+
+//! NOTE Reads the jobs from the stdin, one JSON object per line, e.g. {"in": "a.mscz", "out": "a.pdf"},
+//! and prints the result of each job to the stdout as soon as it's done, until the end of the input
+mu::Ret ConverterController::serveJobs(const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    Ret result = make_ret(Ret::Code::Ok);
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        QJsonParseError err;
+        QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &err);
+        Job job = doc.isObject() ? parseJob(doc.object()) : Job();
+
+        Ret ret;
+        if (err.error != QJsonParseError::NoError || job.in.empty() || job.out.empty()) {
+            ret = make_ret(Err::BatchJobFileFailedParse, err.errorString().toStdString());
+        } else {
+            ret = fileConvert(job.in, job.out, stylePath, forceMode);
+        }
+
+        if (!ret) {
+            LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
+            result = ret;
+        }
+
+        QJsonObject reply;
+        reply["in"] = job.in.toQString();
+        reply["out"] = job.out.toQString();
+        reply["code"] = ret.code();
+        std::cout << QJsonDocument(reply).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+    }
+
+    m_loadedProject = LoadedProject();
+
+    return result;
+}
+
 mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC;
 
     LOGI() << "in: " << in << ", out: " << out;
-    auto notationProject = notationCreator()->newProject();
-    IF_ASSERT_FAILED(notationProject) {
-        return make_ret(Err::UnknownError);
-    }
 
     std::string suffix = io::suffix(out);
     auto writer = writers()->writer(suffix);
@@ -78,14 +312,16 @@ mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t&
         return make_ret(Err::ConvertTypeUnknown);
     }
 
-    Ret ret = notationProject->load(in, stylePath, forceMode);
-    if (!ret) {
-        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
-        return make_ret(Err::InFileFailedLoad);
+    RetVal<INotationProjectPtr> loaded = loadProject(in, stylePath, forceMode);
+    if (!loaded.ret) {
+        return loaded.ret;
     }
 
+    INotationProjectPtr notationProject = loaded.val;
     globalContext()->setCurrentProject(notationProject);
 
+    Ret ret;
+
     if (isConvertPageByPage(suffix)) {
         ret = convertPageByPage(writer, notationProject->masterNotation()->notation(), out);
     } else {
@@ -100,23 +336,20 @@ mu::Ret ConverterController::convertScoreParts(const mu::io::path_t& in, const m
 {
     TRACEFUNC;
 
-    auto notationProject = notationCreator()->newProject();
-    IF_ASSERT_FAILED(notationProject) {
-        return make_ret(Err::UnknownError);
-    }
-
     std::string suffix = io::suffix(out);
     auto writer = writers()->writer(suffix);
     if (!writer) {
         return make_ret(Err::ConvertTypeUnknown);
     }
 
-    Ret ret = notationProject->load(in, stylePath, forceMode);
-    if (!ret) {
-        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
-        return make_ret(Err::InFileFailedLoad);
+    RetVal<INotationProjectPtr> loaded = loadProject(in, stylePath, forceMode);
+    if (!loaded.ret) {
+        return loaded.ret;
     }
 
+    INotationProjectPtr notationProject = loaded.val;
+
+    Ret ret;
     if (suffix == PDF_SUFFIX) {
         ret = convertScorePartsToPdf(writer, notationProject->masterNotation(), out);
     } else if (suffix == PNG_SUFFIX) {
@@ -128,6 +361,36 @@ mu::Ret ConverterController::convertScoreParts(const mu::io::path_t& in, const m
     return make_ret(Ret::Code::Ok);
 }
 
+mu::RetVal<INotationProjectPtr> ConverterController::loadProject(const io::path_t& in, const io::path_t& stylePath, bool forceMode)
+{
+    if (m_loadedProject.project && m_loadedProject.in == in && m_loadedProject.stylePath == stylePath
+        && m_loadedProject.forceMode == forceMode) {
+        LOGI() << "the project is already loaded: " << in;
+        return RetVal<INotationProjectPtr>::make_ok(m_loadedProject.project);
+    }
+
+    //! NOTE Frees the previous project before loading the next one
+    m_loadedProject = LoadedProject();
+
+    auto notationProject = notationCreator()->newProject();
+    IF_ASSERT_FAILED(notationProject) {
+        return make_ret(Err::UnknownError);
+    }
+
+    Ret ret = notationProject->load(in, stylePath, forceMode);
+    if (!ret) {
+        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
+        return make_ret(Err::InFileFailedLoad);
+    }
+
+    m_loadedProject.in = in;
+    m_loadedProject.stylePath = stylePath;
+    m_loadedProject.forceMode = forceMode;
+    m_loadedProject.project = notationProject;
+
+    return RetVal<INotationProjectPtr>::make_ok(notationProject);
+}
+
 mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const io::path_t& batchJobFile) const
 {
     TRACEFUNC;
@@ -150,12 +413,7 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
     QJsonArray arr = doc.array();
 
     for (const QJsonValue v : arr) {
-        QJsonObject obj = v.toObject();
-
-        Job job;
-        job.in = obj["in"].toString();
-        job.out = obj["out"].toString();
-
+        Job job = parseJob(v.toObject());
         if (!job.in.empty() && !job.out.empty()) {
             rv.val.push_back(std::move(job));
         }
@@ -165,6 +423,14 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
     return rv;
 }
 
+ConverterController::Job ConverterController::parseJob(const QJsonObject& obj) const
+{
+    Job job;
+    job.in = obj["in"].toString();
+    job.out = obj["out"].toString();
+    return job;
+}
+
 bool ConverterController::isConvertPageByPage(const std::string& suffix) const
 {
     QList<std::string> types {
@@ -178,27 +444,33 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
+    const size_t pageCount = notation->elements()->pages().size();
+
+    std::vector<std::unique_ptr<QFile> > files;
+    std::vector<QIODevice*> devices;
+    for (size_t i = 0; i < pageCount; i++) {
         const QString filePath = io::path_t(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
 
-        QFile file(filePath);
-        if (!file.open(QFile::WriteOnly)) {
+        auto file = std::make_unique<QFile>(filePath);
+        if (!file->open(QFile::WriteOnly)) {
             return make_ret(Err::OutFileFailedOpen);
         }
 
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-        };
+        file->setProperty("path", out.toQString());
 
-        file.setProperty("path", out.toQString());
+        devices.push_back(file.get());
+        files.push_back(std::move(file));
+    }
 
-        Ret ret = writer->write(notation, file, options);
-        if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
-            return make_ret(Err::OutFileFailedWrite);
-        }
+    //! NOTE The writer may process several pages at a time, so all the files are opened first
+    Ret ret = writer->writePages(notation, devices);
+    if (!ret) {
+        LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
+        return make_ret(Err::OutFileFailedWrite);
+    }
 
-        file.close();
+    for (std::unique_ptr<QFile>& file : files) {
+        file->close();
     }
 
     return make_ret(Ret::Code::Ok);
@@ -353,6 +625,196 @@ mu::Ret ConverterController::exportScoreVideo(const io::path_t& in, const io::pa
     return make_ret(Ret::Code::Ok);
 }
 
+static mu::draw::DrawDataPtr paintDrawData(INotationPtr notation, int page, const std::string& name)
+{
+    auto provider = std::make_shared<mu::draw::BufferedPaintProvider>();
+
+    {
+        mu::draw::Painter painter(provider, name);
+
+        INotationPainting::Options opt;
+        opt.fromPage = page;
+        opt.toPage = page;
+        opt.deviceDpi = static_cast<int>(mu::engraving::DPI);
+        opt.printPageBackground = false;
+
+        notation->painting()->paintPng(&painter, opt);
+    }
+
+    return std::make_shared<mu::draw::DrawData>(provider->takeDrawData());
+}
+
+static mu::Ret writeDrawData(const mu::ByteArray& data, const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data.toQByteArrayNoCopy()) != static_cast<qint64>(data.size())) {
+        return make_ret(Err::OutFileFailedWrite);
+    }
+
+    return mu::make_ok();
+}
+
+//! NOTE Writes the draw data of the page and compares it with the reference, returns the report line if they differ.
+//! The snapshots are binary to keep them small and fast to compare, the diffs are JSON to be readable
+static std::string processDrawData(const mu::draw::DrawDataPtr& data, const QString& outDir, const QString& referenceDir)
+{
+    const QString name = QString::fromStdString(data->name);
+    const mu::ByteArray bin = mu::draw::DrawBufferBinary::toBinary(*data);
+
+    mu::Ret ret = writeDrawData(bin, outDir + "/" + name + ".drawdata");
+    if (!ret) {
+        return data->name + ": failed write";
+    }
+
+    if (referenceDir.isEmpty()) {
+        return std::string();
+    }
+
+    QFile referenceFile(referenceDir + "/" + name + ".drawdata");
+    if (!referenceFile.open(QIODevice::ReadOnly)) {
+        return data->name + ": no reference";
+    }
+
+    mu::RetVal<mu::draw::Diff> diff
+        = mu::draw::DrawBufferBinary::compare(bin, mu::ByteArray::fromQByteArray(referenceFile.readAll()));
+    if (!diff.ret) {
+        return data->name + ": failed read the reference";
+    }
+
+    if (diff.val.empty()) {
+        return std::string();
+    }
+
+    if (diff.val.dataAdded) {
+        writeDrawData(mu::draw::DrawBufferJson::toJson(*diff.val.dataAdded), outDir + "/" + name + ".added.json");
+    }
+
+    if (diff.val.dataRemoved) {
+        writeDrawData(mu::draw::DrawBufferJson::toJson(*diff.val.dataRemoved), outDir + "/" + name + ".removed.json");
+    }
+
+    return data->name + ": differs";
+}
+
+mu::Ret ConverterController::visualTest(const io::path_t& scoresDir, const io::path_t& outDir, const io::path_t& referenceDir,
+                                        const io::path_t& stylePath)
+{
+    TRACEFUNC;
+
+    const QString outDirPath = outDir.toQString();
+    if (!QDir().mkpath(outDirPath)) {
+        return make_ret(Err::OutFileFailedOpen);
+    }
+
+    const QString referenceDirPath = referenceDir.toQString();
+    const QStringList scores = QDir(scoresDir.toQString()).entryList(QDir::Files, QDir::Name);
+
+    //! NOTE Painting the score isn't thread safe, so the pages are painted one by one here,
+    //! and the writing, the reading of the references and the comparing run concurrently.
+    //! The number of pending pages is limited to keep the memory bounded on big score sets
+    const size_t maxPendingPages = 2 * std::max(1, QThread::idealThreadCount());
+
+    std::deque<QFuture<std::string> > pendingPages;
+    std::vector<std::string> report;
+
+    auto takeFirstPendingPage = [&pendingPages, &report]() {
+        std::string line = pendingPages.front().result();
+        if (!line.empty()) {
+            report.push_back(std::move(line));
+        }
+
+        pendingPages.pop_front();
+    };
+
+    for (const QString& score : scores) {
+        const io::path_t in = scoresDir + "/" + score;
+
+        RetVal<INotationProjectPtr> loaded = loadProject(in, stylePath, false);
+        if (!loaded.ret) {
+            report.push_back(score.toStdString() + ": failed load");
+            continue;
+        }
+
+        INotationPtr notation = loaded.val->masterNotation()->notation();
+        const std::string baseName = io::basename(in).toStdString();
+
+        for (int page = 0; page < notation->painting()->pageCount(); ++page) {
+            draw::DrawDataPtr data = paintDrawData(notation, page, baseName + "-" + std::to_string(page + 1));
+
+            if (pendingPages.size() >= maxPendingPages) {
+                takeFirstPendingPage();
+            }
+
+            pendingPages.push_back(QtConcurrent::run([data, outDirPath, referenceDirPath]() {
+                return processDrawData(data, outDirPath, referenceDirPath);
+            }));
+        }
+    }
+
+    while (!pendingPages.empty()) {
+        takeFirstPendingPage();
+    }
+
+    m_loadedProject = LoadedProject();
+
+    QFile reportFile(outDirPath + "/vtest_report.txt");
+    if (reportFile.open(QIODevice::WriteOnly)) {
+        for (const std::string& line : report) {
+            reportFile.write(QByteArray::fromStdString(line + "\n"));
+        }
+    }
+
+    if (!report.empty()) {
+        LOGE() << "visual test found " << report.size() << " problems, see: " << reportFile.fileName();
+        return make_ret(Err::VisualTestDiffFound);
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::scoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out,
+                                       const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    RetVal<INotationProjectPtr> project1 = loadProject(in1, stylePath, forceMode);
+    if (!project1.ret) {
+        return project1.ret;
+    }
+
+    //! NOTE The first project is kept by project1 while the second one is loaded
+    RetVal<INotationProjectPtr> project2 = loadProject(in2, stylePath, forceMode);
+    if (!project2.ret) {
+        return project2.ret;
+    }
+
+    mu::engraving::ScoreDiff diff(project1.val->masterNotation()->notation()->elements()->msScore(),
+                                  project2.val->masterNotation()->notation()->elements()->msScore());
+    diff.update();
+
+    const QByteArray report = diff.report().toQString().toUtf8();
+
+    if (out.empty()) {
+        std::cout << report.toStdString();
+    } else {
+        QFile file(out.toQString());
+        if (!file.open(QIODevice::WriteOnly)) {
+            return make_ret(Err::OutFileFailedOpen);
+        }
+
+        if (file.write(report) != report.size()) {
+            return make_ret(Err::OutFileFailedWrite);
+        }
+    }
+
+    if (!diff.equal()) {
+        LOGI() << diff.changes().size() << " measures differ between " << in1 << " and " << in2;
+        return make_ret(Err::ScoreDiffFound);
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
 mu::Ret ConverterController::updateSource(const io::path_t& in, const std::string& newSource, bool forceMode)
 {
     TRACEFUNC;
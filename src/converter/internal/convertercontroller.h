@@ -24,6 +24,8 @@
 
 #include <list>
 
+#include <QJsonObject>
+
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
@@ -47,7 +49,9 @@ public:
 
     Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                     bool forceMode = false) override;
-    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                     size_t workerCount = 1, bool incremental = false) override;
+    Ret serveJobs(const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
 
@@ -65,6 +69,12 @@ public:
 
     Ret exportScoreVideo(const io::path_t& in, const io::path_t& out) override;
 
+    Ret visualTest(const io::path_t& scoresDir, const io::path_t& outDir, const io::path_t& referenceDir = io::path_t(),
+                   const io::path_t& stylePath = io::path_t()) override;
+
+    Ret scoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out = io::path_t(),
+                  const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+
     Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) override;
 
 private:
@@ -76,7 +86,25 @@ private:
 
     using BatchJob = std::list<Job>;
 
+    //! NOTE The jobs of a batch often convert the same input to several outputs,
+    //! so the last loaded (and laid out) project is kept for the next job
+    struct LoadedProject {
+        io::path_t in;
+        io::path_t stylePath;
+        bool forceMode = false;
+        project::INotationProjectPtr project;
+    };
+
+    RetVal<project::INotationProjectPtr> loadProject(const io::path_t& in, const io::path_t& stylePath, bool forceMode);
+
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
+    Job parseJob(const QJsonObject& obj) const;
+    Ret batchConvertInWorkers(const BatchJob& batchJob, size_t workerCount) const;
+
+    RetVal<QByteArray> jobHash(const Job& job, const io::path_t& stylePath) const;
+    io::path_t jobHashFilePath(const Job& job) const;
+    bool isJobUpToDate(const Job& job, const QByteArray& hash) const;
+    void saveJobHash(const Job& job, const QByteArray& hash) const;
 
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
@@ -86,6 +114,8 @@ private:
                                const io::path_t& out) const;
     Ret convertScorePartsToPngs(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                 const io::path_t& out) const;
+
+    LoadedProject m_loadedProject;
 };
 }
 
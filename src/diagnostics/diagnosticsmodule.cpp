@@ -33,6 +33,7 @@
 #include "internal/diagnosticsactionscontroller.h"
 #include "internal/diagnosticspathsregister.h"
 #include "internal/engravingelementsprovider.h"
+#include "internal/inputlatencyregister.h"
 
 #include "internal/crashhandler/crashhandler.h"
 
@@ -69,6 +70,7 @@ void DiagnosticsModule::registerExports()
 {
     ioc()->registerExport<IDiagnosticsPathsRegister>(moduleName(), new DiagnosticsPathsRegister());
     ioc()->registerExport<EngravingElementsProvider>(moduleName(), new EngravingElementsProvider());
+    ioc()->registerExport<IInputLatencyRegister>(moduleName(), new InputLatencyRegister());
 }
 
 void DiagnosticsModule::resolveImports()
@@ -42,6 +42,9 @@ public:
     virtual void clearStatistic() = 0;
     virtual void printStatistic(const std::string& title) = 0;
 
+    //! NOTE The alive elements of each score (the master and the excerpts) and the undo memory
+    virtual std::string scoresStatistic() const = 0;
+
     // register
     virtual void reg(const mu::engraving::EngravingObject* e) = 0;
     virtual void unreg(const mu::engraving::EngravingObject* e) = 0;
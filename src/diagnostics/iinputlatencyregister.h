@@ -0,0 +1,49 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DIAGNOSTICS_IINPUTLATENCYREGISTER_H
+#define MU_DIAGNOSTICS_IINPUTLATENCYREGISTER_H
+
+#include <string>
+#include <vector>
+
+#include "modularity/imoduleexport.h"
+
+namespace mu::diagnostics {
+//! NOTE Measures the time from an input (a keystroke, a click or a midi note)
+//! to the first paint of the notation after it.
+//! The stages in between are marked with the time elapsed since the input
+class IInputLatencyRegister : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IInputLatencyRegister)
+public:
+    virtual ~IInputLatencyRegister() = default;
+
+    virtual void beginInput(const std::string& source) = 0;
+    virtual void markStage(const std::string& stage) = 0;
+    virtual void endInput() = 0;
+
+    virtual std::vector<std::string> statistic() const = 0;
+    virtual void clear() = 0;
+};
+}
+
+#endif // MU_DIAGNOSTICS_IINPUTLATENCYREGISTER_H
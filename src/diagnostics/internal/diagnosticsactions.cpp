@@ -58,6 +58,16 @@ const UiActionList DiagnosticsActions::m_actions = {
              mu::context::UiCtxAny,
              mu::context::CTX_ANY,
              TranslatableString("action", "Engraving &elements")
+             ),
+    UiAction("diagnostic-input-latency-dump",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Input &latency dump")
+             ),
+    UiAction("diagnostic-memory-dump",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("&Memory dump")
              )
 };
 
@@ -22,9 +22,12 @@
 #include "diagnosticsactionscontroller.h"
 
 #include "types/uri.h"
+#include "allocator.h"
 
 #include "view/diagnosticaccessiblemodel.h"
 
+#include "log.h"
+
 using namespace mu::diagnostics;
 using namespace mu::accessibility;
 
@@ -42,6 +45,24 @@ void DiagnosticsActionsController::init()
     dispatcher()->reg(this, "diagnostic-show-accessible-tree", [this]() { openUri(ACCESSIBLE_TREE_URI); });
     dispatcher()->reg(this, "diagnostic-accessible-tree-dump", []() { DiagnosticAccessibleModel::dumpTree(); });
     dispatcher()->reg(this, "diagnostic-show-engraving-elements", [this]() { openUri(ENGRAVING_ELEMENTS_URI, false); });
+    dispatcher()->reg(this, "diagnostic-input-latency-dump", [this]() { dumpInputLatency(); });
+    dispatcher()->reg(this, "diagnostic-memory-dump", [this]() { dumpMemory(); });
+}
+
+void DiagnosticsActionsController::dumpInputLatency()
+{
+    for (const std::string& line : inputLatencyRegister()->statistic()) {
+        LOGI() << line;
+    }
+}
+
+void DiagnosticsActionsController::dumpMemory()
+{
+    AllocatorsRegister::instance()->printMemory("=== Memory of the object allocators ===");
+
+    if (elementsProvider()) {
+        LOGI() << "\n\n=== Alive elements per score ===\n" << elementsProvider()->scoresStatistic() << '\n';
+    }
 }
 
 void DiagnosticsActionsController::openUri(const mu::UriQuery& uri, bool isSingle)
@@ -27,12 +27,16 @@
 #include "actions/actionable.h"
 #include "iinteractive.h"
 #include "accessibility/iaccessibilitycontroller.h"
+#include "../iinputlatencyregister.h"
+#include "../iengravingelementsprovider.h"
 
 namespace mu::diagnostics {
 class DiagnosticsActionsController : public actions::Actionable
 {
     INJECT(diagnostics, actions::IActionsDispatcher, dispatcher)
     INJECT(diagnostics, framework::IInteractive, interactive)
+    INJECT(diagnostics, IInputLatencyRegister, inputLatencyRegister)
+    INJECT(diagnostics, IEngravingElementsProvider, elementsProvider)
 
 public:
     DiagnosticsActionsController() = default;
@@ -41,6 +45,8 @@ public:
 
 private:
     void openUri(const mu::UriQuery& uri, bool isSingle = true);
+    void dumpInputLatency();
+    void dumpMemory();
 };
 }
 
@@ -21,11 +21,13 @@
  */
 #include "engravingelementsprovider.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "stringutils.h"
 
 #include "engraving/libmscore/score.h"
+#include "engraving/libmscore/undo.h"
 
 #include "log.h"
 
@@ -66,6 +68,47 @@ void EngravingElementsProvider::printStatistic(const std::string& title)
     LOGD() << stream.str() << '\n';
 }
 
+std::string EngravingElementsProvider::scoresStatistic() const
+{
+    struct ScoreStatistic
+    {
+        size_t elementCount = 0;
+        std::map<std::string, size_t> types;
+    };
+
+    std::map<const mu::engraving::Score*, ScoreStatistic> scores;
+    for (const mu::engraving::EngravingObject* e : m_elements) {
+        ScoreStatistic& s = scores[e->score()];
+        s.elementCount++;
+        s.types[e->typeName()]++;
+    }
+
+    static constexpr size_t TOP_TYPES_COUNT = 5;
+
+    std::stringstream stream;
+    stream << TITLE("Score") << TITLE("Elements") << TITLE("Undo bytes") << "Most frequent\n";
+    for (const auto& pair : scores) {
+        const mu::engraving::Score* score = pair.first;
+        const ScoreStatistic& s = pair.second;
+
+        std::vector<std::pair<std::string, size_t> > types(s.types.begin(), s.types.end());
+        std::sort(types.begin(), types.end(), [](const auto& t1, const auto& t2) { return t1.second > t2.second; });
+        types.resize(std::min(types.size(), TOP_TYPES_COUNT));
+
+        std::string name = !score ? std::string("(no score)") : (score->isMaster() ? std::string("(master)") : score->name().toStdString());
+        //! NOTE The excerpts share the undo stack of the master
+        size_t undoBytes = score && score->isMaster() && score->undoStack() ? score->undoStack()->memoryUsage() : 0;
+
+        stream << FORMAT(name, 20) << VALUE(s.elementCount) << VALUE(undoBytes);
+        for (const auto& type : types) {
+            stream << type.first << ": " << type.second << "  ";
+        }
+        stream << "\n";
+    }
+
+    return stream.str();
+}
+
 void EngravingElementsProvider::reg(const mu::engraving::EngravingObject* e)
 {
     m_elements.insert(e);
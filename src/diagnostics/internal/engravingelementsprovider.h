@@ -41,6 +41,7 @@ public:
     // statistic
     void clearStatistic() override;
     void printStatistic(const std::string& title) override;
+    std::string scoresStatistic() const override;
 
     // register
     void reg(const mu::engraving::EngravingObject* e) override;
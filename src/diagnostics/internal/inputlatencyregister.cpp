@@ -0,0 +1,171 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "inputlatencyregister.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+using namespace mu::diagnostics;
+
+//! NOTE A frame at 60 Hz takes about 16 ms, so the first buckets are in frames
+static const std::vector<double> HISTOGRAM_BOUNDS_MS = { 8.0, 16.0, 33.0, 50.0, 100.0, 200.0 };
+static constexpr size_t HISTOGRAM_BAR_WIDTH = 40;
+
+//! NOTE An input which is not followed by any stage (e.g. it didn't change anything) is dropped after this time
+static constexpr double MAX_INPUT_DURATION_MS = 1000.0;
+
+static std::string formatMs(double ms)
+{
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(1) << ms << " ms";
+    return stream.str();
+}
+
+double InputLatencyRegister::elapsedMs() const
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - m_inputStart).count();
+}
+
+void InputLatencyRegister::beginInput(const std::string& source)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    //! NOTE If several inputs come before a paint, the latency is measured from the first of them
+    if (m_inputActive && elapsedMs() < MAX_INPUT_DURATION_MS) {
+        return;
+    }
+
+    m_inputActive = true;
+    m_inputStart = Clock::now();
+    m_inputSource = source;
+    m_inputStages.clear();
+}
+
+void InputLatencyRegister::markStage(const std::string& stage)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_inputActive) {
+        return;
+    }
+
+    m_inputStages[stage] = elapsedMs();
+}
+
+void InputLatencyRegister::endInput()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    //! NOTE A paint before the input is processed (e.g. the midi events are queued) doesn't show it yet
+    if (!m_inputActive || m_inputStages.empty()) {
+        return;
+    }
+
+    m_inputActive = false;
+
+    double totalMs = elapsedMs();
+
+    m_history[m_historyNext] = totalMs;
+    m_historyNext = (m_historyNext + 1) % HISTORY_SIZE;
+    m_historySize = std::min(m_historySize + 1, HISTORY_SIZE);
+
+    for (const auto& stage : m_inputStages) {
+        StageStat& stat = m_stages[stage.first];
+        stat.sumMs += stage.second;
+        stat.maxMs = std::max(stat.maxMs, stage.second);
+        ++stat.count;
+    }
+
+    ++m_sources[m_inputSource];
+}
+
+std::vector<std::string> InputLatencyRegister::statistic() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<std::string> result;
+
+    if (m_historySize == 0) {
+        result.push_back("no input was measured");
+        return result;
+    }
+
+    std::stringstream inputs;
+    inputs << "measured inputs: " << m_historySize << " last of";
+    for (const auto& source : m_sources) {
+        inputs << (source.first == m_sources.begin()->first ? " " : ", ") << source.first << ": " << source.second;
+    }
+    result.push_back(inputs.str());
+
+    std::vector<double> history(m_history.begin(), m_history.begin() + m_historySize);
+    std::sort(history.begin(), history.end());
+
+    auto percentile = [&history](double p) {
+        size_t index = static_cast<size_t>(p * static_cast<double>(history.size() - 1));
+        return history.at(index);
+    };
+
+    result.push_back("input to paint: median " + formatMs(percentile(0.5))
+                     + ", 95% " + formatMs(percentile(0.95))
+                     + ", max " + formatMs(history.back()));
+
+    for (const auto& stage : m_stages) {
+        const StageStat& stat = stage.second;
+        result.push_back(stage.first + " done after: average " + formatMs(stat.sumMs / static_cast<double>(stat.count))
+                         + ", max " + formatMs(stat.maxMs));
+    }
+
+    std::vector<size_t> buckets(HISTOGRAM_BOUNDS_MS.size() + 1, 0);
+    for (double ms : history) {
+        size_t bucket = std::upper_bound(HISTOGRAM_BOUNDS_MS.begin(), HISTOGRAM_BOUNDS_MS.end(), ms) - HISTOGRAM_BOUNDS_MS.begin();
+        ++buckets[bucket];
+    }
+
+    size_t maxCount = *std::max_element(buckets.begin(), buckets.end());
+
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        std::stringstream line;
+        if (i < HISTOGRAM_BOUNDS_MS.size()) {
+            line << "< " << std::setw(4) << HISTOGRAM_BOUNDS_MS[i] << " ms: ";
+        } else {
+            line << ">= " << std::setw(3) << HISTOGRAM_BOUNDS_MS.back() << " ms: ";
+        }
+
+        line << std::setw(4) << buckets[i] << " " << std::string(buckets[i] * HISTOGRAM_BAR_WIDTH / maxCount, '#');
+        result.push_back(line.str());
+    }
+
+    return result;
+}
+
+void InputLatencyRegister::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_inputActive = false;
+    m_inputStages.clear();
+    m_stages.clear();
+    m_sources.clear();
+    m_historySize = 0;
+    m_historyNext = 0;
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DIAGNOSTICS_INPUTLATENCYREGISTER_H
+#define MU_DIAGNOSTICS_INPUTLATENCYREGISTER_H
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+#include "../iinputlatencyregister.h"
+
+namespace mu::diagnostics {
+class InputLatencyRegister : public IInputLatencyRegister
+{
+public:
+    InputLatencyRegister() = default;
+
+    void beginInput(const std::string& source) override;
+    void markStage(const std::string& stage) override;
+    void endInput() override;
+
+    std::vector<std::string> statistic() const override;
+    void clear() override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    //! NOTE The histogram is built from the last inputs only, so it follows the current state of the app
+    static constexpr size_t HISTORY_SIZE = 256;
+
+    struct StageStat {
+        double sumMs = 0.0;
+        double maxMs = 0.0;
+        size_t count = 0;
+    };
+
+    double elapsedMs() const;
+
+    mutable std::mutex m_mutex;
+
+    bool m_inputActive = false;
+    Clock::time_point m_inputStart;
+    std::string m_inputSource;
+    std::map<std::string, double> m_inputStages;
+
+    std::map<std::string, StageStat> m_stages;
+    std::map<std::string, size_t> m_sources;
+
+    std::array<double, HISTORY_SIZE> m_history {};
+    size_t m_historySize = 0;
+    size_t m_historyNext = 0;
+};
+}
+
+#endif // MU_DIAGNOSTICS_INPUTLATENCYREGISTER_H
@@ -88,6 +88,15 @@ void ProfilerViewModel::reload()
         m_allList.append(item);
     }
 
+    group = "Input latency";
+    for (const std::string& data : inputLatencyRegister()->statistic()) {
+        Item item;
+        item.group = group;
+        item.data = QString::fromStdString(data);
+
+        m_allList.append(item);
+    }
+
     find(m_searchText);
 }
 
@@ -114,6 +123,7 @@ void ProfilerViewModel::find(const QString& str)
 void ProfilerViewModel::clear()
 {
     PROFILER_CLEAR;
+    inputLatencyRegister()->clear();
     reload();
 }
 
@@ -24,10 +24,16 @@
 
 #include <QAbstractListModel>
 
+#include "modularity/ioc.h"
+#include "../../iinputlatencyregister.h"
+
 namespace mu::diagnostics {
 class ProfilerViewModel : public QAbstractListModel
 {
     Q_OBJECT
+
+    INJECT(diagnostics, IInputLatencyRegister, inputLatencyRegister)
+
 public:
     explicit ProfilerViewModel(QObject* parent = 0);
 
@@ -69,7 +69,7 @@ AccessibleItemWeakPtr AccessibleRoot::focusedElement() const
 
 void AccessibleRoot::notifyAboutFocusedElementNameChanged()
 {
-    m_staffInfo = "";
+    resetStaffInfo();
 
     if (auto focusedElement = m_focusedElement.lock()) {
         focusedElement->accessiblePropertyChanged().send(accessibility::IAccessible::Property::Name, Val());
@@ -117,13 +117,39 @@ void AccessibleRoot::setEnabled(bool enabled)
 
 QString AccessibleRoot::staffInfo() const
 {
+    //! NOTE The staff info is only built when the screen reader asks for the name
+    AccessibleItemPtr item = m_staffInfoItem.lock();
+    if (!item || m_staffInfoValid) {
+        return m_staffInfo;
+    }
+
+    m_staffInfoValid = true;
+
+    const EngravingItem* element = item->element();
+    if (!element || !element->staff()) {
+        return m_staffInfo;
+    }
+
+    QString staff = qtrc("engraving", "Staff %1").arg(QString::number(element->staffIdx() + 1));
+
+    QString staffName = element->staff()->part()->longName(element->tick());
+    if (staffName.isEmpty()) {
+        staffName = element->staff()->partName();
+    }
+
+    if (staffName.isEmpty()) {
+        m_staffInfo = staff;
+    } else {
+        m_staffInfo = QString("%2 (%3)").arg(staff, staffName);
+    }
+
     return m_staffInfo;
 }
 
 void AccessibleRoot::updateStaffInfo(const AccessibleItemWeakPtr newAccessibleItem, const AccessibleItemWeakPtr oldAccessibleItem,
                                      bool voiceStaffInfoChange)
 {
-    m_staffInfo = "";
+    resetStaffInfo();
 
     if (!voiceStaffInfoChange) {
         return;
@@ -137,23 +163,18 @@ void AccessibleRoot::updateStaffInfo(const AccessibleItemWeakPtr newAccessibleIt
         staff_idx_t oldStaffIdx = oldItem ? oldItem->element()->staffIdx() : nidx;
 
         if (newStaffIdx != oldStaffIdx) {
-            auto element = newItem->element();
-            QString staff = qtrc("engraving", "Staff %1").arg(QString::number(element->staffIdx() + 1));
-
-            QString staffName = element->staff()->part()->longName(element->tick());
-            if (staffName.isEmpty()) {
-                staffName = element->staff()->partName();
-            }
-
-            if (staffName.isEmpty()) {
-                m_staffInfo = staff;
-            } else {
-                m_staffInfo = QString("%2 (%3)").arg(staff, staffName);
-            }
+            m_staffInfoItem = newItem;
         }
     }
 }
 
+void AccessibleRoot::resetStaffInfo()
+{
+    m_staffInfoItem.reset();
+    m_staffInfo.clear();
+    m_staffInfoValid = false;
+}
+
 QString AccessibleRoot::commandInfo() const
 {
     return m_commandInfo;
@@ -61,6 +61,7 @@ public:
     QString rangeSelectionInfo();
 
 private:
+    void resetStaffInfo();
 
     bool m_enabled = false;
 
@@ -68,7 +69,9 @@ private:
 
     AccessibleMapToScreenFunc m_accessibleMapToScreenFunc;
 
-    QString m_staffInfo;
+    AccessibleItemWeakPtr m_staffInfoItem;
+    mutable QString m_staffInfo;
+    mutable bool m_staffInfoValid = false;
     QString m_commandInfo;
 };
 }
@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//! NOTE Representative vtest scores: large multi-staff, dense polyrhythms,
+//! cross-staff beaming, kerning-heavy and long mmrest scores.
+static const std::vector<String> BENCHMARK_SCORES = {
+    u"mmrest-12.mscx",
+    u"polyrythm-1.mscz",
+    u"kerning-3.mscz",
+    u"cross-5.mscz",
+    u"articulation-4.mscz",
+    u"slurs-11.mscz",
+};
+
+//! NOTE The number of iterations per case can be raised via MU_BENCHMARK_ITERATIONS
+//! to get stable numbers; the default keeps the suite cheap enough for ctest.
+static int benchmarkIterations()
+{
+    static const int iterations = []() {
+        const char* env = std::getenv("MU_BENCHMARK_ITERATIONS");
+        int value = env ? std::atoi(env) : 0;
+        return value > 0 ? value : 3;
+    }();
+
+    return iterations;
+}
+
+//! NOTE Peak resident set size of the process in KiB, 0 if unavailable
+static long peakMemoryKb()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+class Engraving_LayoutBenchmarks : public ::testing::Test
+{
+public:
+    void measure(const String& scoreName, const char* caseName, const std::function<void(MasterScore*)>& func);
+};
+
+//---------------------------------------------------------
+//   measure
+//    Runs func on a freshly loaded score for the configured
+//    number of iterations and reports min/avg time and the
+//    peak memory in a greppable form:
+//    BENCHMARK <case> <score> min_ms=... avg_ms=... peak_kb=...
+//---------------------------------------------------------
+
+void Engraving_LayoutBenchmarks::measure(const String& scoreName, const char* caseName,
+                                         const std::function<void(MasterScore*)>& func)
+{
+    MasterScore* score = ScoreRW::readScore(scoreName);
+    ASSERT_TRUE(score);
+
+    using clock = std::chrono::steady_clock;
+
+    const int iterations = benchmarkIterations();
+    double totalMs = 0.0;
+    double minMs = 0.0;
+
+    for (int i = 0; i < iterations; ++i) {
+        clock::time_point start = clock::now();
+        func(score);
+        double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+        totalMs += ms;
+        minMs = (i == 0) ? ms : std::min(minMs, ms);
+    }
+
+    LOGI() << "BENCHMARK " << caseName << " " << scoreName
+           << " min_ms=" << minMs
+           << " avg_ms=" << (totalMs / iterations)
+           << " peak_kb=" << peakMemoryKb();
+
+    delete score;
+}
+
+TEST_F(Engraving_LayoutBenchmarks, FullLayout)
+{
+    for (const String& name : BENCHMARK_SCORES) {
+        measure(name, "full_layout", [](MasterScore* score) {
+            score->doLayout();
+        });
+    }
+}
+
+TEST_F(Engraving_LayoutBenchmarks, RangeRelayout)
+{
+    for (const String& name : BENCHMARK_SCORES) {
+        measure(name, "range_relayout", [](MasterScore* score) {
+            //! NOTE Relayout a single measure in the middle of the score,
+            //! which is what a typical edit triggers
+            Measure* m = score->firstMeasure();
+            for (size_t i = 0; m && i < score->nmeasures() / 2; ++i) {
+                m = m->nextMeasure();
+            }
+            if (m) {
+                score->doLayoutRange(m->tick(), m->endTick());
+            }
+        });
+    }
+}
+
+TEST_F(Engraving_LayoutBenchmarks, LayoutModeSwitch)
+{
+    for (const String& name : BENCHMARK_SCORES) {
+        measure(name, "layout_mode_switch", [](MasterScore* score) {
+            score->setLayoutMode(LayoutMode::LINE);
+            score->doLayout();
+            score->setLayoutMode(LayoutMode::PAGE);
+            score->doLayout();
+        });
+    }
+}
@@ -22,10 +22,12 @@
 #include "mscreader.h"
 
 #include "io/file.h"
+#include "io/mappedfile.h"
 #include "io/fileinfo.h"
 #include "io/dir.h"
 #include "serialization/zipreader.h"
 #include "serialization/xmlstreamreader.h"
+#include "concurrency/taskscheduler.h"
 
 #include "log.h"
 
@@ -136,22 +138,37 @@ String MscReader::mainFileName() const
     return completeBaseName + u".mscx";
 }
 
+String MscReader::findScoreFileName() const
+{
+    StringList files = reader()->fileList();
+    for (const String& name : files) {
+        // mscx file in the root dir
+        if (!name.contains(u'/') && name.endsWith(u".mscx", mu::CaseInsensitive)) {
+            return name;
+        }
+    }
+
+    return mainFileName();
+}
+
 ByteArray MscReader::readScoreFile() const
 {
-    String mscxFileName = mainFileName();
-    ByteArray data = fileData(mscxFileName);
+    ByteArray data = fileData(mainFileName());
     if (data.empty() && reader()->isContainer()) {
-        StringList files = reader()->fileList();
-        for (const String& name : files) {
-            // mscx file in the root dir
-            if (!name.contains(u'/') && name.endsWith(u".mscx", mu::CaseInsensitive)) {
-                mscxFileName = name;
-                break;
-            }
-        }
+        data = fileData(findScoreFileName());
     }
 
-    return fileData(mscxFileName);
+    return data;
+}
+
+ByteArray MscReader::readScoreFileHead(size_t maxSize) const
+{
+    ByteArray data = reader()->fileDataHead(mainFileName(), maxSize);
+    if (data.empty() && reader()->isContainer()) {
+        data = reader()->fileDataHead(findScoreFileName(), maxSize);
+    }
+
+    return data;
 }
 
 std::vector<String> MscReader::excerptNames() const
@@ -183,6 +200,40 @@ ByteArray MscReader::readExcerptFile(const String& name) const
     return fileData(u"Excerpts/" + name + u"/" + fileName);
 }
 
+std::vector<MscReader::ExcerptFiles> MscReader::readExcerptFiles(const std::vector<String>& names) const
+{
+    std::vector<ExcerptFiles> result(names.size());
+
+    auto readFiles = [this, &names, &result](size_t i) {
+        result[i].name = names[i];
+        result[i].styleData = readExcerptStyleFile(names[i]);
+        result[i].scoreData = readExcerptFile(names[i]);
+    };
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    bool concurrent = names.size() > 1 && reader()->isConcurrentReadSupported()
+                      && scheduler->threadPoolSize() > 1
+                      && !scheduler->containsThread(std::this_thread::get_id());
+
+    if (!concurrent) {
+        for (size_t i = 0; i < names.size(); ++i) {
+            readFiles(i);
+        }
+        return result;
+    }
+
+    std::vector<std::future<void> > tasks;
+    tasks.reserve(names.size());
+    for (size_t i = 0; i < names.size(); ++i) {
+        tasks.push_back(scheduler->submit(readFiles, i));
+    }
+    for (std::future<void>& task : tasks) {
+        task.get();
+    }
+
+    return result;
+}
+
 ByteArray MscReader::readChordListFile() const
 {
     return fileData(u"chordlist.xml");
@@ -246,7 +297,9 @@ bool MscReader::ZipFileReader::open(IODevice* device, const path_t& filePath)
 {
     m_device = device;
     if (!m_device) {
-        m_device = new File(filePath);
+        //! NOTE The file is mapped rather than read, so entries that are never requested
+        //! (e.g. an embedded audio track) are never loaded from disk
+        m_device = new MappedFile(filePath);
         m_selfDeviceOwner = true;
     }
 
@@ -318,6 +371,25 @@ ByteArray MscReader::ZipFileReader::fileData(const String& fileName) const
     return data;
 }
 
+ByteArray MscReader::ZipFileReader::fileDataHead(const String& fileName, size_t maxSize) const
+{
+    IF_ASSERT_FAILED(m_zip) {
+        return ByteArray();
+    }
+
+    ByteArray data = m_zip->fileDataHead(fileName.toStdString(), maxSize);
+    if (m_zip->hasError()) {
+        LOGD() << "failed read data";
+        return ByteArray();
+    }
+    return data;
+}
+
+bool MscReader::ZipFileReader::isConcurrentReadSupported() const
+{
+    return m_zip ? m_zip->isConcurrentReadSupported() : false;
+}
+
 bool MscReader::DirReader::open(IODevice* device, const path_t& filePath)
 {
     if (device) {
@@ -381,6 +453,24 @@ ByteArray MscReader::DirReader::fileData(const String& fileName) const
     return file.readAll();
 }
 
+ByteArray MscReader::DirReader::fileDataHead(const String& fileName, size_t maxSize) const
+{
+    io::path_t filePath = m_rootPath + "/" + fileName;
+    File file(filePath);
+    if (!file.open(IODevice::ReadOnly)) {
+        LOGD() << "failed open file: " << filePath;
+        return ByteArray();
+    }
+
+    return file.read(maxSize);
+}
+
+bool MscReader::DirReader::isConcurrentReadSupported() const
+{
+    //! NOTE Every file is opened separately
+    return true;
+}
+
 bool MscReader::XmlFileReader::open(IODevice* device, const path_t& filePath)
 {
     m_device = device;
@@ -481,3 +571,18 @@ ByteArray MscReader::XmlFileReader::fileData(const String& fileName) const
 
     return ByteArray();
 }
+
+ByteArray MscReader::XmlFileReader::fileDataHead(const String& fileName, size_t maxSize) const
+{
+    //! NOTE The files are stored as text of one document, so it has to be parsed anyway
+    ByteArray data = fileData(fileName);
+    if (data.size() > maxSize) {
+        data.truncate(maxSize);
+    }
+    return data;
+}
+
+bool MscReader::XmlFileReader::isConcurrentReadSupported() const
+{
+    return false;
+}
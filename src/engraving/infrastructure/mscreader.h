@@ -58,10 +58,24 @@ public:
     ByteArray readStyleFile() const;
     ByteArray readScoreFile() const;
 
+    //! NOTE Reads at most maxSize first bytes of the score file,
+    //! for a container the rest of the file is not even decompressed
+    ByteArray readScoreFileHead(size_t maxSize) const;
+
     std::vector<String> excerptNames() const;
     ByteArray readExcerptStyleFile(const String& name) const;
     ByteArray readExcerptFile(const String& name) const;
 
+    struct ExcerptFiles {
+        String name;
+        ByteArray styleData;
+        ByteArray scoreData;
+    };
+
+    //! NOTE Reads the style and score files of the given excerpts,
+    //! concurrently if the container allows it
+    std::vector<ExcerptFiles> readExcerptFiles(const std::vector<String>& names) const;
+
     ByteArray readChordListFile() const;
     ByteArray readThumbnailFile() const;
 
@@ -86,6 +100,8 @@ private:
         virtual bool isContainer() const = 0;
         virtual StringList fileList() const = 0;
         virtual ByteArray fileData(const String& fileName) const = 0;
+        virtual ByteArray fileDataHead(const String& fileName, size_t maxSize) const = 0;
+        virtual bool isConcurrentReadSupported() const = 0;
     };
 
     struct ZipFileReader : public IReader
@@ -97,6 +113,8 @@ private:
         bool isContainer() const override;
         StringList fileList() const override;
         ByteArray fileData(const String& fileName) const override;
+        ByteArray fileDataHead(const String& fileName, size_t maxSize) const override;
+        bool isConcurrentReadSupported() const override;
     private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
@@ -111,6 +129,8 @@ private:
         bool isContainer() const override;
         StringList fileList() const override;
         ByteArray fileData(const String& fileName) const override;
+        ByteArray fileDataHead(const String& fileName, size_t maxSize) const override;
+        bool isConcurrentReadSupported() const override;
     private:
         io::path_t m_rootPath;
     };
@@ -123,6 +143,8 @@ private:
         bool isContainer() const override;
         StringList fileList() const override;
         ByteArray fileData(const String& fileName) const override;
+        ByteArray fileDataHead(const String& fileName, size_t maxSize) const override;
+        bool isConcurrentReadSupported() const override;
     private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
@@ -132,6 +154,7 @@ private:
     ByteArray fileData(const String& fileName) const;
 
     String mainFileName() const;
+    String findScoreFileName() const;
 
     Params m_params;
     mutable IReader* m_reader = nullptr;
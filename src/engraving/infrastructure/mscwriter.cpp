@@ -94,7 +94,7 @@ MscWriter::IWriter* MscWriter::writer() const
     if (!m_writer) {
         switch (m_params.mode) {
         case MscIoMode::Zip:
-            m_writer = new ZipFileWriter();
+            m_writer = new ZipFileWriter(m_params.previousFilePath);
             break;
         case MscIoMode::Dir:
             m_writer = new DirWriter();
@@ -245,6 +245,11 @@ void MscWriter::Meta::addFile(const String& file)
 // Writers
 // =======================================================================
 
+MscWriter::ZipFileWriter::ZipFileWriter(const io::path_t& previousFilePath)
+    : m_previousFilePath(previousFilePath)
+{
+}
+
 MscWriter::ZipFileWriter::~ZipFileWriter()
 {
     delete m_zip;
@@ -257,8 +262,11 @@ bool MscWriter::ZipFileWriter::open(io::IODevice* device, const path_t& filePath
 {
     m_device = device;
     if (!m_device) {
-        m_device = new File(filePath);
+        //! NOTE File rewrites the whole file on each write,
+        //! so the archive is assembled in memory and written to the file on close
+        m_device = new Buffer();
         m_selfDeviceOwner = true;
+        m_filePath = filePath;
     }
 
     if (!m_device->isOpen()) {
@@ -269,6 +277,7 @@ bool MscWriter::ZipFileWriter::open(io::IODevice* device, const path_t& filePath
     }
 
     m_zip = new ZipWriter(m_device);
+    m_zip->setPreviousArchive(m_previousFilePath);
 
     return true;
 }
@@ -282,6 +291,15 @@ void MscWriter::ZipFileWriter::close()
     if (m_device) {
         m_device->close();
     }
+
+    if (m_selfDeviceOwner && !m_filePath.empty()) {
+        const ByteArray& data = static_cast<Buffer*>(m_device)->data();
+        File file(m_filePath);
+        if (!file.open(IODevice::WriteOnly) || file.write(data) != data.size()) {
+            LOGE() << "failed write file: " << m_filePath;
+        }
+        m_filePath = io::path_t();
+    }
 }
 
 bool MscWriter::ZipFileWriter::isOpened() const
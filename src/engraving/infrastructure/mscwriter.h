@@ -43,6 +43,10 @@ public:
         io::path_t filePath;
         String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE Zip only. Files, whose data didn't change since this file was written,
+        //! are copied from it without compressing them again
+        io::path_t previousFilePath;
     };
 
     MscWriter() = default;
@@ -80,6 +84,7 @@ private:
 
     struct ZipFileWriter : public IWriter
     {
+        ZipFileWriter(const io::path_t& previousFilePath);
         ~ZipFileWriter() override;
         bool open(io::IODevice* device, const io::path_t& filePath) override;
         void close() override;
@@ -89,6 +94,8 @@ private:
     private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
+        io::path_t m_filePath;
+        io::path_t m_previousFilePath;
         ZipWriter* m_zip = nullptr;
     };
 
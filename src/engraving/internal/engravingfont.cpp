@@ -21,6 +21,8 @@
  */
 #include "engravingfont.h"
 
+#include <cstring>
+
 #include "serialization/json.h"
 #include "io/file.h"
 #include "io/fileinfo.h"
@@ -104,6 +106,22 @@ void EngravingFont::ensureLoad()
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
+    File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
+    ByteArray metadata;
+    if (metadataFile.open(IODevice::ReadOnly)) {
+        metadata = metadataFile.readAll();
+    }
+
+    //! NOTE Measuring all the glyphs and reading the metadata takes a while,
+    //! so the result is cached until the font or its metadata change
+    const uint64_t cacheKey = metricsCacheKey(metadata);
+    if (!metadata.empty() && loadMetricsCache(cacheKey)) {
+        loadComposedGlyphs();
+        m_engravingDefaults.insert({ Sid::MusicalTextFont, String(u"%1 Text").arg(String::fromStdString(m_family)) });
+        m_loaded = true;
+        return;
+    }
+
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
@@ -113,14 +131,13 @@ void EngravingFont::ensureLoad()
         computeMetrics(sym, code);
     }
 
-    File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
-    if (!metadataFile.open(IODevice::ReadOnly)) {
+    if (metadata.empty()) {
         LOGE() << "Failed to open glyph metadata file: " << metadataFile.filePath();
         return;
     }
 
     std::string error;
-    JsonObject metadataJson = JsonDocument::fromJson(metadataFile.readAll(), &error).rootObject();
+    JsonObject metadataJson = JsonDocument::fromJson(metadata, &error).rootObject();
     if (!error.empty()) {
         LOGE() << "Json parse error in " << metadataFile.filePath() << ", error: " << error;
         return;
@@ -131,9 +148,193 @@ void EngravingFont::ensureLoad()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
+    saveMetricsCache(cacheKey);
+
     m_loaded = true;
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+static constexpr uint32_t METRICS_CACHE_MAGIC = 0x4D53464D; // MSFM
+static constexpr uint32_t METRICS_CACHE_VERSION = 1;
+
+template<typename T>
+static void writeValue(ByteArray& data, const T& value)
+{
+    data.push_back(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool readValue(const ByteArray& data, size_t& pos, T& value)
+{
+    if (pos + sizeof(T) > data.size()) {
+        return false;
+    }
+    std::memcpy(&value, data.constData() + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+static uint64_t fnv1a(const ByteArray& data, uint64_t hash = 14695981039346656037ULL)
+{
+    const uint8_t* d = data.constData();
+    for (size_t i = 0; i < data.size(); ++i) {
+        hash = (hash ^ d[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+io::path_t EngravingFont::metricsCachePath() const
+{
+    if (!globalConfiguration()) {
+        return io::path_t();
+    }
+
+    return globalConfiguration()->userAppDataPath() + "/engravingfonts/" + io::path_t(m_family + ".metrics");
+}
+
+uint64_t EngravingFont::metricsCacheKey(const ByteArray& metadata) const
+{
+    ByteArray font;
+    if (fileSystem()) {
+        fileSystem()->readFile(m_fontPath, font);
+    }
+
+    return fnv1a(metadata, fnv1a(font)) ^ m_symbols.size();
+}
+
+bool EngravingFont::loadMetricsCache(uint64_t key)
+{
+    io::path_t path = metricsCachePath();
+    ByteArray data;
+    if (path.empty() || !fileSystem() || !fileSystem()->exists(path) || !fileSystem()->readFile(path, data)) {
+        return false;
+    }
+
+    size_t pos = 0;
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t cachedKey = 0;
+    uint64_t symCount = 0;
+    if (!readValue(data, pos, magic) || !readValue(data, pos, version) || !readValue(data, pos, cachedKey)
+        || !readValue(data, pos, symCount)) {
+        return false;
+    }
+
+    if (magic != METRICS_CACHE_MAGIC || version != METRICS_CACHE_VERSION || cachedKey != key || symCount != m_symbols.size()) {
+        return false;
+    }
+
+    std::vector<Sym> symbols(m_symbols.size());
+    for (Sym& sym : symbols) {
+        uint32_t code = 0;
+        double x = 0.0, y = 0.0, w = 0.0, h = 0.0;
+        uint8_t anchorCount = 0;
+        if (!readValue(data, pos, code) || !readValue(data, pos, x) || !readValue(data, pos, y) || !readValue(data, pos, w)
+            || !readValue(data, pos, h) || !readValue(data, pos, sym.advance) || !readValue(data, pos, anchorCount)) {
+            return false;
+        }
+
+        sym.code = code;
+        sym.bbox = RectF(x, y, w, h);
+
+        for (uint8_t i = 0; i < anchorCount; ++i) {
+            int32_t anchorId = 0;
+            double ax = 0.0, ay = 0.0;
+            if (!readValue(data, pos, anchorId) || !readValue(data, pos, ax) || !readValue(data, pos, ay)) {
+                return false;
+            }
+            sym.smuflAnchors[static_cast<SmuflAnchorId>(anchorId)] = PointF(ax, ay);
+        }
+    }
+
+    double textEnclosureThickness = 0.0;
+    uint32_t defaultsCount = 0;
+    if (!readValue(data, pos, textEnclosureThickness) || !readValue(data, pos, defaultsCount)) {
+        return false;
+    }
+
+    std::unordered_map<Sid, PropertyValue> engravingDefaults;
+    for (uint32_t i = 0; i < defaultsCount; ++i) {
+        int32_t sid = 0;
+        uint8_t isBool = 0;
+        double value = 0.0;
+        if (!readValue(data, pos, sid) || !readValue(data, pos, isBool) || !readValue(data, pos, value)) {
+            return false;
+        }
+
+        if (isBool) {
+            engravingDefaults.insert({ static_cast<Sid>(sid), value != 0.0 });
+        } else {
+            engravingDefaults.insert({ static_cast<Sid>(sid), value });
+        }
+    }
+
+    m_symbols = std::move(symbols);
+    m_engravingDefaults = std::move(engravingDefaults);
+    m_textEnclosureThickness = textEnclosureThickness;
+
+    return true;
+}
+
+void EngravingFont::saveMetricsCache(uint64_t key) const
+{
+    io::path_t path = metricsCachePath();
+    if (path.empty() || !fileSystem()) {
+        return;
+    }
+
+    ByteArray data;
+    writeValue(data, METRICS_CACHE_MAGIC);
+    writeValue(data, METRICS_CACHE_VERSION);
+    writeValue(data, key);
+    writeValue(data, static_cast<uint64_t>(m_symbols.size()));
+
+    for (const Sym& sym : m_symbols) {
+        writeValue(data, static_cast<uint32_t>(sym.code));
+        writeValue(data, sym.bbox.x());
+        writeValue(data, sym.bbox.y());
+        writeValue(data, sym.bbox.width());
+        writeValue(data, sym.bbox.height());
+        writeValue(data, sym.advance);
+        writeValue(data, static_cast<uint8_t>(sym.smuflAnchors.size()));
+        for (const auto& anchor : sym.smuflAnchors) {
+            writeValue(data, static_cast<int32_t>(anchor.first));
+            writeValue(data, anchor.second.x());
+            writeValue(data, anchor.second.y());
+        }
+    }
+
+    writeValue(data, m_textEnclosureThickness);
+
+    // the musical text font is derived from the family, so it isn't cached
+    std::vector<std::pair<Sid, PropertyValue> > defaults;
+    for (const auto& pair : m_engravingDefaults) {
+        if (pair.second.type() == P_TYPE::REAL || pair.second.type() == P_TYPE::BOOL) {
+            defaults.push_back(pair);
+        }
+    }
+
+    writeValue(data, static_cast<uint32_t>(defaults.size()));
+    for (const auto& pair : defaults) {
+        const bool isBool = pair.second.type() == P_TYPE::BOOL;
+        writeValue(data, static_cast<int32_t>(pair.first));
+        writeValue(data, static_cast<uint8_t>(isBool));
+        writeValue(data, isBool ? (pair.second.toBool() ? 1.0 : 0.0) : pair.second.toDouble());
+    }
+
+    Ret ret = fileSystem()->makePath(io::dirpath(path));
+    if (ret) {
+        ret = fileSystem()->writeFile(path, data);
+    }
+
+    if (!ret) {
+        LOGW() << "failed to save the font metrics cache: " << path << ", err: " << ret.toString();
+    }
+}
+
 void EngravingFont::loadGlyphsWithAnchors(const JsonObject& glyphsWithAnchors)
 {
     for (const std::string& symName : glyphsWithAnchors.keys()) {
@@ -27,6 +27,8 @@
 #include "iengravingfont.h"
 
 #include "modularity/ioc.h"
+#include "iglobalconfiguration.h"
+#include "io/ifilesystem.h"
 #include "draw/ifontprovider.h"
 #include "draw/types/geometry.h"
 #include "iengravingfontsprovider.h"
@@ -51,6 +53,8 @@ class EngravingFont : public IEngravingFont
 {
     INJECT_STATIC(score, mu::draw::IFontProvider, fontProvider)
     INJECT_STATIC(score, IEngravingFontsProvider, engravingFonts)
+    INJECT_STATIC(score, framework::IGlobalConfiguration, globalConfiguration)
+    INJECT_STATIC(score, io::IFileSystem, fileSystem)
 public:
     EngravingFont(const std::string& name, const std::string& family, const io::path_t& filePath);
     EngravingFont(const EngravingFont& other);
@@ -117,6 +121,11 @@ private:
     void loadEngravingDefaults(const JsonObject& engravingDefaultsObject);
     void computeMetrics(Sym& sym, const Smufl::Code& code);
 
+    io::path_t metricsCachePath() const;
+    uint64_t metricsCacheKey(const ByteArray& metadata) const;
+    bool loadMetricsCache(uint64_t key);
+    void saveMetricsCache(uint64_t key) const;
+
     Sym& sym(SymId id);
     const Sym& sym(SymId id) const;
 
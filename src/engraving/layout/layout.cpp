@@ -21,6 +21,9 @@
  */
 #include "layout.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "containers.h"
 
 #include "libmscore/barline.h"
@@ -73,8 +76,10 @@ Layout::Layout(Score* score)
 
 void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, const Fraction& et)
 {
+    TRACEFUNC;
     CmdStateLocker cmdStateLocker(m_score);
     LayoutContext ctx(m_score);
+    ctx.arena = &m_arena;
 
     Fraction stick(st);
     Fraction etick(et);
@@ -87,6 +92,7 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
         DeleteAll(m_score->pages());
         m_score->pages().clear();
         LayoutPage::getNextPage(options, ctx);
+        m_layoutComplete = true;
         return;
     }
 
@@ -131,6 +137,20 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
     // m->system() will return a nullptr. We need to find the multi measure
     // rest which replaces the measure range
 
+    // content of the measures in the range may have changed,
+    // drop their cached horizontal spacing and mm rest content
+    for (MeasureBase* mb = m; mb && mb->tick() <= etick; mb = mb->next()) {
+        if (!mb->isMeasure()) {
+            continue;
+        }
+        Measure* measure = toMeasure(mb);
+        measure->invalidateSpacingCache();
+        measure->invalidateMMRestContent();
+        if (measure->mmRest()) {
+            measure->mmRest()->invalidateSpacingCache();
+        }
+    }
+
     if (!m->system() && m->isMeasure() && toMeasure(m)->hasMMRest()) {
         LOGD("  don’t start with mmrest");
         m = toMeasure(m)->mmRest();
@@ -141,6 +161,7 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
         ctx.nextMeasure = m;         //_showVBox ? first() : firstMeasure();
         ctx.startTick   = m->tick();
         layoutLinear(layoutAll, options, ctx);
+        m_layoutComplete = true;
         return;
     }
 
@@ -221,10 +242,14 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
 
 void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
 {
+    TRACEFUNC;
     MeasureBase* lmb;
+    size_t pagesDone = 0;
+    bool reachedPageLimit = false;
     do {
         LayoutPage::getNextPage(options, lc);
         LayoutPage::collectPage(options, lc);
+        ++pagesDone;
 
         if (lc.page && !lc.page->systems().empty()) {
             lmb = lc.page->systems().back()->measures().back();
@@ -241,9 +266,21 @@ void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
         //    c) this page ends with the same measure as the previous layout
         //    pageOldMeasure will be last measure from previous layout if range was completed on or before this page
         //    it will be nullptr if this page was never laid out or if we collected a system for next page
+        // or
+        // 3) we have laid out as many pages as requested, the rest is left for continueLayout()
+        if (options.pageLimit && pagesDone >= options.pageLimit && lc.curSystem && !lc.rangeDone) {
+            reachedPageLimit = true;
+            break;
+        }
     } while (lc.curSystem && !(lc.rangeDone && lmb == lc.pageOldMeasure));
     // && page->system(0)->measures().back()->tick() > endTick // FIXME: perhaps the first measure was meant? Or last system?
 
+    if (reachedPageLimit) {
+        m_layoutComplete = false;
+    } else if (!lc.curSystem) {
+        m_layoutComplete = true;
+    }
+
     if (!lc.curSystem) {
         // The end of the score. The remaining systems are not needed...
         DeleteAll(lc.systemList);
@@ -263,12 +300,59 @@ void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
     lc.score()->systems().insert(lc.score()->systems().end(), lc.systemList.begin(), lc.systemList.end());
 }
 
+//---------------------------------------------------------
+//   continueTick
+//    where to resume a page-limited layout: the last laid
+//    out system is laid out again so that spacing and lines
+//    across the page turn stay consistent
+//---------------------------------------------------------
+
+Fraction Layout::continueTick() const
+{
+    for (auto it = m_score->pages().rbegin(); it != m_score->pages().rend(); ++it) {
+        const std::vector<System*>& systems = (*it)->systems();
+        if (!systems.empty() && !systems.back()->measures().empty()) {
+            return systems.back()->measures().front()->tick();
+        }
+    }
+
+    return Fraction(0, 1);
+}
+
+//---------------------------------------------------------
+//   estimatedPageCount
+//    extrapolate the number of pages of an incomplete
+//    layout from the part of the score laid out so far
+//---------------------------------------------------------
+
+size_t Layout::estimatedPageCount() const
+{
+    const size_t npages = m_score->npages();
+    if (m_layoutComplete || npages == 0 || !m_score->last()) {
+        return npages;
+    }
+
+    const Page* lastPage = m_score->pages().back();
+    if (lastPage->systems().empty() || lastPage->systems().back()->measures().empty()) {
+        return npages;
+    }
+
+    const double doneTicks = lastPage->systems().back()->measures().back()->endTick().ticks();
+    const double totalTicks = m_score->last()->endTick().ticks();
+    if (doneTicks <= 0 || doneTicks >= totalTicks) {
+        return npages;
+    }
+
+    return std::max(npages, static_cast<size_t>(std::ceil(npages * totalTicks / doneTicks)));
+}
+
 //---------------------------------------------------------
 //   layoutLinear
 //---------------------------------------------------------
 
 void Layout::layoutLinear(bool layoutAll, const LayoutOptions& options, LayoutContext& lc)
 {
+    TRACEFUNC;
     resetSystems(layoutAll, options, lc);
 
     collectLinearSystem(options, lc);
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_LAYOUT_H
 #define MU_ENGRAVING_LAYOUT_H
 
+#include "global/allocator.h"
+
 #include "layoutoptions.h"
 
 namespace mu::engraving {
@@ -35,6 +37,14 @@ public:
 
     void doLayoutRange(const LayoutOptions& options, const Fraction&, const Fraction&);
 
+    //! NOTE Returns false if the last page mode layout stopped at LayoutOptions::pageLimit
+    //! before reaching the end of the score
+    bool isLayoutComplete() const { return m_layoutComplete; }
+    //! NOTE The tick to start the range layout from to lay out the rest of the score
+    //! after a page-limited layout
+    Fraction continueTick() const;
+    size_t estimatedPageCount() const;
+
 private:
 
     void layoutLinear(const LayoutOptions& options, LayoutContext& ctx);
@@ -45,6 +55,10 @@ private:
     void doLayout(const LayoutOptions& options, LayoutContext& lc);
 
     Score* m_score = nullptr;
+    bool m_layoutComplete = true;
+
+    // temporaries of a layout pass, the blocks are reused between passes
+    ArenaAllocator m_arena;
 };
 }
 
@@ -37,8 +37,14 @@
 
 #include "layoutcontext.h"
 
+#include "concurrency/taskscheduler.h"
+#include "log.h"
+
 using namespace mu::engraving;
 
+// below this number of beams the task dispatch costs more than it saves
+static constexpr size_t PARALLEL_BEAMS_MIN_COUNT = 16;
+
 //---------------------------------------------------------
 //   isTopBeam
 //    returns true for the first CR of a beam that is not cross-staff
@@ -276,6 +282,7 @@ void LayoutBeams::beamGraceNotes(Score* score, Chord* mainNote, bool after)
 
 void LayoutBeams::createBeams(Score* score, LayoutContext& lc, Measure* measure)
 {
+    TRACEFUNC;
     bool crossMeasure = score->styleB(Sid::crossMeasureValues);
 
     for (track_idx_t track = 0; track < score->ntracks(); ++track) {
@@ -473,34 +480,103 @@ void LayoutBeams::createBeams(Score* score, LayoutContext& lc, Measure* measure)
     }
 }
 
+//---------------------------------------------------------
+//   prepareBeamLayout
+//    do the part of Beam::layout() that changes more than the beam and its chords:
+//    reparenting touches the children of the system, adding or removing stems and hooks
+//    goes through the undo stack
+//---------------------------------------------------------
+
+static void prepareBeamLayout(Beam* beam)
+{
+    beam->setParent(beam->elements().front()->measure()->system());
+    for (ChordRest* cr : beam->elements()) {
+        if (cr->isChord() && toChord(cr)->stemElementsOutdated()) {
+            toChord(cr)->layoutStem();
+        }
+    }
+}
+
+static bool hasStaffMove(const Beam* beam)
+{
+    for (const ChordRest* cr : beam->elements()) {
+        if (cr->staffMove() != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /************************************************************
  * layoutNonCrossBeams()
- * layout all non-cross-staff beams starting on this segment
+ * layout all non-cross-staff beams starting on these segments
  * **********************************************************/
 
-void LayoutBeams::layoutNonCrossBeams(Segment* s)
+void LayoutBeams::layoutNonCrossBeams(const std::vector<Segment*>& segments)
 {
-    for (EngravingItem* e : s->elist()) {
-        if (!e || !e->isChordRest() || !e->score()->staff(e->staffIdx())->show()) {
-            // the beam and its system may still be referenced when selecting all,
-            // even if the staff is invisible. The old system is invalid and does cause problems in #284012
-            if (e && e->isChordRest() && !e->score()->staff(e->staffIdx())->show() && toChordRest(e)->beam()) {
-                toChordRest(e)->beam()->resetExplicitParent();
-            }
-            continue;
+    TRACEFUNC;
+
+    //! NOTE A beam without moved chords changes only itself and the chords of its staff,
+    //! so the staves are laid out concurrently. Beams with chords moved to another staff are laid out afterwards
+    std::vector<std::vector<Beam*> > staffBeams;
+    std::vector<Beam*> movedBeams;
+    size_t beamCount = 0;
+
+    auto addBeam = [&](ChordRest* cr) {
+        if (!LayoutBeams::isTopBeam(cr)) {
+            return;
         }
-        ChordRest* cr = toChordRest(e);
-        // layout beam
-        if (LayoutBeams::isTopBeam(cr)) {
-            cr->beam()->layout();
+        Beam* beam = cr->beam();
+        prepareBeamLayout(beam);
+        if (hasStaffMove(beam)) {
+            movedBeams.push_back(beam);
+            return;
         }
-        if (!cr->isChord()) {
-            continue;
+        staff_idx_t staffIdx = cr->staffIdx();
+        if (staffBeams.size() <= staffIdx) {
+            staffBeams.resize(staffIdx + 1);
         }
-        for (Chord* grace : toChord(cr)->graceNotes()) {
-            if (LayoutBeams::isTopBeam(grace)) {
-                grace->beam()->layout();
+        staffBeams[staffIdx].push_back(beam);
+        ++beamCount;
+    };
+
+    for (Segment* s : segments) {
+        for (EngravingItem* e : s->elist()) {
+            if (!e || !e->isChordRest() || !e->score()->staff(e->staffIdx())->show()) {
+                // the beam and its system may still be referenced when selecting all,
+                // even if the staff is invisible. The old system is invalid and does cause problems in #284012
+                if (e && e->isChordRest() && !e->score()->staff(e->staffIdx())->show() && toChordRest(e)->beam()) {
+                    toChordRest(e)->beam()->resetExplicitParent();
+                }
+                continue;
+            }
+            ChordRest* cr = toChordRest(e);
+            addBeam(cr);
+            if (!cr->isChord()) {
+                continue;
+            }
+            for (Chord* grace : toChord(cr)->graceNotes()) {
+                addBeam(grace);
             }
         }
     }
+
+    auto layoutStaffBeams = [&staffBeams](size_t staffIdx) {
+        for (Beam* beam : staffBeams[staffIdx]) {
+            beam->layout();
+        }
+    };
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    if (beamCount >= PARALLEL_BEAMS_MIN_COUNT && staffBeams.size() > 1 && scheduler->threadPoolSize() > 1) {
+        scheduler->parallelFor(size_t(0), staffBeams.size(), layoutStaffBeams);
+    } else {
+        for (size_t staffIdx = 0; staffIdx < staffBeams.size(); ++staffIdx) {
+            layoutStaffBeams(staffIdx);
+        }
+    }
+
+    for (Beam* beam : movedBeams) {
+        beam->layout();
+    }
 }
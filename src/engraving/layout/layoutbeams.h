@@ -41,7 +41,7 @@ public:
     static void createBeams(Score* score, LayoutContext& lc, Measure* measure);
     static void restoreBeams(Measure* m);
     static void breakCrossMeasureBeams(const LayoutContext& ctx, Measure* measure);
-    static void layoutNonCrossBeams(Segment* s);
+    static void layoutNonCrossBeams(const std::vector<Segment*>& segments);
 
 private:
     static void beamGraceNotes(Score* score, Chord* mainNote, bool after);
@@ -38,6 +38,8 @@
 #include "libmscore/stemslash.h"
 #include "libmscore/tie.h"
 
+#include "log.h"
+
 using namespace mu::engraving;
 
 //---------------------------------------------------------
@@ -63,6 +65,7 @@ static void layoutSegmentElements(Segment* segment, track_idx_t startTrack, trac
 
 void LayoutChords::layoutChords1(Score* score, Segment* segment, staff_idx_t staffIdx)
 {
+    TRACEFUNC;
     const Staff* staff = score->Score::staff(staffIdx);
     const track_idx_t startTrack = staffIdx * VOICES;
     const track_idx_t endTrack   = startTrack + VOICES;
@@ -21,6 +21,8 @@
  */
 #include "layoutcontext.h"
 
+#include "global/allocator.h"
+
 #include "libmscore/mscoreview.h"
 #include "libmscore/score.h"
 #include "libmscore/spanner.h"
@@ -39,6 +41,10 @@ LayoutContext::~LayoutContext()
         s->layoutSystemsDone();
     }
 
+    if (arena) {
+        arena->reset();
+    }
+
     for (MuseScoreView* v : score()->getViewer()) {
         v->layoutChanged();
     }
@@ -28,6 +28,10 @@
 #include "types/fraction.h"
 #include "types/types.h"
 
+namespace mu {
+class ArenaAllocator;
+}
+
 namespace mu::engraving {
 class MeasureBase;
 class Page;
@@ -71,6 +75,10 @@ public:
 
     double totalBracketsWidth = -1.0;
 
+    //! NOTE Storage for temporaries of this layout pass, reset when the context is destroyed.
+    //! Must not be used from the parallel skyline tasks.
+    ArenaAllocator* arena = nullptr;
+
 private:
     Score* m_score = nullptr;
 };
@@ -33,10 +33,13 @@
 #include "libmscore/segment.h"
 #include "libmscore/system.h"
 
+#include "log.h"
+
 using namespace mu::engraving;
 
 void LayoutHarmonies::layoutHarmonies(const std::vector<Segment*>& sl)
 {
+    TRACEFUNC;
     for (const Segment* s : sl) {
         for (EngravingItem* e : s->annotations()) {
             if (e->isHarmony()) {
@@ -56,6 +59,7 @@ void LayoutHarmonies::layoutHarmonies(const std::vector<Segment*>& sl)
 void LayoutHarmonies::alignHarmonies(const System* system, const std::vector<Segment*>& sl, bool harmony, const double maxShiftAbove,
                                      const double maxShiftBelow)
 {
+    TRACEFUNC;
     // Help class.
     // Contains harmonies/fretboard per segment.
     class HarmonyList : public std::vector<EngravingItem*>
@@ -21,6 +21,8 @@
  */
 #include "layoutlyrics.h"
 
+#include <vector>
+
 #include "style/styledef.h"
 
 #include "libmscore/chordrest.h"
@@ -30,102 +32,132 @@
 #include "libmscore/segment.h"
 #include "libmscore/system.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 
+//! NOTE The chord rests with lyrics of one staff of the system, in segment order.
+//! Built once per system, so the alignment passes don't walk every segment and voice again
+using StaffLyrics = std::vector<ChordRest*>;
+using ChordRestRange = std::pair<StaffLyrics::const_iterator, StaffLyrics::const_iterator>;
+
 //---------------------------------------------------------
-//   findLyricsMaxY
+//   collectLyrics
 //---------------------------------------------------------
 
-static double findLyricsMaxY(const MStyle& style, Segment& s, staff_idx_t staffIdx)
+static void collectLyrics(const System* system, staff_idx_t staffIdx, StaffLyrics& lyrics)
 {
-    double yMax = 0.0;
-    if (!s.isChordRestType()) {
-        return yMax;
+    for (MeasureBase* mb : system->measures()) {
+        if (!mb->isMeasure()) {
+            continue;
+        }
+        Measure* m = toMeasure(mb);
+        for (Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
+            for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
+                ChordRest* cr = s->cr(staffIdx * VOICES + voice);
+                if (cr && !cr->lyrics().empty()) {
+                    lyrics.push_back(cr);
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   takeRange
+//    the chord rests at the position of `it` that share the same key (measure or segment)
+//---------------------------------------------------------
+
+template<typename KeyFunc>
+static ChordRestRange takeRange(StaffLyrics::const_iterator& it, StaffLyrics::const_iterator end, const void* key, KeyFunc keyOf)
+{
+    StaffLyrics::const_iterator begin = it;
+    while (it != end && keyOf(*it) == key) {
+        ++it;
     }
+    return { begin, it };
+}
 
+//---------------------------------------------------------
+//   findLyricsMaxY
+//---------------------------------------------------------
+
+static double findLyricsMaxY(const MStyle& style, ChordRest* cr, staff_idx_t staffIdx)
+{
+    double yMax = 0.0;
     double lyricsMinTopDistance = style.styleMM(Sid::lyricsMinTopDistance);
+    Segment* s = cr->segment();
 
-    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-        ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-        if (cr && !cr->lyrics().empty()) {
-            SkylineLine sk(true);
+    SkylineLine sk(true);
 
-            for (Lyrics* l : cr->lyrics()) {
-                if (l->autoplace() && l->placeBelow()) {
-                    double yOff = l->offset().y();
-                    PointF offset = l->pos() + cr->pos() + s.pos() + s.measure()->pos();
-                    RectF r = l->bbox().translated(offset);
-                    r.translate(0.0, -yOff);
-                    sk.add(r.x(), r.top(), r.width());
-                }
-            }
-            SysStaff* ss = s.measure()->system()->staff(staffIdx);
-            for (Lyrics* l : cr->lyrics()) {
-                if (l->autoplace() && l->placeBelow()) {
-                    double y = ss->skyline().south().minDistance(sk);
-                    if (y > -lyricsMinTopDistance) {
-                        yMax = std::max(yMax, y + lyricsMinTopDistance);
-                    }
-                }
+    for (Lyrics* l : cr->lyrics()) {
+        if (l->autoplace() && l->placeBelow()) {
+            double yOff = l->offset().y();
+            PointF offset = l->pos() + cr->pos() + s->pos() + s->measure()->pos();
+            RectF r = l->bbox().translated(offset);
+            r.translate(0.0, -yOff);
+            sk.add(r.x(), r.top(), r.width());
+        }
+    }
+    SysStaff* ss = s->measure()->system()->staff(staffIdx);
+    for (Lyrics* l : cr->lyrics()) {
+        if (l->autoplace() && l->placeBelow()) {
+            double y = ss->skyline().south().minDistance(sk);
+            if (y > -lyricsMinTopDistance) {
+                yMax = std::max(yMax, y + lyricsMinTopDistance);
             }
         }
     }
     return yMax;
 }
 
+static double findLyricsMaxY(const MStyle& style, const ChordRestRange& range, staff_idx_t staffIdx)
+{
+    double yMax = 0.0;
+    for (auto it = range.first; it != range.second; ++it) {
+        yMax = std::max(yMax, findLyricsMaxY(style, *it, staffIdx));
+    }
+    return yMax;
+}
+
 //---------------------------------------------------------
 //   findLyricsMinY
 //---------------------------------------------------------
 
-static double findLyricsMinY(const MStyle& style, Segment& s, staff_idx_t staffIdx)
+static double findLyricsMinY(const MStyle& style, ChordRest* cr, staff_idx_t staffIdx)
 {
     double yMin = 0.0;
-    if (!s.isChordRestType()) {
-        return yMin;
-    }
     double lyricsMinTopDistance = style.styleMM(Sid::lyricsMinTopDistance);
-    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-        ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-        if (cr && !cr->lyrics().empty()) {
-            SkylineLine sk(false);
+    Segment* s = cr->segment();
 
-            for (Lyrics* l : cr->lyrics()) {
-                if (l->autoplace() && l->placeAbove()) {
-                    double yOff = l->offset().y();
-                    RectF r = l->bbox().translated(l->pos() + cr->pos() + s.pos() + s.measure()->pos());
-                    r.translate(0.0, -yOff);
-                    sk.add(r.x(), r.bottom(), r.width());
-                }
-            }
-            SysStaff* ss = s.measure()->system()->staff(staffIdx);
-            for (Lyrics* l : cr->lyrics()) {
-                if (l->autoplace() && l->placeAbove()) {
-                    double y = sk.minDistance(ss->skyline().north());
-                    if (y > -lyricsMinTopDistance) {
-                        yMin = std::min(yMin, -y - lyricsMinTopDistance);
-                    }
-                }
+    SkylineLine sk(false);
+
+    for (Lyrics* l : cr->lyrics()) {
+        if (l->autoplace() && l->placeAbove()) {
+            double yOff = l->offset().y();
+            RectF r = l->bbox().translated(l->pos() + cr->pos() + s->pos() + s->measure()->pos());
+            r.translate(0.0, -yOff);
+            sk.add(r.x(), r.bottom(), r.width());
+        }
+    }
+    SysStaff* ss = s->measure()->system()->staff(staffIdx);
+    for (Lyrics* l : cr->lyrics()) {
+        if (l->autoplace() && l->placeAbove()) {
+            double y = sk.minDistance(ss->skyline().north());
+            if (y > -lyricsMinTopDistance) {
+                yMin = std::min(yMin, -y - lyricsMinTopDistance);
             }
         }
     }
     return yMin;
 }
 
-static double findLyricsMaxY(const MStyle& style, Measure* m, staff_idx_t staffIdx)
-{
-    double yMax = 0.0;
-    for (Segment& s : m->segments()) {
-        yMax = std::max(yMax, findLyricsMaxY(style, s, staffIdx));
-    }
-    return yMax;
-}
-
-static double findLyricsMinY(const MStyle& style, Measure* m, staff_idx_t staffIdx)
+static double findLyricsMinY(const MStyle& style, const ChordRestRange& range, staff_idx_t staffIdx)
 {
     double yMin = 0.0;
-    for (Segment& s : m->segments()) {
-        yMin = std::min(yMin, findLyricsMinY(style, s, staffIdx));
+    for (auto it = range.first; it != range.second; ++it) {
+        yMin = std::min(yMin, findLyricsMinY(style, *it, staffIdx));
     }
     return yMin;
 }
@@ -134,33 +166,26 @@ static double findLyricsMinY(const MStyle& style, Measure* m, staff_idx_t staffI
 //   applyLyricsMax
 //---------------------------------------------------------
 
-static void applyLyricsMax(const MStyle& style, Segment& s, staff_idx_t staffIdx, double yMax)
+static void applyLyricsMax(const MStyle& style, ChordRest* cr, staff_idx_t staffIdx, double yMax)
 {
-    if (!s.isChordRestType()) {
-        return;
-    }
-    Skyline& sk = s.measure()->system()->staff(staffIdx)->skyline();
-    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-        ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-        if (cr && !cr->lyrics().empty()) {
-            double lyricsMinBottomDistance = style.styleMM(Sid::lyricsMinBottomDistance);
-            for (Lyrics* l : cr->lyrics()) {
-                if (l->autoplace() && l->placeBelow()) {
-                    l->movePosY(yMax - l->propertyDefault(Pid::OFFSET).value<PointF>().y());
-                    if (l->addToSkyline()) {
-                        PointF offset = l->pos() + cr->pos() + s.pos() + s.measure()->pos();
-                        sk.add(l->bbox().translated(offset).adjusted(0.0, 0.0, 0.0, lyricsMinBottomDistance));
-                    }
-                }
+    Segment* s = cr->segment();
+    Skyline& sk = s->measure()->system()->staff(staffIdx)->skyline();
+    double lyricsMinBottomDistance = style.styleMM(Sid::lyricsMinBottomDistance);
+    for (Lyrics* l : cr->lyrics()) {
+        if (l->autoplace() && l->placeBelow()) {
+            l->movePosY(yMax - l->propertyDefault(Pid::OFFSET).value<PointF>().y());
+            if (l->addToSkyline()) {
+                PointF offset = l->pos() + cr->pos() + s->pos() + s->measure()->pos();
+                sk.add(l->bbox().translated(offset).adjusted(0.0, 0.0, 0.0, lyricsMinBottomDistance));
             }
         }
     }
 }
 
-static void applyLyricsMax(const MStyle& style, Measure* m, staff_idx_t staffIdx, double yMax)
+static void applyLyricsMax(const MStyle& style, const ChordRestRange& range, staff_idx_t staffIdx, double yMax)
 {
-    for (Segment& s : m->segments()) {
-        applyLyricsMax(style, s, staffIdx, yMax);
+    for (auto it = range.first; it != range.second; ++it) {
+        applyLyricsMax(style, *it, staffIdx, yMax);
     }
 }
 
@@ -182,17 +207,10 @@ static void applyLyricsMin(ChordRest* cr, staff_idx_t staffIdx, double yMin)
     }
 }
 
-static void applyLyricsMin(Measure* m, staff_idx_t staffIdx, double yMin)
+static void applyLyricsMin(const ChordRestRange& range, staff_idx_t staffIdx, double yMin)
 {
-    for (Segment& s : m->segments()) {
-        if (s.isChordRestType()) {
-            for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-                ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-                if (cr) {
-                    applyLyricsMin(cr, staffIdx, yMin);
-                }
-            }
-        }
+    for (auto it = range.first; it != range.second; ++it) {
+        applyLyricsMin(*it, staffIdx, yMin);
     }
 }
 
@@ -205,119 +223,105 @@ static void applyLyricsMin(Measure* m, staff_idx_t staffIdx, double yMin)
 
 void LayoutLyrics::layoutLyrics(const LayoutOptions& options, const Score* score, System* system)
 {
+    TRACEFUNC;
     std::vector<staff_idx_t> visibleStaves;
     for (staff_idx_t staffIdx = system->firstVisibleStaff(); staffIdx < score->nstaves();
          staffIdx = system->nextVisibleStaff(staffIdx)) {
         visibleStaves.push_back(staffIdx);
     }
 
-    //int nAbove[nstaves()];
-    std::vector<staff_idx_t> VnAbove(score->nstaves());
+    std::vector<StaffLyrics> lyricsTable(score->nstaves());
+    for (staff_idx_t staffIdx : visibleStaves) {
+        collectLyrics(system, staffIdx, lyricsTable[staffIdx]);
+    }
 
     for (staff_idx_t staffIdx : visibleStaves) {
-        VnAbove[staffIdx] = 0;
-        for (MeasureBase* mb : system->measures()) {
-            if (!mb->isMeasure()) {
-                continue;
-            }
-            Measure* m = toMeasure(mb);
-            for (Segment& s : m->segments()) {
-                if (s.isChordRestType()) {
-                    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-                        ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-                        if (cr) {
-                            staff_idx_t nA = 0;
-                            for (Lyrics* l : cr->lyrics()) {
-                                // user adjusted offset can possibly change placement
-                                if (l->offsetChanged() != OffsetChange::NONE) {
-                                    PlacementV p = l->placement();
-                                    l->rebaseOffset();
-                                    if (l->placement() != p) {
-                                        l->undoResetProperty(Pid::AUTOPLACE);
-                                        //l->undoResetProperty(Pid::OFFSET);
-                                        //l->layout();
-                                    }
-                                }
-                                l->setOffsetChanged(false);
-                                if (l->placeAbove()) {
-                                    ++nA;
-                                }
-                            }
-                            VnAbove[staffIdx] = std::max(VnAbove[staffIdx], nA);
-                        }
+        const StaffLyrics& staffLyrics = lyricsTable[staffIdx];
+        if (staffLyrics.empty()) {
+            continue;
+        }
+
+        staff_idx_t nAbove = 0;
+        for (ChordRest* cr : staffLyrics) {
+            staff_idx_t nA = 0;
+            for (Lyrics* l : cr->lyrics()) {
+                // user adjusted offset can possibly change placement
+                if (l->offsetChanged() != OffsetChange::NONE) {
+                    PlacementV p = l->placement();
+                    l->rebaseOffset();
+                    if (l->placement() != p) {
+                        l->undoResetProperty(Pid::AUTOPLACE);
+                        //l->undoResetProperty(Pid::OFFSET);
+                        //l->layout();
                     }
                 }
+                l->setOffsetChanged(false);
+                if (l->placeAbove()) {
+                    ++nA;
+                }
             }
+            nAbove = std::max(nAbove, nA);
         }
-    }
 
-    for (staff_idx_t staffIdx : visibleStaves) {
-        for (MeasureBase* mb : system->measures()) {
-            if (!mb->isMeasure()) {
-                continue;
-            }
-            Measure* m = toMeasure(mb);
-            for (Segment& s : m->segments()) {
-                if (s.isChordRestType()) {
-                    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-                        ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-                        if (cr) {
-                            for (Lyrics* l : cr->lyrics()) {
-                                l->layout2(static_cast<int>(VnAbove[staffIdx]));
-                            }
-                        }
-                    }
-                }
+        for (ChordRest* cr : staffLyrics) {
+            for (Lyrics* l : cr->lyrics()) {
+                l->layout2(static_cast<int>(nAbove));
             }
         }
     }
 
+    auto measureOf = [](const ChordRest* cr) -> const void* { return cr->measure(); };
+    auto segmentOf = [](const ChordRest* cr) -> const void* { return cr->segment(); };
+
     switch (options.verticalAlignRange) {
-    case VerticalAlignRange::MEASURE:
+    case VerticalAlignRange::MEASURE: {
+        std::vector<StaffLyrics::const_iterator> cursors(score->nstaves());
+        for (staff_idx_t staffIdx : visibleStaves) {
+            cursors[staffIdx] = lyricsTable[staffIdx].cbegin();
+        }
         for (MeasureBase* mb : system->measures()) {
             if (!mb->isMeasure()) {
                 continue;
             }
-            Measure* m = toMeasure(mb);
             for (staff_idx_t staffIdx : visibleStaves) {
-                double yMax = findLyricsMaxY(score->style(), m, staffIdx);
-                applyLyricsMax(score->style(), m, staffIdx, yMax);
+                ChordRestRange range = takeRange(cursors[staffIdx], lyricsTable[staffIdx].cend(), mb, measureOf);
+                if (range.first == range.second) {
+                    continue;
+                }
+                double yMax = findLyricsMaxY(score->style(), range, staffIdx);
+                applyLyricsMax(score->style(), range, staffIdx, yMax);
             }
         }
-        break;
+    } break;
     case VerticalAlignRange::SYSTEM:
         for (staff_idx_t staffIdx : visibleStaves) {
-            double yMax = 0.0;
-            double yMin = 0.0;
-            for (MeasureBase* mb : system->measures()) {
-                if (!mb->isMeasure()) {
-                    continue;
-                }
-                yMax = std::max<double>(yMax, findLyricsMaxY(score->style(), toMeasure(mb), staffIdx));
-                yMin = std::min(yMin, findLyricsMinY(score->style(), toMeasure(mb), staffIdx));
-            }
-            for (MeasureBase* mb : system->measures()) {
-                if (!mb->isMeasure()) {
-                    continue;
-                }
-                applyLyricsMax(score->style(), toMeasure(mb), staffIdx, yMax);
-                applyLyricsMin(toMeasure(mb), staffIdx, yMin);
-            }
+            const StaffLyrics& staffLyrics = lyricsTable[staffIdx];
+            ChordRestRange range { staffLyrics.cbegin(), staffLyrics.cend() };
+            double yMax = findLyricsMaxY(score->style(), range, staffIdx);
+            double yMin = findLyricsMinY(score->style(), range, staffIdx);
+            applyLyricsMax(score->style(), range, staffIdx, yMax);
+            applyLyricsMin(range, staffIdx, yMin);
         }
         break;
-    case VerticalAlignRange::SEGMENT:
+    case VerticalAlignRange::SEGMENT: {
+        std::vector<StaffLyrics::const_iterator> cursors(score->nstaves());
+        for (staff_idx_t staffIdx : visibleStaves) {
+            cursors[staffIdx] = lyricsTable[staffIdx].cbegin();
+        }
         for (MeasureBase* mb : system->measures()) {
             if (!mb->isMeasure()) {
                 continue;
             }
-            Measure* m = toMeasure(mb);
             for (staff_idx_t staffIdx : visibleStaves) {
-                for (Segment& s : m->segments()) {
-                    double yMax = findLyricsMaxY(score->style(), s, staffIdx);
-                    applyLyricsMax(score->style(), s, staffIdx, yMax);
+                StaffLyrics::const_iterator end = lyricsTable[staffIdx].cend();
+                StaffLyrics::const_iterator& it = cursors[staffIdx];
+                while (it != end && (*it)->measure() == mb) {
+                    ChordRestRange range = takeRange(it, end, (*it)->segment(), segmentOf);
+                    double yMax = findLyricsMaxY(score->style(), range, staffIdx);
+                    applyLyricsMax(score->style(), range, staffIdx, yMax);
                 }
             }
         }
-        break;
+    } break;
     }
 }
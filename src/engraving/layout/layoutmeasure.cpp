@@ -21,6 +21,8 @@
  */
 #include "layoutmeasure.h"
 
+#include <functional>
+
 #include "libmscore/ambitus.h"
 #include "libmscore/barline.h"
 #include "libmscore/beam.h"
@@ -30,6 +32,7 @@
 #include "libmscore/lyrics.h"
 #include "libmscore/marker.h"
 #include "libmscore/measure.h"
+#include "libmscore/measurecolumns.h"
 #include "libmscore/mmrest.h"
 #include "libmscore/part.h"
 #include "libmscore/score.h"
@@ -46,6 +49,29 @@
 
 using namespace mu::engraving;
 
+//---------------------------------------------------------
+//   mmRestContentKey
+//    what the content copied into an mm rest depends on, besides the underlying measures
+//---------------------------------------------------------
+
+template<typename T>
+static inline void hashCombine(size_t& seed, const T& v)
+{
+    seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+static size_t mmRestContentKey(const Score* score, const Measure* lastMeasure, const Fraction& len, int numMeasures)
+{
+    size_t key = 0;
+    hashCombine(key, lastMeasure);
+    hashCombine(key, len.numerator());
+    hashCombine(key, len.denominator());
+    hashCombine(key, numMeasures);
+    hashCombine(key, score->nstaves());
+    hashCombine(key, score->style().revision());
+    return key;
+}
+
 //---------------------------------------------------------
 //   createMMRest
 //    create a multimeasure rest
@@ -55,11 +81,14 @@ using namespace mu::engraving;
 void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Measure* firstMeasure, Measure* lastMeasure,
                                  const Fraction& len)
 {
+    TRACEFUNC;
     int numMeasuresInMMRest = 1;
+    bool contentValid = firstMeasure->mmRestContentValid();
     if (firstMeasure != lastMeasure) {
         for (Measure* m = firstMeasure->nextMeasure(); m; m = m->nextMeasure()) {
             ++numMeasuresInMMRest;
             m->setMMRestCount(-1);
+            contentValid = contentValid && m->mmRestContentValid();
             if (m->mmRest()) {
                 score->undo(new ChangeMMRest(m, 0));
             }
@@ -69,8 +98,15 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
         }
     }
 
+    const size_t contentKey = mmRestContentKey(score, lastMeasure, len, numMeasuresInMMRest);
+
     // mmrMeasure coexists with n undisplayed measures of rests
     Measure* mmrMeasure = firstMeasure->mmRest();
+
+    // nothing was edited in the range since the mm rest was built: only the segment flags,
+    // which the system layout changes, are set again below, the copied elements are kept
+    const bool upToDate = mmrMeasure && contentValid && mmrMeasure->mmRestContentKey() == contentKey;
+
     if (mmrMeasure) {
         // reuse existing mmrest
         if (mmrMeasure->ticks() != len) {
@@ -98,7 +134,7 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
     //
     // set mmrMeasure with same barline as last underlying measure
     //
-    Segment* lastMeasureEndBarlineSeg = lastMeasure->findSegmentR(SegmentType::EndBarLine, lastMeasure->ticks());
+    Segment* lastMeasureEndBarlineSeg = upToDate ? nullptr : lastMeasure->findSegmentR(SegmentType::EndBarLine, lastMeasure->ticks());
     if (lastMeasureEndBarlineSeg) {
         Segment* mmrEndBarlineSeg = mmrMeasure->undoGetSegmentR(SegmentType::EndBarLine, mmrMeasure->ticks());
         for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
@@ -131,8 +167,8 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
     //
     // if last underlying measure ends with clef change, show same at end of mmrest
     //
-    Segment* lastMeasureClefSeg = lastMeasure->findSegmentR(SegmentType::Clef | SegmentType::HeaderClef,
-                                                            lastMeasure->ticks());
+    Segment* lastMeasureClefSeg = upToDate ? nullptr : lastMeasure->findSegmentR(SegmentType::Clef | SegmentType::HeaderClef,
+                                                                                 lastMeasure->ticks());
     if (lastMeasureClefSeg) {
         Segment* mmrClefSeg = mmrMeasure->undoGetSegment(lastMeasureClefSeg->segmentType(), lastMeasure->endTick());
         for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
@@ -161,35 +197,37 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
     //
     // copy markers to mmrMeasure
     //
-    ElementList oldList = mmrMeasure->takeElements();
-    ElementList newList = lastMeasure->el();
-    for (EngravingItem* e : firstMeasure->el()) {
-        if (e->isMarker()) {
-            newList.push_back(e);
+    if (!upToDate) {
+        ElementList oldList = mmrMeasure->takeElements();
+        ElementList newList = lastMeasure->el();
+        for (EngravingItem* e : firstMeasure->el()) {
+            if (e->isMarker()) {
+                newList.push_back(e);
+            }
         }
-    }
-    for (EngravingItem* e : newList) {
-        bool found = false;
-        for (EngravingItem* ee : oldList) {
-            if (ee->type() == e->type() && ee->subtype() == e->subtype()) {
-                mmrMeasure->add(ee);
-                auto i = std::find(oldList.begin(), oldList.end(), ee);
-                if (i != oldList.end()) {
-                    oldList.erase(i);
+        for (EngravingItem* e : newList) {
+            bool found = false;
+            for (EngravingItem* ee : oldList) {
+                if (ee->type() == e->type() && ee->subtype() == e->subtype()) {
+                    mmrMeasure->add(ee);
+                    auto i = std::find(oldList.begin(), oldList.end(), ee);
+                    if (i != oldList.end()) {
+                        oldList.erase(i);
+                    }
+                    found = true;
+                    break;
                 }
-                found = true;
-                break;
+            }
+            if (!found) {
+                mmrMeasure->add(e->clone());
             }
         }
-        if (!found) {
-            mmrMeasure->add(e->clone());
+        for (EngravingItem* e : oldList) {
+            delete e;
         }
     }
-    for (EngravingItem* e : oldList) {
-        delete e;
-    }
     Segment* s = mmrMeasure->undoGetSegmentR(SegmentType::ChordRest, Fraction(0, 1));
-    for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+    for (size_t staffIdx = 0; !upToDate && staffIdx < score->nstaves(); ++staffIdx) {
         track_idx_t track = staffIdx * VOICES;
         if (s->element(track) == 0) {
             MMRest* mmr = Factory::createMMRest(s);
@@ -212,7 +250,7 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
         }
         mmrSeg->setEnabled(underlyingSeg->enabled());
         mmrSeg->setTrailer(underlyingSeg->trailer());
-        for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        for (size_t staffIdx = 0; !upToDate && staffIdx < score->nstaves(); ++staffIdx) {
             track_idx_t track = staffIdx * VOICES;
             Clef* clef = toClef(underlyingSeg->element(track));
             if (clef) {
@@ -239,7 +277,7 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
         }
         mmrSeg->setEnabled(underlyingSeg->enabled());
         mmrSeg->setHeader(underlyingSeg->header());
-        for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        for (staff_idx_t staffIdx = 0; !upToDate && staffIdx < score->nstaves(); ++staffIdx) {
             track_idx_t track = staffIdx * VOICES;
             TimeSig* underlyingTimeSig = toTimeSig(underlyingSeg->element(track));
             if (underlyingTimeSig) {
@@ -269,7 +307,7 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
         if (mmrSeg == 0) {
             mmrSeg = mmrMeasure->undoGetSegmentR(SegmentType::Ambitus, Fraction(0, 1));
         }
-        for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        for (size_t staffIdx = 0; !upToDate && staffIdx < score->nstaves(); ++staffIdx) {
             track_idx_t track = staffIdx * VOICES;
             Ambitus* underlyingAmbitus = toAmbitus(underlyingSeg->element(track));
             if (underlyingAmbitus) {
@@ -300,7 +338,7 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
         }
         mmrSeg->setEnabled(underlyingSeg->enabled());
         mmrSeg->setHeader(underlyingSeg->header());
-        for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        for (size_t staffIdx = 0; !upToDate && staffIdx < score->nstaves(); ++staffIdx) {
             track_idx_t track = staffIdx * VOICES;
             KeySig* underlyingKeySig  = toKeySig(underlyingSeg->element(track));
             if (underlyingKeySig) {
@@ -334,7 +372,7 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
     //
     // check for rehearsal mark etc.
     //
-    underlyingSeg = firstMeasure->findSegmentR(SegmentType::ChordRest, Fraction(0, 1));
+    underlyingSeg = upToDate ? nullptr : firstMeasure->findSegmentR(SegmentType::ChordRest, Fraction(0, 1));
     if (underlyingSeg) {
         // clone elements from underlying measure to mmr
         for (EngravingItem* e : underlyingSeg->annotations()) {
@@ -385,6 +423,14 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
     MeasureBase* nm = options.showVBox ? lastMeasure->next() : lastMeasure->nextMeasure();
     mmrMeasure->setNext(nm);
     mmrMeasure->setPrev(firstMeasure->prev());
+
+    mmrMeasure->setMMRestContentKey(contentKey);
+    for (Measure* m = firstMeasure; m; m = m->nextMeasure()) {
+        m->setMMRestContentValid(true);
+        if (m == lastMeasure) {
+            break;
+        }
+    }
 }
 
 //---------------------------------------------------------
@@ -459,13 +505,15 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
         return true;
     }
 
-    auto sl = ctx.score()->spannerMap().findOverlapping(m->tick().ticks(), m->endTick().ticks());
-    for (auto i : sl) {
-        Spanner* s = i.value;
+    bool spannerBreak = false;
+    ctx.score()->spannerMap().forEachOverlapping(m->tick().ticks(), m->endTick().ticks(), [m, &spannerBreak](const Spanner* s) {
         // break for first measure of volta or textline and first measure *after* volta
         if ((s->isVolta() || s->isGradualTempoChange() || s->isTextLine()) && (s->tick() == m->tick() || s->tick2() == m->tick())) {
-            return true;
+            spannerBreak = true;
         }
+    });
+    if (spannerBreak) {
+        return true;
     }
 
     // break for marker in this measure
@@ -581,6 +629,7 @@ static void layoutDrumsetChord(Chord* c, const Drumset* drumset, const StaffType
 
 void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext& ctx)
 {
+    TRACEFUNC;
     Score* score = ctx.score();
     ctx.prevMeasure = ctx.curMeasure;
     ctx.curMeasure  = ctx.nextMeasure;
@@ -661,32 +710,42 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
     // calculate accidentals and note lines,
     // create stem and set stem direction
     //
+    // the measure is walked once per staff, take the segments
+    // and their elements into contiguous arrays first
+    const MeasureColumns columns(measure);
+
     for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        if (!columns.staffHasElements(staffIdx)) {
+            continue;
+        }
+
         const Staff* staff     = score->Score::staff(staffIdx);
         const Drumset* drumset
             = staff->part()->instrument(measure->tick())->useDrumset() ? staff->part()->instrument(measure->tick())->drumset() : 0;
         AccidentalState as;          // list of already set accidentals for this measure
         as.init(staff->keySigEvent(measure->tick()));
 
-        for (Segment& segment : measure->segments()) {
+        for (size_t segIdx = 0; segIdx < columns.segmentCount(); ++segIdx) {
+            Segment& segment = *columns.segment(segIdx);
+            const SegmentType segmentType = columns.segmentType(segIdx);
             // TODO? maybe we do need to process it here to make it possible to enable later
             //if (!segment.enabled())
             //      continue;
-            if (segment.isKeySigType()) {
-                KeySig* ks = toKeySig(segment.element(staffIdx * VOICES));
+            if (segmentType == SegmentType::KeySig) {
+                KeySig* ks = toKeySig(columns.element(segIdx, staffIdx * VOICES));
                 if (!ks) {
                     continue;
                 }
                 Fraction tick = segment.tick();
                 as.init(staff->keySigEvent(tick));
                 ks->layout();
-            } else if (segment.isChordRestType()) {
+            } else if (segmentType == SegmentType::ChordRest) {
                 const StaffType* st = staff->staffTypeForElement(&segment);
                 track_idx_t track     = staffIdx * VOICES;
                 track_idx_t endTrack  = track + VOICES;
 
                 for (track_idx_t t = track; t < endTrack; ++t) {
-                    ChordRest* cr = segment.cr(t);
+                    ChordRest* cr = toChordRest(columns.element(segIdx, t));
                     if (!cr) {
                         continue;
                     }
@@ -738,14 +797,14 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
                     }
                     cr->setMag(m);
                 }
-            } else if (segment.isClefType()) {
-                EngravingItem* e = segment.element(staffIdx * VOICES);
+            } else if (segmentType == SegmentType::Clef) {
+                EngravingItem* e = columns.element(segIdx, staffIdx * VOICES);
                 if (e) {
                     toClef(e)->setSmall(true);
                     e->layout();
                 }
-            } else if (segment.isType(SegmentType::TimeSig | SegmentType::Ambitus | SegmentType::HeaderClef)) {
-                EngravingItem* e = segment.element(staffIdx * VOICES);
+            } else if (segmentType & (SegmentType::TimeSig | SegmentType::Ambitus | SegmentType::HeaderClef)) {
+                EngravingItem* e = columns.element(segIdx, staffIdx * VOICES);
                 if (e) {
                     e->layout();
                 }
@@ -759,12 +818,13 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
      * with stems, and stems extensions depend on beams. Solution: we compute dummy beams here, *before*
      * horizontal spacing. It is pointless for the beams themselves, but it *does* correctly extend the
      * stems, thus allowing to compute horizontal spacing correctly. (M.S.) */
+    std::vector<Segment*> beamSegments;
     for (Segment& s : measure->segments()) {
-        if (!s.isChordRestType()) {
-            continue;
+        if (s.isChordRestType()) {
+            beamSegments.push_back(&s);
         }
-        LayoutBeams::layoutNonCrossBeams(&s);
     }
+    LayoutBeams::layoutNonCrossBeams(beamSegments);
 
     for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
         for (Segment& segment : measure->segments()) {
@@ -860,6 +920,7 @@ int LayoutMeasure::adjustMeasureNo(LayoutContext& lc, MeasureBase* m)
  * **************************************************************/
 void LayoutMeasure::computePreSpacingItems(Measure* m)
 {
+    TRACEFUNC;
     // Compute chord properties
     bool isFirstChordInMeasure = true;
     LayoutChords::clearLineAttachPoints(m);
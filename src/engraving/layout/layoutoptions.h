@@ -45,6 +45,11 @@ struct LayoutOptions
 
     bool showVBox = true;
 
+    //! NOTE In page mode, stop after this many pages have been laid out
+    //! and leave the rest of the score for a later Layout::continueLayout() call.
+    //! 0 means no limit.
+    size_t pageLimit = 0;
+
     // from style
     double loWidth = 0;
     double loHeight = 0;
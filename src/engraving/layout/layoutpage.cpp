@@ -22,6 +22,7 @@
 #include "layoutpage.h"
 
 #include "realfn.h"
+#include "global/allocator.h"
 
 #include "libmscore/barline.h"
 #include "libmscore/beam.h"
@@ -360,6 +361,7 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
 
 void LayoutPage::layoutPage(const LayoutContext& ctx, Page* page, double restHeight, double footerPadding)
 {
+    TRACEFUNC;
     if (restHeight < 0.0) {
         LOGN("restHeight < 0.0: %f\n", restHeight);
         restHeight = 0;
@@ -507,6 +509,7 @@ void LayoutPage::checkDivider(const LayoutContext& ctx, bool left, System* s, do
 
 void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double footerPadding)
 {
+    TRACEFUNC;
     Score* score = ctx.score();
     VerticalGapDataList vgdl;
 
@@ -521,7 +524,7 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
     bool transferCurlyBracket  { false };
     for (System* system : page->systems()) {
         if (system->vbox()) {
-            VerticalGapData* vgd = new VerticalGapData(&ctx.score()->style(), !ngaps++, system, nullptr, nullptr, nullptr, prevYBottom);
+            VerticalGapData* vgd = ctx.arena->create<VerticalGapData>(&ctx.score()->style(), !ngaps++, system, nullptr, nullptr, nullptr, prevYBottom);
             vgd->addSpaceAroundVBox(true);
             prevYBottom = system->y();
             yBottom     = system->y() + system->height();
@@ -558,7 +561,7 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
                 }
 
                 VerticalGapData* vgd
-                    = new VerticalGapData(&ctx.score()->style(), !ngaps++, system, staff, sysStaff, nextSpacer, prevYBottom);
+                    = ctx.arena->create<VerticalGapData>(&ctx.score()->style(), !ngaps++, system, staff, sysStaff, nextSpacer, prevYBottom);
                 nextSpacer = system->downSpacer(staff->idx());
 
                 if (newSystem) {
@@ -583,9 +586,11 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
                     vbox = false;
                 }
 
+                // SkylineLine::max() scans the whole skyline, query it once per staff
+                const double southMax = sysStaff->skyline().south().max();
                 prevYBottom  = system->y() + sysStaff->y() + sysStaff->bbox().height();
-                yBottom      = system->y() + sysStaff->y() + sysStaff->skyline().south().max();
-                spacerOffset = sysStaff->skyline().south().max() - sysStaff->bbox().height();
+                yBottom      = system->y() + sysStaff->y() + southMax;
+                spacerOffset = southMax - sysStaff->bbox().height();
                 vgdl.push_back(vgd);
             }
             transferNormalBracket = endNormalBracket >= 0;
@@ -608,6 +613,7 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
     // Try to make the gaps equal, taking the spread factors and maximum spacing into account.
     static const int maxPasses { 20 };     // Saveguard to prevent endless loops.
     int pass { 0 };
+    VerticalGapDataList modified;
     while (!RealIsNull(spaceRemaining) && (ngaps > 0) && (++pass < maxPasses)) {
         ngaps = 0;
         double smallest     { vgdl.smallest() };
@@ -616,12 +622,13 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
             break;
         }
 
-        if ((nextSmallest - smallest) * vgdl.sumStretchFactor() > spaceRemaining) {
-            nextSmallest = smallest + spaceRemaining / vgdl.sumStretchFactor();
+        const double sumStretchFactor { vgdl.sumStretchFactor() };
+        if ((nextSmallest - smallest) * sumStretchFactor > spaceRemaining) {
+            nextSmallest = smallest + spaceRemaining / sumStretchFactor;
         }
 
         double addedSpace { 0.0 };
-        VerticalGapDataList modified;
+        modified.clear();
         for (VerticalGapData* vgd : vgdl) {
             if (!RealIsNull(vgd->spacing() - smallest)) {
                 continue;
@@ -705,5 +712,5 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
         system->layoutBracketsVertical();
         system->layoutInstrumentNames();
     }
-    vgdl.deleteAll();
+    // gap data lives in the layout arena, no need to delete it
 }
@@ -51,10 +51,14 @@
 #include "layoutmeasure.h"
 #include "layouttuplets.h"
 
+#include "concurrency/taskscheduler.h"
 #include "log.h"
 
 using namespace mu::engraving;
 
+// below this number of staves the task dispatch costs more than it saves
+static constexpr size_t PARALLEL_SKYLINES_MIN_STAVES = 8;
+
 //---------------------------------------------------------
 //   collectSystem
 //---------------------------------------------------------
@@ -336,7 +340,10 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
 
     assert(ctx.prevMeasure);
 
-    if (ctx.endTick < ctx.prevMeasure->tick()) {
+    // The first measure of the next system (if any) has already been processed by getNextMeasure(),
+    // so the range is complete as soon as it ends inside the last measure of this system;
+    // there is no need to collect one more system when the edit is at the end of a system.
+    if (ctx.endTick < ctx.prevMeasure->endTick()) {
         // we've processed the entire range
         // but we need to continue layout until we reach a system whose last measure is the same as previous layout
         if (ctx.prevMeasure == ctx.systemOldMeasure) {
@@ -561,6 +568,7 @@ System* LayoutSystem::getNextSystem(LayoutContext& ctx)
 
 void LayoutSystem::hideEmptyStaves(Score* score, System* system, bool isFirstSystem)
 {
+    TRACEFUNC;
     size_t staves = score->nstaves();
     staff_idx_t staffIdx = 0;
     bool systemIsEmpty = true;
@@ -667,8 +675,111 @@ void LayoutSystem::hideEmptyStaves(Score* score, System* system, bool isFirstSys
     }
 }
 
+//---------------------------------------------------------
+//   createSkyline
+//    build the skyline of a single staff of the system
+//---------------------------------------------------------
+
+void LayoutSystem::createSkyline(const LayoutOptions& options, const LayoutContext& ctx, System* system, staff_idx_t staffIdx)
+{
+    SysStaff* ss = system->staff(staffIdx);
+    Skyline& skyline = ss->skyline();
+    skyline.clear();
+    for (MeasureBase* mb : system->measures()) {
+        if (!mb->isMeasure()) {
+            continue;
+        }
+        Measure* m = toMeasure(mb);
+        MeasureNumber* mno = m->noText(staffIdx);
+        MMRestRange* mmrr  = m->mmRangeText(staffIdx);
+        // no need to build skyline outside of range in continuous view
+        if (options.isLinearMode() && (m->tick() < ctx.startTick || m->tick() > ctx.endTick)) {
+            continue;
+        }
+        if (mno && mno->addToSkyline()) {
+            ss->skyline().add(mno->bbox().translated(m->pos() + mno->pos()));
+        }
+        if (mmrr && mmrr->addToSkyline()) {
+            ss->skyline().add(mmrr->bbox().translated(m->pos() + mmrr->pos()));
+        }
+        if (m->staffLines(staffIdx)->addToSkyline()) {
+            ss->skyline().add(m->staffLines(staffIdx)->bbox().translated(m->pos()));
+        }
+        for (Segment& s : m->segments()) {
+            if (!s.enabled() || s.isTimeSigType()) {             // hack: ignore time signatures
+                continue;
+            }
+            PointF p(s.pos() + m->pos());
+            if (s.segmentType()
+                & (SegmentType::BarLine | SegmentType::EndBarLine | SegmentType::StartRepeatBarLine | SegmentType::BeginBarLine)) {
+                BarLine* bl = toBarLine(s.element(staffIdx * VOICES));
+                if (bl && bl->addToSkyline()) {
+                    RectF r = bl->layoutRect();
+                    skyline.add(r.translated(bl->pos() + p));
+                }
+            } else {
+                track_idx_t strack = staffIdx * VOICES;
+                track_idx_t etrack = strack + VOICES;
+                for (EngravingItem* e : s.elist()) {
+                    if (!e) {
+                        continue;
+                    }
+                    track_idx_t effectiveTrack = e->vStaffIdx() * VOICES + e->voice();
+                    if (effectiveTrack < strack || effectiveTrack >= etrack) {
+                        continue;
+                    }
+
+                    // clear layout for chord-based fingerings
+                    // do this before adding chord to skyline
+                    if (e->isChord()) {
+                        Chord* c = toChord(e);
+                        std::list<Note*> notes;
+                        for (auto gc : c->graceNotes()) {
+                            for (auto n : gc->notes()) {
+                                notes.push_back(n);
+                            }
+                        }
+                        for (auto n : c->notes()) {
+                            notes.push_back(n);
+                        }
+                        for (Note* note : notes) {
+                            for (EngravingItem* en : note->el()) {
+                                if (en->isFingering()) {
+                                    Fingering* f = toFingering(en);
+                                    if (f->layoutType() == ElementType::CHORD) {
+                                        f->setPos(PointF());
+                                        f->setbbox(RectF());
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    // add element to skyline
+                    if (e->addToSkyline()) {
+                        skyline.add(e->shape().translated(e->pos() + p));
+                    }
+
+                    // add tremolo to skyline
+                    if (e->isChord() && toChord(e)->tremolo()) {
+                        Tremolo* t = toChord(e)->tremolo();
+                        Chord* c1 = t->chord1();
+                        Chord* c2 = t->chord2();
+                        if (!t->twoNotes() || (c1 && !c1->staffMove() && c2 && !c2->staffMove())) {
+                            if (t->chord() == e && t->addToSkyline()) {
+                                skyline.add(t->shape().translated(t->pos() + e->pos() + p));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutContext& lc, Score* score, System* system)
 {
+    TRACEFUNC;
     if (score->noStaves()) {
         return;
     }
@@ -704,12 +815,15 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
     //  may change.
     //-------------------------------------------------------------
 
+    std::vector<Segment*> beamSegments;
     for (Segment* s : sl) {
-        if (!s->isChordRestType()) {
-            continue;
+        if (s->isChordRestType()) {
+            beamSegments.push_back(s);
         }
-        LayoutBeams::layoutNonCrossBeams(s);
-        // Must recreate the shapes because stem lengths may have been changed!
+    }
+    LayoutBeams::layoutNonCrossBeams(beamSegments);
+    // Must recreate the shapes because stem lengths may have been changed!
+    for (Segment* s : beamSegments) {
         s->createShapes();
     }
 
@@ -717,99 +831,24 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
     //    create skylines
     //-------------------------------------------------------------
 
-    for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
-        SysStaff* ss = system->staff(staffIdx);
-        Skyline& skyline = ss->skyline();
-        skyline.clear();
-        for (MeasureBase* mb : system->measures()) {
-            if (!mb->isMeasure()) {
-                continue;
-            }
-            Measure* m = toMeasure(mb);
-            MeasureNumber* mno = m->noText(staffIdx);
-            MMRestRange* mmrr  = m->mmRangeText(staffIdx);
-            // no need to build skyline outside of range in continuous view
-            if (options.isLinearMode() && (m->tick() < lc.startTick || m->tick() > lc.endTick)) {
-                continue;
-            }
-            if (mno && mno->addToSkyline()) {
-                ss->skyline().add(mno->bbox().translated(m->pos() + mno->pos()));
-            }
-            if (mmrr && mmrr->addToSkyline()) {
-                ss->skyline().add(mmrr->bbox().translated(m->pos() + mmrr->pos()));
-            }
-            if (m->staffLines(staffIdx)->addToSkyline()) {
-                ss->skyline().add(m->staffLines(staffIdx)->bbox().translated(m->pos()));
-            }
-            for (Segment& s : m->segments()) {
-                if (!s.enabled() || s.isTimeSigType()) {             // hack: ignore time signatures
-                    continue;
-                }
-                PointF p(s.pos() + m->pos());
-                if (s.segmentType()
-                    & (SegmentType::BarLine | SegmentType::EndBarLine | SegmentType::StartRepeatBarLine | SegmentType::BeginBarLine)) {
-                    BarLine* bl = toBarLine(s.element(staffIdx * VOICES));
-                    if (bl && bl->addToSkyline()) {
-                        RectF r = bl->layoutRect();
-                        skyline.add(r.translated(bl->pos() + p));
-                    }
-                } else {
-                    track_idx_t strack = staffIdx * VOICES;
-                    track_idx_t etrack = strack + VOICES;
-                    for (EngravingItem* e : s.elist()) {
-                        if (!e) {
-                            continue;
-                        }
-                        track_idx_t effectiveTrack = e->vStaffIdx() * VOICES + e->voice();
-                        if (effectiveTrack < strack || effectiveTrack >= etrack) {
-                            continue;
-                        }
-
-                        // clear layout for chord-based fingerings
-                        // do this before adding chord to skyline
-                        if (e->isChord()) {
-                            Chord* c = toChord(e);
-                            std::list<Note*> notes;
-                            for (auto gc : c->graceNotes()) {
-                                for (auto n : gc->notes()) {
-                                    notes.push_back(n);
-                                }
-                            }
-                            for (auto n : c->notes()) {
-                                notes.push_back(n);
-                            }
-                            for (Note* note : notes) {
-                                for (EngravingItem* en : note->el()) {
-                                    if (en->isFingering()) {
-                                        Fingering* f = toFingering(en);
-                                        if (f->layoutType() == ElementType::CHORD) {
-                                            f->setPos(PointF());
-                                            f->setbbox(RectF());
-                                        }
-                                    }
-                                }
-                            }
-                        }
-
-                        // add element to skyline
-                        if (e->addToSkyline()) {
-                            skyline.add(e->shape().translated(e->pos() + p));
-                        }
-
-                        // add tremolo to skyline
-                        if (e->isChord() && toChord(e)->tremolo()) {
-                            Tremolo* t = toChord(e)->tremolo();
-                            Chord* c1 = t->chord1();
-                            Chord* c2 = t->chord2();
-                            if (!t->twoNotes() || (c1 && !c1->staffMove() && c2 && !c2->staffMove())) {
-                                if (t->chord() == e && t->addToSkyline()) {
-                                    skyline.add(t->shape().translated(t->pos() + e->pos() + p));
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+    const size_t nstaves = score->nstaves();
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    if (nstaves >= PARALLEL_SKYLINES_MIN_STAVES && scheduler->threadPoolSize() > 1) {
+        // every staff writes only to its own skyline and to the elements
+        // that belong to it, so the staves can be processed concurrently
+        std::vector<std::future<void> > futures;
+        futures.reserve(nstaves);
+        for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+            futures.push_back(scheduler->submit([&options, &lc, system, staffIdx]() {
+                createSkyline(options, lc, system, staffIdx);
+            }));
+        }
+        for (std::future<void>& future : futures) {
+            future.get();
+        }
+    } else {
+        for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+            createSkyline(options, lc, system, staffIdx);
         }
     }
 
@@ -1279,7 +1318,7 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
     }
 }
 
-void LayoutSystem::doLayoutTies(System* system, std::vector<Segment*> sl, const Fraction& stick, const Fraction& etick)
+void LayoutSystem::doLayoutTies(System* system, const std::vector<Segment*>& sl, const Fraction& stick, const Fraction& etick)
 {
     UNUSED(etick);
 
@@ -1297,8 +1336,9 @@ void LayoutSystem::doLayoutTies(System* system, std::vector<Segment*> sl, const
     }
 }
 
-void LayoutSystem::processLines(System* system, std::vector<Spanner*> lines, bool align)
+void LayoutSystem::processLines(System* system, const std::vector<Spanner*>& lines, bool align)
 {
+    TRACEFUNC;
     std::vector<SpannerSegment*> segments;
     for (Spanner* sp : lines) {
         SpannerSegment* ss = sp->layoutSystem(system);         // create/layout spanner segment for this system
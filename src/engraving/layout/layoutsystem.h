@@ -43,9 +43,10 @@ public:
 private:
     static System* getNextSystem(LayoutContext& lc);
     static void hideEmptyStaves(Score* score, System* system, bool isFirstSystem);
-    static void processLines(System* system, std::vector<Spanner*> lines, bool align);
+    static void createSkyline(const LayoutOptions& options, const LayoutContext& ctx, System* system, staff_idx_t staffIdx);
+    static void processLines(System* system, const std::vector<Spanner*>& lines, bool align);
     static void layoutTies(Chord* ch, System* system, const Fraction& stick);
-    static void doLayoutTies(System* system, std::vector<Segment*> sl, const Fraction& stick, const Fraction& etick);
+    static void doLayoutTies(System* system, const std::vector<Segment*>& sl, const Fraction& stick, const Fraction& etick);
     static void justifySystem(System* system, double curSysWidth, double targetSystemWidth);
     static void updateCrossBeams(System* system, const LayoutContext& ctx);
     static void restoreTies(System* system);
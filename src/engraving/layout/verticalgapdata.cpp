@@ -235,17 +235,21 @@ double VerticalGapDataList::sumStretchFactor() const
 
 double VerticalGapDataList::smallest(double limit) const
 {
-    VerticalGapData* vdp { nullptr };
-    for (VerticalGapData* vgd : *this) {
+    const double ceilLimit { std::ceil(limit) };
+    bool found { false };
+    double result { 0.0 };
+    for (const VerticalGapData* vgd : *this) {
         if (vgd->isFixedHeight()) {
             continue;
         }
-        if ((std::ceil(limit) == std::ceil(vgd->spacing()))) {
+        const double spacing { vgd->spacing() };
+        if (ceilLimit == std::ceil(spacing)) {
             continue;
         }
-        if (!vdp || (vgd->spacing() < vdp->spacing())) {
-            vdp = vgd;
+        if (!found || spacing < result) {
+            result = spacing;
+            found = true;
         }
     }
-    return vdp ? vdp->spacing() : 0.0;
+    return result;
 }
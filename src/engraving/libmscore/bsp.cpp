@@ -20,9 +20,13 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include "bsp.h"
+
+#include "containers.h"
+
 #include "engravingitem.h"
 
 using namespace mu;
@@ -38,7 +42,7 @@ class InsertItemBspTreeVisitor : public BspTreeVisitor
 public:
     EngravingItem* item;
 
-    inline void visit(std::list<EngravingItem*>* items) { items->push_front(item); }
+    inline void visit(std::vector<EngravingItem*>* items) { items->push_back(item); }
 };
 
 //---------------------------------------------------------
@@ -51,7 +55,7 @@ class RemoveItemBspTreeVisitor : public BspTreeVisitor
 public:
     EngravingItem* item;
 
-    inline void visit(std::list<EngravingItem*>* items) { items->remove(item); }
+    inline void visit(std::vector<EngravingItem*>* items) { mu::remove(*items, item); }
 };
 
 //---------------------------------------------------------
@@ -62,15 +66,14 @@ class FindItemBspTreeVisitor : public BspTreeVisitor
 {
     OBJECT_ALLOCATOR(engraving, FindItemBspTreeVisitor)
 public:
-    std::list<EngravingItem*> foundItems;
+    std::vector<EngravingItem*>* foundItems = nullptr;
 
-    void visit(std::list<EngravingItem*>* items)
+    void visit(std::vector<EngravingItem*>* items)
     {
-        for (auto it = items->begin(); it != items->end(); ++it) {
-            EngravingItem* item = *it;
+        for (EngravingItem* item : *items) {
             if (!item->itemDiscovered) {
                 item->itemDiscovered = true;
-                foundItems.push_front(item);
+                foundItems->push_back(item);
             }
         }
     }
@@ -107,7 +110,9 @@ void BspTree::initialize(const RectF& rec, int n)
 
     nodes.resize((1 << (depth + 1)) - 1);
     leaves.resize(1LL << depth);
-    std::fill(leaves.begin(), leaves.end(), std::list<EngravingItem*>());
+    for (std::vector<EngravingItem*>& leaf : leaves) {
+        leaf.clear();
+    }
     initialize(rec, depth, 0);
 }
 
@@ -150,35 +155,52 @@ void BspTree::remove(EngravingItem* element)
 
 std::vector<EngravingItem*> BspTree::items(const RectF& rec)
 {
-    FindItemBspTreeVisitor findVisitor;
-    climbTree(&findVisitor, rec);
     std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
-        if (e->pageBoundingRect().intersects(rec)) {
-            l.push_back(e);
-        }
-    }
+    items(rec, l);
+    return l;
+}
+
+std::vector<EngravingItem*> BspTree::items(const PointF& pos)
+{
+    std::vector<EngravingItem*> l;
+    items(pos, l);
     return l;
 }
 
 //---------------------------------------------------------
 //   items
+//    the candidates are collected into result and then
+//    filtered in place
 //---------------------------------------------------------
 
-std::vector<EngravingItem*> BspTree::items(const PointF& pos)
+void BspTree::items(const RectF& rec, std::vector<EngravingItem*>& result)
+{
+    const size_t first = result.size();
+
+    FindItemBspTreeVisitor findVisitor;
+    findVisitor.foundItems = &result;
+    climbTree(&findVisitor, rec);
+
+    auto end = std::remove_if(result.begin() + first, result.end(), [&rec](EngravingItem* e) {
+        e->itemDiscovered = false;
+        return !e->pageBoundingRect().intersects(rec);
+    });
+    result.erase(end, result.end());
+}
+
+void BspTree::items(const PointF& pos, std::vector<EngravingItem*>& result)
 {
+    const size_t first = result.size();
+
     FindItemBspTreeVisitor findVisitor;
+    findVisitor.foundItems = &result;
     climbTree(&findVisitor, pos);
 
-    std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
+    auto end = std::remove_if(result.begin() + first, result.end(), [&pos](EngravingItem* e) {
         e->itemDiscovered = false;
-        if (e->contains(pos)) {
-            l.push_back(e);
-        }
-    }
-    return l;
+        return !e->contains(pos);
+    });
+    result.erase(end, result.end());
 }
 
 #ifndef NDEBUG
@@ -23,7 +23,7 @@
 #ifndef __BSP_H__
 #define __BSP_H__
 
-#include <list>
+#include <vector>
 
 #include "global/allocator.h"
 #include "types/string.h"
@@ -61,12 +61,10 @@ private:
     void climbTree(BspTreeVisitor* visitor, const mu::PointF& pos, int index = 0);
     void climbTree(BspTreeVisitor* visitor, const mu::RectF& rect, int index = 0);
 
-    void findItems(std::list<EngravingItem*>* foundItems, const mu::RectF& rect, int index);
-    void findItems(std::list<EngravingItem*>* foundItems, const mu::PointF& pos, int index);
     mu::RectF rectForIndex(int index) const;
 
     std::vector<Node> nodes;
-    std::vector<std::list<EngravingItem*> > leaves;
+    std::vector<std::vector<EngravingItem*> > leaves;
     int leafCnt;
     mu::RectF rect;
 
@@ -82,6 +80,10 @@ public:
     std::vector<EngravingItem*> items(const mu::RectF& rect);
     std::vector<EngravingItem*> items(const mu::PointF& pos);
 
+    //! NOTE Items are appended to result, it is not cleared
+    void items(const mu::RectF& rect, std::vector<EngravingItem*>& result);
+    void items(const mu::PointF& pos, std::vector<EngravingItem*>& result);
+
     int leafCount() const { return leafCnt; }
     inline int firstChildIndex(int index) const { return index * 2 + 1; }
 
@@ -104,7 +106,7 @@ class BspTreeVisitor
     OBJECT_ALLOCATOR(engraving, BspTreeVisitor)
 public:
     virtual ~BspTreeVisitor() {}
-    virtual void visit(std::list<EngravingItem*>* items) = 0;
+    virtual void visit(std::vector<EngravingItem*>* items) = 0;
 };
 } // namespace mu::engraving
 #endif
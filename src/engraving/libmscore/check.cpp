@@ -31,11 +31,16 @@
 #include "tuplet.h"
 #include "utils.h"
 
+#include "concurrency/taskscheduler.h"
 #include "log.h"
 
 using namespace mu;
 using namespace mu::engraving;
 
+//! NOTE Checking a measure is cheap, so small scores are checked on the calling thread
+static constexpr size_t PARALLEL_CHECK_MIN_MEASURES = 64;
+static constexpr size_t PARALLEL_CHECK_GRAIN = 16;
+
 namespace mu::engraving {
 //---------------------------------------------------------
 //   checkScore
@@ -98,6 +103,64 @@ void Score::checkScore()
     }
 }
 
+//---------------------------------------------------------
+//   MeasureCheck
+//    the result of checking one measure, the measures
+//    are checked in parallel, the results are reported
+//    and the fixes applied in the score order afterwards
+//---------------------------------------------------------
+
+struct MeasureCheck
+{
+    struct StaffError {
+        staff_idx_t staffIdx = 0;
+        voice_idx_t voice = 0;
+        Fraction found;
+    };
+
+    Measure* measure = nullptr;
+    int number = 0;
+    std::vector<StaffError> errors;
+    std::vector<Rest*> badMeasureRests;
+};
+
+static void checkMeasureDurations(MeasureCheck& check, size_t nstaves)
+{
+    Measure* m = check.measure;
+    Fraction mLen = m->ticks();
+
+    for (size_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+        Rest* fmrest0 = 0;            // full measure rest in voice 0
+        Fraction voices[VOICES];
+        for (Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
+            for (size_t v = 0; v < VOICES; ++v) {
+                ChordRest* cr = toChordRest(s->element(static_cast<int>(staffIdx) * VOICES + static_cast<int>(v)));
+                if (cr == 0) {
+                    continue;
+                }
+                voices[v] += cr->actualTicks();
+                if (v == 0 && cr->isRest()) {
+                    Rest* r = toRest(cr);
+                    if (r->durationType().isMeasure()) {
+                        fmrest0 = r;
+                    }
+                }
+            }
+        }
+        if (voices[0] != mLen) {
+            check.errors.push_back({ staffIdx, 0, voices[0] });
+            if (fmrest0) {
+                check.badMeasureRests.push_back(fmrest0);
+            }
+        }
+        for (voice_idx_t v = 1; v < VOICES; ++v) {
+            if (voices[v] > mLen) {
+                check.errors.push_back({ staffIdx, v, voices[v] });
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------
 //   sanityCheck - Simple check for score
 ///    Check that voice 1 is complete
@@ -106,63 +169,78 @@ void Score::checkScore()
 
 bool Score::sanityCheck()
 {
-    bool result = true;
+    return sanityCheck(Fraction(0, 1), Fraction(-1, 1));
+}
+
+//---------------------------------------------------------
+//   sanityCheck
+///    Check only the measures overlapping [startTick, endTick],
+///    e.g. the range changed by a command.
+///    A negative endTick means the end of the score
+//---------------------------------------------------------
+
+bool Score::sanityCheck(const Fraction& startTick, const Fraction& endTick)
+{
+    std::vector<MeasureCheck> checks;
     int mNumber = 1;
-    String error;
-    for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
+    for (Measure* m = firstMeasure(); m; m = m->nextMeasure(), ++mNumber) {
+        if (endTick >= Fraction(0, 1) && m->tick() > endTick) {
+            break;
+        }
+        if (m->endTick() <= startTick) {
+            continue;
+        }
+        MeasureCheck check;
+        check.measure = m;
+        check.number = mNumber;
+        checks.push_back(std::move(check));
+    }
+
+    const size_t nstaves = staves().size();
+    auto checkMeasure = [&checks, nstaves](size_t idx) {
+        checkMeasureDurations(checks[idx], nstaves);
+    };
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    if (checks.size() >= PARALLEL_CHECK_MIN_MEASURES && scheduler->threadPoolSize() > 1) {
+        scheduler->parallelFor(size_t(0), checks.size(), checkMeasure, PARALLEL_CHECK_GRAIN);
+    } else {
+        for (size_t idx = 0; idx < checks.size(); ++idx) {
+            checkMeasure(idx);
+        }
+    }
+
+    bool result = true;
+    for (const MeasureCheck& check : checks) {
+        Measure* m = check.measure;
         Fraction mLen = m->ticks();
-        size_t endStaff  = staves().size();
-        for (size_t staffIdx = 0; staffIdx < endStaff; ++staffIdx) {
-            Rest* fmrest0 = 0;            // full measure rest in voice 0
-            Fraction voices[VOICES];
 #ifndef NDEBUG
+        for (size_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
             m->setCorrupted(staffIdx, false);
+        }
 #endif
-            for (Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
-                for (size_t v = 0; v < VOICES; ++v) {
-                    ChordRest* cr = toChordRest(s->element(static_cast<int>(staffIdx) * VOICES + static_cast<int>(v)));
-                    if (cr == 0) {
-                        continue;
-                    }
-                    voices[v] += cr->actualTicks();
-                    if (v == 0 && cr->isRest()) {
-                        Rest* r = toRest(cr);
-                        if (r->durationType().isMeasure()) {
-                            fmrest0 = r;
-                        }
-                    }
-                }
-            }
-            if (voices[0] != mLen) {
+        for (const MeasureCheck::StaffError& error : check.errors) {
+            if (error.voice == 0) {
                 LOGE() << String(u"Measure %1, staff %2 incomplete. Expected: %3; Found: %4")
-                    .arg(mNumber).arg(staffIdx + 1).arg(mLen.toString(), voices[0].toString());
-
-#ifndef NDEBUG
-                m->setCorrupted(staffIdx, true);
-#endif
-                result = false;
-                // try to fix a bad full measure rest
-                if (fmrest0) {
-                    // fmrest0->setDuration(mLen * fmrest0->staff()->timeStretch(fmrest0->tick()));
-                    fmrest0->setTicks(mLen);
-                    if (fmrest0->actualTicks() != mLen) {
-                        fprintf(stderr, "whoo???\n");
-                    }
-                }
+                    .arg(check.number).arg(error.staffIdx + 1).arg(mLen.toString(), error.found.toString());
+            } else {
+                LOGE() << String(u"Measure %1, staff %2, voice %3 too long. Expected: %4; Found: %5")
+                    .arg(check.number).arg(error.staffIdx + 1).arg(error.voice + 1).arg(mLen.toString(), error.found.toString());
             }
-            for (voice_idx_t v = 1; v < VOICES; ++v) {
-                if (voices[v] > mLen) {
-                    LOGE() << String(u"Measure %1, staff %2, voice %3 too long. Expected: %4; Found: %5")
-                        .arg(mNumber).arg(staffIdx + 1).arg(v + 1).arg(mLen.toString(), voices[v].toString());
-
 #ifndef NDEBUG
-                    m->setCorrupted(staffIdx, true);
+            m->setCorrupted(error.staffIdx, true);
 #endif
-                    result = false;
-                }
+            result = false;
+        }
+
+        // try to fix a bad full measure rest
+        for (Rest* fmrest0 : check.badMeasureRests) {
+            // fmrest0->setDuration(mLen * fmrest0->staff()->timeStretch(fmrest0->tick()));
+            fmrest0->setTicks(mLen);
+            if (fmrest0->actualTicks() != mLen) {
+                fprintf(stderr, "whoo???\n");
             }
         }
-        mNumber++;
     }
 
     return result;
@@ -1824,6 +1824,23 @@ void Chord::calcRelativeMag()
     }
 }
 
+//---------------------------------------------------------
+//   stemElementsOutdated
+//    true if layoutStem() would add or remove the stem, hook or stem slash
+//---------------------------------------------------------
+
+bool Chord::stemElementsOutdated() const
+{
+    if (!shouldHaveStem()) {
+        return _stem || _hook || _stemSlash;
+    }
+    if (!_stem || shouldHaveHook() != (_hook != nullptr)) {
+        return true;
+    }
+    bool needsStemSlash = (_noteType == NoteType::ACCIACCATURA) && !(beam() && beam()->elements().front() != this);
+    return needsStemSlash != (_stemSlash != nullptr);
+}
+
 //! May be called again when the chord is added to or removed from a beam.
 void Chord::layoutStem()
 {
@@ -249,6 +249,7 @@ public:
     void setEndsGlissando(bool val) { _endsGlissando = val; }
     void updateEndsGlissando();
     StemSlash* stemSlash() const { return _stemSlash; }
+    bool stemElementsOutdated() const;
     bool slash();
     void setSlash(bool flag, bool stemless);
     void removeMarkings(bool keepTremolo = false) override;
@@ -1768,6 +1768,8 @@ void ChordList::read(XmlReader& e)
             e.unknown();
         }
     }
+
+    invalidateCache();
 }
 
 //---------------------------------------------------------
@@ -1928,6 +1930,8 @@ void ChordList::unload()
     renderListBase.clear();
     chordTokenList.clear();
     _autoAdjust = false;
+
+    invalidateCache();
 }
 
 const ChordDescription* ChordList::description(int id) const
@@ -1939,6 +1943,98 @@ const ChordDescription* ChordList::description(int id) const
     return &it->second;
 }
 
+//---------------------------------------------------------
+//   parse
+//---------------------------------------------------------
+
+const ParsedChord& ChordList::parse(const String& name, bool syntaxOnly, bool preferMinor) const
+{
+    //! NOTE The result depends on nothing but the name, the flags and the tokens of this list
+    static constexpr size_t MAX_CACHED_CHORDS = 4096;
+
+    ParseKey key { name, syntaxOnly, preferMinor };
+    auto it = m_parseCache.find(key);
+    if (it != m_parseCache.end()) {
+        return it->second;
+    }
+
+    if (m_parseCache.size() >= MAX_CACHED_CHORDS) {
+        m_parseCache.clear();
+    }
+
+    ParsedChord pc;
+    pc.parse(name, this, syntaxOnly, preferMinor);
+    return m_parseCache.emplace(std::move(key), std::move(pc)).first->second;
+}
+
+//---------------------------------------------------------
+//   findDescription
+//---------------------------------------------------------
+
+const ChordDescription* ChordList::findDescription(const String& name, const ParsedChord* pc) const
+{
+    updateIndex();
+
+    auto it = m_nameIndex.find(name);
+    if (it != m_nameIndex.end()) {
+        return description(it->second);
+    }
+
+    // exact match failed, so fall back on parsed match if one was found
+    if (pc) {
+        it = m_parsedIndex.find(pc->handle());
+        if (it != m_parsedIndex.end()) {
+            return description(it->second);
+        }
+    }
+
+    return nullptr;
+}
+
+//---------------------------------------------------------
+//   invalidateCache
+//---------------------------------------------------------
+
+void ChordList::invalidateCache()
+{
+    m_parseCache.clear();
+    m_indexValid = false;
+}
+
+//---------------------------------------------------------
+//   updateIndex
+//---------------------------------------------------------
+
+void ChordList::updateIndex() const
+{
+    //! NOTE Descriptions can also be added straight into the map (see Harmony::generateDescription),
+    //! a changed size is taken as a change as well
+    if (m_indexValid && m_indexedSize == size()) {
+        return;
+    }
+
+    m_nameIndex.clear();
+    m_parsedIndex.clear();
+
+    for (const auto& p : *this) {
+        const ChordDescription& cd = p.second;
+        if (cd.names.empty()) {
+            continue;
+        }
+
+        // the first description wins for a name, the last one for a parsed form
+        for (const String& s : cd.names) {
+            m_nameIndex.emplace(s, cd.id);
+        }
+        for (const ParsedChord& parsed : cd.parsedChords) {
+            m_parsedIndex[parsed.handle()] = cd.id;
+        }
+    }
+
+    m_indexedSize = size();
+    m_indexValid = true;
+}
+
 void ChordList::checkChordList(const MStyle& style)
 {
     // make sure we have a chordlist
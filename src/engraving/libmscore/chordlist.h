@@ -24,6 +24,7 @@
 #define __CHORDLIST_H__
 
 #include <map>
+#include <unordered_map>
 
 #include "global/allocator.h"
 #include "types/string.h"
@@ -307,12 +308,47 @@ public:
 
     void checkChordList(const MStyle& style);
 
+    //! NOTE Parsed forms are cached per chord list, lead sheets repeat the same few symbols a lot
+    const ParsedChord& parse(const String& name, bool syntaxOnly = false, bool preferMinor = false) const;
+
+    //! NOTE Looks up a description by one of its names,
+    //! falls back to a description whose parsed form matches pc
+    const ChordDescription* findDescription(const String& name, const ParsedChord* pc = nullptr) const;
+
 private:
 
     friend class compat::ReadChordListHook;
 
     void read(XmlReader&);
     void write(XmlWriter& xml) const;
+
+    void invalidateCache();
+    void updateIndex() const;
+
+    struct ParseKey {
+        String name;
+        bool syntaxOnly = false;
+        bool preferMinor = false;
+
+        bool operator==(const ParseKey& k) const
+        {
+            return name == k.name && syntaxOnly == k.syntaxOnly && preferMinor == k.preferMinor;
+        }
+    };
+
+    struct ParseKeyHash {
+        size_t operator()(const ParseKey& k) const noexcept
+        {
+            return k.name.hash() ^ (size_t(k.syntaxOnly) << 1) ^ (size_t(k.preferMinor) << 2);
+        }
+    };
+
+    mutable std::unordered_map<ParseKey, ParsedChord, ParseKeyHash> m_parseCache;
+
+    mutable std::unordered_map<String, int> m_nameIndex;
+    mutable std::unordered_map<String, int> m_parsedIndex;
+    mutable size_t m_indexedSize = 0;
+    mutable bool m_indexValid = false;
 };
 } // namespace mu::engraving
 #endif
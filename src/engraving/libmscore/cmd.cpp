@@ -141,7 +141,6 @@ void CmdState::reset()
     _oneElement = true;
     _mb = nullptr;
     _oneMeasureBase = true;
-    _locked = false;
 }
 
 //---------------------------------------------------------
@@ -150,7 +149,7 @@ void CmdState::reset()
 
 void CmdState::setTick(const Fraction& t)
 {
-    if (_locked) {
+    if (locked()) {
         return;
     }
 
@@ -169,7 +168,7 @@ void CmdState::setTick(const Fraction& t)
 
 void CmdState::setStaff(staff_idx_t st)
 {
-    if (_locked || st == mu::nidx) {
+    if (locked() || st == mu::nidx) {
         return;
     }
 
@@ -187,7 +186,7 @@ void CmdState::setStaff(staff_idx_t st)
 
 void CmdState::setMeasureBase(const MeasureBase* mb)
 {
-    if (!mb || _mb == mb || _locked) {
+    if (!mb || _mb == mb || locked()) {
         return;
     }
 
@@ -201,7 +200,7 @@ void CmdState::setMeasureBase(const MeasureBase* mb)
 
 void CmdState::setElement(const EngravingItem* e)
 {
-    if (!e || _el == e || _locked) {
+    if (!e || _el == e || locked()) {
         return;
     }
 
@@ -276,6 +275,13 @@ void Score::startCmd()
 
     MScore::setError(MsError::MS_NO_ERROR);
 
+    // inside a batch the commands go into the batch macro,
+    // the changed ranges are accumulated until endBatch()
+    if (isBatchActive() && undoStack()->active()) {
+        masterScore()->batchState().cmdStart = undoStack()->current()->childCount();
+        return;
+    }
+
     cmdState().reset();
 
     // Start collecting low-level undo operations for a
@@ -287,6 +293,68 @@ void Score::startCmd()
     undoStack()->beginMacro(this);
 }
 
+//---------------------------------------------------------
+//   startBatch
+//    Commands between startBatch() and endBatch() are
+//    collected into a single undo step. Their startCmd() and
+//    endCmd() calls only mark command boundaries (a rollback
+//    reverts just that command), layout and the change
+//    notification happen once in endBatch().
+//    Batches nest, only the outermost one takes effect.
+//---------------------------------------------------------
+
+void Score::startBatch()
+{
+    if (undoStack()->locked()) {
+        return;
+    }
+
+    auto& batch = masterScore()->batchState();
+    if (batch.level++ > 0) {
+        return;
+    }
+
+    startCmd();
+    batch.cmdStart = 0;
+    batch.layoutAllParts = false;
+}
+
+//---------------------------------------------------------
+//   endBatch
+//---------------------------------------------------------
+
+void Score::endBatch(bool rollback, bool layoutAllParts)
+{
+    if (undoStack()->locked()) {
+        return;
+    }
+
+    auto& batch = masterScore()->batchState();
+    if (batch.level == 0) {
+        LOGW() << "no batch active";
+        return;
+    }
+
+    if (--batch.level > 0) {
+        batch.layoutAllParts |= layoutAllParts;
+        return;
+    }
+
+    // the error may have been set by the last command of the batch, it is already handled
+    MScore::setError(MsError::MS_NO_ERROR);
+
+    endCmd(rollback, layoutAllParts || batch.layoutAllParts);
+}
+
+//---------------------------------------------------------
+//   isBatchActive
+//---------------------------------------------------------
+
+bool Score::isBatchActive() const
+{
+    return masterScore()->batchState().level > 0;
+}
+
 //---------------------------------------------------------
 //   undoRedo
 //---------------------------------------------------------
@@ -353,6 +421,17 @@ void Score::endCmd(bool rollback, bool layoutAllParts)
         rollback = true;
     }
 
+    if (isBatchActive()) {
+        auto& batch = masterScore()->batchState();
+        if (rollback) {
+            // revert only this command, keep the rest of the batch
+            undoStack()->current()->unwind(batch.cmdStart);
+        }
+        batch.cmdStart = undoStack()->current()->childCount();
+        batch.layoutAllParts |= layoutAllParts;
+        return;
+    }
+
     if (rollback) {
         undoStack()->current()->unwind();
     }
@@ -442,6 +521,17 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
         MasterScore* ms = masterScore();
         CmdState& cs = ms->cmdState();
         if (updateAll || cs.updateAll()) {
+            if (!updateAll) {
+                // nothing was laid out, so the changed areas are unknown
+                for (Score* s : scoreList()) {
+                    s->setDamageAll();
+                }
+            } else if (!_updateState.refresh.isNull()) {
+                // the areas marked besides the layout, e.g. the removed elements
+                double d = spatium() * .5;
+                addDamage(_updateState.refresh.adjusted(-d, -d, 2 * d, 2 * d));
+                _updateState.refresh = RectF();
+            }
             for (Score* s : scoreList()) {
                 for (MuseScoreView* v : s->viewer) {
                     v->updateAll();
@@ -451,6 +541,7 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
             // updateRange updates only current score
             double d = spatium() * .5;
             _updateState.refresh.adjust(-d, -d, 2 * d, 2 * d);
+            addDamage(_updateState.refresh);
             for (MuseScoreView* v : viewer) {
                 v->dataChanged(_updateState.refresh);
             }
@@ -3233,7 +3324,9 @@ void Score::cmdExplode()
         }
         int full = 0;
 
-        for (Segment* seg = startSegment; seg && seg->tick() < lTick; seg = seg->next1()) {
+        // the tracks only depend on the contents of the measures, so each measure is checked once
+        // rather than once for each of its segments
+        for (Measure* sm = startMeasure; sm && sm->tick() < lTick && full != VOICES; sm = sm->nextMeasure()) {
             for (track_idx_t i = srcTrack; i < srcTrack + VOICES && full != VOICES; i++) {
                 bool t = true;
                 for (voice_idx_t j = 0; j < VOICES; j++) {
@@ -3243,7 +3336,7 @@ void Score::cmdExplode()
                     }
                 }
 
-                if (!seg->measure()->hasVoice(i) || seg->measure()->isOnlyRests(i) || !t) {
+                if (!t || !sm->hasVoice(i) || sm->isOnlyRests(i)) {
                     continue;
                 }
                 sTracks[full] = i;
@@ -3253,7 +3346,7 @@ void Score::cmdExplode()
                         dTracks[full] = j;
                         break;
                     }
-                    for (Measure* m = seg->measure(); m && m->tick() < lTick; m = m->nextMeasure()) {
+                    for (Measure* m = sm; m && m->tick() < lTick; m = m->nextMeasure()) {
                         if (!m->hasVoice(j) || (m->hasVoice(j) && m->isOnlyRests(j))) {
                             dTracks[full] = j;
                         } else {
@@ -183,10 +183,19 @@ void EngravingItem::notifyAboutNameChanged()
         return;
     }
 
-    if (m_accessible) {
-        doInitAccessible();
-        m_accessible->accessibleRoot()->notifyAboutFocusedElementNameChanged();
+    if (!m_accessible) {
+        return;
     }
+
+    //! NOTE Only the focused element is voiced, so the other selected elements
+    //! (e.g. when a command changes the whole selection) don't send notifications
+    AccessibleRoot* root = m_accessible->accessibleRoot();
+    if (!root || root->focusedElement().lock() != m_accessible) {
+        return;
+    }
+
+    doInitAccessible();
+    root->notifyAboutFocusedElementNameChanged();
 }
 
 #endif
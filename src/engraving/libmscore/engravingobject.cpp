@@ -23,6 +23,7 @@
 #include "engravingobject.h"
 
 #include <iterator>
+#include <mutex>
 #include <unordered_set>
 
 #include "rw/xml.h"
@@ -45,6 +46,10 @@ using namespace mu::engraving;
 namespace mu::engraving {
 ElementStyle const EngravingObject::emptyStyle;
 
+//! NOTE The link lists are shared between the master score and its parts,
+//! the layouts of the parts may add to them concurrently (e.g. when creating mmrests)
+static std::mutex s_linksMutex;
+
 EngravingObject* EngravingObjectList::at(size_t i) const
 {
     return *std::next(begin(), i);
@@ -618,6 +623,7 @@ void EngravingObject::linkTo(EngravingObject* element)
     assert(element != this);
     assert(!_links);
 
+    std::lock_guard<std::mutex> lock(s_linksMutex);
     if (element->links()) {
         _links = element->_links;
         assert(_links->contains(element));
@@ -644,6 +650,7 @@ void EngravingObject::unlink()
         return;
     }
 
+    std::lock_guard<std::mutex> lock(s_linksMutex);
     assert(_links->contains(this));
     _links->remove(this);
 
@@ -711,6 +718,7 @@ std::list<EngravingObject*> EngravingObject::linkList() const
 {
     std::list<EngravingObject*> el;
     if (_links) {
+        std::lock_guard<std::mutex> lock(s_linksMutex);
         el = *_links;
     } else {
         el.push_back(const_cast<EngravingObject*>(this));
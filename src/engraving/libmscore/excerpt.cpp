@@ -302,7 +302,9 @@ void Excerpt::read(XmlReader& e)
     }
 }
 
-void Excerpt::createExcerpt(Excerpt* excerpt)
+//! NOTE With layout == false the part score is only marked for a full layout,
+//! which runs when the part is opened or exported (closed scores are skipped by Score::update() anyway)
+void Excerpt::createExcerpt(Excerpt* excerpt, bool layout)
 {
     MasterScore* masterScore = excerpt->masterScore();
     Score* score = excerpt->excerptScore();
@@ -382,12 +384,17 @@ void Excerpt::createExcerpt(Excerpt* excerpt)
         score->setMetaTag(u"partName", partLabel);
     }
 
+    bool transpose = masterScore->styleB(Sid::concertPitch) != score->styleB(Sid::concertPitch);
+
     // initial layout of score
+    // the transposition below walks the mmrest segments, which only exist after a layout
     score->addLayoutFlags(LayoutFlag::FIX_PITCH_VELO);
-    score->doLayout();
+    if (layout || transpose) {
+        score->doLayout();
+    }
 
     // handle transposing instruments
-    if (masterScore->styleB(Sid::concertPitch) != score->styleB(Sid::concertPitch)) {
+    if (transpose) {
         for (const Staff* staff : score->staves()) {
             if (staff->staffType(Fraction(0, 1))->group() == StaffGroup::PERCUSSION) {
                 continue;
@@ -460,7 +467,9 @@ void Excerpt::createExcerpt(Excerpt* excerpt)
     score->remapBracketsAndBarlines();
 
     score->setLayoutAll();
-    score->doLayout();
+    if (layout) {
+        score->doLayout();
+    }
 }
 
 void MasterScore::deleteExcerpt(Excerpt* excerpt)
@@ -516,9 +525,9 @@ void MasterScore::deleteExcerpt(Excerpt* excerpt)
     undo(new RemoveExcerpt(excerpt));
 }
 
-void MasterScore::initAndAddExcerpt(Excerpt* excerpt, bool fakeUndo)
+void MasterScore::initAndAddExcerpt(Excerpt* excerpt, bool fakeUndo, bool layout)
 {
-    initExcerpt(excerpt);
+    initExcerpt(excerpt, layout);
 
     auto excerptCmd = new AddExcerpt(excerpt);
     if (fakeUndo) {
@@ -528,10 +537,14 @@ void MasterScore::initAndAddExcerpt(Excerpt* excerpt, bool fakeUndo)
     }
 }
 
-void MasterScore::initExcerpt(Excerpt* excerpt)
+void MasterScore::initExcerpt(Excerpt* excerpt, bool layout)
 {
     if (excerpt->inited()) {
-        excerpt->excerptScore()->doLayout();
+        if (layout) {
+            excerpt->excerptScore()->doLayout();
+        } else {
+            excerpt->excerptScore()->setLayoutAll();
+        }
         return;
     }
 
@@ -540,7 +553,7 @@ void MasterScore::initExcerpt(Excerpt* excerpt)
     score->style().set(Sid::createMultiMeasureRests, true);
     initParts(excerpt);
 
-    Excerpt::createExcerpt(excerpt);
+    Excerpt::createExcerpt(excerpt, layout);
     excerpt->setInited(true);
 }
 
@@ -765,6 +778,15 @@ static MeasureBase* cloneMeasure(MeasureBase* mb, Score* score, const Score* osc
 
             track_idx_t strack = mu::value(trackList, srcTrack, mu::nidx);
 
+            // nothing is cloned from a track that is not in the excerpt,
+            // except system elements which are taken from track 0
+            if (strack == mu::nidx && srcTrack != 0) {
+                continue;
+            }
+
+            //There are probably more destination tracks for the same source
+            const std::vector<track_idx_t> dstTracks = mu::values(trackList, srcTrack);
+
             Tremolo* tremolo = 0;
             for (Segment* oseg = m->first(); oseg; oseg = oseg->next()) {
                 Segment* ns = nullptr;           //create segment later, on demand
@@ -795,14 +817,11 @@ static MeasureBase* cloneMeasure(MeasureBase* mb, Score* score, const Score* osc
                 }
 
                 //If track is not mapped skip the following
-                if (mu::value(trackList, srcTrack, mu::nidx) == mu::nidx) {
+                if (strack == mu::nidx) {
                     continue;
                 }
 
-                //There are probably more destination tracks for the same source
-                std::vector<track_idx_t> t = mu::values(trackList, srcTrack);
-
-                for (track_idx_t track : t) {
+                for (track_idx_t track : dstTracks) {
                     //Clone KeySig TimeSig and Clefs if voice 1 of source staff is not mapped to a track
                     EngravingItem* oef = oseg->element(trackZeroVoice(srcTrack));
                     if (oef && !oef->generated() && (oef->isTimeSig() || oef->isKeySig())
@@ -795,8 +795,7 @@ const ChordDescription* Harmony::parseHarmony(const String& ss, int* root, int*
     if (useLiteral) {
         cd = descr(s);
     } else {
-        _parsedForm = new ParsedChord();
-        _parsedForm->parse(s, cl, syntaxOnly, preferMinor);
+        _parsedForm = new ParsedChord(cl->parse(s, syntaxOnly, preferMinor));
         // parser prepends "=" to name of implied minor chords
         // use this here as well
         if (preferMinor) {
@@ -1276,25 +1275,7 @@ const ChordDescription* Harmony::descr() const
 const ChordDescription* Harmony::descr(const String& name, const ParsedChord* pc) const
 {
     const ChordList* cl = score()->chordList();
-    const ChordDescription* match = 0;
-    if (cl) {
-        for (const auto& p : *cl) {
-            const ChordDescription& cd = p.second;
-            for (const String& s : cd.names) {
-                if (s == name) {
-                    return &cd;
-                } else if (pc) {
-                    for (const ParsedChord& sParsed : cd.parsedChords) {
-                        if (sParsed == *pc) {
-                            match = &cd;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    // exact match failed, so fall back on parsed match if one was found
-    return match;
+    return cl ? cl->findDescription(name, pc) : nullptr;
 }
 
 //---------------------------------------------------------
@@ -2014,9 +1995,8 @@ const std::vector<HDegree>& Harmony::degreeList() const
 const ParsedChord* Harmony::parsedForm()
 {
     if (!_parsedForm) {
-        ChordList* cl = score()->chordList();
-        _parsedForm = new ParsedChord();
-        _parsedForm->parse(_textName, cl, false);
+        const ChordList* cl = score()->chordList();
+        _parsedForm = new ParsedChord(cl->parse(_textName));
     }
     return _parsedForm;
 }
@@ -85,7 +85,7 @@ Image::Image(const Image& img)
     _linkPath        = img._linkPath;
     _linkIsValid     = img._linkIsValid;
     if (imageType == ImageType::RASTER) {
-        rasterDoc = img.rasterDoc ? std::make_shared<Pixmap>(*img.rasterDoc) : nullptr;
+        rasterDoc = img.rasterDoc;
     } else if (imageType == ImageType::SVG) {
         svgDoc = img.svgDoc ? new SvgRenderer(_storeItem->buffer()) : 0;
     }
@@ -175,7 +175,7 @@ void Image::draw(mu::draw::Painter* painter) const
                 t.setMatrix(1.0, t.m12(), t.m13(), t.m21(), 1.0, t.m23(), t.m31(), t.m32(), t.m33());
                 painter->setWorldTransform(t);
                 if ((buffer.size() != ss || _dirty) && rasterDoc && !rasterDoc->isNull()) {
-                    buffer = imageProvider()->scaled(*rasterDoc, ss);
+                    buffer = _storeItem ? _storeItem->scaled(ss) : imageProvider()->scaled(*rasterDoc, ss);
                     _dirty = false;
                 }
                 if (buffer.isNull()) {
@@ -553,8 +553,8 @@ void Image::layout()
         }
     } else if (imageType == ImageType::RASTER && !rasterDoc) {
         if (_storeItem) {
-            rasterDoc = imageProvider()->createPixmap(_storeItem->buffer());
-            if (!rasterDoc->isNull()) {
+            rasterDoc = _storeItem->pixmap();
+            if (rasterDoc && !rasterDoc->isNull()) {
                 _dirty = true;
             }
         }
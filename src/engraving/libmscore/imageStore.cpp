@@ -53,6 +53,12 @@ ImageStoreItem::ImageStoreItem(const path_t& p)
 void ImageStoreItem::dereference(Image* image)
 {
     _references.remove(image);
+
+    //! NOTE The encoded buffer is kept for saving, the decoded images are made again when needed
+    if (_references.empty()) {
+        _pixmap.reset();
+        _mipmaps.clear();
+    }
 }
 
 //---------------------------------------------------------
@@ -100,6 +106,54 @@ void ImageStoreItem::load()
     _hash = cryptographicHash()->hash(_buffer, ICryptographicHash::Algorithm::Md4);
 }
 
+//---------------------------------------------------------
+//   pixmap
+//    decode the raster image once for all its references
+//---------------------------------------------------------
+
+std::shared_ptr<draw::Pixmap> ImageStoreItem::pixmap()
+{
+    if (!_pixmap) {
+        load();
+        _pixmap = imageProvider()->createPixmap(_buffer);
+    }
+    return _pixmap;
+}
+
+//---------------------------------------------------------
+//   scaled
+//    scale from the smallest mipmap level that is still
+//    bigger than the requested size, so zooming out doesn't
+//    rescale the whole image every time
+//---------------------------------------------------------
+
+draw::Pixmap ImageStoreItem::scaled(const Size& size)
+{
+    std::shared_ptr<draw::Pixmap> origin = pixmap();
+    if (!origin || origin->isNull()) {
+        return draw::Pixmap();
+    }
+
+    const draw::Pixmap* source = origin.get();
+    for (size_t level = 0;; ++level) {
+        const Size half(source->width() / 2, source->height() / 2);
+        if (half.width() < size.width() || half.height() < size.height() || half.width() < 1 || half.height() < 1) {
+            break;
+        }
+
+        if (level == _mipmaps.size()) {
+            _mipmaps.push_back(imageProvider()->scaled(*source, half));
+        }
+        source = &_mipmaps.at(level);
+    }
+
+    if (source->size() == size) {
+        return *source;
+    }
+
+    return imageProvider()->scaled(*source, size);
+}
+
 //---------------------------------------------------------
 //   hashName
 //---------------------------------------------------------
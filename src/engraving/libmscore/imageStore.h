@@ -24,6 +24,7 @@
 #define __IMAGE_CACHE_H__
 
 #include <list>
+#include <memory>
 
 #include "types/string.h"
 #include "types/bytearray.h"
@@ -31,6 +32,8 @@
 
 #include "modularity/ioc.h"
 #include "global/icryptographichash.h"
+#include "draw/iimageprovider.h"
+#include "draw/types/pixmap.h"
 
 namespace mu::engraving {
 class Image;
@@ -43,6 +46,7 @@ class Score;
 class ImageStoreItem
 {
     INJECT(engraving, ICryptographicHash, cryptographicHash)
+    INJECT(engraving, mu::draw::IImageProvider, imageProvider)
 
     std::list<Image*> _references;
     io::path_t _path;                  // original location of image
@@ -50,6 +54,9 @@ class ImageStoreItem
     mu::ByteArray _buffer;
     mu::ByteArray _hash;               // 16 byte md4 hash of _buffer
 
+    std::shared_ptr<mu::draw::Pixmap> _pixmap;     // decoded on first use, shared by the references
+    std::vector<mu::draw::Pixmap> _mipmaps;        // _pixmap downscaled by 2, 4, 8...
+
 public:
     ImageStoreItem(const io::path_t& p);
     void dereference(Image*);
@@ -66,6 +73,9 @@ public:
     String hashName() const;
     const mu::ByteArray& hash() const { return _hash; }
     void set(const mu::ByteArray& b, const mu::ByteArray& h) { _buffer = b; _hash = h; }
+
+    std::shared_ptr<mu::draw::Pixmap> pixmap();
+    mu::draw::Pixmap scaled(const mu::Size& size);
 };
 
 //---------------------------------------------------------
@@ -51,6 +51,21 @@ std::vector<InstrumentGenre*> instrumentGenres;
 std::vector<InstrumentFamily*> instrumentFamilies;
 std::vector<ScoreOrder> instrumentOrders;
 
+//! NOTE Every template (and <init> of a template) is looked up by id while the templates are loaded,
+//! so the lookup must not walk all the templates loaded so far
+static std::map<String, InstrumentTemplate*> instrumentTemplatesById;
+
+//---------------------------------------------------------
+//   registerTemplate
+//    the first template with an id is found by searchTemplate,
+//    as the references copy the already registered one
+//---------------------------------------------------------
+
+static void registerTemplate(InstrumentTemplate* t)
+{
+    instrumentTemplatesById.emplace(t->id, t);
+}
+
 //---------------------------------------------------------
 //   InstrumentIndex
 //---------------------------------------------------------
@@ -168,13 +183,17 @@ void InstrumentGroup::read(XmlReader& e)
                 t->midiArticulations.insert(t->midiArticulations.end(), midiArticulations.begin(), midiArticulations.end());
                 t->sequenceOrder = static_cast<int>(instrumentTemplates.size());
                 instrumentTemplates.push_back(t);
+                t->read(e);
+                registerTemplate(t);
+            } else {
+                t->read(e);
             }
-            t->read(e);
         } else if (tag == "ref") {
             InstrumentTemplate* ttt = searchTemplate(e.readText());
             if (ttt) {
                 InstrumentTemplate* t = new InstrumentTemplate(*ttt);
                 instrumentTemplates.push_back(t);
+                registerTemplate(t);
             } else {
                 LOGD("instrument reference not found <%s>", e.text().toUtf8().data());
             }
@@ -645,6 +664,7 @@ void clearInstrumentTemplates()
     }
     DeleteAll(instrumentGroups);
     instrumentGroups.clear();
+    instrumentTemplatesById.clear();
     DeleteAll(instrumentGenres);
     instrumentGenres.clear();
     DeleteAll(instrumentFamilies);
@@ -720,14 +740,7 @@ bool loadInstrumentTemplates(const io::path_t& instrTemplatesPath)
 
 InstrumentTemplate* searchTemplate(const String& name)
 {
-    for (InstrumentGroup* g : instrumentGroups) {
-        for (InstrumentTemplate* it : g->instrumentTemplates) {
-            if (it->id == name) {
-                return it;
-            }
-        }
-    }
-    return 0;
+    return mu::value(instrumentTemplatesById, name, nullptr);
 }
 
 //---------------------------------------------------------
@@ -176,6 +176,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/measure.h
     ${CMAKE_CURRENT_LIST_DIR}/measurebase.cpp
     ${CMAKE_CURRENT_LIST_DIR}/measurebase.h
+    ${CMAKE_CURRENT_LIST_DIR}/measurecolumns.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/measurecolumns.h
     ${CMAKE_CURRENT_LIST_DIR}/measurenumber.cpp
     ${CMAKE_CURRENT_LIST_DIR}/measurenumber.h
     ${CMAKE_CURRENT_LIST_DIR}/measurenumberbase.cpp
@@ -205,6 +207,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/notifier.h
     ${CMAKE_CURRENT_LIST_DIR}/ottava.cpp
     ${CMAKE_CURRENT_LIST_DIR}/ottava.h
+    ${CMAKE_CURRENT_LIST_DIR}/packedrtree.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/packedrtree.h
     ${CMAKE_CURRENT_LIST_DIR}/page.cpp
     ${CMAKE_CURRENT_LIST_DIR}/page.h
     ${CMAKE_CURRENT_LIST_DIR}/palmmute.cpp
@@ -247,6 +251,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/scorefile.cpp
     ${CMAKE_CURRENT_LIST_DIR}/scoreorder.cpp
     ${CMAKE_CURRENT_LIST_DIR}/scoreorder.h
+    ${CMAKE_CURRENT_LIST_DIR}/scorediff.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/scorediff.h
     ${CMAKE_CURRENT_LIST_DIR}/scoretree.cpp
     ${CMAKE_CURRENT_LIST_DIR}/segment.cpp
     ${CMAKE_CURRENT_LIST_DIR}/segment.h
@@ -283,6 +289,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/stafftext.h
     ${CMAKE_CURRENT_LIST_DIR}/stafftextbase.cpp
     ${CMAKE_CURRENT_LIST_DIR}/stafftextbase.h
+    ${CMAKE_CURRENT_LIST_DIR}/stafftimeline.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/stafftimeline.h
     ${CMAKE_CURRENT_LIST_DIR}/stafftype.cpp
     ${CMAKE_CURRENT_LIST_DIR}/stafftype.h
     ${CMAKE_CURRENT_LIST_DIR}/stafftypechange.cpp
@@ -37,14 +37,15 @@ using namespace mu;
 namespace mu::engraving {
 //---------------------------------------------------------
 //   searchNextLyrics
+//    the search stops at endTick, if the caller only cares about a range
 //---------------------------------------------------------
 
-static Lyrics* searchNextLyrics(Segment* s, staff_idx_t staffIdx, int verse, PlacementV p)
+static Lyrics* searchNextLyrics(Segment* s, staff_idx_t staffIdx, int verse, PlacementV p, const Fraction& endTick = Fraction::max())
 {
     Lyrics* l = 0;
-    while ((s = s->next1(SegmentType::ChordRest))) {
-        track_idx_t strack = staffIdx * VOICES;
-        track_idx_t etrack = strack + VOICES;
+    track_idx_t strack = staffIdx * VOICES;
+    track_idx_t etrack = strack + VOICES;
+    while ((s = s->next1(SegmentType::ChordRest)) && s->tick() < endTick) {
         // search through all tracks of current staff looking for a lyric in specified verse
         for (track_idx_t track = strack; track < etrack; ++track) {
             ChordRest* cr = toChordRest(s->element(track));
@@ -403,7 +404,13 @@ void LyricsLineSegment::layout()
         ryoffset() = lyr->offset().y();
     } else {
         // use Y position of *next* syllable if there is one on same system
-        Lyrics* nextLyr1 = searchNextLyrics(lyr->segment(), lyr->staffIdx(), lyr->no(), lyr->placement());
+        // dashes already know it, for melismas a search to the end of the system is enough
+        Lyrics* nextLyr1 = nullptr;
+        if (!isEndMelisma) {
+            nextLyr1 = lyricsLine()->nextLyrics();
+        } else if (system()) {
+            nextLyr1 = searchNextLyrics(lyr->segment(), lyr->staffIdx(), lyr->no(), lyr->placement(), system()->endTick());
+        }
         if (nextLyr1 && nextLyr1->segment()->system() == system()) {
             setPosY(nextLyr1->ipos().y());
             ryoffset() = nextLyr1->offset().y();
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_MASTERSCORE_H
 #define MU_ENGRAVING_MASTERSCORE_H
 
+#include <functional>
+
 #include "infrastructure/ifileinfoprovider.h"
 
 #include "instrument.h"
@@ -94,6 +96,13 @@ class MasterScore : public Score
 
     CmdState _cmdState;       // modified during cmd processing
 
+    struct BatchState {
+        int level = 0;                  // nesting of startBatch() calls
+        size_t cmdStart = 0;            // first undo command of the current command inside the batch
+        bool layoutAllParts = false;
+    };
+    BatchState _batchState;
+
     Fraction _pos[3];                      ///< 0 - current, 1 - left loop, 2 - right loop
 
     int _midiPortCount = 0;                           // A count of ALSA midi out ports
@@ -181,6 +190,9 @@ public:
     void addLayoutFlags(LayoutFlags val) override { _cmdState.layoutFlags |= val; }
     void setInstrumentsChanged(bool val) override { _cmdState._instrumentsChanged = val; }
 
+    BatchState& batchState() { return _batchState; }
+    const BatchState& batchState() const { return _batchState; }
+
     void setExcerptsChanged(bool val) { _cmdState._excerptsChanged = val; }
     bool excerptsChanged() const { return _cmdState._excerptsChanged; }
     bool instrumentsChanged() const { return _cmdState._instrumentsChanged; }
@@ -214,8 +226,8 @@ public:
     void removeExcerpt(Excerpt*);
     void deleteExcerpt(Excerpt*);
 
-    void initAndAddExcerpt(Excerpt*, bool);
-    void initExcerpt(Excerpt*);
+    void initAndAddExcerpt(Excerpt*, bool fakeUndo, bool layout = true);
+    void initExcerpt(Excerpt*, bool layout = true);
     void initEmptyExcerpt(Excerpt*);
 
     void setPlaybackScore(Score*);
@@ -225,6 +237,7 @@ public:
     const InstrChannel* playbackChannel(const InstrChannel* c) const { return _midiMapping[c->channel()].articulation(); }
 
     MasterScore* unrollRepeats();
+    void forEachUnrolledMeasure(const std::function<bool(const Measure* measure, int utick)>& func);
 
     IFileInfoProviderPtr fileInfo() const;
     void setFileInfoProvider(IFileInfoProviderPtr fileInfoProvider);
@@ -28,6 +28,7 @@
 #include "measure.h"
 
 #include <cmath>
+#include <functional>
 
 #include "realfn.h"
 
@@ -3698,6 +3699,7 @@ double Measure::createEndBarLines(bool isLastMeasureInSystem)
     Segment* s = seg->prevActive();
     if (s) {
         double x = s->xpos();
+        prepareDistanceCache(spacingContentKey(s));
         computeWidth(s, x, false, system()->minSysTicks(), system()->maxSysTicks(), layoutStretch());
     }
 
@@ -4194,10 +4196,10 @@ void Measure::computeWidth(Segment* s, double x, bool isSystemHeader, Fraction m
         if (ns) {
             if (isSystemHeader && (ns->isStartRepeatBarLineType() || ns->isChordRestType() || (ns->isClefType() && !ns->header()))) {
                 // this is the system header gap
-                w = s->minHorizontalDistance(ns, true);
+                w = minHorizontalDistance(s, ns, true);
                 isSystemHeader = false;
             } else {
-                w = s->minHorizontalDistance(ns, false);
+                w = minHorizontalDistance(s, ns, false);
                 if (s->isChordRestType()) {
                     Segment* ps = s->prevActive();
                     double durStretch = s->computeDurationStretch(ps, minTicks, maxTicks);
@@ -4213,7 +4215,7 @@ void Measure::computeWidth(Segment* s, double x, bool isSystemHeader, Fraction m
             // Clefs (or breaths) are justified right-to-left. It is the clef (or breath) that needs to move left
             //(if there's space), not the following segment that needs to move right.
             if ((ns->isClefType() || ns->isBreathType()) && ns->next()) {
-                double reduction = std::max(ns->minHorizontalCollidingDistance(ns->next()),
+                double reduction = std::max(minHorizontalCollidingDistance(ns, ns->next()),
                                             double(score()->styleMM(Sid::clefKeyRightMargin)));
                 w -= reduction;
                 s->setWidthOffset(s->widthOffset() - reduction);
@@ -4249,7 +4251,7 @@ void Measure::computeWidth(Segment* s, double x, bool isSystemHeader, Fraction m
                     break;
                 }
 
-                ww = ps->minHorizontalCollidingDistance(ns) - (s->x() - ps->x());
+                ww = minHorizontalCollidingDistance(ps, ns) - (s->x() - ps->x());
                 if (ps == fs) {
                     ww = std::max(ww, ns->minLeft(ls) - s->x());
                 }
@@ -4349,8 +4351,188 @@ void Measure::computeWidth(Fraction minTicks, Fraction maxTicks, double stretchC
     x = computeFirstSegmentXPosition(s);
     bool isSystemHeader = s->header();
 
+    const size_t contentKey = spacingContentKey(s);
+    const size_t cacheKey = spacingCacheKey(contentKey, x, minTicks, maxTicks, stretchCoeff);
+    if (restoreSpacingCache(s, cacheKey)) {
+        setLayoutStretch(stretchCoeff);
+        return;
+    }
+
     _squeezableSpace = 0;
+    prepareDistanceCache(contentKey);
     computeWidth(s, x, isSystemHeader, minTicks, maxTicks, stretchCoeff);
+    storeSpacingCache(s, cacheKey);
+}
+
+//---------------------------------------------------------
+//   spacingContentKey
+//    hash of the measure content the spacing depends on:
+//    the style and the segment shapes
+//---------------------------------------------------------
+
+template<typename T>
+static inline void hashCombine(size_t& seed, const T& v)
+{
+    seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t Measure::spacingContentKey(const Segment* s) const
+{
+    size_t key = 0;
+    hashCombine(key, s);
+    hashCombine(key, m_mmRestCount);
+    hashCombine(key, isFirstInSystem());
+    hashCombine(key, score()->style().revision());
+
+    for (const Segment* seg = s; seg; seg = seg->next()) {
+        hashCombine(key, seg);
+        hashCombine(key, static_cast<int>(seg->segmentType()));
+        hashCombine(key, seg->enabled());
+        hashCombine(key, seg->header());
+        hashCombine(key, seg->extraLeadingSpace().val());
+        hashCombine(key, seg->rtick().ticks());
+        hashCombine(key, seg->ticks().ticks());
+        for (const Shape& shape : seg->shapes()) {
+            hashCombine(key, shape.size());
+            for (const ShapeElement& e : shape) {
+                hashCombine(key, e.toItem);
+                hashCombine(key, e.x());
+                hashCombine(key, e.y());
+                hashCombine(key, e.width());
+                hashCombine(key, e.height());
+            }
+        }
+    }
+
+    return key;
+}
+
+//---------------------------------------------------------
+//   spacingCacheKey
+//    hash of everything computeWidth() depends on: the
+//    measure content and the spacing parameters
+//---------------------------------------------------------
+
+size_t Measure::spacingCacheKey(size_t contentKey, double x, Fraction minTicks, Fraction maxTicks, double stretchCoeff) const
+{
+    size_t key = contentKey;
+    hashCombine(key, x);
+    hashCombine(key, minTicks.numerator());
+    hashCombine(key, minTicks.denominator());
+    hashCombine(key, maxTicks.numerator());
+    hashCombine(key, maxTicks.denominator());
+    hashCombine(key, stretchCoeff);
+    hashCombine(key, m_userStretch);
+    if (system()) {
+        hashCombine(key, system()->width());
+        hashCombine(key, system()->leftMargin());
+    }
+
+    return key;
+}
+
+//---------------------------------------------------------
+//   restoreSpacingCache
+//    apply the result of a previous computeWidth() call
+//    made with the same key
+//---------------------------------------------------------
+
+bool Measure::restoreSpacingCache(Segment* s, size_t key)
+{
+    if (!m_spacingCache.valid || m_spacingCache.key != key) {
+        return false;
+    }
+
+    size_t idx = 0;
+    for (Segment* seg = s; seg; seg = seg->next()) {
+        if (idx >= m_spacingCache.segments.size()) {
+            return false;
+        }
+        const SpacingCache::SegmentSpacing& sp = m_spacingCache.segments[idx++];
+        seg->setPosX(sp.x);
+        seg->setWidth(sp.width);
+        seg->setWidthOffset(sp.widthOffset);
+        seg->setStretch(sp.stretch);
+        seg->setCrossBeamType(sp.crossBeamType);
+    }
+
+    _squeezableSpace = m_spacingCache.squeezableSpace;
+    setWidth(m_spacingCache.width);
+    setWidthLocked(m_spacingCache.widthLocked);
+    return true;
+}
+
+//---------------------------------------------------------
+//   storeSpacingCache
+//---------------------------------------------------------
+
+void Measure::storeSpacingCache(Segment* s, size_t key)
+{
+    m_spacingCache.segments.clear();
+    for (Segment* seg = s; seg; seg = seg->next()) {
+        m_spacingCache.segments.push_back({ seg->x(), seg->width(), seg->widthOffset(), seg->stretch(), seg->crossBeamType() });
+    }
+    m_spacingCache.key = key;
+    m_spacingCache.width = width();
+    m_spacingCache.squeezableSpace = _squeezableSpace;
+    m_spacingCache.widthLocked = _isWidthLocked;
+    m_spacingCache.valid = true;
+}
+
+//---------------------------------------------------------
+//   prepareDistanceCache
+//    keep the segment distances of the previous computeWidth()
+//    call if the measure content is the same
+//---------------------------------------------------------
+
+void Measure::prepareDistanceCache(size_t contentKey)
+{
+    if (m_distanceCache.valid && m_distanceCache.key == contentKey) {
+        return;
+    }
+    m_distanceCache.distances.clear();
+    m_distanceCache.key = contentKey;
+    m_distanceCache.valid = true;
+}
+
+size_t Measure::DistanceCache::KeyHash::operator()(const Key& k) const
+{
+    size_t h = 0;
+    hashCombine(h, k.segment);
+    hashCombine(h, k.next);
+    hashCombine(h, static_cast<int>(k.kind));
+    return h;
+}
+
+//---------------------------------------------------------
+//   minHorizontalDistance
+//   minHorizontalCollidingDistance
+//    the segment distances, memoized as long as the
+//    measure content does not change
+//---------------------------------------------------------
+
+double Measure::minHorizontalDistance(Segment* s, Segment* ns, bool systemHeaderGap)
+{
+    const DistanceCache::Key key { s, ns, systemHeaderGap ? DistanceCache::Kind::SystemHeaderGap : DistanceCache::Kind::Layout };
+    auto it = m_distanceCache.distances.find(key);
+    if (it != m_distanceCache.distances.end()) {
+        return it->second;
+    }
+    double d = s->minHorizontalDistance(ns, systemHeaderGap);
+    m_distanceCache.distances.emplace(key, d);
+    return d;
+}
+
+double Measure::minHorizontalCollidingDistance(Segment* s, Segment* ns)
+{
+    const DistanceCache::Key key { s, ns, DistanceCache::Kind::Colliding };
+    auto it = m_distanceCache.distances.find(key);
+    if (it != m_distanceCache.distances.end()) {
+        return it->second;
+    }
+    double d = s->minHorizontalCollidingDistance(ns);
+    m_distanceCache.distances.emplace(key, d);
+    return d;
 }
 
 double Measure::computeMinMeasureWidth() const
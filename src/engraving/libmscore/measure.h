@@ -28,6 +28,8 @@
  Definition of class Measure.
 */
 
+#include <unordered_map>
+
 #include "measurebase.h"
 
 #include "segmentlist.h"
@@ -314,6 +316,14 @@ public:
     Measure* mmRestFirst() const;
     Measure* mmRestLast() const;
 
+    //! NOTE An mm rest keeps what it copied from its underlying measures (barlines, clefs, key and time signatures,
+    //! annotations) until one of those is laid out for an edit or the key of the range changes
+    bool mmRestContentValid() const { return m_mmRestContentValid; }
+    void setMMRestContentValid(bool v) { m_mmRestContentValid = v; }
+    void invalidateMMRestContent() { m_mmRestContentValid = false; }
+    size_t mmRestContentKey() const { return m_mmRestContentKey; }
+    void setMMRestContentKey(size_t key) { m_mmRestContentKey = key; }
+
     int measureRepeatCount(staff_idx_t staffIdx) const;
     bool containsMeasureRepeat(const staff_idx_t staffIdxFrom, const staff_idx_t staffIdxTo) const;
     void setMeasureRepeatCount(int n, staff_idx_t staffIdx);
@@ -348,6 +358,11 @@ public:
     double basicStretch() const;
     double basicWidth() const;
     void computeWidth(Fraction minTicks, Fraction maxTicks, double stretchCoeff);
+    void invalidateSpacingCache()
+    {
+        m_spacingCache.valid = false;
+        m_distanceCache.valid = false;
+    }
     void stretchToTargetWidth(double targetWidth);
     void checkHeader();
     void checkTrailer();
@@ -375,6 +390,61 @@ public:
     void respaceSegments();
 
 private:
+    //---------------------------------------------------------
+    //   SpacingCache
+    //    result of the last computeWidth() call, valid as long as
+    //    the measure content, the spacing parameters and the style
+    //    produce the same key
+    //---------------------------------------------------------
+
+    struct SpacingCache {
+        struct SegmentSpacing {
+            double x = 0.0;
+            double width = 0.0;
+            double widthOffset = 0.0;
+            double stretch = 0.0;
+            CrossBeamType crossBeamType;
+        };
+
+        size_t key = 0;
+        bool valid = false;
+        double width = 0.0;
+        double squeezableSpace = 0.0;
+        bool widthLocked = false;
+        std::vector<SegmentSpacing> segments;
+    };
+
+    //---------------------------------------------------------
+    //   DistanceCache
+    //    minimum distances between segment pairs, they depend on
+    //    the measure content only, so they are kept when the
+    //    measure is respaced with other spacing parameters
+    //---------------------------------------------------------
+
+    struct DistanceCache {
+        enum class Kind : char {
+            Layout,
+            SystemHeaderGap,
+            Colliding
+        };
+
+        struct Key {
+            const Segment* segment = nullptr;
+            const Segment* next = nullptr;
+            Kind kind = Kind::Layout;
+
+            bool operator==(const Key& k) const { return segment == k.segment && next == k.next && kind == k.kind; }
+        };
+
+        struct KeyHash {
+            size_t operator()(const Key& k) const;
+        };
+
+        size_t key = 0;
+        bool valid = false;
+        std::unordered_map<Key, double, KeyHash> distances;
+    };
+
     double _squeezableSpace = 0;
     friend class Factory;
     friend class rw::MeasureRW;
@@ -388,6 +458,13 @@ private:
     void fillGap(const Fraction& pos, const Fraction& len, track_idx_t track, const Fraction& stretch, bool useGapRests = true);
     void computeWidth(Segment* s, double x, bool isSystemHeader, Fraction minTicks, Fraction maxTicks, double stretchCoeff);
     double computeMinMeasureWidth() const;
+    size_t spacingContentKey(const Segment* s) const;
+    size_t spacingCacheKey(size_t contentKey, double x, Fraction minTicks, Fraction maxTicks, double stretchCoeff) const;
+    bool restoreSpacingCache(Segment* s, size_t key);
+    void storeSpacingCache(Segment* s, size_t key);
+    void prepareDistanceCache(size_t contentKey);
+    double minHorizontalDistance(Segment* s, Segment* ns, bool systemHeaderGap);
+    double minHorizontalCollidingDistance(Segment* s, Segment* ns);
 
     MStaff* mstaff(staff_idx_t staffIndex) const;
 
@@ -415,6 +492,12 @@ private:
 
     double m_layoutStretch = 1.0;
     bool _isWidthLocked = false;
+
+    SpacingCache m_spacingCache;
+    DistanceCache m_distanceCache;
+
+    bool m_mmRestContentValid = false;      // underlying measure: unchanged since its mm rest was built
+    size_t m_mmRestContentKey = 0;          // mm rest: the range and style it was built for
 };
 } // namespace mu::engraving
 #endif
@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "measurecolumns.h"
+
+#include <algorithm>
+
+#include "measure.h"
+#include "segment.h"
+
+#include "log.h"
+
+using namespace mu;
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   build
+//---------------------------------------------------------
+
+void MeasureColumns::build(const Measure* measure, SegmentType types)
+{
+    clear();
+
+    if (!measure) {
+        return;
+    }
+
+    for (Segment* s = measure->first(types); s; s = s->next(types)) {
+        m_segments.push_back(s);
+        m_ticks.push_back(s->tick());
+        m_types.push_back(s->segmentType());
+        m_trackCount = std::max(m_trackCount, s->elist().size());
+    }
+
+    const size_t segments = m_segments.size();
+    const size_t staves = staffCount();
+
+    m_elements.assign(m_trackCount * segments, nullptr);
+    m_trackHasElements.assign(m_trackCount, false);
+    m_staffBounds.assign(staves * segments, RectF());
+
+    for (size_t segIdx = 0; segIdx < segments; ++segIdx) {
+        const Segment* s = m_segments[segIdx];
+
+        const std::vector<EngravingItem*>& elist = s->elist();
+        for (track_idx_t track = 0; track < elist.size(); ++track) {
+            if (EngravingItem* e = elist[track]) {
+                m_elements[track * segments + segIdx] = e;
+                m_trackHasElements[track] = true;
+            }
+        }
+
+        const std::vector<Shape>& shapes = s->shapes();
+        const size_t shapeCount = std::min(staves, shapes.size());
+        for (staff_idx_t staffIdx = 0; staffIdx < shapeCount; ++staffIdx) {
+            const Shape& shape = shapes[staffIdx];
+            if (shape.empty()) {
+                continue;
+            }
+            m_staffBounds[staffIdx * segments + segIdx]
+                = RectF(shape.left(), shape.top(), shape.right() - shape.left(), shape.bottom() - shape.top());
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void MeasureColumns::clear()
+{
+    m_trackCount = 0;
+    m_segments.clear();
+    m_ticks.clear();
+    m_types.clear();
+    m_elements.clear();
+    m_trackHasElements.clear();
+    m_staffBounds.clear();
+}
+
+//---------------------------------------------------------
+//   staffHasElements
+//---------------------------------------------------------
+
+bool MeasureColumns::staffHasElements(staff_idx_t staffIdx) const
+{
+    const track_idx_t strack = staffIdx * VOICES;
+    for (track_idx_t track = strack; track < strack + VOICES && track < m_trackCount; ++track) {
+        if (m_trackHasElements[track]) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace mu::engraving
@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_MEASURECOLUMNS_H
+#define MU_ENGRAVING_MEASURECOLUMNS_H
+
+#include <vector>
+
+#include "draw/types/geometry.h"
+
+#include "types/fraction.h"
+
+#include "mscore.h"
+#include "types.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class Measure;
+class Segment;
+
+//---------------------------------------------------------
+//   MeasureColumns
+//    Read-only snapshot of the segments of a measure in
+//    contiguous arrays: one entry per segment for tick and
+//    type, one column per track for the elements and one
+//    column per staff for the shape bounds.
+//
+//    Code that walks all segments of a measure track by track
+//    or staff by staff (layout, playback) can use it instead of
+//    hopping through the segment list and the per segment
+//    element vectors. The snapshot is not updated, rebuild
+//    it after segments or elements are added or removed.
+//---------------------------------------------------------
+
+class MeasureColumns
+{
+public:
+    MeasureColumns() = default;
+    explicit MeasureColumns(const Measure* measure, SegmentType types = SegmentType::All) { build(measure, types); }
+
+    void build(const Measure* measure, SegmentType types = SegmentType::All);
+    void clear();
+
+    size_t segmentCount() const { return m_segments.size(); }
+    size_t trackCount() const { return m_trackCount; }
+    size_t staffCount() const { return m_trackCount / VOICES; }
+
+    Segment* segment(size_t segIdx) const { return m_segments[segIdx]; }
+    const Fraction& tick(size_t segIdx) const { return m_ticks[segIdx]; }
+    SegmentType segmentType(size_t segIdx) const { return m_types[segIdx]; }
+
+    EngravingItem* element(size_t segIdx, track_idx_t track) const { return m_elements[track * segmentCount() + segIdx]; }
+    //! NOTE Elements of the track for all segments, segmentCount() entries
+    EngravingItem* const* trackColumn(track_idx_t track) const { return m_elements.data() + track * segmentCount(); }
+    bool trackHasElements(track_idx_t track) const { return m_trackHasElements[track]; }
+    bool staffHasElements(staff_idx_t staffIdx) const;
+
+    const RectF& staffBounds(size_t segIdx, staff_idx_t staffIdx) const { return m_staffBounds[staffIdx * segmentCount() + segIdx]; }
+
+private:
+    size_t m_trackCount = 0;
+
+    std::vector<Segment*> m_segments;
+    std::vector<Fraction> m_ticks;
+    std::vector<SegmentType> m_types;
+
+    std::vector<EngravingItem*> m_elements;     // track major, size = tracks * segments
+    std::vector<bool> m_trackHasElements;       // size = tracks
+    std::vector<RectF> m_staffBounds;           // staff major, size = staves * segments
+};
+} // namespace mu::engraving
+
+#endif // MU_ENGRAVING_MEASURECOLUMNS_H
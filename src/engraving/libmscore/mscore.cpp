@@ -43,6 +43,7 @@ bool MScore::testWriteStyleToScore = true;
 // #ifndef NDEBUG
 bool MScore::noHorizontalStretch = false;
 bool MScore::noVerticalStretch   = false;
+bool MScore::pageRTreeIndex      = true;
 bool MScore::useFallbackFont     = true;
 // #endif
 
@@ -256,6 +256,7 @@ public:
 // #ifndef NDEBUG
     static bool noHorizontalStretch;
     static bool noVerticalStretch;
+    static bool pageRTreeIndex;             // hit-test pages with a packed R-tree instead of the BSP tree
     static bool useFallbackFont;
 // #endif
     static bool debugMode;
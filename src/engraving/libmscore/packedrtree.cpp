@@ -0,0 +1,270 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "packedrtree.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "engravingitem.h"
+
+using namespace mu;
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   touches
+//    like RectF::intersects / contains, but edges count and
+//    empty rectangles are not ignored, so that items with a
+//    zero width or height are still found
+//---------------------------------------------------------
+
+static inline bool touches(const RectF& a, const RectF& b)
+{
+    return a.left() <= b.right() && b.left() <= a.right() && a.top() <= b.bottom() && b.top() <= a.bottom();
+}
+
+//---------------------------------------------------------
+//   covers
+//    a has an area and contains b
+//---------------------------------------------------------
+
+static inline bool covers(const RectF& a, const RectF& b)
+{
+    if (isEqual(a.left(), a.right()) || isEqual(a.top(), a.bottom())) {
+        return false;
+    }
+    return a.left() <= b.left() && b.right() <= a.right() && a.top() <= b.top() && b.bottom() <= a.bottom();
+}
+
+static inline bool touches(const RectF& r, const PointF& p)
+{
+    return r.left() <= p.x() && p.x() <= r.right() && r.top() <= p.y() && p.y() <= r.bottom();
+}
+
+//---------------------------------------------------------
+//   bounds
+//    RectF::united() skips empty rectangles, keep them
+//---------------------------------------------------------
+
+static inline RectF bounds(const RectF& a, const RectF& b)
+{
+    double left = std::min(a.left(), b.left());
+    double top = std::min(a.top(), b.top());
+    double right = std::max(a.right(), b.right());
+    double bottom = std::max(a.bottom(), b.bottom());
+    return RectF(left, top, right - left, bottom - top);
+}
+
+//---------------------------------------------------------
+//   sortTileRecursive
+//    order rectangles so that consecutive runs of
+//    NODE_CAPACITY are spatially close: sort by x, cut into
+//    vertical slices, sort each slice by y
+//---------------------------------------------------------
+
+template<typename T>
+void PackedRTree::sortTileRecursive(std::vector<T>& v)
+{
+    const size_t nodeCount = (v.size() + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    const size_t sliceCount = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nodeCount))));
+    const size_t sliceSize = sliceCount * NODE_CAPACITY;
+
+    std::sort(v.begin(), v.end(), [](const T& a, const T& b) {
+        return a.bbox.center().x() < b.bbox.center().x();
+    });
+
+    for (size_t i = 0; i < v.size(); i += sliceSize) {
+        auto end = v.begin() + std::min(v.size(), i + sliceSize);
+        std::sort(v.begin() + i, end, [](const T& a, const T& b) {
+            return a.bbox.center().y() < b.bbox.center().y();
+        });
+    }
+}
+
+//---------------------------------------------------------
+//   build
+//---------------------------------------------------------
+
+void PackedRTree::build(const std::vector<EngravingItem*>& items)
+{
+    clear();
+
+    m_entries.reserve(items.size());
+    for (EngravingItem* item : items) {
+        // scanElements may report an item more than once
+        if (item->itemDiscovered) {
+            continue;
+        }
+        item->itemDiscovered = true;
+        m_entries.push_back({ item->pageBoundingRect(), item });
+    }
+    for (const Entry& e : m_entries) {
+        e.item->itemDiscovered = false;
+    }
+
+    if (m_entries.empty()) {
+        return;
+    }
+
+    sortTileRecursive(m_entries);
+
+    std::vector<Node> level;
+    level.reserve((m_entries.size() + NODE_CAPACITY - 1) / NODE_CAPACITY);
+    for (size_t i = 0; i < m_entries.size(); i += NODE_CAPACITY) {
+        Node n;
+        n.first = i;
+        n.count = std::min(NODE_CAPACITY, m_entries.size() - i);
+        n.leaf = true;
+        n.bbox = m_entries[i].bbox;
+        for (size_t j = i + 1; j < i + n.count; ++j) {
+            n.bbox = bounds(n.bbox, m_entries[j].bbox);
+        }
+        level.push_back(n);
+    }
+
+    // each level is stored after the one below it, the root comes last
+    while (level.size() > 1) {
+        sortTileRecursive(level);
+
+        const size_t base = m_nodes.size();
+        m_nodes.insert(m_nodes.end(), level.begin(), level.end());
+
+        std::vector<Node> parents;
+        parents.reserve((level.size() + NODE_CAPACITY - 1) / NODE_CAPACITY);
+        for (size_t i = 0; i < level.size(); i += NODE_CAPACITY) {
+            Node n;
+            n.first = base + i;
+            n.count = std::min(NODE_CAPACITY, level.size() - i);
+            n.bbox = level[i].bbox;
+            for (size_t j = i + 1; j < i + n.count; ++j) {
+                n.bbox = bounds(n.bbox, level[j].bbox);
+            }
+            parents.push_back(n);
+        }
+        level = std::move(parents);
+    }
+
+    m_root = m_nodes.size();
+    m_nodes.push_back(level.front());
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void PackedRTree::clear()
+{
+    m_entries.clear();
+    m_nodes.clear();
+    m_root = 0;
+}
+
+//---------------------------------------------------------
+//   items
+//---------------------------------------------------------
+
+void PackedRTree::items(const RectF& rect, std::vector<EngravingItem*>& result) const
+{
+    if (!m_nodes.empty()) {
+        findItems(m_root, rect, result);
+    }
+}
+
+void PackedRTree::items(const PointF& pos, std::vector<EngravingItem*>& result) const
+{
+    if (!m_nodes.empty()) {
+        findItems(m_root, pos, result);
+    }
+}
+
+//---------------------------------------------------------
+//   findItems
+//---------------------------------------------------------
+
+void PackedRTree::findItems(size_t nodeIdx, const RectF& rect, std::vector<EngravingItem*>& result) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (!touches(node.bbox, rect)) {
+        return;
+    }
+
+    // a zoomed out view covers most of the page, don't test each item then
+    if (covers(rect, node.bbox)) {
+        collectItems(nodeIdx, result);
+        return;
+    }
+
+    if (node.leaf) {
+        for (size_t i = node.first; i < node.first + node.count; ++i) {
+            if (m_entries[i].bbox.intersects(rect)) {
+                result.push_back(m_entries[i].item);
+            }
+        }
+        return;
+    }
+
+    for (size_t i = node.first; i < node.first + node.count; ++i) {
+        findItems(i, rect, result);
+    }
+}
+
+void PackedRTree::collectItems(size_t nodeIdx, std::vector<EngravingItem*>& result) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (node.leaf) {
+        for (size_t i = node.first; i < node.first + node.count; ++i) {
+            // as RectF::intersects, items without an area are not found
+            const RectF& bbox = m_entries[i].bbox;
+            if (!isEqual(bbox.left(), bbox.right()) && !isEqual(bbox.top(), bbox.bottom())) {
+                result.push_back(m_entries[i].item);
+            }
+        }
+        return;
+    }
+
+    for (size_t i = node.first; i < node.first + node.count; ++i) {
+        collectItems(i, result);
+    }
+}
+
+void PackedRTree::findItems(size_t nodeIdx, const PointF& pos, std::vector<EngravingItem*>& result) const
+{
+    const Node& node = m_nodes[nodeIdx];
+    if (!touches(node.bbox, pos)) {
+        return;
+    }
+
+    if (node.leaf) {
+        for (size_t i = node.first; i < node.first + node.count; ++i) {
+            const Entry& e = m_entries[i];
+            if (touches(e.bbox, pos) && e.item->contains(pos)) {
+                result.push_back(e.item);
+            }
+        }
+        return;
+    }
+
+    for (size_t i = node.first; i < node.first + node.count; ++i) {
+        findItems(i, pos, result);
+    }
+}
+} // namespace mu::engraving
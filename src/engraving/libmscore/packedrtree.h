@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_PACKEDRTREE_H
+#define MU_ENGRAVING_PACKEDRTREE_H
+
+#include <vector>
+
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+class EngravingItem;
+
+//---------------------------------------------------------
+//   PackedRTree
+//    Static R-tree, bulk loaded with the sort-tile-recursive
+//    algorithm. Nodes and entries are stored in contiguous
+//    arrays and every item is stored exactly once.
+//    It must be rebuilt when the items move.
+//---------------------------------------------------------
+
+class PackedRTree
+{
+public:
+    PackedRTree() = default;
+
+    void build(const std::vector<EngravingItem*>& items);
+    void clear();
+
+    bool empty() const { return m_entries.empty(); }
+    size_t size() const { return m_entries.size(); }
+
+    //! NOTE Items are appended to result, it is not cleared
+    void items(const mu::RectF& rect, std::vector<EngravingItem*>& result) const;
+    void items(const mu::PointF& pos, std::vector<EngravingItem*>& result) const;
+
+private:
+    static constexpr size_t NODE_CAPACITY = 16;
+
+    struct Entry {
+        mu::RectF bbox;
+        EngravingItem* item = nullptr;
+    };
+
+    struct Node {
+        mu::RectF bbox;
+        size_t first = 0;           // first child node, or first entry for leaves
+        size_t count = 0;
+        bool leaf = false;
+    };
+
+    template<typename T>
+    static void sortTileRecursive(std::vector<T>& v);
+
+    void findItems(size_t nodeIdx, const mu::RectF& rect, std::vector<EngravingItem*>& result) const;
+    void findItems(size_t nodeIdx, const mu::PointF& pos, std::vector<EngravingItem*>& result) const;
+    void collectItems(size_t nodeIdx, std::vector<EngravingItem*>& result) const;
+
+    std::vector<Entry> m_entries;
+    std::vector<Node> m_nodes;
+    size_t m_root = 0;
+};
+} // namespace mu::engraving
+
+#endif // MU_ENGRAVING_PACKEDRTREE_H
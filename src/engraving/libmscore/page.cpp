@@ -59,19 +59,43 @@ Page::Page(RootItem* parent)
 //---------------------------------------------------------
 
 std::vector<EngravingItem*> Page::items(const RectF& rect)
+{
+    std::vector<EngravingItem*> result;
+    items(rect, result);
+    return result;
+}
+
+std::vector<EngravingItem*> Page::items(const mu::PointF& point)
+{
+    std::vector<EngravingItem*> result;
+    items(point, result);
+    return result;
+}
+
+void Page::items(const RectF& rect, std::vector<EngravingItem*>& result)
 {
     if (!bspTreeValid) {
         doRebuildBspTree();
     }
-    return bspTree.items(rect);
+
+    if (MScore::pageRTreeIndex) {
+        rTree.items(rect, result);
+    } else {
+        bspTree.items(rect, result);
+    }
 }
 
-std::vector<EngravingItem*> Page::items(const mu::PointF& point)
+void Page::items(const mu::PointF& point, std::vector<EngravingItem*>& result)
 {
     if (!bspTreeValid) {
         doRebuildBspTree();
     }
-    return bspTree.items(point);
+
+    if (MScore::pageRTreeIndex) {
+        rTree.items(point, result);
+    } else {
+        bspTree.items(point, result);
+    }
 }
 
 //---------------------------------------------------------
@@ -332,12 +356,30 @@ static void countElements(void* data, EngravingItem* /*e*/)
     ++(*(int*)data);
 }
 
+static void collectElements(void* data, EngravingItem* e)
+{
+    static_cast<std::vector<EngravingItem*>*>(data)->push_back(e);
+}
+
 //---------------------------------------------------------
 //   doRebuildBspTree
 //---------------------------------------------------------
 
 void Page::doRebuildBspTree()
 {
+    //! NOTE The page doesn't change between layouts, bulk load a packed R-tree
+    if (MScore::pageRTreeIndex) {
+        bspTree.clear();
+
+        std::vector<EngravingItem*> elements;
+        scanElements(&elements, collectElements, false);
+        rTree.build(elements);
+        bspTreeValid = true;
+        return;
+    }
+
+    rTree.clear();
+
     int n = 0;
     scanElements(&n, countElements, false);
 
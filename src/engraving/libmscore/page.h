@@ -27,6 +27,7 @@
 
 #include "engravingitem.h"
 #include "bsp.h"
+#include "packedrtree.h"
 
 namespace mu::engraving {
 class RootItem;
@@ -51,6 +52,7 @@ class Page final : public EngravingItem
     page_idx_t _no;                        // page number
 
     BspTree bspTree;
+    PackedRTree rTree;              // used instead of bspTree if MScore::pageRTreeIndex
     bool bspTreeValid;
 
     void doRebuildBspTree();
@@ -92,6 +94,8 @@ public:
 
     std::vector<EngravingItem*> items(const mu::RectF& r);
     std::vector<EngravingItem*> items(const mu::PointF& p);
+    void items(const mu::RectF& r, std::vector<EngravingItem*>& result);     // appends to result
+    void items(const mu::PointF& p, std::vector<EngravingItem*>& result);
     void invalidateBspTree() { bspTreeValid = false; }
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
@@ -26,6 +26,9 @@
 
 #include "pitchspelling.h"
 
+#include <memory>
+
+
 #include "translation.h"
 #include "types/typesconv.h"
 
@@ -35,6 +38,7 @@
 #include "part.h"
 #include "score.h"
 #include "staff.h"
+#include "stafftimeline.h"
 #include "utils.h"
 
 #include "log.h"
@@ -612,7 +616,33 @@ int tpc(int idx, int pitch, int opt)
 //   computeWindow
 //---------------------------------------------------------
 
-int computeWindow(const std::vector<Note*>& notes, int start, int end)
+//---------------------------------------------------------
+//   noteKeys
+//    the key of every note, the notes of a staff come in
+//    tick order, so the staff timeline is walked forward
+//---------------------------------------------------------
+
+static std::vector<int> noteKeys(const std::vector<Note*>& notes, int start, int end)
+{
+    std::vector<int> keys(notes.size(), 0);
+    const Staff* staff = nullptr;
+    std::unique_ptr<StaffTimeline> timeline;
+    std::unique_ptr<StaffTimeline::Cursor> cursor;
+
+    for (int i = start; i < end; ++i) {
+        const Note* note = notes[i];
+        if (note->staff() != staff) {
+            staff = note->staff();
+            timeline = std::make_unique<StaffTimeline>(staff);
+            cursor = std::make_unique<StaffTimeline::Cursor>(*timeline);
+        }
+        keys[i] = int(cursor->seek(note->chord()->tick().ticks()).keySigEvent.key());
+    }
+
+    return keys;
+}
+
+static int computeWindow(const std::vector<Note*>& notes, const std::vector<int>& keys, int start, int end)
 {
     int p   = 10000;
     int idx = -1;
@@ -623,11 +653,10 @@ int computeWindow(const std::vector<Note*>& notes, int start, int end)
     int k = 0;
     while (i < end) {
         pitch[k] = notes[i]->pitch() % 12;
-        Fraction tick = notes[i]->chord()->tick();
-        key[k]   = int(notes[i]->staff()->key(tick)) + 7;
+        key[k]   = keys[i] + 7;
         if (key[k] < 0 || key[k] > 14) {
             LOGD("illegal key at tick %d: %d, window %d-%d",
-                 tick.ticks(), key[k] - 7, start, end);
+                 notes[i]->chord()->tick().ticks(), key[k] - 7, start, end);
             return 0;
             // abort();
         }
@@ -683,6 +712,11 @@ int computeWindow(const std::vector<Note*>& notes, int start, int end)
     return idx;
 }
 
+int computeWindow(const std::vector<Note*>& notes, int start, int end)
+{
+    return computeWindow(notes, noteKeys(notes, start, end), start, end);
+}
+
 //---------------------------------------------------------
 //   changeAllTpcs
 //---------------------------------------------------------
@@ -704,12 +738,22 @@ void changeAllTpcs(Note* n, int tpc1)
 }
 
 //---------------------------------------------------------
-//   spell
+//   computeSpelling
+//    Returns the tpc1 chosen for every note, or Tpc::TPC_INVALID
+//    for notes the windowing leaves untouched. Only reads the
+//    notes and their staves' key lists, so spellings of different
+//    staves may be computed concurrently.
 //---------------------------------------------------------
 
-void Score::spellNotelist(std::vector<Note*>& notes)
+std::vector<int> computeSpelling(const std::vector<Note*>& notes)
 {
     int n = int(notes.size());
+    std::vector<int> tpcs(n, Tpc::TPC_INVALID);
+    const std::vector<int> keys = noteKeys(notes, 0, n);
+
+    auto spellNote = [&notes, &tpcs](int i, const int* tab, int opt, int k) {
+        tpcs[i] = tab[(notes[i]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)];
+    };
 
     int start = 0;
     while (start < n) {
@@ -717,7 +761,7 @@ void Score::spellNotelist(std::vector<Note*>& notes)
         if (end > n) {
             end = n;
         }
-        int opt = computeWindow(notes, start, end);
+        int opt = computeWindow(notes, keys, start, end);
         const int* tab;
         if (opt < 0) {
             tab = tab2;
@@ -727,40 +771,61 @@ void Score::spellNotelist(std::vector<Note*>& notes)
         }
 
         if (start == 0) {
-            changeAllTpcs(notes[0], tab[(notes[0]->pitch() % 12) * 2 + (opt & 1)]);
+            spellNote(0, tab, opt, 0);
             if (n > 1) {
-                changeAllTpcs(notes[1], tab[(notes[1]->pitch() % 12) * 2 + ((opt & 2) >> 1)]);
+                spellNote(1, tab, opt, 1);
             }
             if (n > 2) {
-                changeAllTpcs(notes[2], tab[(notes[2]->pitch() % 12) * 2 + ((opt & 4) >> 2)]);
+                spellNote(2, tab, opt, 2);
             }
         }
         if ((end - start) >= 6) {
-            changeAllTpcs(notes[start + 3], tab[(notes[start + 3]->pitch() % 12) * 2 + ((opt & 8) >> 3)]);
-            changeAllTpcs(notes[start + 4], tab[(notes[start + 4]->pitch() % 12) * 2 + ((opt & 16) >> 4)]);
-            changeAllTpcs(notes[start + 5], tab[(notes[start + 5]->pitch() % 12) * 2 + ((opt & 32) >> 5)]);
+            spellNote(start + 3, tab, opt, 3);
+            spellNote(start + 4, tab, opt, 4);
+            spellNote(start + 5, tab, opt, 5);
         }
         if (end == n) {
             int n1 = end - start;
-            int k;
             switch (n1 - 6) {
             case 3:
-                k = end - start - 3;
-                changeAllTpcs(notes[end - 3], tab[(notes[end - 3]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
+                spellNote(end - 3, tab, opt, n1 - 3);
             // FALLTHROUGH
             case 2:
-                k = end - start - 2;
-                changeAllTpcs(notes[end - 2], tab[(notes[end - 2]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
+                spellNote(end - 2, tab, opt, n1 - 2);
             // FALLTHROUGH
             case 1:
-                k = end - start - 1;
-                changeAllTpcs(notes[end - 1], tab[(notes[end - 1]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
+                spellNote(end - 1, tab, opt, n1 - 1);
             }
             break;
         }
         // advance to next window
         start += 3;
     }
+    return tpcs;
+}
+
+//---------------------------------------------------------
+//   spellNotelist
+//---------------------------------------------------------
+
+void Score::spellNotelist(std::vector<Note*>& notes)
+{
+    applySpelling(notes, computeSpelling(notes));
+}
+
+//---------------------------------------------------------
+//   applySpelling
+//    tpcs as returned by computeSpelling(notes)
+//---------------------------------------------------------
+
+void Score::applySpelling(const std::vector<Note*>& notes, const std::vector<int>& tpcs)
+{
+    assert(notes.size() == tpcs.size());
+    for (size_t i = 0; i < notes.size(); ++i) {
+        if (tpcs[i] != Tpc::TPC_INVALID) {
+            changeAllTpcs(notes[i], tpcs[i]);
+        }
+    }
 }
 
 //---------------------------------------------------------
@@ -75,6 +75,7 @@ enum class NoteCaseType : signed char {
 extern int pitch2tpc(int pitch, Key, Prefer prefer);
 
 extern int computeWindow(const std::vector<Note*>& notes, int start, int end);
+extern std::vector<int> computeSpelling(const std::vector<Note*>& notes);
 extern int tpc(int idx, int pitch, int opt);
 extern String tpc2name(int tpc, NoteSpellingType spelling, NoteCaseType noteCase, bool explicitAccidental = false, bool full = false);
 extern void tpc2name(int tpc, NoteSpellingType noteSpelling, NoteCaseType noteCase, String& s, String& acc, bool explicitAccidental = false,
@@ -155,15 +155,93 @@ void RepeatList::update(bool expand)
         return;
     }
 
+    // Most of the edits don't touch the measures, repeats, jumps, markers or voltas, so the unwound
+    // segments stay the same and only the timing of them has to be recalculated
+    std::vector<uint64_t> key = structureKey();
+
+    if (expand == _expanded && !empty() && key == _structureKey) {
+        updateTempo();
+        _scoreChanged = false;
+        return;
+    }
+
     if (expand) {
         unwind();
     } else {
         flatten();
     }
 
+    _structureKey = std::move(key);
     _scoreChanged = false;
 }
 
+//---------------------------------------------------------
+//   structureKey
+///   Collects everything that is taken into account by
+///   collectRepeatListElements, unwind and flatten
+//---------------------------------------------------------
+
+std::vector<uint64_t> RepeatList::structureKey() const
+{
+    std::vector<uint64_t> key;
+
+    auto addPointer = [&key](const void* ptr) {
+        key.push_back(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr)));
+    };
+
+    for (const MeasureBase* mb = _score->first(); mb; mb = mb->next()) {
+        addPointer(mb);
+
+        const LayoutBreak* sectionBreak = mb->sectionBreakElement();
+        key.push_back(sectionBreak ? static_cast<uint64_t>(sectionBreak->pause() * 1000) + 1 : 0);
+
+        if (!mb->isMeasure()) {
+            continue;
+        }
+
+        const Measure* measure = toMeasure(mb);
+        key.push_back(static_cast<uint64_t>(measure->tick().ticks()));
+        key.push_back(static_cast<uint64_t>(measure->endTick().ticks()));
+        key.push_back((measure->repeatStart() ? 1 : 0) | (measure->repeatEnd() ? 2 : 0));
+        key.push_back(static_cast<uint64_t>(measure->repeatCount()));
+
+        for (const EngravingItem* e : measure->el()) {
+            if (e->isJump()) {
+                const Jump* jump = toJump(e);
+                addPointer(jump);
+                key.push_back(jump->jumpTo().hash());
+                key.push_back(jump->playUntil().hash());
+                key.push_back(jump->continueAt().hash());
+                key.push_back(jump->playRepeats() ? 1 : 0);
+            } else if (e->isMarker()) {
+                const Marker* marker = toMarker(e);
+                addPointer(marker);
+                key.push_back(marker->label().hash());
+                key.push_back(static_cast<uint64_t>(marker->align().horizontal));
+            }
+        }
+    }
+
+    for (const auto& spannerEntry : _score->spanner()) {
+        if (!spannerEntry.second->isVolta()) {
+            continue;
+        }
+
+        const Volta* volta = toVolta(spannerEntry.second);
+        addPointer(volta);
+        addPointer(volta->startMeasure());
+        addPointer(volta->endMeasure());
+        key.push_back(static_cast<uint64_t>(volta->getProperty(Pid::END_HOOK_TYPE).value<HookType>()));
+
+        for (int ending : volta->endings()) {
+            key.push_back(static_cast<uint64_t>(ending));
+        }
+        key.push_back(static_cast<uint64_t>(-1));
+    }
+
+    return key;
+}
+
 //---------------------------------------------------------
 //   updateTempo
 //---------------------------------------------------------
@@ -188,6 +266,54 @@ void RepeatList::updateTempo()
     }
 }
 
+//---------------------------------------------------------
+//   segmentIdxFromUTick
+///   The segments are sorted by utick, so the last looked up
+///   segment is checked first and a binary search is done otherwise
+//---------------------------------------------------------
+
+size_t RepeatList::segmentIdxFromUTick(int utick) const
+{
+    size_t n = size();
+    unsigned cached = idx1.load(std::memory_order_relaxed);
+
+    if (cached < n && utick >= at(cached)->utick && (cached + 1 == n || utick < at(cached + 1)->utick)) {
+        return cached;
+    }
+
+    auto it = std::upper_bound(cbegin(), cend(), utick, [](int tick, const RepeatSegment* rs) {
+        return tick < rs->utick;
+    });
+
+    size_t idx = it == cbegin() ? 0 : static_cast<size_t>(std::distance(cbegin(), it)) - 1;
+    idx1.store(static_cast<unsigned>(idx), std::memory_order_relaxed);
+
+    return idx;
+}
+
+//---------------------------------------------------------
+//   segmentIdxFromUTime
+//---------------------------------------------------------
+
+size_t RepeatList::segmentIdxFromUTime(double secs) const
+{
+    size_t n = size();
+    unsigned cached = idx2.load(std::memory_order_relaxed);
+
+    if (cached < n && secs >= at(cached)->utime && (cached + 1 == n || secs < at(cached + 1)->utime)) {
+        return cached;
+    }
+
+    auto it = std::upper_bound(cbegin(), cend(), secs, [](double time, const RepeatSegment* rs) {
+        return time < rs->utime;
+    });
+
+    size_t idx = it == cbegin() ? 0 : static_cast<size_t>(std::distance(cbegin(), it)) - 1;
+    idx2.store(static_cast<unsigned>(idx), std::memory_order_relaxed);
+
+    return idx;
+}
+
 //---------------------------------------------------------
 //   utick2tick
 //---------------------------------------------------------
@@ -201,16 +327,9 @@ int RepeatList::utick2tick(int tick) const
     if (tick < 0) {
         return 0;
     }
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            idx1 = i;
-            return tick - (at(i)->utick - at(i)->tick);
-        }
-    }
 
-    ASSERT_X(String(u"tick %1 not found in RepeatList").arg(tick));
-    return 0;
+    const RepeatSegment* rs = at(segmentIdxFromUTick(tick));
+    return tick - (rs->utick - rs->tick);
 }
 
 //---------------------------------------------------------
@@ -236,16 +355,13 @@ int RepeatList::tick2utick(int tick) const
 
 double RepeatList::utick2utime(int tick) const
 {
-    size_t n = size();
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            int t     = tick - (at(i)->utick - at(i)->tick);
-            double tt = _score->tempomap()->tick2time(t) + at(i)->timeOffset;
-            return tt;
-        }
+    if (empty() || tick < front()->utick) {
+        return 0.0;
     }
-    return 0.0;
+
+    const RepeatSegment* rs = at(segmentIdxFromUTick(tick));
+    int t = tick - (rs->utick - rs->tick);
+    return _score->tempomap()->tick2time(t) + rs->timeOffset;
 }
 
 //---------------------------------------------------------
@@ -254,17 +370,13 @@ double RepeatList::utick2utime(int tick) const
 
 int RepeatList::utime2utick(double secs) const
 {
-    size_t repeatSegmentsCount = size();
-    unsigned ii = (idx2 < repeatSegmentsCount) && (secs >= at(idx2)->utime) ? idx2 : 0;
-    for (unsigned i = ii; i < repeatSegmentsCount; ++i) {
-        if ((secs >= at(i)->utime) && ((i + 1 == repeatSegmentsCount) || (secs < at(i + 1)->utime))) {
-            idx2 = i;
-            return _score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
-        }
+    if (empty() || secs < front()->utime) {
+        ASSERT_X(String(u"time %1 not found in RepeatList").arg(secs));
+        return 0;
     }
 
-    ASSERT_X(String(u"time %1 not found in RepeatList").arg(secs));
-    return 0;
+    const RepeatSegment* rs = at(segmentIdxFromUTime(secs));
+    return _score->tempomap()->time2tick(secs - rs->timeOffset) + (rs->utick - rs->tick);
 }
 
 ///
@@ -23,6 +23,7 @@
 #ifndef __REPEATLIST_H__
 #define __REPEATLIST_H__
 
+#include <atomic>
 #include <set>
 #include <vector>
 
@@ -80,10 +81,11 @@ class RepeatList : public std::vector<RepeatSegment*>
     OBJECT_ALLOCATOR(engraving, RepeatList)
 
     Score* _score = nullptr;
-    mutable unsigned idx1, idx2;     // cached values
+    mutable std::atomic<unsigned> idx1, idx2;     // cached values, read by the playback rendering threads
 
     bool _expanded = false;
     bool _scoreChanged = true;
+    std::vector<uint64_t> _structureKey;   // everything the unwinding depends on, to skip it when nothing of that has changed
 
     std::set<std::pair<Jump const* const, int> > _jumpsTaken;     // take the jumps only once, so track them during unwind
     std::vector<RepeatListElementList> _rlElements;   // all elements of the score that influence the RepeatList
@@ -99,6 +101,10 @@ class RepeatList : public std::vector<RepeatSegment*>
     void unwind();
     void flatten();
 
+    std::vector<uint64_t> structureKey() const;
+    size_t segmentIdxFromUTick(int utick) const;
+    size_t segmentIdxFromUTime(double secs) const;
+
 public:
     RepeatList(Score* s);
     RepeatList(const RepeatList&) = delete;
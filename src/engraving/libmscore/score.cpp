@@ -27,10 +27,13 @@
 
 #include "score.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
+#include <unordered_set>
 
 #include "containers.h"
+#include "concurrency/taskscheduler.h"
 
 #include "style/style.h"
 #include "style/defaultstyle.h"
@@ -155,6 +158,11 @@ MeasureBaseList::MeasureBaseList()
 
 void MeasureBaseList::push_back(MeasureBase* e)
 {
+    // importers append the measures one by one and look them up by tick in between,
+    // so an appended measure extends the index instead of invalidating it
+    if (m_measureIndexValid && e->isMeasure()) {
+        m_measureIndex.push_back(toMeasure(e));
+    }
     ++_size;
     if (_last) {
         _last->setNext(e);
@@ -174,6 +182,7 @@ void MeasureBaseList::push_back(MeasureBase* e)
 
 void MeasureBaseList::push_front(MeasureBase* e)
 {
+    invalidateIndex();
     ++_size;
     if (_first) {
         _first->setPrev(e);
@@ -207,6 +216,7 @@ void MeasureBaseList::add(MeasureBase* e)
     e->setPrev(el->prev());
     el->prev()->setNext(e);
     el->setPrev(e);
+    invalidateIndex();
 }
 
 //---------------------------------------------------------
@@ -215,6 +225,7 @@ void MeasureBaseList::add(MeasureBase* e)
 
 void MeasureBaseList::remove(MeasureBase* el)
 {
+    invalidateIndex();
     --_size;
     if (el->prev()) {
         el->prev()->setNext(el->next());
@@ -234,6 +245,7 @@ void MeasureBaseList::remove(MeasureBase* el)
 
 void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 {
+    invalidateIndex();
     ++_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         ++_size;
@@ -258,6 +270,7 @@ void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 {
+    invalidateIndex();
     --_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         --_size;
@@ -282,6 +295,7 @@ void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::change(MeasureBase* ob, MeasureBase* nb)
 {
+    invalidateIndex();
     nb->setPrev(ob->prev());
     nb->setNext(ob->next());
     if (ob->prev()) {
@@ -305,6 +319,35 @@ void MeasureBaseList::change(MeasureBase* ob, MeasureBase* nb)
     }
 }
 
+//---------------------------------------------------------
+//   measureAt
+//    return the last measure starting at or before tick,
+//    nullptr if there is none
+//---------------------------------------------------------
+
+Measure* MeasureBaseList::measureAt(const Fraction& tick) const
+{
+    if (!m_measureIndexValid) {
+        m_measureIndex.clear();
+        for (MeasureBase* mb = _first; mb; mb = mb->next()) {
+            if (mb->isMeasure()) {
+                m_measureIndex.push_back(toMeasure(mb));
+            }
+        }
+        m_measureIndexValid = true;
+    }
+
+    auto it = std::upper_bound(m_measureIndex.begin(), m_measureIndex.end(), tick, [](const Fraction& t, const Measure* m) {
+        return t < m->tick();
+    });
+
+    if (it == m_measureIndex.begin()) {
+        return nullptr;
+    }
+
+    return *(--it);
+}
+
 //---------------------------------------------------------
 //   Score
 //---------------------------------------------------------
@@ -936,40 +979,81 @@ void Score::setIsOpen(bool open)
 
 void Score::spell()
 {
-    for (staff_idx_t i = 0; i < nstaves(); ++i) {
-        std::vector<Note*> notes;
-        for (Segment* s = firstSegment(SegmentType::All); s; s = s->next1()) {
-            track_idx_t strack = i * VOICES;
-            track_idx_t etrack = strack + VOICES;
-            for (track_idx_t track = strack; track < etrack; ++track) {
-                EngravingItem* e = s->element(track);
-                if (e && e->type() == ElementType::CHORD) {
-                    std::copy_if(toChord(e)->notes().begin(), toChord(e)->notes().end(),
-                                 std::back_inserter(notes), [this](EngravingItem* ce) { return selection().isNone() || ce->selected(); });
-                }
+    std::vector<std::vector<Note*> > staffNotes(nstaves());
+    for (Segment* s = firstSegment(SegmentType::All); s; s = s->next1()) {
+        for (track_idx_t track = 0; track < ntracks(); ++track) {
+            EngravingItem* e = s->element(track);
+            if (e && e->type() == ElementType::CHORD) {
+                std::copy_if(toChord(e)->notes().begin(), toChord(e)->notes().end(),
+                             std::back_inserter(staffNotes[track2staff(track)]),
+                             [this](EngravingItem* ce) { return selection().isNone() || ce->selected(); });
             }
         }
-        spellNotelist(notes);
     }
+    spellStaves(staffNotes);
 }
 
 void Score::spell(staff_idx_t startStaff, staff_idx_t endStaff, Segment* startSegment, Segment* endSegment)
 {
-    for (staff_idx_t i = startStaff; i < endStaff; ++i) {
-        std::vector<Note*> notes;
-        for (Segment* s = startSegment; s && s != endSegment; s = s->next()) {
-            track_idx_t strack = i * VOICES;
-            track_idx_t etrack = strack + VOICES;
-            for (track_idx_t track = strack; track < etrack; ++track) {
-                EngravingItem* e = s->element(track);
-                if (e && e->type() == ElementType::CHORD) {
-                    notes.insert(notes.end(),
-                                 toChord(e)->notes().begin(),
-                                 toChord(e)->notes().end());
-                }
+    if (startStaff >= endStaff) {
+        return;
+    }
+    std::vector<std::vector<Note*> > staffNotes(endStaff - startStaff);
+    track_idx_t strack = startStaff * VOICES;
+    track_idx_t etrack = endStaff * VOICES;
+    for (Segment* s = startSegment; s && s != endSegment; s = s->next()) {
+        for (track_idx_t track = strack; track < etrack; ++track) {
+            EngravingItem* e = s->element(track);
+            if (e && e->type() == ElementType::CHORD) {
+                std::vector<Note*>& notes = staffNotes[track2staff(track) - startStaff];
+                notes.insert(notes.end(),
+                             toChord(e)->notes().begin(),
+                             toChord(e)->notes().end());
             }
         }
-        spellNotelist(notes);
+    }
+    spellStaves(staffNotes);
+}
+
+//---------------------------------------------------------
+//   spellStaves
+//    Note lists are spelled independently per staff. The
+//    spelling itself is read-only and is computed on the task
+//    scheduler for large selections; the tpc changes go through
+//    the undo stack and are always applied here, in staff order,
+//    so the result does not depend on thread scheduling.
+//---------------------------------------------------------
+
+void Score::spellStaves(const std::vector<std::vector<Note*> >& staffNotes)
+{
+    static constexpr size_t PARALLEL_SPELL_MIN_NOTES = 1024;
+
+    size_t totalNotes = 0;
+    size_t nonEmptyStaves = 0;
+    for (const std::vector<Note*>& notes : staffNotes) {
+        totalNotes += notes.size();
+        nonEmptyStaves += notes.empty() ? 0 : 1;
+    }
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    bool parallel = nonEmptyStaves > 1 && totalNotes >= PARALLEL_SPELL_MIN_NOTES
+                    && scheduler->threadPoolSize() > 1
+                    && !scheduler->containsThread(std::this_thread::get_id());
+
+    if (!parallel) {
+        for (const std::vector<Note*>& notes : staffNotes) {
+            applySpelling(notes, computeSpelling(notes));
+        }
+        return;
+    }
+
+    std::vector<std::future<std::vector<int> > > spellings;
+    spellings.reserve(staffNotes.size());
+    for (const std::vector<Note*>& notes : staffNotes) {
+        spellings.push_back(scheduler->submit([&notes]() { return computeSpelling(notes); }));
+    }
+    for (size_t i = 0; i < staffNotes.size(); ++i) {
+        applySpelling(staffNotes[i], spellings[i].get());
     }
 }
 
@@ -3450,8 +3534,19 @@ void Score::select(EngravingItem* item, SelectType type, staff_idx_t staffIdx)
 
 void Score::select(const std::vector<EngravingItem*>& items, SelectType type, staff_idx_t staffIdx)
 {
-    for (EngravingItem* item : items) {
-        doSelect(item, type, staffIdx);
+    //! NOTE Adding the elements one by one is quadratic: each one is searched in the selection,
+    //! and the whole selection is updated after each one (e.g. "select all similar")
+    bool addAtOnce = type == SelectType::ADD && !_selection.isRange()
+                     && std::none_of(items.cbegin(), items.cend(), [](const EngravingItem* item) {
+        return !item || item->isMeasure();
+    });
+
+    if (addAtOnce) {
+        selectAdd(items);
+    } else {
+        for (EngravingItem* item : items) {
+            doSelect(item, type, staffIdx);
+        }
     }
 
     if (!_selection.elements().empty()) {
@@ -3571,6 +3666,42 @@ void Score::selectAdd(EngravingItem* e)
     _selection.setState(selState);
 }
 
+//---------------------------------------------------------
+//   selectAdd
+//    adds the elements (no measures) to a list selection,
+//    as selectAdd of each of them would do
+//---------------------------------------------------------
+
+void Score::selectAdd(const std::vector<EngravingItem*>& items)
+{
+    if (items.empty()) {
+        return;
+    }
+
+    // as after selecting the last one
+    const Fraction playTick = items.back()->playTick();
+    if (masterScore()->playPos() != playTick) {
+        masterScore()->setPlayPos(playTick);
+    }
+
+    std::unordered_set<EngravingItem*> selected(_selection.elements().cbegin(), _selection.elements().cend());
+    std::vector<EngravingItem*> added;
+
+    for (EngravingItem* e : items) {
+        if (selected.insert(e).second) {
+            addRefresh(e->abbox());
+            added.push_back(e);
+        }
+    }
+
+    if (!added.empty()) {
+        _selection.add(added);
+        _selection.setState(SelState::LIST);
+    }
+
+    setSelectionChanged(true);
+}
+
 //---------------------------------------------------------
 //   selectRange
 //    staffIdx is valid, if element is of type MEASURE
@@ -4387,8 +4518,9 @@ int Score::linkId()
 void Score::linkId(int val)
 {
     Score* s = masterScore();
-    if (val >= s->_linkId) {
-        s->_linkId = val + 1;       // update unused link id
+    int unused = s->_linkId;
+    // update unused link id, the part scores may be laid out concurrently
+    while (val >= unused && !s->_linkId.compare_exchange_weak(unused, val + 1)) {
     }
 }
 
@@ -5728,6 +5860,101 @@ void Score::doLayout()
     doLayoutRange(Fraction(0, 1), Fraction(-1, 1));
 }
 
+//---------------------------------------------------------
+//   doLayoutScores
+//    Lays out the given scores completely, e.g. all parts
+//    of a master score before exporting them.
+//    Every score has its own layout state, so the layouts
+//    run concurrently. The state they share (link lists,
+//    link ids, the command state lock) is thread-safe, the
+//    fonts are loaded here beforehand. Within a command,
+//    the shared undo stack records the changes, so then
+//    the scores are laid out one after another.
+//---------------------------------------------------------
+
+void Score::doLayoutScores(const std::vector<Score*>& scores)
+{
+    TRACEFUNC;
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    bool parallel = scores.size() > 1
+                    && scheduler->threadPoolSize() > 1
+                    && !scheduler->containsThread(std::this_thread::get_id());
+
+    for (const Score* score : scores) {
+        if (score->undoStack()->active()) {
+            parallel = false;
+        }
+    }
+
+    if (!parallel) {
+        for (Score* score : scores) {
+            score->doLayout();
+        }
+        return;
+    }
+
+    for (const Score* score : scores) {
+        score->engravingFonts()->fontByName(score->style().value(Sid::MusicalSymbolFont).value<String>().toStdString());
+        score->engravingFonts()->fallbackFont();
+    }
+
+    scheduler->parallelFor(size_t(0), scores.size(), [&scores](size_t idx) {
+        scores[idx]->doLayout();
+    });
+}
+
+//---------------------------------------------------------
+//   SystemBand
+//    the canvas area a system paints into: the page width,
+//    up to the middle of the gaps to the neighbour systems
+//---------------------------------------------------------
+
+struct SystemBand {
+    RectF rect;
+    Fraction tick;
+    Fraction endTick;
+
+    bool operator==(const SystemBand& b) const { return rect == b.rect && tick == b.tick && endTick == b.endTick; }
+};
+
+static std::vector<SystemBand> systemBands(const Score* score)
+{
+    std::vector<SystemBand> bands;
+
+    for (const Page* page : score->pages()) {
+        const std::vector<System*>& systems = page->systems();
+
+        for (size_t i = 0; i < systems.size(); ++i) {
+            const System* system = systems.at(i);
+            if (system->measures().empty()) {
+                continue;
+            }
+
+            RectF r = system->pageBoundingRect();
+            double top = i > 0 ? (systems.at(i - 1)->pageBoundingRect().bottom() + r.top()) * 0.5 : 0.0;
+            double bottom = i + 1 < systems.size() ? (r.bottom() + systems.at(i + 1)->pageBoundingRect().top()) * 0.5 : page->height();
+
+            SystemBand band;
+            band.rect = RectF(0.0, top, page->width(), bottom - top).translated(page->pos());
+            band.tick = system->measures().front()->tick();
+            band.endTick = system->measures().back()->endTick();
+            bands.push_back(band);
+        }
+    }
+
+    return bands;
+}
+
+static bool containsBand(const std::vector<SystemBand>& bands, const SystemBand& band)
+{
+    auto it = std::lower_bound(bands.begin(), bands.end(), band, [](const SystemBand& b1, const SystemBand& b2) {
+        return b1.tick < b2.tick;
+    });
+
+    return it != bands.end() && *it == band;
+}
+
 void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 {
     TRACEFUNC;
@@ -5735,8 +5962,42 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     m_engravingFont = engravingFonts()->fontByName(style().value(Sid::MusicalSymbolFont).value<String>().toStdString());
     _noteHeadWidth = m_engravingFont->width(SymId::noteheadBlack, spatium() / SPATIUM20);
 
+    //! NOTE The damage is tracked per system: a system is repainted if it was in the layout range,
+    //! or if it moved or changed its measures. A complete layout or a new page count damages everything
+    bool layoutAll = !last() || (st <= Fraction(0, 1) && (et < Fraction(0, 1) || et >= last()->endTick()));
+    bool trackDamage = m_damageState != DamageState::All && !layoutAll && !linearMode();
+    std::vector<SystemBand> bandsBefore;
+    size_t pageCountBefore = pages().size();
+    if (trackDamage) {
+        bandsBefore = systemBands(this);
+    }
+
     m_layoutOptions.updateFromStyle(style());
     m_layout.doLayoutRange(m_layoutOptions, st, et);
+    // the page limit applies to a single layout pass only
+    m_layoutOptions.pageLimit = 0;
+
+    if (!trackDamage || pages().size() != pageCountBefore) {
+        setDamageAll();
+    } else {
+        std::vector<SystemBand> bandsAfter = systemBands(this);
+        // the layout range borders are inclusive, the elements at them may change as well
+        auto inRange = [&st, &et](const SystemBand& band) {
+            return band.endTick >= st && (et < Fraction(0, 1) || band.tick <= et);
+        };
+
+        for (const SystemBand& band : bandsAfter) {
+            if (inRange(band) || !containsBand(bandsBefore, band)) {
+                addDamage(band.rect);
+            }
+        }
+
+        for (const SystemBand& band : bandsBefore) {
+            if (!containsBand(bandsAfter, band)) {
+                addDamage(band.rect);
+            }
+        }
+    }
 
     if (_resetAutoplace) {
         _resetAutoplace = false;
@@ -5749,6 +6010,63 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     }
 }
 
+//---------------------------------------------------------
+//   addDamage
+//---------------------------------------------------------
+
+void Score::addDamage(const mu::RectF& rect)
+{
+    if (m_damageState == DamageState::All || rect.isEmpty()) {
+        return;
+    }
+
+    m_damage.push_back(rect);
+    m_damageState = DamageState::Rects;
+}
+
+//---------------------------------------------------------
+//   setDamageAll
+//---------------------------------------------------------
+
+void Score::setDamageAll()
+{
+    m_damage.clear();
+    m_damageState = DamageState::All;
+}
+
+//---------------------------------------------------------
+//   takeDamage
+//    nothing recorded counts as everything, e.g. after
+//    changes which do not go through the layout
+//---------------------------------------------------------
+
+bool Score::takeDamage(std::vector<mu::RectF>& rects)
+{
+    bool known = m_damageState == DamageState::Rects;
+    rects = std::move(m_damage);
+
+    m_damage.clear();
+    m_damageState = DamageState::None;
+
+    return known;
+}
+
+//---------------------------------------------------------
+//   continueLayout
+//    lay out the pages left over by a page-limited layout,
+//    at most pageLimit of them (0: up to the end of the score)
+//---------------------------------------------------------
+
+void Score::continueLayout(size_t pageLimit)
+{
+    if (isLayoutComplete()) {
+        return;
+    }
+
+    m_layoutOptions.pageLimit = pageLimit;
+    doLayoutRange(m_layout.continueTick(), Fraction(-1, 1));
+}
+
 void Score::createPaddingTable()
 {
     for (size_t i=0; i < TOT_ELEMENT_TYPES; ++i) {
@@ -28,7 +28,9 @@
  Definition of Score class.
 */
 
+#include <atomic>
 #include <set>
+#include <vector>
 #include <memory>
 
 #include "async/channel.h"
@@ -165,14 +167,20 @@ class MeasureBaseList
     MeasureBase* _first = nullptr;
     MeasureBase* _last = nullptr;
 
+    // measures of the list in order, for binary searches by tick;
+    // rebuilt lazily after the list has changed, ticks are always read from the measures
+    mutable std::vector<Measure*> m_measureIndex;
+    mutable bool m_measureIndexValid = false;
+
     void push_back(MeasureBase* e);
     void push_front(MeasureBase* e);
+    void invalidateIndex() { m_measureIndexValid = false; }
 
 public:
     MeasureBaseList();
     MeasureBase* first() const { return _first; }
     MeasureBase* last()  const { return _last; }
-    void clear() { _first = _last = 0; _size = 0; }
+    void clear() { _first = _last = 0; _size = 0; invalidateIndex(); }
     void add(MeasureBase*);
     void remove(MeasureBase*);
     void insert(MeasureBase*, MeasureBase*);
@@ -180,6 +188,8 @@ public:
     void change(MeasureBase* o, MeasureBase* n);
     int size() const { return _size; }
     bool empty() const { return _size == 0; }
+
+    Measure* measureAt(const Fraction& tick) const;
 };
 
 //---------------------------------------------------------
@@ -269,7 +279,8 @@ class CmdState
     bool _oneElement = true;
     bool _oneMeasureBase = true;
 
-    bool _locked = false;
+    //! NOTE A counter, since the layouts of several scores of a master score may run concurrently
+    std::atomic<int> _lockCount { 0 };
 
     void setMeasureBase(const MeasureBase* mb);
 
@@ -296,8 +307,9 @@ public:
     staff_idx_t endStaff() const { return _endStaff; }
     const EngravingItem* element() const;
 
-    void lock() { _locked = true; }
-    void unlock() { _locked = false; }
+    void lock() { ++_lockCount; }
+    void unlock() { --_lockCount; }
+    bool locked() const { return _lockCount > 0; }
 #ifndef NDEBUG
     void dump();
 #endif
@@ -371,7 +383,7 @@ private:
     friend class Layout;
 
     static std::set<Score*> validScores;
-    int _linkId { 0 };
+    std::atomic<int> _linkId { 0 };
     MasterScore* _masterScore { 0 };
     std::list<MuseScoreView*> viewer;
     Excerpt* _excerpt  { 0 };
@@ -440,6 +452,15 @@ private:
     Layout m_layout;
     LayoutOptions m_layoutOptions;
 
+    enum class DamageState {
+        None,
+        Rects,
+        All
+    };
+
+    DamageState m_damageState = DamageState::None;
+    std::vector<mu::RectF> m_damage;   ///< canvas areas drawn differently since the last takeDamage()
+
     mu::async::Channel<EngravingItem*> m_elementDestroyed;
 
     ShadowNote* m_shadowNote = nullptr;
@@ -466,6 +487,7 @@ private:
     void doSelect(EngravingItem* e, SelectType type, staff_idx_t staffIdx);
     void selectSingle(EngravingItem* e, staff_idx_t staffIdx);
     void selectAdd(EngravingItem* e);
+    void selectAdd(const std::vector<EngravingItem*>& items);
     void selectRange(EngravingItem* e, staff_idx_t staffIdx);
 
     void cmdToggleVisible();
@@ -654,6 +676,8 @@ public:
     void undoChangePitch(Note* note, int pitch, int tpc1, int tpc2);
     void undoChangeFretting(Note* note, int pitch, int string, int fret, int tpc1, int tpc2);
     void spellNotelist(std::vector<Note*>& notes);
+    void applySpelling(const std::vector<Note*>& notes, const std::vector<int>& tpcs);
+    void spellStaves(const std::vector<std::vector<Note*> >& staffNotes);
     void undoChangeTpc(Note* note, int tpc);
     void undoChangeChordRestLen(ChordRest* cr, const TDuration&);
     void undoTransposeHarmony(Harmony*, int, int);
@@ -751,6 +775,9 @@ public:
 
     void startCmd();                    // start undoable command
     void endCmd(bool rollback = false, bool layoutAllParts = false); // end undoable command
+    void startBatch();                  // merge the following commands into one, see startBatch()
+    void endBatch(bool rollback = false, bool layoutAllParts = false);
+    bool isBatchActive() const;
     void update() { update(true); }
     void lockUpdates(bool locked);
     void undoRedo(bool undo, EditData*);
@@ -1049,6 +1076,20 @@ public:
 
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
+    static void doLayoutScores(const std::vector<Score*>& scores);
+
+    //! NOTE Demand-driven page layout: the next layout stops after pageLimit pages,
+    //! continueLayout() lays out the following pages later on
+    void setLayoutPageLimit(size_t pageLimit) { m_layoutOptions.pageLimit = pageLimit; }
+    bool isLayoutComplete() const { return m_layout.isLayoutComplete(); }
+    void continueLayout(size_t pageLimit = 0);
+    size_t estimatedPageCount() const { return m_layout.estimatedPageCount(); }
+
+    //! NOTE The layouts and refreshes record the canvas areas they change.
+    //! takeDamage() returns them and starts a new record, false means that the whole canvas has to be repainted
+    void addDamage(const mu::RectF& rect);
+    void setDamageAll();
+    bool takeDamage(std::vector<mu::RectF>& rects);
 
     SynthesizerState& synthesizerState() { return _synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
@@ -1210,6 +1251,7 @@ public:
     String nextRehearsalMarkText(RehearsalMark* previous, RehearsalMark* current) const;
 
     bool sanityCheck();
+    bool sanityCheck(const Fraction& startTick, const Fraction& endTick);
 
     bool checkKeys();
 
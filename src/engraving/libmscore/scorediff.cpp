@@ -0,0 +1,312 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "scorediff.h"
+
+#include <functional>
+
+#include "dtl/dtl.hpp"
+
+#include "io/buffer.h"
+
+#include "rw/xmlwriter.h"
+
+#include "measure.h"
+#include "score.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::io;
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   measureText
+//---------------------------------------------------------
+
+static std::string measureText(const MeasureBase* mb, staff_idx_t staffIdx)
+{
+    Buffer buffer;
+    buffer.open(IODevice::WriteOnly);
+    XmlWriter xml(&buffer);
+
+    if (mb->isMeasure()) {
+        toMeasure(mb)->write(xml, staffIdx, staffIdx == 0, false);
+    } else if (staffIdx == 0) {
+        mb->write(xml);
+    }
+
+    xml.flush();
+
+    const ByteArray& data = buffer.data();
+    return std::string(data.constChar(), data.size());
+}
+
+//---------------------------------------------------------
+//   lines
+//    split the text and trim the indentation of the lines
+//---------------------------------------------------------
+
+static std::vector<std::string> lines(const std::string& text)
+{
+    std::vector<std::string> result;
+    size_t begin = 0;
+    while (begin < text.size()) {
+        size_t end = text.find('\n', begin);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+
+        size_t first = text.find_first_not_of(' ', begin);
+        if (first < end) {
+            result.push_back(text.substr(first, end - first));
+        }
+
+        begin = end + 1;
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   measureLabel
+//---------------------------------------------------------
+
+static String measureLabel(const MeasureBase* mb)
+{
+    if (!mb) {
+        return u"-";
+    }
+
+    if (mb->isMeasure()) {
+        return String(u"measure %1").arg(toMeasure(mb)->no() + 1);
+    }
+
+    return String(u"%1 at tick %2").arg(String::fromAscii(mb->typeName())).arg(mb->tick().ticks());
+}
+
+//---------------------------------------------------------
+//   ScoreDiff
+//---------------------------------------------------------
+
+ScoreDiff::ScoreDiff(const Score* s1, const Score* s2)
+    : m_score1(s1), m_score2(s2)
+{
+}
+
+//---------------------------------------------------------
+//   records
+//---------------------------------------------------------
+
+std::vector<ScoreDiff::MeasureRecord> ScoreDiff::records(const Score* score)
+{
+    std::vector<MeasureRecord> result;
+    const size_t nstaves = score->nstaves();
+
+    for (const MeasureBase* mb = score->first(); mb; mb = mb->next()) {
+        MeasureRecord record;
+        record.measure = mb;
+        record.staves.reserve(nstaves);
+
+        for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+            record.staves.push_back(measureText(mb, staffIdx));
+            record.hash = record.hash * 31 + std::hash<std::string> {}(record.staves.back());
+        }
+
+        result.push_back(std::move(record));
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   measureChange
+//    compares the staves of the two measures line by line
+//---------------------------------------------------------
+
+ScoreDiff::MeasureChange ScoreDiff::measureChange(const MeasureRecord* r1, const MeasureRecord* r2)
+{
+    MeasureChange change;
+    change.type = ChangeType::Changed;
+    change.measure1 = r1->measure;
+    change.measure2 = r2->measure;
+
+    static const std::string noStaff;
+    const size_t nstaves = std::max(r1->staves.size(), r2->staves.size());
+
+    for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+        const std::string& text1 = staffIdx < r1->staves.size() ? r1->staves.at(staffIdx) : noStaff;
+        const std::string& text2 = staffIdx < r2->staves.size() ? r2->staves.at(staffIdx) : noStaff;
+        if (text1 == text2) {
+            continue;
+        }
+
+        dtl::Diff<std::string, std::vector<std::string> > diff(lines(text1), lines(text2));
+        diff.compose();
+
+        StaffChange staffChange;
+        staffChange.staff = staffIdx;
+        for (const auto& elem : diff.getSes().getSequence()) {
+            if (elem.second.type == dtl::SES_DELETE) {
+                staffChange.removedLines.push_back(String::fromStdString(elem.first));
+            } else if (elem.second.type == dtl::SES_ADD) {
+                staffChange.addedLines.push_back(String::fromStdString(elem.first));
+            }
+        }
+
+        change.staves.push_back(std::move(staffChange));
+    }
+
+    return change;
+}
+
+//---------------------------------------------------------
+//   addRun
+//    the removed and the inserted measures between two matching
+//    measures are paired in order as changed measures,
+//    the rest of them are removed or inserted
+//---------------------------------------------------------
+
+void ScoreDiff::addRun(const std::vector<const MeasureRecord*>& removed, const std::vector<const MeasureRecord*>& inserted)
+{
+    const size_t paired = std::min(removed.size(), inserted.size());
+    for (size_t i = 0; i < paired; ++i) {
+        m_changes.push_back(measureChange(removed.at(i), inserted.at(i)));
+    }
+
+    for (size_t i = paired; i < removed.size(); ++i) {
+        MeasureChange change;
+        change.type = ChangeType::Removed;
+        change.measure1 = removed.at(i)->measure;
+        m_changes.push_back(std::move(change));
+    }
+
+    for (size_t i = paired; i < inserted.size(); ++i) {
+        MeasureChange change;
+        change.type = ChangeType::Inserted;
+        change.measure2 = inserted.at(i)->measure;
+        m_changes.push_back(std::move(change));
+    }
+}
+
+//---------------------------------------------------------
+//   update
+//---------------------------------------------------------
+
+void ScoreDiff::update()
+{
+    TRACEFUNC;
+
+    m_changes.clear();
+
+    IF_ASSERT_FAILED(m_score1 && m_score2) {
+        return;
+    }
+
+    const std::vector<MeasureRecord> records1 = records(m_score1);
+    const std::vector<MeasureRecord> records2 = records(m_score2);
+
+    //! NOTE The common head and tail are skipped before the LCS,
+    //! in a mostly identical score that leaves only a few measures to match
+    size_t head = 0;
+    while (head < records1.size() && head < records2.size() && records1.at(head).hash == records2.at(head).hash) {
+        ++head;
+    }
+
+    size_t tail = 0;
+    while (tail < records1.size() - head && tail < records2.size() - head
+           && records1.at(records1.size() - tail - 1).hash == records2.at(records2.size() - tail - 1).hash) {
+        ++tail;
+    }
+
+    std::vector<size_t> hashes1;
+    for (size_t i = head; i < records1.size() - tail; ++i) {
+        hashes1.push_back(records1.at(i).hash);
+    }
+
+    std::vector<size_t> hashes2;
+    for (size_t i = head; i < records2.size() - tail; ++i) {
+        hashes2.push_back(records2.at(i).hash);
+    }
+
+    if (hashes1.empty() && hashes2.empty()) {
+        return;
+    }
+
+    dtl::Diff<size_t, std::vector<size_t> > diff(hashes1, hashes2, true);
+    diff.compose();
+
+    std::vector<const MeasureRecord*> removed;
+    std::vector<const MeasureRecord*> inserted;
+
+    for (const auto& elem : diff.getSes().getSequence()) {
+        switch (elem.second.type) {
+        case dtl::SES_DELETE:
+            removed.push_back(&records1.at(head + elem.second.beforeIdx - 1));
+            break;
+        case dtl::SES_ADD:
+            inserted.push_back(&records2.at(head + elem.second.afterIdx - 1));
+            break;
+        case dtl::SES_COMMON:
+            addRun(removed, inserted);
+            removed.clear();
+            inserted.clear();
+            break;
+        }
+    }
+
+    addRun(removed, inserted);
+}
+
+//---------------------------------------------------------
+//   report
+//---------------------------------------------------------
+
+String ScoreDiff::report() const
+{
+    String result;
+
+    for (const MeasureChange& change : m_changes) {
+        switch (change.type) {
+        case ChangeType::Inserted:
+            result += u"inserted " + measureLabel(change.measure2) + u"\n";
+            break;
+        case ChangeType::Removed:
+            result += u"removed " + measureLabel(change.measure1) + u"\n";
+            break;
+        case ChangeType::Changed:
+            result += u"changed " + measureLabel(change.measure1) + u" -> " + measureLabel(change.measure2) + u"\n";
+            break;
+        }
+
+        for (const StaffChange& staffChange : change.staves) {
+            result += String(u"  staff %1:\n").arg(staffChange.staff + 1);
+            for (const String& line : staffChange.removedLines) {
+                result += u"  - " + line + u"\n";
+            }
+            for (const String& line : staffChange.addedLines) {
+                result += u"  + " + line + u"\n";
+            }
+        }
+    }
+
+    return result;
+}
+}
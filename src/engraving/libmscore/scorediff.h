@@ -0,0 +1,93 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_SCOREDIFF_H
+#define MU_ENGRAVING_SCOREDIFF_H
+
+#include <string>
+#include <vector>
+
+#include "types/string.h"
+#include "types/types.h"
+
+namespace mu::engraving {
+class MeasureBase;
+class Score;
+
+//---------------------------------------------------------
+//   ScoreDiff
+//    Structural difference of two scores.
+//    Every measure is written staff by staff and hashed.
+//    The measure sequences are matched by hash, so the runs of
+//    identical measures are skipped without looking at their content,
+//    and only the changed measures are compared line by line.
+//---------------------------------------------------------
+
+class ScoreDiff
+{
+public:
+    enum class ChangeType : signed char {
+        Inserted,
+        Removed,
+        Changed
+    };
+
+    struct StaffChange {
+        staff_idx_t staff = 0;
+        std::vector<String> removedLines;
+        std::vector<String> addedLines;
+    };
+
+    struct MeasureChange {
+        ChangeType type = ChangeType::Changed;
+        const MeasureBase* measure1 = nullptr; // null if inserted
+        const MeasureBase* measure2 = nullptr; // null if removed
+        std::vector<StaffChange> staves;
+    };
+
+    ScoreDiff(const Score* s1, const Score* s2);
+
+    void update();
+
+    bool equal() const { return m_changes.empty(); }
+    const std::vector<MeasureChange>& changes() const { return m_changes; }
+
+    String report() const;
+
+private:
+    struct MeasureRecord {
+        const MeasureBase* measure = nullptr;
+        std::vector<std::string> staves;
+        size_t hash = 0;
+    };
+
+    static std::vector<MeasureRecord> records(const Score* score);
+    static MeasureChange measureChange(const MeasureRecord* r1, const MeasureRecord* r2);
+
+    void addRun(const std::vector<const MeasureRecord*>& removed, const std::vector<const MeasureRecord*>& inserted);
+
+    const Score* m_score1 = nullptr;
+    const Score* m_score2 = nullptr;
+    std::vector<MeasureChange> m_changes;
+};
+}
+
+#endif // MU_ENGRAVING_SCOREDIFF_H
@@ -367,6 +367,8 @@ bool Score::writeScore(io::IODevice* f, bool msczFormat, bool onlySelection, com
 
 bool Score::writeScore(io::IODevice* f, bool msczFormat, bool onlySelection, compat::WriteScoreHook& hook, WriteContext& ctx)
 {
+    TRACEFUNC;
+
     XmlWriter xml(f);
     xml.context()->setIsMsczMode(msczFormat);
     xml.setContext(&ctx);
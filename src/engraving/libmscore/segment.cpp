@@ -2545,20 +2545,20 @@ double Segment::elementsTopOffsetFromSkyline(staff_idx_t staffIndex) const
         return 0;
     }
 
-    SkylineLine north = staffSystem->skyline().north();
     int topOffset = INT_MAX;
-    for (SkylineSegment segment: north) {
-        Segment* seg = prev1enabled();
-        if (!seg) {
-            continue;
-        }
-        bool ok = seg->pagePos().x() <= segment.x && segment.x <= pagePos().x();
-        if (!ok) {
-            continue;
-        }
+    const Segment* seg = prev1enabled();
+    if (seg) {
+        const double startX = seg->pagePos().x();
+        const double endX = pagePos().x();
+        for (const SkylineSegment& segment : staffSystem->skyline().north()) {
+            bool ok = startX <= segment.x && segment.x <= endX;
+            if (!ok) {
+                continue;
+            }
 
-        if (segment.y < topOffset) {
-            topOffset = segment.y;
+            if (segment.y < topOffset) {
+                topOffset = segment.y;
+            }
         }
     }
 
@@ -2578,20 +2578,20 @@ double Segment::elementsBottomOffsetFromSkyline(staff_idx_t staffIndex) const
         return 0;
     }
 
-    SkylineLine south = staffSystem->skyline().south();
     int bottomOffset = INT_MIN;
-    for (SkylineSegment segment: south) {
-        Segment* seg = prev1enabled();
-        if (!seg) {
-            continue;
-        }
-        bool ok = seg->pagePos().x() <= segment.x && segment.x <= pagePos().x();
-        if (!ok) {
-            continue;
-        }
+    const Segment* seg = prev1enabled();
+    if (seg) {
+        const double startX = seg->pagePos().x();
+        const double endX = pagePos().x();
+        for (const SkylineSegment& segment : staffSystem->skyline().south()) {
+            bool ok = startX <= segment.x && segment.x <= endX;
+            if (!ok) {
+                continue;
+            }
 
-        if (segment.y > bottomOffset) {
-            bottomOffset = segment.y;
+            if (segment.y > bottomOffset) {
+                bottomOffset = segment.y;
+            }
         }
     }
 
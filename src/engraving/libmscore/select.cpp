@@ -457,6 +457,17 @@ void Selection::add(EngravingItem* el)
     update();
 }
 
+//! NOTE Updates the selection once for all the elements
+void Selection::add(const std::vector<EngravingItem*>& els)
+{
+    IF_ASSERT_FAILED(!isLocked()) {
+        LOGE() << "selection locked, reason: " << lockReason();
+        return;
+    }
+    _el.insert(_el.end(), els.begin(), els.end());
+    update();
+}
+
 void Selection::appendFiltered(EngravingItem* e)
 {
     IF_ASSERT_FAILED(!isLocked()) {
@@ -208,6 +208,7 @@ public:
     bool isSingle() const { return (_state == SelState::LIST) && (_el.size() == 1); }
 
     void add(EngravingItem*);
+    void add(const std::vector<EngravingItem*>& els);
     void deselectAll();
     void remove(EngravingItem*);
     void clear();
@@ -32,6 +32,32 @@ using namespace mu;
 using namespace mu::draw;
 
 namespace mu::engraving {
+//---------------------------------------------------------
+//   HorizontalExtent
+//    the horizontal range covered by the rects of a shape
+//    that pass the filter. A rect can only overlap one of
+//    these rects horizontally if it overlaps the range, so
+//    the pairwise tests skip the rects outside of it
+//---------------------------------------------------------
+
+struct HorizontalExtent {
+    double left = std::numeric_limits<double>::max();
+    double right = std::numeric_limits<double>::lowest();
+
+    template<typename Filter>
+    HorizontalExtent(const Shape& shape, Filter filter)
+    {
+        for (const RectF& r : shape) {
+            if (filter(r)) {
+                left = std::min(left, r.left());
+                right = std::max(right, r.right());
+            }
+        }
+    }
+
+    bool excludes(const RectF& r) const { return r.right() <= left || r.left() >= right; }
+};
+
 //---------------------------------------------------------
 //   addHorizontalSpacing
 //    This methods creates "walls". They are represented by
@@ -110,16 +136,17 @@ double Shape::minHorizontalDistance(const Shape& a, Score* score) const
             double ay1 = r1.top();
             double ay2 = r1.bottom();
             bool intersection = mu::engraving::intersects(ay1, ay2, by1, by2, verticalClearance);
-            double padding = 0;
             KerningType kerningType = KerningType::NON_KERNING;
             if (item1 && item2) {
-                padding = item1->computePadding(item2);
                 kerningType = item1->computeKerningType(item2);
             }
             if ((intersection && kerningType != KerningType::ALLOW_COLLISION)
                 || (r1.width() == 0 || r2.width() == 0) // Temporary hack: shapes of zero-width are assumed to collide with everyghin
                 || (!item1 && item2 && item2->isLyrics()) // Temporary hack: avoids collision with melisma line
                 || kerningType == KerningType::NON_KERNING) {
+                // padding is only needed for pairs that collide, which
+                // in large shapes (stacked lyrics, harmony) are the minority
+                double padding = (item1 && item2) ? item1->computePadding(item2) : 0.0;
                 dist = std::max(dist, r1.right() - r2.left() + padding);
             }
             if (kerningType == KerningType::KERNING_UNTIL_ORIGIN) { //prepared for future user option, for now always false
@@ -143,9 +170,11 @@ double Shape::minVerticalDistance(const Shape& a) const
         return 0.0;
     }
 
+    const HorizontalExtent extent(*this, [](const RectF& r) { return r.height() > 0.0; });
+
     double dist = -1000000.0; // min real
     for (const RectF& r2 : a) {
-        if (r2.height() <= 0.0) {
+        if (r2.height() <= 0.0 || extent.excludes(r2)) {
             continue;
         }
         double bx1 = r2.left();
@@ -172,8 +201,13 @@ double Shape::minVerticalDistance(const Shape& a) const
 //----------------------------------------------------------------
 bool Shape::clearsVertically(const Shape& a) const
 {
-    for (const RectF r1 : a) {
-        for (const RectF r2 : *this) {
+    const HorizontalExtent extent(*this, [](const RectF&) { return true; });
+
+    for (const RectF& r1 : a) {
+        if (extent.excludes(r1)) {
+            continue;
+        }
+        for (const RectF& r2 : *this) {
             if (mu::engraving::intersects(r1.left(), r1.right(), r2.left(), r2.right(), 0.0)) {
                 if (std::min(r1.top(), r1.bottom()) <= std::max(r2.top(), r2.bottom())) {
                     return false;
@@ -343,8 +377,18 @@ bool Shape::intersects(const RectF& rr) const
 
 bool Shape::intersects(const Shape& other) const
 {
+    if (empty() || other.empty()) {
+        return false;
+    }
+
+    // a rect intersecting one of the rects also intersects their bounding rect
+    RectF bbox;
+    for (const RectF& r : *this) {
+        bbox.unite(r);
+    }
+
     for (const RectF& r : other) {
-        if (intersects(r)) {
+        if (bbox.intersects(r) && intersects(r)) {
             return true;
         }
     }
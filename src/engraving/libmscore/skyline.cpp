@@ -261,40 +261,38 @@ double Skyline::minDistance(const Skyline& s) const
 double SkylineLine::minDistance(const SkylineLine& sl) const
 {
     double dist = MINIMUM_Y;
+    if (sl.seg.empty()) {
+        return dist;
+    }
 
-    double x1 = 0.0;
-    double x2 = 0.0;
-    auto k   = sl.begin();
-    for (auto i = begin(); i != end(); ++i) {
-        if (i->staffSpan > 0) {
-            continue; // don't add this to the distance because it crosses to the next staff
+    // autoplace compares a single element with the skyline of the whole system staff:
+    // only walk the segments of this skyline within the x range of sl
+    const double slRight = sl.seg.back().x + sl.seg.back().w;
+
+    SegConstIter k = sl.begin();
+    for (SegConstIter i = find(sl.seg.front().x); i != end() && i->x < slRight; ++i) {
+        if (i->staffSpan > 0 || !valid(*i)) {
+            // don't add this to the distance because it crosses to the next staff
+            // or there is nothing there
+            continue;
         }
-        while (k != sl.end() && (x2 + k->w) < x1) {
-            x2 += k->w;
-            ++k;
+        const double left = i->x;
+        const double right = i->x + i->w;
+
+        // the skylines are sorted by x: jump over the segments of sl
+        // lying completely to the left instead of walking through them
+        if (k != sl.end() && (k->x + k->w) < left) {
+            k = sl.find(left);
         }
         if (k == sl.end()) {
             break;
         }
-        for (;;) {
-            if ((x1 + i->w > x2) && (x1 < x2 + k->w) && k->staffSpan >= 0) {
+        for (SegConstIter kk = k; kk != sl.end() && kk->x < right; ++kk) {
+            if ((kk->x + kk->w > left) && kk->staffSpan >= 0 && sl.valid(*kk)) {
                 // (staffSpan: don't add lower north skyline object if it crosses into our staff)
-                dist = std::max(dist, i->y - k->y);
+                dist = std::max(dist, i->y - kk->y);
             }
-            if (x2 + k->w < x1 + i->w) {
-                x2 += k->w;
-                ++k;
-                if (k == sl.end()) {
-                    break;
-                }
-            } else {
-                break;
-            }
-        }
-        if (k == sl.end()) {
-            break;
         }
-        x1 += i->w;
     }
     return dist;
 }
@@ -1211,7 +1211,7 @@ void Spanner::setTick(const Fraction& v)
     Score* score = this->score();
 
     if (score) {
-        score->spannerMap().setDirty();
+        score->spannerMap().updateSpanner(this);
     }
 
     _startUniqueTicks = score ? score->repeatList().tick2utick(tick().ticks()) : 0;
@@ -1241,7 +1241,7 @@ void Spanner::setTicks(const Fraction& f)
     Score* score = this->score();
 
     if (score) {
-        score->spannerMap().setDirty();
+        score->spannerMap().updateSpanner(this);
     }
 
     _endUniqueTicks = score ? score->repeatList().tick2utick(tick2().ticks()) : 0;
@@ -21,6 +21,9 @@
  */
 
 #include "spannermap.h"
+
+#include <algorithm>
+
 #include "spanner.h"
 #include "part.h"
 
@@ -29,6 +32,130 @@
 using namespace mu;
 
 namespace mu::engraving {
+//---------------------------------------------------------
+//   interval tree helpers
+//---------------------------------------------------------
+
+namespace {
+template<typename Node>
+int height(const Node* n)
+{
+    return n ? n->height : 0;
+}
+
+template<typename Node>
+void updateNode(Node* n)
+{
+    n->height = 1 + std::max(height(n->left), height(n->right));
+    n->maxStop = n->stop;
+    if (n->left) {
+        n->maxStop = std::max(n->maxStop, n->left->maxStop);
+    }
+    if (n->right) {
+        n->maxStop = std::max(n->maxStop, n->right->maxStop);
+    }
+}
+
+template<typename Node>
+Node* rotateRight(Node* n)
+{
+    Node* l = n->left;
+    n->left = l->right;
+    l->right = n;
+    updateNode(n);
+    updateNode(l);
+    return l;
+}
+
+template<typename Node>
+Node* rotateLeft(Node* n)
+{
+    Node* r = n->right;
+    n->right = r->left;
+    r->left = n;
+    updateNode(n);
+    updateNode(r);
+    return r;
+}
+
+template<typename Node>
+Node* balance(Node* n)
+{
+    updateNode(n);
+    int diff = height(n->left) - height(n->right);
+    if (diff > 1) {
+        if (height(n->left->left) < height(n->left->right)) {
+            n->left = rotateLeft(n->left);
+        }
+        return rotateRight(n);
+    }
+    if (diff < -1) {
+        if (height(n->right->right) < height(n->right->left)) {
+            n->right = rotateRight(n->right);
+        }
+        return rotateLeft(n);
+    }
+    return n;
+}
+
+template<typename Node>
+bool less(const Node* a, const Node* b)
+{
+    return a->start < b->start || (a->start == b->start && a->seq < b->seq);
+}
+
+template<typename Node>
+Node* insert(Node* root, Node* n)
+{
+    if (!root) {
+        return n;
+    }
+    if (less(n, root)) {
+        root->left = insert(root->left, n);
+    } else {
+        root->right = insert(root->right, n);
+    }
+    return balance(root);
+}
+
+template<typename Node>
+Node* takeMin(Node* root, Node*& min)
+{
+    if (!root->left) {
+        min = root;
+        return root->right;
+    }
+    root->left = takeMin(root->left, min);
+    return balance(root);
+}
+
+template<typename Node>
+Node* remove(Node* root, const Node* n)
+{
+    if (!root) {
+        return nullptr;
+    }
+    if (root == n) {
+        Node* l = root->left;
+        Node* r = root->right;
+        if (!r) {
+            return l;
+        }
+        Node* min = nullptr;
+        r = takeMin(r, min);
+        min->left = l;
+        min->right = r;
+        return balance(min);
+    }
+    if (less(n, root)) {
+        root->left = remove(root->left, n);
+    } else {
+        root->right = remove(root->right, n);
+    }
+    return balance(root);
+}
+}
+
 //---------------------------------------------------------
 //   SpannerMap
 //---------------------------------------------------------
@@ -36,12 +163,26 @@ namespace mu::engraving {
 SpannerMap::SpannerMap()
     : std::multimap<int, Spanner*>()
 {
-    dirty = true;
+}
+
+SpannerMap::~SpannerMap()
+{
+    deleteTree(m_root);
+}
+
+void SpannerMap::deleteTree(Node* n)
+{
+    if (!n) {
+        return;
+    }
+    deleteTree(n->left);
+    deleteTree(n->right);
+    delete n;
 }
 
 //---------------------------------------------------------
 //   update
-//   updates the internal lookup tree, not the map itself
+//   updates the collision free lookup tree, not the map itself
 //---------------------------------------------------------
 
 void SpannerMap::update() const
@@ -51,9 +192,8 @@ void SpannerMap::update() const
 
     collectIntervals(regularIntervals, collisionFreeIntervals);
 
-    tree = interval_tree::IntervalTree<Spanner*>(regularIntervals);
     collisionFreeTree = interval_tree::IntervalTree<Spanner*>(collisionFreeIntervals);
-    dirty = false;
+    m_collisionFreeDirty = false;
 }
 
 //---------------------------------------------------------
@@ -62,16 +202,17 @@ void SpannerMap::update() const
 
 const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
-        update();
-    }
-
     results.clear();
 
     if (excludeCollisions) {
+        if (m_collisionFreeDirty) {
+            update();
+        }
         collisionFreeTree.findContained(start, stop, results);
     } else {
-        tree.findContained(start, stop, results);
+        forEachContained(start, stop, [this](Spanner* s) {
+            results.emplace_back(s->tick().ticks(), s->tick2().ticks(), s);
+        });
     }
 
     return results;
@@ -83,16 +224,17 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
 
 const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
-        update();
-    }
-
     results.clear();
 
     if (excludeCollisions) {
+        if (m_collisionFreeDirty) {
+            update();
+        }
         collisionFreeTree.findOverlapping(start, stop, results);
     } else {
-        tree.findOverlapping(start, stop, results);
+        forEachOverlapping(start, stop, [this](Spanner* s) {
+            results.emplace_back(s->tick().ticks(), s->tick2().ticks(), s);
+        });
     }
 
     return results;
@@ -142,14 +284,48 @@ void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList&
     }
 }
 
+//---------------------------------------------------------
+//   insertNode
+//---------------------------------------------------------
+
+void SpannerMap::insertNode(Spanner* s, std::multimap<int, Spanner*>::iterator it)
+{
+    Node* n = new Node();
+    n->start = s->tick().ticks();
+    n->stop = s->tick2().ticks();
+    n->maxStop = n->stop;
+    n->seq = m_nextSeq++;
+    n->spanner = s;
+
+    m_root = insert(m_root, n);
+    m_entries[s] = Entry { it, n };
+}
+
+//---------------------------------------------------------
+//   removeNode
+//---------------------------------------------------------
+
+void SpannerMap::removeNode(const Entry& entry)
+{
+    m_root = remove(m_root, entry.node);
+    delete entry.node;
+}
+
 //---------------------------------------------------------
 //   addSpanner
 //---------------------------------------------------------
 
 void SpannerMap::addSpanner(Spanner* s)
 {
-    insert(std::pair<int, Spanner*>(s->tick().ticks(), s));
-    dirty = true;
+    auto existing = m_entries.find(s);
+    if (existing != m_entries.end()) {
+        LOGD("%s (%p) already added", s->typeName(), s);
+        return;
+    }
+
+    auto it = insert(std::pair<int, Spanner*>(s->tick().ticks(), s));
+    insertNode(s, it);
+    m_collisionFreeDirty = true;
 }
 
 //---------------------------------------------------------
@@ -158,15 +334,55 @@ void SpannerMap::addSpanner(Spanner* s)
 
 bool SpannerMap::removeSpanner(Spanner* s)
 {
-    for (auto i = begin(); i != end(); ++i) {
-        if (i->second == s) {
-            erase(i);
-            dirty = true;
-            return true;
-        }
+    auto entry = m_entries.find(s);
+    if (entry == m_entries.end()) {
+        LOGD("%s (%p) not found", s->typeName(), s);
+        return false;
     }
-    LOGD("%s (%p) not found", s->typeName(), s);
-    return false;
+
+    erase(entry->second.it);
+    removeNode(entry->second);
+    m_entries.erase(entry);
+    m_collisionFreeDirty = true;
+    return true;
+}
+
+//---------------------------------------------------------
+//   updateSpanner
+//    move a spanner whose start or length has changed
+//    to its new place in the interval tree
+//---------------------------------------------------------
+
+void SpannerMap::updateSpanner(Spanner* s)
+{
+    auto entry = m_entries.find(s);
+    if (entry == m_entries.end()) {
+        return;
+    }
+
+    const Node* n = entry->second.node;
+    if (n->start == s->tick().ticks() && n->stop == s->tick2().ticks()) {
+        return;
+    }
+
+    //! NOTE The map itself keeps the old key, callers iterating over it may change spanner ticks
+    std::multimap<int, Spanner*>::iterator it = entry->second.it;
+    removeNode(entry->second);
+    insertNode(s, it);
+    m_collisionFreeDirty = true;
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void SpannerMap::clear()
+{
+    std::multimap<int, Spanner*>::clear();
+    deleteTree(m_root);
+    m_root = nullptr;
+    m_entries.clear();
+    m_collisionFreeDirty = true;
 }
 
 #ifndef NDEBUG
@@ -24,6 +24,8 @@
 #define __SPANNERMAP_H__
 
 #include <map>
+#include <unordered_map>
+
 #include "thirdparty/intervaltree/IntervalTree.h"
 
 namespace mu::engraving {
@@ -31,15 +33,50 @@ class Spanner;
 
 //---------------------------------------------------------
 //   SpannerMap
+//    Spanners ordered by start tick. Overlap queries
+//    use an interval tree (AVL tree ordered by start tick,
+//    each node keeps the largest end tick of its subtree),
+//    which is updated on every insertion, removal and tick
+//    change instead of being rebuilt.
 //---------------------------------------------------------
 
 class SpannerMap : std::multimap<int, Spanner*>
 {
-    mutable bool dirty;
-    mutable interval_tree::IntervalTree<Spanner*> tree;
+    struct Node {
+        int start = 0;
+        int stop = 0;
+        int maxStop = 0;        // largest stop in this subtree
+        int height = 1;
+        size_t seq = 0;         // insertion order, orders spanners with the same start
+        Spanner* spanner = nullptr;
+        Node* left = nullptr;
+        Node* right = nullptr;
+    };
+
+    struct Entry {
+        std::multimap<int, Spanner*>::iterator it;
+        Node* node = nullptr;
+    };
+
+    Node* m_root = nullptr;
+    size_t m_nextSeq = 0;
+    std::unordered_map<const Spanner*, Entry> m_entries;
+
+    // the collision free intervals depend on the neighbours of each spanner,
+    // they are only used for playback and rebuilt on demand
+    mutable bool m_collisionFreeDirty = true;
     mutable interval_tree::IntervalTree<Spanner*> collisionFreeTree;
     mutable std::vector<interval_tree::Interval<Spanner*> > results;
 
+    void insertNode(Spanner* s, std::multimap<int, Spanner*>::iterator it);
+    void removeNode(const Entry& entry);
+    static void deleteTree(Node* n);
+
+    template<typename F>
+    static void visitOverlapping(const Node* n, int start, int stop, F& f);
+    template<typename F>
+    static void visitContained(const Node* n, int start, int stop, F& f);
+
 public:
     typedef typename std::multimap<int, Spanner*>::const_reverse_iterator const_reverse_it;
     typedef typename std::multimap<int, Spanner*>::const_iterator const_it;
@@ -47,9 +84,21 @@ public:
     using IntervalList = std::vector<interval_tree::Interval<Spanner*> >;
 
     SpannerMap();
+    ~SpannerMap();
+
+    SpannerMap(const SpannerMap&) = delete;
+    SpannerMap& operator=(const SpannerMap&) = delete;
 
     const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
     const IntervalList& findOverlapping(int start, int stop, bool excludeCollisions = false) const;
+
+    //! NOTE Call f(Spanner*) for each spanner overlapping [start, stop], in start tick order,
+    //! without allocating. The map must not be modified from f.
+    template<typename F>
+    void forEachOverlapping(int start, int stop, F&& f) const { visitOverlapping(m_root, start, stop, f); }
+    template<typename F>
+    void forEachContained(int start, int stop, F&& f) const { visitContained(m_root, start, stop, f); }
+
     const std::multimap<int, Spanner*>& map() const { return *this; }
 
     void collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const;
@@ -60,14 +109,66 @@ public:
     const_it cend() const { return std::multimap<int, Spanner*>::cend(); }
     void addSpanner(Spanner* s);
     bool removeSpanner(Spanner* s);
-    void clear() { std::multimap<int, Spanner*>::clear(); dirty = true; }
+    void updateSpanner(Spanner* s);             // must be called if a spanner changes start/length
+    void clear();
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
-    void setDirty() const { dirty = true; }     // must be called if a spanner changes start/length
+    void setDirty() const { m_collisionFreeDirty = true; }
 #ifndef NDEBUG
     void dump() const;
 #endif
 };
+
+//---------------------------------------------------------
+//   visitOverlapping
+//---------------------------------------------------------
+
+template<typename F>
+void SpannerMap::visitOverlapping(const Node* n, int start, int stop, F& f)
+{
+    if (!n || n->maxStop < start) {
+        return;
+    }
+
+    visitOverlapping(n->left, start, stop, f);
+
+    if (n->start > stop) {
+        return;
+    }
+
+    if (n->stop >= start) {
+        f(n->spanner);
+    }
+
+    visitOverlapping(n->right, start, stop, f);
+}
+
+//---------------------------------------------------------
+//   visitContained
+//---------------------------------------------------------
+
+template<typename F>
+void SpannerMap::visitContained(const Node* n, int start, int stop, F& f)
+{
+    if (!n || n->maxStop < start) {
+        return;
+    }
+
+    // the left subtree only holds smaller start ticks
+    if (n->start >= start) {
+        visitContained(n->left, start, stop, f);
+    }
+
+    if (n->start > stop) {
+        return;
+    }
+
+    if (n->start >= start && n->stop <= stop) {
+        f(n->spanner);
+    }
+
+    visitContained(n->right, start, stop, f);
+}
 } // namespace mu::engraving
 
 #endif
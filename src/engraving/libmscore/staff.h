@@ -162,6 +162,7 @@ public:
     size_t bracketLevels() const;
 
     ClefList& clefList() { return clefs; }
+    const ClefList& clefList() const { return clefs; }
     ClefTypeList clefType(const Fraction&) const;
     ClefTypeList defaultClefType() const { return _defaultClefType; }
     void setDefaultClefType(const ClefTypeList& l) { _defaultClefType = l; }
@@ -187,6 +188,7 @@ public:
     const Groups& group(const Fraction&) const;
 
     KeyList* keyList() { return &_keys; }
+    const KeyList* keyList() const { return &_keys; }
     Key key(const Fraction& tick) const { return keySigEvent(tick).key(); }
     KeySigEvent keySigEvent(const Fraction&) const;
     Fraction nextKeyTick(const Fraction&) const;
@@ -240,6 +242,7 @@ public:
     const StaffType* staffType(const Fraction& = Fraction(0, 1)) const;
     const StaffType* constStaffType(const Fraction&) const;
     const StaffType* staffTypeForElement(const EngravingItem*) const;
+    const StaffTypeList& staffTypeList() const { return _staffTypeList; }
     bool isStaffTypeStartFrom(const Fraction& = Fraction(0, 1)) const;
     void moveStaffType(const Fraction& from, const Fraction& to);
     StaffType* staffType(const Fraction&);
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "stafftimeline.h"
+
+#include <algorithm>
+
+#include "part.h"
+#include "staff.h"
+
+using namespace mu;
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   StaffTimeline
+//---------------------------------------------------------
+
+StaffTimeline::StaffTimeline(const Staff* staff)
+{
+    std::vector<int> ticks { 0 };
+
+    for (const auto& pair : *staff->keyList()) {
+        ticks.push_back(pair.first);
+    }
+    for (const auto& pair : staff->clefList()) {
+        ticks.push_back(pair.first);
+    }
+    for (const auto& pair : staff->part()->instruments()) {
+        ticks.push_back(pair.first);
+    }
+    for (int tick = 0;;) {
+        int next = staff->staffTypeList().staffTypeRange(Fraction::fromTicks(tick)).second;
+        if (next <= tick) {
+            break;
+        }
+        ticks.push_back(next);
+        tick = next;
+    }
+
+    std::sort(ticks.begin(), ticks.end());
+    ticks.erase(std::unique(ticks.begin(), ticks.end()), ticks.end());
+    ticks.erase(ticks.begin(), std::lower_bound(ticks.begin(), ticks.end(), 0));
+
+    m_states.reserve(ticks.size());
+    for (int tick : ticks) {
+        Fraction t = Fraction::fromTicks(tick);
+        State state;
+        state.tick = tick;
+        state.keySigEvent = staff->keySigEvent(t);
+        state.clefType = staff->clefType(t);
+        state.staffType = staff->staffType(t);
+        state.instrument = staff->part()->instrument(t);
+        m_states.push_back(std::move(state));
+    }
+}
+
+//---------------------------------------------------------
+//   state
+//    the state at tick, ticks before 0 get the state at 0
+//---------------------------------------------------------
+
+const StaffTimeline::State& StaffTimeline::state(int tick) const
+{
+    auto it = std::upper_bound(m_states.cbegin(), m_states.cend(), tick, [](int t, const State& s) {
+        return t < s.tick;
+    });
+    return it == m_states.cbegin() ? *it : *std::prev(it);
+}
+
+//---------------------------------------------------------
+//   Cursor::seek
+//---------------------------------------------------------
+
+const StaffTimeline::State& StaffTimeline::Cursor::seek(int tick)
+{
+    const std::vector<State>& states = m_timeline->m_states;
+
+    while (m_idx > 0 && states[m_idx].tick > tick) {
+        --m_idx;
+    }
+    while (m_idx + 1 < states.size() && states[m_idx + 1].tick <= tick) {
+        ++m_idx;
+    }
+
+    return states[m_idx];
+}
+}
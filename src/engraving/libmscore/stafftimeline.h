@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_STAFFTIMELINE_H
+#define MU_ENGRAVING_STAFFTIMELINE_H
+
+#include <vector>
+
+#include "clef.h"
+#include "key.h"
+
+namespace mu::engraving {
+class Instrument;
+class Staff;
+class StaffType;
+
+//---------------------------------------------------------
+//   StaffTimeline
+//    A flat snapshot of the key, clef, staff type and
+//    instrument changes of a staff, for the loops that
+//    look them up for many ticks in order.
+//    It isn't updated when the staff changes, so it must
+//    not outlive the loop that created it.
+//---------------------------------------------------------
+
+class StaffTimeline
+{
+public:
+    struct State {
+        int tick = 0;
+        KeySigEvent keySigEvent;
+        ClefTypeList clefType;
+        const StaffType* staffType = nullptr;
+        const Instrument* instrument = nullptr;
+    };
+
+    //---------------------------------------------------------
+    //   Cursor
+    //    amortized O(1) per seek when the ticks mostly go forward
+    //---------------------------------------------------------
+
+    class Cursor
+    {
+    public:
+        explicit Cursor(const StaffTimeline& timeline)
+            : m_timeline(&timeline) {}
+
+        const State& seek(int tick);
+
+    private:
+        const StaffTimeline* m_timeline = nullptr;
+        size_t m_idx = 0;
+    };
+
+    explicit StaffTimeline(const Staff* staff);
+
+    const State& state(int tick) const;
+    const std::vector<State>& states() const { return m_states; }
+
+    Cursor cursor() const { return Cursor(*this); }
+
+private:
+    std::vector<State> m_states;
+};
+}
+
+#endif // MU_ENGRAVING_STAFFTIMELINE_H
@@ -22,7 +22,7 @@
 
 #include "stringdata.h"
 
-#include <map>
+#include <algorithm>
 
 #include "rw/xml.h"
 
@@ -189,8 +189,9 @@ void StringData::fretChords(Chord* chord) const
     for (nString = 0; nString < static_cast<int>(strings()); nString++) {
         bUsed[nString] = 0;
     }
-    // we also need the notes sorted in order of string (from highest to lowest) and then pitch
-    std::map<int, Note*> sortedNotes;
+    // we also need the notes sorted in order of string (from highest to lowest) and then pitch;
+    // a segment has few notes, so they are collected in a vector and sorted once
+    std::vector<std::pair<int, Note*> > sortedNotes;
     int count = 0;
     // store staff pitch offset at this tick, to speed up actual note pitch calculations
     int transp = chord->staff() ? chord->part()->instrument(chord->tick())->transpose().chromatic : 0;
@@ -212,6 +213,10 @@ void StringData::fretChords(Chord* chord) const
             }
         }
     }
+    // the keys are unique, they include the submission order
+    std::sort(sortedNotes.begin(), sortedNotes.end(), [](const std::pair<int, Note*>& a, const std::pair<int, Note*>& b) {
+        return a.first < b.first;
+    });
     // determine used range of frets
     minFret = INT32_MAX;
     maxFret = INT32_MIN;
@@ -462,7 +467,7 @@ int StringData::fret(int pitch, int string, int pitchOffset) const
 //    Notes without a string assigned yet, are sorted according to the lowest string which can accommodate them.
 //---------------------------------------------------------
 
-void StringData::sortChordNotes(std::map<int, Note*>& sortedNotes, const Chord* chord, int pitchOffset, int* count) const
+void StringData::sortChordNotes(std::vector<std::pair<int, Note*> >& sortedNotes, const Chord* chord, int pitchOffset, int* count) const
 {
     int capoFret = chord->staff()->part()->capoFret();
 
@@ -486,7 +491,7 @@ void StringData::sortChordNotes(std::map<int, Note*>& sortedNotes, const Chord*
 
         int key = string * 100000;
         key += -(note->pitch() + pitchOffset) * 100 + *count;       // disambiguate notes of equal pitch
-        sortedNotes.insert({ key, note });
+        sortedNotes.push_back({ key, note });
         (*count)++;
     }
 }
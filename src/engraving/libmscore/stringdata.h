@@ -61,7 +61,7 @@ class StringData
     bool        convertPitch(int pitch, int pitchOffset, int* string, int* fret) const;
     int         fret(int pitch, int string, int pitchOffset) const;
     int         getPitch(int string, int fret, int pitchOffset) const;
-    void        sortChordNotes(std::map<int, Note*>& sortedNotes, const Chord* chord, int pitchOffset, int* count) const;
+    void        sortChordNotes(std::vector<std::pair<int, Note*> >& sortedNotes, const Chord* chord, int pitchOffset, int* count) const;
 
 public:
     StringData() {}
@@ -22,6 +22,7 @@
 
 #include "tempo.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "rw/xml.h"
@@ -131,6 +132,34 @@ void TempoMap::normalize()
         tempo = e->second.tempo.val;
     }
     ++_tempoSN;
+    updateIndex();
+}
+
+//---------------------------------------------------------
+//   updateIndex
+//---------------------------------------------------------
+
+void TempoMap::updateIndex()
+{
+    _index.clear();
+    _index.reserve(size());
+
+    for (auto e = cbegin(); e != cend(); ++e) {
+        _index.push_back({ e->first, e->second.tempo.val, e->second.pause, e->second.time });
+    }
+
+    _indexSN = _tempoSN;
+}
+
+//---------------------------------------------------------
+//   isIndexValid
+//    the events might have been inserted into the map
+//    directly, without normalizing it
+//---------------------------------------------------------
+
+bool TempoMap::isIndexValid() const
+{
+    return _indexSN == _tempoSN && _index.size() == size() && !_index.empty();
 }
 
 //---------------------------------------------------------
@@ -154,6 +183,7 @@ void TempoMap::clear()
 {
     std::map<int, TEvent>::clear();
     ++_tempoSN;
+    updateIndex();
 }
 
 //---------------------------------------------------------
@@ -171,6 +201,7 @@ void TempoMap::clearRange(int tick1, int tick2)
     }
     erase(first, last);
     ++_tempoSN;
+    updateIndex();
 }
 
 //---------------------------------------------------------
@@ -290,7 +321,19 @@ double TempoMap::tick2time(int tick, int* sn) const
     double delta = double(tick);
     BeatsPerSecond tempo = 2.0;
 
-    if (!empty()) {
+    if (isIndexValid()) {
+        int ptick = 0;
+        auto e = std::upper_bound(_index.cbegin(), _index.cend(), tick, [](int t, const IndexEntry& entry) {
+            return t < entry.tick;
+        });
+        if (e != _index.cbegin()) {
+            --e;
+            ptick = e->tick;
+            tempo = e->tempo;
+            time  = e->time;
+        }
+        delta = double(tick - ptick);
+    } else if (!empty()) {
         int ptick  = 0;
         auto e = lower_bound(tick);
         if (e == end()) {
@@ -333,6 +376,30 @@ int TempoMap::time2tick(double time, int* sn) const
 
     delta = 0.0;
     tempo = 2.0;
+
+    if (isIndexValid()) {
+        // the first event which is not before the time, the events before it are passed completely
+        auto e = std::lower_bound(_index.cbegin(), _index.cend(), time, [](const IndexEntry& entry, double t) {
+            return entry.time < t;
+        });
+        if (e != _index.cbegin()) {
+            auto pe = e - 1;
+            delta = pe->time;
+            tick  = pe->tick;
+            tempo = pe->tempo;
+        }
+        // if in a pause period, wait on previous tick
+        if (e != _index.cend() && time > e->time - e->pause) {
+            delta = (time - (e->time - e->pause) + delta);
+        }
+        delta = time - delta;
+        tick += lrint(delta * _tempoMultiplier.val * Constants::division * tempo.val);
+        if (sn) {
+            *sn = _tempoSN;
+        }
+        return tick;
+    }
+
     for (auto e = begin(); e != end(); ++e) {
         // if in a pause period, wait on previous tick
         if ((time <= e->second.time) && (time > e->second.time - e->second.pause)) {
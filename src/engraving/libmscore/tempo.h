@@ -24,6 +24,7 @@
 #define __AL_TEMPO_H__
 
 #include <map>
+#include <vector>
 
 #include "global/allocator.h"
 #include "global/async/notification.h"
@@ -77,7 +78,21 @@ class TempoMap : public std::map<int, TEvent>
     BeatsPerSecond _tempoMultiplier;
     async::Notification _tempoMultiplierChanged;
 
+    //! NOTE A flat copy of the events sorted by tick (and so by time), for the binary searches
+    //!      in tick2time and time2tick which are called many times while playing
+    struct IndexEntry {
+        int tick = 0;
+        double tempo = 0.0;
+        double pause = 0.0;
+        double time = 0.0;
+    };
+
+    std::vector<IndexEntry> _index;
+    int _indexSN = 0;
+
     void normalize();
+    void updateIndex();
+    bool isIndexValid() const;
     void del(int tick);
 
 public:
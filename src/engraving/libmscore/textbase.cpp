@@ -868,50 +868,26 @@ void TextBlock::draw(mu::draw::Painter* p, const TextBase* t) const
 }
 
 //---------------------------------------------------------
-//   layout
+//   measure
+//    positions the fragments and computes the bounding box and the line spacing,
+//    before the alignment and the line spacing of the text are applied
 //---------------------------------------------------------
 
-void TextBlock::layout(TextBase* t)
+void TextBlock::measure(const TextBase* t)
 {
-    _bbox        = RectF();
-    double x      = 0.0;
-    _lineSpacing = 0.0;
-    double lm     = 0.0;
+    MeasureCache key;
+    key.spatium = t->sizeIsSpatiumDependent() ? t->spatium() : 0.0;
+    key.textStyleType = t->textStyleType();
+    key.musicalTextFont = t->score()->styleSt(Sid::MusicalTextFont);
+    key.musicalSymbolFont = t->score()->styleSt(Sid::MusicalSymbolFont);
 
-    double layoutWidth = 0;
-    EngravingItem* e = t->parentItem();
-    if (e && t->layoutToParentWidth()) {
-        layoutWidth = e->width();
-        switch (e->type()) {
-        case ElementType::HBOX:
-        case ElementType::VBOX:
-        case ElementType::TBOX: {
-            Box* b = toBox(e);
-            layoutWidth -= ((b->leftMargin() + b->rightMargin()) * DPMM);
-            lm = b->leftMargin() * DPMM;
-        }
-        break;
-        case ElementType::PAGE: {
-            Page* p = toPage(e);
-            layoutWidth -= (p->lm() + p->rm());
-            lm = p->lm();
-        }
-        break;
-        case ElementType::MEASURE: {
-            Measure* m = toMeasure(e);
-            layoutWidth = m->bbox().width();
-        }
-        break;
-        default:
-            break;
-        }
+    if (_measureCache && restoreMeasure(key)) {
+        return;
     }
 
-    if (_fragments.empty()) {
-        mu::draw::FontMetrics fm = t->fontMetrics();
-        _bbox.setRect(0.0, -fm.ascent(), 1.0, fm.descent());
-        _lineSpacing = fm.lineSpacing();
-    } else if (_fragments.size() == 1 && _fragments.front().text.isEmpty()) {
+    double x = 0.0;
+
+    if (_fragments.size() == 1 && _fragments.front().text.isEmpty()) {
         auto fi = _fragments.begin();
         TextFragment& f = *fi;
         f.pos.setX(x);
@@ -962,6 +938,90 @@ void TextBlock::layout(TextBase* t)
         }
     }
 
+    std::shared_ptr<MeasureCache> cache = std::make_shared<MeasureCache>(std::move(key));
+    cache->fragments.assign(_fragments.begin(), _fragments.end());
+    cache->bbox = _bbox;
+    cache->lineSpacing = _lineSpacing;
+    _measureCache = cache;
+}
+
+bool TextBlock::restoreMeasure(const MeasureCache& key)
+{
+    const MeasureCache& cache = *_measureCache;
+    if (!RealIsEqual(cache.spatium, key.spatium)
+        || cache.textStyleType != key.textStyleType
+        || cache.musicalTextFont != key.musicalTextFont
+        || cache.musicalSymbolFont != key.musicalSymbolFont
+        || cache.fragments.size() != _fragments.size()) {
+        return false;
+    }
+
+    auto ci = cache.fragments.cbegin();
+    for (const TextFragment& f : _fragments) {
+        if (!(f == *ci)) {
+            return false;
+        }
+        ++ci;
+    }
+
+    ci = cache.fragments.cbegin();
+    for (TextFragment& f : _fragments) {
+        f.pos = ci->pos;
+        ++ci;
+    }
+
+    _bbox = cache.bbox;
+    _lineSpacing = cache.lineSpacing;
+    return true;
+}
+
+//---------------------------------------------------------
+//   layout
+//---------------------------------------------------------
+
+void TextBlock::layout(TextBase* t)
+{
+    _bbox        = RectF();
+    _lineSpacing = 0.0;
+    double lm     = 0.0;
+
+    double layoutWidth = 0;
+    EngravingItem* e = t->parentItem();
+    if (e && t->layoutToParentWidth()) {
+        layoutWidth = e->width();
+        switch (e->type()) {
+        case ElementType::HBOX:
+        case ElementType::VBOX:
+        case ElementType::TBOX: {
+            Box* b = toBox(e);
+            layoutWidth -= ((b->leftMargin() + b->rightMargin()) * DPMM);
+            lm = b->leftMargin() * DPMM;
+        }
+        break;
+        case ElementType::PAGE: {
+            Page* p = toPage(e);
+            layoutWidth -= (p->lm() + p->rm());
+            lm = p->lm();
+        }
+        break;
+        case ElementType::MEASURE: {
+            Measure* m = toMeasure(e);
+            layoutWidth = m->bbox().width();
+        }
+        break;
+        default:
+            break;
+        }
+    }
+
+    if (_fragments.empty()) {
+        mu::draw::FontMetrics fm = t->fontMetrics();
+        _bbox.setRect(0.0, -fm.ascent(), 1.0, fm.descent());
+        _lineSpacing = fm.lineSpacing();
+    } else {
+        measure(t);
+    }
+
     // Apply style/custom line spacing
     _lineSpacing *= t->textLineSpacing();
 
@@ -23,6 +23,7 @@
 #ifndef __TEXTBASE_H__
 #define __TEXTBASE_H__
 
+#include <memory>
 #include <variant>
 
 #include "modularity/ioc.h"
@@ -236,13 +237,27 @@ public:
 
 class TextBlock
 {
+    //! NOTE The measured fragments, reused while the text, the format and the fonts are the same
+    struct MeasureCache {
+        std::vector<TextFragment> fragments;
+        mu::RectF bbox;
+        double lineSpacing = 0.0;
+        double spatium = 0.0;
+        TextStyleType textStyleType = TextStyleType::DEFAULT;
+        String musicalTextFont;
+        String musicalSymbolFont;
+    };
+
     std::list<TextFragment> _fragments;
     double _y = 0;
     double _lineSpacing = 0.0;
     mu::RectF _bbox;
     bool _eol = false;
+    std::shared_ptr<const MeasureCache> _measureCache;
 
     void simplify();
+    void measure(const TextBase*);
+    bool restoreMeasure(const MeasureCache& key);
 
 public:
     TextBlock() {}
@@ -439,14 +439,20 @@ bool Score::transpose(TransposeMode mode, TransposeDirection direction, Key trKe
         s1 = s1->measure()->first();
     }
     Segment* s2 = _selection.endSegment();
+
+    // the staff types are taken at the start of the range, so they are looked up once rather than for each segment
+    std::vector<track_idx_t> pitchedTracks;
+    for (track_idx_t track : tracks) {
+        if (staff(track / VOICES)->staffType(s1->tick())->group() != StaffGroup::PERCUSSION) {
+            pitchedTracks.push_back(track);
+        }
+    }
+
     for (Segment* segment = s1; segment && segment != s2; segment = segment->next1()) {
         if (!segment->enabled()) {
             continue;
         }
-        for (track_idx_t track : tracks) {
-            if (staff(track / VOICES)->staffType(s1->tick())->group() == StaffGroup::PERCUSSION) {
-                continue;
-            }
+        for (track_idx_t track : pitchedTracks) {
             EngravingItem* e = segment->element(track);
             if (!e) {
                 continue;
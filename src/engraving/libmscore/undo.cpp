@@ -168,6 +168,40 @@ void UndoCommand::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   estimatedItemMemory
+//    elements don't know their own size, estimate it
+//    from the number of items in the subtree
+//---------------------------------------------------------
+
+static constexpr size_t ESTIMATED_ITEM_SIZE = 512;
+
+static size_t estimatedItemMemory(const EngravingObject* e)
+{
+    if (!e) {
+        return 0;
+    }
+
+    size_t size = ESTIMATED_ITEM_SIZE;
+    for (const EngravingObject* child : e->children()) {
+        size += estimatedItemMemory(child);
+    }
+    return size;
+}
+
+//---------------------------------------------------------
+//   UndoCommand::memoryUsage
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryUsage() const
+{
+    size_t size = sizeof(*this);
+    for (const UndoCommand* c : childList) {
+        size += c->memoryUsage();
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -263,9 +297,9 @@ void UndoCommand::filterChildren(UndoCommand::Filter f, EngravingItem* target)
 //   unwind
 //---------------------------------------------------------
 
-void UndoCommand::unwind()
+void UndoCommand::unwind(size_t keepCount)
 {
-    while (!childList.empty()) {
+    while (childList.size() > keepCount) {
         UndoCommand* c = mu::takeLast(childList);
         LOG_UNDO() << "unwind: " << c->name();
         c->undo(0);
@@ -324,6 +358,7 @@ void UndoStack::beginMacro(Score* score)
         return;
     }
     curCmd = new UndoMacro(score);
+    resetPropertyRun();
 }
 
 //---------------------------------------------------------
@@ -352,6 +387,56 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
 #endif
     curCmd->appendChild(cmd);
     cmd->redo(ed);
+
+    if (coalesce(cmd)) {
+        curCmd->removeChild();
+        delete cmd;
+    }
+}
+
+//---------------------------------------------------------
+//   coalesce
+//    A property change following a change of the same
+//    property of the same object within one run of
+//    property changes of a macro is redundant: the earlier
+//    command holds the original value and flip() swaps in
+//    whatever the object holds at undo time, so redo still
+//    gets the latest value. Any other command ends the run,
+//    since it may depend on the intermediate value.
+//---------------------------------------------------------
+
+bool UndoStack::coalesce(UndoCommand* cmd)
+{
+    if (strcmp(cmd->name(), "ChangeProperty") != 0) {
+        resetPropertyRun();
+        return false;
+    }
+
+    const std::list<UndoCommand*>& commands = curCmd->commands();
+    if (commands.empty() || commands.back() != cmd) {
+        resetPropertyRun();
+        return false;
+    }
+
+    // the run is only valid while nothing else was appended to or removed from the macro
+    const UndoCommand* prev = commands.size() > 1 ? *std::prev(commands.end(), 2) : nullptr;
+    if (!prev || prev != m_propertyRunLast) {
+        m_propertyRun.clear();
+    }
+
+    const ChangeProperty* change = static_cast<const ChangeProperty*>(cmd);
+    if (!m_propertyRun.emplace(change->getElement(), change->getId()).second) {
+        return true;
+    }
+
+    m_propertyRunLast = cmd;
+    return false;
+}
+
+void UndoStack::resetPropertyRun()
+{
+    m_propertyRun.clear();
+    m_propertyRunLast = nullptr;
 }
 
 //---------------------------------------------------------
@@ -400,6 +485,9 @@ void UndoStack::remove(size_t idx)
 
 void UndoStack::mergeCommands(size_t startIdx)
 {
+    // the index was taken from getCurIdx()
+    startIdx = startIdx > m_droppedCount ? startIdx - m_droppedCount : 0;
+
     assert(startIdx <= curIdx);
 
     if (startIdx >= list.size()) {
@@ -427,6 +515,7 @@ void UndoStack::pop()
         return;
     }
     UndoCommand* cmd = curCmd->removeChild();
+    resetPropertyRun();
     cmd->undo(0);
 }
 
@@ -454,11 +543,65 @@ void UndoStack::endMacro(bool rollback)
             cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
             delete cmd;
         }
+        curCmd->updateMemoryUsage();
         list.push_back(curCmd);
         stateList.push_back(nextState++);
         ++curIdx;
     }
     curCmd = 0;
+    resetPropertyRun();
+
+    if (!rollback) {
+        enforceMemoryBudget();
+    }
+}
+
+//---------------------------------------------------------
+//   setMemoryBudget
+//---------------------------------------------------------
+
+void UndoStack::setMemoryBudget(size_t bytes)
+{
+    m_memoryBudget = bytes;
+    enforceMemoryBudget();
+}
+
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t UndoStack::memoryUsage() const
+{
+    size_t size = 0;
+    for (const UndoMacro* macro : list) {
+        size += macro->cachedMemoryUsage();
+    }
+    return size;
+}
+
+//---------------------------------------------------------
+//   enforceMemoryBudget
+//    drop the oldest applied macros until the stack fits
+//    into the budget; the last one is always kept
+//---------------------------------------------------------
+
+void UndoStack::enforceMemoryBudget()
+{
+    if (!m_memoryBudget || curCmd) {
+        return;
+    }
+
+    size_t size = memoryUsage();
+    while (size > m_memoryBudget && curIdx > 1) {
+        UndoMacro* macro = mu::takeFirst(list);
+        stateList.erase(stateList.begin());
+        --curIdx;
+        ++m_droppedCount;
+
+        size -= macro->cachedMemoryUsage();
+        macro->cleanup(true);
+        delete macro;
+    }
 }
 
 //---------------------------------------------------------
@@ -476,6 +619,7 @@ void UndoStack::reopen()
     assert(curIdx > 0);
     --curIdx;
     curCmd = mu::takeAt(list, curIdx);
+    resetPropertyRun();
     stateList.erase(stateList.begin() + curIdx);
     for (auto i : curCmd->commands()) {
         LOG_UNDO() << "   " << i->name();
@@ -492,7 +636,7 @@ void UndoStack::undo(EditData* ed)
     // Are we currently editing text?
     if (ed && ed->element && ed->element->isTextBase()) {
         TextEditData* ted = static_cast<TextEditData*>(ed->getData(ed->element).get());
-        if (ted && ted->startUndoIdx == curIdx) {
+        if (ted && ted->startUndoIdx == getCurIdx()) {
             // No edits to undo, so do nothing
             return;
         }
@@ -992,6 +1136,11 @@ void RemoveElement::cleanup(bool undo)
     }
 }
 
+size_t RemoveElement::memoryUsage() const
+{
+    return UndoCommand::memoryUsage() + estimatedItemMemory(element);
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -2000,6 +2149,22 @@ std::vector<Clef*> InsertRemoveMeasures::getCourtesyClefs(Measure* m)
     return startClefs;
 }
 
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t InsertRemoveMeasures::memoryUsage() const
+{
+    size_t size = UndoCommand::memoryUsage();
+    for (const MeasureBase* m = fm; m; m = m->next()) {
+        size += estimatedItemMemory(m);
+        if (m == lm) {
+            break;
+        }
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   insertMeasures
 //---------------------------------------------------------
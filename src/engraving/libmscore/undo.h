@@ -29,6 +29,7 @@
 */
 
 #include <map>
+#include <set>
 
 #include "modularity/ioc.h"
 #include "iengravingfontsprovider.h"
@@ -122,10 +123,13 @@ public:
     void appendChild(UndoCommand* cmd) { childList.push_back(cmd); }
     UndoCommand* removeChild() { return mu::takeLast(childList); }
     size_t childCount() const { return childList.size(); }
-    void unwind();
+    void unwind(size_t keepCount = 0);
     const std::list<UndoCommand*>& commands() const { return childList; }
     virtual std::vector<const EngravingObject*> objectItems() const { return {}; }
     virtual void cleanup(bool undo);
+    //! NOTE Rough estimate of the memory held by this command and its children,
+    //! including removed elements it keeps alive
+    virtual size_t memoryUsage() const;
 // #ifndef QT_NO_DEBUG
     virtual const char* name() const { return "UndoCommand"; }
 // #endif
@@ -177,11 +181,16 @@ public:
 
     ChangesInfo changesInfo() const;
 
+    void updateMemoryUsage() { m_memoryUsage = memoryUsage(); }
+    size_t cachedMemoryUsage() const { return m_memoryUsage; }
+
     static bool canRecordSelectedElement(const EngravingItem* e);
 
     UNDO_NAME("UndoMacro")
 
 private:
+    size_t m_memoryUsage = 0;
+
     InputState m_undoInputState;
     InputState m_redoInputState;
     SelectionInfo m_undoSelectionInfo;
@@ -203,7 +212,19 @@ class UndoStack
     size_t curIdx = 0;
     bool isLocked = false;
 
+    size_t m_memoryBudget = 0;
+    size_t m_droppedCount = 0;      // macros dropped from the front to stay within the budget
+
+    //! NOTE The properties changed by the trailing run of ChangeProperty commands of the current macro.
+    //! A change is propagated to all linked elements of the parts, so the changes of one element
+    //! are interleaved with the ones of its links and rarely follow each other directly
+    std::set<std::pair<const EngravingObject*, Pid> > m_propertyRun;
+    const UndoCommand* m_propertyRunLast = nullptr;
+
     void remove(size_t idx);
+    void enforceMemoryBudget();
+    bool coalesce(UndoCommand* cmd);
+    void resetPropertyRun();
 
 public:
     UndoStack();
@@ -220,7 +241,8 @@ public:
     bool canUndo() const { return curIdx > 0; }
     bool canRedo() const { return curIdx < list.size(); }
     bool isClean() const { return cleanState == stateList[curIdx]; }
-    size_t getCurIdx() const { return curIdx; }
+    //! NOTE The index counts dropped macros too, so it stays stable when the oldest macros are dropped
+    size_t getCurIdx() const { return curIdx + m_droppedCount; }
     UndoMacro* current() const { return curCmd; }
     UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
     UndoMacro* prev() const { return curIdx > 1 ? list[curIdx - 2] : 0; }
@@ -230,6 +252,12 @@ public:
 
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    //! NOTE When the applied macros hold more than this many bytes,
+    //! the oldest ones are dropped. 0 means no limit.
+    void setMemoryBudget(size_t bytes);
+    size_t memoryBudget() const { return m_memoryBudget; }
+    size_t memoryUsage() const;
 };
 
 class InsertPart : public UndoCommand
@@ -649,6 +677,7 @@ public:
     void undo(EditData*) override;
     void redo(EditData*) override;
     void cleanup(bool) override;
+    size_t memoryUsage() const override;
     const char* name() const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
@@ -892,6 +921,7 @@ public:
         : fm(_fm), lm(_lm) {}
     virtual void undo(EditData*) override = 0;
     virtual void redo(EditData*) override = 0;
+    size_t memoryUsage() const override;
     UNDO_CHANGED_OBJECTS({ fm, lm })
 };
 
@@ -178,4 +178,26 @@ MasterScore* MasterScore::unrollRepeats()
 
     return score;
 }
+
+//---------------------------------------------------------
+//   forEachUnrolledMeasure
+//    calls func for the measures of the score in the
+//    unrolled order, with their tick in the unrolled
+//    score, until func returns false.
+//    Unlike unrollRepeats() this doesn't copy the score,
+//    so it suits the consumers that only read the measures
+//---------------------------------------------------------
+
+void MasterScore::forEachUnrolledMeasure(const std::function<bool(const Measure* measure, int utick)>& func)
+{
+    setExpandRepeats(true);
+
+    for (const RepeatSegment* rs : repeatList()) {
+        for (const Measure* m : rs->measureList()) {
+            if (!func(m, rs->utick + m->tick().ticks() - rs->tick)) {
+                return;
+            }
+        }
+    }
+}
 }
@@ -70,18 +70,12 @@ Measure* Score::tick2measure(const Fraction& tick) const
         return firstMeasure();
     }
 
-    Measure* lm = 0;
-    for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
-        if (tick < m->tick()) {
-            assert(lm);
-            return lm;
-        }
-        lm = m;
-    }
-    // check last measure
-    if (lm && (tick >= lm->tick()) && (tick <= lm->endTick())) {
-        return lm;
+    Measure* m = _measures.measureAt(tick);
+    // the following measure starts after tick, so only the last measure needs a range check
+    if (m && (m->nextMeasure() || tick <= m->endTick())) {
+        return m;
     }
+    Measure* lm = lastMeasure();
     LOGD("tick2measure %d (max %d) not found", tick.ticks(), lm ? lm->tick().ticks() : -1);
     return 0;
 }
@@ -100,6 +94,17 @@ Measure* Score::tick2measureMM(const Fraction& t) const
         tick = Fraction(0, 1);
     }
 
+    // A measure that is neither covered by a multimeasure rest nor starts one
+    // is also the answer in the multimeasure rest sequence.
+    // Measures covered by a multimeasure rest have mmRestCount -1, fall back to the walk for them.
+    Measure* m = _measures.measureAt(tick);
+    if (m && (!styleB(Sid::createMultiMeasureRests) || m->mmRestCount() >= 0)) {
+        Measure* mm = (styleB(Sid::createMultiMeasureRests) && m->hasMMRest()) ? m->mmRest() : m;
+        if (mm->nextMeasureMM() || tick <= mm->endTick()) {
+            return mm;
+        }
+    }
+
     Measure* lm = 0;
 
     for (Measure* m = firstMeasureMM(); m; m = m->nextMeasureMM()) {
@@ -123,12 +128,10 @@ Measure* Score::tick2measureMM(const Fraction& t) const
 
 MeasureBase* Score::tick2measureBase(const Fraction& tick) const
 {
-    for (MeasureBase* mb = first(); mb; mb = mb->next()) {
-        Fraction st = mb->tick();
-        Fraction l  = mb->ticks();
-        if (tick >= st && tick < (st + l)) {
-            return mb;
-        }
+    // frames have no length, so only a measure can contain tick
+    Measure* m = _measures.measureAt(tick);
+    if (m && tick < m->endTick()) {
+        return m;
     }
 //      LOGD("tick2measureBase %d not found", tick);
     return 0;
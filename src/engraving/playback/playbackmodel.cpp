@@ -32,6 +32,9 @@
 #include "libmscore/tempo.h"
 #include "libmscore/measurerepeat.h"
 
+#include "async/async.h"
+#include "concurrency/taskscheduler.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -44,6 +47,8 @@ static const std::string CHORD_SYMBOLS_INSTRUMENT_ID("chord_symbols");
 
 const InstrumentTrackId PlaybackModel::METRONOME_TRACK_ID = { 999, METRONOME_INSTRUMENT_ID };
 
+static constexpr int LOADING_RANGE_MEASURE_COUNT = 16;
+
 static const Harmony* findChordSymbol(const EngravingItem* item)
 {
     if (item->isHarmony()) {
@@ -55,13 +60,16 @@ static const Harmony* findChordSymbol(const EngravingItem* item)
     return nullptr;
 }
 
-void PlaybackModel::load(Score* score)
+void PlaybackModel::load(Score* score, bool progressively)
 {
+    TRACEFUNC;
+
     if (!score || score->measures()->empty() || !score->lastMeasure()) {
         return;
     }
 
     m_score = score;
+    m_rangesToLoad.clear();
 
     auto changesChannel = score->changesChannel();
     changesChannel.resetOnReceive(this);
@@ -70,6 +78,18 @@ void PlaybackModel::load(Score* score)
         TickBoundaries tickRange = tickBoundaries(range);
         TrackBoundaries trackRange = trackBoundaries(range);
 
+        //! NOTE The measures of the score have been moved while it was still loading,
+        //!      so the ranges which are left to load don't match them anymore
+        if (!m_rangesToLoad.empty() && m_score->lastMeasure()
+            && m_score->lastMeasure()->endTick().ticks() != m_rangesToLoadEndTick) {
+            m_rangesToLoad.clear();
+
+            tickRange.tickFrom = 0;
+            tickRange.tickTo = m_score->lastMeasure()->endTick().ticks();
+            trackRange.trackFrom = 0;
+            trackRange.trackTo = m_score->ntracks();
+        }
+
         clearExpiredTracks();
         clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo);
@@ -86,23 +106,114 @@ void PlaybackModel::load(Score* score)
         reload();
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    if (progressively) {
+        m_rangesToLoad = rangesToLoad();
+        m_rangesToLoadEndTick = m_score->lastMeasure()->endTick().ticks();
+
+        TickBoundaries firstRange = m_rangesToLoad.front();
+        m_rangesToLoad.pop_front();
+
+        update(firstRange.tickFrom, firstRange.tickTo, 0, m_score->ntracks());
+    } else {
+        update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    }
 
     for (const auto& pair : m_playbackDataMap) {
         m_trackAdded.send(pair.first);
     }
 
     m_dataChanged.notify();
+
+    if (!m_rangesToLoad.empty()) {
+        Async::call(this, [this]() {
+            loadNextRange();
+        });
+    }
+}
+
+void PlaybackModel::loadNextRange()
+{
+    TRACEFUNC;
+
+    if (!m_score || m_rangesToLoad.empty()) {
+        return;
+    }
+
+    TickBoundaries range = m_rangesToLoad.front();
+    m_rangesToLoad.pop_front();
+
+    track_idx_t trackTo = m_score->ntracks();
+
+    //! NOTE The range might have been already rendered partially, if it was edited during the loading
+    clearExpiredEvents(range.tickFrom, range.tickTo, 0, trackTo);
+
+    InstrumentTrackIdSet oldTracks = existingTrackIdSet();
+
+    ChangedTrackIdSet trackChanges;
+    updateEvents(range.tickFrom, range.tickTo, 0, trackTo, &trackChanges);
+
+    notifyAboutChanges(oldTracks, trackChanges);
+
+    if (!m_rangesToLoad.empty()) {
+        Async::call(this, [this]() {
+            loadNextRange();
+        });
+    }
+}
+
+std::list<PlaybackModel::TickBoundaries> PlaybackModel::rangesToLoad() const
+{
+    std::list<TickBoundaries> result;
+
+    auto appendRanges = [&result](const Measure* from, const Measure* to) {
+        TickBoundaries range;
+        int measureCount = 0;
+
+        for (const Measure* measure = from; measure && measure != to; measure = measure->nextMeasure()) {
+            if (measureCount == 0) {
+                range.tickFrom = measure->tick().ticks();
+            }
+
+            //! NOTE The segments starting right at the end of the range belong to the next one
+            range.tickTo = measure->endTick().ticks() - 1;
+
+            if (++measureCount == LOADING_RANGE_MEASURE_COUNT) {
+                result.push_back(range);
+                measureCount = 0;
+            }
+        }
+
+        if (measureCount > 0) {
+            result.push_back(range);
+        }
+    };
+
+    const Measure* firstMeasure = m_score->firstMeasure();
+    const Measure* playbackMeasure = m_score->tick2measure(m_score->playPos());
+
+    if (!playbackMeasure) {
+        playbackMeasure = firstMeasure;
+    }
+
+    //! NOTE Start from the playback position, so that the playback is able to start as soon as possible
+    appendRanges(playbackMeasure, nullptr);
+    appendRanges(firstMeasure, playbackMeasure);
+
+    return result;
 }
 
 void PlaybackModel::reload()
 {
+    TRACEFUNC;
+
     int trackFrom = 0;
     size_t trackTo = m_score->ntracks();
 
     int tickFrom = 0;
     int tickTo = m_score->lastMeasure()->endTick().ticks();
 
+    m_rangesToLoad.clear();
+
     clearExpiredTracks();
     clearExpiredContexts(trackFrom, trackTo);
 
@@ -110,10 +221,12 @@ void PlaybackModel::reload()
         pair.second.originEvents.clear();
     }
 
+    m_eventsDeltas.clear();
+
     update(tickFrom, tickTo, trackFrom, trackTo);
 
     for (auto& pair : m_playbackDataMap) {
-        pair.second.mainStream.send(pair.second.originEvents);
+        pair.second.mainStream.send(PlaybackEventsDelta::reset(pair.second.originEvents));
     }
 
     m_dataChanged.notify();
@@ -186,6 +299,8 @@ const PlaybackData& PlaybackModel::resolveTrackPlaybackData(const ID& partId, co
 
 void PlaybackModel::triggerEventsForItems(const std::vector<const EngravingItem*>& items)
 {
+    TRACEFUNC;
+
     std::vector<const EngravingItem*> playableItems = filterPlaybleItems(items);
     if (playableItems.empty()) {
         return;
@@ -348,7 +463,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
 
         if (chordSymbol->play()) {
             m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile,
-                                         m_playbackDataMap[trackId].originEvents);
+                                         m_playbackDataMap.at(trackId).originEvents);
         }
 
         collectChangesTracks(trackId, trackChanges);
@@ -389,17 +504,17 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
             }
         }
 
-        const PlaybackContext& ctx = m_playbackCtxMap[trackId];
-
         ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
         if (!profile) {
             LOGE() << "unsupported instrument family: " << item->part()->id();
             continue;
         }
 
+        const PlaybackContext& ctx = m_playbackCtxMap.at(trackId);
+
         m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
                           ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
-                          m_playbackDataMap[trackId].originEvents);
+                          m_playbackDataMap.at(trackId).originEvents);
 
         collectChangesTracks(trackId, trackChanges);
     }
@@ -410,25 +525,31 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
 {
     TRACEFUNC;
 
-    std::set<staff_idx_t> changedStaffIdSet = m_score->staffIdsFromRange(trackFrom, trackTo);
+    struct PartRenderingTask {
+        std::set<staff_idx_t> staffIdSet;
+        ChangedTrackIdSet trackChanges;
+    };
 
-    for (const RepeatSegment* repeatSegment : repeatList()) {
-        int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
-        int repeatStartTick = repeatSegment->tick;
-        int repeatEndTick = repeatStartTick + repeatSegment->len();
+    //! NOTE Every part is rendered into its own tracks only, so the parts can be rendered in parallel
+    std::vector<PartRenderingTask> tasks;
 
-        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
+    for (const Part* part : m_score->parts()) {
+        if (trackTo < part->startTrack() || trackFrom >= part->endTrack()) {
             continue;
         }
 
-        for (const Measure* measure : repeatSegment->measureList()) {
-            int measureStartTick = measure->tick().ticks();
-            int measureEndTick = measure->endTick().ticks();
+        PartRenderingTask task;
+        task.staffIdSet = part->staveIdxList();
+        tasks.push_back(std::move(task));
+    }
 
-            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
-                continue;
-            }
+    prepareParallelRendering();
 
+    auto renderPart = [this, tickFrom, tickTo, trackChanges, &tasks](size_t taskIdx) {
+        PartRenderingTask& task = tasks[taskIdx];
+        ChangedTrackIdSet* taskTrackChanges = trackChanges ? &task.trackChanges : nullptr;
+
+        visitMeasures(tickFrom, tickTo, [&](const Measure* measure, const int tickPositionOffset) {
             for (Segment* segment = measure->first(); segment; segment = segment->next()) {
                 if (!segment->isChordRestType()) {
                     continue;
@@ -441,16 +562,65 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                     continue;
                 }
 
-                processSegment(tickPositionOffset, segment, changedStaffIdSet, trackChanges);
+                processSegment(tickPositionOffset, segment, task.staffIdSet, taskTrackChanges);
+            }
+        });
+    };
+
+    TaskScheduler::instance()->parallelFor(size_t(0), tasks.size(), renderPart);
+
+    if (trackChanges) {
+        for (const PartRenderingTask& task : tasks) {
+            trackChanges->insert(task.trackChanges.cbegin(), task.trackChanges.cend());
+        }
+    }
+
+    PlaybackEventsMap& metronomeEvents = m_playbackDataMap[METRONOME_TRACK_ID].originEvents;
+
+    visitMeasures(tickFrom, tickTo, [&](const Measure* measure, const int tickPositionOffset) {
+        m_renderer.renderMetronome(m_score, measure->tick().ticks(), measure->endTick().ticks(), tickPositionOffset, metronomeEvents);
+        collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
+    });
+}
+
+void PlaybackModel::visitMeasures(const int tickFrom, const int tickTo,
+                                  const std::function<void(const Measure*, const int tickPositionOffset)>& visitor) const
+{
+    for (const RepeatSegment* repeatSegment : repeatList()) {
+        int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
+        int repeatStartTick = repeatSegment->tick;
+        int repeatEndTick = repeatStartTick + repeatSegment->len();
+
+        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
+            continue;
+        }
+
+        for (const Measure* measure : repeatSegment->measureList()) {
+            int measureStartTick = measure->tick().ticks();
+            int measureEndTick = measure->endTick().ticks();
+
+            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
+                continue;
             }
 
-            m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
-                                       m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
-            collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
+            visitor(measure, tickPositionOffset);
         }
     }
 }
 
+void PlaybackModel::prepareParallelRendering()
+{
+    //! NOTE The rendering of the parts mustn't modify the shared data, so everything which is
+    //!      created or cached on the first access is touched here, before the rendering starts
+    repeatList();
+    m_score->tick2measure(Fraction(0, 1));
+
+    for (const auto& pair : m_playbackDataMap) {
+        m_playbackCtxMap[pair.first];
+        defaultActiculationProfile(pair.first);
+    }
+}
+
 bool PlaybackModel::hasToReloadTracks(const ScoreChangesRange& changesRange) const
 {
     static const std::unordered_set<ElementType> REQUIRED_TYPES = {
@@ -641,10 +811,28 @@ void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, co
             continue;
         }
 
-        search->second.mainStream.send(search->second.originEvents);
+        search->second.mainStream.send(takeEventsDelta(trackId));
         search->second.dynamicLevelChanges.send(search->second.dynamicLevelMap);
     }
 
+    //! NOTE The tracks whose events have only been removed
+    InstrumentTrackIdSet tracksWithRemovedEvents;
+    for (const auto& pair : m_eventsDeltas) {
+        if (pair.second.isReset || !pair.second.removedRanges.empty()) {
+            tracksWithRemovedEvents.insert(pair.first);
+        }
+    }
+
+    for (const InstrumentTrackId& trackId : tracksWithRemovedEvents) {
+        auto search = m_playbackDataMap.find(trackId);
+
+        if (search != m_playbackDataMap.cend()) {
+            search->second.mainStream.send(takeEventsDelta(trackId));
+        }
+    }
+
+    m_eventsDeltas.clear();
+
     for (auto it = m_playbackDataMap.cbegin(); it != m_playbackDataMap.cend(); ++it) {
         if (!mu::contains(oldTracks, it->first)) {
             m_trackAdded.send(it->first);
@@ -656,6 +844,29 @@ void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, co
     }
 }
 
+PlaybackEventsDelta PlaybackModel::takeEventsDelta(const InstrumentTrackId& trackId)
+{
+    const PlaybackEventsMap& events = m_playbackDataMap.at(trackId).originEvents;
+
+    auto search = m_eventsDeltas.find(trackId);
+    if (search == m_eventsDeltas.end() || search->second.isReset) {
+        if (search != m_eventsDeltas.end()) {
+            m_eventsDeltas.erase(search);
+        }
+
+        return PlaybackEventsDelta::reset(events);
+    }
+
+    PlaybackEventsDelta result = std::move(search->second);
+    m_eventsDeltas.erase(search);
+
+    for (const PlaybackEventsDelta::Range& range : result.removedRanges) {
+        result.insertedEvents.insert(events.lower_bound(range.from), events.upper_bound(range.to));
+    }
+
+    return result;
+}
+
 void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mpe::timestamp_t timestampFrom,
                                       const mpe::timestamp_t timestampTo)
 {
@@ -666,13 +877,17 @@ void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mp
     }
 
     PlaybackData& trackPlaybackData = search->second;
+    PlaybackEventsDelta& delta = m_eventsDeltas[trackId];
 
     if (timestampFrom == -1 && timestampTo == -1) {
         search->second.originEvents.clear();
+        delta.isReset = true;
         return;
     }
 
     PlaybackEventsMap::const_iterator lowerBound;
+    PlaybackEventsDelta::Range removedRange;
+    removedRange.to = timestampTo;
 
     if (timestampFrom == 0) {
         //!Note Some events might be started RIGHT before the "official" start of the track
@@ -680,8 +895,11 @@ void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mp
         lowerBound = trackPlaybackData.originEvents.begin();
     } else {
         lowerBound = trackPlaybackData.originEvents.lower_bound(timestampFrom);
+        removedRange.from = timestampFrom;
     }
 
+    delta.removedRanges.push_back(removedRange);
+
     auto upperBound = trackPlaybackData.originEvents.upper_bound(timestampTo);
 
     for (auto it = lowerBound; it != upperBound;) {
@@ -25,6 +25,7 @@
 
 #include <unordered_map>
 #include <map>
+#include <list>
 #include <functional>
 
 #include "async/asyncable.h"
@@ -45,6 +46,7 @@ class Score;
 class Note;
 class EngravingItem;
 class Segment;
+class Measure;
 class Instrument;
 class RepeatList;
 
@@ -53,7 +55,10 @@ class PlaybackModel : public async::Asyncable
     INJECT(engraving, mpe::IArticulationProfilesRepository, profilesRepository)
 
 public:
-    void load(Score* score);
+    //! NOTE If the score is loaded progressively, all the tracks become available right away
+    //!      with the events around the playback position only, the rest of the score is rendered
+    //!      in small ranges between the iterations of the event loop and is sent as the events changes
+    void load(Score* score, bool progressively = false);
     void reload();
 
     async::Notification dataChanged() const;
@@ -100,6 +105,9 @@ private:
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const std::string& instrumentId) const;
 
+    void loadNextRange();
+    std::list<TickBoundaries> rangesToLoad() const;
+
     void update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                 ChangedTrackIdSet* trackChanges = nullptr);
     void updateSetupData();
@@ -108,6 +116,10 @@ private:
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
 
+    void visitMeasures(const int tickFrom, const int tickTo,
+                       const std::function<void(const Measure*, const int tickPositionOffset)>& visitor) const;
+    void prepareParallelRendering();
+
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& changedStaffIdSet,
                         ChangedTrackIdSet* trackChanges);
 
@@ -120,6 +132,7 @@ private:
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo);
     void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
     void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks);
+    mpe::PlaybackEventsDelta takeEventsDelta(const InstrumentTrackId& trackId);
 
     void removeEventsFromRange(const track_idx_t trackFrom, const track_idx_t trackTo, const mpe::timestamp_t timestampFrom = -1,
                                const mpe::timestamp_t timestampTo = -1);
@@ -145,6 +158,13 @@ private:
     std::unordered_map<InstrumentTrackId, PlaybackContext> m_playbackCtxMap;
     std::unordered_map<InstrumentTrackId, mpe::PlaybackData> m_playbackDataMap;
 
+    //! NOTE The ranges of the events removed since the last notification about the changes
+    std::unordered_map<InstrumentTrackId, mpe::PlaybackEventsDelta> m_eventsDeltas;
+
+    //! NOTE The measure aligned ranges of the score which haven't been rendered yet
+    std::list<TickBoundaries> m_rangesToLoad;
+    int m_rangesToLoadEndTick = 0;
+
     async::Notification m_dataChanged;
     async::Channel<InstrumentTrackId> m_trackAdded;
     async::Channel<InstrumentTrackId> m_trackRemoved;
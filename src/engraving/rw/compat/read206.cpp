@@ -3435,9 +3435,12 @@ Err Read206::read206(mu::engraving::MasterScore* masterScore, XmlReader& e, Read
 
     // fix positions
     //    offset = saved offset - layout position
-    masterScore->doLayout();
-    for (auto i : ctx.fixOffsets()) {
-        i.first->setOffset(i.second - i.first->pos());
+    //    the score is laid out again after reading, so only do it here if there is something to fix
+    if (!ctx.fixOffsets().empty()) {
+        masterScore->doLayout();
+        for (auto i : ctx.fixOffsets()) {
+            i.first->setOffset(i.second - i.first->pos());
+        }
     }
 
     return Err::NoError;
@@ -40,10 +40,19 @@ static int readStyleDefaultsVersion(MasterScore* score, const ByteArray& scoreDa
     XmlReader e(scoreData);
     e.setDocName(completeBaseName);
 
+    //! NOTE defaultsVersion can only be a value of the score style, which is written before the parts,
+    //! so stop at the end of the first style or at the first part instead of scanning the whole file
     while (!e.atEnd()) {
-        e.readNext();
-        if (e.name() == "defaultsVersion") {
-            return e.readInt();
+        XmlStreamReader::TokenType token = e.readNext();
+        if (token == XmlStreamReader::StartElement) {
+            if (e.name() == "defaultsVersion") {
+                return e.readInt();
+            }
+            if (e.name() == "Part") {
+                break;
+            }
+        } else if (token == XmlStreamReader::EndElement && e.name() == "Style") {
+            break;
         }
     }
 
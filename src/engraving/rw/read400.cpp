@@ -74,6 +74,8 @@ bool Read400::read400(Score* score, XmlReader& e, ReadContext& ctx)
 
 bool Read400::readScore400(Score* score, XmlReader& e, ReadContext& ctx)
 {
+    TRACEFUNC;
+
     std::vector<int> sysStaves;
     while (e.readNextStartElement()) {
         e.context()->setTrack(mu::nidx);
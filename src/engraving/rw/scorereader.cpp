@@ -100,9 +100,13 @@ Err ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscReader,
     }
 
     // Read excerpts
+    //! NOTE The excerpt files are extracted from the container concurrently,
+    //! but building the part scores stays serial: it creates and links elements
+    //! of the master score, which is not thread-safe
     if (masterScore->mscVersion() >= 400) {
-        std::vector<String> excerptNames = mscReader.excerptNames();
-        for (const String& excerptName : excerptNames) {
+        std::vector<MscReader::ExcerptFiles> excerptFiles = mscReader.readExcerptFiles(mscReader.excerptNames());
+        for (MscReader::ExcerptFiles& files : excerptFiles) {
+            const String& excerptName = files.name;
             Score* partScore = masterScore->createScore();
 
             compat::ReadStyleHook::setupDefaultStyle(partScore);
@@ -110,12 +114,11 @@ Err ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscReader,
             Excerpt* ex = new Excerpt(masterScore);
             ex->setExcerptScore(partScore);
 
-            ByteArray excerptStyleData = mscReader.readExcerptStyleFile(excerptName);
-            Buffer excerptStyleBuf(&excerptStyleData);
+            Buffer excerptStyleBuf(&files.styleData);
             excerptStyleBuf.open(IODevice::ReadOnly);
             partScore->style().read(&excerptStyleBuf);
 
-            ByteArray excerptData = mscReader.readExcerptFile(excerptName);
+            ByteArray excerptData = std::move(files.scoreData);
 
             ReadContext ctx(partScore);
             ctx.initLinks(masterScoreCtx);
@@ -148,6 +151,8 @@ Err ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscReader,
 
 Err ScoreReader::read(MasterScore* score, XmlReader& e, ReadContext& ctx, compat::ReadStyleHook* styleHook)
 {
+    TRACEFUNC;
+
     while (e.readNextStartElement()) {
         if (e.name() == "museScore") {
             const String& version = e.attribute("version");
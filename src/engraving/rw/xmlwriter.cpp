@@ -22,6 +22,8 @@
 
 #include "xmlwriter.h"
 
+#include <charconv>
+
 #include "types/typesconv.h"
 #include "rw/writecontext.h"
 #include "libmscore/engravingitem.h"
@@ -309,7 +311,14 @@ void XmlWriter::tagFraction(const AsciiStringView& name, const Fraction& v, cons
         return;
     }
 
-    element(name, v.toString());
+    //! NOTE Same as v.toString(), but without temporary strings
+    char buf[32];
+    char* end = buf + sizeof(buf);
+    char* p = std::to_chars(buf, end, v.numerator()).ptr;
+    *p++ = '/';
+    p = std::to_chars(p, end, v.denominator()).ptr;
+
+    element(name, AsciiStringView(buf, p - buf));
 }
 
 void XmlWriter::writeXml(const String& name, String s)
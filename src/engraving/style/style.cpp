@@ -22,6 +22,8 @@
 
 #include "style.h"
 
+#include <atomic>
+
 #include "compat/pageformat.h"
 #include "rw/compat/readchordlisthook.h"
 #include "rw/xml.h"
@@ -37,6 +39,12 @@ using namespace mu;
 using namespace mu::io;
 using namespace mu::engraving;
 
+static uint64_t nextRevision()
+{
+    static std::atomic<uint64_t> counter = 0;
+    return ++counter;
+}
+
 const PropertyValue& MStyle::value(Sid idx) const
 {
     if (idx == Sid::NOSTYLE) {
@@ -69,23 +77,42 @@ void MStyle::set(const Sid t, const PropertyValue& val)
 
     const size_t idx = size_t(t);
     m_values[idx] = val;
+    m_revision = nextRevision();
     if (t == Sid::spatium) {
         precomputeValues();
     } else {
-        if (StyleDef::styleValues[idx].valueType() == P_TYPE::SPATIUM) {
-            double _spatium = value(Sid::spatium).toReal();
-            m_precomputedValues[idx] = m_values[idx].value<Spatium>().val() * _spatium;
-        }
+        precomputeValue(StyleDef::styleValues[idx], m_precomputedReals[size_t(Sid::spatium)]);
     }
 }
 
 void MStyle::precomputeValues()
 {
+    m_revision = nextRevision();
     double _spatium = value(Sid::spatium).toReal();
     for (const StyleDef::StyleValue& t : StyleDef::styleValues) {
-        if (t.valueType() == P_TYPE::SPATIUM) {
-            m_precomputedValues[t.idx()] = value(t.styleIdx()).value<Spatium>().val() * _spatium;
-        }
+        precomputeValue(t, _spatium);
+    }
+}
+
+void MStyle::precomputeValue(const StyleDef::StyleValue& t, double spatium)
+{
+    const PropertyValue& val = value(t.styleIdx());
+
+    // the same conversions as styleD() / styleB() did on the PropertyValue
+    switch (t.valueType()) {
+    case P_TYPE::SPATIUM:
+        m_precomputedValues[t.idx()] = val.value<Spatium>().val() * spatium;
+        m_precomputedReals[t.idx()] = val.value<Spatium>().val();
+        break;
+    case P_TYPE::REAL:
+        m_precomputedReals[t.idx()] = val.toReal();
+        break;
+    case P_TYPE::BOOL:
+    case P_TYPE::INT:
+        m_precomputedBools[t.idx()] = val.toBool();
+        break;
+    default:
+        break;
     }
 }
 
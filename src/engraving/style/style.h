@@ -24,7 +24,9 @@
 #define MU_ENGRAVING_STYLE_H
 
 #include <array>
+#include <bitset>
 #include <cassert>
+#include <cstdint>
 
 #include "io/iodevice.h"
 
@@ -47,19 +49,29 @@ class XmlWriter;
 class MStyle
 {
 public:
-    MStyle() = default;
+    MStyle() { precomputeValues(); }
 
     const PropertyValue& styleV(Sid idx) const { return value(idx); }
     Spatium styleS(Sid idx) const
     {
         assert(MStyle::valueType(idx) == P_TYPE::SPATIUM);
-        return value(idx).value<Spatium>();
+        return idx != Sid::NOSTYLE ? Spatium(m_precomputedReals[size_t(idx)]) : Spatium();
     }
 
     Millimetre styleMM(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::SPATIUM); return valueMM(idx); }
     String  styleSt(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::STRING); return value(idx).value<String>(); }
-    bool     styleB(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::BOOL); return value(idx).toBool(); }
-    double   styleD(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::REAL); return value(idx).toReal(); }
+    bool styleB(Sid idx) const
+    {
+        assert(MStyle::valueType(idx) == P_TYPE::BOOL);
+        return idx != Sid::NOSTYLE && m_precomputedBools[size_t(idx)];
+    }
+
+    double styleD(Sid idx) const
+    {
+        assert(MStyle::valueType(idx) == P_TYPE::REAL);
+        return idx != Sid::NOSTYLE ? m_precomputedReals[size_t(idx)] : 0.0;
+    }
+
     int      styleI(Sid idx) const { /* can be int or enum, so no assert */ return value(idx).toInt(); }
 
     const PropertyValue& value(Sid idx) const;
@@ -78,6 +90,10 @@ public:
 
     void precomputeValues();
 
+    //! NOTE Changes every time a value is set; equal revisions imply equal values,
+    //! so it can be used as a cheap key for anything derived from the style
+    uint64_t revision() const { return m_revision; }
+
     static P_TYPE valueType(const Sid);
     static const char* valueName(const Sid);
     static Sid styleIdx(const String& name);
@@ -93,7 +109,14 @@ private:
     bool readTextStyleValCompat(XmlReader&);
 
     std::array<PropertyValue, size_t(Sid::STYLES)> m_values;
-    std::array<Millimetre, size_t(Sid::STYLES)> m_precomputedValues;
+    void precomputeValue(const StyleDef::StyleValue& t, double spatium);
+
+    //! NOTE Layout reads these style values very often, keep them as plain values
+    //! to avoid the PropertyValue conversion
+    std::array<Millimetre, size_t(Sid::STYLES)> m_precomputedValues {};     // SPATIUM values in mm
+    std::array<double, size_t(Sid::STYLES)> m_precomputedReals {};          // REAL and SPATIUM values
+    std::bitset<size_t(Sid::STYLES)> m_precomputedBools;                    // BOOL and INT values
+    uint64_t m_revision = 0;
 };
 } // namespace mu::engraving
 
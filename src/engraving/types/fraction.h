@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_FRACTION_H
 #define MU_ENGRAVING_FRACTION_H
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <numeric>
@@ -34,12 +35,46 @@
 // everything contained in .h file for performance reasons
 
 namespace mu::engraving {
+namespace detail {
+// gcd(ticks, ticks per whole note) only depends on ticks modulo the ticks per whole note
+constexpr int TICKS_PER_WHOLE = Constants::division * 4;
+
+constexpr std::array<int, TICKS_PER_WHOLE> makeTicksGcdTable()
+{
+    std::array<int, TICKS_PER_WHOLE> table {};
+    for (int i = 0; i < TICKS_PER_WHOLE; ++i) {
+        table[i] = std::gcd(i, TICKS_PER_WHOLE);
+    }
+    return table;
+}
+
+inline constexpr std::array<int, TICKS_PER_WHOLE> TICKS_GCD = makeTicksGcdTable();
+}
+
 class Fraction
 {
     // ensure 64 bit to avoid overflows in comparisons
     int64_t m_numerator = 0;
     int64_t m_denominator = 1;
 
+    static constexpr bool isPowerOfTwo(int64_t v) { return v > 0 && (v & (v - 1)) == 0; }
+
+    static constexpr bool fitsInt(int64_t v)
+    {
+        return v > std::numeric_limits<int32_t>::min() && v <= std::numeric_limits<int32_t>::max();
+    }
+
+    // Note values have power of two denominators, one of them divides the other, so it's the common denominator
+    void addPowerOfTwo(int64_t numerator, int64_t denominator)
+    {
+        if (m_denominator < denominator) {
+            m_numerator = m_numerator * (denominator / m_denominator) + numerator;
+            m_denominator = denominator;
+        } else {
+            m_numerator += numerator * (m_denominator / denominator);
+        }
+    }
+
 public:
     // no implicit conversion from int to Fraction:
     constexpr Fraction() = default;
@@ -102,6 +137,19 @@ public:
 
     void reduce()
     {
+        // The values are stored in 64 bit for the comparisons, but almost always fit in 32 bit,
+        // where gcd and the divisions are much cheaper
+        if (fitsInt(m_numerator) && fitsInt(m_denominator)) {
+            const int32_t numerator = static_cast<int32_t>(m_numerator);
+            const int32_t denominator = static_cast<int32_t>(m_denominator);
+            const int32_t g = std::gcd(numerator, denominator);
+            if (g > 1) {
+                m_numerator = numerator / g;
+                m_denominator = denominator / g;
+            }
+            return;
+        }
+
         const int64_t g = std::gcd(m_numerator, m_denominator);
         if (g) {
             m_numerator /= g;
@@ -111,11 +159,9 @@ public:
 
     Fraction reduced() const
     {
-        const int64_t g = std::gcd(m_numerator, m_denominator);
-        if (g) {
-            return Fraction(static_cast<int>(m_numerator / g), static_cast<int>(m_denominator / g));
-        }
-        return Fraction(m_numerator, m_denominator);
+        Fraction result(*this);
+        result.reduce();
+        return result;
     }
 
     // comparison
@@ -156,6 +202,8 @@ public:
     {
         if (m_denominator == val.m_denominator) {
             m_numerator += val.m_numerator;        // Common enough use case to be handled separately for efficiency
+        } else if (isPowerOfTwo(m_denominator) && isPowerOfTwo(val.m_denominator)) {
+            addPowerOfTwo(val.m_numerator, val.m_denominator);
         } else {
             const int64_t g = std::gcd(m_denominator, val.m_denominator);
             if (g) {
@@ -171,6 +219,8 @@ public:
     {
         if (m_denominator == val.m_denominator) {
             m_numerator -= val.m_numerator;       // Common enough use case to be handled separately for efficiency
+        } else if (isPowerOfTwo(m_denominator) && isPowerOfTwo(val.m_denominator)) {
+            addPowerOfTwo(-val.m_numerator, val.m_denominator);
         } else {
             const int64_t g = std::gcd(m_denominator, val.m_denominator);
             if (g) {
@@ -248,7 +298,11 @@ public:
         if (ticks == -1) {
             return Fraction(-1, 1);        // HACK
         }
-        return Fraction(ticks, Constants::division * 4).reduced();
+
+        // same as Fraction(ticks, Constants::division * 4).reduced(), but without computing gcd
+        const int64_t absTicks = ticks < 0 ? -static_cast<int64_t>(ticks) : ticks;
+        const int g = detail::TICKS_GCD[static_cast<size_t>(absTicks % detail::TICKS_PER_WHOLE)];
+        return Fraction(ticks / g, detail::TICKS_PER_WHOLE / g);
     }
 
     // A very small fraction, corresponds to 1 MIDI tick
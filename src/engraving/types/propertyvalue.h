@@ -23,9 +23,12 @@
 #define MU_ENGRAVING_PROPERTYVALUE_H
 
 #include <any>
+#include <cstddef>
+#include <new>
 #include <string>
 #include <memory>
 #include <cassert>
+#include <type_traits>
 
 #include "types/string.h"
 #include "types/types.h"
@@ -401,6 +404,9 @@ private:
 
         virtual bool isEnum() const = 0;
         virtual int enumToInt() const = 0;
+
+        //! NOTE Copy constructs this arg into the given buffer, used for inline storage
+        virtual IArg* cloneInto(void* buf) const = 0;
     };
 
     template<typename T>
@@ -431,12 +437,118 @@ private:
                 return -1;
             }
         }
+
+        IArg* cloneInto(void* buf) const override
+        {
+            return new (buf) Arg<T>(v);
+        }
+    };
+
+    //! NOTE Small values (bool, int, double, enums, points, fractions, colors...) are kept
+    //! inside the PropertyValue itself, so creating or copying them never allocates.
+    //! Bigger or not trivially copyable values (strings, vectors, paths...) are shared on the heap.
+    class ArgStorage
+    {
+    public:
+        static constexpr size_t INLINE_SIZE = 32;
+
+        template<typename T>
+        static constexpr bool isInline()
+        {
+            return std::is_trivially_copyable<T>::value
+                   && sizeof(Arg<T>) <= INLINE_SIZE
+                   && alignof(Arg<T>) <= alignof(std::max_align_t);
+        }
+
+        ArgStorage() = default;
+
+        ArgStorage(const ArgStorage& other)
+        {
+            assign(other);
+        }
+
+        ArgStorage(ArgStorage&& other) noexcept
+        {
+            assign(std::move(other));
+        }
+
+        ~ArgStorage()
+        {
+            reset();
+        }
+
+        ArgStorage& operator=(const ArgStorage& other)
+        {
+            if (this != &other) {
+                reset();
+                assign(other);
+            }
+            return *this;
+        }
+
+        ArgStorage& operator=(ArgStorage&& other) noexcept
+        {
+            if (this != &other) {
+                reset();
+                assign(std::move(other));
+            }
+            return *this;
+        }
+
+        template<typename T>
+        void set(const T& v)
+        {
+            reset();
+            if constexpr (isInline<T>()) {
+                m_inline = new (m_buf) Arg<T>(v);
+            } else {
+                m_shared = std::make_shared<Arg<T> >(v);
+            }
+        }
+
+        IArg* get() const { return m_inline ? m_inline : m_shared.get(); }
+        IArg* operator->() const { return get(); }
+        explicit operator bool() const { return get() != nullptr; }
+
+    private:
+        void reset()
+        {
+            if (m_inline) {
+                m_inline->~IArg();
+                m_inline = nullptr;
+            }
+            m_shared.reset();
+        }
+
+        void assign(const ArgStorage& other)
+        {
+            if (other.m_inline) {
+                m_inline = other.m_inline->cloneInto(m_buf);
+            } else {
+                m_shared = other.m_shared;
+            }
+        }
+
+        void assign(ArgStorage&& other)
+        {
+            if (other.m_inline) {
+                m_inline = other.m_inline->cloneInto(m_buf);
+            } else {
+                m_shared = std::move(other.m_shared);
+            }
+        }
+
+        IArg* m_inline = nullptr;
+        alignas(std::max_align_t) unsigned char m_buf[INLINE_SIZE];
+        std::shared_ptr<IArg> m_shared;
     };
 
     template<typename T>
-    inline std::shared_ptr<IArg> make_data(const T& v) const
+    inline ArgStorage make_data(const T& v) const
     {
-        return std::shared_ptr<IArg>(new Arg<T>(v));
+        ArgStorage data;
+        data.set<T>(v);
+        return data;
     }
 
     template<typename T>
@@ -446,7 +558,7 @@ private:
     }
 
     P_TYPE m_type = P_TYPE::UNDEFINED;
-    std::shared_ptr<IArg> m_data = nullptr;
+    ArgStorage m_data;
 };
 }
 
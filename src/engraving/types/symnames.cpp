@@ -21,6 +21,8 @@
  */
 #include "symnames.h"
 
+#include <algorithm>
+
 #include "containers.h"
 #include "translation.h"
 
@@ -29,7 +31,8 @@
 using namespace mu;
 using namespace mu::engraving;
 
-std::map<AsciiStringView, SymId> SymNames::s_nameToSymIdHash = {};
+//! NOTE No symbol name is longer, so the ASCII copy of a name to look up fits on the stack
+static constexpr size_t MAX_SYM_NAME_LENGTH = 64;
 
 AsciiStringView SymNames::nameForSymId(SymId id)
 {
@@ -48,16 +51,36 @@ String SymNames::translatedUserNameForSymId(SymId id)
 
 SymId SymNames::symIdByName(const AsciiStringView& name, SymId def)
 {
-    if (s_nameToSymIdHash.empty()) {
-        loadNameToSymIdHash();
+    const NameToSymIdIndex& index = nameToSymIdIndex();
+
+    auto it = std::lower_bound(index.cbegin(), index.cend(), name, [](const auto& entry, const AsciiStringView& n) {
+        return entry.first < n;
+    });
+
+    if (it == index.cend() || it->first != name) {
+        return def;
     }
-    return mu::value(s_nameToSymIdHash, name, def);
+
+    return it->second;
 }
 
 SymId SymNames::symIdByName(const String& name, SymId def)
 {
-    ByteArray ba = name.toAscii();
-    return symIdByName(AsciiStringView(ba.constChar()), def);
+    const size_t size = name.size();
+    if (size > MAX_SYM_NAME_LENGTH) {
+        return def;
+    }
+
+    char ascii[MAX_SYM_NAME_LENGTH];
+    for (size_t i = 0; i < size; ++i) {
+        char16_t ch = name.at(i).unicode();
+        if (ch > 0x7F) {
+            return def;
+        }
+        ascii[i] = static_cast<char>(ch);
+    }
+
+    return symIdByName(AsciiStringView(ascii, size), def);
 }
 
 SymId SymNames::symIdByOldName(const AsciiStringView& oldName)
@@ -79,13 +102,28 @@ SymId SymNames::symIdByUserName(const String& userName)
     return SymId::noSym;
 }
 
-void SymNames::loadNameToSymIdHash()
+const SymNames::NameToSymIdIndex& SymNames::nameToSymIdIndex()
 {
-    TRACEFUNC; // Should be called 0 or 1 times.
+    //! NOTE A sorted array, built on first use (thread-safe as a function-local static),
+    //! is searched without allocations and is more compact than a map
+    static const NameToSymIdIndex index = []() {
+        TRACEFUNC;
 
-    for (size_t i = 0; i < s_symNames.size(); ++i) {
-        s_nameToSymIdHash.insert({ s_symNames[i], static_cast<SymId>(i) });
-    }
+        NameToSymIdIndex result;
+        result.reserve(s_symNames.size());
+        for (size_t i = 0; i < s_symNames.size(); ++i) {
+            result.push_back({ s_symNames[i], static_cast<SymId>(i) });
+        }
+
+        //! NOTE Stable, so that the first symbol with a name is found, as before
+        std::stable_sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+        return result;
+    }();
+
+    return index;
 }
 
 constexpr const std::array<AsciiStringView, size_t(SymId::lastSym) + 1> SymNames::s_symNames { {
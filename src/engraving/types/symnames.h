@@ -42,13 +42,12 @@ struct SymNames {
     static SymId symIdByUserName(const String& userName);
 
 private:
-    static void loadNameToSymIdHash();
+    using NameToSymIdIndex = std::vector<std::pair<AsciiStringView, SymId> >;
+    static const NameToSymIdIndex& nameToSymIdIndex();
 
     static const std::array<AsciiStringView, size_t(SymId::lastSym) + 1> s_symNames;
     static const std::array<const char*, size_t(SymId::lastSym) + 1> s_symUserNames;
 
-    //! Will be initialized when first used
-    static std::map<AsciiStringView, SymId> s_nameToSymIdHash;
     static const std::map<AsciiStringView, SymId> s_oldNameToSymIdHash;
 };
 }
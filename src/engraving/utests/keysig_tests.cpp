@@ -26,6 +26,9 @@
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
 #include "libmscore/part.h"
+#include "libmscore/segment.h"
+#include "libmscore/staff.h"
+#include "libmscore/stafftimeline.h"
 #include "libmscore/undo.h"
 
 #include "utils/scorerw.h"
@@ -178,3 +181,26 @@ TEST_F(Engraving_KeySigTests, keysigMode)
     EXPECT_TRUE(ScoreComp::saveCompareScore(score, u"keysig03.mscx", KEYSIG_DATA_DIR + u"keysig03-ref.mscx"));
     delete score;
 }
+
+TEST_F(Engraving_KeySigTests, staffTimeline)
+{
+    MasterScore* score = ScoreRW::readScore(KEYSIG_DATA_DIR + u"keysig.mscx");
+    ASSERT_TRUE(score);
+
+    // the timeline gives the same states as the lookups of the staff, both walked forward and by search
+    for (const Staff* staff : score->staves()) {
+        StaffTimeline timeline(staff);
+        StaffTimeline::Cursor cursor = timeline.cursor();
+        for (Segment* s = score->firstSegment(SegmentType::All); s; s = s->next1()) {
+            const Fraction tick = s->tick();
+            const StaffTimeline::State& state = cursor.seek(tick.ticks());
+            EXPECT_EQ(state.keySigEvent.key(), staff->key(tick));
+            EXPECT_EQ(state.clefType, staff->clefType(tick));
+            EXPECT_EQ(state.staffType, staff->staffType(tick));
+            EXPECT_EQ(state.instrument, staff->part()->instrument(tick));
+            EXPECT_EQ(timeline.state(tick.ticks()).keySigEvent.key(), staff->key(tick));
+        }
+    }
+
+    delete score;
+}
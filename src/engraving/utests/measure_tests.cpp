@@ -25,6 +25,7 @@
 #include "libmscore/engravingitem.h"
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
+#include "libmscore/measurecolumns.h"
 #include "libmscore/measurenumber.h"
 #include "libmscore/rest.h"
 #include "libmscore/segment.h"
@@ -552,3 +553,78 @@ TEST_F(Engraving_MeasureTests, measureNumbers)
 
     delete score;
 }
+
+//---------------------------------------------------------
+//   tick2measureIndex
+//    tick lookups must follow inserted and removed measures
+//---------------------------------------------------------
+
+TEST_F(Engraving_MeasureTests, tick2measureIndex)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    auto checkLookups = [score]() {
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            EXPECT_EQ(score->tick2measure(m->tick()), m);
+            EXPECT_EQ(score->tick2measure(m->tick() + m->ticks() / 2), m);
+            EXPECT_EQ(score->tick2measureBase(m->tick()), m);
+        }
+        Measure* lm = score->lastMeasure();
+        EXPECT_EQ(score->tick2measure(lm->endTick()), lm);
+        EXPECT_EQ(score->tick2measureBase(lm->endTick()), nullptr);
+        EXPECT_EQ(score->tick2measure(lm->endTick() + Fraction(1, 4)), nullptr);
+    };
+
+    checkLookups();
+
+    // insert a measure in the middle, all following measures move
+    score->startCmd();
+    score->insertMeasure(ElementType::MEASURE, score->firstMeasure()->nextMeasure());
+    score->endCmd();
+    checkLookups();
+
+    // and remove it again
+    score->undoRedo(true, 0);
+    checkLookups();
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   measureColumns
+//    the columnar snapshot must match the segment list
+//---------------------------------------------------------
+
+TEST_F(Engraving_MeasureTests, measureColumns)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        MeasureColumns columns(m);
+        EXPECT_EQ(columns.trackCount(), score->ntracks());
+
+        size_t segIdx = 0;
+        for (Segment* s = m->first(); s; s = s->next(), ++segIdx) {
+            ASSERT_LT(segIdx, columns.segmentCount());
+            EXPECT_EQ(columns.segment(segIdx), s);
+            EXPECT_EQ(columns.tick(segIdx), s->tick());
+            EXPECT_EQ(columns.segmentType(segIdx), s->segmentType());
+            for (track_idx_t track = 0; track < score->ntracks(); ++track) {
+                EXPECT_EQ(columns.element(segIdx, track), s->element(track));
+                EXPECT_EQ(columns.trackColumn(track)[segIdx], s->element(track));
+            }
+        }
+        EXPECT_EQ(segIdx, columns.segmentCount());
+
+        // only chord rest segments
+        MeasureColumns crColumns(m, SegmentType::ChordRest);
+        for (size_t i = 0; i < crColumns.segmentCount(); ++i) {
+            EXPECT_EQ(crColumns.segmentType(i), SegmentType::ChordRest);
+        }
+        EXPECT_EQ(crColumns.segmentCount() > 0, m->first(SegmentType::ChordRest) != nullptr);
+    }
+
+    delete score;
+}
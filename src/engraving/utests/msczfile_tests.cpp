@@ -87,3 +87,149 @@ TEST_F(Engraving_MsczFileTests, MsczFile_WriteRead)
         EXPECT_EQ(imageData, originImageData);
     }
 }
+
+TEST_F(Engraving_MsczFileTests, MsczFile_WriteReadLarge)
+{
+    //! CASE Writing and reading data, that is compressed in several blocks
+
+    //! GIVEN Data larger than a compression block
+    ByteArray originScoreData;
+    for (int i = 0; originScoreData.size() < 5 * 1024 * 1024; ++i) {
+        const std::string note = "<Note><pitch>" + std::to_string(i % 128) + "</pitch></Note>\n";
+        originScoreData.push_back(reinterpret_cast<const uint8_t*>(note.c_str()), note.size());
+    }
+    const ByteArray originStyleData("style");
+
+    //! DO Write datas
+    ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "large.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeScoreFile(originScoreData);
+        writer.writeStyleFile(originStyleData);
+    }
+
+    EXPECT_LT(msczData.size(), originScoreData.size());
+
+    //! CHECK Read and compare with origin
+    {
+        Buffer buf(&msczData);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = "large.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        EXPECT_EQ(reader.readScoreFile(), originScoreData);
+        EXPECT_EQ(reader.readStyleFile(), originStyleData);
+
+        //! CHECK Only the head of the score file can be read
+        ByteArray head = reader.readScoreFileHead(1000);
+        EXPECT_EQ(head.size(), 1000);
+        EXPECT_EQ(head, originScoreData.left(1000));
+        EXPECT_EQ(reader.readScoreFileHead(originScoreData.size() * 2), originScoreData);
+    }
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_ReusePreviousFile)
+{
+    //! CASE Writing a file again, when only some of its datas changed
+
+    //! GIVEN A written file
+    const ByteArray originScoreData("score");
+    const ByteArray originImageData("image");
+
+    {
+        MscWriter::Params params;
+        params.filePath = "reuse1.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeScoreFile(originScoreData);
+        writer.addImageFile(u"image1.png", originImageData);
+    }
+
+    //! DO Write changed and unchanged datas, reusing the previous file
+    const ByteArray changedScoreData("score changed");
+
+    {
+        MscWriter::Params params;
+        params.filePath = "reuse2.mscz";
+        params.mode = MscIoMode::Zip;
+        params.previousFilePath = "reuse1.mscz";
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeScoreFile(changedScoreData);
+        writer.addImageFile(u"image1.png", originImageData);
+    }
+
+    //! CHECK Read and compare with the new datas
+    {
+        MscReader::Params params;
+        params.filePath = "reuse2.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        EXPECT_EQ(reader.readScoreFile(), changedScoreData);
+        EXPECT_EQ(reader.readImageFile(u"image1.png"), originImageData);
+    }
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_ReadExcerpts)
+{
+    //! GIVEN A container with several excerpts
+    const std::vector<String> names = { u"Flute", u"Oboe", u"Clarinet", u"Bassoon" };
+
+    ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "excerpts.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeScoreFile(ByteArray("score"));
+        for (const String& name : names) {
+            writer.addExcerptStyleFile(name, (u"style " + name).toUtf8());
+            writer.addExcerptFile(name, (u"excerpt " + name).toUtf8());
+        }
+    }
+
+    //! DO Read all excerpts at once
+    Buffer buf(&msczData);
+    MscReader::Params params;
+    params.device = &buf;
+    params.filePath = "excerpts.mscz";
+    params.mode = MscIoMode::Zip;
+
+    MscReader reader(params);
+    reader.open();
+
+    std::vector<MscReader::ExcerptFiles> files = reader.readExcerptFiles(reader.excerptNames());
+
+    //! CHECK Every excerpt got its own files, in the requested order
+    ASSERT_EQ(files.size(), names.size());
+    for (const MscReader::ExcerptFiles& f : files) {
+        EXPECT_EQ(f.styleData, (u"style " + f.name).toUtf8());
+        EXPECT_EQ(f.scoreData, (u"excerpt " + f.name).toUtf8());
+        EXPECT_EQ(f.scoreData, reader.readExcerptFile(f.name));
+    }
+}
@@ -474,6 +474,52 @@ TEST_F(Engraving_NoteTests, tpcDegrees)
     //QCOMPARE(tpc2degree(Tpc::TPC_B_S, Key::C_S), 7);
 }
 
+//---------------------------------------------------------
+///   spellSelection
+///    Score::spell() applies exactly the tpcs computeSpelling() chooses
+//---------------------------------------------------------
+
+TEST_F(Engraving_NoteTests, spellSelection)
+{
+    MasterScore* score = ScoreRW::readScore(NOTE_DATA_DIR + u"empty.mscx");
+
+    score->inputState().setTrack(0);
+    score->inputState().setSegment(score->tick2segment(Fraction(0, 1), false, SegmentType::ChordRest));
+    score->inputState().setDuration(DurationType::V_EIGHTH);
+    score->inputState().setNoteEntryMode(true);
+
+    //! GIVEN a run of chromatic notes
+    for (int pitch = 60; pitch < 80; ++pitch) {
+        score->cmdAddPitch(pitch, false, false);
+    }
+    score->inputState().setNoteEntryMode(false);
+    score->deselectAll();
+
+    std::vector<Note*> notes;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        EngravingItem* e = s->element(0);
+        if (e && e->isChord()) {
+            notes.insert(notes.end(), toChord(e)->notes().begin(), toChord(e)->notes().end());
+        }
+    }
+    ASSERT_EQ(notes.size(), 20u);
+
+    std::vector<int> tpcs = computeSpelling(notes);
+    ASSERT_EQ(tpcs.size(), notes.size());
+
+    //! DO respell the whole score
+    score->startCmd();
+    score->spell();
+    score->endCmd();
+
+    //! CHECK every note got the computed spelling, and it matches its pitch
+    for (size_t i = 0; i < notes.size(); ++i) {
+        ASSERT_NE(tpcs[i], Tpc::TPC_INVALID);
+        EXPECT_EQ(notes[i]->tpc1(), tpcs[i]);
+        EXPECT_EQ((tpc2pitch(tpcs[i]) + 12) % 12, notes[i]->pitch() % 12);
+    }
+}
+
 TEST_F(Engraving_NoteTests, alteredUnison)
 {
     MasterScore* score = ScoreRW::readScore(NOTE_DATA_DIR + u"altered-unison.mscx");
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/page.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_PageTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   rtreeMatchesBspTree
+//    both page indexes must find the same items
+//---------------------------------------------------------
+
+TEST_F(Engraving_PageTests, rtreeMatchesBspTree)
+{
+    //! GIVEN a laid out score
+    MasterScore* score = ScoreRW::readScore(u"measure_data/measure-1.mscx");
+    ASSERT_TRUE(score);
+    score->doLayout();
+    ASSERT_FALSE(score->pages().empty());
+
+    const bool pageRTreeIndex = MScore::pageRTreeIndex;
+
+    auto query = [](Page* page, bool rtree, const auto& area) {
+        MScore::pageRTreeIndex = rtree;
+        page->invalidateBspTree();
+        std::vector<EngravingItem*> items;
+        page->items(area, items);
+        return std::set<EngravingItem*>(items.begin(), items.end());
+    };
+
+    for (Page* page : score->pages()) {
+        const RectF bbox = page->bbox();
+        const double step = bbox.width() / 13;
+
+        //! DO query points and rectangles all over the page
+        //! CHECK the R-tree and the BSP tree agree
+        for (double y = bbox.top(); y < bbox.bottom(); y += step) {
+            for (double x = bbox.left(); x < bbox.right(); x += step) {
+                const PointF pos(x, y);
+                EXPECT_EQ(query(page, true, pos), query(page, false, pos));
+
+                const RectF rect(x, y, step * 2, step);
+                std::set<EngravingItem*> found = query(page, true, rect);
+                EXPECT_EQ(found, query(page, false, rect));
+            }
+        }
+
+        const RectF whole = bbox.adjusted(-1, -1, 1, 1);
+        EXPECT_FALSE(query(page, true, whole).empty());
+    }
+
+    MScore::pageRTreeIndex = pageRTreeIndex;
+
+    delete score;
+}
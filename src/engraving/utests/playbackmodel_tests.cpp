@@ -26,6 +26,7 @@
 
 #include "async/asyncable.h"
 #include "async/channel.h"
+#include "async/processevents.h"
 #include "mpe/tests/utils/articulationutils.h"
 #include "mpe/tests/mocks/articulationprofilesrepositorymock.h"
 
@@ -397,8 +398,8 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
     ON_CALL(*m_repositoryMock, defaultProfile(ArticulationFamily::Strings)).WillByDefault(Return(m_defaultProfile));
 
-    // [GIVEN] Expected amount of changed events
-    int expectedChangedEventsCount = 24;
+    // [GIVEN] Expected amount of events after the change
+    size_t expectedEventsCount = 24;
 
     // [GIVEN] The playback model requested to be loaded
     PlaybackModel model;
@@ -406,10 +407,18 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     model.load(score);
 
     PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString());
-
-    // [THEN] Updated events map will match our expectations
-    result.mainStream.onReceive(this, [expectedChangedEventsCount](const PlaybackEventsMap& updatedEvents) {
-        EXPECT_EQ(updatedEvents.size(), expectedChangedEventsCount);
+    PlaybackEventsMap receivedEvents = result.originEvents;
+
+    // [THEN] Only the changed measure will be sent, twice because of the repeat
+    result.mainStream.onReceive(this, [&](const PlaybackEventsDelta& delta) {
+        EXPECT_FALSE(delta.isReset);
+        EXPECT_EQ(delta.removedRanges.size(), 2);
+        EXPECT_LT(delta.insertedEvents.size(), expectedEventsCount);
+
+        // [THEN] The events with the delta applied will match the events of the model
+        delta.applyTo(receivedEvents);
+        EXPECT_EQ(receivedEvents.size(), expectedEventsCount);
+        EXPECT_TRUE(receivedEvents == model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents);
     });
 
     // [WHEN] Notation has been changed on the 2-nd measure
@@ -423,6 +432,68 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     score->changesChannel().send(range);
 }
 
+/**
+ * @brief PlaybackModelTests_Progressive_Load
+ * @details In this case we're loading the same score twice - at once and progressively, starting from the 2-nd measure
+ *          The events of the progressively loaded track, with all the received changes applied, should match the other one
+ */
+TEST_F(Engraving_PlaybackModelTests, Progressive_Load)
+{
+    // [GIVEN] Simple piece of score (Violin, 4/4, 120 bpm, Treble Cleff)
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "repeat_range/repeat_range.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+    ASSERT_TRUE(part);
+    ASSERT_EQ(part->instruments().size(), 1);
+
+    // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    ON_CALL(*m_repositoryMock, defaultProfile(ArticulationFamily::Strings)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model which has been loaded at once
+    PlaybackModel expectedModel;
+    expectedModel.setprofilesRepository(m_repositoryMock);
+    expectedModel.load(score);
+
+    PlaybackEventsMap expectedEvents
+        = expectedModel.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents;
+
+    // [GIVEN] The playback position is on the 2-nd measure
+    score->setPlayPos(Fraction::fromTicks(1920));
+
+    // [WHEN] The playback model requested to be loaded progressively
+    PlaybackModel model;
+    model.setprofilesRepository(m_repositoryMock);
+
+    InstrumentTrackIdSet addedTracks;
+    model.trackAdded().onReceive(this, [&addedTracks](const InstrumentTrackId& trackId) {
+        addedTracks.insert(trackId);
+    });
+
+    model.load(score, true /*progressively*/);
+
+    // [THEN] All the tracks are available right away
+    EXPECT_EQ(addedTracks, expectedModel.existingTrackIdSet());
+
+    PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString());
+    PlaybackEventsMap receivedEvents = result.originEvents;
+
+    result.mainStream.onReceive(this, [&receivedEvents](const PlaybackEventsDelta& delta) {
+        delta.applyTo(receivedEvents);
+    });
+
+    // [WHEN] The rest of the score has been loaded
+    for (size_t i = 0; i < score->nmeasures(); ++i) {
+        async::processEvents();
+    }
+
+    // [THEN] The events match the ones of the model loaded at once
+    EXPECT_EQ(receivedEvents.size(), expectedEvents.size());
+    EXPECT_TRUE(receivedEvents == expectedEvents);
+}
+
 /**
  * @brief PlaybackModelTests_Metronome_4_4
  * @details In this case we're building up a playback model of a simple score - Violin, 4/4, 120bpm, Treble Cleff, 4 measures
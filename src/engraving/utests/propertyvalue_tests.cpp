@@ -0,0 +1,97 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "types/propertyvalue.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_PropertyValueTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_PropertyValueTests, InlineValues)
+{
+    //! GIVEN Scalar and small values, stored inline
+    PropertyValue b(true);
+    PropertyValue i(42);
+    PropertyValue d(0.5);
+    PropertyValue p(PointF(1.0, 2.0));
+    PropertyValue f(Fraction(3, 4));
+    PropertyValue e(DirectionV::UP);
+
+    //! DO Copy them
+    PropertyValue b2 = b;
+    PropertyValue i2 = i;
+    PropertyValue d2 = d;
+    PropertyValue p2 = p;
+    PropertyValue f2 = f;
+    PropertyValue e2 = e;
+
+    //! CHECK The copies hold the same values
+    EXPECT_EQ(b2.toBool(), true);
+    EXPECT_EQ(i2.toInt(), 42);
+    EXPECT_DOUBLE_EQ(d2.toReal(), 0.5);
+    EXPECT_EQ(p2.value<PointF>(), PointF(1.0, 2.0));
+    EXPECT_EQ(f2.value<Fraction>(), Fraction(3, 4));
+    EXPECT_EQ(e2.value<DirectionV>(), DirectionV::UP);
+
+    EXPECT_EQ(b, b2);
+    EXPECT_EQ(i, i2);
+    EXPECT_EQ(p, p2);
+    EXPECT_EQ(e, e2);
+
+    //! CHECK Enum to int conversion still works
+    EXPECT_EQ(e2.value<int>(), static_cast<int>(DirectionV::UP));
+    EXPECT_TRUE(e2.isEnum());
+}
+
+TEST_F(Engraving_PropertyValueTests, AssignAndMove)
+{
+    //! GIVEN An inline value and a heap value
+    PropertyValue i(7);
+    PropertyValue s(String(u"text"));
+
+    //! DO Assign over each other and move
+    PropertyValue v = s;
+    v = i;
+    EXPECT_EQ(v.type(), P_TYPE::INT);
+    EXPECT_EQ(v.toInt(), 7);
+
+    v = s;
+    EXPECT_EQ(v.type(), P_TYPE::STRING);
+    EXPECT_EQ(v.value<String>(), String(u"text"));
+
+    PropertyValue moved = std::move(i);
+    EXPECT_EQ(moved.toInt(), 7);
+
+    PropertyValue movedString = std::move(v);
+    EXPECT_EQ(movedString.value<String>(), String(u"text"));
+
+    //! CHECK An undefined value stays undefined when copied
+    PropertyValue undefined;
+    PropertyValue undefined2 = undefined;
+    EXPECT_FALSE(undefined2.isValid());
+    EXPECT_EQ(undefined, undefined2);
+}
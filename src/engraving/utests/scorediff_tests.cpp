@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "libmscore/chord.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/note.h"
+#include "libmscore/scorediff.h"
+#include "libmscore/segment.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String SCOREDIFF_DATA_DIR(u"measure_data/");
+
+class Engraving_ScoreDiffTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_ScoreDiffTests, equal)
+{
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + u"measure-1.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score1 && score2);
+
+    ScoreDiff diff(score1, score2);
+    diff.update();
+
+    EXPECT_TRUE(diff.equal());
+    EXPECT_TRUE(diff.report().isEmpty());
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(Engraving_ScoreDiffTests, insertedMeasure)
+{
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + u"measure-1.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score1 && score2);
+
+    score2->startCmd();
+    score2->insertMeasure(ElementType::MEASURE, score2->firstMeasure()->nextMeasure());
+    score2->endCmd();
+
+    ScoreDiff diff(score1, score2);
+    diff.update();
+
+    //! NOTE The measure numbers after the inserted one change too,
+    //! but the numbers aren't written, so only the inserted measure differs
+    ASSERT_EQ(diff.changes().size(), 1);
+    EXPECT_EQ(diff.changes().front().type, ScoreDiff::ChangeType::Inserted);
+    EXPECT_EQ(diff.changes().front().measure2, score2->firstMeasure()->nextMeasure());
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(Engraving_ScoreDiffTests, changedNote)
+{
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + u"measure-1.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score1 && score2);
+
+    Segment* segment = score2->firstMeasure()->first(SegmentType::ChordRest);
+    Note* note = nullptr;
+    for (; segment && !note; segment = segment->next1(SegmentType::ChordRest)) {
+        EngravingItem* item = segment->element(0);
+        if (item && item->isChord()) {
+            note = toChord(item)->upNote();
+        }
+    }
+    ASSERT_TRUE(note);
+
+    score2->startCmd();
+    note->undoChangeProperty(Pid::PITCH, note->pitch() + 1);
+    score2->endCmd();
+
+    ScoreDiff diff(score1, score2);
+    diff.update();
+
+    ASSERT_EQ(diff.changes().size(), 1);
+    const ScoreDiff::MeasureChange& change = diff.changes().front();
+    EXPECT_EQ(change.type, ScoreDiff::ChangeType::Changed);
+    EXPECT_EQ(change.measure2, note->chord()->measure());
+    ASSERT_EQ(change.staves.size(), 1);
+    EXPECT_EQ(change.staves.front().staff, 0);
+    EXPECT_FALSE(change.staves.front().removedLines.empty());
+    EXPECT_FALSE(change.staves.front().addedLines.empty());
+
+    delete score1;
+    delete score2;
+}
@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include "libmscore/chord.h"
 #include "libmscore/excerpt.h"
 #include "libmscore/factory.h"
@@ -31,6 +33,7 @@
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
 #include "libmscore/part.h"
+#include "libmscore/spanner.h"
 #include "libmscore/staff.h"
 #include "libmscore/system.h"
 #include "libmscore/undo.h"
@@ -593,3 +596,58 @@ TEST_F(Engraving_SpannersTests, spanners16)
     EXPECT_TRUE(ScoreComp::saveCompareScore(score, u"smallstaff01.mscx", SPANNERS_DATA_DIR + u"smallstaff01-ref.mscx"));
     delete score;
 }
+
+//---------------------------------------------------------
+//   spannerMapQueries
+//    the interval tree must follow tick changes
+//    without being rebuilt
+//---------------------------------------------------------
+
+TEST_F(Engraving_SpannersTests, spannerMapQueries)
+{
+    MasterScore* score = ScoreRW::readScore(SPANNERS_DATA_DIR + "smallstaff01.mscx");
+    ASSERT_TRUE(score);
+
+    const SpannerMap& smap = score->spannerMap();
+    ASSERT_FALSE(smap.empty());
+
+    auto checkQueries = [score, &smap]() {
+        const int endTick = score->lastMeasure()->endTick().ticks();
+        const int step = Constants::division / 2;
+        for (int start = 0; start <= endTick; start += step) {
+            for (int stop = start; stop <= endTick; stop += step) {
+                std::set<Spanner*> overlapping;
+                std::set<Spanner*> contained;
+                for (const auto& p : smap.map()) {
+                    Spanner* s = p.second;
+                    if (s->tick().ticks() <= stop && s->tick2().ticks() >= start) {
+                        overlapping.insert(s);
+                    }
+                    if (s->tick().ticks() >= start && s->tick2().ticks() <= stop) {
+                        contained.insert(s);
+                    }
+                }
+
+                std::set<Spanner*> found;
+                smap.forEachOverlapping(start, stop, [&found](Spanner* s) { found.insert(s); });
+                EXPECT_EQ(found, overlapping);
+
+                found.clear();
+                for (const auto& interval : smap.findContained(start, stop)) {
+                    found.insert(interval.value);
+                }
+                EXPECT_EQ(found, contained);
+            }
+        }
+    };
+
+    checkQueries();
+
+    // move every spanner by a beat
+    for (const auto& p : smap.map()) {
+        p.second->setTick(p.second->tick() + Fraction(1, 4));
+    }
+    checkQueries();
+
+    delete score;
+}
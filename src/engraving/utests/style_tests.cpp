@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "style/style.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_StyleTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   precomputedValues
+//    the typed accessors must follow set()
+//---------------------------------------------------------
+
+TEST_F(Engraving_StyleTests, precomputedValues)
+{
+    //! GIVEN a style with default values
+    MStyle style;
+
+    EXPECT_DOUBLE_EQ(style.styleD(Sid::spatium), style.value(Sid::spatium).toReal());
+    EXPECT_EQ(style.styleB(Sid::concertPitch), style.value(Sid::concertPitch).toBool());
+    EXPECT_DOUBLE_EQ(style.styleS(Sid::minNoteDistance).val(), style.value(Sid::minNoteDistance).value<Spatium>().val());
+
+    //! DO change values
+    style.set(Sid::concertPitch, !style.styleB(Sid::concertPitch));
+    style.set(Sid::smallNoteMag, 0.5);
+    style.set(Sid::minNoteDistance, Spatium(0.75));
+    style.set(Sid::spatium, 20.0);
+
+    //! CHECK the accessors return the new values
+    EXPECT_EQ(style.styleB(Sid::concertPitch), style.value(Sid::concertPitch).toBool());
+    EXPECT_DOUBLE_EQ(style.styleD(Sid::smallNoteMag), 0.5);
+    EXPECT_DOUBLE_EQ(style.styleS(Sid::minNoteDistance).val(), 0.75);
+    EXPECT_DOUBLE_EQ(style.styleD(Sid::spatium), 20.0);
+    EXPECT_DOUBLE_EQ(style.styleMM(Sid::minNoteDistance).val(), 0.75 * 20.0);
+}
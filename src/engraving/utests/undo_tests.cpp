@@ -0,0 +1,221 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/undo.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String MEASURE_DATA_DIR(u"measure_data/");
+
+class Engraving_UndoTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   coalescePropertyChanges
+//    repeated changes of one property within a command
+//    keep a single undo step back to the original value
+//---------------------------------------------------------
+
+TEST_F(Engraving_UndoTests, coalescePropertyChanges)
+{
+    //! GIVEN a score
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    const double origStretch = m->userStretch();
+
+    //! DO change the same property several times in one command
+    score->startCmd();
+    m->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    m->undoChangeProperty(Pid::USER_STRETCH, 2.0);
+    m->undoChangeProperty(Pid::USER_STRETCH, 2.5);
+    score->endCmd();
+
+    //! CHECK only one change is recorded
+    const UndoMacro* macro = score->undoStack()->last();
+    ASSERT_TRUE(macro);
+    EXPECT_EQ(macro->childCount(), 1u);
+    EXPECT_DOUBLE_EQ(m->userStretch(), 2.5);
+
+    //! CHECK undo restores the original value and redo the last one
+    score->undoRedo(true, 0);
+    EXPECT_DOUBLE_EQ(m->userStretch(), origStretch);
+
+    score->undoRedo(false, 0);
+    EXPECT_DOUBLE_EQ(m->userStretch(), 2.5);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   coalesceInterleavedPropertyChanges
+//    the changes of one element are still coalesced when
+//    they alternate with changes of other elements,
+//    as it happens for linked elements in the parts
+//---------------------------------------------------------
+
+TEST_F(Engraving_UndoTests, coalesceInterleavedPropertyChanges)
+{
+    //! GIVEN a score with two measures
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m1 = score->firstMeasure();
+    ASSERT_TRUE(m1 && m1->nextMeasure());
+    Measure* m2 = m1->nextMeasure();
+    const double origStretch1 = m1->userStretch();
+    const double origStretch2 = m2->userStretch();
+
+    //! DO change the same property of both measures alternately in one command
+    score->startCmd();
+    m1->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    m2->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    m1->undoChangeProperty(Pid::USER_STRETCH, 2.0);
+    m2->undoChangeProperty(Pid::USER_STRETCH, 2.5);
+    score->endCmd();
+
+    //! CHECK one change is recorded per measure
+    const UndoMacro* macro = score->undoStack()->last();
+    ASSERT_TRUE(macro);
+    EXPECT_EQ(macro->childCount(), 2u);
+
+    //! CHECK undo restores the original values and redo the last ones
+    score->undoRedo(true, 0);
+    EXPECT_DOUBLE_EQ(m1->userStretch(), origStretch1);
+    EXPECT_DOUBLE_EQ(m2->userStretch(), origStretch2);
+
+    score->undoRedo(false, 0);
+    EXPECT_DOUBLE_EQ(m1->userStretch(), 2.0);
+    EXPECT_DOUBLE_EQ(m2->userStretch(), 2.5);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   memoryBudget
+//    the oldest commands are dropped when the history
+//    exceeds its budget, indices stay stable
+//---------------------------------------------------------
+
+TEST_F(Engraving_UndoTests, memoryBudget)
+{
+    //! GIVEN a score with a tiny history budget
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* undoStack = score->undoStack();
+    undoStack->setMemoryBudget(1);
+
+    Measure* m = score->firstMeasure();
+    const size_t startIdx = undoStack->getCurIdx();
+
+    //! DO run several commands
+    for (double stretch : { 1.5, 2.0, 2.5 }) {
+        score->startCmd();
+        m->undoChangeProperty(Pid::USER_STRETCH, stretch);
+        score->endCmd();
+    }
+
+    //! CHECK the index counts every command, but only the last one can be undone
+    EXPECT_EQ(undoStack->getCurIdx(), startIdx + 3);
+    EXPECT_TRUE(undoStack->canUndo());
+
+    score->undoRedo(true, 0);
+    EXPECT_DOUBLE_EQ(m->userStretch(), 2.0);
+    EXPECT_FALSE(undoStack->canUndo());
+
+    //! CHECK without a budget the whole history is kept
+    undoStack->setMemoryBudget(0);
+    score->undoRedo(false, 0);
+    for (double stretch : { 3.0, 3.5 }) {
+        score->startCmd();
+        m->undoChangeProperty(Pid::USER_STRETCH, stretch);
+        score->endCmd();
+    }
+    score->undoRedo(true, 0);
+    score->undoRedo(true, 0);
+    EXPECT_DOUBLE_EQ(m->userStretch(), 2.5);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   batch
+//    commands inside a batch form a single undo step
+//---------------------------------------------------------
+
+TEST_F(Engraving_UndoTests, batch)
+{
+    //! GIVEN a score
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* undoStack = score->undoStack();
+    const size_t startIdx = undoStack->getCurIdx();
+
+    Measure* m1 = score->firstMeasure();
+    Measure* m2 = m1->nextMeasure();
+    Measure* m3 = m2->nextMeasure();
+    ASSERT_TRUE(m3);
+    const double origStretch = m1->userStretch();
+
+    //! DO run several commands in a batch, roll back one of them
+    score->startBatch();
+    EXPECT_TRUE(score->isBatchActive());
+
+    score->startCmd();
+    m1->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    score->endCmd();
+
+    score->startCmd();
+    m2->undoChangeProperty(Pid::USER_STRETCH, 2.0);
+    score->endCmd(true);
+
+    score->startCmd();
+    m3->undoChangeProperty(Pid::USER_STRETCH, 2.5);
+    score->endCmd();
+
+    score->endBatch();
+    EXPECT_FALSE(score->isBatchActive());
+
+    //! CHECK the batch is one undo step without the rolled back command
+    EXPECT_EQ(undoStack->getCurIdx(), startIdx + 1);
+    EXPECT_DOUBLE_EQ(m1->userStretch(), 1.5);
+    EXPECT_DOUBLE_EQ(m2->userStretch(), origStretch);
+    EXPECT_DOUBLE_EQ(m3->userStretch(), 2.5);
+
+    score->undoRedo(true, 0);
+    EXPECT_DOUBLE_EQ(m1->userStretch(), origStretch);
+    EXPECT_DOUBLE_EQ(m3->userStretch(), origStretch);
+
+    delete score;
+}
@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
@@ -65,3 +66,32 @@ TEST_F(Engraving_UnrollRepeatsTests, pickupMeasure)
 
     EXPECT_TRUE(ScoreComp::saveCompareScore(unrolled, u"pickup-measure-test.mscx", UNROLLREPEATS_DATA_DIR + u"pickup-measure-ref.mscx"));
 }
+
+//---------------------------------------------------------
+///   forEachUnrolledMeasure
+///   the streamed measures follow each other without gaps
+///   and match the measures of the unrolled copy
+//---------------------------------------------------------
+
+TEST_F(Engraving_UnrollRepeatsTests, forEachUnrolledMeasure)
+{
+    MasterScore* score = ScoreRW::readScore(UNROLLREPEATS_DATA_DIR + u"clef-key-ts-test.mscx");
+    ASSERT_TRUE(score);
+
+    size_t count = 0;
+    int expectedTick = 0;
+    bool contiguous = true;
+    score->forEachUnrolledMeasure([&](const Measure* m, int utick) {
+        contiguous = contiguous && utick == expectedTick;
+        expectedTick = utick + m->ticks().ticks();
+        ++count;
+        return true;
+    });
+
+    EXPECT_TRUE(contiguous);
+
+    MasterScore* unrolled = score->unrollRepeats();
+    ASSERT_TRUE(unrolled);
+    EXPECT_EQ(count, unrolled->nmeasures());
+    EXPECT_EQ(expectedTick, unrolled->endTick().ticks());
+}
@@ -23,8 +23,7 @@
 #ifndef MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 #define MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 
-#include <map>
-#include <set>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
@@ -33,6 +32,7 @@
 
 #include "internal/audiosanitizer.h"
 #include "audiotypes.h"
+#include "eventtimeline.h"
 
 namespace mu::audio {
 template<class ... Types>
@@ -40,11 +40,20 @@ class AbstractEventSequencer : public async::Asyncable
 {
 public:
     using EventType = std::variant<Types...>;
-    using EventSequence = std::set<EventType>;
-    using EventSequenceMap = std::map<msecs_t, EventSequence>;
 
-    typedef typename EventSequenceMap::const_iterator SequenceIterator;
-    typedef typename EventSequence::const_iterator EventIterator;
+    //! NOTE The events to be played in one block, sorted and without duplicates
+    using EventSequence = std::vector<EventType>;
+
+    //! NOTE The duplicates are kept, so the events of one note can be removed without touching the same events of the others
+    using Timeline = EventTimeline<EventType>;
+    using TimelineIterator = typename Timeline::const_iterator;
+
+    AbstractEventSequencer()
+    {
+        updateMainSequenceIterator();
+        updateOffSequenceIterator();
+        updateDynamicChangesIterator();
+    }
 
     virtual ~AbstractEventSequencer()
     {
@@ -68,9 +77,16 @@ public:
             updateOffStreamEvents(changes);
         });
 
-        m_mainStreamChanges.onReceive(this, [this](const mpe::PlaybackEventsMap& changes) {
-            m_playbackEventsMap = changes;
-            updateMainStreamEvents(changes);
+        m_mainStreamChanges.onReceive(this, [this](const mpe::PlaybackEventsDelta& delta) {
+            if (delta.isReset) {
+                m_playbackEventsMap = delta.insertedEvents;
+                updateMainStreamEvents(m_playbackEventsMap);
+                return;
+            }
+
+            mpe::PlaybackEventsMap removedEvents;
+            delta.applyTo(m_playbackEventsMap, &removedEvents);
+            applyMainStreamDelta(removedEvents, delta.insertedEvents);
         });
 
         m_dynamicLevelChanges.onReceive(this, [this](const mpe::DynamicLevelMap& changes) {
@@ -86,6 +102,13 @@ public:
     virtual void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) = 0;
     virtual void updateDynamicChanges(const mpe::DynamicLevelMap& changes) = 0;
 
+    //! NOTE Called when only a part of the track has been changed, the sequencers which can't
+    //!      update their events partially just reload the whole track
+    virtual void applyMainStreamDelta(const mpe::PlaybackEventsMap& /*removedEvents*/, const mpe::PlaybackEventsMap& /*insertedEvents*/)
+    {
+        updateMainStreamEvents(m_playbackEventsMap);
+    }
+
     async::Notification flushedOffStreamEvents() const
     {
         return m_offStreamFlushed;
@@ -139,11 +162,12 @@ public:
         return std::prev(upper)->second;
     }
 
-    EventSequence eventsToBePlayed(const msecs_t nextMsecs)
+    //! NOTE The result is valid until the next call
+    const EventSequence& eventsToBePlayed(const msecs_t nextMsecs)
     {
         ONLY_AUDIO_WORKER_THREAD;
 
-        EventSequence result;
+        EventSequence& result = m_eventsToBePlayed;
 
         result.clear();
 
@@ -152,7 +176,7 @@ public:
             return result;
         }
 
-        if (m_currentMainSequenceIt == m_mainStreamEvents.cend()) {
+        if (m_currentMainSequenceIt == m_mainStreamEvents.end()) {
             return result;
         }
 
@@ -161,6 +185,8 @@ public:
         handleMainStream(result);
         handleDynamicChanges(result);
 
+        sortAndRemoveDuplicates(result);
+
         return result;
     }
 
@@ -168,75 +194,99 @@ protected:
     void resetAllIterators()
     {
         updateMainSequenceIterator();
-        updateOffSequenceIterator();
         updateDynamicChangesIterator();
     }
 
     void updateMainSequenceIterator()
     {
-        m_currentMainSequenceIt = m_mainStreamEvents.lower_bound(m_playbackPosition);
+        m_mainStreamEvents.finalize();
+        m_currentMainSequenceIt = m_mainStreamEvents.lowerBound(m_playbackPosition);
     }
 
     void updateOffSequenceIterator()
     {
-        m_currentOffSequenceIt = m_offStreamEvents.cbegin();
+        m_offStreamEvents.finalize();
+        m_currentOffSequenceIt = m_offStreamEvents.begin();
+        m_offStreamPosition = 0;
     }
 
     void updateDynamicChangesIterator()
     {
-        m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
+        m_dynamicEvents.finalize();
+        m_currentDynamicsIt = m_dynamicEvents.lowerBound(m_playbackPosition);
     }
 
     void handleOffStream(EventSequence& result, const msecs_t nextMsecs)
     {
-        if (m_offStreamEvents.empty() || m_currentOffSequenceIt == m_offStreamEvents.cend()) {
+        if (m_currentOffSequenceIt == m_offStreamEvents.end()) {
             return;
         }
 
-        if (m_currentOffSequenceIt->first <= nextMsecs) {
-            result = m_currentOffSequenceIt->second;
-            m_currentOffSequenceIt = m_offStreamEvents.erase(m_currentOffSequenceIt);
-        } else {
-            auto node = m_offStreamEvents.extract(m_currentOffSequenceIt);
-            node.key() -= nextMsecs;
-            m_offStreamEvents.insert(std::move(node));
-            updateOffSequenceIterator();
+        m_offStreamPosition += nextMsecs;
+
+        if (m_currentOffSequenceIt->timestamp <= m_offStreamPosition) {
+            m_currentOffSequenceIt = appendGroup(result, m_offStreamEvents, m_currentOffSequenceIt);
         }
     }
 
     void handleMainStream(EventSequence& result)
     {
-        if (m_currentMainSequenceIt->first <= m_playbackPosition) {
-            result.insert(m_currentMainSequenceIt->second.cbegin(),
-                          m_currentMainSequenceIt->second.cend());
-
-            m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
+        if (m_currentMainSequenceIt->timestamp <= m_playbackPosition) {
+            m_currentMainSequenceIt = appendGroup(result, m_mainStreamEvents, m_currentMainSequenceIt);
         }
     }
 
     void handleDynamicChanges(EventSequence& result)
     {
-        if (m_dynamicEvents.empty() || m_currentDynamicsIt == m_dynamicEvents.cend()) {
+        if (m_currentDynamicsIt == m_dynamicEvents.end()) {
             return;
         }
 
-        if (m_currentDynamicsIt->first <= m_playbackPosition) {
-            result.insert(m_currentDynamicsIt->second.cbegin(),
-                          m_currentDynamicsIt->second.cend());
+        if (m_currentDynamicsIt->timestamp <= m_playbackPosition) {
+            m_currentDynamicsIt = appendGroup(result, m_dynamicEvents, m_currentDynamicsIt);
+        }
+    }
+
+    static TimelineIterator appendGroup(EventSequence& result, const Timeline& timeline, TimelineIterator it)
+    {
+        TimelineIterator groupEnd = timeline.groupEnd(it);
 
-            m_currentDynamicsIt = std::next(m_currentDynamicsIt);
+        for (; it != groupEnd; ++it) {
+            result.push_back(it->event);
         }
+
+        return groupEnd;
+    }
+
+    static void sortAndRemoveDuplicates(EventSequence& sequence)
+    {
+        if (sequence.size() < 2) {
+            return;
+        }
+
+        std::less<EventType> less;
+        std::sort(sequence.begin(), sequence.end(), less);
+
+        auto last = std::unique(sequence.begin(), sequence.end(), [&less](const EventType& first, const EventType& second) {
+            return !less(first, second) && !less(second, first);
+        });
+
+        sequence.erase(last, sequence.end());
     }
 
     mutable msecs_t m_playbackPosition = 0;
 
-    SequenceIterator m_currentMainSequenceIt;
-    SequenceIterator m_currentOffSequenceIt;
-    SequenceIterator m_currentDynamicsIt;
+    msecs_t m_offStreamPosition = 0;
+
+    TimelineIterator m_currentMainSequenceIt;
+    TimelineIterator m_currentOffSequenceIt;
+    TimelineIterator m_currentDynamicsIt;
+
+    Timeline m_mainStreamEvents;
+    Timeline m_offStreamEvents;
+    Timeline m_dynamicEvents;
 
-    EventSequenceMap m_mainStreamEvents;
-    EventSequenceMap m_offStreamEvents;
-    EventSequenceMap m_dynamicEvents;
+    EventSequence m_eventsToBePlayed;
 
     mpe::DynamicLevelMap m_dynamicLevelMap;
     mpe::PlaybackEventsMap m_playbackEventsMap;
@@ -246,7 +296,7 @@ protected:
 
     bool m_isActive = false;
 
-    mpe::PlaybackEventsChanges m_mainStreamChanges;
+    mpe::PlaybackEventsDeltaChanges m_mainStreamChanges;
     mpe::PlaybackEventsChanges m_offStreamChanges;
     mpe::DynamicLevelChanges m_dynamicLevelChanges;
 };
@@ -21,6 +21,8 @@
  */
 #include "audiomodule.h"
 
+#include <atomic>
+
 #include <QQmlEngine>
 
 #include "ui/iuiengine.h"
@@ -47,6 +49,7 @@
 
 #include "view/synthssettingsmodel.h"
 #include "devtools/waveformmodel.h"
+#include "devtools/audiometricsmodel.h"
 
 #include "diagnostics/idiagnosticspathsregister.h"
 
@@ -69,6 +72,8 @@ static std::shared_ptr<Playback> s_playbackFacade = std::make_shared<Playback>()
 
 static std::shared_ptr<SoundFontRepository> s_soundFontRepository = std::make_shared<SoundFontRepository>();
 
+static std::atomic<bool> s_lookaheadRenderEnabled = false;
+
 #ifdef Q_OS_LINUX
 #include "internal/platform/lin/linuxaudiodriver.h"
 static std::shared_ptr<IAudioDriver> s_audioDriver = std::shared_ptr<IAudioDriver>(new LinuxAudioDriver());
@@ -129,6 +134,7 @@ void AudioModule::registerResources()
 void AudioModule::registerUiTypes()
 {
     qmlRegisterType<WaveFormModel>("MuseScore.Audio", 1, 0, "WaveFormModel");
+    qmlRegisterType<AudioMetricsModel>("MuseScore.Audio", 1, 0, "AudioMetricsModel");
     qmlRegisterType<synth::SynthsSettingsModel>("MuseScore.Audio", 1, 0, "SynthsSettingsModel");
 
     ioc()->resolve<ui::IUiEngine>(moduleName())->addSourceImportPath(audio_QML_IMPORT);
@@ -173,6 +179,16 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
     s_audioBuffer->init(s_audioConfiguration->audioChannelsCount(),
                         s_audioConfiguration->renderStep());
 
+    s_audioBuffer->setLowLatencyMode(s_audioConfiguration->isLowLatencyModeEnabled());
+    s_audioConfiguration->lowLatencyModeEnabledChanged().onNotify(nullptr, []() {
+        s_audioBuffer->setLowLatencyMode(s_audioConfiguration->isLowLatencyModeEnabled());
+    });
+
+    s_lookaheadRenderEnabled = s_audioConfiguration->isLookaheadRenderEnabled();
+    s_audioConfiguration->lookaheadRenderEnabledChanged().onNotify(nullptr, []() {
+        s_lookaheadRenderEnabled = s_audioConfiguration->isLookaheadRenderEnabled();
+    });
+
     s_audioOutputController->init();
 
     // Setup audio driver
@@ -213,6 +229,7 @@ void AudioModule::setupAudioDriver(const framework::IApplication::RunMode& mode)
     requiredSpec.callback = [](void* /*userdata*/, uint8_t* stream, int byteCount) {
         auto samplesPerChannel = byteCount / (2 * sizeof(float));
         s_audioBuffer->pop(reinterpret_cast<float*>(stream), samplesPerChannel);
+        s_audioWorker->wakeup();
     };
 
     if (mode == framework::IApplication::RunMode::Editor) {
@@ -250,9 +267,22 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
         s_playbackFacade->init();
     };
 
-    auto workerLoopBody = []() {
+    s_playbackFacade->setCommandsWakeup([]() {
+        s_audioWorker->wakeup();
+    });
+
+    samples_t renderStep = s_audioConfiguration->renderStep();
+
+    auto workerLoopBody = [renderStep]() {
         ONLY_AUDIO_WORKER_THREAD;
+        s_playbackFacade->processCommands();
         s_audioBuffer->forward();
+
+        //! NOTE After the block for the driver is ready, the time left until the next one
+        //! goes into rendering the heavy instruments ahead
+        if (s_lookaheadRenderEnabled && AudioEngine::instance()->mode() == RenderMode::RealTimeMode) {
+            AudioEngine::instance()->mixer()->renderAhead(renderStep);
+        }
     };
 
     s_audioWorker->run(workerSetup, workerLoopBody);
@@ -24,6 +24,7 @@
 #define MU_AUDIO_AUDIOTYPES_H
 
 #include <variant>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -89,6 +90,15 @@ struct SoundTrackFormat {
     }
 };
 
+struct SoundTrackDestination {
+    io::path_t path;
+    SoundTrackFormat format;
+};
+
+//! NOTE All the destinations of one export share the rendered audio,
+//! so they must have the same sample rate and the same number of channels
+using SoundTrackDestinations = std::vector<SoundTrackDestination>;
+
 using AudioSourceName = std::string;
 using AudioResourceId = std::string;
 using AudioResourceIdList = std::vector<AudioResourceId>;
@@ -287,23 +297,91 @@ struct AudioSignalVal {
 
 using AudioSignalChanges = async::Channel<audioch_t, AudioSignalVal>;
 
+//! NOTE Time spent on rendering a track relative to the real time duration of the rendered audio
+using cpu_load_t = float;
+using AudioCpuLoadChanges = async::Channel<cpu_load_t>;
+
+//! NOTE Time spent on one stage of the audio pipeline since the metrics were taken the last time
+struct AudioProcessingTime {
+    uint64_t callCount = 0;
+    double totalMsecs = 0.0;
+    double maxMsecs = 0.0;
+    uint64_t samplesPerChannel = 0; // the amount of audio processed
+
+    double averageMsecs() const
+    {
+        return callCount > 0 ? totalMsecs / callCount : 0.0;
+    }
+
+    //! NOTE Relative to the real time duration of the processed audio, 1.0 means the whole budget
+    double load(const sample_rate_t sampleRate) const
+    {
+        if (samplesPerChannel == 0 || sampleRate == 0) {
+            return 0.0;
+        }
+
+        return totalMsecs / (samplesPerChannel * 1000.0 / sampleRate);
+    }
+};
+
+struct AudioTrackMetrics {
+    TrackId trackId = -1;
+    AudioResourceId sourceId;
+    AudioProcessingTime channel; // the whole mixer channel
+    AudioProcessingTime source;  // the synth
+    std::vector<std::pair<AudioResourceId, AudioProcessingTime> > fx;
+    samples_t fxLatency = 0; // reported by the active fx, not compensated
+};
+
+struct AudioMetrics {
+    sample_rate_t sampleRate = 0;
+
+    uint64_t underrunCount = 0; // since the start
+    size_t reservedSamples = 0;
+
+    AudioProcessingTime bufferFill; // all the work of the audio worker for the driver
+    AudioProcessingTime mix;        // the mixer, including the channels and the master fx
+    AudioProcessingTime masterFx;
+    samples_t masterFxLatency = 0;
+
+    std::vector<AudioTrackMetrics> tracks;
+};
+
+//! NOTE Called for every processed block, each send is queued to the main thread.
+//! So the values are decimated: at most one send per channel per interval,
+//! carrying the peak of the values received since the previous send, so short transients still reach the meters
 struct AudioSignalsNotifier {
     void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
     {
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
+        SignalState& state = m_signalStatesMap[audioChNumber];
 
         volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
+        state.peakPressure = std::max(state.peakPressure, validatedPressure);
+        state.peakAmplitude = std::max(state.peakAmplitude, newAmplitude);
 
-        if (RealIsEqual(signalVal.pressure, validatedPressure)) {
+        auto now = std::chrono::steady_clock::now();
+        if (now - state.lastSendTime < MINIMAL_SEND_INTERVAL) {
             return;
         }
 
-        if (std::abs(signalVal.pressure - validatedPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
+        AudioSignalVal& signalVal = state.val;
+        volume_dbfs_t peakPressure = state.peakPressure;
+        float peakAmplitude = state.peakAmplitude;
+
+        state.peakPressure = MINIMUM_OPERABLE_DBFS_LEVEL;
+        state.peakAmplitude = 0.f;
+
+        if (RealIsEqual(signalVal.pressure, peakPressure)) {
             return;
         }
 
-        signalVal.amplitude = newAmplitude;
-        signalVal.pressure = validatedPressure;
+        if (std::abs(signalVal.pressure - peakPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
+            return;
+        }
+
+        state.lastSendTime = now;
+        signalVal.amplitude = peakAmplitude;
+        signalVal.pressure = peakPressure;
 
         audioSignalChanges.send(audioChNumber, signalVal);
     }
@@ -314,7 +392,17 @@ private:
     static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 2.5f;
     static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
 
-    std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
+    //! NOTE About 60 updates per second, the meters are not repainted faster anyway
+    static constexpr std::chrono::milliseconds MINIMAL_SEND_INTERVAL { 16 };
+
+    struct SignalState {
+        AudioSignalVal val;
+        volume_dbfs_t peakPressure = MINIMUM_OPERABLE_DBFS_LEVEL;
+        float peakAmplitude = 0.f;
+        std::chrono::steady_clock::time_point lastSendTime;
+    };
+
+    std::map<audioch_t, SignalState> m_signalStatesMap;
 };
 
 enum class PlaybackStatus {
@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "audiometricsmodel.h"
+
+#include "log.h"
+
+using namespace mu::audio;
+
+static constexpr int METRICS_INTERVAL_MSECS = 1000;
+
+static QString formatTime(const AudioProcessingTime& time, const sample_rate_t sampleRate)
+{
+    return QString("avg %1 ms, max %2 ms, load %3%")
+           .arg(time.averageMsecs(), 0, 'f', 3)
+           .arg(time.maxMsecs, 0, 'f', 3)
+           .arg(time.load(sampleRate) * 100.0, 0, 'f', 1);
+}
+
+AudioMetricsModel::AudioMetricsModel(QObject* parent)
+    : QObject(parent)
+{
+    m_timer.setInterval(METRICS_INTERVAL_MSECS);
+    connect(&m_timer, &QTimer::timeout, this, &AudioMetricsModel::requestMetrics);
+    m_timer.start();
+
+    requestMetrics();
+}
+
+QString AudioMetricsModel::report() const
+{
+    return m_report;
+}
+
+bool AudioMetricsModel::loggingEnabled() const
+{
+    return m_loggingEnabled;
+}
+
+void AudioMetricsModel::setLoggingEnabled(bool enabled)
+{
+    if (m_loggingEnabled == enabled) {
+        return;
+    }
+
+    m_loggingEnabled = enabled;
+    emit loggingEnabledChanged();
+}
+
+void AudioMetricsModel::requestMetrics()
+{
+    playback()->audioOutput()->takeMetrics().onResolve(this, [this](const AudioMetrics& metrics) {
+        setMetrics(metrics);
+    });
+}
+
+void AudioMetricsModel::setMetrics(const AudioMetrics& metrics)
+{
+    QStringList lines;
+
+    lines << QString("underruns: %1, reserved: %2 samples").arg(metrics.underrunCount).arg(metrics.reservedSamples);
+    lines << QString("buffer fill: %1").arg(formatTime(metrics.bufferFill, metrics.sampleRate));
+    lines << QString("mixer: %1").arg(formatTime(metrics.mix, metrics.sampleRate));
+    lines << QString("master fx: %1, latency %2 samples").arg(formatTime(metrics.masterFx, metrics.sampleRate))
+        .arg(metrics.masterFxLatency);
+
+    for (const AudioTrackMetrics& track : metrics.tracks) {
+        lines << QString("track %1: %2, fx latency %3 samples").arg(track.trackId).arg(formatTime(track.channel, metrics.sampleRate))
+            .arg(track.fxLatency);
+        lines << QString("    %1: %2").arg(QString::fromStdString(track.sourceId), formatTime(track.source, metrics.sampleRate));
+
+        for (const auto& fx : track.fx) {
+            lines << QString("    %1: %2").arg(QString::fromStdString(fx.first), formatTime(fx.second, metrics.sampleRate));
+        }
+    }
+
+    m_report = lines.join("\n");
+    emit reportChanged();
+
+    if (m_loggingEnabled) {
+        LOGI() << "audio metrics:\n" << m_report;
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_AUDIOMETRICSMODEL_H
+#define MU_AUDIO_AUDIOMETRICSMODEL_H
+
+#include <QObject>
+#include <QTimer>
+
+#include "modularity/ioc.h"
+#include "async/asyncable.h"
+
+#include "iplayback.h"
+
+namespace mu::audio {
+class AudioMetricsModel : public QObject, public async::Asyncable
+{
+    Q_OBJECT
+
+    INJECT(audio, IPlayback, playback)
+
+    Q_PROPERTY(QString report READ report NOTIFY reportChanged)
+    Q_PROPERTY(bool loggingEnabled READ loggingEnabled WRITE setLoggingEnabled NOTIFY loggingEnabledChanged)
+
+public:
+    explicit AudioMetricsModel(QObject* parent = nullptr);
+
+    QString report() const;
+    bool loggingEnabled() const;
+
+public slots:
+    void setLoggingEnabled(bool enabled);
+
+signals:
+    void reportChanged();
+    void loggingEnabledChanged();
+
+private:
+    void requestMetrics();
+    void setMetrics(const AudioMetrics& metrics);
+
+    QTimer m_timer;
+    QString m_report;
+    bool m_loggingEnabled = false;
+};
+}
+
+#endif // MU_AUDIO_AUDIOMETRICSMODEL_H
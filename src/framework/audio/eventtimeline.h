@@ -0,0 +1,218 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_EVENTTIMELINE_H
+#define MU_AUDIO_EVENTTIMELINE_H
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "audiotypes.h"
+
+namespace mu::audio {
+//! NOTE Events sorted by their timestamps and stored contiguously.
+//!      The events are appended in any order and sorted by finalize(), the chunk index
+//!      makes seeking a matter of a few comparisons even for long scores
+template<class EventType>
+class EventTimeline
+{
+public:
+    struct Entry {
+        msecs_t timestamp = 0;
+        EventType event;
+    };
+
+    using const_iterator = typename std::vector<Entry>::const_iterator;
+
+    void add(const msecs_t timestamp, EventType event)
+    {
+        m_entries.push_back({ timestamp, std::move(event) });
+        m_isFinalized = false;
+    }
+
+    void reserve(const size_t size)
+    {
+        m_entries.reserve(size);
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_chunkIndex.clear();
+        m_isFinalized = true;
+    }
+
+    void finalize()
+    {
+        if (m_isFinalized) {
+            return;
+        }
+
+        std::sort(m_entries.begin(), m_entries.end(), &EventTimeline::entryLess);
+        rebuildChunkIndex();
+        m_isFinalized = true;
+    }
+
+    //! NOTE Both timelines have to be finalized
+    void merge(const EventTimeline& other)
+    {
+        if (other.empty()) {
+            return;
+        }
+
+        std::vector<Entry> result;
+        result.reserve(m_entries.size() + other.m_entries.size());
+        std::merge(m_entries.cbegin(), m_entries.cend(), other.m_entries.cbegin(), other.m_entries.cend(),
+                   std::back_inserter(result), &EventTimeline::entryLess);
+
+        m_entries.swap(result);
+        rebuildChunkIndex();
+    }
+
+    //! NOTE Removes one entry for every entry of the other timeline, both timelines have to be finalized
+    void remove(const EventTimeline& other)
+    {
+        if (other.empty() || empty()) {
+            return;
+        }
+
+        auto removedIt = other.m_entries.cbegin();
+        auto writeIt = m_entries.begin();
+
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            while (removedIt != other.m_entries.cend() && entryLess(*removedIt, *it)) {
+                ++removedIt;
+            }
+
+            if (removedIt != other.m_entries.cend() && !entryLess(*it, *removedIt)) {
+                ++removedIt;
+                continue;
+            }
+
+            if (writeIt != it) {
+                *writeIt = std::move(*it);
+            }
+
+            ++writeIt;
+        }
+
+        m_entries.erase(writeIt, m_entries.end());
+        rebuildChunkIndex();
+    }
+
+    bool empty() const
+    {
+        return m_entries.empty();
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    const_iterator begin() const
+    {
+        return m_entries.cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return m_entries.cend();
+    }
+
+    //! NOTE The first entry which is not earlier than the timestamp
+    const_iterator lowerBound(const msecs_t timestamp) const
+    {
+        if (m_entries.empty() || timestamp <= m_entries.front().timestamp) {
+            return m_entries.cbegin();
+        }
+
+        size_t chunk = static_cast<size_t>((timestamp - m_entries.front().timestamp) / CHUNK_DURATION);
+        if (chunk >= m_chunkIndex.size()) {
+            return m_entries.cend();
+        }
+
+        auto first = m_entries.cbegin() + m_chunkIndex[chunk];
+        auto last = chunk + 1 < m_chunkIndex.size() ? m_entries.cbegin() + m_chunkIndex[chunk + 1] : m_entries.cend();
+
+        return std::lower_bound(first, last, timestamp, [](const Entry& entry, const msecs_t value) {
+            return entry.timestamp < value;
+        });
+    }
+
+    //! NOTE The end of the group of entries with the same timestamp
+    const_iterator groupEnd(const_iterator it) const
+    {
+        const msecs_t timestamp = it->timestamp;
+        while (it != m_entries.cend() && it->timestamp == timestamp) {
+            ++it;
+        }
+
+        return it;
+    }
+
+private:
+    //! NOTE 1 second, timestamps are in microseconds
+    static constexpr msecs_t CHUNK_DURATION = 1000000;
+
+    static bool entryLess(const Entry& first, const Entry& second)
+    {
+        if (first.timestamp != second.timestamp) {
+            return first.timestamp < second.timestamp;
+        }
+
+        return std::less<EventType>()(first.event, second.event);
+    }
+
+    void rebuildChunkIndex()
+    {
+        m_chunkIndex.clear();
+
+        if (m_entries.empty()) {
+            return;
+        }
+
+        //! NOTE m_chunkIndex[n] is the first entry of the n-th second of the timeline
+        const msecs_t firstTimestamp = m_entries.front().timestamp;
+        const size_t chunkCount = static_cast<size_t>((m_entries.back().timestamp - firstTimestamp) / CHUNK_DURATION) + 1;
+        m_chunkIndex.reserve(chunkCount);
+
+        size_t entryIdx = 0;
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            const msecs_t chunkStart = firstTimestamp + static_cast<msecs_t>(chunk) * CHUNK_DURATION;
+            while (m_entries[entryIdx].timestamp < chunkStart) {
+                ++entryIdx;
+            }
+
+            m_chunkIndex.push_back(entryIdx);
+        }
+    }
+
+    std::vector<Entry> m_entries;
+    std::vector<size_t> m_chunkIndex;
+    bool m_isFinalized = true;
+};
+}
+
+#endif // MU_AUDIO_EVENTTIMELINE_H
@@ -54,6 +54,16 @@ public:
     virtual async::Notification driverBufferSizeChanged() const = 0;
     virtual samples_t renderStep() const = 0;
 
+    //! NOTE Keep as little audio as possible rendered ahead of the driver, e.g. for MIDI input preview
+    virtual bool isLowLatencyModeEnabled() const = 0;
+    virtual void setLowLatencyModeEnabled(bool enabled) = 0;
+    virtual async::Notification lowLatencyModeEnabledChanged() const = 0;
+
+    //! NOTE Render the tracks of heavy instruments (MuseSampler, VST) ahead of the playhead during playback
+    virtual bool isLookaheadRenderEnabled() const = 0;
+    virtual void setLookaheadRenderEnabled(bool enabled) = 0;
+    virtual async::Notification lookaheadRenderEnabledChanged() const = 0;
+
     virtual unsigned int sampleRate() const = 0;
     virtual void setSampleRate(unsigned int sampleRate) = 0;
     virtual async::Notification sampleRateChanged() const = 0;
@@ -65,6 +75,12 @@ public:
     virtual void setUserSoundFontDirectories(const io::paths_t& paths) = 0;
     virtual async::Channel<io::paths_t> soundFontDirectoriesChanged() const = 0;
 
+    //! NOTE Decoded SF3 samples, shared by all the instances of the app
+    virtual io::path_t soundFontSamplesCachePath() const = 0;
+
+    //! NOTE Max number of voices played by all the Fluid instances together, 0 means no limit
+    virtual int synthesizersVoiceBudget() const = 0;
+
     virtual const synth::SynthesizerState& synthesizerState() const = 0;
     virtual Ret saveSynthesizerState(const synth::SynthesizerState& state) = 0;
     virtual async::Notification synthesizerStateChanged() const = 0;
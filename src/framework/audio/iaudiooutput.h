@@ -51,9 +51,17 @@ public:
     virtual async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
     virtual async::Promise<AudioSignalChanges> masterSignalChanges() const = 0;
 
+    virtual async::Promise<AudioCpuLoadChanges> cpuLoadChanges(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
+
+    //! NOTE The processing times of the audio pipeline since the previous call, e.g. to poll them periodically
+    virtual async::Promise<AudioMetrics> takeMetrics() = 0;
+
     virtual async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                 const SoundTrackFormat& format) = 0;
 
+    //! NOTE Renders the sequence once and encodes it to all the destinations in parallel
+    virtual async::Promise<bool> saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinations& destinations) = 0;
+
     virtual framework::Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) = 0;
 
     virtual void clearAllFx() = 0;
@@ -41,6 +41,9 @@ public:
     virtual void setActive(bool active) = 0;
 
     virtual void process(float* buffer, unsigned int sampleCount) = 0;
+
+    //! NOTE The delay of the output against the input, in samples per channel
+    virtual samples_t latency() const = 0;
 };
 
 using IFxProcessorPtr = std::shared_ptr<IFxProcessor>;
@@ -21,6 +21,8 @@
  */
 #include "audiobuffer.h"
 
+#include <algorithm>
+
 #include "log.h"
 #include "audiosanitizer.h"
 
@@ -107,6 +109,8 @@ void AudioBuffer::init(const audioch_t audioChannelsCount, const samples_t rende
     m_renderStep = renderStep;
 
     m_data.resize(m_samplesPerChannel * m_audioChannelsCount, 0.f);
+
+    m_samplesToReserve = m_lowLatencyMode ? lowLatencyReserve() : DEFAULT_SIZE / 2;
 }
 
 void AudioBuffer::setSource(std::shared_ptr<IAudioSource> source)
@@ -132,15 +136,23 @@ void AudioBuffer::forward()
     const auto currentReadIdx = m_readIndex.load(std::memory_order_acquire);
     size_t nextWriteIdx = currentWriteIdx;
 
-    samples_t framesToReserve = DEFAULT_SIZE / 2;
+    const size_t framesToReserve = m_samplesToReserve.load(std::memory_order_relaxed);
+
+    const auto fillStart = std::chrono::steady_clock::now();
+    samples_t filledSamples = 0;
 
     while (reservedFrames(nextWriteIdx, currentReadIdx) < framesToReserve) {
         m_source->process(m_data.data() + nextWriteIdx, m_renderStep);
 
         nextWriteIdx = incrementWriteIndex(nextWriteIdx, m_renderStep);
+        filledSamples += m_renderStep;
     }
 
     m_writeIndex.store(nextWriteIdx, std::memory_order_release);
+
+    if (filledSamples > 0) {
+        m_fillTime.add(std::chrono::steady_clock::now() - fillStart, filledSamples);
+    }
 }
 
 void AudioBuffer::pop(float* dest, size_t sampleCount)
@@ -152,11 +164,15 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
         return;
     }
 
-    if (reservedFrames(currentWriteIdx, currentReadIdx) < (sampleCount * 2)) {
-        static size_t missingFramesTotal = 0;
-        missingFramesTotal += (sampleCount * 2);
-        LOGD() << "\n FRAMES MISSED " << sampleCount * 2 << ", reserve: " <<
-            reservedFrames(currentWriteIdx, currentReadIdx) << ", total: " << missingFramesTotal;
+    const size_t requiredSamples = sampleCount * m_audioChannelsCount;
+    if (reservedFrames(currentWriteIdx, currentReadIdx) < requiredSamples) {
+        //! NOTE No logging here, this is the driver's thread
+        m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+
+        if (m_lowLatencyMode.load(std::memory_order_relaxed)) {
+            size_t reserve = m_samplesToReserve.load(std::memory_order_relaxed);
+            m_samplesToReserve.store(std::min(reserve + requiredSamples, DEFAULT_SIZE / 2), std::memory_order_relaxed);
+        }
     }
 
     size_t newReadIdx = currentReadIdx;
@@ -190,6 +206,37 @@ void AudioBuffer::setMinSamplesToReserve(size_t lag)
         lag = DEFAULT_SIZE;
     }
     m_minSamplesToReserve = lag;
+
+    if (m_lowLatencyMode) {
+        m_samplesToReserve = lowLatencyReserve();
+    }
+}
+
+void AudioBuffer::setLowLatencyMode(bool enabled)
+{
+    m_lowLatencyMode = enabled;
+    m_samplesToReserve = enabled ? lowLatencyReserve() : DEFAULT_SIZE / 2;
+}
+
+AudioBuffer::Statistics AudioBuffer::statistics() const
+{
+    Statistics result;
+    result.underrunCount = m_underrunCount.load(std::memory_order_relaxed);
+    result.reservedSamples = reservedFrames(m_writeIndex.load(std::memory_order_acquire), m_readIndex.load(std::memory_order_acquire));
+
+    return result;
+}
+
+AudioProcessingTime AudioBuffer::takeFillTime()
+{
+    return m_fillTime.take();
+}
+
+size_t AudioBuffer::lowLatencyReserve() const
+{
+    // two driver buffers, and at least one render step ahead
+    size_t reserve = std::max<size_t>(m_minSamplesToReserve * 2, m_renderStep) * m_audioChannelsCount;
+    return std::min(reserve, DEFAULT_SIZE / 2);
 }
 
 void AudioBuffer::reset()
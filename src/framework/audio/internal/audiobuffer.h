@@ -28,6 +28,7 @@
 
 #include "iaudiosource.h"
 #include "audiotypes.h"
+#include "processingtimecounter.h"
 
 //!Note Somehow clang has this define, but doesn't have symbols for std::hardware_destructive_interference_size
 #if defined(__cpp_lib_hardware_interference_size) && !defined(Q_OS_MACOS)
@@ -51,13 +52,33 @@ public:
     void pop(float* dest, size_t sampleCount);
     void setMinSamplesToReserve(size_t lag);
 
+    //! NOTE In the low latency mode the buffer keeps only a couple of driver buffers rendered ahead,
+    //! instead of a fixed large reserve, and grows the reserve each time the driver runs out of data
+    void setLowLatencyMode(bool enabled);
+
+    struct Statistics {
+        uint64_t underrunCount = 0;
+        size_t reservedSamples = 0; // interleaved samples rendered ahead of the driver
+    };
+
+    //! NOTE Can be called from any thread
+    Statistics statistics() const;
+
+    //! NOTE The time spent on filling the buffer since the last call, can be called from any thread
+    AudioProcessingTime takeFillTime();
+
     void reset();
 
 private:
     size_t reservedFrames(const size_t writeIdx, const size_t readIdx) const;
     size_t incrementWriteIndex(const size_t writeIdx, const samples_t samplesPerChannel);
+    size_t lowLatencyReserve() const;
 
-    size_t m_minSamplesToReserve = 0;
+    std::atomic<size_t> m_minSamplesToReserve = 0;
+    std::atomic<bool> m_lowLatencyMode = false;
+    std::atomic<size_t> m_samplesToReserve = 0;
+    std::atomic<uint64_t> m_underrunCount = 0;
+    ProcessingTimeCounter m_fillTime;
 
     alignas(cache_line_size) std::atomic<size_t> m_writeIndex = 0;
     alignas(cache_line_size) std::atomic<size_t> m_readIndex = 0;
@@ -20,6 +20,9 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "audioconfiguration.h"
+
+#include <algorithm>
+
 #include "settings.h"
 #include "stringutils.h"
 
@@ -43,8 +46,11 @@ static const Settings::Key AUDIO_API_KEY("audio", "io/audioApi");
 static const Settings::Key AUDIO_OUTPUT_DEVICE_ID_KEY("audio", "io/outputDevice");
 static const Settings::Key AUDIO_BUFFER_SIZE_KEY("audio", "io/bufferSize");
 static const Settings::Key AUDIO_SAMPLE_RATE_KEY("audio", "io/sampleRate");
+static const Settings::Key AUDIO_LOW_LATENCY_MODE_KEY("audio", "io/lowLatencyMode");
+static const Settings::Key AUDIO_LOOKAHEAD_RENDER_KEY("audio", "io/lookaheadRender");
 
 static const Settings::Key USER_SOUNDFONTS_PATHS("midi", "application/paths/mySoundfonts");
+static const Settings::Key SYNTHESIZERS_VOICE_BUDGET_KEY("audio", "synthesizers/voiceBudget");
 
 static const AudioResourceId DEFAULT_SOUND_FONT_NAME = "MS Basic";     // "GeneralUser GS v1.471.sf2"; // "MS Basic.sf3";
 static const AudioResourceMeta DEFAULT_AUDIO_RESOURCE_META
@@ -74,11 +80,23 @@ void AudioConfiguration::init()
         m_driverSampleRateChanged.notify();
     });
 
+    settings()->setDefaultValue(AUDIO_LOW_LATENCY_MODE_KEY, Val(false));
+    settings()->valueChanged(AUDIO_LOW_LATENCY_MODE_KEY).onReceive(nullptr, [this](const Val&) {
+        m_lowLatencyModeEnabledChanged.notify();
+    });
+
+    settings()->setDefaultValue(AUDIO_LOOKAHEAD_RENDER_KEY, Val(false));
+    settings()->valueChanged(AUDIO_LOOKAHEAD_RENDER_KEY).onReceive(nullptr, [this](const Val&) {
+        m_lookaheadRenderEnabledChanged.notify();
+    });
+
     settings()->setDefaultValue(USER_SOUNDFONTS_PATHS, Val(globalConfiguration()->userDataPath() + "/SoundFonts"));
     settings()->valueChanged(USER_SOUNDFONTS_PATHS).onReceive(nullptr, [this](const Val&) {
         m_soundFontDirsChanged.send(soundFontDirectories());
     });
 
+    settings()->setDefaultValue(SYNTHESIZERS_VOICE_BUDGET_KEY, Val(1024));
+
     for (const auto& path : userSoundFontDirectories()) {
         fileSystem()->makePath(path);
     }
@@ -143,7 +161,44 @@ async::Notification AudioConfiguration::driverBufferSizeChanged() const
 
 samples_t AudioConfiguration::renderStep() const
 {
-    return 512;
+    static constexpr samples_t DEFAULT_RENDER_STEP = 512;
+
+    //! NOTE The buffer is filled in render steps, so a step larger than the driver buffer adds latency
+    if (isLowLatencyModeEnabled()) {
+        return std::min<samples_t>(DEFAULT_RENDER_STEP, driverBufferSize());
+    }
+
+    return DEFAULT_RENDER_STEP;
+}
+
+bool AudioConfiguration::isLowLatencyModeEnabled() const
+{
+    return settings()->value(AUDIO_LOW_LATENCY_MODE_KEY).toBool();
+}
+
+void AudioConfiguration::setLowLatencyModeEnabled(bool enabled)
+{
+    settings()->setSharedValue(AUDIO_LOW_LATENCY_MODE_KEY, Val(enabled));
+}
+
+async::Notification AudioConfiguration::lowLatencyModeEnabledChanged() const
+{
+    return m_lowLatencyModeEnabledChanged;
+}
+
+bool AudioConfiguration::isLookaheadRenderEnabled() const
+{
+    return settings()->value(AUDIO_LOOKAHEAD_RENDER_KEY).toBool();
+}
+
+void AudioConfiguration::setLookaheadRenderEnabled(bool enabled)
+{
+    settings()->setSharedValue(AUDIO_LOOKAHEAD_RENDER_KEY, Val(enabled));
+}
+
+async::Notification AudioConfiguration::lookaheadRenderEnabledChanged() const
+{
+    return m_lookaheadRenderEnabledChanged;
 }
 
 unsigned int AudioConfiguration::sampleRate() const
@@ -185,6 +240,16 @@ async::Channel<io::paths_t> AudioConfiguration::soundFontDirectoriesChanged() co
     return m_soundFontDirsChanged;
 }
 
+io::path_t AudioConfiguration::soundFontSamplesCachePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/soundfont_samples";
+}
+
+int AudioConfiguration::synthesizersVoiceBudget() const
+{
+    return settings()->value(SYNTHESIZERS_VOICE_BUDGET_KEY).toInt();
+}
+
 AudioInputParams AudioConfiguration::defaultAudioInputParams() const
 {
     AudioInputParams result;
@@ -53,6 +53,14 @@ public:
     async::Notification driverBufferSizeChanged() const override;
     samples_t renderStep() const override;
 
+    bool isLowLatencyModeEnabled() const override;
+    void setLowLatencyModeEnabled(bool enabled) override;
+    async::Notification lowLatencyModeEnabledChanged() const override;
+
+    bool isLookaheadRenderEnabled() const override;
+    void setLookaheadRenderEnabled(bool enabled) override;
+    async::Notification lookaheadRenderEnabledChanged() const override;
+
     unsigned int sampleRate() const override;
     void setSampleRate(unsigned int sampleRate) override;
     async::Notification sampleRateChanged() const override;
@@ -62,6 +70,10 @@ public:
     void setUserSoundFontDirectories(const io::paths_t& paths) override;
     async::Channel<io::paths_t> soundFontDirectoriesChanged() const override;
 
+    io::path_t soundFontSamplesCachePath() const override;
+
+    int synthesizersVoiceBudget() const override;
+
     AudioInputParams defaultAudioInputParams() const override;
 
     const synth::SynthesizerState& defaultSynthesizerState() const;
@@ -84,6 +96,8 @@ private:
     async::Notification m_audioOutputDeviceIdChanged;
     async::Notification m_driverBufferSizeChanged;
     async::Notification m_driverSampleRateChanged;
+    async::Notification m_lowLatencyModeEnabledChanged;
+    async::Notification m_lookaheadRenderEnabledChanged;
 };
 }
 
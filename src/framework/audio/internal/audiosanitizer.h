@@ -39,6 +39,9 @@ public:
     static void setupWorkerThread();
     static std::thread::id workerThread();
     static bool isWorkerThread();
+
+    //! NOTE Marks the calling thread as one of the threads that process the worker's audio in parallel
+    static void setupWorkerPoolThread();
 };
 }
 
@@ -29,10 +29,38 @@
 #include <emscripten/html5.h>
 #endif
 
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#elif defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 using namespace mu::audio;
 
+//! NOTE If a wakeup is missed, the thread still checks in after this time.
+//! The audio buffer holds much more than that, so it only bounds the latency of events
+static constexpr std::chrono::milliseconds MAX_WAIT_TIME(10);
+
 std::thread::id AudioThread::ID;
 
+static void setHighPriority()
+{
+#if defined(Q_OS_WIN)
+    if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST)) {
+        LOGW() << "failed to raise the priority of the audio worker thread";
+    }
+#elif defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+    //! NOTE Real-time scheduling usually needs a privilege (e.g. rtkit or limits.conf on Linux);
+    //! without it the thread keeps the normal priority
+    sched_param param {};
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+        LOGI() << "real-time priority is not available for the audio worker thread";
+    }
+#endif
+}
+
 AudioThread::~AudioThread()
 {
     if (m_running) {
@@ -62,6 +90,7 @@ void AudioThread::stop(const Runnable& onFinished)
 {
     m_onFinished = onFinished;
     m_running = false;
+    wakeup();
     if (m_thread) {
         m_thread->join();
     }
@@ -72,12 +101,36 @@ bool AudioThread::isRunning() const
     return m_running;
 }
 
+void AudioThread::wakeup()
+{
+    //! NOTE Called from the driver's callback, so no lock here.
+    //! Without the lock a wakeup can slip in between the check and the wait of waitForWakeup,
+    //! then the thread is woken up by the next one or by the timeout
+    m_wakeupRequested.store(true, std::memory_order_release);
+    m_wakeupCv.notify_one();
+}
+
+void AudioThread::waitForWakeup()
+{
+    std::unique_lock<std::mutex> lock(m_wakeupMutex);
+    m_wakeupCv.wait_for(lock, MAX_WAIT_TIME, [this]() {
+        return m_wakeupRequested.load(std::memory_order_acquire) || !m_running;
+    });
+    m_wakeupRequested.store(false, std::memory_order_relaxed);
+}
+
 void AudioThread::main()
 {
     mu::runtime::setThreadName("audio_worker");
 
     AudioThread::ID = std::this_thread::get_id();
 
+    setHighPriority();
+
+    mu::async::onThreadInvoke(AudioThread::ID, [this]() {
+        wakeup();
+    });
+
     if (m_onStart) {
         m_onStart();
     }
@@ -89,10 +142,12 @@ void AudioThread::main()
             m_mainLoopBody();
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        waitForWakeup();
     }
 
     if (m_onFinished) {
         m_onFinished();
     }
+
+    mu::async::onThreadInvoke(AudioThread::ID, nullptr);
 }
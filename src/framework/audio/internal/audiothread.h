@@ -26,7 +26,9 @@
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 
 namespace mu::audio {
 class AudioThread
@@ -43,8 +45,13 @@ public:
     void stop(const Runnable& onFinished = nullptr);
     bool isRunning() const;
 
+    //! NOTE The thread sleeps until it is woken up (or for a short timeout) between iterations of the loop:
+    //! call this when there is something to do, e.g. the audio buffer has been read or an event has been queued
+    void wakeup();
+
 private:
     void main();
+    void waitForWakeup();
 
     Runnable m_onStart = nullptr;
     Runnable m_mainLoopBody = nullptr;
@@ -52,6 +59,10 @@ private:
 
     std::unique_ptr<std::thread> m_thread = nullptr;
     std::atomic<bool> m_running = false;
+
+    std::mutex m_wakeupMutex;
+    std::condition_variable m_wakeupCv;
+    std::atomic<bool> m_wakeupRequested = false;
 };
 using AudioThreadPtr = std::shared_ptr<AudioThread>;
 }
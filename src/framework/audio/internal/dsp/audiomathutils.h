@@ -23,12 +23,23 @@
 #ifndef MU_AUDIO_AUDIOMATHUTILS_H
 #define MU_AUDIO_AUDIOMATHUTILS_H
 
+#include <cstddef>
 #include <cstdlib>
 #include <limits>
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define MU_AUDIO_DSP_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MU_AUDIO_DSP_NEON
+#endif
+
 #include "audiotypes.h"
 
 namespace mu::audio::dsp {
+static constexpr size_t MAX_AUDIO_CHANNELS = std::numeric_limits<audioch_t>::max() + 1;
+
 inline float balanceGain(const balance_t balance, const int audioChannelNumber)
 {
     return (audioChannelNumber * 2 - 1) * balance + 1.f;
@@ -59,15 +70,137 @@ inline float sampleReleaseTimeCoefficient(const unsigned int sampleRate, const f
     return std::exp(-std::log(9) / (sampleRate * releaseTimeInSecs));
 }
 
-inline void multiplySamples(float* buffer, const audioch_t& audioChannelsCount,
-                            const audioch_t& audioChannelNumber, const samples_t& samplesPerChannel,
-                            const float& multiplier)
+//! NOTE The kernels below work on the whole interleaved buffer at once, four samples at a time.
+//! SSE and NEON are part of the baseline of every x86-64 and ARM64 target we build for,
+//! so they are selected at compile time; other targets get the plain loops
+
+//! buffer[i] *= multiplier
+inline void multiplySamples(float* buffer, const size_t samplesCount, const float multiplier)
 {
-    for (samples_t i = 0; i < samplesPerChannel; ++i) {
-        int idx = i * audioChannelsCount + audioChannelNumber;
+    size_t i = 0;
+#if defined(MU_AUDIO_DSP_SSE)
+    const __m128 mul = _mm_set1_ps(multiplier);
+    for (; i + 4 <= samplesCount; i += 4) {
+        _mm_storeu_ps(buffer + i, _mm_mul_ps(_mm_loadu_ps(buffer + i), mul));
+    }
+#elif defined(MU_AUDIO_DSP_NEON)
+    const float32x4_t mul = vdupq_n_f32(multiplier);
+    for (; i + 4 <= samplesCount; i += 4) {
+        vst1q_f32(buffer + i, vmulq_f32(vld1q_f32(buffer + i), mul));
+    }
+#endif
+    for (; i < samplesCount; ++i) {
+        buffer[i] *= multiplier;
+    }
+}
 
-        buffer[idx] *= multiplier;
+//! outBuffer[i] += inBuffer[i]
+inline void mixSamples(float* outBuffer, const float* inBuffer, const size_t samplesCount)
+{
+    size_t i = 0;
+#if defined(MU_AUDIO_DSP_SSE)
+    for (; i + 4 <= samplesCount; i += 4) {
+        _mm_storeu_ps(outBuffer + i, _mm_add_ps(_mm_loadu_ps(outBuffer + i), _mm_loadu_ps(inBuffer + i)));
     }
+#elif defined(MU_AUDIO_DSP_NEON)
+    for (; i + 4 <= samplesCount; i += 4) {
+        vst1q_f32(outBuffer + i, vaddq_f32(vld1q_f32(outBuffer + i), vld1q_f32(inBuffer + i)));
+    }
+#endif
+    for (; i < samplesCount; ++i) {
+        outBuffer[i] += inBuffer[i];
+    }
+}
+
+//! Multiplies every audio channel of an interleaved buffer by its own gain
+//! and adds the squares of the resulting samples to squaredSums[audioChannel]
+inline void applyGainsAndSumSquares(float* buffer, const audioch_t audioChannelsCount, const samples_t samplesPerChannel,
+                                    const gain_t* gains, float* squaredSums)
+{
+    const size_t samplesCount = samplesPerChannel * audioChannelsCount;
+    size_t i = 0;
+
+#if defined(MU_AUDIO_DSP_SSE) || defined(MU_AUDIO_DSP_NEON)
+    // the gain pattern repeats within a vector of four samples
+    if (audioChannelsCount == 1 || audioChannelsCount == 2 || audioChannelsCount == 4) {
+        float gainPattern[4];
+        for (size_t lane = 0; lane < 4; ++lane) {
+            gainPattern[lane] = gains[lane % audioChannelsCount];
+        }
+
+        float sumPattern[4];
+#if defined(MU_AUDIO_DSP_SSE)
+        const __m128 gain = _mm_loadu_ps(gainPattern);
+        __m128 sum = _mm_setzero_ps();
+        for (; i + 4 <= samplesCount; i += 4) {
+            __m128 samples = _mm_mul_ps(_mm_loadu_ps(buffer + i), gain);
+            _mm_storeu_ps(buffer + i, samples);
+            sum = _mm_add_ps(sum, _mm_mul_ps(samples, samples));
+        }
+        _mm_storeu_ps(sumPattern, sum);
+#else
+        const float32x4_t gain = vld1q_f32(gainPattern);
+        float32x4_t sum = vdupq_n_f32(0.f);
+        for (; i + 4 <= samplesCount; i += 4) {
+            float32x4_t samples = vmulq_f32(vld1q_f32(buffer + i), gain);
+            vst1q_f32(buffer + i, samples);
+            sum = vmlaq_f32(sum, samples, samples);
+        }
+        vst1q_f32(sumPattern, sum);
+#endif
+
+        for (size_t lane = 0; lane < 4; ++lane) {
+            squaredSums[lane % audioChannelsCount] += sumPattern[lane];
+        }
+    }
+#endif
+
+    // i is always a multiple of the channels count here
+    for (; i < samplesCount; ++i) {
+        const audioch_t audioChNum = static_cast<audioch_t>(i % audioChannelsCount);
+        const float resultSample = buffer[i] * gains[audioChNum];
+        buffer[i] = resultSample;
+        squaredSums[audioChNum] += resultSample * resultSample;
+    }
+}
+
+//! Returns the sum of a[i] * b[i].
+//! The products are summed in four partial sums, in the same order with and without SIMD
+inline float dotProduct(const float* a, const float* b, const size_t count)
+{
+    const size_t vectorCount = count - count % 4;
+    float result = 0.f;
+
+#if defined(MU_AUDIO_DSP_SSE)
+    __m128 sum = _mm_setzero_ps();
+    for (size_t i = 0; i < vectorCount; i += 4) {
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    result = _mm_cvtss_f32(sum);
+#elif defined(MU_AUDIO_DSP_NEON)
+    float32x4_t sum = vdupq_n_f32(0.f);
+    for (size_t i = 0; i < vectorCount; i += 4) {
+        sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+    }
+    float32x2_t halves = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    result = vget_lane_f32(vpadd_f32(halves, halves), 0);
+#else
+    float sums[4] = { 0.f, 0.f, 0.f, 0.f };
+    for (size_t i = 0; i < vectorCount; i += 4) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            sums[lane] += a[i + lane] * b[i + lane];
+        }
+    }
+    result = (sums[0] + sums[2]) + (sums[1] + sums[3]);
+#endif
+
+    for (size_t i = vectorCount; i < count; ++i) {
+        result += a[i] * b[i];
+    }
+
+    return result;
 }
 
 template<typename T>
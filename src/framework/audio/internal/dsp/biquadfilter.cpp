@@ -0,0 +1,141 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "biquadfilter.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+static constexpr audioch_t MAX_LANES = 4;
+
+void BiquadFilter::setCoefficients(const float b0, const float b1, const float b2, const float a0, const float a1, const float a2)
+{
+    m_b0 = b0 / a0;
+    m_b1 = b1 / a0;
+    m_b2 = b2 / a0;
+    m_a1 = a1 / a0;
+    m_a2 = a2 / a0;
+}
+
+void BiquadFilter::reset()
+{
+    m_z1.fill(0.f);
+    m_z2.fill(0.f);
+}
+
+void BiquadFilter::process(float* buffer, const audioch_t audioChannelsCount, const samples_t samplesPerChannel)
+{
+#if defined(MU_AUDIO_DSP_SSE) || defined(MU_AUDIO_DSP_NEON)
+    if (audioChannelsCount == 0 || audioChannelsCount > MAX_LANES) {
+        processScalar(buffer, audioChannelsCount, samplesPerChannel);
+        return;
+    }
+
+    //! NOTE The filter is recursive, so the samples of one channel can't be computed in parallel,
+    //! but the channels are independent. The unused lanes compute zeros
+    const size_t frameSize = audioChannelsCount * sizeof(float);
+    float frame[MAX_LANES] = {};
+    float z1[MAX_LANES] = {};
+    float z2[MAX_LANES] = {};
+    std::copy(m_z1.begin(), m_z1.begin() + audioChannelsCount, z1);
+    std::copy(m_z2.begin(), m_z2.begin() + audioChannelsCount, z2);
+
+#if defined(MU_AUDIO_DSP_SSE)
+    const __m128 b0 = _mm_set1_ps(m_b0);
+    const __m128 b1 = _mm_set1_ps(m_b1);
+    const __m128 b2 = _mm_set1_ps(m_b2);
+    const __m128 a1 = _mm_set1_ps(m_a1);
+    const __m128 a2 = _mm_set1_ps(m_a2);
+    __m128 s1 = _mm_loadu_ps(z1);
+    __m128 s2 = _mm_loadu_ps(z2);
+
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        float* samples = buffer + s * audioChannelsCount;
+        std::memcpy(frame, samples, frameSize);
+
+        const __m128 x = _mm_loadu_ps(frame);
+        const __m128 y = _mm_add_ps(_mm_mul_ps(b0, x), s1);
+        s1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1, x), _mm_mul_ps(a1, y)), s2);
+        s2 = _mm_sub_ps(_mm_mul_ps(b2, x), _mm_mul_ps(a2, y));
+
+        _mm_storeu_ps(frame, y);
+        std::memcpy(samples, frame, frameSize);
+    }
+
+    _mm_storeu_ps(z1, s1);
+    _mm_storeu_ps(z2, s2);
+#else
+    const float32x4_t b0 = vdupq_n_f32(m_b0);
+    const float32x4_t b1 = vdupq_n_f32(m_b1);
+    const float32x4_t b2 = vdupq_n_f32(m_b2);
+    const float32x4_t a1 = vdupq_n_f32(m_a1);
+    const float32x4_t a2 = vdupq_n_f32(m_a2);
+    float32x4_t s1 = vld1q_f32(z1);
+    float32x4_t s2 = vld1q_f32(z2);
+
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        float* samples = buffer + s * audioChannelsCount;
+        std::memcpy(frame, samples, frameSize);
+
+        const float32x4_t x = vld1q_f32(frame);
+        const float32x4_t y = vaddq_f32(vmulq_f32(b0, x), s1);
+        s1 = vaddq_f32(vsubq_f32(vmulq_f32(b1, x), vmulq_f32(a1, y)), s2);
+        s2 = vsubq_f32(vmulq_f32(b2, x), vmulq_f32(a2, y));
+
+        vst1q_f32(frame, y);
+        std::memcpy(samples, frame, frameSize);
+    }
+
+    vst1q_f32(z1, s1);
+    vst1q_f32(z2, s2);
+#endif
+
+    std::copy(z1, z1 + audioChannelsCount, m_z1.begin());
+    std::copy(z2, z2 + audioChannelsCount, m_z2.begin());
+#else
+    processScalar(buffer, audioChannelsCount, samplesPerChannel);
+#endif
+}
+
+void BiquadFilter::processScalar(float* buffer, const audioch_t audioChannelsCount, const samples_t samplesPerChannel)
+{
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+        float z1 = m_z1[audioChNum];
+        float z2 = m_z2[audioChNum];
+
+        for (samples_t s = 0; s < samplesPerChannel; ++s) {
+            float& sample = buffer[s * audioChannelsCount + audioChNum];
+
+            const float x = sample;
+            const float y = m_b0 * x + z1;
+            z1 = m_b1 * x - m_a1 * y + z2;
+            z2 = m_b2 * x - m_a2 * y;
+
+            sample = y;
+        }
+
+        m_z1[audioChNum] = z1;
+        m_z2[audioChNum] = z2;
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_DSP_BIQUADFILTER_H
+#define MU_AUDIO_DSP_BIQUADFILTER_H
+
+#include <array>
+
+#include "audiotypes.h"
+#include "audiomathutils.h"
+
+namespace mu::audio::dsp {
+//! NOTE A second order IIR filter in the transposed direct form II.
+//! The coefficients are normalized by a0 once, so there is no division per sample,
+//! and every audio channel of the interleaved buffer has its own state
+class BiquadFilter
+{
+public:
+    BiquadFilter() = default;
+
+    void setCoefficients(const float b0, const float b1, const float b2, const float a0, const float a1, const float a2);
+    void reset();
+
+    //! NOTE Up to four audio channels are filtered in the lanes of one SIMD vector,
+    //! the result is the same as the one of processScalar
+    void process(float* buffer, const audioch_t audioChannelsCount, const samples_t samplesPerChannel);
+    void processScalar(float* buffer, const audioch_t audioChannelsCount, const samples_t samplesPerChannel);
+
+private:
+    float m_b0 = 1.f;
+    float m_b1 = 0.f;
+    float m_b2 = 0.f;
+    float m_a1 = 0.f;
+    float m_a2 = 0.f;
+
+    std::array<float, MAX_AUDIO_CHANNELS> m_z1 = {};
+    std::array<float, MAX_AUDIO_CHANNELS> m_z2 = {};
+};
+}
+
+#endif // MU_AUDIO_DSP_BIQUADFILTER_H
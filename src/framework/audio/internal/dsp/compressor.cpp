@@ -73,9 +73,7 @@ void Compressor::process(const float linearRms, float* buffer, const audioch_t&
     float currentGainReduction = std::min(gainFact, m_previousGainReduction);
 
     // apply gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, currentGainReduction);
-    }
+    multiplySamples(buffer, samplesPerChannel * audioChannelsCount, currentGainReduction);
 
     m_previousGainReduction = currentGainReduction;
 }
@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "polyphaseresampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "audiomathutils.h"
+
+#include "log.h"
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+//! NOTE About 80 dB of stopband attenuation
+static constexpr double KAISER_BETA = 7.857;
+
+static double besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 50 && term > sum * 1e-12; ++k) {
+        const double f = x / (2.0 * k);
+        term *= f * f;
+        sum += term;
+    }
+    return sum;
+}
+
+PolyphaseResampler::PolyphaseResampler(const audioch_t audioChannelsCount, const unsigned int sampleRateIn,
+                                       const unsigned int sampleRateOut)
+    : m_audioChannelsCount(audioChannelsCount), m_sampleRateIn(sampleRateIn), m_sampleRateOut(sampleRateOut)
+{
+    IF_ASSERT_FAILED(sampleRateIn > 0 && sampleRateOut > 0) {
+        m_sampleRateIn = m_sampleRateOut = 1;
+    }
+
+    const unsigned int divider = std::gcd(m_sampleRateIn, m_sampleRateOut);
+    m_L = m_sampleRateOut / divider;
+    m_M = m_sampleRateIn / divider;
+
+    //! NOTE For the unusual ratios the phase is rounded down to one of MAX_PHASES
+    m_phasesCount = std::min<size_t>(m_L, MAX_PHASES);
+
+    initFilter();
+
+    m_history.resize(m_audioChannelsCount * 2 * TAPS, 0.f);
+}
+
+audioch_t PolyphaseResampler::audioChannelsCount() const
+{
+    return m_audioChannelsCount;
+}
+
+unsigned int PolyphaseResampler::sampleRateIn() const
+{
+    return m_sampleRateIn;
+}
+
+unsigned int PolyphaseResampler::sampleRateOut() const
+{
+    return m_sampleRateOut;
+}
+
+void PolyphaseResampler::initFilter()
+{
+    //! NOTE The prototype works at phasesCount times the input rate,
+    //! its cutoff is a bit below the half of the lower rate
+    const size_t length = m_phasesCount * TAPS;
+    const double cutoff = 0.45 * std::min(1.0, double(m_L) / m_M) / m_phasesCount; // cycles per prototype sample
+    const double center = (length - 1) / 2.0;
+
+    std::vector<double> prototype(length);
+    for (size_t i = 0; i < length; ++i) {
+        const double t = i - center;
+        const double sinc = t == 0 ? 2 * cutoff : std::sin(2 * M_PI * cutoff * t) / (M_PI * t);
+        const double r = t / center;
+        const double window = besselI0(KAISER_BETA * std::sqrt(std::max(0.0, 1.0 - r * r))) / besselI0(KAISER_BETA);
+        prototype[i] = sinc * window;
+    }
+
+    //! NOTE The phase p takes the taps p, p + phasesCount, ... of the prototype.
+    //! Each phase is normalized to a gain of 1, so a constant input gives the same constant
+    m_filter.assign(length, 0.f);
+    for (size_t p = 0; p < m_phasesCount; ++p) {
+        double sum = 0.0;
+        for (size_t k = 0; k < TAPS; ++k) {
+            sum += prototype[k * m_phasesCount + p];
+        }
+
+        for (size_t k = 0; k < TAPS; ++k) {
+            m_filter[p * TAPS + (TAPS - 1 - k)] = static_cast<float>(prototype[k * m_phasesCount + p] / sum);
+        }
+    }
+}
+
+void PolyphaseResampler::pushFrame(const float* frame)
+{
+    for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
+        float* history = m_history.data() + audioChNum * 2 * TAPS;
+        history[m_historyPos] = frame[audioChNum];
+        history[m_historyPos + TAPS] = frame[audioChNum];
+    }
+
+    m_historyPos = (m_historyPos + 1) % TAPS;
+}
+
+samples_t PolyphaseResampler::process(const float* input, const samples_t inputFrames, float* output,
+                                      const samples_t maxOutputFrames, samples_t& usedInputFrames)
+{
+    usedInputFrames = 0;
+    samples_t outputFrames = 0;
+
+    while (outputFrames < maxOutputFrames) {
+        while (m_pendingInputFrames > 0 && usedInputFrames < inputFrames) {
+            pushFrame(input + usedInputFrames * m_audioChannelsCount);
+            ++usedInputFrames;
+            --m_pendingInputFrames;
+        }
+
+        if (m_pendingInputFrames > 0) {
+            break;
+        }
+
+        // the window of the newest TAPS frames starts at m_historyPos
+        const size_t phase = size_t(m_phase) * m_phasesCount / m_L;
+        const float* coefficients = m_filter.data() + phase * TAPS;
+        float* frame = output + outputFrames * m_audioChannelsCount;
+
+        for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
+            const float* window = m_history.data() + audioChNum * 2 * TAPS + m_historyPos;
+            frame[audioChNum] = dotProduct(window, coefficients, TAPS);
+        }
+
+        ++outputFrames;
+
+        m_phase += m_M;
+        m_pendingInputFrames += m_phase / m_L;
+        m_phase %= m_L;
+    }
+
+    return outputFrames;
+}
+
+samples_t PolyphaseResampler::outputFramesFor(const samples_t inputFrames) const
+{
+    return inputFrames * m_L / m_M;
+}
+
+void PolyphaseResampler::reset()
+{
+    std::fill(m_history.begin(), m_history.end(), 0.f);
+    m_historyPos = 0;
+    m_phase = 0;
+    m_pendingInputFrames = 1;
+}
@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_DSP_POLYPHASERESAMPLER_H
+#define MU_AUDIO_DSP_POLYPHASERESAMPLER_H
+
+#include <vector>
+
+#include "audiotypes.h"
+
+namespace mu::audio::dsp {
+//! NOTE Converts an interleaved stream from one sample rate to another, block by block.
+//! The rates are reduced to L/M, and every output frame is the dot product of the last
+//! TAPS input frames with one phase of a Kaiser windowed sinc.
+//! The filter and the history are allocated in the constructor, process() doesn't allocate,
+//! so it can run in the audio graph. The output is delayed by TAPS / 2 input frames
+class PolyphaseResampler
+{
+public:
+    static constexpr size_t TAPS = 32;
+    static constexpr size_t MAX_PHASES = 1024;
+
+    PolyphaseResampler(const audioch_t audioChannelsCount, const unsigned int sampleRateIn, const unsigned int sampleRateOut);
+
+    audioch_t audioChannelsCount() const;
+    unsigned int sampleRateIn() const;
+    unsigned int sampleRateOut() const;
+
+    //! NOTE Reads up to inputFrames frames from input and writes up to maxOutputFrames frames to output.
+    //! Returns the count of written frames, usedInputFrames is the count of read ones.
+    //! The input isn't needed after the call, the frames of the history are copied
+    samples_t process(const float* input, const samples_t inputFrames, float* output, const samples_t maxOutputFrames,
+                      samples_t& usedInputFrames);
+
+    //! NOTE The count of output frames for inputFrames frames, ignoring the state
+    samples_t outputFramesFor(const samples_t inputFrames) const;
+
+    void reset();
+
+private:
+    void initFilter();
+    void pushFrame(const float* frame);
+
+    audioch_t m_audioChannelsCount = 0;
+    unsigned int m_sampleRateIn = 0;
+    unsigned int m_sampleRateOut = 0;
+
+    // output frame n is at input frame n * M / L
+    unsigned int m_L = 1;
+    unsigned int m_M = 1;
+    size_t m_phasesCount = 1;
+
+    std::vector<float> m_filter; // m_phasesCount * TAPS, the taps of each phase are reversed
+    std::vector<float> m_history; // per channel, 2 * TAPS: every frame is written twice to keep the window contiguous
+    size_t m_historyPos = 0;
+
+    unsigned int m_phase = 0; // (n * M) mod L
+    samples_t m_pendingInputFrames = 1; // before the next output frame
+};
+}
+
+#endif // MU_AUDIO_DSP_POLYPHASERESAMPLER_H
@@ -28,6 +28,9 @@ using namespace mu;
 using namespace mu::audio;
 using namespace mu::audio::encode;
 
+//!Note See thirdparty/lame/API
+static constexpr size_t LAME_EXTRA_BUFFER_SIZE = 7200;
+
 struct LameHandler
 {
     LameHandler() = default;
@@ -79,30 +82,38 @@ bool Mp3Encoder::init(const io::path_t& path, const SoundTrackFormat& format, co
     return true;
 }
 
-size_t Mp3Encoder::requiredOutputBufferSize(samples_t totalSamplesNumber) const
+size_t Mp3Encoder::requiredOutputBufferSize(samples_t samplesPerChannel) const
 {
-    //!Note See thirdparty/lame/API
+    //!Note The worst case is 1.25 * samplesPerChannel + 7200 bytes
 
-    return totalSamplesNumber;
+    return static_cast<size_t>(1.25 * samplesPerChannel) + LAME_EXTRA_BUFFER_SIZE;
 }
 
 size_t Mp3Encoder::encode(samples_t samplesPerChannel, const float* input)
 {
-    m_progress.progressChanged.send(0, 100, "");
+    prepareOutputBuffer(samplesPerChannel);
 
     int encodedBytes = lame_encode_buffer_interleaved_ieee_float(m_handler->flags, input, samplesPerChannel,
                                                                  m_outputBuffer.data(),
                                                                  static_cast<int>(m_outputBuffer.size()));
 
-    m_progress.progressChanged.send(50, 100, "");
-    size_t result = std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream);
-    m_progress.progressChanged.send(100, 100, "");
+    if (encodedBytes < 0) {
+        LOGE() << "lame encoding error: " << encodedBytes;
+        return 0;
+    }
+
+    if (encodedBytes == 0) {
+        //! NOTE lame may keep a short block for the next frame
+        return samplesPerChannel;
+    }
 
-    return result;
+    return std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream);
 }
 
 size_t Mp3Encoder::flush()
 {
+    prepareOutputBuffer(0);
+
     int encodedBytes = lame_encode_flush(m_handler->flags,
                                          m_outputBuffer.data(),
                                          static_cast<int>(m_outputBuffer.size()));
@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_PROCESSINGTIMECOUNTER_H
+#define MU_AUDIO_PROCESSINGTIMECOUNTER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "audiotypes.h"
+
+namespace mu::audio {
+//! NOTE Accumulates the time spent on one stage of the audio pipeline.
+//! add() is called by one thread at a time (the one that processes the stage) and doesn't lock,
+//! take() may be called from any thread and starts a new period
+class ProcessingTimeCounter
+{
+public:
+    void add(std::chrono::steady_clock::duration time, samples_t samplesPerChannel)
+    {
+        const uint64_t nsecs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+
+        m_callCount.fetch_add(1, std::memory_order_relaxed);
+        m_totalNsecs.fetch_add(nsecs, std::memory_order_relaxed);
+        m_samplesPerChannel.fetch_add(samplesPerChannel, std::memory_order_relaxed);
+
+        if (nsecs > m_maxNsecs.load(std::memory_order_relaxed)) {
+            m_maxNsecs.store(nsecs, std::memory_order_relaxed);
+        }
+    }
+
+    AudioProcessingTime take()
+    {
+        static constexpr double NSECS_PER_MSEC = 1000000.0;
+
+        AudioProcessingTime result;
+        result.callCount = m_callCount.exchange(0, std::memory_order_relaxed);
+        result.totalMsecs = m_totalNsecs.exchange(0, std::memory_order_relaxed) / NSECS_PER_MSEC;
+        result.maxMsecs = m_maxNsecs.exchange(0, std::memory_order_relaxed) / NSECS_PER_MSEC;
+        result.samplesPerChannel = m_samplesPerChannel.exchange(0, std::memory_order_relaxed);
+
+        return result;
+    }
+
+private:
+    std::atomic<uint64_t> m_callCount = 0;
+    std::atomic<uint64_t> m_totalNsecs = 0;
+    std::atomic<uint64_t> m_maxNsecs = 0;
+    std::atomic<uint64_t> m_samplesPerChannel = 0;
+};
+}
+
+#endif // MU_AUDIO_PROCESSINGTIMECOUNTER_H
@@ -29,70 +29,123 @@
 #include "internal/encoders/wavencoder.h"
 
 #include "defer.h"
+#include "runtime.h"
 
 using namespace mu;
 using namespace mu::audio;
 using namespace mu::audio::soundtrack;
 
-static constexpr int WRITE_STEPS = 2;
-static constexpr int PREPARE_STEP = 0;
-static constexpr int ENCODE_STEP = 1;
+//! NOTE The mixer renders every channel of a block in one parallel job, the block is split into
+//! render steps inside the channels. Larger blocks mean fewer synchronization points between the
+//! channel threads and fewer hand-overs to the encoder thread
+static constexpr samples_t RENDER_STEPS_PER_BLOCK = 32;
 
-SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration,
-                                   IAudioSourcePtr source)
+//! NOTE Enough to keep both threads busy, about 3 seconds of audio with the default render step
+static constexpr size_t RING_BLOCKS_COUNT = 8;
+
+static constexpr int RENDER_PROGRESS_PART = 80;
+static constexpr int ENCODE_PROGRESS_PART = 20;
+
+SoundTrackWriter::SoundTrackWriter(const SoundTrackDestinations& destinations, const msecs_t totalDuration, IAudioSourcePtr source)
     : m_source(std::move(source))
 {
-    if (!m_source) {
+    if (!m_source || destinations.empty()) {
         return;
     }
 
-    samples_t totalSamplesNumber = (totalDuration / 1000000.f) * sizeof(float) * format.sampleRate;
-    m_inputBuffer.resize(totalSamplesNumber);
-    m_intermBuffer.resize(config()->renderStep() * config()->audioChannelsCount());
-
-    m_encoderPtr = createEncoder(format.type);
-
-    if (!m_encoderPtr) {
-        return;
+    m_sampleRate = destinations.front().format.sampleRate;
+    m_totalSamplesPerChannel = (totalDuration / 1000000.f) * m_sampleRate;
+
+    for (const SoundTrackDestination& destination : destinations) {
+        if (destination.format.sampleRate != m_sampleRate
+            || destination.format.audioChannelsNumber != destinations.front().format.audioChannelsNumber) {
+            LOGE() << "all the destinations must have the same sample rate and channels number, path: " << destination.path;
+            m_sinks.clear();
+            return;
+        }
+
+        encode::AbstractAudioEncoderPtr encoder = createEncoder(destination.format.type);
+        if (!encoder) {
+            m_sinks.clear();
+            return;
+        }
+
+        if (!encoder->init(destination.path, destination.format, m_totalSamplesPerChannel)) {
+            LOGE() << "failed to init the encoder, path: " << destination.path;
+            m_sinks.clear();
+            return;
+        }
+
+        Sink sink;
+        sink.encoder = std::move(encoder);
+        m_sinks.push_back(std::move(sink));
     }
 
-    m_encoderPtr->init(destination, format, totalSamplesNumber);
-    m_encoderPtr->progress().progressChanged.onReceive(this, [this](int64_t current, int64_t total, std::string) {
-        sendStepProgress(ENCODE_STEP, current, total);
-    });
+    const size_t blockSize = config()->renderStep() * RENDER_STEPS_PER_BLOCK * config()->audioChannelsCount();
+    m_blocks.resize(RING_BLOCKS_COUNT);
+    for (Block& block : m_blocks) {
+        block.samples.resize(blockSize);
+    }
 }
 
 bool SoundTrackWriter::write()
 {
     TRACEFUNC;
 
-    if (!m_source || !m_encoderPtr) {
+    if (!m_source || m_sinks.empty()) {
         return false;
     }
 
     AudioEngine::instance()->setMode(RenderMode::OfflineMode);
+    AudioEngine::instance()->mixer()->setRenderStep(config()->renderStep());
 
-    m_source->setSampleRate(m_encoderPtr->format().sampleRate);
+    m_source->setSampleRate(m_sampleRate);
     m_source->setIsActive(true);
 
     DEFER {
-        m_encoderPtr->flush();
+        for (Sink& sink : m_sinks) {
+            sink.encoder->flush();
+        }
 
+        AudioEngine::instance()->mixer()->setRenderStep(0);
         AudioEngine::instance()->setMode(RenderMode::RealTimeMode);
 
         m_source->setSampleRate(AudioEngine::instance()->sampleRate());
         m_source->setIsActive(false);
     };
 
-    if (!prepareInputBuffer()) {
-        return false;
+    m_renderedBlocks = 0;
+    m_renderedSamples = 0;
+    m_renderingFinished = false;
+    m_encodingFailed = false;
+
+    for (Sink& sink : m_sinks) {
+        sink.encodedBlocks = 0;
+        sink.encodedSamples = 0;
+        sink.finished = false;
+        sink.thread = std::thread(&SoundTrackWriter::th_encode, this, &sink);
     }
 
-    if (m_encoderPtr->encode(m_inputBuffer.size() / sizeof(float), m_inputBuffer.data()) == 0) {
-        return false;
+    bool ok = render();
+
+    {
+        std::unique_lock lock(m_pipelineMutex);
+        m_renderingFinished = true;
+        m_pipelineChanged.notify_all();
+
+        m_pipelineChanged.wait(lock, [this]() {
+            sendProgress(m_renderedSamples, encodedSamples());
+            return encodingFinished();
+        });
+
+        ok = ok && !m_encodingFailed;
     }
 
-    return true;
+    for (Sink& sink : m_sinks) {
+        sink.thread.join();
+    }
+
+    return ok;
 }
 
 framework::Progress SoundTrackWriter::progress()
@@ -111,40 +164,136 @@ encode::AbstractAudioEncoderPtr SoundTrackWriter::createEncoder(const SoundTrack
     }
 }
 
-bool SoundTrackWriter::prepareInputBuffer()
+bool SoundTrackWriter::render()
 {
-    size_t inputBufferOffset = 0;
-    size_t inputBufferMaxOffset = m_inputBuffer.size();
+    if (m_totalSamplesPerChannel == 0) {
+        LOGI() << "No audio to export";
+        return false;
+    }
+
+    const samples_t blockSize = config()->renderStep() * RENDER_STEPS_PER_BLOCK;
+
+    samples_t renderedSamples = 0;
+    size_t renderedBlocks = 0;
+
+    sendProgress(0, 0);
+
+    while (renderedSamples < m_totalSamplesPerChannel) {
+        samples_t encodedSamples = 0;
+
+        {
+            std::unique_lock lock(m_pipelineMutex);
+            m_pipelineChanged.wait(lock, [this, renderedBlocks]() {
+                return renderedBlocks - encodedBlocks() < m_blocks.size() || m_encodingFailed;
+            });
+
+            if (m_encodingFailed) {
+                return false;
+            }
 
-    sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
+            encodedSamples = this->encodedSamples();
+        }
 
-    samples_t renderStep = config()->renderStep();
+        sendProgress(renderedSamples, encodedSamples);
 
-    while (inputBufferOffset < inputBufferMaxOffset) {
-        m_source->process(m_intermBuffer.data(), renderStep);
+        //! NOTE All the encoder threads are done with this block, they only read blocks before m_renderedBlocks
+        Block& block = m_blocks[renderedBlocks % m_blocks.size()];
+        block.samplesPerChannel = std::min(blockSize, m_totalSamplesPerChannel - renderedSamples);
 
-        size_t samplesToCopy = std::min(m_intermBuffer.size(), inputBufferMaxOffset - inputBufferOffset);
+        m_source->process(block.samples.data(), block.samplesPerChannel);
 
-        std::copy(m_intermBuffer.begin(),
-                  m_intermBuffer.begin() + samplesToCopy,
-                  m_inputBuffer.begin() + inputBufferOffset);
+        renderedSamples += block.samplesPerChannel;
+        ++renderedBlocks;
 
-        inputBufferOffset += samplesToCopy;
-        sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
+        std::lock_guard lock(m_pipelineMutex);
+        m_renderedBlocks = renderedBlocks;
+        m_renderedSamples = renderedSamples;
+        m_pipelineChanged.notify_all();
     }
 
-    if (inputBufferOffset == 0) {
-        LOGI() << "No audio to export";
-        return false;
+    return true;
+}
+
+void SoundTrackWriter::th_encode(Sink* sink)
+{
+    runtime::setThreadName("audio_export_encoder");
+
+    size_t encodedBlocks = 0;
+    samples_t encodedSamples = 0;
+
+    while (true) {
+        {
+            std::unique_lock lock(m_pipelineMutex);
+            m_pipelineChanged.wait(lock, [this, encodedBlocks]() {
+                return m_renderedBlocks > encodedBlocks || m_renderingFinished || m_encodingFailed;
+            });
+
+            if (m_renderedBlocks == encodedBlocks || m_encodingFailed) {
+                break;
+            }
+        }
+
+        const Block& block = m_blocks[encodedBlocks % m_blocks.size()];
+        bool ok = sink->encoder->encode(block.samplesPerChannel, block.samples.data()) > 0;
+
+        encodedSamples += block.samplesPerChannel;
+        ++encodedBlocks;
+
+        std::lock_guard lock(m_pipelineMutex);
+        if (!ok) {
+            m_encodingFailed = true;
+            m_pipelineChanged.notify_all();
+            break;
+        }
+
+        sink->encodedBlocks = encodedBlocks;
+        sink->encodedSamples = encodedSamples;
+        m_pipelineChanged.notify_all();
+    }
+
+    std::lock_guard lock(m_pipelineMutex);
+    sink->finished = true;
+    m_pipelineChanged.notify_all();
+}
+
+size_t SoundTrackWriter::encodedBlocks() const
+{
+    size_t result = m_renderedBlocks;
+    for (const Sink& sink : m_sinks) {
+        result = std::min(result, sink.encodedBlocks);
+    }
+
+    return result;
+}
+
+samples_t SoundTrackWriter::encodedSamples() const
+{
+    samples_t result = m_renderedSamples;
+    for (const Sink& sink : m_sinks) {
+        result = std::min(result, sink.encodedSamples);
+    }
+
+    return result;
+}
+
+bool SoundTrackWriter::encodingFinished() const
+{
+    for (const Sink& sink : m_sinks) {
+        if (!sink.finished) {
+            return false;
+        }
     }
 
     return true;
 }
 
-void SoundTrackWriter::sendStepProgress(int step, int64_t current, int64_t total)
+void SoundTrackWriter::sendProgress(samples_t renderedSamples, samples_t encodedSamples)
 {
-    int stepRange = step == PREPARE_STEP ? 80 : 20;
-    int stepProgressStart = step == PREPARE_STEP ? 0 : 80;
-    int stepCurrentProgress = stepProgressStart + ((current * 100 / total) * stepRange) / 100;
-    m_progress.progressChanged.send(stepCurrentProgress, 100, "");
+    if (m_totalSamplesPerChannel == 0) {
+        return;
+    }
+
+    int64_t current = (static_cast<int64_t>(renderedSamples) * RENDER_PROGRESS_PART
+                       + static_cast<int64_t>(encodedSamples) * ENCODE_PROGRESS_PART) / m_totalSamplesPerChannel;
+    m_progress.progressChanged.send(current, 100, "");
 }
@@ -25,6 +25,9 @@
 
 #include <vector>
 #include <cstdio>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include "async/asyncable.h"
 #include "modularity/ioc.h"
@@ -39,23 +42,50 @@ class SoundTrackWriter : public async::Asyncable
 {
     INJECT_STATIC(audio, IAudioConfiguration, config)
 public:
-    SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration, IAudioSourcePtr source);
+    SoundTrackWriter(const SoundTrackDestinations& destinations, const msecs_t totalDuration, IAudioSourcePtr source);
 
     bool write();
     framework::Progress progress();
 
 private:
+    struct Block {
+        std::vector<float> samples;
+        samples_t samplesPerChannel = 0;
+    };
+
+    struct Sink {
+        encode::AbstractAudioEncoderPtr encoder = nullptr;
+        std::thread thread;
+        size_t encodedBlocks = 0;
+        samples_t encodedSamples = 0;
+        bool finished = false;
+    };
+
     encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType& type) const;
-    bool prepareInputBuffer();
+    bool render();
+    void th_encode(Sink* sink);
 
-    void sendStepProgress(int step, int64_t current, int64_t total);
+    size_t encodedBlocks() const;
+    samples_t encodedSamples() const;
+    bool encodingFinished() const;
 
-    IAudioSourcePtr m_source = nullptr;
+    void sendProgress(samples_t renderedSamples, samples_t encodedSamples);
 
-    std::vector<float> m_inputBuffer;
-    std::vector<float> m_intermBuffer;
+    IAudioSourcePtr m_source = nullptr;
+    sample_rate_t m_sampleRate = 0;
+    samples_t m_totalSamplesPerChannel = 0;
 
-    encode::AbstractAudioEncoderPtr m_encoderPtr = nullptr;
+    //! NOTE A bounded ring of blocks between the renderer and the encoder threads, one thread per sink,
+    //! so the memory doesn't depend on the score length. The renderer waits while the slowest sink
+    //! hasn't freed a block. The positions are counted in blocks and are guarded by m_pipelineMutex
+    std::vector<Block> m_blocks;
+    std::vector<Sink> m_sinks;
+    size_t m_renderedBlocks = 0;
+    samples_t m_renderedSamples = 0;
+    bool m_renderingFinished = false;
+    bool m_encodingFailed = false;
+    std::mutex m_pipelineMutex;
+    std::condition_variable m_pipelineChanged;
 
     framework::Progress m_progress;
 };
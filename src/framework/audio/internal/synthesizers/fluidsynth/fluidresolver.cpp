@@ -23,6 +23,8 @@
 #include "fluidresolver.h"
 
 #include "internal/audiosanitizer.h"
+#include "sfsamplestorage.h"
+#include "fluidvoicebudget.h"
 
 #include "log.h"
 
@@ -35,6 +37,9 @@ FluidResolver::FluidResolver()
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    SoundFontSampleStorage::init(configuration()->soundFontSamplesCachePath());
+    FluidVoiceBudget::instance()->setMaxVoices(configuration()->synthesizersVoiceBudget());
+
     refresh();
     soundFontRepository()->soundFontPathsChanged().onNotify(this, [this]() {
         refresh();
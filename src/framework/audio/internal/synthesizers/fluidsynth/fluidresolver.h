@@ -28,6 +28,7 @@
 #include "async/asyncable.h"
 #include "modularity/ioc.h"
 #include "audio/isoundfontrepository.h"
+#include "audio/iaudioconfiguration.h"
 
 #include "isynthresolver.h"
 #include "fluidsynth.h"
@@ -36,6 +37,7 @@ namespace mu::audio::synth {
 class FluidResolver : public ISynthResolver::IResolver, public async::Asyncable
 {
     INJECT(audio, ISoundFontRepository, soundFontRepository)
+    INJECT(audio, IAudioConfiguration, configuration)
 public:
     explicit FluidResolver();
 
@@ -44,30 +44,51 @@ int FluidSequencer::currentExpressionLevel() const
 
 void FluidSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
-    m_offStreamEvents.clear();
+    Timeline events;
+    updatePlaybackEvents(events, changes);
+
+    m_offStreamEvents = std::move(events);
     m_offStreamFlushed.notify();
-    updatePlaybackEvents(m_offStreamEvents, changes);
     updateOffSequenceIterator();
 }
 
 void FluidSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
-    m_mainStreamEvents.clear();
+    Timeline events;
+    updatePlaybackEvents(events, changes);
+
+    m_mainStreamEvents = std::move(events);
     m_mainStreamFlushed.notify();
-    updatePlaybackEvents(m_mainStreamEvents, changes);
+    updateMainSequenceIterator();
+}
+
+void FluidSequencer::applyMainStreamDelta(const mpe::PlaybackEventsMap& removedEvents, const mpe::PlaybackEventsMap& insertedEvents)
+{
+    if (!removedEvents.empty()) {
+        Timeline expiredEvents;
+        updatePlaybackEvents(expiredEvents, removedEvents);
+        m_mainStreamEvents.remove(expiredEvents);
+        m_mainStreamFlushed.notify();
+    }
+
+    Timeline newEvents;
+    updatePlaybackEvents(newEvents, insertedEvents);
+    m_mainStreamEvents.merge(newEvents);
+
     updateMainSequenceIterator();
 }
 
 void FluidSequencer::updateDynamicChanges(const mpe::DynamicLevelMap& changes)
 {
     m_dynamicEvents.clear();
+    m_dynamicEvents.reserve(changes.size());
 
     for (const auto& pair : changes) {
         midi::Event event(midi::Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
         event.setIndex(midi::EXPRESSION_CONTROLLER);
         event.setData(expressionLevel(pair.second));
 
-        m_dynamicEvents[pair.first].emplace(std::move(event));
+        m_dynamicEvents.add(pair.first, std::move(event));
     }
 
     updateDynamicChangesIterator();
@@ -83,8 +104,16 @@ const ChannelMap& FluidSequencer::channels() const
     return m_channels;
 }
 
-void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
+void FluidSequencer::updatePlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& changes)
 {
+    size_t eventsCount = 0;
+    for (const auto& pair : changes) {
+        eventsCount += pair.second.size();
+    }
+
+    //! NOTE Note on, note off and the controllers of every note
+    destination.reserve(destination.size() + eventsCount * 4);
+
     for (const auto& pair : changes) {
         for (const mpe::PlaybackEvent& event : pair.second) {
             if (!std::holds_alternative<mpe::NoteEvent>(event)) {
@@ -107,22 +136,24 @@ void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const m
             noteOn.setVelocity(velocity);
             noteOn.setPitchNote(noteIdx, tuning);
 
-            destination[timestampFrom].emplace(std::move(noteOn));
+            destination.add(timestampFrom, std::move(noteOn));
 
             midi::Event noteOff(Event::Opcode::NoteOff, Event::MessageType::ChannelVoice20);
             noteOff.setChannel(channelIdx);
             noteOff.setNote(noteIdx);
             noteOff.setPitchNote(noteIdx, tuning);
 
-            destination[timestampTo].emplace(std::move(noteOff));
+            destination.add(timestampTo, std::move(noteOff));
 
             appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, 64);
             appendPitchBend(destination, noteEvent, BEND_SUPPORTED_TYPES, channelIdx);
         }
     }
+
+    destination.finalize();
 }
 
-void FluidSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                          const mpe::ArticulationTypeSet& appliableTypes, const int midiControlIdx)
 {
     mpe::ArticulationType currentType = mpe::ArticulationType::Undefined;
@@ -142,23 +173,23 @@ void FluidSequencer::appendControlSwitch(EventSequenceMap& destination, const mp
         start.setIndex(midiControlIdx);
         start.setData(127);
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(std::move(start));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, std::move(start));
 
         midi::Event end(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
         end.setIndex(midiControlIdx);
         end.setData(0);
 
-        destination[articulationMeta.timestamp + articulationMeta.overallDuration].emplace(std::move(end));
+        destination.add(articulationMeta.timestamp + articulationMeta.overallDuration, std::move(end));
     } else {
         midi::Event cc(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
         cc.setIndex(midiControlIdx);
         cc.setData(0);
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(std::move(cc));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, std::move(cc));
     }
 }
 
-void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::appendPitchBend(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                      const mpe::ArticulationTypeSet& appliableTypes, const channel_t channelIdx)
 {
     mpe::ArticulationType currentType = mpe::ArticulationType::Undefined;
@@ -187,7 +218,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
                 timestamp_t currentPoint = timestampFrom + noteEvent.arrangementCtx().actualDuration * percentageToFactor(it->first);
 
                 event.setData(pitchBendLevel(it->second));
-                destination[currentPoint].emplace(event);
+                destination.add(currentPoint, event);
                 return;
             }
 
@@ -208,7 +239,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
 
                 int pitchBendVal = pitchBendLevel(it->second + (i * pitchStep));
                 event.setData(pitchBendVal);
-                destination[currentPoint].emplace(event);
+                destination.add(currentPoint, event);
             }
 
             it++;
@@ -218,7 +249,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
     }
 
     event.setData(8192);
-    destination[timestampFrom].emplace(std::move(event));
+    destination.add(timestampFrom, std::move(event));
 }
 
 channel_t FluidSequencer::channel(const mpe::NoteEvent& noteEvent) const
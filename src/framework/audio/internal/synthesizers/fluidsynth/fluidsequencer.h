@@ -40,6 +40,7 @@ public:
 
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& changes) override;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) override;
+    void applyMainStreamDelta(const mpe::PlaybackEventsMap& removedEvents, const mpe::PlaybackEventsMap& insertedEvents) override;
     void updateDynamicChanges(const mpe::DynamicLevelMap& changes) override;
 
     async::Channel<midi::channel_t, midi::Program> channelAdded() const;
@@ -47,12 +48,12 @@ public:
     const ChannelMap& channels() const;
 
 private:
-    void updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes);
+    void updatePlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& changes);
 
-    void appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
+    void appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
                              const int midiControlIdx);
 
-    void appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
+    void appendPitchBend(Timeline& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
                          const midi::channel_t channelIdx);
 
     midi::channel_t channel(const mpe::NoteEvent& noteEvent) const;
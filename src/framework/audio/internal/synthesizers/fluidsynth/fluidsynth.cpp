@@ -32,6 +32,7 @@
 #include "realfn.h"
 
 #include "sfcachedloader.h"
+#include "fluidvoicebudget.h"
 #include "audioerrors.h"
 #include "audiotypes.h"
 
@@ -67,6 +68,13 @@ FluidSynth::FluidSynth(const AudioSourceParams& params)
     m_fluid = std::make_shared<Fluid>();
 
     init();
+
+    FluidVoiceBudget::instance()->registerSynth();
+}
+
+FluidSynth::~FluidSynth()
+{
+    FluidVoiceBudget::instance()->unregisterSynth(m_activeVoices);
 }
 
 bool FluidSynth::isValid() const
@@ -211,6 +219,7 @@ void FluidSynth::setSampleRate(unsigned int sampleRate)
     }
 
     createFluidInstance();
+    updateActiveVoices();
     addSoundFonts(std::vector<io::path_t>(m_sfontPaths.cbegin(), m_sfontPaths.cend()));
     setupSound(m_setupData);
 }
@@ -351,6 +360,10 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
         handleEvent(std::get<midi::Event>(event));
     }
 
+    if (!sequence.empty()) {
+        applyVoiceBudget();
+    }
+
     fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
 
     unsigned int channelCount = audioChannelsCount();
@@ -359,6 +372,8 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
                                          buffer, 0, channelCount,
                                          buffer, 1, channelCount);
 
+    updateActiveVoices();
+
     if (result != FLUID_OK) {
         return 0;
     }
@@ -404,3 +419,29 @@ int FluidSynth::setControllerValue(const midi::Event& event)
 
     return fluid_synth_cc(m_fluid->synth, event.channel(), event.index(),  event.data());
 }
+
+void FluidSynth::applyVoiceBudget()
+{
+    updateActiveVoices();
+
+    FluidVoiceBudget* budget = FluidVoiceBudget::instance();
+    int voicesToSteal = budget->voicesToSteal(m_activeVoices);
+    if (voicesToSteal <= 0) {
+        return;
+    }
+
+    //! NOTE The killed voices are released by Fluid on the next rendering,
+    //!      so take them out of the budget right away, otherwise the other synths would steal too
+    int killed = fluid_synth_kill_voices_by_priority(m_fluid->synth, voicesToSteal);
+    if (killed > 0) {
+        budget->updateActiveVoices(m_activeVoices, m_activeVoices - killed);
+        m_activeVoices -= killed;
+    }
+}
+
+void FluidSynth::updateActiveVoices()
+{
+    int activeVoices = m_fluid->synth ? fluid_synth_get_active_voice_count(m_fluid->synth) : 0;
+    FluidVoiceBudget::instance()->updateActiveVoices(m_activeVoices, activeVoices);
+    m_activeVoices = activeVoices;
+}
@@ -44,6 +44,7 @@ class FluidSynth : public AbstractSynthesizer
     INJECT(audio, midi::IMidiOutPort, midiOutPort)
 public:
     FluidSynth(const audio::AudioSourceParams& params);
+    ~FluidSynth() override;
 
     SoundFontFormats soundFontFormats() const;
     Ret addSoundFonts(const std::vector<io::path_t>& sfonts);
@@ -107,6 +108,9 @@ private:
     int setExpressionLevel(int level);
     int setControllerValue(const midi::Event& event);
 
+    void applyVoiceBudget();
+    void updateActiveVoices();
+
     std::shared_ptr<Fluid> m_fluid = nullptr;
 
     async::Channel<unsigned int> m_streamsCountChanged;
@@ -115,6 +119,8 @@ private:
     std::set<io::path_t> m_sfontPaths;
 
     KeyTuning m_tuning;
+
+    int m_activeVoices = 0;
 };
 
 using FluidSynthPtr = std::shared_ptr<FluidSynth>;
@@ -0,0 +1,86 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "fluidvoicebudget.h"
+
+#include <algorithm>
+
+using namespace mu::audio::synth;
+
+FluidVoiceBudget* FluidVoiceBudget::instance()
+{
+    static FluidVoiceBudget s;
+    return &s;
+}
+
+void FluidVoiceBudget::setMaxVoices(int maxVoices)
+{
+    m_maxVoices = std::max(maxVoices, 0);
+}
+
+int FluidVoiceBudget::maxVoices() const
+{
+    return m_maxVoices;
+}
+
+void FluidVoiceBudget::registerSynth()
+{
+    ++m_synthCount;
+}
+
+void FluidVoiceBudget::unregisterSynth(int activeVoices)
+{
+    --m_synthCount;
+    m_activeVoices -= activeVoices;
+}
+
+void FluidVoiceBudget::updateActiveVoices(int oldCount, int newCount)
+{
+    if (oldCount != newCount) {
+        m_activeVoices += newCount - oldCount;
+    }
+}
+
+int FluidVoiceBudget::activeVoices() const
+{
+    return m_activeVoices;
+}
+
+int FluidVoiceBudget::voicesToSteal(int ownVoices) const
+{
+    int maxVoices = m_maxVoices;
+    if (maxVoices <= 0) {
+        return 0;
+    }
+
+    int overflow = m_activeVoices - maxVoices;
+    if (overflow <= 0) {
+        return 0;
+    }
+
+    int fairShare = maxVoices / std::max(m_synthCount.load(), 1);
+    if (ownVoices <= fairShare) {
+        return 0;
+    }
+
+    return std::min(overflow, ownVoices - fairShare);
+}
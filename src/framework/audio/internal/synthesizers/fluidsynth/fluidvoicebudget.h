@@ -0,0 +1,58 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_FLUIDVOICEBUDGET_H
+#define MU_AUDIO_FLUIDVOICEBUDGET_H
+
+#include <atomic>
+
+namespace mu::audio::synth {
+//! NOTE The voice budget shared by all the Fluid instances (one per track).
+//!      The instances are processed in parallel, so the state is kept in atomics
+class FluidVoiceBudget
+{
+public:
+    static FluidVoiceBudget* instance();
+
+    void setMaxVoices(int maxVoices);
+    int maxVoices() const;
+
+    void registerSynth();
+    void unregisterSynth(int activeVoices);
+
+    void updateActiveVoices(int oldCount, int newCount);
+    int activeVoices() const;
+
+    //! NOTE How many voices a synth with `ownVoices` playing voices has to release,
+    //!      the synths above their fair share give up voices first
+    int voicesToSteal(int ownVoices) const;
+
+private:
+    FluidVoiceBudget() = default;
+
+    std::atomic<int> m_maxVoices = 0;
+    std::atomic<int> m_activeVoices = 0;
+    std::atomic<int> m_synthCount = 0;
+};
+}
+
+#endif // MU_AUDIO_FLUIDVOICEBUDGET_H
@@ -0,0 +1,281 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sfsamplestorage.h"
+
+#include <chrono>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#elif !defined(Q_OS_WASM)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+extern "C" {
+#include <fluidsynth.h>
+#include <sfloader/fluid_samplecache.h>
+}
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::audio::synth;
+
+io::path_t SoundFontSampleStorage::s_cachePath;
+
+namespace {
+struct MappedRegion
+{
+    void* address = nullptr;
+    size_t length = 0;
+#ifdef Q_OS_WIN
+    HANDLE mapping = nullptr;
+#endif
+};
+
+bool isLittleEndian()
+{
+    const uint16_t value = 1;
+    return *reinterpret_cast<const uint8_t*>(&value) == 1;
+}
+
+//! NOTE Maps [offset, offset + length) of the file read-only, returns the region and its data pointer
+MappedRegion* mapFile(const std::string& path, uint64_t offset, size_t length, const void** data)
+{
+#if defined(Q_OS_WIN)
+    int wideLength = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+    std::wstring widePath(wideLength, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, widePath.data(), wideLength);
+
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        return nullptr;
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const uint64_t alignedOffset = offset - offset % info.dwAllocationGranularity;
+    const size_t mappedLength = length + static_cast<size_t>(offset - alignedOffset);
+
+    void* address = MapViewOfFile(mapping, FILE_MAP_READ, static_cast<DWORD>(alignedOffset >> 32),
+                                  static_cast<DWORD>(alignedOffset & 0xFFFFFFFF), mappedLength);
+    if (!address) {
+        CloseHandle(mapping);
+        return nullptr;
+    }
+
+    MappedRegion* region = new MappedRegion();
+    region->address = address;
+    region->length = mappedLength;
+    region->mapping = mapping;
+#elif !defined(Q_OS_WASM)
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t alignedOffset = offset - offset % pageSize;
+    const size_t mappedLength = length + static_cast<size_t>(offset - alignedOffset);
+
+    void* address = mmap(nullptr, mappedLength, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(alignedOffset));
+    close(fd);
+    if (address == MAP_FAILED) {
+        return nullptr;
+    }
+
+    MappedRegion* region = new MappedRegion();
+    region->address = address;
+    region->length = mappedLength;
+#else
+    UNUSED(path);
+    UNUSED(offset);
+    UNUSED(length);
+    UNUSED(data);
+    return nullptr;
+#endif
+
+#ifndef Q_OS_WASM
+    *data = static_cast<const uint8_t*>(region->address) + (offset - alignedOffset);
+    return region;
+#endif
+}
+
+void unmapRegion(MappedRegion* region)
+{
+#if defined(Q_OS_WIN)
+    UnmapViewOfFile(region->address);
+    CloseHandle(region->mapping);
+#elif !defined(Q_OS_WASM)
+    munmap(region->address, region->length);
+#endif
+
+    delete region;
+}
+}
+
+void SoundFontSampleStorage::init(const io::path_t& decodedSamplesCachePath)
+{
+#ifdef Q_OS_WASM
+    UNUSED(decodedSamplesCachePath);
+#else
+    s_cachePath = decodedSamplesCachePath;
+
+    if (!s_cachePath.empty()) {
+        Ret ret = fileSystem()->makePath(s_cachePath);
+        if (!ret) {
+            LOGW() << "failed to create the decoded samples cache: " << s_cachePath << ", err: " << ret.toString();
+            s_cachePath = io::path_t();
+        }
+    }
+
+    //! NOTE SF2 sample data are little endian and are mapped as they are
+    if (isLittleEndian()) {
+        fluid_samplecache_set_storage(&SoundFontSampleStorage::provide, &SoundFontSampleStorage::release);
+    }
+#endif
+}
+
+int SoundFontSampleStorage::provide(_SFData* sf, unsigned int sampleStart, unsigned int sampleEnd, int sampleType,
+                                    short** data, char** data24, void** handle)
+{
+    //! NOTE 24 bit sound fonts are rare, FluidSynth reads them as usual
+    if (!sf || sf->sample24pos != 0 || sampleEnd < sampleStart) {
+        return -1;
+    }
+
+    *data24 = nullptr;
+
+    if (sampleType & FLUID_SAMPLETYPE_OGG_VORBIS) {
+        return provideDecoded(sf, sampleStart, sampleEnd, sampleType, data, handle);
+    }
+
+    return provideFromSoundFont(sf, sampleStart, sampleEnd, data, handle);
+}
+
+void SoundFontSampleStorage::release(void* handle)
+{
+    unmapRegion(static_cast<MappedRegion*>(handle));
+}
+
+int SoundFontSampleStorage::provideFromSoundFont(_SFData* sf, unsigned int sampleStart, unsigned int sampleEnd,
+                                                 short** data, void** handle)
+{
+    const size_t samplesCount = static_cast<size_t>(sampleEnd) - sampleStart + 1;
+    if ((static_cast<uint64_t>(sampleEnd) + 1) * sizeof(short) > sf->samplesize) {
+        return -1;
+    }
+
+    const void* mappedData = nullptr;
+    MappedRegion* region = mapFile(sf->fname, sf->samplepos + static_cast<uint64_t>(sampleStart) * sizeof(short),
+                                   samplesCount * sizeof(short), &mappedData);
+    if (!region) {
+        LOGW() << "failed to map the samples of " << sf->fname << ", reading them instead";
+        return -1;
+    }
+
+    //! NOTE FluidSynth never writes into the sample data, so the mapping stays read-only
+    *data = const_cast<short*>(static_cast<const short*>(mappedData));
+    *handle = region;
+
+    return static_cast<int>(samplesCount);
+}
+
+int SoundFontSampleStorage::provideDecoded(_SFData* sf, unsigned int sampleStart, unsigned int sampleEnd, int sampleType,
+                                           short** data, void** handle)
+{
+    if (s_cachePath.empty()) {
+        return -1;
+    }
+
+    const io::path_t path = decodedSamplePath(sf, sampleStart, sampleEnd);
+
+    if (!fileSystem()->exists(path)) {
+        short* decoded = nullptr;
+        char* decoded24 = nullptr;
+        int samplesCount = fluid_sffile_read_sample_data(sf, sampleStart, sampleEnd, sampleType, &decoded, &decoded24);
+
+        if (samplesCount > 0) {
+            //! NOTE Written under a unique name and moved into place,
+            //! so another process never maps a half written file
+            std::stringstream tempSuffix;
+            tempSuffix << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id())
+                       << std::chrono::steady_clock::now().time_since_epoch().count();
+            const io::path_t tempPath = path + tempSuffix.str();
+
+            ByteArray bytes = ByteArray::fromRawData(reinterpret_cast<const uint8_t*>(decoded), samplesCount * sizeof(short));
+            if (fileSystem()->writeFile(tempPath, bytes)) {
+                fileSystem()->move(tempPath, path, true);
+            }
+        }
+
+        fluid_free(decoded);
+        fluid_free(decoded24);
+
+        if (samplesCount <= 0) {
+            return -1;
+        }
+    }
+
+    RetVal<uint64_t> fileSize = fileSystem()->fileSize(path);
+    if (!fileSize.ret || fileSize.val < sizeof(short)) {
+        return -1;
+    }
+
+    const void* mappedData = nullptr;
+    MappedRegion* region = mapFile(path.toStdString(), 0, fileSize.val, &mappedData);
+    if (!region) {
+        return -1;
+    }
+
+    *data = const_cast<short*>(static_cast<const short*>(mappedData));
+    *handle = region;
+
+    return static_cast<int>(fileSize.val / sizeof(short));
+}
+
+io::path_t SoundFontSampleStorage::decodedSamplePath(const _SFData* sf, unsigned int sampleStart, unsigned int sampleEnd)
+{
+    //! NOTE One directory per version of a sound font, an updated sound font gets a new one
+    std::stringstream soundFontKey;
+    soundFontKey << sf->fname << "|" << fileSystem()->fileSize(sf->fname).val
+                 << "|" << fileSystem()->lastModified(sf->fname).toString().toStdString();
+
+    std::stringstream path;
+    path << std::hex << std::hash<std::string>()(soundFontKey.str()) << std::dec
+         << "/" << sampleStart << "_" << sampleEnd << ".pcm";
+
+    io::path_t result = s_cachePath + "/" + path.str();
+    fileSystem()->makePath(io::dirpath(result));
+
+    return result;
+}
@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_SFSAMPLESTORAGE_H
+#define MU_AUDIO_SFSAMPLESTORAGE_H
+
+#include "modularity/ioc.h"
+#include "io/ifilesystem.h"
+#include "io/path.h"
+
+struct _SFData;
+
+namespace mu::audio::synth {
+//! NOTE Provides FluidSynth with sample data mapped from files instead of private heap copies.
+//! SF2 samples are mapped straight from the sound font, SF3 samples are decoded once into
+//! a cache on disk and mapped from there. Read-only mappings of the same file share their pages
+//! between all synth instances and between processes, e.g. several MuseScore instances
+class SoundFontSampleStorage
+{
+    INJECT_STATIC(audio, io::IFileSystem, fileSystem)
+public:
+    static void init(const io::path_t& decodedSamplesCachePath);
+
+private:
+    static int provide(_SFData* sf, unsigned int sampleStart, unsigned int sampleEnd, int sampleType,
+                       short** data, char** data24, void** handle);
+    static void release(void* handle);
+
+    static int provideFromSoundFont(_SFData* sf, unsigned int sampleStart, unsigned int sampleEnd, short** data, void** handle);
+    static int provideDecoded(_SFData* sf, unsigned int sampleStart, unsigned int sampleEnd, int sampleType,
+                              short** data, void** handle);
+    static io::path_t decodedSamplePath(const _SFData* sf, unsigned int sampleStart, unsigned int sampleEnd);
+
+    static io::path_t s_cachePath;
+};
+}
+
+#endif // MU_AUDIO_SFSAMPLESTORAGE_H
@@ -0,0 +1,136 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_AUDIOCOMMANDQUEUE_H
+#define MU_AUDIO_AUDIOCOMMANDQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "audiotypes.h"
+
+namespace mu::audio {
+//! NOTE Transport and mixer changes that the audio worker should apply as soon as possible.
+//! A command is a plain value, so sending one neither locks nor allocates (unlike Async::call)
+struct AudioCommand {
+    enum class Type : uint8_t {
+        Undefined = 0,
+        Play,
+        Seek,
+        Stop,
+        Pause,
+        Resume,
+        SetOutputLevels,
+        SetMasterOutputLevels
+    };
+
+    Type type = Type::Undefined;
+    TrackSequenceId sequenceId = -1;
+    TrackId trackId = -1;
+
+    msecs_t positionMsecs = 0;
+
+    volume_db_t volume = 0.f;
+    balance_t balance = 0.f;
+    bool muted = false;
+};
+
+//! NOTE Fixed-size single-producer/single-consumer ring:
+//! the main thread pushes, the audio worker processes. When the ring is full, push returns false
+//! and the sender is expected to fall back to Async::call
+class AudioCommandQueue
+{
+public:
+    static constexpr size_t CAPACITY = 256;
+
+    using Wakeup = std::function<void ()>;
+    using Consumer = std::function<void (const AudioCommand&)>;
+
+    //! NOTE Called after a successful push, e.g. to wake up the audio worker
+    void setWakeup(const Wakeup& wakeup)
+    {
+        m_wakeup = wakeup;
+    }
+
+    void setConsumer(const Consumer& consumer)
+    {
+        m_consumer = consumer;
+    }
+
+    //! NOTE Producer side
+    bool push(const AudioCommand& command)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_head.load(std::memory_order_acquire) == CAPACITY) {
+            return false;
+        }
+
+        m_commands[tail % CAPACITY] = command;
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        if (m_wakeup) {
+            m_wakeup();
+        }
+
+        return true;
+    }
+
+    //! NOTE Producer side: the number of commands pushed so far.
+    //! An Async::call sent instead of a command passes it to process(), so that the changes are applied in order
+    size_t pushedCount() const
+    {
+        return m_tail.load(std::memory_order_relaxed);
+    }
+
+    //! NOTE Consumer side: passes the commands to the consumer, up to the given number of pushed commands
+    void process(size_t untilPushedCount = SIZE_MAX)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+
+        while (head != tail && head < untilPushedCount) {
+            AudioCommand command = m_commands[head % CAPACITY];
+            m_head.store(++head, std::memory_order_release);
+
+            if (m_consumer) {
+                m_consumer(command);
+            }
+        }
+    }
+
+private:
+    std::array<AudioCommand, CAPACITY> m_commands;
+
+    //! NOTE Free-running counters on separate cache lines,
+    //! so that the producer and the consumer don't invalidate each other
+    alignas(64) std::atomic<size_t> m_head = 0;
+    alignas(64) std::atomic<size_t> m_tail = 0;
+
+    Wakeup m_wakeup = nullptr;
+    Consumer m_consumer = nullptr;
+};
+}
+
+#endif // MU_AUDIO_AUDIOCOMMANDQUEUE_H
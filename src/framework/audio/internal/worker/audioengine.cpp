@@ -163,3 +163,24 @@ MixerPtr AudioEngine::mixer() const
     ONLY_AUDIO_WORKER_THREAD;
     return m_mixer;
 }
+
+AudioMetrics AudioEngine::takeMetrics()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    AudioMetrics result;
+    result.sampleRate = m_sampleRate;
+
+    if (m_buffer) {
+        AudioBuffer::Statistics statistics = m_buffer->statistics();
+        result.underrunCount = statistics.underrunCount;
+        result.reservedSamples = statistics.reservedSamples;
+        result.bufferFill = m_buffer->takeFillTime();
+    }
+
+    if (m_mixer) {
+        m_mixer->takeMetrics(result);
+    }
+
+    return result;
+}
@@ -56,6 +56,9 @@ public:
 
     MixerPtr mixer() const;
 
+    //! NOTE Collects the metrics of the whole pipeline and starts a new period
+    AudioMetrics takeMetrics();
+
 private:
     AudioEngine();
 
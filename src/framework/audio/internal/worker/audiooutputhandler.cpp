@@ -30,6 +30,7 @@
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/worker/audioengine.h"
+#include "itracks.h"
 #include "audioerrors.h"
 
 #ifdef ENABLE_AUDIO_EXPORT
@@ -43,8 +44,8 @@ using namespace mu::async;
 using namespace mu::audio::soundtrack;
 #endif
 
-AudioOutputHandler::AudioOutputHandler(IGetTrackSequence* getSequence)
-    : m_getSequence(getSequence)
+AudioOutputHandler::AudioOutputHandler(IGetTrackSequence* getSequence, IPlayback* playback, AudioCommandQueue* commands)
+    : m_getSequence(getSequence), m_playback(playback), m_commands(commands)
 {
     ONLY_AUDIO_MAIN_OR_WORKER_THREAD;
 
@@ -76,9 +77,38 @@ Promise<AudioOutputParams> AudioOutputHandler::outputParams(const TrackSequenceI
 
 void AudioOutputHandler::setOutputParams(const TrackSequenceId sequenceId, const TrackId trackId, const AudioOutputParams& params)
 {
-    Async::call(this, [this, sequenceId, trackId, params]() {
+    if (canSendCommand()) {
+        ensureMainThreadSubscriptions();
+
+        auto key = std::make_pair(sequenceId, trackId);
+        auto it = m_sentFxChains.find(key);
+
+        if (it != m_sentFxChains.end() && it->second == params.fxChain) {
+            AudioCommand command;
+            command.type = AudioCommand::Type::SetOutputLevels;
+            command.sequenceId = sequenceId;
+            command.trackId = trackId;
+            command.volume = params.volume;
+            command.balance = params.balance;
+            command.muted = params.muted;
+
+            if (m_commands->push(command)) {
+                return;
+            }
+        }
+
+        m_sentFxChains[key] = params.fxChain;
+    }
+
+    size_t pushedBefore = canSendCommand() ? m_commands->pushedCount() : 0;
+
+    Async::call(this, [this, sequenceId, trackId, params, pushedBefore]() {
         ONLY_AUDIO_WORKER_THREAD;
 
+        if (m_commands) {
+            m_commands->process(pushedBefore);
+        }
+
         ITrackSequencePtr s = sequence(sequenceId);
 
         if (s) {
@@ -109,9 +139,31 @@ Promise<AudioOutputParams> AudioOutputHandler::masterOutputParams() const
 
 void AudioOutputHandler::setMasterOutputParams(const AudioOutputParams& params)
 {
-    Async::call(this, [this, params]() {
+    if (canSendCommand()) {
+        if (m_sentMasterFxChain == params.fxChain) {
+            AudioCommand command;
+            command.type = AudioCommand::Type::SetMasterOutputLevels;
+            command.volume = params.volume;
+            command.balance = params.balance;
+            command.muted = params.muted;
+
+            if (m_commands->push(command)) {
+                return;
+            }
+        }
+
+        m_sentMasterFxChain = params.fxChain;
+    }
+
+    size_t pushedBefore = canSendCommand() ? m_commands->pushedCount() : 0;
+
+    Async::call(this, [this, params, pushedBefore]() {
         ONLY_AUDIO_WORKER_THREAD;
 
+        if (m_commands) {
+            m_commands->process(pushedBefore);
+        }
+
         IF_ASSERT_FAILED(mixer()) {
             return;
         }
@@ -122,9 +174,20 @@ void AudioOutputHandler::setMasterOutputParams(const AudioOutputParams& params)
 
 void AudioOutputHandler::clearMasterOutputParams()
 {
-    Async::call(this, [this]() {
+    size_t pushedBefore = 0;
+
+    if (canSendCommand()) {
+        m_sentMasterFxChain.reset();
+        pushedBefore = m_commands->pushedCount();
+    }
+
+    Async::call(this, [this, pushedBefore]() {
         ONLY_AUDIO_WORKER_THREAD;
 
+        if (m_commands) {
+            m_commands->process(pushedBefore);
+        }
+
         IF_ASSERT_FAILED(mixer()) {
             return;
         }
@@ -181,10 +244,43 @@ Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
     }, AudioThread::ID);
 }
 
+Promise<AudioCpuLoadChanges> AudioOutputHandler::cpuLoadChanges(const TrackSequenceId sequenceId, const TrackId trackId) const
+{
+    return Promise<AudioCpuLoadChanges>([this, sequenceId, trackId](auto resolve, auto reject) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        ITrackSequencePtr s = sequence(sequenceId);
+
+        if (!s) {
+            return reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
+        }
+
+        if (!s->audioIO()->isHasTrack(trackId)) {
+            return reject(static_cast<int>(Err::InvalidTrackId), "no track");
+        }
+
+        return resolve(s->audioIO()->cpuLoadChanges(trackId));
+    }, AudioThread::ID);
+}
+
+Promise<AudioMetrics> AudioOutputHandler::takeMetrics()
+{
+    return Promise<AudioMetrics>([](auto resolve, auto /*reject*/) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        return resolve(AudioEngine::instance()->takeMetrics());
+    }, AudioThread::ID);
+}
+
 Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                  const SoundTrackFormat& format)
 {
-    return Promise<bool>([this, sequenceId, destination, format](auto resolve, auto reject) {
+    return saveSoundTracks(sequenceId, { SoundTrackDestination { destination, format } });
+}
+
+Promise<bool> AudioOutputHandler::saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinations& destinations)
+{
+    return Promise<bool>([this, sequenceId, destinations](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         IF_ASSERT_FAILED(mixer()) {
@@ -200,7 +296,7 @@ Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceI
         s->player()->stop();
         s->player()->seek(0);
         msecs_t totalDuration = s->player()->duration();
-        SoundTrackWriter writer(destination, format, totalDuration, mixer());
+        SoundTrackWriter writer(destinations, totalDuration, mixer());
 
         framework::Progress progress = saveSoundTrackProgress(sequenceId);
         writer.progress().progressChanged.onReceive(this, [&progress](int64_t current, int64_t total, std::string title) {
@@ -231,6 +327,70 @@ void AudioOutputHandler::clearAllFx()
     fxResolver()->clearAllFx();
 }
 
+void AudioOutputHandler::applyCommand(const AudioCommand& command)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (command.type == AudioCommand::Type::SetOutputLevels) {
+        ITrackSequencePtr s = sequence(command.sequenceId);
+        if (!s) {
+            return;
+        }
+
+        RetVal<AudioOutputParams> params = s->audioIO()->outputParams(command.trackId);
+        if (!params.ret) {
+            return;
+        }
+
+        params.val.volume = command.volume;
+        params.val.balance = command.balance;
+        params.val.muted = command.muted;
+
+        s->audioIO()->setOutputParams(command.trackId, params.val);
+    } else if (command.type == AudioCommand::Type::SetMasterOutputLevels) {
+        IF_ASSERT_FAILED(mixer()) {
+            return;
+        }
+
+        AudioOutputParams params = mixer()->masterOutputParams();
+        params.volume = command.volume;
+        params.balance = command.balance;
+        params.muted = command.muted;
+
+        mixer()->setMasterOutputParams(params);
+    }
+}
+
+bool AudioOutputHandler::canSendCommand() const
+{
+    //! NOTE The queue has a single producer, the main thread
+    return m_commands && AudioSanitizer::isMainThread();
+}
+
+void AudioOutputHandler::ensureMainThreadSubscriptions()
+{
+    if (m_mainThreadSubscribed || !m_playback) {
+        return;
+    }
+
+    m_mainThreadSubscribed = true;
+
+    //! NOTE The ids of the removed tracks and sequences are reused, so the new ones must not inherit the sent fx chains
+    m_playback->tracks()->trackRemoved().onReceive(this, [this](const TrackSequenceId sequenceId, const TrackId trackId) {
+        m_sentFxChains.erase(std::make_pair(sequenceId, trackId));
+    });
+
+    m_playback->sequenceRemoved().onReceive(this, [this](const TrackSequenceId sequenceId) {
+        for (auto it = m_sentFxChains.begin(); it != m_sentFxChains.end();) {
+            if (it->first.first == sequenceId) {
+                it = m_sentFxChains.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    });
+}
+
 std::shared_ptr<Mixer> AudioOutputHandler::mixer() const
 {
     return AudioEngine::instance()->mixer();
@@ -23,12 +23,17 @@
 #ifndef MU_AUDIO_AUDIOIOHANDLER_H
 #define MU_AUDIO_AUDIOIOHANDLER_H
 
+#include <map>
+#include <optional>
+
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
 
 #include "ifxresolver.h"
 #include "iaudiooutput.h"
 #include "igettracksequence.h"
+#include "iplayback.h"
+#include "audiocommandqueue.h"
 
 namespace mu::audio {
 class Mixer;
@@ -37,7 +42,7 @@ class AudioOutputHandler : public IAudioOutput, public async::Asyncable
     INJECT(audio, fx::IFxResolver, fxResolver)
 
 public:
-    explicit AudioOutputHandler(IGetTrackSequence* getSequence);
+    explicit AudioOutputHandler(IGetTrackSequence* getSequence, IPlayback* playback = nullptr, AudioCommandQueue* commands = nullptr);
 
     async::Promise<AudioOutputParams> outputParams(const TrackSequenceId sequenceId, const TrackId trackId) const override;
     void setOutputParams(const TrackSequenceId sequenceId, const TrackId trackId, const AudioOutputParams& params) override;
@@ -53,20 +58,38 @@ public:
     async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const override;
     async::Promise<AudioSignalChanges> masterSignalChanges() const override;
 
+    async::Promise<AudioCpuLoadChanges> cpuLoadChanges(const TrackSequenceId sequenceId, const TrackId trackId) const override;
+
+    async::Promise<AudioMetrics> takeMetrics() override;
+
     async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                         const SoundTrackFormat& format) override;
+    async::Promise<bool> saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinations& destinations) override;
 
     framework::Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) override;
 
     void clearAllFx() override;
 
+    void applyCommand(const AudioCommand& command);
+
 private:
+    bool canSendCommand() const;
+    void ensureMainThreadSubscriptions();
+
     std::shared_ptr<Mixer> mixer() const;
     ITrackSequencePtr sequence(const TrackSequenceId id) const;
     void ensureSeqSubscriptions(const ITrackSequencePtr s) const;
     void ensureMixerSubscriptions() const;
 
     IGetTrackSequence* m_getSequence = nullptr;
+    IPlayback* m_playback = nullptr;
+    AudioCommandQueue* m_commands = nullptr;
+
+    //! NOTE The fx chains last sent from the main thread (accessed only there):
+    //! while a chain doesn't change, only the levels are sent, through the command queue
+    std::map<std::pair<TrackSequenceId, TrackId>, AudioFxChain> m_sentFxChains;
+    std::optional<AudioFxChain> m_sentMasterFxChain;
+    bool m_mainThreadSubscribed = false;
 
     mutable async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     mutable async::Channel<TrackSequenceId, TrackId, AudioOutputParams> m_outputParamsChanged;
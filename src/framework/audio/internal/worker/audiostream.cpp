@@ -54,11 +54,23 @@ bool AudioStream::loadFile(const io::path_t& path)
 
 void AudioStream::convertSampleRate(unsigned int sampleRate)
 {
-    if (sampleRate != m_sampleRate) {
-        auto src = new SampleRateConvertor(m_data, m_channels, m_sampleRate, sampleRate);
-        m_data = src->convert();
-        m_sampleRate = sampleRate;
+    if (sampleRate == m_sampleRate || m_channels == 0) {
+        return;
     }
+
+    dsp::PolyphaseResampler resampler(static_cast<audioch_t>(m_channels), m_sampleRate, sampleRate);
+
+    const samples_t inputFrames = m_data.size() / m_channels;
+    const samples_t outputFrames = resampler.outputFramesFor(inputFrames);
+
+    std::vector<float> data(outputFrames * m_channels);
+    samples_t usedInputFrames = 0;
+    samples_t writtenFrames = resampler.process(m_data.data(), inputFrames, data.data(), outputFrames, usedInputFrames);
+    data.resize(writtenFrames * m_channels);
+
+    m_data = std::move(data);
+    m_sampleRate = sampleRate;
+    m_src.setSampleRateIn(sampleRate);
 }
 
 unsigned int AudioStream::channelsCount() const
@@ -25,6 +25,7 @@
 #include <vector>
 #include "audio/iaudiostream.h"
 #include "samplerateconvertor.h"
+#include "internal/dsp/polyphaseresampler.h"
 
 namespace mu::audio {
 class AudioStream : public IAudioStream
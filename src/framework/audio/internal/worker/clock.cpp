@@ -67,8 +67,14 @@ void Clock::setCurrentTime(msecs_t time)
         return;
     }
 
+    //! NOTE The subscribers only get milliseconds, so don't queue a send that changes nothing for them
+    bool msecsChanged = m_currentTime / 1000 != time / 1000;
+
     m_currentTime = time;
-    m_timeChangedInMilliSecs.send(m_currentTime / 1000);
+
+    if (msecsChanged) {
+        m_timeChangedInMilliSecs.send(m_currentTime / 1000);
+    }
 }
 
 void Clock::start()
@@ -27,6 +27,11 @@
 
 using namespace mu::audio;
 
+Equaliser::Equaliser(const audioch_t audioChannelsCount)
+    : m_audioChannelsCount(audioChannelsCount)
+{
+}
+
 void Equaliser::setSampleRate(unsigned int sampleRate)
 {
     m_sampleRate = sampleRate;
@@ -45,17 +50,13 @@ void Equaliser::setActive(bool active)
 
 void Equaliser::process(float* buffer, unsigned int sampleCount)
 {
-    for (unsigned int i = 0; i < sampleCount; ++i) {
-        m_x[2] = m_x[1];
-        m_x[1] = m_x[0];
-        m_x[0] = buffer[i];
-
-        m_y[2] = m_y[1];
-        m_y[1] = m_y[0];
-        m_y[0] = (m_b[2] * m_x[2] + m_b[1] * m_x[1] + m_b[0] * m_x[0] - m_a[1] * m_y[1] - m_a[2] * m_y[2]) / m_a[0];
+    //! NOTE sampleCount is the count of samples per channel of the interleaved buffer
+    m_filter.process(buffer, m_audioChannelsCount, sampleCount);
+}
 
-        buffer[i] = m_y[0];
-    }
+samples_t Equaliser::latency() const
+{
+    return 0;
 }
 
 void Equaliser::calculate()
@@ -67,13 +68,8 @@ void Equaliser::calculate()
     float w0 = 2 * M_PI * m_frequency / m_sampleRate;
     float alpha = std::sin(w0) * a / (2 * m_q);
 
-    m_b[0] = 1 + alpha * a;
-    m_b[1] = -2 * std::cos(w0);
-    m_b[2] = 1 - alpha * a;
-
-    m_a[0] = 1 + alpha / a;
-    m_a[1] = -2 * std::cos(w0);
-    m_a[2] = 1 - alpha / a;
+    m_filter.setCoefficients(1 + alpha * a, -2 * std::cos(w0), 1 - alpha * a,
+                             1 + alpha / a, -2 * std::cos(w0), 1 - alpha / a);
 }
 
 void mu::audio::Equaliser::setFrequency(float value)
@@ -24,11 +24,13 @@
 
 #include "ifxprocessor.h"
 
+#include "internal/dsp/biquadfilter.h"
+
 namespace mu::audio {
 class Equaliser : public IFxProcessor
 {
 public:
-    Equaliser();
+    explicit Equaliser(const audioch_t audioChannelsCount = 2);
 
     void setSampleRate(unsigned int sampleRate) override;
 
@@ -40,18 +42,17 @@ public:
     void setQ(float value);
 
     void process(float* buffer, unsigned int sampleCount) override;
+    samples_t latency() const override;
 
 private:
     void calculate();
 
     unsigned int m_sampleRate = 0;
+    audioch_t m_audioChannelsCount = 0;
     bool m_active = true;
 
     float m_gain = 0, m_frequency = 1000.f, m_q = 1.f;
-    float m_a[3] = { 0, 0, 0 };
-    float m_b[3] = { 0, 0, 0 };
-    float m_x[3] = { 0, 0, 0 };
-    float m_y[3] = { 0, 0, 0 };
+    dsp::BiquadFilter m_filter;
 };
 }
 
@@ -22,6 +22,8 @@
 
 #include "eventaudiosource.h"
 
+#include <algorithm>
+
 #include "log.h"
 
 #include "internal/audiosanitizer.h"
@@ -31,17 +33,24 @@ using namespace mu::audio;
 using namespace mu::audio::synth;
 using namespace mu::mpe;
 
+//! NOTE How far ahead of the playhead the heavy instruments are rendered, and how much of it per call,
+//! so that filling the lookahead never delays the next block for long
+static constexpr double LOOKAHEAD_DURATION_SECS = 0.5;
+static constexpr size_t MAX_LOOKAHEAD_STEPS_PER_CALL = 4;
+
 EventAudioSource::EventAudioSource(const TrackId trackId, const mpe::PlaybackData& playbackData)
     : m_trackId(trackId), m_playbackData(playbackData)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    m_playbackData.mainStream.onReceive(this, [this](const PlaybackEventsMap& events) {
-        m_playbackData.originEvents = events;
+    m_playbackData.mainStream.onReceive(this, [this](const PlaybackEventsDelta& delta) {
+        delta.applyTo(m_playbackData.originEvents);
+        resetLookahead();
     });
 
     m_playbackData.dynamicLevelChanges.onReceive(this, [this](const DynamicLevelMap& changes) {
         m_playbackData.dynamicLevelMap = changes;
+        resetLookahead();
     });
 }
 
@@ -69,6 +78,8 @@ void EventAudioSource::setIsActive(const bool active)
         return;
     }
 
+    resetLookahead();
+
     m_synth->setIsActive(active);
     m_synth->flushSound();
 }
@@ -116,7 +127,18 @@ samples_t EventAudioSource::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    return m_synth->process(buffer, samplesPerChannel);
+    samples_t result = samplesPerChannel;
+
+    if (!popLookahead(buffer, samplesPerChannel)) {
+        resetLookahead();
+        result = m_synth->process(buffer, samplesPerChannel);
+    }
+
+    if (m_synth->isActive()) {
+        m_samplesSinceSeek += samplesPerChannel;
+    }
+
+    return result;
 }
 
 void EventAudioSource::seek(const msecs_t newPositionMsecs)
@@ -127,10 +149,49 @@ void EventAudioSource::seek(const msecs_t newPositionMsecs)
         return;
     }
 
+    m_lookahead.clear();
+    m_lastSeekPosition = newPositionMsecs;
+    m_samplesSinceSeek = 0;
+
     m_synth->setPlaybackPosition(newPositionMsecs);
     m_synth->revokePlayingNotes();
 }
 
+samples_t EventAudioSource::renderAhead(const samples_t samplesPerStep)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!canRenderAhead() || samplesPerStep == 0) {
+        resetLookahead();
+        return 0;
+    }
+
+    const size_t stepSize = samplesPerStep * m_synth->audioChannelsCount();
+
+    if (m_lookahead.stepSize != stepSize) {
+        resetLookahead();
+
+        m_lookahead.stepSize = stepSize;
+        m_lookahead.stepCount = std::max<size_t>(1, static_cast<size_t>(LOOKAHEAD_DURATION_SECS * m_sampleRate / samplesPerStep));
+        m_lookahead.data.assign(m_lookahead.stepCount * stepSize, 0.f);
+    }
+
+    samples_t result = 0;
+
+    for (size_t i = 0; i < MAX_LOOKAHEAD_STEPS_PER_CALL && !m_lookahead.full(); ++i) {
+        size_t step = (m_lookahead.firstStep + m_lookahead.readySteps) % m_lookahead.stepCount;
+        float* stepBuffer = m_lookahead.data.data() + step * stepSize;
+
+        std::fill(stepBuffer, stepBuffer + stepSize, 0.f);
+        m_synth->process(stepBuffer, samplesPerStep);
+
+        ++m_lookahead.readySteps;
+        result += samplesPerStep;
+    }
+
+    return result;
+}
+
 const AudioInputParams& EventAudioSource::inputParams() const
 {
     return m_params;
@@ -142,6 +203,8 @@ void EventAudioSource::applyInputParams(const AudioInputParams& requiredParams)
         return;
     }
 
+    resetLookahead();
+
     SynthCtx ctx = currentSynthCtx();
 
     m_synth = synthResolver()->resolveSynth(m_trackId, requiredParams, m_playbackData.setupData);
@@ -197,3 +260,50 @@ void EventAudioSource::setupSource()
     m_synth->setSampleRate(m_sampleRate);
     m_synth->setup(m_playbackData);
 }
+
+bool EventAudioSource::canRenderAhead() const
+{
+    if (!m_synth || m_sampleRate == 0 || !m_synth->isActive()) {
+        return false;
+    }
+
+    //! NOTE Only the instruments that are expensive to render, the others just render in time
+    AudioSourceType type = m_synth->type();
+    return type == AudioSourceType::MuseSampler || type == AudioSourceType::Vsti;
+}
+
+bool EventAudioSource::popLookahead(float* buffer, samples_t samplesPerChannel)
+{
+    if (m_lookahead.empty() || m_lookahead.stepSize != samplesPerChannel * m_synth->audioChannelsCount()) {
+        return false;
+    }
+
+    const float* stepBuffer = m_lookahead.data.data() + m_lookahead.firstStep * m_lookahead.stepSize;
+    std::copy(stepBuffer, stepBuffer + m_lookahead.stepSize, buffer);
+
+    m_lookahead.firstStep = (m_lookahead.firstStep + 1) % m_lookahead.stepCount;
+    --m_lookahead.readySteps;
+
+    return true;
+}
+
+void EventAudioSource::resetLookahead()
+{
+    if (m_lookahead.empty()) {
+        return;
+    }
+
+    //! NOTE The synth is ahead of the playhead by the discarded steps: bring it back,
+    //! so that the changes are heard from the playhead on
+    m_lookahead.clear();
+
+    if (m_synth) {
+        m_synth->setPlaybackPosition(playheadPosition());
+        m_synth->revokePlayingNotes();
+    }
+}
+
+msecs_t EventAudioSource::playheadPosition() const
+{
+    return m_lastSeekPosition + m_samplesSinceSeek * 1000000 / m_sampleRate;
+}
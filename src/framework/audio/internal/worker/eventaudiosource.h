@@ -23,6 +23,8 @@
 #ifndef MU_AUDIO_EVENTAUDIOSOURCE_H
 #define MU_AUDIO_EVENTAUDIOSOURCE_H
 
+#include <vector>
+
 #include "async/asyncable.h"
 #include "modularity/ioc.h"
 #include "mpe/events.h"
@@ -50,6 +52,7 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
     void seek(const msecs_t newPositionMsecs) override;
+    samples_t renderAhead(const samples_t samplesPerStep) override;
 
     const AudioInputParams& inputParams() const override;
     void applyInputParams(const AudioInputParams& requiredParams) override;
@@ -67,10 +70,41 @@ private:
         }
     };
 
+    //! NOTE The steps rendered ahead of the playhead, in the order they are played
+    struct Lookahead
+    {
+        std::vector<float> data;
+        size_t stepSize = 0; // interleaved samples
+        size_t stepCount = 0;
+        size_t firstStep = 0;
+        size_t readySteps = 0;
+
+        bool empty() const
+        {
+            return readySteps == 0;
+        }
+
+        bool full() const
+        {
+            return readySteps == stepCount;
+        }
+
+        void clear()
+        {
+            firstStep = 0;
+            readySteps = 0;
+        }
+    };
+
     void setupSource();
     SynthCtx currentSynthCtx() const;
     void restoreSynthCtx(SynthCtx&& ctx);
 
+    bool canRenderAhead() const;
+    bool popLookahead(float* buffer, samples_t samplesPerChannel);
+    void resetLookahead();
+    msecs_t playheadPosition() const;
+
     TrackId m_trackId = -1;
     mpe::PlaybackData m_playbackData;
     synth::ISynthesizerPtr m_synth = nullptr;
@@ -78,6 +112,10 @@ private:
     async::Channel<AudioInputParams> m_paramsChanges;
 
     samples_t m_sampleRate = 0;
+
+    Lookahead m_lookahead;
+    msecs_t m_lastSeekPosition = 0;
+    samples_t m_samplesSinceSeek = 0;
 };
 }
 
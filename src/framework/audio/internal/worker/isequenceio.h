@@ -47,6 +47,7 @@ public:
     virtual async::Channel<TrackId, AudioOutputParams> outputParamsChanged() const = 0;
 
     virtual async::Channel<audioch_t, AudioSignalVal> audioSignalChanges(const TrackId id) const = 0;
+    virtual AudioCpuLoadChanges cpuLoadChanges(const TrackId id) const = 0;
 };
 
 using ISequenceIOPtr = std::shared_ptr<ISequenceIO>;
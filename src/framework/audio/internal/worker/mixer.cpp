@@ -24,10 +24,9 @@
 #include "async/async.h"
 #include "log.h"
 
+#include <array>
 #include <limits>
 
-#include "concurrency/taskscheduler.h"
-
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/dsp/audiomathutils.h"
@@ -37,9 +36,22 @@ using namespace mu;
 using namespace mu::audio;
 using namespace mu::async;
 
+static size_t mixerWorkerThreadCount()
+{
+#ifdef Q_OS_WASM
+    return 0;
+#else
+    //! NOTE The audio worker thread itself processes channels too
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 2 ? hardwareThreads / 2 - 1 : 0;
+#endif
+}
+
 Mixer::Mixer()
 {
     ONLY_AUDIO_WORKER_THREAD;
+
+    m_workerPool = std::make_unique<MixerWorkerPool>(mixerWorkerThreadCount());
 }
 
 Mixer::~Mixer()
@@ -53,7 +65,7 @@ IAudioSourcePtr Mixer::mixedSource()
     return shared_from_this();
 }
 
-RetVal<MixerChannelPtr> Mixer::addChannel(const TrackId trackId, IAudioSourcePtr source)
+RetVal<MixerChannelPtr> Mixer::addChannel(const TrackId trackId, ITrackAudioInputPtr source)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
@@ -66,6 +78,7 @@ RetVal<MixerChannelPtr> Mixer::addChannel(const TrackId trackId, IAudioSourcePtr
     }
 
     m_mixerChannels.emplace(trackId, std::make_shared<MixerChannel>(trackId, std::move(source), m_sampleRate));
+    updateRenderChannels();
 
     result.val = m_mixerChannels[trackId];
     result.ret = make_ret(Ret::Code::Ok);
@@ -81,6 +94,7 @@ Ret Mixer::removeChannel(const TrackId id)
 
     if (search != m_mixerChannels.end() && search->second) {
         m_mixerChannels.erase(id);
+        updateRenderChannels();
         return make_ret(Ret::Code::Ok);
     }
 
@@ -117,6 +131,9 @@ unsigned int Mixer::audioChannelsCount() const
 samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
+    TRACEFUNC;
+
+    const auto processingStart = std::chrono::steady_clock::now();
 
     for (IClockPtr clock : m_clocks) {
         clock->forward((samplesPerChannel * 1000000) / m_sampleRate);
@@ -124,55 +141,86 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 
     std::fill(outBuffer, outBuffer + samplesPerChannel * audioChannelsCount(), 0.f);
 
-    if (m_writeCacheBuff.size() != samplesPerChannel * audioChannelsCount()) {
-        m_writeCacheBuff.resize(samplesPerChannel * audioChannelsCount(), 0.f);
+    prepareChannelBuffers(samplesPerChannel);
+    m_workerPool->run(&Mixer::processChannel, this, m_renderChannels.size());
+
+    if (m_masterParams.muted || m_channelBuffers.empty()) {
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            notifyAboutAudioSignalChanges(audioChNum, 0);
+        }
+
+        m_mixTime.add(std::chrono::steady_clock::now() - processingStart, samplesPerChannel);
+        return 0;
     }
 
-    samples_t masterChannelSampleCount = 0;
+    //! NOTE The master bus works in the same steps as the channels did,
+    //! so the limiter and the master fx behave exactly as in the real-time mode
+    const samples_t renderStep = this->renderStep(samplesPerChannel);
+    const size_t audioChannels = audioChannelsCount();
 
-    std::vector<std::future<std::vector<float> > > futureList;
+    for (samples_t offset = 0; offset < samplesPerChannel; offset += renderStep) {
+        const samples_t stepSamples = std::min(renderStep, samplesPerChannel - offset);
+        float* stepBuffer = outBuffer + offset * audioChannels;
 
-    for (const auto& pair : m_mixerChannels) {
-        MixerChannelPtr channel = pair.second;
-        std::future<std::vector<float> > future = TaskScheduler::instance()->submit([this, samplesPerChannel,
-                                                                                     channel]() -> std::vector<float> {
-            thread_local std::vector<float> buffer(samplesPerChannel * audioChannelsCount(), 0.f);
-            thread_local std::vector<float> silent_buffer(samplesPerChannel * audioChannelsCount(), 0.f);
+        for (const std::vector<float>& buffer : m_channelBuffers) {
+            mixOutputFromChannel(stepBuffer, buffer.data() + offset * audioChannels, stepSamples);
+        }
 
-            buffer = silent_buffer;
+        completeOutput(stepBuffer, stepSamples);
 
-            if (channel) {
-                channel->process(buffer.data(), samplesPerChannel);
-            }
+        const auto masterFxStart = std::chrono::steady_clock::now();
 
-            return buffer;
-        });
+        for (IFxProcessorPtr& fxProcessor : m_masterFxProcessors) {
+            if (fxProcessor->active()) {
+                fxProcessor->process(stepBuffer, stepSamples);
+            }
+        }
 
-        futureList.emplace_back(std::move(future));
+        m_masterFxTime.add(std::chrono::steady_clock::now() - masterFxStart, stepSamples);
     }
 
-    for (size_t i = 0; i < futureList.size(); ++i) {
-        mixOutputFromChannel(outBuffer, futureList[i].get().data(), samplesPerChannel);
+    m_mixTime.add(std::chrono::steady_clock::now() - processingStart, samplesPerChannel);
 
-        masterChannelSampleCount = std::max(samplesPerChannel, masterChannelSampleCount);
-    }
+    return samplesPerChannel;
+}
 
-    if (m_masterParams.muted || masterChannelSampleCount == 0) {
-        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0);
-        }
-        return 0;
+void Mixer::setRenderStep(samples_t renderStep)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_renderStep = renderStep;
+}
+
+void Mixer::renderAhead(samples_t samplesPerStep)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_renderChannels.empty() || samplesPerStep == 0) {
+        return;
     }
 
-    completeOutput(outBuffer, samplesPerChannel);
+    m_renderSamplesPerChannel = samplesPerStep;
+    m_workerPool->run(&Mixer::renderChannelAhead, this, m_renderChannels.size());
+}
+
+void Mixer::takeMetrics(AudioMetrics& metrics)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    metrics.mix = m_mixTime.take();
+    metrics.masterFx = m_masterFxTime.take();
 
-    for (IFxProcessorPtr& fxProcessor : m_masterFxProcessors) {
-        if (fxProcessor->active()) {
-            fxProcessor->process(outBuffer, samplesPerChannel);
+    metrics.masterFxLatency = 0;
+    for (const IFxProcessorPtr& fx : m_masterFxProcessors) {
+        if (fx->active()) {
+            metrics.masterFxLatency += fx->latency();
         }
     }
 
-    return masterChannelSampleCount;
+    metrics.tracks.clear();
+    for (MixerChannel* channel : m_renderChannels) {
+        metrics.tracks.push_back(channel->takeMetrics());
+    }
 }
 
 void Mixer::setIsActive(bool arg)
@@ -266,7 +314,66 @@ async::Channel<audioch_t, AudioSignalVal> Mixer::masterAudioSignalChanges() cons
     return m_audioSignalNotifier.audioSignalChanges;
 }
 
-void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount)
+void Mixer::processChannel(void* mixer, size_t channelIdx)
+{
+    Mixer* self = static_cast<Mixer*>(mixer);
+    std::vector<float>& buffer = self->m_channelBuffers[channelIdx];
+    MixerChannel* channel = self->m_renderChannels[channelIdx];
+
+    std::fill(buffer.begin(), buffer.end(), 0.f);
+
+    //! NOTE Events are applied at the start of each process call of a synth,
+    //! so a long block is rendered in steps to keep their timing accurate
+    const samples_t samplesPerChannel = self->m_renderSamplesPerChannel;
+    const samples_t renderStep = self->renderStep(samplesPerChannel);
+    const size_t audioChannels = self->audioChannelsCount();
+
+    for (samples_t offset = 0; offset < samplesPerChannel; offset += renderStep) {
+        channel->process(buffer.data() + offset * audioChannels, std::min(renderStep, samplesPerChannel - offset));
+    }
+}
+
+void Mixer::renderChannelAhead(void* mixer, size_t channelIdx)
+{
+    Mixer* self = static_cast<Mixer*>(mixer);
+    self->m_renderChannels[channelIdx]->renderAhead(self->m_renderSamplesPerChannel);
+}
+
+samples_t Mixer::renderStep(samples_t samplesPerChannel) const
+{
+    if (m_renderStep == 0) {
+        return samplesPerChannel;
+    }
+
+    return std::min(m_renderStep, samplesPerChannel);
+}
+
+void Mixer::updateRenderChannels()
+{
+    m_renderChannels.clear();
+
+    for (const auto& pair : m_mixerChannels) {
+        if (pair.second) {
+            m_renderChannels.push_back(pair.second.get());
+        }
+    }
+}
+
+void Mixer::prepareChannelBuffers(samples_t samplesPerChannel)
+{
+    m_renderSamplesPerChannel = samplesPerChannel;
+
+    size_t bufferSize = samplesPerChannel * audioChannelsCount();
+
+    m_channelBuffers.resize(m_renderChannels.size());
+    for (std::vector<float>& buffer : m_channelBuffers) {
+        if (buffer.size() != bufferSize) {
+            buffer.resize(bufferSize);
+        }
+    }
+}
+
+void Mixer::mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount)
 {
     IF_ASSERT_FAILED(outBuffer && inBuffer) {
         return;
@@ -276,13 +383,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int
         return;
     }
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        for (samples_t s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
-
-            outBuffer[idx] += inBuffer[idx];
-        }
-    }
+    dsp::mixSamples(outBuffer, inBuffer, samplesCount * audioChannelsCount());
 }
 
 void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
@@ -291,25 +392,24 @@ void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
         return;
     }
 
-    float totalSquaredSum = 0.f;
+    const audioch_t audioChannels = audioChannelsCount();
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    std::array<gain_t, dsp::MAX_AUDIO_CHANNELS> gains;
+    std::array<float, dsp::MAX_AUDIO_CHANNELS> squaredSums;
 
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
+    for (audioch_t audioChNum = 0; audioChNum < audioChannels; ++audioChNum) {
+        gains[audioChNum] = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
+        squaredSums[audioChNum] = 0.f;
+    }
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+    dsp::applyGainsAndSumSquares(buffer, audioChannels, samplesPerChannel, gains.data(), squaredSums.data());
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    float totalSquaredSum = 0.f;
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
-        }
+    for (audioch_t audioChNum = 0; audioChNum < audioChannels; ++audioChNum) {
+        totalSquaredSum += squaredSums[audioChNum];
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
+        float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesPerChannel);
         notifyAboutAudioSignalChanges(audioChNum, rms);
     }
 
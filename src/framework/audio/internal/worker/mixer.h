@@ -30,6 +30,7 @@
 
 #include "abstractaudiosource.h"
 #include "mixerchannel.h"
+#include "mixerworkerpool.h"
 #include "internal/dsp/limiter.h"
 #include "ifxresolver.h"
 #include "iclock.h"
@@ -44,7 +45,7 @@ public:
 
     IAudioSourcePtr mixedSource();
 
-    RetVal<MixerChannelPtr> addChannel(const TrackId trackId, IAudioSourcePtr source);
+    RetVal<MixerChannelPtr> addChannel(const TrackId trackId, ITrackAudioInputPtr source);
     Ret removeChannel(const TrackId id);
 
     void setAudioChannelsCount(const audioch_t count);
@@ -65,18 +66,45 @@ public:
     samples_t process(float* outBuffer, samples_t samplesPerChannel) override;
     void setIsActive(bool arg) override;
 
+    //! NOTE Blocks longer than the render step are handed to every channel as a whole,
+    //! so the channels of a long block are rendered in parallel with a single dispatch.
+    //! 0 means the block is rendered in one step
+    void setRenderStep(samples_t renderStep);
+
+    //! NOTE Lets the channels fill their lookahead buffers, see ITrackAudioInput::renderAhead
+    void renderAhead(samples_t samplesPerStep);
+
+    //! NOTE Fills the processing times of the mixer and its channels since the last call
+    void takeMetrics(AudioMetrics& metrics);
+
 private:
-    void mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount);
+    static void processChannel(void* mixer, size_t channelIdx);
+    static void renderChannelAhead(void* mixer, size_t channelIdx);
+
+    void updateRenderChannels();
+    void prepareChannelBuffers(samples_t samplesPerChannel);
+    samples_t renderStep(samples_t samplesPerChannel) const;
+
+    void mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount);
     void completeOutput(float* buffer, const samples_t& samplesPerChannel);
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
 
-    std::vector<float> m_writeCacheBuff;
-
     AudioOutputParams m_masterParams;
     async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     std::vector<IFxProcessorPtr> m_masterFxProcessors = {};
 
     std::map<TrackId, MixerChannelPtr> m_mixerChannels = {};
+
+    //! NOTE Everything the channels need during a block is prepared up front,
+    //! so processing doesn't allocate unless the channels or the block size change
+    std::vector<MixerChannel*> m_renderChannels;
+    std::vector<std::vector<float> > m_channelBuffers;
+    samples_t m_renderSamplesPerChannel = 0;
+    samples_t m_renderStep = 0;
+    std::unique_ptr<MixerWorkerPool> m_workerPool;
+
+    ProcessingTimeCounter m_mixTime;
+    ProcessingTimeCounter m_masterFxTime;
     dsp::LimiterPtr m_limiter = nullptr;
 
     std::set<IClockPtr> m_clocks;
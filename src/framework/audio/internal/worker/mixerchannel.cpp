@@ -22,6 +22,8 @@
 #include "mixerchannel.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 
 #include "log.h"
 
@@ -32,7 +34,11 @@ using namespace mu;
 using namespace mu::audio;
 using namespace mu::async;
 
-MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate)
+//! NOTE The load is smoothed over several blocks, so a single slow block doesn't make the meter jump
+static constexpr cpu_load_t CPU_LOAD_SMOOTHING = 0.1f;
+static constexpr cpu_load_t CPU_LOAD_MINIMAL_VALUABLE_DIFF = 0.01f;
+
+MixerChannel::MixerChannel(const TrackId trackId, ITrackAudioInputPtr source, const unsigned int sampleRate)
     : m_trackId(trackId),
     m_sampleRate(sampleRate),
     m_audioSource(std::move(source)),
@@ -58,9 +64,11 @@ void MixerChannel::applyOutputParams(const AudioOutputParams& requiredParams)
 
     m_fxProcessors.clear();
     m_fxProcessors = fxResolver()->resolveFxList(m_trackId, requiredParams.fxChain);
+    m_fxTimes.clear();
 
     for (IFxProcessorPtr& fx : m_fxProcessors) {
         fx->setSampleRate(m_sampleRate);
+        m_fxTimes.push_back(std::make_unique<ProcessingTimeCounter>());
 
         fx->paramsChanged().onReceive(this, [this](const AudioFxParams& fxParams) {
             m_params.fxChain.insert_or_assign(fxParams.chainOrder, fxParams);
@@ -107,6 +115,11 @@ async::Channel<audioch_t, AudioSignalVal> MixerChannel::audioSignalChanges() con
     return m_audioSignalNotifier.audioSignalChanges;
 }
 
+AudioCpuLoadChanges MixerChannel::cpuLoadChanges() const
+{
+    return m_cpuLoadChanges;
+}
+
 bool MixerChannel::isActive() const
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -137,6 +150,7 @@ void MixerChannel::setSampleRate(unsigned int sampleRate)
         return;
     }
 
+    m_sampleRate = sampleRate;
     m_audioSource->setSampleRate(sampleRate);
 
     for (IFxProcessorPtr fx : m_fxProcessors) {
@@ -169,13 +183,19 @@ async::Channel<unsigned int> MixerChannel::audioChannelsCountChanged() const
 samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
+    TRACEFUNC;
 
     IF_ASSERT_FAILED(m_audioSource) {
         return 0;
     }
 
+    const auto processingStart = std::chrono::steady_clock::now();
+
     samples_t processedSamplesCount = m_audioSource->process(buffer, samplesPerChannel);
 
+    auto sourceEnd = std::chrono::steady_clock::now();
+    m_sourceTime.add(sourceEnd - processingStart, samplesPerChannel);
+
     if (processedSamplesCount == 0 || m_params.muted) {
         std::fill(buffer, buffer + samplesPerChannel * audioChannelsCount(), 0.f);
 
@@ -183,42 +203,99 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
             notifyAboutAudioSignalChanges(audioChNum, 0.f);
         }
 
+        auto processingTime = std::chrono::steady_clock::now() - processingStart;
+        updateCpuLoad(processingTime, samplesPerChannel);
+        m_channelTime.add(processingTime, samplesPerChannel);
+
         return processedSamplesCount;
     }
 
-    for (IFxProcessorPtr fx : m_fxProcessors) {
+    for (size_t i = 0; i < m_fxProcessors.size(); ++i) {
+        const IFxProcessorPtr& fx = m_fxProcessors[i];
         if (!fx->active()) {
             continue;
         }
+
+        auto fxStart = std::chrono::steady_clock::now();
         fx->process(buffer, samplesPerChannel);
+        m_fxTimes[i]->add(std::chrono::steady_clock::now() - fxStart, samplesPerChannel);
     }
 
     completeOutput(buffer, samplesPerChannel);
 
+    auto processingTime = std::chrono::steady_clock::now() - processingStart;
+    updateCpuLoad(processingTime, samplesPerChannel);
+    m_channelTime.add(processingTime, samplesPerChannel);
+
     return processedSamplesCount;
 }
 
-void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
+void MixerChannel::renderAhead(samples_t samplesPerStep)
 {
-    float totalSquaredSum = 0.f;
+    ONLY_AUDIO_WORKER_THREAD;
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    IF_ASSERT_FAILED(m_audioSource) {
+        return;
+    }
+
+    const auto processingStart = std::chrono::steady_clock::now();
 
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+    samples_t renderedSamplesCount = m_audioSource->renderAhead(samplesPerStep);
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+    if (renderedSamplesCount > 0) {
+        auto processingTime = std::chrono::steady_clock::now() - processingStart;
+        updateCpuLoad(processingTime, renderedSamplesCount);
+
+        //! NOTE The audio is counted when it's played, so that the load doesn't count it twice
+        m_sourceTime.add(processingTime, 0);
+        m_channelTime.add(processingTime, 0);
+    }
+}
+
+AudioTrackMetrics MixerChannel::takeMetrics()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    AudioTrackMetrics result;
+    result.trackId = m_trackId;
+    result.channel = m_channelTime.take();
+    result.source = m_sourceTime.take();
+
+    if (m_audioSource) {
+        result.sourceId = m_audioSource->inputParams().resourceMeta.id;
+    }
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    for (size_t i = 0; i < m_fxProcessors.size(); ++i) {
+        result.fx.emplace_back(m_fxProcessors[i]->params().resourceMeta.id, m_fxTimes[i]->take());
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
+        if (m_fxProcessors[i]->active()) {
+            result.fxLatency += m_fxProcessors[i]->latency();
         }
+    }
+
+    return result;
+}
+
+void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
+{
+    const audioch_t audioChannels = audioChannelsCount();
+
+    std::array<gain_t, dsp::MAX_AUDIO_CHANNELS> gains;
+    std::array<float, dsp::MAX_AUDIO_CHANNELS> squaredSums;
+
+    for (audioch_t audioChNum = 0; audioChNum < audioChannels; ++audioChNum) {
+        gains[audioChNum] = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+        squaredSums[audioChNum] = 0.f;
+    }
+
+    dsp::applyGainsAndSumSquares(buffer, audioChannels, samplesCount, gains.data(), squaredSums.data());
+
+    float totalSquaredSum = 0.f;
+
+    for (audioch_t audioChNum = 0; audioChNum < audioChannels; ++audioChNum) {
+        totalSquaredSum += squaredSums[audioChNum];
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+        float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesCount);
 
         notifyAboutAudioSignalChanges(audioChNum, rms);
     }
@@ -235,3 +312,24 @@ void MixerChannel::notifyAboutAudioSignalChanges(const audioch_t audioChannelNum
 {
     m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
 }
+
+void MixerChannel::updateCpuLoad(std::chrono::steady_clock::duration processingTime, samples_t samplesPerChannel)
+{
+    if (m_sampleRate == 0 || samplesPerChannel == 0) {
+        return;
+    }
+
+    using seconds_f = std::chrono::duration<float>;
+
+    const float blockDuration = static_cast<float>(samplesPerChannel) / static_cast<float>(m_sampleRate);
+    const cpu_load_t blockLoad = std::chrono::duration_cast<seconds_f>(processingTime).count() / blockDuration;
+
+    m_cpuLoad += (blockLoad - m_cpuLoad) * CPU_LOAD_SMOOTHING;
+
+    if (std::abs(m_cpuLoad - m_notifiedCpuLoad) < CPU_LOAD_MINIMAL_VALUABLE_DIFF) {
+        return;
+    }
+
+    m_notifiedCpuLoad = m_cpuLoad;
+    m_cpuLoadChanges.send(m_cpuLoad);
+}
@@ -22,6 +22,8 @@
 #ifndef MU_AUDIO_MIXERCHANNEL_H
 #define MU_AUDIO_MIXERCHANNEL_H
 
+#include <chrono>
+
 #include "modularity/ioc.h"
 
 #include "async/asyncable.h"
@@ -30,6 +32,7 @@
 #include "ifxprocessor.h"
 #include "track.h"
 #include "internal/dsp/compressor.h"
+#include "internal/processingtimecounter.h"
 
 namespace mu::audio {
 class MixerChannel : public ITrackAudioOutput, public async::Asyncable
@@ -37,13 +40,14 @@ class MixerChannel : public ITrackAudioOutput, public async::Asyncable
     INJECT(audio, fx::IFxResolver, fxResolver)
 
 public:
-    explicit MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate);
+    explicit MixerChannel(const TrackId trackId, ITrackAudioInputPtr source, const unsigned int sampleRate);
 
     const AudioOutputParams& outputParams() const override;
     void applyOutputParams(const AudioOutputParams& requiredParams) override;
     async::Channel<AudioOutputParams> outputParamsChanged() const override;
 
     async::Channel<audioch_t, AudioSignalVal> audioSignalChanges() const override;
+    AudioCpuLoadChanges cpuLoadChanges() const override;
 
     bool isActive() const override;
     void setIsActive(bool arg) override;
@@ -53,22 +57,36 @@ public:
     async::Channel<unsigned int> audioChannelsCountChanged() const override;
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
+    void renderAhead(samples_t samplesPerStep);
+
+    //! NOTE Returns the processing times since the last call
+    AudioTrackMetrics takeMetrics();
+
 private:
     void completeOutput(float* buffer, unsigned int samplesCount) const;
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
+    void updateCpuLoad(std::chrono::steady_clock::duration processingTime, samples_t samplesPerChannel);
 
     TrackId m_trackId = -1;
 
     unsigned int m_sampleRate = 0;
     AudioOutputParams m_params;
 
-    IAudioSourcePtr m_audioSource = nullptr;
+    ITrackAudioInputPtr m_audioSource = nullptr;
     std::vector<IFxProcessorPtr> m_fxProcessors = {};
 
+    ProcessingTimeCounter m_channelTime;
+    ProcessingTimeCounter m_sourceTime;
+    std::vector<std::unique_ptr<ProcessingTimeCounter> > m_fxTimes; // one per fx processor
+
     dsp::CompressorPtr m_compressor = nullptr;
 
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+
+    cpu_load_t m_cpuLoad = 0.f;
+    cpu_load_t m_notifiedCpuLoad = 0.f;
+    AudioCpuLoadChanges m_cpuLoadChanges;
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
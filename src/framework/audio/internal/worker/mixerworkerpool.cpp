@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mixerworkerpool.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define MU_AUDIO_CPU_PAUSE _mm_pause()
+#else
+#define MU_AUDIO_CPU_PAUSE std::this_thread::yield()
+#endif
+
+#include "runtime.h"
+
+#include "internal/audiosanitizer.h"
+
+using namespace mu::audio;
+
+//! NOTE How many times a worker checks for a new block before it goes to sleep.
+//! Short enough not to burn a core between blocks, long enough to catch back-to-back blocks
+static constexpr int SPIN_COUNT_BEFORE_SLEEP = 4000;
+
+static inline void cpuRelax()
+{
+    MU_AUDIO_CPU_PAUSE;
+}
+
+MixerWorkerPool::MixerWorkerPool(size_t threadCount)
+{
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&MixerWorkerPool::th_workerLoop, this, "audio_mixer_" + std::to_string(i));
+    }
+}
+
+MixerWorkerPool::~MixerWorkerPool()
+{
+    m_isActive = false;
+    {
+        std::lock_guard lock(m_sleepMutex);
+    }
+    m_wakeCv.notify_all();
+
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t MixerWorkerPool::threadCount() const
+{
+    return m_threads.size();
+}
+
+uint64_t MixerWorkerPool::makeState(uint32_t generation, size_t jobCount, size_t nextJob)
+{
+    return (uint64_t(generation) << 32) | (uint64_t(jobCount) << 16) | uint64_t(nextJob);
+}
+
+uint32_t MixerWorkerPool::generationOf(uint64_t state)
+{
+    return uint32_t(state >> 32);
+}
+
+void MixerWorkerPool::run(Job job, void* context, size_t jobCount)
+{
+    if (jobCount == 0) {
+        return;
+    }
+
+    if (m_threads.empty() || jobCount == 1 || jobCount > MAX_JOBS) {
+        for (size_t i = 0; i < jobCount; ++i) {
+            job(context, i);
+        }
+        return;
+    }
+
+    //! NOTE The job and the context are only read by a thread that has claimed an index of this generation,
+    //! and no index can be claimed before the new state is published
+    m_job = job;
+    m_context = context;
+    m_pendingJobs.store(jobCount, std::memory_order_relaxed);
+    ++m_generation;
+    m_state.store(makeState(m_generation, jobCount, 0));
+
+    if (m_sleepingThreads.load() > 0) {
+        {
+            std::lock_guard lock(m_sleepMutex);
+        }
+        m_wakeCv.notify_all();
+    }
+
+    runJobs(m_generation);
+
+    while (m_pendingJobs.load(std::memory_order_acquire) > 0) {
+        cpuRelax();
+    }
+}
+
+void MixerWorkerPool::runJobs(uint32_t generation)
+{
+    uint64_t state = m_state.load(std::memory_order_acquire);
+
+    while (generationOf(state) == generation) {
+        size_t jobCount = (state >> 16) & MAX_JOBS;
+        size_t jobIdx = state & MAX_JOBS;
+        if (jobIdx >= jobCount) {
+            return;
+        }
+
+        if (!m_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            continue;
+        }
+
+        m_job(m_context, jobIdx);
+        m_pendingJobs.fetch_sub(1, std::memory_order_release);
+
+        state = m_state.load(std::memory_order_acquire);
+    }
+}
+
+void MixerWorkerPool::th_workerLoop(const std::string& name)
+{
+    mu::runtime::setThreadName(name);
+    AudioSanitizer::setupWorkerPoolThread();
+
+    uint32_t lastGeneration = 0;
+
+    while (m_isActive) {
+        uint32_t generation = generationOf(m_state.load(std::memory_order_acquire));
+
+        for (int i = 0; i < SPIN_COUNT_BEFORE_SLEEP && generation == lastGeneration && m_isActive; ++i) {
+            cpuRelax();
+            generation = generationOf(m_state.load(std::memory_order_acquire));
+        }
+
+        if (generation == lastGeneration) {
+            ++m_sleepingThreads;
+            {
+                std::unique_lock lock(m_sleepMutex);
+                m_wakeCv.wait(lock, [this, lastGeneration]() {
+                    return !m_isActive || generationOf(m_state.load()) != lastGeneration;
+                });
+            }
+            --m_sleepingThreads;
+            continue;
+        }
+
+        lastGeneration = generation;
+        runJobs(generation);
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_MIXERWORKERPOOL_H
+#define MU_AUDIO_MIXERWORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mu::audio {
+//! NOTE A fixed set of threads that runs the mixer channels of one audio block in parallel.
+//! Unlike TaskScheduler, dispatching a block does not allocate and does not take a lock
+//! on the hot path: jobs are claimed from a single atomic word and completion is an atomic counter.
+//! The calling thread takes part in the work, so a block is never waiting for a sleeping thread to start.
+class MixerWorkerPool
+{
+public:
+    using Job = void (*)(void* context, size_t jobIdx);
+
+    static constexpr size_t MAX_JOBS = 0xFFFF;
+
+    explicit MixerWorkerPool(size_t threadCount);
+    ~MixerWorkerPool();
+
+    size_t threadCount() const;
+
+    //! NOTE Runs job(context, i) for every i in [0, jobCount) and returns when all of them are done.
+    //! Must only be called from one thread at a time
+    void run(Job job, void* context, size_t jobCount);
+
+private:
+    // generation (32 bits) | job count (16 bits) | next job index (16 bits)
+    static uint64_t makeState(uint32_t generation, size_t jobCount, size_t nextJob);
+    static uint32_t generationOf(uint64_t state);
+
+    void th_workerLoop(const std::string& name);
+    void runJobs(uint32_t generation);
+
+    std::vector<std::thread> m_threads;
+
+    std::atomic<uint64_t> m_state = 0;
+    std::atomic<size_t> m_pendingJobs = 0;
+    Job m_job = nullptr;
+    void* m_context = nullptr;
+    uint32_t m_generation = 0;
+
+    std::atomic<bool> m_isActive = true;
+    std::atomic<size_t> m_sleepingThreads = 0;
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeCv;
+};
+}
+
+#endif // MU_AUDIO_MIXERWORKERPOOL_H
@@ -42,15 +42,20 @@ void Playback::init()
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    m_playerHandlersPtr = std::make_shared<PlayerHandler>(this);
+    m_playerHandlersPtr = std::make_shared<PlayerHandler>(this, &m_commands);
     m_trackHandlersPtr = std::make_shared<TracksHandler>(this);
-    m_audioOutputPtr = std::make_shared<AudioOutputHandler>(this);
+    m_audioOutputPtr = std::make_shared<AudioOutputHandler>(this, this, &m_commands);
+
+    m_commands.setConsumer([this](const AudioCommand& command) {
+        applyCommand(command);
+    });
 }
 
 void Playback::deinit()
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    m_commands.setConsumer(nullptr);
     m_sequences.clear();
 
     m_playerHandlersPtr = nullptr;
@@ -139,6 +144,43 @@ IAudioOutputPtr Playback::audioOutput() const
     return m_audioOutputPtr;
 }
 
+void Playback::setCommandsWakeup(const AudioCommandQueue::Wakeup& wakeup)
+{
+    m_commands.setWakeup(wakeup);
+}
+
+void Playback::processCommands()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_commands.process();
+}
+
+void Playback::applyCommand(const AudioCommand& command)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    switch (command.type) {
+    case AudioCommand::Type::Play:
+    case AudioCommand::Type::Seek:
+    case AudioCommand::Type::Stop:
+    case AudioCommand::Type::Pause:
+    case AudioCommand::Type::Resume:
+        if (m_playerHandlersPtr) {
+            m_playerHandlersPtr->applyCommand(command);
+        }
+        break;
+    case AudioCommand::Type::SetOutputLevels:
+    case AudioCommand::Type::SetMasterOutputLevels:
+        if (m_audioOutputPtr) {
+            m_audioOutputPtr->applyCommand(command);
+        }
+        break;
+    case AudioCommand::Type::Undefined:
+        break;
+    }
+}
+
 ITrackSequencePtr Playback::sequence(const TrackSequenceId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
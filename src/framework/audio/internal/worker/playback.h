@@ -32,7 +32,12 @@
 #include "igettracksequence.h"
 #include "iplayback.h"
 
+#include "audiocommandqueue.h"
+
 namespace mu::audio {
+class PlayerHandler;
+class TracksHandler;
+class AudioOutputHandler;
 class Playback : public IPlayback, public IGetTrackSequence, public async::Asyncable
 {
 public:
@@ -51,14 +56,23 @@ public:
     ITracksPtr tracks() const override;
     IAudioOutputPtr audioOutput() const override;
 
+    void setCommandsWakeup(const AudioCommandQueue::Wakeup& wakeup);
+
+    //! NOTE Applies the commands sent through the lock-free queue, called on every iteration of the worker loop
+    void processCommands();
+
 protected:
     // IGetTrackSequence
     ITrackSequencePtr sequence(const TrackSequenceId id) const override;
 
 private:
-    IPlayerPtr m_playerHandlersPtr = nullptr;
-    ITracksPtr m_trackHandlersPtr = nullptr;
-    IAudioOutputPtr m_audioOutputPtr = nullptr;
+    void applyCommand(const AudioCommand& command);
+
+    std::shared_ptr<PlayerHandler> m_playerHandlersPtr = nullptr;
+    std::shared_ptr<TracksHandler> m_trackHandlersPtr = nullptr;
+    std::shared_ptr<AudioOutputHandler> m_audioOutputPtr = nullptr;
+
+    AudioCommandQueue m_commands;
 
     std::map<TrackSequenceId, ITrackSequencePtr> m_sequences;
 
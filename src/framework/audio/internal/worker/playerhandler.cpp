@@ -32,8 +32,8 @@
 using namespace mu::audio;
 using namespace mu::async;
 
-PlayerHandler::PlayerHandler(IGetTrackSequence* getSequence)
-    : m_getSequence(getSequence)
+PlayerHandler::PlayerHandler(IGetTrackSequence* getSequence, AudioCommandQueue* commands)
+    : m_getSequence(getSequence), m_commands(commands)
 {
 }
 
@@ -44,62 +44,48 @@ PlayerHandler::~PlayerHandler()
 
 void PlayerHandler::play(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
+    AudioCommand command;
+    command.type = AudioCommand::Type::Play;
+    command.sequenceId = sequenceId;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->play();
-        }
-    }, AudioThread::ID);
+    sendCommand(command);
 }
 
 void PlayerHandler::seek(const TrackSequenceId sequenceId, const msecs_t newPositionMsecs)
 {
-    Async::call(this, [this, sequenceId, newPositionMsecs]() {
-        ONLY_AUDIO_WORKER_THREAD;
+    AudioCommand command;
+    command.type = AudioCommand::Type::Seek;
+    command.sequenceId = sequenceId;
+    command.positionMsecs = newPositionMsecs;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->seek(newPositionMsecs);
-        }
-    }, AudioThread::ID);
+    sendCommand(command);
 }
 
 void PlayerHandler::stop(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
+    AudioCommand command;
+    command.type = AudioCommand::Type::Stop;
+    command.sequenceId = sequenceId;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->stop();
-        }
-    }, AudioThread::ID);
+    sendCommand(command);
 }
 
 void PlayerHandler::pause(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
+    AudioCommand command;
+    command.type = AudioCommand::Type::Pause;
+    command.sequenceId = sequenceId;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->pause();
-        }
-    }, AudioThread::ID);
+    sendCommand(command);
 }
 
 void PlayerHandler::resume(const TrackSequenceId sequenceId)
 {
-    Async::call(this, [this, sequenceId]() {
-        ONLY_AUDIO_WORKER_THREAD;
+    AudioCommand command;
+    command.type = AudioCommand::Type::Resume;
+    command.sequenceId = sequenceId;
 
-        ITrackSequencePtr s = sequence(sequenceId);
-        if (s) {
-            s->player()->resume();
-        }
-    }, AudioThread::ID);
+    sendCommand(command);
 }
 
 void PlayerHandler::setDuration(const TrackSequenceId sequenceId, const msecs_t durationMsec)
@@ -161,6 +147,53 @@ Channel<TrackSequenceId, PlaybackStatus> PlayerHandler::playbackStatusChanged()
     return m_playbackStatusChanged;
 }
 
+void PlayerHandler::applyCommand(const AudioCommand& command)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    ITrackSequencePtr s = sequence(command.sequenceId);
+    if (!s) {
+        return;
+    }
+
+    switch (command.type) {
+    case AudioCommand::Type::Play: s->player()->play();
+        break;
+    case AudioCommand::Type::Seek: s->player()->seek(command.positionMsecs);
+        break;
+    case AudioCommand::Type::Stop: s->player()->stop();
+        break;
+    case AudioCommand::Type::Pause: s->player()->pause();
+        break;
+    case AudioCommand::Type::Resume: s->player()->resume();
+        break;
+    default:
+        break;
+    }
+}
+
+void PlayerHandler::sendCommand(const AudioCommand& command)
+{
+    //! NOTE The queue has a single producer, so the other threads (and a full queue) go the usual way
+    size_t pushedBefore = 0;
+
+    if (m_commands && AudioSanitizer::isMainThread()) {
+        if (m_commands->push(command)) {
+            return;
+        }
+
+        pushedBefore = m_commands->pushedCount();
+    }
+
+    Async::call(this, [this, command, pushedBefore]() {
+        if (m_commands) {
+            m_commands->process(pushedBefore);
+        }
+
+        applyCommand(command);
+    }, AudioThread::ID);
+}
+
 ITrackSequencePtr PlayerHandler::sequence(const TrackSequenceId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
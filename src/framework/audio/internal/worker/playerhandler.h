@@ -27,12 +27,13 @@
 
 #include "iplayer.h"
 #include "igettracksequence.h"
+#include "audiocommandqueue.h"
 
 namespace mu::audio {
 class PlayerHandler : public IPlayer, public async::Asyncable
 {
 public:
-    explicit PlayerHandler(IGetTrackSequence* getSequence);
+    explicit PlayerHandler(IGetTrackSequence* getSequence, AudioCommandQueue* commands = nullptr);
     ~PlayerHandler();
 
     void play(const TrackSequenceId sequenceId) override;
@@ -48,11 +49,16 @@ public:
     async::Channel<TrackSequenceId, msecs_t> playbackPositionMsecs() const override;
     async::Channel<TrackSequenceId, PlaybackStatus> playbackStatusChanged() const override;
 
+    void applyCommand(const AudioCommand& command);
+
 private:
+    void sendCommand(const AudioCommand& command);
+
     ITrackSequencePtr sequence(const TrackSequenceId id) const;
     void ensureSubscriptions(const ITrackSequencePtr s) const;
 
     IGetTrackSequence* m_getSequence = nullptr;
+    AudioCommandQueue* m_commands = nullptr;
 
     mutable async::Channel<TrackSequenceId, msecs_t> m_playbackPositionMsecsChanged;
     mutable async::Channel<TrackSequenceId, PlaybackStatus> m_playbackStatusChanged;
@@ -25,6 +25,8 @@
 #include <vector>
 #include <deque>
 namespace mu::audio {
+//! NOTE Works on the whole data with random access.
+//! For streams, see dsp::PolyphaseResampler, it converts block by block without allocation
 class SampleRateConvertor
 {
 public:
@@ -159,3 +159,19 @@ Channel<audioch_t, AudioSignalVal> SequenceIO::audioSignalChanges(const TrackId
 
     return track->outputHandler->audioSignalChanges();
 }
+
+AudioCpuLoadChanges SequenceIO::cpuLoadChanges(const TrackId id) const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(m_getTracks) {
+        return {};
+    }
+
+    TrackPtr track = m_getTracks->track(id);
+    IF_ASSERT_FAILED(track) {
+        return AudioCpuLoadChanges();
+    }
+
+    return track->outputHandler->cpuLoadChanges();
+}
@@ -47,6 +47,7 @@ public:
     async::Channel<TrackId, AudioOutputParams> outputParamsChanged() const override;
 
     async::Channel<audioch_t, AudioSignalVal> audioSignalChanges(const TrackId id) const override;
+    AudioCpuLoadChanges cpuLoadChanges(const TrackId id) const override;
 
 private:
     IGetTracks* m_getTracks = nullptr;
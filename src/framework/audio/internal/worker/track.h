@@ -46,6 +46,11 @@ public:
     virtual ~ITrackAudioInput() = default;
 
     virtual void seek(const msecs_t newPositionMsecs) = 0;
+
+    //! NOTE Renders the next steps ahead of the playhead, if the source keeps a lookahead buffer.
+    //! Called between the audio blocks, with the same number of samples per step as process().
+    //! Returns the number of samples (per channel) rendered
+    virtual samples_t renderAhead(const samples_t samplesPerStep) = 0;
     virtual const AudioInputParams& inputParams() const = 0;
     virtual void applyInputParams(const AudioInputParams& requiredParams) = 0;
     virtual async::Channel<AudioInputParams> inputParamsChanged() const = 0;
@@ -61,6 +66,7 @@ public:
     virtual async::Channel<AudioOutputParams> outputParamsChanged() const = 0;
 
     virtual async::Channel<audioch_t, AudioSignalVal> audioSignalChanges() const = 0;
+    virtual AudioCpuLoadChanges cpuLoadChanges() const = 0;
 };
 
 using ITrackAudioInputPtr = std::shared_ptr<ITrackAudioInput>;
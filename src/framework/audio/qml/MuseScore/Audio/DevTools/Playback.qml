@@ -39,6 +39,10 @@ Rectangle {
         }
     }
 
+    AudioMetricsModel {
+        id: metricsModel
+    }
+
     Rectangle {
         id: backgroundRect
 
@@ -84,4 +88,30 @@ Rectangle {
             currentSignalAmplitude: waveModel.currentSignalAmplitude
         }
     }
+
+    Column {
+        id: metricsColumn
+
+        anchors.top: contentRow.bottom
+        anchors.topMargin: 12
+        anchors.left: parent.left
+        anchors.leftMargin: 12
+        anchors.right: parent.right
+
+        spacing: 8
+
+        FlatButton {
+            text: metricsModel.loggingEnabled ? "Stop logging metrics" : "Log metrics"
+
+            onClicked: {
+                metricsModel.loggingEnabled = !metricsModel.loggingEnabled
+            }
+        }
+
+        StyledTextLabel {
+            width: parent.width
+            horizontalAlignment: Text.AlignLeft
+            text: metricsModel.report
+        }
+    }
 }
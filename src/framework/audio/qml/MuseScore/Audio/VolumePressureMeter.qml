@@ -25,7 +25,9 @@ import MuseScore.UiComponents 1.0
 import MuseScore.Ui 1.0
 import MuseScore.Audio 1.0
 
-Canvas {
+//! NOTE Only the background and the ruler are painted on the canvas, and only when the theme changes.
+//! The level itself is a clipped gradient rectangle, so a new value just moves a scene graph node
+Item {
     id: root
 
     property real currentVolumePressure: -60.0
@@ -39,10 +41,11 @@ Canvas {
     width: root.showRuler ? prv.indicatorWidth + 20 : prv.indicatorWidth
     height: prv.indicatorHeight + (prv.overloadHeight * 2)
 
+    onShowRulerChanged: { canvas.requestPaint() }
+
     QtObject {
         id: prv
 
-        property var gradient: null
         readonly property int overloadHeight: 4
 
         readonly property real indicatorHeight: 140
@@ -52,6 +55,13 @@ Canvas {
         readonly property int fullValueRangeLength: root.maxDisplayedVolumePressure - root.minDisplayedVolumePressure
         readonly property real divisionPixels: (prv.indicatorHeight - prv.overloadHeight) / fullValueRangeLength
 
+        readonly property real valueLength: Math.max(0, Math.min(prv.maxValueLength,
+                                                                 prv.divisionPixels * (prv.fullValueRangeLength - Math.abs(root.currentVolumePressure))))
+        readonly property real maxValueLength: prv.indicatorHeight - prv.overloadHeight
+
+        // the gradient spans the meter without the overload areas, the rest of the bar keeps the last color
+        readonly property real gradientScale: (prv.indicatorHeight - 2 * prv.overloadHeight) / prv.maxValueLength
+
         readonly property real unitsTextWidth: 12
         readonly property color unitTextColor: Utils.colorWithAlpha(ui.theme.fontPrimaryColor, 0.8)
         readonly property string unitTextFont: {
@@ -61,8 +71,8 @@ Canvas {
             return pxSize + ' ' + family
         }
 
-        onUnitTextColorChanged: { prv.rulerNeedsPaint = true; root.requestPaint() }
-        onUnitTextFontChanged: { prv.rulerNeedsPaint = true; root.requestPaint() }
+        onUnitTextColorChanged: { canvas.requestPaint() }
+        onUnitTextFontChanged: { canvas.requestPaint() }
 
         // strokes
         readonly property real strokeHorizontalMargin: 2
@@ -73,97 +83,115 @@ Canvas {
         readonly property real shortStrokeWidth: 2
         readonly property color shortStrokeColor: Utils.colorWithAlpha(ui.theme.fontPrimaryColor, 0.3)
 
-        onLongStrokeColorChanged: { prv.rulerNeedsPaint = true; root.requestPaint() }
-        onShortStrokeColorChanged: { prv.rulerNeedsPaint = true; root.requestPaint() }
-
-        property bool rulerNeedsPaint: true
+        onLongStrokeColorChanged: { canvas.requestPaint() }
+        onShortStrokeColorChanged: { canvas.requestPaint() }
     }
 
-    function drawRuler(ctx, originVPos, originHPos, fullStep, smallStep, strokeHeight, strokeWidth) {
-        ctx.clearRect(0, prv.indicatorWidth, root.height, root.width - prv.indicatorWidth)
-        ctx.font = prv.unitTextFont
+    Canvas {
+        id: canvas
 
-        var currentStrokeVPos = 0
+        anchors.fill: parent
 
-        for (var i = 0; i <= prv.fullValueRangeLength; i+=smallStep) {
-            if (i == 0) {
-                currentStrokeVPos = originVPos
-            } else {
-                currentStrokeVPos += prv.divisionPixels * smallStep
-            }
+        function drawRuler(ctx, originVPos, originHPos, fullStep, smallStep, strokeHeight, strokeWidth) {
+            ctx.font = prv.unitTextFont
+
+            var currentStrokeVPos = 0
 
-            if (i % fullStep) {
-                ctx.fillStyle = prv.shortStrokeColor
-                ctx.fillRect(currentStrokeVPos,
-                             originHPos,
-                             prv.shortStrokeHeight,
-                             prv.shortStrokeWidth)
+            for (var i = 0; i <= prv.fullValueRangeLength; i+=smallStep) {
+                if (i == 0) {
+                    currentStrokeVPos = originVPos
+                } else {
+                    currentStrokeVPos += prv.divisionPixels * smallStep
+                }
 
-            } else {
-                ctx.fillStyle = prv.longStrokeColor
-                ctx.fillRect(currentStrokeVPos,
-                             originHPos,
-                             prv.longStrokeHeight,
-                             prv.longStrokeWidth)
+                if (i % fullStep) {
+                    ctx.fillStyle = prv.shortStrokeColor
+                    ctx.fillRect(currentStrokeVPos,
+                                 originHPos,
+                                 prv.shortStrokeHeight,
+                                 prv.shortStrokeWidth)
 
-                let textHPos = originHPos + prv.longStrokeWidth + prv.strokeHorizontalMargin
+                } else {
+                    ctx.fillStyle = prv.longStrokeColor
+                    ctx.fillRect(currentStrokeVPos,
+                                 originHPos,
+                                 prv.longStrokeHeight,
+                                 prv.longStrokeWidth)
 
-                ctx.save()
+                    let textHPos = originHPos + prv.longStrokeWidth + prv.strokeHorizontalMargin
 
-                ctx.rotate(Math.PI/2)
-                ctx.fillStyle = prv.unitTextColor
-                ctx.fillText(prv.fullValueRangeLength - i, textHPos, -currentStrokeVPos + 2)
+                    ctx.save()
 
-                ctx.restore()
+                    ctx.rotate(Math.PI/2)
+                    ctx.fillStyle = prv.unitTextColor
+                    ctx.fillText(prv.fullValueRangeLength - i, textHPos, -currentStrokeVPos + 2)
+
+                    ctx.restore()
+                }
             }
         }
 
-        prv.rulerNeedsPaint = false
-    }
+        onPaint: {
+            var ctx = canvas.context
 
-    onPaint: {
-        var ctx = root.context
+            if (!ctx) {
+                ctx = getContext("2d")
+                ctx.translate(0, root.height)
+                ctx.rotate(3 * (Math.PI/2))
 
-        if (!ctx) {
-            ctx = getContext("2d")
-            ctx.translate(0, root.height)
-            ctx.rotate(3 * (Math.PI/2))
+                ctx.textAlign = "start"
+            }
 
-            ctx.textAlign = "start"
-        }
+            ctx.clearRect(0, 0, root.height, root.width)
 
-        ctx.clearRect(0, 0, root.height, prv.indicatorWidth)
+            ctx.fillStyle = "#4D4D4D"
+            ctx.fillRect(prv.overloadHeight, 0, prv.indicatorHeight, prv.indicatorWidth)
 
-        ctx.fillStyle = "#4D4D4D"
-        ctx.fillRect(prv.overloadHeight, 0, prv.indicatorHeight, prv.indicatorWidth)
+            if (root.showRuler) {
+                var originVPos = prv.overloadHeight
+                var originHPos = prv.indicatorWidth + prv.strokeHorizontalMargin
 
-        ctx.fillStyle = root.isClipping ? "#FF1C1C" : "#666666"
-        ctx.fillRect(prv.indicatorHeight, 0, prv.overloadHeight, prv.indicatorWidth)
+                drawRuler(ctx, originVPos, originHPos, 6/*fullStep*/, 3/*smallStep*/)
+            }
+        }
 
-        if (!prv.gradient) {
-            prv.gradient = ctx.createLinearGradient(prv.overloadHeight, 0, prv.indicatorHeight - prv.overloadHeight, prv.indicatorWidth)
-            prv.gradient.addColorStop(0.0, "#26E386")
-            prv.gradient.addColorStop(0.55, "#CBED41")
-            prv.gradient.addColorStop(0.80, "#FC8226")
+        Component.onCompleted: {
+            requestPaint()
         }
+    }
 
-        ctx.fillStyle = prv.gradient
-        ctx.fillRect(prv.overloadHeight, 0, prv.divisionPixels * (prv.fullValueRangeLength - Math.abs(root.currentVolumePressure)), prv.indicatorWidth)
+    Rectangle {
+        id: clippingIndicator
 
-        if (prv.rulerNeedsPaint) {
-            var originVPos = prv.overloadHeight
-            var originHPos = prv.indicatorWidth + prv.strokeHorizontalMargin
+        x: 0
+        y: prv.overloadHeight
+        width: prv.indicatorWidth
+        height: prv.overloadHeight
 
-            drawRuler(ctx, originVPos, originHPos, 6/*fullStep*/, 3/*smallStep*/)
-        }
+        color: root.isClipping ? "#FF1C1C" : "#666666"
     }
 
-    onCurrentVolumePressureChanged: {
-        requestPaint()
-    }
+    Item {
+        id: valueBar
+
+        x: 0
+        y: root.height - prv.overloadHeight - height
+        width: prv.indicatorWidth
+        height: prv.valueLength
 
-    Component.onCompleted: {
-        prv.rulerNeedsPaint = true
-        requestPaint()
+        clip: true
+
+        Rectangle {
+            anchors.bottom: parent.bottom
+
+            width: parent.width
+            height: prv.maxValueLength
+
+            gradient: Gradient {
+                GradientStop { position: 1.0 - 0.80 * prv.gradientScale; color: "#FC8226" }
+                GradientStop { position: 1.0 - 0.55 * prv.gradientScale; color: "#CBED41" }
+                GradientStop { position: 1.0; color: "#26E386" }
+            }
+        }
     }
 }
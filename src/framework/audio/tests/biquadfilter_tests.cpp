@@ -0,0 +1,110 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "internal/dsp/biquadfilter.h"
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+class Audio_BiquadFilterTests : public ::testing::Test
+{
+public:
+    static BiquadFilter peakFilter()
+    {
+        //! NOTE A peaking filter of +6 dB at 1 kHz, the same as the one of the Equaliser
+        const float a = std::pow(10.f, 6.f / 40.f);
+        const float w0 = 2 * M_PI * 1000.f / 44100.f;
+        const float alpha = std::sin(w0) * a / 2;
+
+        BiquadFilter filter;
+        filter.setCoefficients(1 + alpha * a, -2 * std::cos(w0), 1 - alpha * a, 1 + alpha / a, -2 * std::cos(w0), 1 - alpha / a);
+        return filter;
+    }
+
+    static std::vector<float> signal(const audioch_t audioChannelsCount, const samples_t samplesPerChannel)
+    {
+        std::vector<float> result(audioChannelsCount * samplesPerChannel);
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = std::sin(0.05f * i) * 0.5f + ((i * 7919) % 101) / 200.f - 0.25f;
+        }
+        return result;
+    }
+};
+
+TEST_F(Audio_BiquadFilterTests, SameAsScalar)
+{
+    for (audioch_t audioChannelsCount : { 1, 2, 3, 4, 6 }) {
+        const samples_t samplesPerChannel = 513;
+
+        std::vector<float> buffer = signal(audioChannelsCount, samplesPerChannel);
+        std::vector<float> reference = buffer;
+
+        BiquadFilter filter = peakFilter();
+        BiquadFilter referenceFilter = peakFilter();
+
+        filter.process(buffer.data(), audioChannelsCount, samplesPerChannel);
+        referenceFilter.processScalar(reference.data(), audioChannelsCount, samplesPerChannel);
+
+        //! NOTE The vector and the scalar code do the same operations in the same order,
+        //! only a compiler that contracts the scalar ones into FMA would round them differently
+        for (size_t i = 0; i < buffer.size(); ++i) {
+            EXPECT_FLOAT_EQ(buffer[i], reference[i]) << "channels: " << int(audioChannelsCount) << ", sample: " << i;
+        }
+    }
+}
+
+TEST_F(Audio_BiquadFilterTests, StateBetweenBlocks)
+{
+    const audioch_t audioChannelsCount = 2;
+    const samples_t samplesPerChannel = 512;
+
+    std::vector<float> buffer = signal(audioChannelsCount, samplesPerChannel);
+    std::vector<float> reference = buffer;
+
+    BiquadFilter filter = peakFilter();
+    const samples_t half = samplesPerChannel / 2;
+    filter.process(buffer.data(), audioChannelsCount, half);
+    filter.process(buffer.data() + half * audioChannelsCount, audioChannelsCount, samplesPerChannel - half);
+
+    BiquadFilter referenceFilter = peakFilter();
+    referenceFilter.process(reference.data(), audioChannelsCount, samplesPerChannel);
+
+    EXPECT_EQ(buffer, reference);
+}
+
+TEST_F(Audio_BiquadFilterTests, Identity)
+{
+    const audioch_t audioChannelsCount = 2;
+    const samples_t samplesPerChannel = 64;
+
+    std::vector<float> buffer = signal(audioChannelsCount, samplesPerChannel);
+    const std::vector<float> reference = buffer;
+
+    BiquadFilter filter;
+    filter.process(buffer.data(), audioChannelsCount, samplesPerChannel);
+
+    EXPECT_EQ(buffer, reference);
+}
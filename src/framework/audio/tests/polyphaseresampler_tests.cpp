@@ -0,0 +1,123 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "internal/dsp/polyphaseresampler.h"
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+class Audio_PolyphaseResamplerTests : public ::testing::Test
+{
+public:
+    static std::vector<float> sine(const audioch_t audioChannelsCount, const samples_t frames, const double frequency,
+                                   const unsigned int sampleRate)
+    {
+        std::vector<float> result(frames * audioChannelsCount);
+        for (samples_t i = 0; i < frames; ++i) {
+            for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+                // the channels have different phases to catch a mix-up of them
+                result[i * audioChannelsCount + audioChNum] = std::sin(2 * M_PI * frequency * i / sampleRate + audioChNum);
+            }
+        }
+        return result;
+    }
+
+    static std::vector<float> resample(PolyphaseResampler& resampler, const std::vector<float>& input, const samples_t blockFrames)
+    {
+        const audioch_t audioChannelsCount = resampler.audioChannelsCount();
+        const samples_t inputFrames = input.size() / audioChannelsCount;
+
+        std::vector<float> result;
+        std::vector<float> block(blockFrames * audioChannelsCount);
+
+        samples_t offset = 0;
+        while (offset < inputFrames) {
+            samples_t used = 0;
+            samples_t written = resampler.process(input.data() + offset * audioChannelsCount, inputFrames - offset,
+                                                  block.data(), blockFrames, used);
+            result.insert(result.end(), block.begin(), block.begin() + written * audioChannelsCount);
+            offset += used;
+        }
+
+        return result;
+    }
+};
+
+TEST_F(Audio_PolyphaseResamplerTests, FramesCount)
+{
+    for (auto rates : { std::make_pair(44100u, 48000u), std::make_pair(48000u, 44100u), std::make_pair(22050u, 44100u) }) {
+        PolyphaseResampler resampler(2, rates.first, rates.second);
+
+        const samples_t inputFrames = rates.first; // one second
+        std::vector<float> output = resample(resampler, std::vector<float>(inputFrames * 2, 0.f), 256);
+
+        EXPECT_EQ(output.size() / 2, resampler.outputFramesFor(inputFrames));
+    }
+}
+
+TEST_F(Audio_PolyphaseResamplerTests, BlockSizeDoesNotMatter)
+{
+    const std::vector<float> input = sine(2, 10000, 440, 44100);
+
+    PolyphaseResampler resampler1(2, 44100, 48000);
+    PolyphaseResampler resampler2(2, 44100, 48000);
+
+    EXPECT_EQ(resample(resampler1, input, 4096), resample(resampler2, input, 7));
+}
+
+TEST_F(Audio_PolyphaseResamplerTests, Sine)
+{
+    const unsigned int rateIn = 44100;
+    const unsigned int rateOut = 48000;
+    const double frequency = 1000;
+
+    PolyphaseResampler resampler(2, rateIn, rateOut);
+    const std::vector<float> output = resample(resampler, sine(2, rateIn / 10, frequency, rateIn), 512);
+
+    //! NOTE The peak of the prototype is at (L * TAPS - 1) / 2 of its samples, L = 160 for these rates
+    const double delaySecs = (PolyphaseResampler::TAPS - 1.0 / 160) / 2 / rateIn;
+    const samples_t outputFrames = output.size() / 2;
+
+    double maxError = 0;
+    for (samples_t i = PolyphaseResampler::TAPS * 2; i < outputFrames; ++i) {
+        for (audioch_t audioChNum = 0; audioChNum < 2; ++audioChNum) {
+            const double expected = std::sin(2 * M_PI * frequency * (double(i) / rateOut - delaySecs) + audioChNum);
+            maxError = std::max(maxError, std::abs(output[i * 2 + audioChNum] - expected));
+        }
+    }
+
+    EXPECT_LT(maxError, 0.01);
+}
+
+TEST_F(Audio_PolyphaseResamplerTests, Constant)
+{
+    PolyphaseResampler resampler(1, 48000, 44100);
+    const std::vector<float> output = resample(resampler, std::vector<float>(4800, 0.5f), 100);
+
+    for (size_t i = PolyphaseResampler::TAPS; i < output.size(); ++i) {
+        EXPECT_NEAR(output[i], 0.5f, 1e-5);
+    }
+}
@@ -68,8 +68,12 @@ bool BufferedPaintProvider::isActive() const
 
 void BufferedPaintProvider::beginObject(const std::string& name, const PointF& pagePos)
 {
+    //! NOTE The new object starts with the current state, like the drawing goes on a real painter
+    DrawData::State state = currentState();
+
     // add new object
     m_currentObjects.push(DrawData::Object(name, pagePos));
+    m_currentObjects.top().datas.back().state = std::move(state);
 
 #ifdef TRACE_DRAW_OBJ_ENABLED
     m_drawObjectsLogger.beginObject(name, pagePos);
@@ -87,7 +91,7 @@ void BufferedPaintProvider::endObject()
     }
 
     // move object to buffer
-    m_buf.objects.push_back(obj);
+    m_buf.objects.push_back(std::move(obj));
 
     // remove obj
     m_currentObjects.pop();
@@ -99,6 +103,12 @@ void BufferedPaintProvider::endObject()
 
 const DrawData::Data& BufferedPaintProvider::currentData() const
 {
+    //! NOTE Painter asks for the transform before the target is begun
+    if (m_currentObjects.empty()) {
+        static const DrawData::Data empty;
+        return empty;
+    }
+
     return m_currentObjects.top().datas.back();
 }
 
@@ -174,10 +184,18 @@ const Brush& BufferedPaintProvider::brush() const
 
 void BufferedPaintProvider::save()
 {
+    m_savedStates.push(currentState());
 }
 
 void BufferedPaintProvider::restore()
 {
+    //! NOTE The recorded data is replayed, so the state has to be restored like a real painter does
+    if (m_savedStates.empty()) {
+        return;
+    }
+
+    editableState() = m_savedStates.top();
+    m_savedStates.pop();
 }
 
 void BufferedPaintProvider::setTransform(const Transform& transform)
@@ -273,9 +291,19 @@ const DrawData& BufferedPaintProvider::drawData() const
     return m_buf;
 }
 
+DrawData BufferedPaintProvider::takeDrawData()
+{
+    DrawData data = std::move(m_buf);
+    clear();
+    return data;
+}
+
 void BufferedPaintProvider::clear()
 {
     m_buf = DrawData();
     std::stack<DrawData::Object> empty;
     m_currentObjects.swap(empty);
+
+    std::stack<DrawData::State> emptyStates;
+    m_savedStates.swap(emptyStates);
 }
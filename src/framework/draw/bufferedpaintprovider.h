@@ -89,6 +89,7 @@ public:
     // ---
 
     const DrawData& drawData() const;
+    DrawData takeDrawData();
     void clear();
 
 private:
@@ -101,6 +102,7 @@ private:
 
     DrawData m_buf;
     std::stack<DrawData::Object> m_currentObjects;
+    std::stack<DrawData::State> m_savedStates;
     bool m_isActive = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
 };
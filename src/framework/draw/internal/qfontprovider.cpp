@@ -21,6 +21,9 @@
  */
 #include "qfontprovider.h"
 
+#include <memory>
+#include <vector>
+
 #include <QPaintDevice>
 #include <QFontDatabase>
 #include <QFontMetricsF>
@@ -53,55 +56,149 @@ protected:
 
 static FontPaintDevice device;
 
+//! NOTE Text layout asks for the metrics per fragment and per character,
+//! and making a QFontMetricsF means converting the font and resolving it every time.
+//! So the metrics are kept per font, together with the results for the characters and the strings.
+//! The cache is per thread, as layout can run on several threads
+namespace {
+struct FontMetrics
+{
+    Font font;
+    QFontMetricsF metrics;
+
+    QHash<uint, double> charAdvances;
+    QHash<uint, RectF> charRects;
+    QHash<uint, bool> inFont;
+    QHash<QString, double> stringAdvances;
+    QHash<QString, RectF> stringRects;
+    QHash<QString, RectF> stringTightRects;
+
+    explicit FontMetrics(const Font& f)
+        : font(f), metrics(f.toQFont(), &device) {}
+};
+
+class FontMetricsCache
+{
+public:
+    FontMetrics& metrics(const Font& f, uint64_t fontsGeneration)
+    {
+        if (m_fontsGeneration != fontsGeneration) {
+            m_fontsGeneration = fontsGeneration;
+            m_fonts.clear();
+        }
+
+        //! NOTE The same font is usually asked for many times in a row
+        if (!m_fonts.empty() && isSameFont(m_fonts.front()->font, f)) {
+            return *m_fonts.front();
+        }
+
+        for (size_t i = 1; i < m_fonts.size(); ++i) {
+            if (isSameFont(m_fonts[i]->font, f)) {
+                std::swap(m_fonts[i], m_fonts.front());
+                return *m_fonts.front();
+            }
+        }
+
+        if (m_fonts.size() >= MAX_FONTS) {
+            m_fonts.pop_back();
+        }
+
+        m_fonts.insert(m_fonts.begin(), std::make_unique<FontMetrics>(f));
+        return *m_fonts.front();
+    }
+
+private:
+    static constexpr size_t MAX_FONTS = 64;
+
+    static bool isSameFont(const Font& f1, const Font& f2)
+    {
+        //! NOTE Font::operator== does not compare the pixel size
+        return f1.pixelSize() == f2.pixelSize() && f1 == f2;
+    }
+
+    std::vector<std::unique_ptr<FontMetrics> > m_fonts;
+    uint64_t m_fontsGeneration = 0;
+};
+
+//! NOTE Not destroyed on purpose, the threads can finish after the font database is gone
+static thread_local FontMetricsCache& s_metricsCache = *new FontMetricsCache();
+
+template<typename Key, typename Value, typename Func>
+static Value cached(QHash<Key, Value>& hash, const Key& key, Func func)
+{
+    //! NOTE Bounds the memory taken by the strings of a long text-heavy score
+    static constexpr int MAX_CACHED_VALUES = 4096;
+
+    auto it = hash.constFind(key);
+    if (it != hash.constEnd()) {
+        return it.value();
+    }
+
+    if (hash.size() >= MAX_CACHED_VALUES) {
+        hash.clear();
+    }
+
+    Value value = func();
+    hash.insert(key, value);
+    return value;
+}
+}
+
 int QFontProvider::addSymbolFont(const String& family, const io::path_t& path)
 {
     m_symbolsFonts[family] = path;
+    ++m_fontsGeneration;
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
 int QFontProvider::addTextFont(const io::path_t& path)
 {
+    ++m_fontsGeneration;
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
 void QFontProvider::insertSubstitution(const String& familyName, const String& substituteName)
 {
+    ++m_fontsGeneration;
     QFont::insertSubstitution(familyName, substituteName);
 }
 
 double QFontProvider::lineSpacing(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).lineSpacing();
+    return s_metricsCache.metrics(f, m_fontsGeneration).metrics.lineSpacing();
 }
 
 double QFontProvider::xHeight(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).xHeight();
+    return s_metricsCache.metrics(f, m_fontsGeneration).metrics.xHeight();
 }
 
 double QFontProvider::height(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).height();
+    return s_metricsCache.metrics(f, m_fontsGeneration).metrics.height();
 }
 
 double QFontProvider::ascent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).ascent();
+    return s_metricsCache.metrics(f, m_fontsGeneration).metrics.ascent();
 }
 
 double QFontProvider::descent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).descent();
+    return s_metricsCache.metrics(f, m_fontsGeneration).metrics.descent();
 }
 
 bool QFontProvider::inFont(const Font& f, Char ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).inFont(ch);
+    FontMetrics& fm = s_metricsCache.metrics(f, m_fontsGeneration);
+    return cached(fm.inFont, uint(ch.unicode()), [&fm, ch]() {
+        return fm.metrics.inFont(ch);
+    });
 }
 
 bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 {
-    if (!QFontMetricsF(f.toQFont(), &device).inFontUcs4(ucs4)) {
+    if (!s_metricsCache.metrics(f, m_fontsGeneration).metrics.inFontUcs4(ucs4)) {
         return false;
     }
 
@@ -113,32 +210,50 @@ bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 
 double QFontProvider::horizontalAdvance(const Font& f, const String& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    FontMetrics& fm = s_metricsCache.metrics(f, m_fontsGeneration);
+    QString str = string;
+    return cached(fm.stringAdvances, str, [&fm, &str]() {
+        return fm.metrics.horizontalAdvance(str);
+    });
 }
 
 double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(ch);
+    FontMetrics& fm = s_metricsCache.metrics(f, m_fontsGeneration);
+    return cached(fm.charAdvances, uint(ch.unicode()), [&fm, ch]() {
+        return fm.metrics.horizontalAdvance(ch);
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    FontMetrics& fm = s_metricsCache.metrics(f, m_fontsGeneration);
+    QString str = string;
+    return cached(fm.stringRects, str, [&fm, &str]() {
+        return RectF::fromQRectF(fm.metrics.boundingRect(str));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const Char& ch) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(ch));
+    FontMetrics& fm = s_metricsCache.metrics(f, m_fontsGeneration);
+    return cached(fm.charRects, uint(ch.unicode()), [&fm, ch]() {
+        return RectF::fromQRectF(fm.metrics.boundingRect(ch));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(r.toQRectF(), flags, string));
+    return RectF::fromQRectF(s_metricsCache.metrics(f, m_fontsGeneration).metrics.boundingRect(r.toQRectF(), flags, string));
 }
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    FontMetrics& fm = s_metricsCache.metrics(f, m_fontsGeneration);
+    QString str = string;
+    return cached(fm.stringTightRects, str, [&fm, &str]() {
+        return RectF::fromQRectF(fm.metrics.tightBoundingRect(str));
+    });
 }
 
 // Score symbols
@@ -22,6 +22,8 @@
 #ifndef MU_DRAW_QFONTPROVIDER_H
 #define MU_DRAW_QFONTPROVIDER_H
 
+#include <atomic>
+
 #include <QHash>
 #include "ifontprovider.h"
 
@@ -64,6 +66,9 @@ private:
 
     QHash<QString /*family*/, io::path_t> m_symbolsFonts;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+
+    //! NOTE Changed when the available fonts change, the cached metrics are dropped then
+    std::atomic<uint64_t> m_fontsGeneration = 0;
 };
 }
 
@@ -36,12 +36,15 @@ QImagePainterProvider::QImagePainterProvider(std::shared_ptr<Pixmap> px)
 
 QImagePainterProvider::~QImagePainterProvider()
 {
+    flushSymbols();
     delete m_painter;
+    m_painter = nullptr;
 }
 
 bool QImagePainterProvider::endTarget(bool endDraw)
 {
     UNUSED(endDraw)
+    flushSymbols();
     * m_px = Pixmap::fromQPixmap(QPixmap::fromImage(m_image));
     return true;
 }
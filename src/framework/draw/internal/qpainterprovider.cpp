@@ -22,6 +22,7 @@
 #include "qpainterprovider.h"
 
 #include <QPainter>
+#include <QPaintEngine>
 #include <QRawFont>
 #include <QTextLayout>
 #include <QTextLine>
@@ -51,6 +52,10 @@ QPainterProvider::QPainterProvider(QPainter* painter, bool ownsPainter)
 
 QPainterProvider::~QPainterProvider()
 {
+    if (m_painter && m_painter->isActive()) {
+        flushSymbols();
+    }
+
     if (m_ownsPainter) {
         delete m_painter;
     }
@@ -79,10 +84,13 @@ void QPainterProvider::beginTarget(const std::string&)
 
 void QPainterProvider::beforeEndTargetHook(Painter*)
 {
+    flushSymbols();
 }
 
 bool QPainterProvider::endTarget(bool endDraw)
 {
+    flushSymbols();
+
     if (endDraw) {
         return m_painter->end();
     }
@@ -106,6 +114,7 @@ void QPainterProvider::endObject()
 
 void QPainterProvider::setAntialiasing(bool arg)
 {
+    flushSymbols();
     m_painter->setRenderHint(QPainter::Antialiasing, arg);
     m_painter->setRenderHint(QPainter::TextAntialiasing, arg);
 }
@@ -119,6 +128,7 @@ void QPainterProvider::setCompositionMode(CompositionMode mode)
         }
         return QPainter::CompositionMode_SourceOver;
     };
+    flushSymbols();
     m_painter->setCompositionMode(toQPainter(mode));
 }
 
@@ -192,6 +202,7 @@ const Transform& QPainterProvider::transform() const
 
 void QPainterProvider::drawPath(const PainterPath& path)
 {
+    flushSymbols();
     m_painter->drawPath(PainterPath::toQPainterPath(path));
 }
 
@@ -201,6 +212,8 @@ void QPainterProvider::drawPolygon(const PointF* points, size_t pointCount, Poly
 
     const QPointF* qpoints = reinterpret_cast<const QPointF*>(points);
 
+    flushSymbols();
+
     switch (mode) {
     case PolygonMode::OddEven: {
         m_painter->drawPolygon(qpoints, int(pointCount), Qt::OddEvenFill);
@@ -219,16 +232,19 @@ void QPainterProvider::drawPolygon(const PointF* points, size_t pointCount, Poly
 
 void QPainterProvider::drawText(const PointF& point, const String& text)
 {
+    flushSymbols();
     m_painter->drawText(point.toQPointF(), text);
 }
 
 void QPainterProvider::drawText(const RectF& rect, int flags, const String& text)
 {
+    flushSymbols();
     m_painter->drawText(rect.toQRectF(), flags, text);
 }
 
 void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
 {
+    flushSymbols();
     m_painter->save();
     double mm = m_painter->worldTransform().m11();
     double dx = m_painter->worldTransform().dx();
@@ -289,6 +305,63 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
 }
 
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
+{
+    if (!canDrawGlyphRuns()) {
+        drawSymbolText(point, ucs4Code);
+        return;
+    }
+
+    FontGlyphs& glyphs = currentFontGlyphs();
+    auto it = glyphs.glyphIndexes.find(ucs4Code);
+    if (it == glyphs.glyphIndexes.end()) {
+        quint32 glyphIndex = 0;
+        int glyphCount = 1;
+        QString str = QString::fromUcs4(&ucs4Code, 1);
+        if (!glyphs.rawFont.glyphIndexesForChars(str.constData(), str.size(), &glyphIndex, &glyphCount) || glyphCount != 1) {
+            glyphIndex = 0;
+        }
+        it = glyphs.glyphIndexes.insert(ucs4Code, glyphIndex);
+    }
+
+    //! NOTE The glyph is missing in the font, only the text drawing can fall back to another font
+    if (it.value() == 0) {
+        flushSymbols();
+        drawSymbolText(point, ucs4Code);
+        return;
+    }
+
+    const QTransform transform = m_painter->worldTransform();
+    size_t fontGlyphs = m_currentFontGlyphs;
+
+    //! NOTE Only the translation may differ inside a run, it is moved into the glyph positions
+    bool isSameRun = !m_symbolRun.glyphIndexes.isEmpty()
+                     && m_symbolRun.fontGlyphs == fontGlyphs
+                     && m_symbolRun.pen == m_painter->pen()
+                     && m_symbolRun.transform.m11() == transform.m11()
+                     && m_symbolRun.transform.m12() == transform.m12()
+                     && m_symbolRun.transform.m21() == transform.m21()
+                     && m_symbolRun.transform.m22() == transform.m22()
+                     && transform.isAffine();
+
+    if (!isSameRun) {
+        flushSymbols();
+
+        if (!transform.isAffine() || !transform.isInvertible()) {
+            drawSymbolText(point, ucs4Code);
+            return;
+        }
+
+        m_symbolRun.fontGlyphs = fontGlyphs;
+        m_symbolRun.pen = m_painter->pen();
+        m_symbolRun.transform = transform;
+        m_symbolRun.invertedTransform = transform.inverted();
+    }
+
+    m_symbolRun.glyphIndexes.push_back(it.value());
+    m_symbolRun.positions.push_back(m_symbolRun.invertedTransform.map(transform.map(QPointF(point.x(), point.y()))));
+}
+
+void QPainterProvider::drawSymbolText(const PointF& point, char32_t ucs4Code)
 {
     static QHash<char32_t, QString> cache;
     if (!cache.contains(ucs4Code)) {
@@ -298,8 +371,64 @@ void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
     m_painter->drawText(QPointF(point.x(), point.y()), cache[ucs4Code]);
 }
 
+bool QPainterProvider::canDrawGlyphRuns() const
+{
+    //! NOTE The vector engines (svg, pdf, printer) need the characters to write the text,
+    //! a glyph run only gives them glyph indexes
+    const QPaintEngine* engine = m_painter->paintEngine();
+    if (!engine) {
+        return false;
+    }
+
+    return engine->type() == QPaintEngine::Raster || engine->type() == QPaintEngine::OpenGL2;
+}
+
+QPainterProvider::FontGlyphs& QPainterProvider::currentFontGlyphs()
+{
+    if (m_currentFontGlyphs < m_fontGlyphs.size() && m_fontGlyphs[m_currentFontGlyphs].font == m_font) {
+        return m_fontGlyphs[m_currentFontGlyphs];
+    }
+
+    for (size_t i = 0; i < m_fontGlyphs.size(); ++i) {
+        if (m_fontGlyphs[i].font == m_font) {
+            m_currentFontGlyphs = i;
+            return m_fontGlyphs[i];
+        }
+    }
+
+    FontGlyphs glyphs;
+    glyphs.font = m_font;
+    glyphs.rawFont = QRawFont::fromFont(m_painter->font());
+    m_fontGlyphs.push_back(std::move(glyphs));
+    m_currentFontGlyphs = m_fontGlyphs.size() - 1;
+
+    return m_fontGlyphs.back();
+}
+
+void QPainterProvider::flushSymbols()
+{
+    if (m_symbolRun.glyphIndexes.isEmpty()) {
+        return;
+    }
+
+    QGlyphRun run;
+    run.setRawFont(m_fontGlyphs[m_symbolRun.fontGlyphs].rawFont);
+    run.setGlyphIndexes(m_symbolRun.glyphIndexes);
+    run.setPositions(m_symbolRun.positions);
+
+    m_painter->save();
+    m_painter->setWorldTransform(m_symbolRun.transform);
+    m_painter->setPen(m_symbolRun.pen);
+    m_painter->drawGlyphRun(QPointF(), run);
+    m_painter->restore();
+
+    m_symbolRun.glyphIndexes.clear();
+    m_symbolRun.positions.clear();
+}
+
 void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 {
+    flushSymbols();
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
@@ -312,6 +441,7 @@ void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 
 void QPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
+    flushSymbols();
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
@@ -324,20 +454,24 @@ void QPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, cons
 
 void QPainterProvider::drawPixmap(const PointF& point, const QPixmap& pm)
 {
+    flushSymbols();
     m_painter->drawPixmap(QPointF(point.x(), point.y()), pm);
 }
 
 void QPainterProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
 {
+    flushSymbols();
     m_painter->drawTiledPixmap(rect.toQRectF(), pm, QPointF(offset.x(), offset.y()));
 }
 
 void QPainterProvider::setClipRect(const RectF& rect)
 {
+    flushSymbols();
     m_painter->setClipRect(rect.toQRectF());
 }
 
 void QPainterProvider::setClipping(bool enable)
 {
+    flushSymbols();
     m_painter->setClipping(enable);
 }
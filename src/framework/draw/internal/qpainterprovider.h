@@ -22,6 +22,14 @@
 #ifndef MU_DRAW_QPAINTERPROVIDER_H
 #define MU_DRAW_QPAINTERPROVIDER_H
 
+#include <vector>
+
+#include <QHash>
+#include <QPen>
+#include <QRawFont>
+#include <QTransform>
+#include <QVector>
+
 #include "../ipaintprovider.h"
 
 class QPainter;
@@ -87,9 +95,32 @@ public:
     void setClipping(bool enable) override;
 
 protected:
+    void flushSymbols();
+
     QPainter* m_painter = nullptr;
 
 private:
+    struct FontGlyphs {
+        Font font;
+        QRawFont rawFont;
+        QHash<char32_t, quint32> glyphIndexes;
+    };
+
+    //! NOTE Consecutive symbols of the same font and pen, drawn with the same scaling and rotation,
+    //! are collected here and drawn as one glyph run
+    struct SymbolRun {
+        size_t fontGlyphs = 0;
+        QPen pen;
+        QTransform transform;
+        QTransform invertedTransform;
+        QVector<quint32> glyphIndexes;
+        QVector<QPointF> positions;
+    };
+
+    bool canDrawGlyphRuns() const;
+    FontGlyphs& currentFontGlyphs();
+    void drawSymbolText(const PointF& point, char32_t ucs4Code);
+
     bool m_ownsPainter = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
     Font m_font;
@@ -97,6 +128,10 @@ private:
     Brush m_brush;
 
     Transform m_transform;
+
+    std::vector<FontGlyphs> m_fontGlyphs;
+    size_t m_currentFontGlyphs = 0;
+    SymbolRun m_symbolRun;
 };
 }
 
@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "multipaintprovider.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+MultiPaintProvider::MultiPaintProvider(const std::vector<IPaintProviderPtr>& providers)
+    : m_providers(providers)
+{
+    IF_ASSERT_FAILED(!m_providers.empty()) {
+        return;
+    }
+}
+
+bool MultiPaintProvider::isActive() const
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        if (!provider->isActive()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void MultiPaintProvider::beginTarget(const std::string& name)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->beginTarget(name);
+    }
+}
+
+void MultiPaintProvider::beforeEndTargetHook(Painter* painter)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->beforeEndTargetHook(painter);
+    }
+}
+
+bool MultiPaintProvider::endTarget(bool endDraw)
+{
+    bool ok = true;
+    for (const IPaintProviderPtr& provider : m_providers) {
+        ok = provider->endTarget(endDraw) && ok;
+    }
+    return ok;
+}
+
+void MultiPaintProvider::beginObject(const std::string& name, const PointF& pagePos)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->beginObject(name, pagePos);
+    }
+}
+
+void MultiPaintProvider::endObject()
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->endObject();
+    }
+}
+
+void MultiPaintProvider::setAntialiasing(bool arg)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setAntialiasing(arg);
+    }
+}
+
+void MultiPaintProvider::setCompositionMode(CompositionMode mode)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setCompositionMode(mode);
+    }
+}
+
+void MultiPaintProvider::setFont(const Font& font)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setFont(font);
+    }
+}
+
+const Font& MultiPaintProvider::font() const
+{
+    return m_providers.front()->font();
+}
+
+void MultiPaintProvider::setPen(const Pen& pen)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setPen(pen);
+    }
+}
+
+void MultiPaintProvider::setNoPen()
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setNoPen();
+    }
+}
+
+const Pen& MultiPaintProvider::pen() const
+{
+    return m_providers.front()->pen();
+}
+
+void MultiPaintProvider::setBrush(const Brush& brush)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setBrush(brush);
+    }
+}
+
+const Brush& MultiPaintProvider::brush() const
+{
+    return m_providers.front()->brush();
+}
+
+void MultiPaintProvider::save()
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->save();
+    }
+}
+
+void MultiPaintProvider::restore()
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->restore();
+    }
+}
+
+void MultiPaintProvider::setTransform(const Transform& transform)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setTransform(transform);
+    }
+}
+
+const Transform& MultiPaintProvider::transform() const
+{
+    return m_providers.front()->transform();
+}
+
+void MultiPaintProvider::drawPath(const PainterPath& path)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawPath(path);
+    }
+}
+
+void MultiPaintProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawPolygon(points, pointCount, mode);
+    }
+}
+
+void MultiPaintProvider::drawText(const PointF& point, const String& text)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawText(point, text);
+    }
+}
+
+void MultiPaintProvider::drawText(const RectF& rect, int flags, const String& text)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawText(rect, flags, text);
+    }
+}
+
+void MultiPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawTextWorkaround(f, pos, text);
+    }
+}
+
+void MultiPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawSymbol(point, ucs4Code);
+    }
+}
+
+void MultiPaintProvider::drawPixmap(const PointF& point, const Pixmap& pm)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawPixmap(point, pm);
+    }
+}
+
+void MultiPaintProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawTiledPixmap(rect, pm, offset);
+    }
+}
+
+#ifndef NO_QT_SUPPORT
+void MultiPaintProvider::drawPixmap(const PointF& point, const QPixmap& pm)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawPixmap(point, pm);
+    }
+}
+
+void MultiPaintProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->drawTiledPixmap(rect, pm, offset);
+    }
+}
+#endif
+
+void MultiPaintProvider::setClipRect(const RectF& rect)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setClipRect(rect);
+    }
+}
+
+void MultiPaintProvider::setClipping(bool enable)
+{
+    for (const IPaintProviderPtr& provider : m_providers) {
+        provider->setClipping(enable);
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "draw/utils/drawbinary.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_DrawBinaryTests : public ::testing::Test
+{
+public:
+};
+
+static DrawData makeDrawData()
+{
+    DrawData data;
+    data.name = "page";
+
+    for (int i = 0; i < 3; ++i) {
+        DrawData::Object obj("note_" + std::to_string(i), PointF(10.5 * i, 2.25));
+        DrawData::Data& d = obj.datas.front();
+
+        d.state.font.setFamily(u"Leland", Font::Type::MusicSymbol);
+        d.state.font.setPointSizeF(20.0);
+
+        DrawPath path;
+        path.path.moveTo(1.0, 2.0);
+        path.path.lineTo(3.5, -4.0);
+        path.path.cubicTo(1.0, 1.0, 2.0, 2.0, 3.0, 3.0);
+        path.pen = Pen(Color(10, 20, 30, 40), 1.25);
+        d.paths.push_back(path);
+
+        DrawPolygon polygon;
+        polygon.polygon.push_back(PointF(0.0, 0.0));
+        polygon.polygon.push_back(PointF(-1.0, 7.125));
+        polygon.mode = PolygonMode::Polyline;
+        d.polygons.push_back(polygon);
+
+        d.texts.push_back({ PointF(5.0, 6.0), u"" });
+
+        data.objects.push_back(obj);
+    }
+
+    return data;
+}
+
+TEST_F(Draw_DrawBinaryTests, WriteRead)
+{
+    //! GIVEN Draw data
+    DrawDataPtr data = std::make_shared<DrawData>(makeDrawData());
+
+    //! DO Write and read it
+    ByteArray bin = DrawBufferBinary::toBinary(*data);
+    RetVal<DrawDataPtr> read = DrawBufferBinary::fromBinary(bin);
+
+    //! CHECK
+    ASSERT_TRUE(read.ret);
+    EXPECT_EQ(read.val->name, data->name);
+    ASSERT_EQ(read.val->objects.size(), data->objects.size());
+    EXPECT_EQ(read.val->objects.at(1).datas.front().state.font, data->objects.at(1).datas.front().state.font);
+    EXPECT_EQ(read.val->objects.at(1).datas.front().paths.front().path.elementCount(), 5u);
+    EXPECT_TRUE(DrawComp::compare(data, read.val).empty());
+}
+
+TEST_F(Draw_DrawBinaryTests, ReadTruncated)
+{
+    //! GIVEN Truncated binary draw data
+    ByteArray bin = DrawBufferBinary::toBinary(makeDrawData());
+    bin.truncate(bin.size() - 3);
+
+    //! CHECK Reading fails
+    EXPECT_FALSE(DrawBufferBinary::fromBinary(bin).ret);
+}
+
+TEST_F(Draw_DrawBinaryTests, Compare)
+{
+    //! GIVEN Draw data and the one with a moved object
+    DrawData origin = makeDrawData();
+    DrawData data = origin;
+    data.objects.at(1).pagePos = PointF(100.0, 100.0);
+
+    //! DO Compare the same and the changed one
+    RetVal<Diff> same = DrawBufferBinary::compare(DrawBufferBinary::toBinary(origin), DrawBufferBinary::toBinary(origin));
+    RetVal<Diff> changed = DrawBufferBinary::compare(DrawBufferBinary::toBinary(data), DrawBufferBinary::toBinary(origin));
+
+    //! CHECK
+    ASSERT_TRUE(same.ret);
+    EXPECT_TRUE(same.val.empty());
+
+    ASSERT_TRUE(changed.ret);
+    ASSERT_EQ(changed.val.dataRemoved->objects.size(), 1u);
+    ASSERT_EQ(changed.val.dataAdded->objects.size(), 1u);
+    EXPECT_EQ(changed.val.dataRemoved->objects.front().name, "note_1");
+}
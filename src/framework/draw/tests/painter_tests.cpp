@@ -27,6 +27,8 @@
 #include "draw/painter.h"
 
 #include "draw/internal/qpainterprovider.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
 
 using namespace mu;
 using namespace mu::draw;
@@ -156,3 +158,50 @@ TEST_F(Draw_PainterTests, Painter_SaveRestore)
 
     EXPECT_EQ(painter.provider()->transform(), worldTransform * expectedViewTransform);
 }
+
+TEST_F(Draw_PainterTests, BufferedPaintProvider_Replay)
+{
+    //! GIVEN Painter that records to a buffer
+    std::shared_ptr<BufferedPaintProvider> buffer = std::make_shared<BufferedPaintProvider>();
+
+    {
+        Painter painter(buffer, "test");
+        painter.setNoPen();
+        painter.setBrush(Brush(Color::redColor));
+
+        //! DO Paint with a changed state between save and restore
+        painter.save();
+        painter.setBrush(Brush(Color::blueColor));
+        painter.translate(10.0, 0.0);
+        painter.drawRect(RectF(0.0, 0.0, 4.0, 4.0));
+        painter.restore();
+
+        painter.drawRect(RectF(0.0, 0.0, 4.0, 4.0));
+    }
+
+    DrawData data = buffer->takeDrawData();
+    EXPECT_TRUE(buffer->drawData().objects.empty());
+    ASSERT_EQ(data.objects.size(), 1u);
+
+    //! GIVEN Image to replay on
+    QImage pd(20, 10, QImage::Format_ARGB32_Premultiplied);
+    pd.fill(Qt::white);
+    QPainter qp(&pd);
+    Painter painter(&qp, "test");
+
+    //! DO Replay shifted down
+    Transform transform;
+    transform.translate(0.0, 5.0);
+
+    painter.provider()->save();
+    DrawDataPaint::paintObject(painter.provider().get(), data.objects.front(), transform);
+    painter.provider()->restore();
+    painter.endDraw();
+    qp.end();
+
+    //! CHECK The state after restore is the saved one, and both rects are shifted
+    EXPECT_EQ(QColor(pd.pixel(2, 7)), QColor(Qt::red));
+    EXPECT_EQ(QColor(pd.pixel(12, 7)), QColor(Qt::blue));
+    EXPECT_EQ(QColor(pd.pixel(2, 2)), QColor(Qt::white));
+    EXPECT_EQ(QColor(pd.pixel(12, 2)), QColor(Qt::white));
+}
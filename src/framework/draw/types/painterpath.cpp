@@ -285,7 +285,7 @@ void PainterPath::arcTo(const RectF& rect, double startAngle, double sweepLength
 }
 
 #ifndef NO_QT_SUPPORT
-QPainterPath PainterPath::toQPainterPath(const PainterPath& path)
+static QPainterPath buildQPainterPath(const PainterPath& path)
 {
     QPainterPath qpath;
     std::vector<QPainterPath::Element> curveEls;
@@ -339,6 +339,17 @@ QPainterPath PainterPath::toQPainterPath(const PainterPath& path)
     return qpath;
 }
 
+//! NOTE The conversion is done once per geometry: the slurs, ties and other paths
+//! are built by the layout and then drawn many times
+QPainterPath PainterPath::toQPainterPath(const PainterPath& path)
+{
+    if (!path.m_qpath) {
+        path.m_qpath = std::make_shared<const QPainterPath>(buildQPainterPath(path));
+    }
+
+    return *path.m_qpath;
+}
+
 #endif
 
 void PainterPath::closeSubpath()
@@ -744,5 +755,8 @@ void PainterPath::setDirty()
 {
     m_dirtyBounds = true;
     m_convex = false;
+#ifndef NO_QT_SUPPORT
+    m_qpath = nullptr;
+#endif
 }
 }
@@ -24,6 +24,7 @@
 #define MU_DRAW_PAINTERPATH_H
 
 #include <cmath>
+#include <memory>
 
 #include "geometry.h"
 #include "bezier.h"
@@ -178,6 +179,11 @@ private:
 
     std::vector<Element> m_elements;
 
+#ifndef NO_QT_SUPPORT
+    //! NOTE Shared by the copies until one of them is changed
+    mutable std::shared_ptr<const QPainterPath> m_qpath;
+#endif
+
     friend class Transform;
 };
 }
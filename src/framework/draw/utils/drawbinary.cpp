@@ -0,0 +1,685 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "drawbinary.h"
+
+#include <map>
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+namespace mu::draw::binary {
+static const uint8_t MAGIC[] = { 'M', 'U', 'D', 'D' };
+static const uint64_t VERSION = 1;
+
+//! NOTE The same precision as in DrawBufferJson
+static int64_t rtoi(double v)
+{
+    return static_cast<int64_t>(v * 1000.0);
+}
+
+static double itor(int64_t v)
+{
+    return static_cast<double>(v) / 1000.0;
+}
+
+static std::string fontKey(const Font& font)
+{
+    return font.family().toStdString()
+           + '\x1f' + std::to_string(static_cast<int>(font.type()))
+           + '\x1f' + std::to_string(rtoi(font.pointSizeF()))
+           + '\x1f' + std::to_string(static_cast<int>(font.weight()))
+           + '\x1f' + (font.italic() ? '1' : '0');
+}
+
+class Writer
+{
+public:
+    explicit Writer(ByteArray& out)
+        : m_out(out) {}
+
+    void writeUInt(uint64_t v)
+    {
+        while (v >= 0x80) {
+            m_out.push_back(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        m_out.push_back(static_cast<uint8_t>(v));
+    }
+
+    //! NOTE Zigzag, so the small negative values are short too
+    void writeInt(int64_t v)
+    {
+        writeUInt((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+    }
+
+    void writeReal(double v)
+    {
+        writeInt(rtoi(v));
+    }
+
+    void writeBool(bool v)
+    {
+        m_out.push_back(v ? 1 : 0);
+    }
+
+    //! NOTE 0 and the string itself for the first occurrence, then the index + 1
+    void writeString(const std::string& str)
+    {
+        auto it = m_strings.find(str);
+        if (it != m_strings.end()) {
+            writeUInt(it->second + 1);
+            return;
+        }
+
+        writeUInt(0);
+        writeUInt(str.size());
+        m_out.push_back(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+
+        m_strings.emplace(str, m_strings.size());
+    }
+
+    void writeString(const String& str)
+    {
+        writeString(str.toStdString());
+    }
+
+    void writeColor(const Color& c)
+    {
+        writeUInt((static_cast<uint64_t>(c.red()) << 24) | (static_cast<uint64_t>(c.green()) << 16)
+                  | (static_cast<uint64_t>(c.blue()) << 8) | static_cast<uint64_t>(c.alpha()));
+    }
+
+    void writePoint(const PointF& p)
+    {
+        writeReal(p.x());
+        writeReal(p.y());
+    }
+
+    void writeDeltaPoint(const PointF& p, int64_t& lastX, int64_t& lastY)
+    {
+        const int64_t x = rtoi(p.x());
+        const int64_t y = rtoi(p.y());
+        writeInt(x - lastX);
+        writeInt(y - lastY);
+        lastX = x;
+        lastY = y;
+    }
+
+    void writeRect(const RectF& r)
+    {
+        writeReal(r.x());
+        writeReal(r.y());
+        writeReal(r.width());
+        writeReal(r.height());
+    }
+
+    void writeSize(const Size& sz)
+    {
+        writeInt(sz.width());
+        writeInt(sz.height());
+    }
+
+    void write(const Pen& pen)
+    {
+        writeUInt(static_cast<uint64_t>(pen.style()));
+        writeColor(pen.color());
+        writeReal(pen.widthF());
+    }
+
+    void write(const Brush& brush)
+    {
+        writeUInt(static_cast<uint64_t>(brush.style()));
+        writeColor(brush.color());
+    }
+
+    void write(const Font& font)
+    {
+        const std::string key = fontKey(font);
+        auto it = m_fonts.find(key);
+        if (it != m_fonts.end()) {
+            writeUInt(it->second + 1);
+            return;
+        }
+
+        writeUInt(0);
+        writeString(font.family());
+        writeUInt(static_cast<uint64_t>(font.type()));
+        writeReal(font.pointSizeF());
+        writeUInt(static_cast<uint64_t>(font.weight()));
+        writeBool(font.italic());
+
+        m_fonts.emplace(key, m_fonts.size());
+    }
+
+    void write(const Transform& t)
+    {
+        for (double v : { t.m11(), t.m12(), t.m13(), t.m21(), t.m22(), t.m23(), t.m31(), t.m32(), t.m33() }) {
+            writeReal(v);
+        }
+    }
+
+    void write(const DrawData::State& st)
+    {
+        write(st.pen);
+        write(st.brush);
+        write(st.font);
+        writeBool(st.isAntialiasing);
+        write(st.transform);
+        writeUInt(static_cast<uint64_t>(st.compositionMode));
+    }
+
+    void write(const DrawPath& path)
+    {
+        writeUInt(static_cast<uint64_t>(path.path.fillRule()));
+        writeUInt(path.path.elementCount());
+
+        int64_t lastX = 0;
+        int64_t lastY = 0;
+        for (size_t i = 0; i < path.path.elementCount(); ++i) {
+            PainterPath::Element e = path.path.elementAt(i);
+            writeUInt(static_cast<uint64_t>(e.type));
+            writeDeltaPoint(PointF(e.x, e.y), lastX, lastY);
+        }
+
+        write(path.pen);
+        write(path.brush);
+        writeUInt(static_cast<uint64_t>(path.mode));
+    }
+
+    void write(const DrawPolygon& pol)
+    {
+        writeUInt(static_cast<uint64_t>(pol.mode));
+        writeUInt(pol.polygon.size());
+
+        int64_t lastX = 0;
+        int64_t lastY = 0;
+        for (const PointF& p : pol.polygon) {
+            writeDeltaPoint(p, lastX, lastY);
+        }
+    }
+
+    void write(const DrawText& text)
+    {
+        writePoint(text.pos);
+        writeString(text.text);
+    }
+
+    void write(const DrawRectText& text)
+    {
+        writeRect(text.rect);
+        writeInt(text.flags);
+        writeString(text.text);
+    }
+
+    void write(const DrawPixmap& pm)
+    {
+        writePoint(pm.pos);
+        writeSize(pm.pm.size());
+    }
+
+    void write(const DrawTiledPixmap& pm)
+    {
+        writeRect(pm.rect);
+        writeSize(pm.pm.size());
+        writePoint(pm.offset);
+    }
+
+    template<class T>
+    void write(const std::vector<T>& vals)
+    {
+        writeUInt(vals.size());
+        for (const T& val : vals) {
+            write(val);
+        }
+    }
+
+    void write(const DrawData::Object& obj)
+    {
+        writeString(obj.name);
+        writePoint(obj.pagePos);
+
+        //! NOTE Like in DrawBufferJson, the empty datas are skipped
+        size_t count = 0;
+        for (const DrawData::Data& data : obj.datas) {
+            count += data.empty() ? 0 : 1;
+        }
+
+        writeUInt(count);
+        for (const DrawData::Data& data : obj.datas) {
+            if (data.empty()) {
+                continue;
+            }
+
+            write(data.state);
+            write(data.paths);
+            write(data.polygons);
+            write(data.texts);
+            write(data.rectTexts);
+            write(data.pixmaps);
+            write(data.tiledPixmap);
+        }
+    }
+
+private:
+    ByteArray& m_out;
+    std::map<std::string, size_t> m_strings;
+    std::map<std::string, size_t> m_fonts;
+};
+
+class Reader
+{
+public:
+    explicit Reader(const ByteArray& data)
+        : m_data(data) {}
+
+    bool isError() const
+    {
+        return m_error;
+    }
+
+    bool readHeader(std::string& name, size_t& objectCount)
+    {
+        for (uint8_t b : MAGIC) {
+            if (readByte() != b) {
+                return setError();
+            }
+        }
+
+        if (readUInt() != VERSION) {
+            return setError();
+        }
+
+        name = readStdString();
+        objectCount = static_cast<size_t>(readUInt());
+
+        return !m_error;
+    }
+
+    bool readObject(DrawData::Object& obj)
+    {
+        obj.name = readStdString();
+        obj.pagePos = readPoint();
+
+        const uint64_t count = readUInt();
+        for (uint64_t i = 0; i < count && !m_error; ++i) {
+            DrawData::Data data;
+            read(data.state);
+            read(data.paths);
+            read(data.polygons);
+            read(data.texts);
+            read(data.rectTexts);
+            read(data.pixmaps);
+            read(data.tiledPixmap);
+            obj.datas.push_back(std::move(data));
+        }
+
+        return !m_error;
+    }
+
+private:
+    bool setError()
+    {
+        m_error = true;
+        return false;
+    }
+
+    uint8_t readByte()
+    {
+        if (m_pos >= m_data.size()) {
+            setError();
+            return 0;
+        }
+
+        return m_data.at(m_pos++);
+    }
+
+    uint64_t readUInt()
+    {
+        uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const uint8_t b = readByte();
+            v |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                return v;
+            }
+        }
+
+        setError();
+        return 0;
+    }
+
+    int64_t readInt()
+    {
+        const uint64_t v = readUInt();
+        return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+    }
+
+    double readReal()
+    {
+        return itor(readInt());
+    }
+
+    bool readBool()
+    {
+        return readByte() != 0;
+    }
+
+    std::string readStdString()
+    {
+        const uint64_t index = readUInt();
+        if (index > 0) {
+            if (index > m_strings.size()) {
+                setError();
+                return std::string();
+            }
+            return m_strings.at(index - 1);
+        }
+
+        const uint64_t size = readUInt();
+        if (m_error || size > m_data.size() - m_pos) {
+            setError();
+            return std::string();
+        }
+
+        std::string str(reinterpret_cast<const char*>(m_data.constData() + m_pos), size);
+        m_pos += size;
+
+        m_strings.push_back(str);
+        return str;
+    }
+
+    String readString()
+    {
+        return String::fromStdString(readStdString());
+    }
+
+    Color readColor()
+    {
+        const uint64_t v = readUInt();
+        return Color(static_cast<int>((v >> 24) & 0xff), static_cast<int>((v >> 16) & 0xff),
+                     static_cast<int>((v >> 8) & 0xff), static_cast<int>(v & 0xff));
+    }
+
+    PointF readPoint()
+    {
+        const double x = readReal();
+        const double y = readReal();
+        return PointF(x, y);
+    }
+
+    PointF readDeltaPoint(int64_t& lastX, int64_t& lastY)
+    {
+        lastX += readInt();
+        lastY += readInt();
+        return PointF(itor(lastX), itor(lastY));
+    }
+
+    RectF readRect()
+    {
+        const double x = readReal();
+        const double y = readReal();
+        const double w = readReal();
+        const double h = readReal();
+        return RectF(x, y, w, h);
+    }
+
+    Size readSize()
+    {
+        const int w = static_cast<int>(readInt());
+        const int h = static_cast<int>(readInt());
+        return Size(w, h);
+    }
+
+    void read(Pen& pen)
+    {
+        pen.setStyle(static_cast<PenStyle>(readUInt()));
+        pen.setColor(readColor());
+        pen.setWidthF(readReal());
+    }
+
+    void read(Brush& brush)
+    {
+        brush.setStyle(static_cast<BrushStyle>(readUInt()));
+        brush.setColor(readColor());
+    }
+
+    void read(Font& font)
+    {
+        const uint64_t index = readUInt();
+        if (index > 0) {
+            if (index > m_fonts.size()) {
+                setError();
+                return;
+            }
+            font = m_fonts.at(index - 1);
+            return;
+        }
+
+        const String family = readString();
+        font.setFamily(family, static_cast<Font::Type>(readUInt()));
+        font.setPointSizeF(readReal());
+        font.setWeight(static_cast<Font::Weight>(readUInt()));
+        font.setItalic(readBool());
+
+        m_fonts.push_back(font);
+    }
+
+    void read(Transform& t)
+    {
+        double m[9];
+        for (double& v : m) {
+            v = readReal();
+        }
+        t.setMatrix(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]);
+    }
+
+    void read(DrawData::State& st)
+    {
+        read(st.pen);
+        read(st.brush);
+        read(st.font);
+        st.isAntialiasing = readBool();
+        read(st.transform);
+        st.compositionMode = static_cast<CompositionMode>(readUInt());
+    }
+
+    void read(DrawPath& path)
+    {
+        path.path.setFillRule(static_cast<PainterPath::FillRule>(readUInt()));
+
+        //! NOTE The curves are written as the CurveToElement and two CurveToDataElement, like in DrawBufferJson
+        std::vector<PointF> curvePoints;
+        int64_t lastX = 0;
+        int64_t lastY = 0;
+        const uint64_t count = readUInt();
+        for (uint64_t i = 0; i < count && !m_error; ++i) {
+            const PainterPath::ElementType type = static_cast<PainterPath::ElementType>(readUInt());
+            const PointF p = readDeltaPoint(lastX, lastY);
+
+            switch (type) {
+            case PainterPath::ElementType::MoveToElement: {
+                path.path.moveTo(p);
+            } break;
+            case PainterPath::ElementType::LineToElement: {
+                path.path.lineTo(p);
+            } break;
+            case PainterPath::ElementType::CurveToElement: {
+                curvePoints.clear();
+                curvePoints.push_back(p);
+            } break;
+            case PainterPath::ElementType::CurveToDataElement: {
+                if (curvePoints.size() < 2) {
+                    curvePoints.push_back(p);
+                    continue;
+                }
+
+                path.path.cubicTo(curvePoints.at(0), curvePoints.at(1), p);
+                curvePoints.clear();
+            } break;
+            }
+        }
+
+        read(path.pen);
+        read(path.brush);
+        path.mode = static_cast<DrawMode>(readUInt());
+    }
+
+    void read(DrawPolygon& pol)
+    {
+        pol.mode = static_cast<PolygonMode>(readUInt());
+
+        int64_t lastX = 0;
+        int64_t lastY = 0;
+        const uint64_t count = readUInt();
+        for (uint64_t i = 0; i < count && !m_error; ++i) {
+            pol.polygon.push_back(readDeltaPoint(lastX, lastY));
+        }
+    }
+
+    void read(DrawText& text)
+    {
+        text.pos = readPoint();
+        text.text = readString();
+    }
+
+    void read(DrawRectText& text)
+    {
+        text.rect = readRect();
+        text.flags = static_cast<int>(readInt());
+        text.text = readString();
+    }
+
+    void read(DrawPixmap& pm)
+    {
+        pm.pos = readPoint();
+        pm.pm = Pixmap(readSize());
+    }
+
+    void read(DrawTiledPixmap& pm)
+    {
+        pm.rect = readRect();
+        pm.pm = Pixmap(readSize());
+        pm.offset = readPoint();
+    }
+
+    template<class T>
+    void read(std::vector<T>& vals)
+    {
+        const uint64_t count = readUInt();
+        for (uint64_t i = 0; i < count && !m_error; ++i) {
+            T val;
+            read(val);
+            vals.push_back(std::move(val));
+        }
+    }
+
+    const ByteArray& m_data;
+    size_t m_pos = 0;
+    bool m_error = false;
+    std::vector<std::string> m_strings;
+    std::vector<Font> m_fonts;
+};
+} // mu::draw::binary
+
+ByteArray DrawBufferBinary::toBinary(const DrawData& buf)
+{
+    ByteArray out;
+    binary::Writer writer(out);
+
+    out.push_back(binary::MAGIC, sizeof(binary::MAGIC));
+    writer.writeUInt(binary::VERSION);
+    writer.writeString(buf.name);
+    writer.writeUInt(buf.objects.size());
+
+    for (const DrawData::Object& obj : buf.objects) {
+        writer.write(obj);
+    }
+
+    return out;
+}
+
+RetVal<DrawDataPtr> DrawBufferBinary::fromBinary(const ByteArray& data)
+{
+    binary::Reader reader(data);
+
+    DrawDataPtr buf = std::make_shared<DrawData>();
+    size_t objectCount = 0;
+    if (!reader.readHeader(buf->name, objectCount)) {
+        return make_ret(Ret::Code::UnknownError, "invalid draw data header");
+    }
+
+    for (size_t i = 0; i < objectCount; ++i) {
+        DrawData::Object obj;
+        if (!reader.readObject(obj)) {
+            return make_ret(Ret::Code::UnknownError, "invalid draw data object");
+        }
+
+        buf->objects.push_back(std::move(obj));
+    }
+
+    return RetVal<DrawDataPtr>::make_ok(buf);
+}
+
+RetVal<Diff> DrawBufferBinary::compare(const ByteArray& data, const ByteArray& origin, DrawComp::Tolerance tolerance)
+{
+    binary::Reader dataReader(data);
+    binary::Reader originReader(origin);
+
+    DrawDataPtr restData = std::make_shared<DrawData>();
+    DrawDataPtr restOrigin = std::make_shared<DrawData>();
+
+    size_t dataCount = 0;
+    size_t originCount = 0;
+    if (!dataReader.readHeader(restData->name, dataCount) || !originReader.readHeader(restOrigin->name, originCount)) {
+        return make_ret(Ret::Code::UnknownError, "invalid draw data header");
+    }
+
+    for (size_t i = 0; i < std::max(dataCount, originCount); ++i) {
+        DrawData::Object dataObj;
+        const bool hasData = i < dataCount;
+        if (hasData && !dataReader.readObject(dataObj)) {
+            return make_ret(Ret::Code::UnknownError, "invalid draw data object");
+        }
+
+        DrawData::Object originObj;
+        const bool hasOrigin = i < originCount;
+        if (hasOrigin && !originReader.readObject(originObj)) {
+            return make_ret(Ret::Code::UnknownError, "invalid draw data object");
+        }
+
+        if (hasData && hasOrigin && DrawComp::isEqual(dataObj, originObj, tolerance)) {
+            continue;
+        }
+
+        if (hasData) {
+            restData->objects.push_back(std::move(dataObj));
+        }
+
+        if (hasOrigin) {
+            restOrigin->objects.push_back(std::move(originObj));
+        }
+    }
+
+    return RetVal<Diff>::make_ok(DrawComp::compare(restData, restOrigin, tolerance));
+}
@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_DRAWBINARY_H
+#define MU_DRAW_DRAWBINARY_H
+
+#include "../buffereddrawtypes.h"
+#include "drawcomp.h"
+#include "types/retval.h"
+
+namespace mu::draw {
+//! NOTE Compact alternative to DrawBufferJson for the big snapshots (whole scores).
+//! The strings and the fonts are written once and then referenced by index,
+//! the coordinates have the same precision as in JSON and the points of the paths and
+//! the polygons are written as deltas from the previous point.
+//! The objects are independent records, so they can be read and compared one by one
+class DrawBufferBinary
+{
+public:
+
+    static ByteArray toBinary(const DrawData& buf);
+    static RetVal<DrawDataPtr> fromBinary(const ByteArray& data);
+
+    //! NOTE Compares the snapshots object by object, only the objects that differ at the same position
+    //! are kept and compared with DrawComp at the end, so the equal snapshots are compared in linear time
+    static RetVal<Diff> compare(const ByteArray& data, const ByteArray& origin, DrawComp::Tolerance tolerance = DrawComp::Tolerance());
+};
+}
+
+#endif // MU_DRAW_DRAWBINARY_H
@@ -476,3 +476,8 @@ Diff DrawComp::compare(const DrawDataPtr& data, const DrawDataPtr& origin, Toler
 
     return diff;
 }
+
+bool DrawComp::isEqual(const DrawData::Object& obj, const DrawData::Object& origin, Tolerance tolerance)
+{
+    return comp::isEqual(obj, origin, tolerance);
+}
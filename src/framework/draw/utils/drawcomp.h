@@ -35,6 +35,7 @@ public:
     };
 
     static Diff compare(const DrawDataPtr& data, const DrawDataPtr& origin, Tolerance tolerance = Tolerance());
+    static bool isEqual(const DrawData::Object& obj, const DrawData::Object& origin, Tolerance tolerance = Tolerance());
 };
 }
 
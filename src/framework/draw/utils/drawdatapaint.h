@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_DRAWDATAPAINT_H
+#define MU_DRAW_DRAWDATAPAINT_H
+
+#include "../buffereddrawtypes.h"
+#include "../ipaintprovider.h"
+
+namespace mu::draw {
+class DrawDataPaint
+{
+public:
+
+    //! NOTE Replays an object recorded by BufferedPaintProvider.
+    //! The recorded transforms are combined with the given one, so the object can be painted anywhere.
+    //! The caller should save and restore the state of the provider around the replay
+    static void paintObject(IPaintProvider* provider, const DrawData::Object& object, const Transform& transform);
+};
+}
+
+#endif // MU_DRAW_DRAWDATAPAINT_H
@@ -21,7 +21,10 @@
  */
 #include "allocator.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cstdlib>
+#include <set>
 #include <iostream>
 #include <sstream>
 
@@ -41,8 +44,44 @@ static inline size_t align(size_t n)
 // ============================================
 // ObjectAllocator
 // ============================================
+
+//! NOTE Guards the links between the magazines and the allocators,
+//! for the threads and the allocators that are destroyed at any time.
+//! Locked before the mutex of an allocator, never after
+static std::mutex s_magazinesMutex;
+static std::atomic<size_t> s_allocatorsCount { 0 };
+
+//! NOTE Objects may still be deleted after the cache of the thread is destroyed (e.g. the statics at exit)
+static thread_local bool s_threadCacheDestroyed = false;
+
+struct ObjectAllocator::ThreadCache
+{
+    std::vector<Magazine*> magazines; // by the allocator index
+
+    ~ThreadCache()
+    {
+        s_threadCacheDestroyed = true;
+
+        std::lock_guard<std::mutex> lock(s_magazinesMutex);
+        for (Magazine* m : magazines) {
+            if (!m) {
+                continue;
+            }
+
+            if (ObjectAllocator* a = m->allocator) {
+                a->flush(m, 0);
+
+                std::lock_guard<std::mutex> allocatorLock(a->m_mutex);
+                a->m_magazines.erase(std::find(a->m_magazines.begin(), a->m_magazines.end(), m));
+            }
+
+            delete m;
+        }
+    }
+};
+
 ObjectAllocator::ObjectAllocator(const char* module, const char* name, destroyer_t dtor)
-    : m_module(module), m_name(name), m_dtor(dtor)
+    : m_module(module), m_name(name), m_index(s_allocatorsCount++), m_dtor(dtor)
 {
     AllocatorsRegister::instance()->reg(this);
 }
@@ -50,6 +89,16 @@ ObjectAllocator::ObjectAllocator(const char* module, const char* name, destroyer
 ObjectAllocator::~ObjectAllocator()
 {
     AllocatorsRegister::instance()->unreg(this);
+
+    //! NOTE The magazines are deleted by their threads
+    std::lock_guard<std::mutex> lock(s_magazinesMutex);
+    std::lock_guard<std::mutex> allocatorLock(m_mutex);
+    for (Magazine* m : m_magazines) {
+        m->allocator = nullptr;
+        m->head = nullptr;
+        m->count = 0;
+    }
+    m_magazines.clear();
 }
 
 const char* ObjectAllocator::module() const
@@ -62,33 +111,138 @@ const char* ObjectAllocator::name() const
     return m_name;
 }
 
-void* ObjectAllocator::alloc(size_t size)
+ObjectAllocator::Magazine* ObjectAllocator::threadMagazine()
 {
-    size = align(size);
+    if (s_threadCacheDestroyed) {
+        return nullptr;
+    }
+
+    static thread_local ThreadCache cache;
+
+    if (m_index < cache.magazines.size() && cache.magazines[m_index]) {
+        return cache.magazines[m_index];
+    }
+
+    Magazine* m = new Magazine();
+    m->allocator = this;
+
+    {
+        std::lock_guard<std::mutex> lock(s_magazinesMutex);
+        std::lock_guard<std::mutex> allocatorLock(m_mutex);
+        m_magazines.push_back(m);
+    }
+
+    if (cache.magazines.size() <= m_index) {
+        cache.magazines.resize(m_index + 1, nullptr);
+    }
+    cache.magazines[m_index] = m;
+
+    return m;
+}
+
+void ObjectAllocator::refill(Magazine* m, size_t chunkSize)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (!m_chunkSize) {
-        m_chunkSize = size;
+        m_chunkSize = chunkSize;
     }
 
-    assert(m_chunkSize == size);
+    assert(m_chunkSize == chunkSize);
 
+    //! NOTE At most one new block per refill, so the memory grows as before
     if (!m_free) {
         Block b = allocateBlock(m_chunkSize);
         m_blocks.push_back(b);
         m_free = b.begin;
     }
 
-    // The return value is the current position of
-    // the allocation pointer:
-    Chunk* freeChunk = m_free;
+    size_t count = m->count.load(std::memory_order_relaxed);
+    while (m_free && count < MAGAZINE_SIZE) {
+        Chunk* chunk = m_free;
+        m_free = m_free->next;
+
+        chunk->next = m->head;
+        m->head = chunk;
+        ++count;
+    }
+
+    m->count.store(count, std::memory_order_relaxed);
+}
 
-    // Advance (bump) the allocation pointer to the next chunk.
-    //
-    // When no chunks left, the `m_free` will be set to `nullptr`, and
-    // this will cause allocation of a new block on the next request:
+void ObjectAllocator::flush(Magazine* m, size_t keepCount)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t count = m->count.load(std::memory_order_relaxed);
+    while (m->head && count > keepCount) {
+        Chunk* chunk = m->head;
+        m->head = m->head->next;
+
+        chunk->next = m_free;
+        m_free = chunk;
+        --count;
+    }
+
+    m->count.store(count, std::memory_order_relaxed);
+}
+
+ObjectAllocator::Chunk* ObjectAllocator::allocShared(size_t chunkSize)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_chunkSize) {
+        m_chunkSize = chunkSize;
+    }
+
+    if (!m_free) {
+        Block b = allocateBlock(m_chunkSize);
+        m_blocks.push_back(b);
+        m_free = b.begin;
+    }
+
+    Chunk* chunk = m_free;
     m_free = m_free->next;
+    return chunk;
+}
 
-    m_statistic.totalAllocatedCount++;
+void ObjectAllocator::freeShared(Chunk* chunk)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    chunk->next = m_free;
+    m_free = chunk;
+}
+
+void* ObjectAllocator::alloc(size_t size)
+{
+    size = align(size);
+
+    Chunk* freeChunk = nullptr;
+
+    Magazine* m = threadMagazine();
+    if (m) {
+        if (!m->head) {
+            refill(m, size);
+        }
+
+        // The return value is the head of the thread's free list:
+        freeChunk = m->head;
+
+        // When no chunks left, the head will be set to `nullptr`, and
+        // this will cause a refill on the next request:
+        m->head = freeChunk->next;
+        m->count.store(m->count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    } else {
+        freeChunk = allocShared(size);
+    }
+
+    assert(m_chunkSize == size);
+
+    m_statistic.totalAllocatedCount.fetch_add(1, std::memory_order_relaxed);
+    int64_t live = m_statistic.liveCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    int64_t peak = m_statistic.peakCount.load(std::memory_order_relaxed);
+    while (live > peak && !m_statistic.peakCount.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
 
     return freeChunk;
 }
@@ -98,21 +252,36 @@ void ObjectAllocator::free(void* chunk, size_t size)
 #ifdef NDEBUG
     UNUSED(size);
 #endif
-    assert(m_chunkSize == size);
+    assert(m_chunkSize == align(size));
+
+    m_statistic.totalFreeCount.fetch_add(1, std::memory_order_relaxed);
+    m_statistic.liveCount.fetch_sub(1, std::memory_order_relaxed);
 
-    // The freed chunk's next pointer points to the
-    // current allocation pointer:
-    reinterpret_cast<Chunk*>(chunk)->next = m_free;
+    Magazine* m = threadMagazine();
+    if (!m) {
+        freeShared(reinterpret_cast<Chunk*>(chunk));
+        return;
+    }
+
+    // The freed chunk goes to the thread's free list,
+    // even if it was allocated on another thread:
+    reinterpret_cast<Chunk*>(chunk)->next = m->head;
+    m->head = reinterpret_cast<Chunk*>(chunk);
 
-    // And the allocation pointer is now set
-    // to the returned (free) chunk:
-    m_free = reinterpret_cast<Chunk*>(chunk);
+    size_t count = m->count.load(std::memory_order_relaxed) + 1;
+    m->count.store(count, std::memory_order_relaxed);
 
-    m_statistic.totalFreeCount++;
+    // Return a batch to the shared list, so a thread that only frees does not keep them all:
+    if (count > 2 * MAGAZINE_SIZE) {
+        flush(m, MAGAZINE_SIZE);
+    }
 }
 
 void ObjectAllocator::cleanup()
 {
+    std::lock_guard<std::mutex> lock(s_magazinesMutex);
+    std::lock_guard<std::mutex> allocatorLock(m_mutex);
+
     if (m_blocks.empty()) {
         return;
     }
@@ -124,6 +293,18 @@ void ObjectAllocator::cleanup()
             freeChunks.insert(free);
             free = free->next;
         }
+
+        //! NOTE The other threads don't use the allocator now, so their magazines can be read and reset
+        for (Magazine* m : m_magazines) {
+            free = m->head;
+            while (free) {
+                freeChunks.insert(free);
+                free = free->next;
+            }
+
+            m->head = nullptr;
+            m->count = 0;
+        }
     }
 
     for (size_t bi = 0; bi < m_blocks.size(); ++bi) {
@@ -151,6 +332,7 @@ void ObjectAllocator::cleanup()
     }
 
     m_free = m_blocks.front().begin;
+    m_statistic.liveCount = 0;
 }
 
 ObjectAllocator::Block ObjectAllocator::allocateBlock(size_t chunkSize) const
@@ -187,13 +369,17 @@ void* ObjectAllocator::not_supported(const char* info)
 
 ObjectAllocator::Info ObjectAllocator::stateInfo() const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     Info info;
     info.module = m_module;
     info.name = m_name;
     info.chunkSize = m_chunkSize;
     info.blockCount = m_blocks.size();
-    info.totalAllocatedCount = m_statistic.totalAllocatedCount;
-    info.totalFreeCount = m_statistic.totalFreeCount;
+    info.totalAllocatedCount = m_statistic.totalAllocatedCount.load(std::memory_order_relaxed);
+    info.totalFreeCount = m_statistic.totalFreeCount.load(std::memory_order_relaxed);
+    info.liveCount = static_cast<uint64_t>(std::max(m_statistic.liveCount.load(std::memory_order_relaxed), int64_t(0)));
+    info.peakCount = static_cast<uint64_t>(m_statistic.peakCount.load(std::memory_order_relaxed));
 
     for (const Block& b : m_blocks) {
         info.totalChunks += b.chunkCount;
@@ -205,9 +391,99 @@ ObjectAllocator::Info ObjectAllocator::stateInfo() const
         free = free->next;
     }
 
+    //! NOTE Only the counts of the magazines, their lists belong to their threads
+    for (const Magazine* m : m_magazines) {
+        info.freeChunks += m->count.load(std::memory_order_relaxed);
+    }
+
     return info;
 }
 
+// ============================================
+// ArenaAllocator
+// ============================================
+ArenaAllocator::ArenaAllocator(size_t blockSize)
+    : m_blockSize(blockSize)
+{
+}
+
+ArenaAllocator::~ArenaAllocator()
+{
+    for (const Block& b : m_blocks) {
+        ::free(b.begin);
+    }
+}
+
+void* ArenaAllocator::alloc(size_t size, size_t alignment)
+{
+    m_usedBytes += size;
+
+#ifdef CUSTOM_ALLOCATOR_DISABLED
+    // every allocation gets its own block, so that sanitizers can still track it
+    UNUSED(alignment);
+    Block b;
+    b.begin = reinterpret_cast<uint8_t*>(malloc(std::max(size, size_t(1))));
+    b.size = size;
+    m_blocks.push_back(b);
+    return b.begin;
+#else
+    while (m_currentBlock < m_blocks.size()) {
+        const Block& b = m_blocks.at(m_currentBlock);
+        uintptr_t address = reinterpret_cast<uintptr_t>(b.begin) + m_offset;
+        size_t padding = (alignment - address % alignment) % alignment;
+        if (m_offset + padding + size <= b.size) {
+            m_offset += padding + size;
+            return reinterpret_cast<void*>(address + padding);
+        }
+
+        ++m_currentBlock;
+        m_offset = 0;
+    }
+
+    // malloc returns memory aligned for any fundamental type,
+    // bigger alignments are not supported
+    assert(alignment <= alignof(std::max_align_t));
+
+    Block b;
+    b.size = std::max(m_blockSize, size);
+    b.begin = reinterpret_cast<uint8_t*>(malloc(b.size));
+    m_blocks.push_back(b);
+
+    m_currentBlock = m_blocks.size() - 1;
+    m_offset = size;
+
+    return b.begin;
+#endif
+}
+
+void ArenaAllocator::reset()
+{
+#ifdef CUSTOM_ALLOCATOR_DISABLED
+    for (const Block& b : m_blocks) {
+        ::free(b.begin);
+    }
+    m_blocks.clear();
+#endif
+
+    m_currentBlock = 0;
+    m_offset = 0;
+    m_usedBytes = 0;
+}
+
+size_t ArenaAllocator::usedBytes() const
+{
+    return m_usedBytes;
+}
+
+size_t ArenaAllocator::reservedBytes() const
+{
+    size_t bytes = 0;
+    for (const Block& b : m_blocks) {
+        bytes += b.size;
+    }
+    return bytes;
+}
+
 // ============================================
 // AllocatorsRegister
 // ============================================
@@ -230,6 +506,17 @@ void AllocatorsRegister::cleanupAll(const std::string& module)
     }
 }
 
+std::vector<ObjectAllocator::Info> AllocatorsRegister::stateInfos() const
+{
+    std::vector<ObjectAllocator::Info> infos;
+    infos.reserve(m_allocators.size());
+    for (const ObjectAllocator* a : m_allocators) {
+        infos.push_back(a->stateInfo());
+    }
+
+    return infos;
+}
+
 #define FORMAT(str, width) mu::strings::leftJustified(str, width)
 #define TITLE(str) FORMAT(std::string(str), 20)
 #define VALUE(val) FORMAT(std::to_string(val), 20)
@@ -296,3 +583,59 @@ void AllocatorsRegister::printState(const std::string& title)
 
     LOGD() << stream.str() << '\n';
 }
+
+std::string AllocatorsRegister::memoryStatistic() const
+{
+    std::vector<ObjectAllocator::Info> infos = stateInfos();
+    std::sort(infos.begin(), infos.end(), [](const ObjectAllocator::Info& i1, const ObjectAllocator::Info& i2) {
+        return i1.liveBytes() > i2.liveBytes();
+    });
+
+    struct ModuleInfo {
+        std::string module;
+        uint64_t liveBytes = 0;
+        uint64_t peakBytes = 0; // sum of the peaks of the classes, they may be at different times
+        uint64_t allocatedBytes = 0;
+    };
+
+    std::vector<ModuleInfo> modules;
+    for (const ObjectAllocator::Info& info : infos) {
+        auto it = std::find_if(modules.begin(), modules.end(), [&info](const ModuleInfo& m) { return m.module == info.module; });
+        if (it == modules.end()) {
+            modules.push_back({ info.module });
+            it = modules.end() - 1;
+        }
+
+        it->liveBytes += info.liveBytes();
+        it->peakBytes += info.peakBytes();
+        it->allocatedBytes += info.allocatedBytes();
+    }
+
+    std::stringstream stream;
+    stream << TITLE("Module") << TITLE("Live bytes") << TITLE("Peak bytes") << TITLE("Allocated bytes") << "\n";
+    for (const ModuleInfo& m : modules) {
+        stream << FORMAT(m.module, 20) << VALUE(m.liveBytes) << VALUE(m.peakBytes) << VALUE(m.allocatedBytes) << "\n";
+    }
+
+    stream << "\n";
+    stream << TITLE("Object") << TITLE("Live count") << TITLE("Live bytes") << TITLE("Peak count") << TITLE("Peak bytes") << "\n";
+    for (const ObjectAllocator::Info& info : infos) {
+        if (info.peakCount == 0) {
+            continue;
+        }
+
+        stream << FORMAT(info.name, 20)
+               << VALUE(info.liveCount)
+               << VALUE(info.liveBytes())
+               << VALUE(info.peakCount)
+               << VALUE(info.peakBytes())
+               << "\n";
+    }
+
+    return stream.str();
+}
+
+void AllocatorsRegister::printMemory(const std::string& title)
+{
+    LOGI() << "\n\n" << title << "\n" << memoryStatistic() << '\n';
+}
@@ -22,7 +22,13 @@
 #ifndef MU_GLOBAL_ALLOCATOR_H
 #define MU_GLOBAL_ALLOCATOR_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <list>
 #include <string>
@@ -59,6 +65,10 @@ public: \
     } \
 private:
 
+//! NOTE Thread-safe. Every thread takes the chunks from its own cache (magazine),
+//! which is refilled from and returned to the shared free list in batches, under the lock.
+//! When a thread exits, its cached chunks go back to the shared list.
+//! cleanup() must not run while other threads use the allocator.
 class ObjectAllocator
 {
 public:
@@ -97,9 +107,13 @@ public:
 
         uint64_t totalAllocatedCount = 0;
         uint64_t totalFreeCount = 0;
+        uint64_t liveCount = 0;
+        uint64_t peakCount = 0;
 
         uint64_t usedChunks() const { return totalChunks - freeChunks; }
         uint64_t allocatedBytes() const { return totalChunks * chunkSize; }
+        uint64_t liveBytes() const { return liveCount * chunkSize; }
+        uint64_t peakBytes() const { return peakCount * chunkSize; }
     };
 
     Info stateInfo() const;
@@ -133,24 +147,120 @@ private:
         size_t chunkSize = 0;
     };
 
+    //! NOTE The free chunks cached by one thread, only the owner thread touches the list
+    struct Magazine {
+        ObjectAllocator* allocator = nullptr; // null when the allocator is already destroyed
+        Chunk* head = nullptr;
+        std::atomic<size_t> count { 0 };
+    };
+
+    struct ThreadCache;
+
+    static constexpr size_t MAGAZINE_SIZE = 32;
+
     Block allocateBlock(size_t chunkSize) const;
 
+    Magazine* threadMagazine();
+    void refill(Magazine* m, size_t chunkSize);
+    void flush(Magazine* m, size_t keepCount);
+
+    //! NOTE Without a magazine, when the thread cache is already destroyed
+    Chunk* allocShared(size_t chunkSize);
+    void freeShared(Chunk* chunk);
+
     const char* m_module = nullptr;
     const char* m_name = nullptr;
+    const size_t m_index = 0; // of the magazine in the thread caches
     size_t m_chunkSize = 0;
     destroyer_t m_dtor = nullptr;
+
+    mutable std::mutex m_mutex; // the shared free list, the blocks and the magazines list
     Chunk* m_free = nullptr;
     std::vector<Block> m_blocks;
+    std::vector<Magazine*> m_magazines;
 
     struct Statistic
     {
-        uint64_t totalAllocatedCount = 0;
-        uint64_t totalFreeCount = 0;
+        std::atomic<uint64_t> totalAllocatedCount { 0 };
+        std::atomic<uint64_t> totalFreeCount { 0 };
+        std::atomic<int64_t> liveCount { 0 };
+        std::atomic<int64_t> peakCount { 0 };
     };
 
     Statistic m_statistic;
 };
 
+//! NOTE Bump allocator for short-lived temporaries of one pass (e.g. one layout).
+//! Memory is handed out linearly from big blocks and is only released at once by reset(),
+//! the blocks are kept to be reused by the next pass.
+//! Objects created in the arena are never destroyed, so they must be trivially destructible.
+//! Not thread-safe.
+class ArenaAllocator
+{
+public:
+    ArenaAllocator(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ArenaAllocator(const ArenaAllocator&) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+    ~ArenaAllocator();
+
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 1024 * 64; // 64 kB
+
+    void* alloc(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template<class T, class ... Args>
+    T* create(Args&& ... args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "arena objects are never destroyed");
+        return new (alloc(sizeof(T), alignof(T)))T(std::forward<Args>(args)...);
+    }
+
+    //! NOTE Invalidates everything allocated so far
+    void reset();
+
+    size_t usedBytes() const;
+    size_t reservedBytes() const;
+
+private:
+    struct Block {
+        uint8_t* begin = nullptr;
+        size_t size = 0;
+    };
+
+    size_t m_blockSize = 0;
+    std::vector<Block> m_blocks;
+    size_t m_currentBlock = 0;
+    size_t m_offset = 0;
+    size_t m_usedBytes = 0;
+};
+
+//! NOTE Adapter to use ArenaAllocator in std containers, deallocate does nothing
+template<class T>
+class ArenaStdAllocator
+{
+public:
+    using value_type = T;
+
+    ArenaStdAllocator(ArenaAllocator* arena)
+        : m_arena(arena) {}
+
+    template<class U>
+    ArenaStdAllocator(const ArenaStdAllocator<U>& other)
+        : m_arena(other.arena()) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(m_arena->alloc(n * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) {}
+
+    ArenaAllocator* arena() const { return m_arena; }
+
+    template<class U>
+    bool operator==(const ArenaStdAllocator<U>& other) const { return m_arena == other.arena(); }
+    template<class U>
+    bool operator!=(const ArenaStdAllocator<U>& other) const { return m_arena != other.arena(); }
+
+private:
+    ArenaAllocator* m_arena = nullptr;
+};
+
 class AllocatorsRegister
 {
 public:
@@ -166,8 +276,14 @@ public:
 
     void cleanupAll(const std::string& module);
 
+    std::vector<ObjectAllocator::Info> stateInfos() const;
+
+    //! NOTE Live and peak bytes per module and per class, the biggest first
+    std::string memoryStatistic() const;
+
     void printStatistic(const std::string& title);
     void printState(const std::string& title);
+    void printMemory(const std::string& title);
 
 private:
     std::list<ObjectAllocator*> m_allocators;
@@ -0,0 +1,49 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ASYNC_CANCELLATION_H
+#define MU_ASYNC_CANCELLATION_H
+
+#include <atomic>
+#include <memory>
+
+namespace mu::async {
+//! NOTE Shared by the one who starts an async operation and the operation itself.
+//! The operation checks it between its steps and stops once it is cancelled
+class Cancellation
+{
+public:
+    void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+    bool isCancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> m_cancelled = false;
+};
+
+using CancellationPtr = std::shared_ptr<Cancellation>;
+
+inline bool isCancelled(const CancellationPtr& cancellation)
+{
+    return cancellation && cancellation->isCancelled();
+}
+}
+
+#endif // MU_ASYNC_CANCELLATION_H
@@ -1,211 +1,496 @@
-/*
- * SPDX-License-Identifier: GPL-3.0-only
- * MuseScore-CLA-applies
- *
- * MuseScore
- * Music Composition & Notation
- *
- * Copyright (C) 2022 MuseScore BVBA and others
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License version 3 as
- * published by the Free Software Foundation.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <https://www.gnu.org/licenses/>.
- */
-
-#ifndef MU_GLOBAL_TASKCHEDULER_H
-#define MU_GLOBAL_TASKCHEDULER_H
-
-#include <condition_variable>
-#include <functional>
-#include <future>
-#include <memory>
-#include <mutex>
-#include <atomic>
-#include <queue>
-#include <thread>
-#include <type_traits>
-#include <utility>
-
-#include "log.h"
-
-namespace mu {
-typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
-
-class TaskScheduler
-{
-public:
-
-    //!Note Would be moved into globalmodule.cpp for better lifetime control
-    static TaskScheduler* instance()
-    {
-        static TaskScheduler s;
-        return &s;
-    }
-
-    explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
-        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
-        m_threadPool(std::make_unique<std::thread[]>(vaildateThreadPoolCapacity(desiredThreadCount)))
-    {
-        setupThreads();
-    }
-
-    ~TaskScheduler()
-    {
-        waitForAllTasksComplete();
-        terminateThreads();
-    }
-
-    thread_pool_size_t threadPoolSize() const
-    {
-        return m_threadPoolSize;
-    }
-
-    template<typename FuncT, typename ... ArgsT>
-    void push(FuncT&& task, ArgsT&&... args)
-    {
-        std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        {
-            const std::lock_guard lock(m_mutex);
-            m_taskQueue.push(taskFunctor);
-        }
-        m_newTaskAvailableCv.notify_one();
-    }
-
-    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
-    std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
-    {
-        std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
-        push([taskFunctor, promise] {
-            try {
-                if constexpr (std::is_void_v<ReturnT>) {
-                    std::invoke(taskFunctor);
-                    promise->set_value();
-                } else {
-                    promise->set_value(std::invoke(taskFunctor));
-                }
-            } catch (...) {
-                try {
-                    promise->set_exception(std::current_exception());
-                } catch (...) {
-                    LOGE() << "Unable to schedule a task";
-                }
-            }
-        });
-
-        return promise->get_future();
-    }
-
-    void waitForAllTasksComplete()
-    {
-        m_isWaitingForAllTasksDone = true;
-        std::unique_lock<std::mutex> tasks_lock(m_mutex);
-        m_taskFinishedCv.wait(tasks_lock, [this] { return m_taskQueue.empty(); });
-        m_isWaitingForAllTasksDone = false;
-    }
-
-    const std::set<std::thread::id>& threadIdSet() const
-    {
-        static std::set<std::thread::id> result;
-
-        if (result.empty()) {
-            for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-                result.insert(m_threadPool[i].get_id());
-            }
-        }
-
-        return result;
-    }
-
-    bool containsThread(const std::thread::id& id) const
-    {
-        const auto& idSet = threadIdSet();
-        return idSet.find(id) != idSet.cend();
-    }
-
-private:
-    void setupThreads()
-    {
-        m_isActive = true;
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i] = std::thread(&TaskScheduler::th_workerLoop, this);
-        }
-    }
-
-    void terminateThreads()
-    {
-        m_isActive = false;
-        m_newTaskAvailableCv.notify_all();
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i].join();
-        }
-    }
-
-    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
-    {
-        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
-
-        if (maxCapacity <= 1) {
-            return 1;
-        }
-
-        thread_pool_size_t optimalCapacity = maxCapacity / 2;
-
-        if (desiredThreadCount <= 0) {
-            return optimalCapacity;
-        }
-
-        return desiredThreadCount;
-    }
-
-    void th_workerLoop()
-    {
-        while (m_isActive) {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_newTaskAvailableCv.wait(lock, [this] { return !m_taskQueue.empty() || !m_isActive; });
-
-            if (!m_isActive) {
-                return;
-            }
-
-            std::function<void()> task = m_taskQueue.front();
-            m_taskQueue.pop();
-
-            bool isQueueEmpty = m_taskQueue.empty();
-
-            lock.unlock();
-
-            task();
-
-            if (m_isWaitingForAllTasksDone) {
-                m_taskFinishedCv.notify_one();
-            }
-
-            if (isQueueEmpty) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            }
-        }
-    }
-
-    std::atomic<bool> m_isActive = false;
-    std::atomic<bool> m_isWaitingForAllTasksDone = false;
-
-    mutable std::mutex m_mutex;
-    std::condition_variable m_newTaskAvailableCv;
-    std::condition_variable m_taskFinishedCv;
-    std::queue<std::function<void()> > m_taskQueue;
-
-    thread_pool_size_t m_threadPoolSize = 0;
-    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
-};
-}
-
-#endif // MU_GLOBAL_TASKCHEDULER_H
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_GLOBAL_TASKCHEDULER_H
+#define MU_GLOBAL_TASKCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "log.h"
+
+namespace mu {
+typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
+
+enum class TaskPriority {
+    High = 0,
+    Normal
+};
+
+class TaskScheduler
+{
+    static constexpr thread_pool_size_t IO_THREAD_COUNT = 4;
+
+public:
+
+    //!Note Would be moved into globalmodule.cpp for better lifetime control
+    static TaskScheduler* instance()
+    {
+        static TaskScheduler s;
+        return &s;
+    }
+
+    //! NOTE For the tasks that mostly wait for the disk or the network,
+    //! so that they do not take the threads of the computational ones
+    static TaskScheduler* ioInstance()
+    {
+        static TaskScheduler s(IO_THREAD_COUNT);
+        return &s;
+    }
+
+    explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
+        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
+        m_threadPool(std::make_unique<std::thread[]>(m_threadPoolSize)),
+        m_queues(std::make_unique<WorkerQueue[]>(m_threadPoolSize))
+    {
+        setupThreads();
+    }
+
+    ~TaskScheduler()
+    {
+        waitForAllTasksComplete();
+        terminateThreads();
+    }
+
+    thread_pool_size_t threadPoolSize() const
+    {
+        return m_threadPoolSize;
+    }
+
+    template<typename FuncT, typename ... ArgsT>
+    void push(FuncT&& task, ArgsT&&... args)
+    {
+        push(TaskPriority::Normal, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    //! NOTE High priority tasks are taken before any normal one, by every worker
+    template<typename FuncT, typename ... ArgsT>
+    void push(TaskPriority priority, FuncT&& task, ArgsT&&... args)
+    {
+        std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+        enqueue(priority, std::move(taskFunctor));
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
+    std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
+    {
+        return submit(TaskPriority::Normal, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
+    std::future<ReturnT> submit(TaskPriority priority, FuncT&& task, ArgsT&&... args)
+    {
+        std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+        std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
+        push(priority, [taskFunctor, promise] {
+            try {
+                if constexpr (std::is_void_v<ReturnT>) {
+                    std::invoke(taskFunctor);
+                    promise->set_value();
+                } else {
+                    promise->set_value(std::invoke(taskFunctor));
+                }
+            } catch (...) {
+                try {
+                    promise->set_exception(std::current_exception());
+                } catch (...) {
+                    LOGE() << "Unable to schedule a task";
+                }
+            }
+        });
+
+        return promise->get_future();
+    }
+
+    //! NOTE Calls func(i) for every i in [begin, end), split into chunks of at least grainSize indices.
+    //! The calling thread takes part, so it is safe to call from a task of this scheduler
+    template<typename IndexT, typename FuncT>
+    void parallelFor(IndexT begin, IndexT end, const FuncT& func, IndexT grainSize = 1);
+
+    //! NOTE Runs one queued task on the calling thread, if there is any
+    bool runPendingTask()
+    {
+        std::function<void()> task;
+        if (!popTask(currentWorkerIndex(), task)) {
+            return false;
+        }
+
+        runTask(task);
+        return true;
+    }
+
+    void waitForAllTasksComplete()
+    {
+        std::unique_lock<std::mutex> lock(m_parkMutex);
+        m_taskFinishedCv.wait(lock, [this] { return m_unfinishedTasks.load() == 0; });
+    }
+
+    const std::set<std::thread::id>& threadIdSet() const
+    {
+        return m_threadIds;
+    }
+
+    bool containsThread(const std::thread::id& id) const
+    {
+        return m_threadIds.find(id) != m_threadIds.cend();
+    }
+
+private:
+    static constexpr size_t NO_WORKER = static_cast<size_t>(-1);
+    static constexpr int SPIN_COUNT_BEFORE_PARK = 64;
+    static constexpr size_t PRIORITY_COUNT = 2;
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()> > tasks[PRIORITY_COUNT];
+    };
+
+    struct WorkerInfo {
+        const TaskScheduler* scheduler = nullptr;
+        size_t index = NO_WORKER;
+    };
+
+    static WorkerInfo& currentWorker()
+    {
+        thread_local WorkerInfo info;
+        return info;
+    }
+
+    size_t currentWorkerIndex() const
+    {
+        const WorkerInfo& info = currentWorker();
+        return info.scheduler == this ? info.index : NO_WORKER;
+    }
+
+    void setupThreads()
+    {
+        m_isActive = true;
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threadPool[i] = std::thread(&TaskScheduler::th_workerLoop, this, static_cast<size_t>(i));
+            m_threadIds.insert(m_threadPool[i].get_id());
+        }
+    }
+
+    void terminateThreads()
+    {
+        {
+            std::lock_guard lock(m_parkMutex);
+            m_isActive = false;
+        }
+        m_parkCv.notify_all();
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threadPool[i].join();
+        }
+    }
+
+    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
+    {
+        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
+
+        if (maxCapacity <= 1) {
+            return 1;
+        }
+
+        thread_pool_size_t optimalCapacity = maxCapacity / 2;
+
+        if (desiredThreadCount <= 0) {
+            return optimalCapacity;
+        }
+
+        return desiredThreadCount;
+    }
+
+    void enqueue(TaskPriority priority, std::function<void()>&& task)
+    {
+        //! NOTE A worker keeps what it spawns in its own queue, other threads spread the tasks over all queues
+        size_t index = currentWorkerIndex();
+        if (index == NO_WORKER) {
+            index = m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_threadPoolSize;
+        }
+
+        ++m_unfinishedTasks;
+        {
+            WorkerQueue& queue = m_queues[index];
+            const std::lock_guard lock(queue.mutex);
+            queue.tasks[static_cast<size_t>(priority)].push_back(std::move(task));
+            ++m_queuedTasks;
+        }
+
+        if (m_parkedWorkers.load() > 0) {
+            {
+                std::lock_guard lock(m_parkMutex);
+            }
+            m_parkCv.notify_one();
+        }
+    }
+
+    //! NOTE The owner takes its newest task, the others steal the oldest one
+    bool popTask(size_t selfIndex, std::function<void()>& task)
+    {
+        if (m_queuedTasks.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        for (size_t priority = 0; priority < PRIORITY_COUNT; ++priority) {
+            if (selfIndex != NO_WORKER) {
+                WorkerQueue& queue = m_queues[selfIndex];
+                const std::lock_guard lock(queue.mutex);
+                std::deque<std::function<void()> >& tasks = queue.tasks[priority];
+                if (!tasks.empty()) {
+                    task = std::move(tasks.back());
+                    tasks.pop_back();
+                    --m_queuedTasks;
+                    return true;
+                }
+            }
+
+            size_t start = selfIndex == NO_WORKER ? 0 : selfIndex + 1;
+            for (size_t i = 0; i < m_threadPoolSize; ++i) {
+                size_t victim = (start + i) % m_threadPoolSize;
+                if (victim == selfIndex) {
+                    continue;
+                }
+
+                WorkerQueue& queue = m_queues[victim];
+                const std::lock_guard lock(queue.mutex);
+                std::deque<std::function<void()> >& tasks = queue.tasks[priority];
+                if (!tasks.empty()) {
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                    --m_queuedTasks;
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void runTask(std::function<void()>& task)
+    {
+        task();
+        task = nullptr;
+
+        if (--m_unfinishedTasks == 0) {
+            {
+                std::lock_guard lock(m_parkMutex);
+            }
+            m_taskFinishedCv.notify_all();
+        }
+    }
+
+    void th_workerLoop(size_t index)
+    {
+        currentWorker() = { this, index };
+
+        std::function<void()> task;
+        int spinCount = 0;
+
+        while (true) {
+            if (popTask(index, task)) {
+                runTask(task);
+                spinCount = 0;
+                continue;
+            }
+
+            if (!m_isActive) {
+                return;
+            }
+
+            if (spinCount < SPIN_COUNT_BEFORE_PARK) {
+                ++spinCount;
+                std::this_thread::yield();
+                continue;
+            }
+
+            ++m_parkedWorkers;
+            {
+                std::unique_lock<std::mutex> lock(m_parkMutex);
+                m_parkCv.wait(lock, [this] { return m_queuedTasks.load() > 0 || !m_isActive; });
+            }
+            --m_parkedWorkers;
+            spinCount = 0;
+        }
+    }
+
+    std::atomic<bool> m_isActive = false;
+
+    std::atomic<size_t> m_queuedTasks = 0;
+    std::atomic<size_t> m_unfinishedTasks = 0;
+    std::atomic<size_t> m_parkedWorkers = 0;
+    std::atomic<size_t> m_nextQueue = 0;
+
+    std::mutex m_parkMutex;
+    std::condition_variable m_parkCv;
+    std::condition_variable m_taskFinishedCv;
+
+    thread_pool_size_t m_threadPoolSize = 0;
+    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
+    std::unique_ptr<WorkerQueue[]> m_queues = nullptr;
+    std::set<std::thread::id> m_threadIds;
+};
+
+//! NOTE A set of tasks that can be waited for together.
+//! Waiting runs queued tasks on the waiting thread, so groups can be nested inside tasks without deadlocks
+class TaskGroup
+{
+public:
+    explicit TaskGroup(TaskScheduler* scheduler = TaskScheduler::instance())
+        : m_scheduler(scheduler)
+    {
+    }
+
+    ~TaskGroup()
+    {
+        waitForDone();
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template<typename FuncT>
+    void run(FuncT&& task, TaskPriority priority = TaskPriority::Normal)
+    {
+        ++m_pendingTasks;
+        m_scheduler->push(priority, [this, task = std::forward<FuncT>(task)]() mutable {
+            try {
+                task();
+            } catch (...) {
+                const std::lock_guard lock(m_mutex);
+                if (!m_exception) {
+                    m_exception = std::current_exception();
+                }
+            }
+
+            //! NOTE Decrement under the lock: the waiter takes it before returning,
+            //! so the group can't be destroyed while this is still touching it
+            const std::lock_guard lock(m_mutex);
+            if (--m_pendingTasks == 0) {
+                m_doneCv.notify_all();
+            }
+        });
+    }
+
+    //! NOTE Rethrows the first exception thrown by a task of the group
+    void wait()
+    {
+        waitForDone();
+
+        std::exception_ptr exception;
+        {
+            const std::lock_guard lock(m_mutex);
+            std::swap(exception, m_exception);
+        }
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    void waitForDone()
+    {
+        while (m_pendingTasks.load() > 0) {
+            if (m_scheduler->runPendingTask()) {
+                continue;
+            }
+
+            //! NOTE Our tasks are being run by other threads; check back now and then,
+            //! in case new work shows up that only this thread is free to do
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_doneCv.wait_for(lock, std::chrono::microseconds(200), [this] { return m_pendingTasks.load() == 0; });
+        }
+
+        const std::lock_guard lock(m_mutex);
+    }
+
+    TaskScheduler* m_scheduler = nullptr;
+    std::atomic<size_t> m_pendingTasks = 0;
+    std::mutex m_mutex;
+    std::condition_variable m_doneCv;
+    std::exception_ptr m_exception;
+};
+
+template<typename IndexT, typename FuncT>
+void TaskScheduler::parallelFor(IndexT begin, IndexT end, const FuncT& func, IndexT grainSize)
+{
+    if (!(begin < end)) {
+        return;
+    }
+
+    const size_t count = static_cast<size_t>(end - begin);
+    const size_t grain = std::max<size_t>(static_cast<size_t>(grainSize), 1);
+    const size_t chunkCount = (count + grain - 1) / grain;
+
+    if (chunkCount <= 1 || m_threadPoolSize <= 1) {
+        for (IndexT i = begin; i < end; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextChunk = 0;
+    auto runChunks = [&]() {
+        for (size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+            IndexT chunkBegin = begin + static_cast<IndexT>(chunk * grain);
+            IndexT chunkEnd = begin + static_cast<IndexT>(std::min(count, (chunk + 1) * grain));
+            for (IndexT i = chunkBegin; i < chunkEnd; ++i) {
+                func(i);
+            }
+        }
+    };
+
+    TaskGroup group(this);
+    size_t helperCount = std::min<size_t>(chunkCount, m_threadPoolSize) - 1;
+    for (size_t i = 0; i < helperCount; ++i) {
+        group.run(runChunks);
+    }
+
+    std::exception_ptr exception;
+    try {
+        runChunks();
+    } catch (...) {
+        exception = std::current_exception();
+        nextChunk = chunkCount;
+    }
+
+    group.wait();
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+}
+
+#endif // MU_GLOBAL_TASKCHEDULER_H
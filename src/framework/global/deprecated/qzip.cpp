@@ -570,6 +570,19 @@ public:
     };
 
     void addEntry(EntryType type, const QString& fileName, const QByteArray& contents);
+    void initHeader(FileHeader& header, EntryType type, const QString& fileName);
+    void writeLocalHeader(const FileHeader& header);
+
+    // the file being written by startFile() / writeFileData() / endFile()
+    bool streaming = false;
+    bool streamDeflated = false;
+    FileHeader streamHeader;
+    z_stream stream;
+    uint streamCrc = 0;
+    uint streamSize = 0;
+    uint streamDataStart = 0;
+
+    void writeStreamData(int flush);
 };
 
 LocalFileHeader CentralFileHeader::toLocalHeader() const
@@ -708,12 +721,9 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     }
 
     FileHeader header;
-    memset(&header.h, 0, sizeof(CentralFileHeader));
-    writeUInt(header.h.signature, 0x02014b50);
+    initHeader(header, type, fileName);
 
-    writeUShort(header.h.version_needed, ZIP_VERSION);
     writeUInt(header.h.uncompressed_size, contents.length());
-    writeMSDosDate(header.h.last_mod_file, QDateTime::currentDateTime());
     QByteArray data = contents;
     if (compression == MQZipWriter::AlwaysCompress) {
         writeUShort(header.h.compression_method, CompressionMethodDeflated);
@@ -746,6 +756,22 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     crc_32 = ::crc32(crc_32, (const uchar*)contents.constData(), contents.length());
     writeUInt(header.h.crc_32, crc_32);
 
+    fileHeaders.append(header);
+
+    writeLocalHeader(header);
+    device->write(data);
+    start_of_directory = device->pos();
+    dirtyFileTree = true;
+}
+
+void MQZipWriterPrivate::initHeader(FileHeader& header, EntryType type, const QString& fileName)
+{
+    memset(&header.h, 0, sizeof(CentralFileHeader));
+    writeUInt(header.h.signature, 0x02014b50);
+
+    writeUShort(header.h.version_needed, ZIP_VERSION);
+    writeMSDosDate(header.h.last_mod_file, QDateTime::currentDateTime());
+
     // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
     ushort general_purpose_bits = Utf8Names; // always use utf-8
     writeUShort(header.h.general_purpose_bits, general_purpose_bits);
@@ -783,15 +809,30 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     }
     writeUInt(header.h.external_file_attributes, mode << 16);
     writeUInt(header.h.offset_local_header, start_of_directory);
+}
 
-    fileHeaders.append(header);
-
+void MQZipWriterPrivate::writeLocalHeader(const FileHeader& header)
+{
     LocalFileHeader h = header.h.toLocalHeader();
     device->write((const char*)&h, sizeof(LocalFileHeader));
     device->write(header.file_name);
-    device->write(data);
-    start_of_directory = device->pos();
-    dirtyFileTree = true;
+}
+
+void MQZipWriterPrivate::writeStreamData(int flush)
+{
+    char buf[65536];
+
+    do {
+        stream.next_out = reinterpret_cast<Bytef*>(buf);
+        stream.avail_out = sizeof(buf);
+        int res = ::deflate(&stream, flush);
+        if (res == Z_STREAM_ERROR) {
+            qWarning("QZip: Z_STREAM_ERROR: failed to compress file");
+            status = MQZipWriter::FileError;
+            return;
+        }
+        device->write(buf, sizeof(buf) - stream.avail_out);
+    } while (stream.avail_out == 0);
 }
 
 //////////////////////////////  Reader
@@ -1374,11 +1415,111 @@ void MQZipWriter::addSymLink(const QString& fileName, const QString& destination
     d->addEntry(MQZipWriterPrivate::Symlink, QDir::fromNativeSeparators(fileName), QFile::encodeName(destination));
 }
 
+/*!
+    Start a file in the archive with the given \a fileName, its contents are
+    passed by writeFileData() and the file is completed by endFile().
+    The contents are compressed as they come, so they are never held in memory as a whole.
+    Returns \c false if the device can't be opened or another file is being written.
+*/
+bool MQZipWriter::startFile(const QString& fileName)
+{
+    if (d->streaming) {
+        return false;
+    }
+
+    if (!(d->device->isOpen() || d->device->open(QIODevice::WriteOnly))) {
+        d->status = FileOpenError;
+        return false;
+    }
+    d->device->seek(d->start_of_directory);
+
+    d->initHeader(d->streamHeader, MQZipWriterPrivate::File, QDir::fromNativeSeparators(fileName));
+
+    d->streamDeflated = d->compressionPolicy != NeverCompress;
+    if (d->streamDeflated) {
+        writeUShort(d->streamHeader.h.compression_method, CompressionMethodDeflated);
+
+        memset(&d->stream, 0, sizeof(z_stream));
+        if (deflateInit2(&d->stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            d->status = FileError;
+            return false;
+        }
+    }
+
+    // the sizes and the checksum are filled in by endFile()
+    d->writeLocalHeader(d->streamHeader);
+
+    d->streaming = true;
+    d->streamCrc = ::crc32(0, 0, 0);
+    d->streamSize = 0;
+    d->streamDataStart = d->device->pos();
+
+    return true;
+}
+
+/*!
+    Append \a len bytes of \a data to the file started by startFile().
+*/
+void MQZipWriter::writeFileData(const char* data, qint64 len)
+{
+    if (!d->streaming || len <= 0) {
+        return;
+    }
+
+    d->streamCrc = ::crc32(d->streamCrc, reinterpret_cast<const Bytef*>(data), len);
+    d->streamSize += len;
+
+    if (!d->streamDeflated) {
+        d->device->write(data, len);
+        return;
+    }
+
+    d->stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    d->stream.avail_in = len;
+    d->writeStreamData(Z_NO_FLUSH);
+}
+
+/*!
+    Complete the file started by startFile().
+*/
+void MQZipWriter::endFile()
+{
+    if (!d->streaming) {
+        return;
+    }
+
+    if (d->streamDeflated) {
+        d->stream.next_in = nullptr;
+        d->stream.avail_in = 0;
+        d->writeStreamData(Z_FINISH);
+        deflateEnd(&d->stream);
+    }
+
+    uint end = d->device->pos();
+
+    FileHeader& header = d->streamHeader;
+    writeUInt(header.h.crc_32, d->streamCrc);
+    writeUInt(header.h.compressed_size, end - d->streamDataStart);
+    writeUInt(header.h.uncompressed_size, d->streamSize);
+
+    // write the local header again, now with the sizes and the checksum
+    d->device->seek(d->start_of_directory);
+    d->writeLocalHeader(header);
+    d->device->seek(end);
+
+    d->fileHeaders.append(header);
+    d->start_of_directory = end;
+    d->dirtyFileTree = true;
+    d->streaming = false;
+}
+
 /*!
    Closes the zip file.
 */
 void MQZipWriter::close()
 {
+    endFile();
+
     if (!(d->device->openMode() & QIODevice::WriteOnly)) {
         d->device->close();
         return;
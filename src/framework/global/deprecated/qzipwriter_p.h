@@ -106,6 +106,10 @@ public:
 
     void addSymLink(const QString& fileName, const QString& destination);
 
+    bool startFile(const QString& fileName);
+    void writeFileData(const char* data, qint64 len);
+    void endFile();
+
     void close();
 private:
     MQZipWriterPrivate* d;
@@ -109,6 +109,8 @@ void GlobalModule::onPreInit(const IApplication::RunMode& mode)
     logger->setLevel(haw::logger::Normal);
 #endif
 
+    logger->setIsAsync(true);
+
     LOGI() << "log path: " << logFile->filePath();
     LOGI() << "=== Started MuseScore " << framework::Version::fullVersion() << ", build number " << BUILD_NUMBER << " ===";
 
@@ -151,3 +153,8 @@ void GlobalModule::onPreInit(const IApplication::RunMode& mode)
         pr->reg("settings file", settings()->filePath());
     }
 }
+
+void GlobalModule::onDeinit()
+{
+    settings()->flush();
+}
@@ -23,6 +23,8 @@
 #define MU_SYSTEM_IFILESYSTEM_H
 
 #include "modularity/imoduleexport.h"
+#include "async/promise.h"
+#include "async/cancellation.h"
 #include "types/bytearray.h"
 #include "types/datetime.h"
 #include "types/retval.h"
@@ -61,6 +63,14 @@ public:
     virtual bool readFile(const io::path_t& filePath, ByteArray& data) const = 0;
     virtual Ret writeFile(const io::path_t& filePath, const ByteArray& data) const = 0;
 
+    //! NOTE Async variants, they run on the I/O thread pool and resolve on the calling thread.
+    //! A failed request is rejected with the code of its error, a cancelled one with Ret::Code::Cancel
+    virtual async::Promise<io::paths_t> scanFilesAsync(const io::path_t& rootDir, const std::vector<std::string>& filters,
+                                                       ScanMode mode = ScanMode::FilesInCurrentDirAndSubdirs,
+                                                       const async::CancellationPtr& cancellation = nullptr) const = 0;
+    virtual async::Promise<ByteArray> readFileAsync(const io::path_t& filePath,
+                                                    const async::CancellationPtr& cancellation = nullptr) const = 0;
+
     //! NOTE File info
     virtual io::path_t canonicalFilePath(const io::path_t& filePath) const = 0;
     virtual io::path_t absolutePath(const io::path_t& filePath) const = 0;
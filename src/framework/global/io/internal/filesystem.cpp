@@ -30,10 +30,37 @@
 #endif
 
 #include "io/ioretcodes.h"
+#include "concurrency/taskscheduler.h"
 #include "log.h"
 
 using namespace mu;
 using namespace mu::io;
+using namespace mu::async;
+
+template<typename T, typename Func>
+static Promise<T> runAsync(const CancellationPtr& cancellation, Func func)
+{
+    return Promise<T>([cancellation, func](auto resolve, auto reject) {
+        TaskScheduler::ioInstance()->push([cancellation, func, resolve, reject]() {
+            if (isCancelled(cancellation)) {
+                (void)reject(static_cast<int>(Ret::Code::Cancel), "cancelled");
+                return;
+            }
+
+            RetVal<T> result = func();
+
+            if (isCancelled(cancellation)) {
+                (void)reject(static_cast<int>(Ret::Code::Cancel), "cancelled");
+            } else if (!result.ret) {
+                (void)reject(result.ret.code(), result.ret.text());
+            } else {
+                (void)resolve(result.val);
+            }
+        });
+
+        return Promise<T>::Result::unchecked();
+    });
+}
 
 Ret FileSystem::exists(const io::path_t& path) const
 {
@@ -192,7 +219,28 @@ RetVal<uint64_t> FileSystem::fileSize(const io::path_t& path) const
     return rv;
 }
 
+Promise<ByteArray> FileSystem::readFileAsync(const io::path_t& filePath, const CancellationPtr& cancellation) const
+{
+    return runAsync<ByteArray>(cancellation, [this, filePath]() {
+        return readFile(filePath);
+    });
+}
+
 RetVal<io::paths_t> FileSystem::scanFiles(const io::path_t& rootDir, const std::vector<std::string>& nameFilters, ScanMode mode) const
+{
+    return doScanFiles(rootDir, nameFilters, mode, nullptr);
+}
+
+Promise<io::paths_t> FileSystem::scanFilesAsync(const io::path_t& rootDir, const std::vector<std::string>& nameFilters, ScanMode mode,
+                                                const CancellationPtr& cancellation) const
+{
+    return runAsync<io::paths_t>(cancellation, [this, rootDir, nameFilters, mode, cancellation]() {
+        return doScanFiles(rootDir, nameFilters, mode, cancellation);
+    });
+}
+
+RetVal<io::paths_t> FileSystem::doScanFiles(const io::path_t& rootDir, const std::vector<std::string>& nameFilters, ScanMode mode,
+                                            const CancellationPtr& cancellation) const
 {
     RetVal<io::paths_t> result;
     Ret ret = exists(rootDir);
@@ -225,6 +273,11 @@ RetVal<io::paths_t> FileSystem::scanFiles(const io::path_t& rootDir, const std::
     QDirIterator it(rootDir.toQString(), qnameFilters, filters, flags);
 
     while (it.hasNext()) {
+        if (isCancelled(cancellation)) {
+            result.ret = make_ret(Ret::Code::Cancel);
+            return result;
+        }
+
         result.val.push_back(it.next());
     }
 
@@ -45,6 +45,12 @@ public:
     bool readFile(const io::path_t& filePath, ByteArray& data) const override;
     Ret writeFile(const io::path_t& filePath, const ByteArray& data) const override;
 
+    async::Promise<io::paths_t> scanFilesAsync(const io::path_t& rootDir, const std::vector<std::string>& filters,
+                                               ScanMode mode = ScanMode::FilesInCurrentDirAndSubdirs,
+                                               const async::CancellationPtr& cancellation = nullptr) const override;
+    async::Promise<ByteArray> readFileAsync(const io::path_t& filePath,
+                                            const async::CancellationPtr& cancellation = nullptr) const override;
+
     void setAttribute(const io::path_t& path, Attribute attribute) const override;
     bool setPermissionsAllowedForAll(const io::path_t& path) const override;
 
@@ -56,6 +62,9 @@ public:
     bool isWritable(const path_t& filePath) const override;
 
 private:
+    RetVal<io::paths_t> doScanFiles(const io::path_t& rootDir, const std::vector<std::string>& filters, ScanMode mode,
+                                    const async::CancellationPtr& cancellation) const;
+
     Ret removeFile(const io::path_t& path) const;
     Ret removeDir(const io::path_t& path, bool recursively = true) const;
     Ret copyRecursively(const io::path_t& src, const io::path_t& dst) const;
@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mappedfile.h"
+
+#include <QFile>
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::io;
+
+MappedFile::MappedFile(const path_t& filePath)
+    : m_filePath(filePath)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+path_t MappedFile::filePath() const
+{
+    return m_filePath;
+}
+
+bool MappedFile::isMapped() const
+{
+    return m_mapped != nullptr;
+}
+
+bool MappedFile::doOpen(OpenMode m)
+{
+    if (m != OpenMode::ReadOnly) {
+        NOT_SUPPORTED;
+        return false;
+    }
+
+    unmap();
+
+    m_file = std::make_unique<QFile>(m_filePath.toQString());
+    if (m_file->open(QIODevice::ReadOnly)) {
+        m_size = static_cast<size_t>(m_file->size());
+        m_mapped = m_size > 0 ? m_file->map(0, m_file->size()) : nullptr;
+        if (m_mapped || m_size == 0) {
+            return true;
+        }
+    }
+
+    //! NOTE Mapping is not possible (e.g. some network or virtual file systems), read the whole file
+    LOGD() << "failed map file: " << m_filePath << ", reading it";
+    m_file.reset();
+    m_size = 0;
+    m_data = ByteArray();
+    return fileSystem()->readFile(m_filePath, m_data);
+}
+
+void MappedFile::unmap()
+{
+    if (m_file) {
+        if (m_mapped) {
+            m_file->unmap(const_cast<uchar*>(m_mapped));
+        }
+        m_file->close();
+        m_file.reset();
+    }
+
+    m_mapped = nullptr;
+    m_size = 0;
+    m_data = ByteArray();
+}
+
+size_t MappedFile::dataSize() const
+{
+    return m_file ? m_size : m_data.size();
+}
+
+const uint8_t* MappedFile::rawData() const
+{
+    return m_file ? m_mapped : m_data.constData();
+}
+
+bool MappedFile::resizeData(size_t)
+{
+    NOT_SUPPORTED;
+    return false;
+}
+
+size_t MappedFile::writeData(const uint8_t*, size_t)
+{
+    NOT_SUPPORTED;
+    return 0;
+}
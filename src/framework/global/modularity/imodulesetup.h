@@ -43,6 +43,12 @@ public:
 
     virtual void onPreInit(const framework::IApplication::RunMode& mode) { (void)mode; }
     virtual void onInit(const framework::IApplication::RunMode& mode) { (void)mode; }
+
+    //! NOTE Init work that only touches the module's own data (no settings, Qt objects or other modules).
+    //! It's run on a worker thread after the module's onInit, while the following modules are inited,
+    //! and is finished before onAllInited
+    virtual void onInitConcurrent(const framework::IApplication::RunMode& mode) { (void)mode; }
+
     virtual void onAllInited(const framework::IApplication::RunMode& mode) { (void)mode; }
     virtual void onDelayedInit() {}
     virtual void onDeinit() {}
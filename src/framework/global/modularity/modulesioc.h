@@ -25,6 +25,8 @@
 
 #include <memory>
 #include <map>
+#include <array>
+#include <mutex>
 #include <string>
 #include <cassert>
 #include <iostream>
@@ -44,7 +46,7 @@ public:
             assert(c);
             return;
         }
-        registerService(module, I::interfaceId(), std::shared_ptr<IModuleExportInterface>(), c);
+        registerService(module, serviceIndex<I>(), I::interfaceId(), std::shared_ptr<IModuleExportInterface>(), c);
     }
 
     template<class I>
@@ -74,13 +76,13 @@ public:
             assert(p);
             return;
         }
-        registerService(module, I::interfaceId(), std::static_pointer_cast<IModuleExportInterface>(p), nullptr);
+        registerService(module, serviceIndex<I>(), I::interfaceId(), std::static_pointer_cast<IModuleExportInterface>(p), nullptr);
     }
 
     template<class I>
     void unregisterExport(const std::string& /*module*/)
     {
-        unregisterService(I::interfaceId());
+        unregisterService(serviceIndex<I>());
     }
 
     template<class I>
@@ -94,7 +96,7 @@ public:
     template<class I>
     std::shared_ptr<I> resolve(const std::string& module)
     {
-        std::shared_ptr<IModuleExportInterface> p = doResolvePtrById(module, I::interfaceId());
+        std::shared_ptr<IModuleExportInterface> p = doResolvePtrByIndex(module, serviceIndex<I>());
 #ifdef DEBUG
         return std::dynamic_pointer_cast<I>(p);
 #else
@@ -105,7 +107,7 @@ public:
     template<class I>
     std::shared_ptr<I> resolveRequiredImport(const std::string& module)
     {
-        std::shared_ptr<IModuleExportInterface> p = doResolvePtrById(module, I::interfaceId());
+        std::shared_ptr<IModuleExportInterface> p = doResolvePtrByIndex(module, serviceIndex<I>());
         if (!p) {
             //LOGE() << "not found implementation for interface: " << I::interfaceId();
             assert(false);
@@ -119,46 +121,67 @@ public:
 
     void reset()
     {
-        m_map.clear();
+        m_services.fill(Service());
     }
 
 private:
 
+    //! NOTE The services are stored in a flat table, indexed by interface.
+    //! The index of an interface is looked up by its id only once (per binary), on the first use
+    static constexpr size_t MAX_SERVICES = 512;
+
     ModulesIoC() = default;
 
-    void unregisterService(const std::string& id)
+    template<class I>
+    static size_t serviceIndex()
+    {
+        static const size_t index = instance()->indexOf(I::interfaceId());
+        return index;
+    }
+
+    size_t indexOf(const std::string& id)
+    {
+        //! NOTE The first use of an interface may be on any thread
+        std::lock_guard lock(m_indexesMutex);
+
+        auto it = m_indexes.find(id);
+        if (it != m_indexes.end()) {
+            return it->second;
+        }
+
+        size_t index = m_indexes.size();
+        assert(index < MAX_SERVICES);
+        m_indexes.emplace(id, index);
+        return index;
+    }
+
+    void unregisterService(size_t index)
     {
-        m_map.erase(id);
+        m_services[index] = Service();
     }
 
     void registerService(const std::string& module,
+                         size_t index,
                          const std::string& id,
                          std::shared_ptr<IModuleExportInterface> p,
                          IModuleExportCreator* c)
     {
-        auto foundIt = m_map.find(id);
-        if (foundIt != m_map.end()) {
-            std::cout << module << ": double register:" << id << ", first register in" << m_map[id].sourceModule;
+        Service& inj = m_services[index];
+        if (inj.p || inj.c) {
+            std::cout << module << ": double register:" << id << ", first register in" << inj.sourceModule;
             assert(false);
             return;
         }
 
-        Service inj;
         inj.sourceModule = module;
         inj.c = c;
         inj.p = p;
-        m_map[id] = inj;
     }
 
-    std::shared_ptr<IModuleExportInterface> doResolvePtrById(const std::string& resolveModule, const std::string& id)
+    std::shared_ptr<IModuleExportInterface> doResolvePtrByIndex(const std::string& resolveModule, size_t index)
     {
         (void)(resolveModule); //! TODO add statistics collection / monitoring, who resolves what
-        auto it = m_map.find(id);
-        if (it == m_map.end()) {
-            return nullptr;
-        }
-
-        Service& inj = it->second;
+        Service& inj = m_services[index];
         if (inj.p) {
             return inj.p;
         }
@@ -176,7 +199,10 @@ private:
         std::shared_ptr<IModuleExportInterface> p;
     };
 
-    std::map<std::string, Service > m_map;
+    std::array<Service, MAX_SERVICES> m_services;
+
+    std::mutex m_indexesMutex;
+    std::map<std::string, size_t> m_indexes;
 };
 
 template<class T>
@@ -21,11 +21,14 @@
  */
 #include "zipcontainer.h"
 
+#include <algorithm>
 #include <ctime>
 #include <cstring>
+#include <limits>
 #include <zlib.h>
 
 #include "io/dir.h"
+#include "concurrency/taskscheduler.h"
 
 #include "log.h"
 
@@ -110,76 +113,122 @@ static void writeMSDosDate(uint8_t* dest, const std::tm& dt)
     }
 }
 
-static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+//! NOTE Inflates a raw deflate stream in one pass, straight into the result.
+//! The output is presized from the size stored in the zip header and only grows if that size is wrong.
+//! Stops after maxSize bytes of output, if the stream is longer
+static int inflate(ByteArray& dest, size_t expectedSize, const Bytef* source, size_t sourceLen,
+                   size_t maxSize = std::numeric_limits<size_t>::max())
 {
+    //! NOTE zlib counts in uInt, so the input is fed in chunks
+    static constexpr size_t CHUNK = 1 << 30;
+
     z_stream stream;
-    int err;
+    std::memset(&stream, 0, sizeof(stream));
 
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    if ((uLong)stream.avail_in != sourceLen) {
-        return Z_BUF_ERROR;
+    int err = inflateInit2(&stream, -MAX_WBITS);
+    if (err != Z_OK) {
+        return err;
     }
 
-    stream.next_out = dest;
-    stream.avail_out = (uInt) * destLen;
-    if ((uLong)stream.avail_out != *destLen) {
-        return Z_BUF_ERROR;
-    }
+    dest.resize(std::min(std::max(expectedSize, size_t(1)), maxSize));
 
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
+    size_t inPos = 0;
+    size_t outPos = 0;
+    do {
+        if (stream.avail_in == 0 && inPos < sourceLen) {
+            size_t len = std::min(sourceLen - inPos, CHUNK);
+            stream.next_in = const_cast<Bytef*>(source + inPos);
+            stream.avail_in = static_cast<uInt>(len);
+            inPos += len;
+        }
 
-    err = inflateInit2(&stream, -MAX_WBITS);
-    if (err != Z_OK) {
-        return err;
-    }
+        if (outPos == dest.size()) {
+            if (outPos >= maxSize) {
+                err = Z_STREAM_END;
+                break;
+            }
+            dest.resize(std::min(dest.size() * 2, maxSize));
+        }
 
-    err = inflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        inflateEnd(&stream);
-        if (err == Z_NEED_DICT || (err == Z_BUF_ERROR && stream.avail_in == 0)) {
-            return Z_DATA_ERROR;
+        size_t outLen = std::min(dest.size() - outPos, CHUNK);
+        stream.next_out = dest.data() + outPos;
+        stream.avail_out = static_cast<uInt>(outLen);
+
+        err = inflate(&stream, Z_NO_FLUSH);
+        outPos += outLen - stream.avail_out;
+
+        if (err == Z_BUF_ERROR && stream.avail_in == 0 && inPos == sourceLen) {
+            // out of input before the end of the stream
+            err = Z_DATA_ERROR;
+        } else if (err == Z_BUF_ERROR) {
+            err = Z_OK;
         }
-        return err;
+    } while (err == Z_OK);
+
+    inflateEnd(&stream);
+
+    if (err != Z_STREAM_END) {
+        return err == Z_NEED_DICT ? Z_DATA_ERROR : err;
     }
-    *destLen = stream.total_out;
 
-    err = inflateEnd(&stream);
-    return err;
+    dest.resize(outPos);
+    return Z_OK;
 }
 
-static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+struct DeflatedBlock {
+    ByteArray data;
+    uint crc = 0;
+    size_t size = 0;
+    int err = Z_OK;
+};
+
+//! NOTE Entries above this size are split into blocks that are compressed in parallel
+static constexpr size_t DEFLATE_BLOCK_SIZE = 1024 * 1024;
+static constexpr size_t DEFLATE_DICT_SIZE = 32 * 1024;
+
+//! NOTE Compresses [offset, offset + len) of source as a part of one raw deflate stream.
+//! Like pigz does, a block is primed with the preceding 32 KB of input,
+//! and all but the last block end with a sync flush instead of a final block,
+//! so the blocks of an entry just have to be concatenated.
+static DeflatedBlock deflateBlock(const ByteArray& source, size_t offset, size_t len, bool last)
 {
+    DeflatedBlock block;
+    block.size = len;
+
+    const Bytef* in = source.constData() + offset;
+    block.crc = ::crc32(::crc32(0, nullptr, 0), in, static_cast<uInt>(len));
+
     z_stream stream;
-    int err;
+    std::memset(&stream, 0, sizeof(stream));
 
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    stream.next_out = dest;
-    stream.avail_out = (uInt) * destLen;
-    if ((uLong)stream.avail_out != *destLen) {
-        return Z_BUF_ERROR;
+    block.err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (block.err != Z_OK) {
+        return block;
     }
 
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
-    stream.opaque = (voidpf)0;
-
-    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
-    if (err != Z_OK) {
-        return err;
+    if (offset > 0) {
+        size_t dictSize = std::min(offset, DEFLATE_DICT_SIZE);
+        deflateSetDictionary(&stream, in - dictSize, static_cast<uInt>(dictSize));
     }
 
-    err = deflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        deflateEnd(&stream);
-        return err == Z_OK ? Z_BUF_ERROR : err;
+    // room for the sync flush marker
+    block.data.resize(deflateBound(&stream, static_cast<uLong>(len)) + 16);
+
+    stream.next_in = const_cast<Bytef*>(in);
+    stream.avail_in = static_cast<uInt>(len);
+    stream.next_out = block.data.data();
+    stream.avail_out = static_cast<uInt>(block.data.size());
+
+    block.err = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+    if (block.err == (last ? Z_STREAM_END : Z_OK) && stream.avail_in == 0) {
+        block.err = Z_OK;
+        block.data.resize(stream.total_out);
+    } else if (block.err == Z_OK || block.err == Z_STREAM_END) {
+        block.err = Z_BUF_ERROR;
     }
-    *destLen = stream.total_out;
 
-    err = deflateEnd(&stream);
-    return err;
+    deflateEnd(&stream);
+    return block;
 }
 
 namespace WindowsFileAttributes {
@@ -384,17 +433,51 @@ struct ZipContainer::Impl {
         Directory, File, Symlink
     };
 
+    struct PendingEntry {
+        EntryType type = File;
+        std::string fileName;
+        ByteArray contents;
+        std::tm time;
+        bool compress = false;
+        std::vector<std::future<DeflatedBlock> > blocks;
+
+        //! NOTE Copied from another archive as it's stored there
+        bool reused = false;
+        ByteArray reusedData;
+        uint reusedCrc = 0;
+    };
+
+    //! NOTE Entries are compressed on the task scheduler and written in order of adding
+    std::vector<PendingEntry> pendingEntries;
+
     void addEntry(EntryType type, const std::string& fileName, const ByteArray& contents);
+    void writePendingEntries();
+    void writeEntry(EntryType type, const std::string& fileName, const ByteArray& contents, const ByteArray& data, uint crc_32,
+                    bool compressed, const std::tm& time);
 
     Impl(IODevice* d)
         : device(d) {}
 
     void scanFiles();
     ZipContainer::FileInfo fillFileInfo(int index) const;
+
+    struct EntryData {
+        int compressionMethod = 0;
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        ByteArray storage; // if the device doesn't keep its data in memory
+    };
+
+    int findFile(const std::string& fileName) const;
+    bool readEntryData(int index, EntryData& entry) const;
+    static ByteArray uncompress(const EntryData& entry, size_t uncompressedSize,
+                                size_t maxSize = std::numeric_limits<size_t>::max());
 };
 
 void ZipContainer::Impl::scanFiles()
 {
+    writePendingEntries();
+
     if (!dirtyFileTree) {
         return;
     }
@@ -545,13 +628,104 @@ ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(int index) const
     return fileInfo;
 }
 
+int ZipContainer::Impl::findFile(const std::string& fileName) const
+{
+    const ByteArray name = ByteArray::fromRawData(fileName.c_str(), fileName.size());
+    for (size_t i = 0; i < fileHeaders.size(); ++i) {
+        if (fileHeaders.at(i).file_name == name) {
+            return static_cast<int>(i);
+        }
+    }
+
+    return -1;
+}
+
+bool ZipContainer::Impl::readEntryData(int index, EntryData& entry) const
+{
+    const FileHeader& header = fileHeaders.at(index);
+
+    ushort version_needed = readUShort(header.h.version_needed);
+    if (version_needed > ZIP_VERSION) {
+        LOGW("Zip: .ZIP specification version %d implementationis needed to extract the data.", version_needed);
+        return false;
+    }
+
+    ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
+    size_t compressed_size = readUInt(header.h.compressed_size);
+    size_t start = readUInt(header.h.offset_local_header);
+
+    //! NOTE If the device keeps its data in memory (e.g. a mapped file), the entry is read directly from there.
+    //! This path does not move the device position, so it may be used from several threads, see isConcurrentReadSupported
+    const uint8_t* raw = device->readData();
+    const size_t deviceSize = device->size();
+
+    LocalFileHeader lh;
+    size_t dataPos = 0;
+    if (raw && start + sizeof(LocalFileHeader) <= deviceSize) {
+        std::memcpy(&lh, raw + start, sizeof(LocalFileHeader));
+        dataPos = start + sizeof(LocalFileHeader) + readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
+    } else {
+        device->seek(start);
+        device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
+        uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
+        device->seek(device->pos() + skip);
+        dataPos = device->pos();
+    }
+
+    entry.compressionMethod = readUShort(lh.compression_method);
+
+    if ((general_purpose_bits & Encrypted) != 0) {
+        LOGW("Zip: Unsupported encryption method is needed to extract the data.");
+        return false;
+    }
+
+    if (raw && dataPos + compressed_size <= deviceSize) {
+        entry.data = raw + dataPos;
+        entry.size = compressed_size;
+    } else {
+        device->seek(dataPos);
+        entry.storage = device->read(compressed_size);
+        entry.data = entry.storage.constData();
+        entry.size = entry.storage.size();
+    }
+
+    return true;
+}
+
+ByteArray ZipContainer::Impl::uncompress(const EntryData& entry, size_t uncompressedSize, size_t maxSize)
+{
+    if (entry.compressionMethod == CompressionMethodStored) {
+        // no compression
+        return ByteArray(entry.data, std::min({ entry.size, uncompressedSize, maxSize }));
+    } else if (entry.compressionMethod == CompressionMethodDeflated) {
+        // Deflate
+        ByteArray baunzip;
+        int res = inflate(baunzip, uncompressedSize, entry.data, entry.size, maxSize);
+        switch (res) {
+        case Z_OK:
+            break;
+        case Z_MEM_ERROR:
+            LOGW("Zip: Z_MEM_ERROR: Not enough memory");
+            baunzip.clear();
+            break;
+        default:
+            LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
+            baunzip.clear();
+            break;
+        }
+        return baunzip;
+    }
+
+    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", entry.compressionMethod);
+    return ByteArray();
+}
+
 void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, const ByteArray& contents)
 {
     if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
         status = ZipContainer::FileOpenError;
         return;
     }
-    device->seek(start_of_directory);
 
     // don't compress small files
     ZipContainer::CompressionPolicy compression = compressionPolicy;
@@ -563,6 +737,86 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         }
     }
 
+    PendingEntry entry;
+    entry.type = type;
+    entry.fileName = fileName;
+    entry.compress = compression == ZipContainer::AlwaysCompress;
+
+    std::time_t t = std::time(0);   // get time now
+    entry.time = *std::localtime(&t);
+
+    // the caller may release raw data right after adding it
+    entry.contents = contents.isRawData() ? ByteArray(contents.constData(), contents.size()) : contents;
+
+    if (entry.compress) {
+        TaskScheduler* scheduler = TaskScheduler::instance();
+        const bool async = !scheduler->containsThread(std::this_thread::get_id());
+
+        const ByteArray& source = entry.contents;
+        const size_t size = source.size();
+        const size_t blockSize = size > 2 * DEFLATE_BLOCK_SIZE ? DEFLATE_BLOCK_SIZE : size;
+
+        size_t offset = 0;
+        do {
+            const size_t len = std::min(blockSize, size - offset);
+            const bool last = offset + len == size;
+
+            if (async) {
+                entry.blocks.push_back(scheduler->submit(deflateBlock, source, offset, len, last));
+            } else {
+                std::promise<DeflatedBlock> block;
+                block.set_value(deflateBlock(source, offset, len, last));
+                entry.blocks.push_back(block.get_future());
+            }
+
+            offset += len;
+        } while (offset < size);
+    }
+
+    pendingEntries.push_back(std::move(entry));
+}
+
+void ZipContainer::Impl::writePendingEntries()
+{
+    std::vector<PendingEntry> entries = std::move(pendingEntries);
+    pendingEntries.clear();
+
+    for (PendingEntry& entry : entries) {
+        if (entry.reused) {
+            writeEntry(entry.type, entry.fileName, entry.contents, entry.reusedData, entry.reusedCrc, entry.compress, entry.time);
+            continue;
+        }
+
+        ByteArray data;
+        uint crc_32 = ::crc32(0, 0, 0);
+        bool compressed = entry.compress;
+
+        for (std::future<DeflatedBlock>& future : entry.blocks) {
+            DeflatedBlock block = future.get();
+            if (block.err != Z_OK) {
+                LOGW() << "Zip: failed to compress " << entry.fileName << ", error: " << block.err << ", storing it uncompressed";
+                compressed = false;
+                continue;
+            }
+
+            data.push_back(block.data);
+            crc_32 = ::crc32_combine(crc_32, block.crc, static_cast<z_off_t>(block.size));
+        }
+
+        if (!compressed) {
+            data = entry.contents;
+            crc_32 = ::crc32(::crc32(0, 0, 0), entry.contents.constData(), (uint)entry.contents.size());
+        }
+
+        writeEntry(entry.type, entry.fileName, entry.contents, data, crc_32, compressed, entry.time);
+    }
+}
+
+void ZipContainer::Impl::writeEntry(EntryType type, const std::string& fileName, const ByteArray& contents, const ByteArray& data,
+                                    uint crc_32, bool compressed, const std::tm& time)
+{
+    device->seek(start_of_directory);
+
     FileHeader header;
     std::memset(&header.h, 0, sizeof(CentralFileHeader));
     writeUInt(header.h.signature, 0x02014b50);
@@ -570,39 +824,12 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     writeUShort(header.h.version_needed, ZIP_VERSION);
     writeUInt(header.h.uncompressed_size, (uint)contents.size());
 
-    std::time_t t = std::time(0);   // get time now
-    std::tm* now = std::localtime(&t);
-    writeMSDosDate(header.h.last_mod_file, *now);
-    ByteArray data = contents;
-    if (compression == ZipContainer::AlwaysCompress) {
+    writeMSDosDate(header.h.last_mod_file, time);
+    if (compressed) {
         writeUShort(header.h.compression_method, CompressionMethodDeflated);
-
-        ulong len = (ulong)contents.size();
-        // shamelessly copied form zlib
-        len += (len >> 12) + (len >> 14) + 11;
-        int res;
-        do {
-            data.resize(len);
-            res = deflate((uint8_t*)data.data(), &len, (const uint8_t*)contents.constData(), (ulong)contents.size());
-
-            switch (res) {
-            case Z_OK:
-                data.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                LOGW("Zip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
-                data.resize(0);
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
     }
-// TODO add a check if data.size() > contents.size().  Then try to store the original and revert the compression method to be uncompressed
+
     writeUInt(header.h.compressed_size, (uint)data.size());
-    uint crc_32 = ::crc32(0, 0, 0);
-    crc_32 = ::crc32(crc_32, (const uint8_t*)contents.constData(), (uint)contents.size());
     writeUInt(header.h.crc_32, crc_32);
 
     // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
@@ -687,82 +914,40 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
 {
     p->scanFiles();
 
-    size_t i;
-    for (i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == ByteArray::fromRawData(fileName.c_str(), fileName.size())) {
-            break;
-        }
-    }
-
-    if (i == p->fileHeaders.size()) {
+    int index = p->findFile(fileName);
+    if (index < 0) {
         return ByteArray();
     }
 
-    FileHeader header = p->fileHeaders.at(i);
-
-    ushort version_needed = readUShort(header.h.version_needed);
-    if (version_needed > ZIP_VERSION) {
-        LOGW("Zip: .ZIP specification version %d implementationis needed to extract the data.", version_needed);
+    Impl::EntryData entry;
+    if (!p->readEntryData(index, entry)) {
         return ByteArray();
     }
 
-    ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
-    int compressed_size = readUInt(header.h.compressed_size);
-    int uncompressed_size = readUInt(header.h.uncompressed_size);
-    int start = readUInt(header.h.offset_local_header);
-
-    p->device->seek(start);
-    LocalFileHeader lh;
-    p->device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
-    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
-    p->device->seek(p->device->pos() + skip);
+    return Impl::uncompress(entry, readUInt(p->fileHeaders.at(index).h.uncompressed_size));
+}
 
-    int compression_method = readUShort(lh.compression_method);
+ByteArray ZipContainer::fileDataHead(const std::string& fileName, size_t maxSize) const
+{
+    p->scanFiles();
 
-    if ((general_purpose_bits & Encrypted) != 0) {
-        LOGW("Zip: Unsupported encryption method is needed to extract the data.");
+    int index = p->findFile(fileName);
+    if (index < 0) {
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
-    if (compression_method == CompressionMethodStored) {
-        // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
-    } else if (compression_method == CompressionMethodDeflated) {
-        // Deflate
-        //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
-        ByteArray baunzip;
-        ulong len = std::max(uncompressed_size,  1);
-        int res;
-        do {
-            baunzip.resize(len);
-            res = inflate((uint8_t*)baunzip.data(), &len,
-                          (const uint8_t*)compressed.constData(), compressed_size);
-
-            switch (res) {
-            case Z_OK:
-                if ((size_t)len != baunzip.size()) {
-                    baunzip.resize(len);
-                }
-                break;
-            case Z_MEM_ERROR:
-                LOGW("Zip: Z_MEM_ERROR: Not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            case Z_DATA_ERROR:
-                LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
-        return baunzip;
+    Impl::EntryData entry;
+    if (!p->readEntryData(index, entry)) {
+        return ByteArray();
     }
 
-    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", compression_method);
-    return ByteArray();
+    return Impl::uncompress(entry, readUInt(p->fileHeaders.at(index).h.uncompressed_size), maxSize);
+}
+
+bool ZipContainer::isConcurrentReadSupported() const
+{
+    p->scanFiles();
+    return p->status == NoError && p->device->openMode() == IODevice::ReadOnly && p->device->readData() != nullptr;
 }
 
 ZipContainer::Status ZipContainer::status() const
@@ -785,6 +970,63 @@ void ZipContainer::addFile(const std::string& fileName, const ByteArray& data)
     p->addEntry(Impl::File, Dir::fromNativeSeparators(fileName).toStdString(), data);
 }
 
+bool ZipContainer::addFileFrom(const ZipContainer& source, const std::string& fileName, const ByteArray& data)
+{
+    source.p->scanFiles();
+
+    const std::string name = Dir::fromNativeSeparators(fileName).toStdString();
+    int index = source.p->findFile(name);
+    if (index < 0) {
+        return false;
+    }
+
+    const CentralFileHeader& h = source.p->fileHeaders.at(index).h;
+    if (readUInt(h.uncompressed_size) != data.size()) {
+        return false;
+    }
+
+    uint crc_32 = ::crc32(::crc32(0, 0, 0), data.constData(), (uint)data.size());
+    if (readUInt(h.crc_32) != crc_32) {
+        return false;
+    }
+
+    Impl::EntryData entry;
+    if (!source.p->readEntryData(index, entry)) {
+        return false;
+    }
+
+    if (entry.compressionMethod != CompressionMethodStored && entry.compressionMethod != CompressionMethodDeflated) {
+        return false;
+    }
+
+    //! NOTE Matching sizes and CRC are not a proof, so check the content itself,
+    //! inflating is still much cheaper than deflating
+    if (Impl::uncompress(entry, data.size()) != data) {
+        return false;
+    }
+
+    if (!(p->device->isOpen() || p->device->open(IODevice::WriteOnly))) {
+        p->status = ZipContainer::FileOpenError;
+        return false;
+    }
+
+    Impl::PendingEntry pending;
+    pending.type = Impl::File;
+    pending.fileName = name;
+    pending.contents = data;
+    pending.compress = entry.compressionMethod == CompressionMethodDeflated;
+    pending.reused = true;
+    pending.reusedData = ByteArray(entry.data, entry.size);
+    pending.reusedCrc = crc_32;
+
+    std::time_t t = std::time(0);   // get time now
+    pending.time = *std::localtime(&t);
+
+    p->pendingEntries.push_back(std::move(pending));
+
+    return true;
+}
+
 void ZipContainer::addDirectory(const std::string& dirName)
 {
     std::string name(Dir::fromNativeSeparators(dirName).toStdString());
@@ -802,6 +1044,8 @@ void ZipContainer::close()
         return;
     }
 
+    p->writePendingEntries();
+
     //qDebug("Zip::close writing directory, %d entries", p->fileHeaders.size());
     p->device->seek(p->start_of_directory);
     // write new directory
@@ -64,6 +64,12 @@ public:
 
     ByteArray fileData(const std::string& fileName) const;
 
+    //! NOTE Inflates only the first maxSize bytes of the file
+    ByteArray fileDataHead(const std::string& fileName, size_t maxSize) const;
+
+    //! NOTE If true, fileData may be called from several threads at once
+    bool isConcurrentReadSupported() const;
+
     // Write
     enum CompressionPolicy {
         AlwaysCompress,
@@ -75,6 +81,10 @@ public:
     CompressionPolicy compressionPolicy() const;
 
     void addFile(const std::string& fileName, const ByteArray& data);
+
+    //! NOTE Adds the entry of source as it's stored there, without compressing it again,
+    //! if it holds exactly the given data. Otherwise adds nothing and returns false
+    bool addFileFrom(const ZipContainer& source, const std::string& fileName, const ByteArray& data);
     void addDirectory(const std::string& dirName);
 
 private:
@@ -32,21 +32,53 @@
 
 using namespace mu;
 
+//! NOTE The values read from an object or an array are views into the tree of their parent,
+//! so reading a document does not copy its subtrees. A view is copied on the first change (see detachData),
+//! and a parent that is changed while viewed is copied before that by its own detach
 struct mu::JsonData
 {
     picojson::value val;
+
+    std::shared_ptr<const JsonData> owner;
+    const picojson::value* view = nullptr;
+
+    const picojson::value& value() const { return view ? *view : val; }
 };
 
 static inline const picojson::value& val_const(const std::shared_ptr<JsonData>& d)
 {
-    return d->val;
+    return d->value();
 }
 
 static inline picojson::value& val_mut(std::shared_ptr<JsonData>& d)
 {
+    assert(!d->view);
     return d->val;
 }
 
+static inline std::shared_ptr<JsonData> makeView(const std::shared_ptr<JsonData>& owner, const picojson::value& val)
+{
+    std::shared_ptr<JsonData> d = std::make_shared<JsonData>();
+    d->owner = owner;
+    d->view = &val;
+    return d;
+}
+
+static inline void detachData(std::shared_ptr<JsonData>& d)
+{
+    if (!d) {
+        return;
+    }
+
+    if (d.use_count() == 1 && !d->view) {
+        return;
+    }
+
+    std::shared_ptr<JsonData> copy = std::make_shared<JsonData>();
+    copy->val = d->value();
+    d = copy;
+}
+
 // =======================================
 // JsonValue
 // =======================================
@@ -97,15 +129,7 @@ JsonValue::JsonValue(std::shared_ptr<JsonData> d)
 
 void JsonValue::detach()
 {
-    if (!m_data) {
-        return;
-    }
-
-    if (m_data.use_count() == 1) {
-        return;
-    }
-
-    m_data = std::make_shared<JsonData>(*m_data);
+    detachData(m_data);
 }
 
 bool JsonValue::isNull() const
@@ -360,12 +384,12 @@ JsonValueRef& JsonValueRef::operator=(const JsonObject& v)
 
 static inline const picojson::array& array_const(const std::shared_ptr<JsonData>& d)
 {
-    return d->val.get<picojson::array>();
+    return val_const(d).get<picojson::array>();
 }
 
 static inline picojson::array& array_mut(std::shared_ptr<JsonData>& d)
 {
-    return d->val.get<picojson::array>();
+    return val_mut(d).get<picojson::array>();
 }
 
 JsonArray::JsonArray(std::shared_ptr<JsonData> d)
@@ -384,21 +408,13 @@ JsonArray::JsonArray(std::initializer_list<JsonValue> args)
 
     array_mut(m_data).reserve(args.size());
     for (const JsonValue& v : args) {
-        array_mut(m_data).push_back(v.m_data->val);
+        array_mut(m_data).push_back(v.m_data->value());
     }
 }
 
 void JsonArray::detach()
 {
-    if (!m_data) {
-        return;
-    }
-
-    if (m_data.use_count() == 1) {
-        return;
-    }
-
-    m_data = std::make_shared<JsonData>(*m_data);
+    detachData(m_data);
 }
 
 size_t JsonArray::size() const
@@ -414,9 +430,7 @@ void JsonArray::resize(size_t i)
 
 JsonValue JsonArray::at(size_t i) const
 {
-    std::shared_ptr<JsonData> d = std::make_shared<JsonData>();
-    d->val = array_const(m_data).at(i);
-    return JsonValue(d);
+    return JsonValue(makeView(m_data, array_const(m_data).at(i)));
 }
 
 JsonArray& JsonArray::set(size_t i, bool v)
@@ -464,21 +478,21 @@ JsonArray& JsonArray::set(size_t i, const char* str)
 JsonArray& JsonArray::set(size_t i, const JsonValue& v)
 {
     detach();
-    array_mut(m_data)[i] = v.m_data->val;
+    array_mut(m_data)[i] = v.m_data->value();
     return *this;
 }
 
 JsonArray& JsonArray::set(size_t i, const JsonArray& v)
 {
     detach();
-    array_mut(m_data)[i] = v.m_data->val;
+    array_mut(m_data)[i] = v.m_data->value();
     return *this;
 }
 
 JsonArray& JsonArray::set(size_t i, const JsonObject& v)
 {
     detach();
-    array_mut(m_data)[i] = v.m_data->val;
+    array_mut(m_data)[i] = v.m_data->value();
     return *this;
 }
 
@@ -560,12 +574,12 @@ JsonValueRef JsonArray::operator [](size_t i)
 // =======================================
 static const picojson::object& object_const(const std::shared_ptr<JsonData>& d)
 {
-    return d->val.get<picojson::object>();
+    return val_const(d).get<picojson::object>();
 }
 
 static picojson::object& object_mut(std::shared_ptr<JsonData>& d)
 {
-    return d->val.get<picojson::object>();
+    return val_mut(d).get<picojson::object>();
 }
 
 JsonObject::JsonObject(std::shared_ptr<JsonData> d)
@@ -579,15 +593,7 @@ JsonObject::JsonObject(std::shared_ptr<JsonData> d)
 
 void JsonObject::detach()
 {
-    if (!m_data) {
-        return;
-    }
-
-    if (m_data.use_count() == 1) {
-        return;
-    }
-
-    m_data = std::make_shared<JsonData>(*m_data);
+    detachData(m_data);
 }
 
 bool JsonObject::isValid() const
@@ -616,9 +622,7 @@ JsonValue JsonObject::value(const std::string& key) const
     const picojson::object& o = object_const(m_data);
     auto it = o.find(key);
     if (it != o.cend()) {
-        std::shared_ptr<JsonData> d = std::make_shared<JsonData>();
-        d->val = it->second;
-        return JsonValue(d);
+        return JsonValue(makeView(m_data, it->second));
     }
     return JsonValue();
 }
@@ -668,21 +672,21 @@ JsonObject& JsonObject::set(const std::string& key, const String& str)
 JsonObject& JsonObject::set(const std::string& key, const JsonValue& v)
 {
     detach();
-    object_mut(m_data).insert_or_assign(key, v.m_data->val);
+    object_mut(m_data).insert_or_assign(key, v.m_data->value());
     return *this;
 }
 
 JsonObject& JsonObject::set(const std::string& key, const JsonArray& v)
 {
     detach();
-    object_mut(m_data).insert_or_assign(key, v.m_data->val);
+    object_mut(m_data).insert_or_assign(key, v.m_data->value());
     return *this;
 }
 
 JsonObject& JsonObject::set(const std::string& key, const JsonObject& v)
 {
     detach();
-    object_mut(m_data).insert_or_assign(key, v.m_data->val);
+    object_mut(m_data).insert_or_assign(key, v.m_data->value());
     return *this;
 }
 
@@ -721,7 +725,7 @@ JsonDocument::JsonDocument(JsonObject o)
 
 ByteArray JsonDocument::toJson(Format format) const
 {
-    std::string json = m_data->val.serialize(format == Format::Indented);
+    std::string json = m_data->value().serialize(format == Format::Indented);
     return ByteArray(json.c_str(), json.size());
 }
 
@@ -741,12 +745,12 @@ JsonDocument JsonDocument::fromJson(const ByteArray& ba, std::string* err)
 
 bool JsonDocument::isObject() const
 {
-    return m_data->val.is<picojson::object>();
+    return m_data->value().is<picojson::object>();
 }
 
 bool JsonDocument::isArray() const
 {
-    return m_data->val.is<picojson::array>();
+    return m_data->value().is<picojson::array>();
 }
 
 JsonObject JsonDocument::rootObject() const
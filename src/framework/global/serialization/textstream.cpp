@@ -20,6 +20,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "textstream.h"
+
+#include <charconv>
 #include <sstream>
 
 using namespace mu;
@@ -55,59 +57,65 @@ TextStream& TextStream::operator<<(char ch)
     return *this;
 }
 
+template<typename T>
+static inline void writeNumber(TextStream& stream, T val)
+{
+    char buf[24];
+    std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), val);
+    stream << AsciiStringView(buf, res.ptr - buf);
+}
+
 TextStream& TextStream::operator<<(int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeNumber(*this, val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeNumber(*this, val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(double val)
 {
-    std::stringstream ss;
+    //! NOTE The same as the default formatting of std::ostream (%g, precision 6),
+    //! but without creating a stream and a locale for every number
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    char buf[32];
+    std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), val, std::chars_format::general, 6);
+    write(buf, res.ptr - buf);
+#else
+    thread_local std::ostringstream ss;
+    ss.str(std::string());
     ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    const std::string str = ss.str();
+    write(str.c_str(), str.size());
+#endif
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeNumber(*this, val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeNumber(*this, val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeNumber(*this, val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeNumber(*this, val);
     return *this;
 }
 
@@ -147,8 +155,10 @@ TextStream& TextStream::operator<<(const AsciiStringView& s)
 
 TextStream& TextStream::operator<<(const String& s)
 {
-    ByteArray b = s.toUtf8();
-    write(reinterpret_cast<const char*>(b.constData()), b.size());
+    s.appendUtf8To(m_buf);
+    if (m_device && m_buf.size() > TEXTSTREAM_BUFFERSIZE) {
+        flush();
+    }
     return *this;
 }
 
@@ -21,23 +21,444 @@
  */
 #include "xmlstreamreader.h"
 
+#include <cctype>
 #include <cstring>
 
-#include "thirdparty/tinyxml/tinyxml2.h"
-
 #include "log.h"
 
 using namespace mu;
 using namespace mu::io;
-using namespace tinyxml2;
 
-struct XmlStreamReader::Xml {
-    XMLDocument doc;
-    XMLNode* node = nullptr;
-    XMLError err;
+//! NOTE The reader parses incrementally, token by token, directly in its own copy of the input.
+//! Like tinyxml2 did, names, values and texts are terminated and decoded in place,
+//! so every view handed out points into that buffer and stays valid for the reader's lifetime,
+//! but no document tree is ever built.
+namespace {
+struct ParseState {
+    struct AttrRange {
+        char* name = nullptr;
+        char* nameEnd = nullptr;
+        char* value = nullptr;
+        char* valueEnd = nullptr;
+    };
+
+    ByteArray buffer;
+    char* pos = nullptr;
+    char* end = nullptr;
+    bool tagOpened = false; // '<' of the next tag was overwritten by the terminator of the preceding text
+    bool selfClosing = false;
+    bool hasNodes = false;
+    int64_t line = 1;
+
+    AsciiStringView name;
+    const char* value = nullptr;
+    std::vector<std::pair<AsciiStringView, AsciiStringView> > attributes;
+    std::vector<AsciiStringView> openElements;
+    std::vector<AttrRange> ranges;
+
+    XmlStreamReader::Error err = XmlStreamReader::NoError;
+    String errStr;
+};
+}
+
+struct XmlStreamReader::Xml : public ParseState {
     String customErr;
 };
 
+static inline bool isWhiteSpaceChar(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+static inline bool isNameStartChar(char c)
+{
+    return static_cast<unsigned char>(c) >= 128 || std::isalpha(static_cast<unsigned char>(c)) || c == ':' || c == '_';
+}
+
+static inline bool isNameChar(char c)
+{
+    return isNameStartChar(c) || std::isdigit(static_cast<unsigned char>(c)) || c == '.' || c == '-';
+}
+
+static inline bool startsWith(const char* p, const char* end, const char* prefix, size_t len)
+{
+    return static_cast<size_t>(end - p) >= len && std::memcmp(p, prefix, len) == 0;
+}
+
+static size_t encodeUtf8(uint32_t ch, char* out)
+{
+    if (ch < 0x80) {
+        out[0] = static_cast<char>(ch);
+        return 1;
+    } else if (ch < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (ch >> 6));
+        out[1] = static_cast<char>(0x80 | (ch & 0x3F));
+        return 2;
+    } else if (ch < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (ch >> 12));
+        out[1] = static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (ch & 0x3F));
+        return 3;
+    } else if (ch < 0x110000) {
+        out[0] = static_cast<char>(0xF0 | (ch >> 18));
+        out[1] = static_cast<char>(0x80 | ((ch >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (ch & 0x3F));
+        return 4;
+    }
+    return 0;
+}
+
+//! NOTE Decodes a numeric character reference (&#123; or &#x7b;) starting at p.
+//! Returns the position after ';', or nullptr if it is malformed.
+static const char* decodeCharRef(const char* p, const char* end, char* out, size_t* outLen)
+{
+    const char* c = p + 2;
+    int base = 10;
+    if (c < end && *c == 'x') {
+        base = 16;
+        ++c;
+    }
+
+    uint32_t ch = 0;
+    const char* digits = c;
+    while (c < end && *c != ';') {
+        int d = -1;
+        if (*c >= '0' && *c <= '9') {
+            d = *c - '0';
+        } else if (base == 16 && *c >= 'a' && *c <= 'f') {
+            d = *c - 'a' + 10;
+        } else if (base == 16 && *c >= 'A' && *c <= 'F') {
+            d = *c - 'A' + 10;
+        }
+        if (d < 0 || ch > 0x10FFFF) {
+            return nullptr;
+        }
+        ch = ch * base + d;
+        ++c;
+    }
+
+    if (c == end || c == digits) {
+        return nullptr;
+    }
+
+    *outLen = encodeUtf8(ch, out);
+    return *outLen ? c + 1 : nullptr;
+}
+
+//! NOTE Decodes [start, end) in place and terminates it.
+//! Decoded data is never longer than its source, so this never writes past end.
+static char* decodeInPlace(char* start, char* end, bool processEntities)
+{
+    struct Entity {
+        const char* pattern;
+        size_t length;
+        char value;
+    };
+
+    static const Entity ENTITIES[] = {
+        { "quot", 4, '\"' },
+        { "amp", 3, '&' },
+        { "apos", 4, '\'' },
+        { "lt", 2, '<' },
+        { "gt", 2, '>' }
+    };
+
+    const char* p = start;
+    char* q = start;
+    while (p < end) {
+        if (*p == '\r') {
+            // CR-LF and CR alone become LF
+            p += (p + 1 < end && p[1] == '\n') ? 2 : 1;
+            *q++ = '\n';
+        } else if (processEntities && *p == '&') {
+            bool decoded = false;
+            if (p + 1 < end && p[1] == '#') {
+                char buf[4];
+                size_t len = 0;
+                const char* next = decodeCharRef(p, end, buf, &len);
+                if (next) {
+                    std::memcpy(q, buf, len);
+                    q += len;
+                    p = next;
+                    decoded = true;
+                }
+            } else {
+                for (const Entity& entity : ENTITIES) {
+                    if (static_cast<size_t>(end - p) > entity.length + 1
+                        && std::strncmp(p + 1, entity.pattern, entity.length) == 0
+                        && p[entity.length + 1] == ';') {
+                        *q++ = entity.value;
+                        p += entity.length + 2;
+                        decoded = true;
+                        break;
+                    }
+                }
+            }
+
+            // unknown entities are kept as is, they may be declared in the DTD
+            if (!decoded) {
+                *q++ = *p++;
+            }
+        } else {
+            *q++ = *p++;
+        }
+    }
+    *q = 0;
+    return q;
+}
+
+static void setParseError(ParseState* xml, XmlStreamReader::Error err, const String& message)
+{
+    xml->err = err;
+    xml->errStr = String(u"%1, line %2").arg(message, String::number(xml->line));
+}
+
+static char* skipWhiteSpace(ParseState* xml, char* p)
+{
+    while (p < xml->end && isWhiteSpaceChar(*p)) {
+        if (*p == '\n') {
+            ++xml->line;
+        }
+        ++p;
+    }
+    return p;
+}
+
+//! NOTE Finds the terminator of a comment, declaration, dtd or cdata section, counting lines on the way
+static char* findSequence(ParseState* xml, char* p, const char* seq, size_t len)
+{
+    while (p < xml->end) {
+        if (*p == seq[0] && startsWith(p, xml->end, seq, len)) {
+            return p;
+        }
+        if (*p == '\n') {
+            ++xml->line;
+        }
+        ++p;
+    }
+    return nullptr;
+}
+
+static XmlStreamReader::TokenType readDelimited(ParseState* xml, size_t headerLen, const char* terminator, size_t terminatorLen,
+                                                XmlStreamReader::TokenType token)
+{
+    char* start = xml->pos + headerLen;
+    char* stop = findSequence(xml, start, terminator, terminatorLen);
+    if (!stop) {
+        setParseError(xml, XmlStreamReader::PrematureEndOfDocumentError, u"Unterminated markup");
+        return XmlStreamReader::Invalid;
+    }
+
+    xml->pos = stop + terminatorLen;
+    decodeInPlace(start, stop, false);
+    xml->value = start;
+    return token;
+}
+
+static XmlStreamReader::TokenType readStartElement(ParseState* xml)
+{
+    char* nameStart = xml->pos;
+    char* p = nameStart;
+    if (p == xml->end || !isNameStartChar(*p)) {
+        setParseError(xml, XmlStreamReader::NotWellFormedError, u"Invalid element name");
+        return XmlStreamReader::Invalid;
+    }
+    while (p < xml->end && isNameChar(*p)) {
+        ++p;
+    }
+    char* nameEnd = p;
+
+    //! NOTE Terminators are only written once the whole tag is scanned,
+    //! because they overwrite the delimiters the scan relies on
+    std::vector<ParseState::AttrRange>& ranges = xml->ranges;
+    ranges.clear();
+
+    bool selfClosing = false;
+    while (true) {
+        p = skipWhiteSpace(xml, p);
+        if (p == xml->end) {
+            setParseError(xml, XmlStreamReader::PrematureEndOfDocumentError, u"Unterminated element");
+            return XmlStreamReader::Invalid;
+        }
+
+        if (*p == '>') {
+            ++p;
+            break;
+        }
+
+        if (*p == '/' && p + 1 < xml->end && p[1] == '>') {
+            p += 2;
+            selfClosing = true;
+            break;
+        }
+
+        if (!isNameStartChar(*p)) {
+            setParseError(xml, XmlStreamReader::NotWellFormedError, u"Invalid attribute");
+            return XmlStreamReader::Invalid;
+        }
+
+        ParseState::AttrRange r;
+        r.name = p;
+        while (p < xml->end && isNameChar(*p)) {
+            ++p;
+        }
+        r.nameEnd = p;
+
+        p = skipWhiteSpace(xml, p);
+        if (p == xml->end || *p != '=') {
+            setParseError(xml, XmlStreamReader::NotWellFormedError, u"Invalid attribute");
+            return XmlStreamReader::Invalid;
+        }
+        p = skipWhiteSpace(xml, p + 1);
+        if (p == xml->end || (*p != '\"' && *p != '\'')) {
+            setParseError(xml, XmlStreamReader::NotWellFormedError, u"Invalid attribute value");
+            return XmlStreamReader::Invalid;
+        }
+
+        const char quote = *p++;
+        r.value = p;
+        while (p < xml->end && *p != quote) {
+            if (*p == '\n') {
+                ++xml->line;
+            }
+            ++p;
+        }
+        if (p == xml->end) {
+            setParseError(xml, XmlStreamReader::PrematureEndOfDocumentError, u"Unterminated attribute value");
+            return XmlStreamReader::Invalid;
+        }
+        r.valueEnd = p++;
+        ranges.push_back(r);
+    }
+
+    xml->pos = p;
+    xml->selfClosing = selfClosing;
+
+    *nameEnd = 0;
+    xml->name = AsciiStringView(nameStart, nameEnd - nameStart);
+
+    xml->attributes.clear();
+    for (const ParseState::AttrRange& r : ranges) {
+        *r.nameEnd = 0;
+        char* valueEnd = decodeInPlace(r.value, r.valueEnd, true);
+        xml->attributes.emplace_back(AsciiStringView(r.name, r.nameEnd - r.name), AsciiStringView(r.value, valueEnd - r.value));
+    }
+
+    xml->openElements.push_back(xml->name);
+    return XmlStreamReader::StartElement;
+}
+
+static XmlStreamReader::TokenType readEndElement(ParseState* xml)
+{
+    char* nameStart = xml->pos + 1;
+    char* p = nameStart;
+    while (p < xml->end && isNameChar(*p)) {
+        ++p;
+    }
+    AsciiStringView name(nameStart, p - nameStart);
+
+    p = skipWhiteSpace(xml, p);
+    if (p == xml->end || *p != '>') {
+        setParseError(xml, XmlStreamReader::NotWellFormedError, u"Invalid end element");
+        return XmlStreamReader::Invalid;
+    }
+
+    if (xml->openElements.empty() || xml->openElements.back() != name) {
+        setParseError(xml, XmlStreamReader::NotWellFormedError, u"Mismatched element");
+        return XmlStreamReader::Invalid;
+    }
+
+    xml->pos = p + 1;
+    xml->name = xml->openElements.back();
+    xml->openElements.pop_back();
+    return XmlStreamReader::EndElement;
+}
+
+static XmlStreamReader::TokenType parseNext(ParseState* xml)
+{
+    xml->name = AsciiStringView();
+    xml->value = nullptr;
+    xml->attributes.clear();
+
+    if (xml->selfClosing) {
+        xml->selfClosing = false;
+        xml->name = xml->openElements.back();
+        xml->openElements.pop_back();
+        return XmlStreamReader::EndElement;
+    }
+
+    if (!xml->tagOpened) {
+        //! NOTE As with tinyxml2, whitespace-only text between markup is not reported
+        char* start = xml->pos;
+        char* p = start;
+        bool hasText = false;
+        while (p < xml->end && *p != '<') {
+            if (*p == '\n') {
+                ++xml->line;
+            } else if (!isWhiteSpaceChar(*p)) {
+                hasText = true;
+            }
+            ++p;
+        }
+
+        if (hasText) {
+            xml->hasNodes = true;
+            xml->tagOpened = p < xml->end;
+            xml->pos = xml->tagOpened ? p + 1 : p;
+            decodeInPlace(start, p, true);
+            xml->value = start;
+            return XmlStreamReader::Characters;
+        }
+
+        if (p == xml->end) {
+            xml->pos = p;
+            if (!xml->openElements.empty()) {
+                setParseError(xml, XmlStreamReader::PrematureEndOfDocumentError, u"Premature end of document");
+                return XmlStreamReader::Invalid;
+            }
+            if (!xml->hasNodes) {
+                setParseError(xml, XmlStreamReader::PrematureEndOfDocumentError, u"Document is empty");
+                return XmlStreamReader::Invalid;
+            }
+            return XmlStreamReader::EndDocument;
+        }
+
+        xml->pos = p + 1;
+    }
+
+    xml->tagOpened = false;
+    xml->hasNodes = true;
+
+    // xml->pos is right after '<'
+    if (startsWith(xml->pos, xml->end, "?", 1)) {
+        return readDelimited(xml, 1, "?>", 2, XmlStreamReader::StartDocument);
+    } else if (startsWith(xml->pos, xml->end, "!--", 3)) {
+        return readDelimited(xml, 3, "-->", 3, XmlStreamReader::Comment);
+    } else if (startsWith(xml->pos, xml->end, "![CDATA[", 8)) {
+        return readDelimited(xml, 8, "]]>", 3, XmlStreamReader::Characters);
+    } else if (startsWith(xml->pos, xml->end, "!", 1)) {
+        return readDelimited(xml, 1, ">", 1, XmlStreamReader::DTD);
+    } else if (startsWith(xml->pos, xml->end, "/", 1)) {
+        return readEndElement(xml);
+    }
+    return readStartElement(xml);
+}
+
+static void startParsing(ParseState* xml, ByteArray data)
+{
+    //! NOTE Parsing writes into the buffer, so it is detached (copied) here only if the data is still shared
+    xml->buffer = std::move(data);
+    char* begin = reinterpret_cast<char*>(xml->buffer.data());
+    xml->pos = begin;
+    xml->end = begin ? begin + xml->buffer.size() : nullptr;
+
+    static const char UTF8_BOM[] = { '\xEF', '\xBB', '\xBF' };
+    if (begin && startsWith(xml->pos, xml->end, UTF8_BOM, sizeof(UTF8_BOM))) {
+        xml->pos += sizeof(UTF8_BOM);
+    }
+}
+
 XmlStreamReader::XmlStreamReader()
 {
     m_xml = new Xml();
@@ -46,8 +467,7 @@ XmlStreamReader::XmlStreamReader()
 XmlStreamReader::XmlStreamReader(IODevice* device)
 {
     m_xml = new Xml();
-    ByteArray data = device->readAll();
-    setData(data);
+    startParsing(m_xml, device->readAll());
 }
 
 XmlStreamReader::XmlStreamReader(const ByteArray& data)
@@ -73,14 +493,12 @@ XmlStreamReader::~XmlStreamReader()
 
 void XmlStreamReader::setData(const ByteArray& data)
 {
-    m_xml->doc.Clear();
-    m_xml->err = m_xml->doc.Parse(reinterpret_cast<const char*>(data.constData()), data.size());
-    m_token = m_xml->err == XML_SUCCESS ? TokenType::NoToken : TokenType::Invalid;
-    m_xml->customErr.clear();
+    delete m_xml;
+    m_xml = new Xml();
+    m_entities.clear();
+    m_token = TokenType::NoToken;
 
-    if (m_xml->err != XML_SUCCESS) {
-        LOGE() << errorString();
-    }
+    startParsing(m_xml, data);
 }
 
 bool XmlStreamReader::readNextStartElement()
@@ -100,75 +518,22 @@ bool XmlStreamReader::atEnd() const
     return m_token == TokenType::EndDocument || m_token == TokenType::Invalid;
 }
 
-static XmlStreamReader::TokenType resolveToken(XMLNode* n, bool isStartElement)
-{
-    if (n->ToElement()) {
-        return isStartElement ? XmlStreamReader::TokenType::StartElement : XmlStreamReader::TokenType::EndElement;
-    } else if (n->ToText()) {
-        return XmlStreamReader::TokenType::Characters;
-    } else if (n->ToComment()) {
-        return XmlStreamReader::TokenType::Comment;
-    } else if (n->ToDeclaration()) {
-        return XmlStreamReader::TokenType::StartDocument;
-    } else if (n->ToDocument()) {
-        return XmlStreamReader::TokenType::EndDocument;
-    } else if (n->ToUnknown()) {
-        return XmlStreamReader::TokenType::DTD;
-    }
-    return XmlStreamReader::TokenType::Unknown;
-}
-
-static std::pair<XMLNode*, XmlStreamReader::TokenType> resolveNode(XMLNode* currentNode, XmlStreamReader::TokenType currentToken)
-{
-    if (currentToken == XmlStreamReader::TokenType::StartElement) {
-        XMLNode* child = currentNode->FirstChild();
-        if (child) {
-            return { child, resolveToken(child, true) };
-        }
-
-        XMLNode* sibling = currentNode->NextSibling();
-        if (!sibling || sibling->ToElement() || sibling->ToText()) {
-            return { currentNode, XmlStreamReader::TokenType::EndElement };
-        }
-    }
-
-    XMLNode* sibling = currentNode->NextSibling();
-    if (sibling) {
-        return { sibling, resolveToken(sibling, true) };
-    }
-
-    XMLNode* parent = currentNode->Parent();
-    if (parent) {
-        return { parent, resolveToken(parent, false) };
-    }
-
-    return { nullptr, XmlStreamReader::TokenType::EndDocument };
-}
-
 XmlStreamReader::TokenType XmlStreamReader::readNext()
 {
     if (m_token == TokenType::Invalid) {
         return m_token;
     }
 
-    if (m_xml->err != XML_SUCCESS || m_token == EndDocument) {
-        m_xml->node = nullptr;
+    if (m_xml->err != NoError || m_token == EndDocument) {
         m_token = TokenType::Invalid;
         return m_token;
     }
 
-    if (!m_xml->node) {
-        m_xml->node = m_xml->doc.FirstChild();
-        m_token = m_xml->node->ToDeclaration() ? TokenType::StartDocument : resolveToken(m_xml->node, true);
-        return m_token;
-    }
-
-    std::pair<XMLNode*, XmlStreamReader::TokenType> p = resolveNode(m_xml->node, m_token);
-
-    m_xml->node = p.first;
-    m_token = p.second;
+    m_token = parseNext(m_xml);
 
-    if (m_token == XmlStreamReader::TokenType::DTD) {
+    if (m_token == TokenType::Invalid) {
+        LOGE() << errorString();
+    } else if (m_token == TokenType::DTD) {
         tryParseEntity(m_xml);
     }
 
@@ -179,7 +544,7 @@ void XmlStreamReader::tryParseEntity(Xml* xml)
 {
     static const char* ENTITY = { "ENTITY" };
 
-    const char* str = xml->node->Value();
+    const char* str = xml->value;
     if (std::strncmp(str, ENTITY, 6) == 0) {
         String val = String::fromUtf8(str);
         StringList list = val.split(' ');
@@ -195,7 +560,7 @@ void XmlStreamReader::tryParseEntity(Xml* xml)
 
 String XmlStreamReader::nodeValue(Xml* xml) const
 {
-    String str = String::fromUtf8(xml->node->Value());
+    String str = String::fromUtf8(xml->value);
     if (!m_entities.empty()) {
         for (const auto& p : m_entities) {
             str.replace(p.first, p.second);
@@ -245,7 +610,17 @@ void XmlStreamReader::skipCurrentElement()
 
 AsciiStringView XmlStreamReader::name() const
 {
-    return (m_xml->node && m_xml->node->ToElement()) ? m_xml->node->Value() : AsciiStringView();
+    return (m_token == TokenType::StartElement || m_token == TokenType::EndElement) ? m_xml->name : AsciiStringView();
+}
+
+static const AsciiStringView* findAttribute(const ParseState* xml, const char* name)
+{
+    for (const auto& a : xml->attributes) {
+        if (a.first == name) {
+            return &a.second;
+        }
+    }
+    return nullptr;
 }
 
 bool XmlStreamReader::hasAttribute(const char* name) const
@@ -254,11 +629,7 @@ bool XmlStreamReader::hasAttribute(const char* name) const
         return false;
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return false;
-    }
-    return e->FindAttribute(name) != nullptr;
+    return findAttribute(m_xml, name) != nullptr;
 }
 
 String XmlStreamReader::attribute(const char* name) const
@@ -267,11 +638,11 @@ String XmlStreamReader::attribute(const char* name) const
         return String();
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
+    const AsciiStringView* value = findAttribute(m_xml, name);
+    if (!value) {
         return String();
     }
-    return String::fromUtf8(e->Attribute(name));
+    return String::fromUtf8(value->ascii());
 }
 
 String XmlStreamReader::attribute(const char* name, const String& def) const
@@ -285,11 +656,11 @@ AsciiStringView XmlStreamReader::asciiAttribute(const char* name) const
         return AsciiStringView();
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
+    const AsciiStringView* value = findAttribute(m_xml, name);
+    if (!value) {
         return AsciiStringView();
     }
-    return e->Attribute(name);
+    return *value;
 }
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name, const AsciiStringView& def) const
@@ -324,15 +695,11 @@ std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
         return attrs;
     }
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return attrs;
-    }
-
-    for (const XMLAttribute* xa = e->FirstAttribute(); xa; xa = xa->Next()) {
+    attrs.reserve(m_xml->attributes.size());
+    for (const auto& xa : m_xml->attributes) {
         Attribute a;
-        a.name = xa->Name();
-        a.value = String::fromUtf8(xa->Value());
+        a.name = xa.first;
+        a.value = String::fromUtf8(xa.second.ascii());
         attrs.push_back(std::move(a));
     }
     return attrs;
@@ -340,7 +707,7 @@ std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
 
 String XmlStreamReader::text() const
 {
-    if (m_xml->node && (m_xml->node->ToText() || m_xml->node->ToComment())) {
+    if (m_xml->value && (m_token == TokenType::Characters || m_token == TokenType::Comment)) {
         return nodeValue(m_xml);
     }
     return String();
@@ -348,8 +715,8 @@ String XmlStreamReader::text() const
 
 AsciiStringView XmlStreamReader::asciiText() const
 {
-    if (m_xml->node && (m_xml->node->ToText() || m_xml->node->ToComment())) {
-        return m_xml->node->Value();
+    if (m_xml->value && (m_token == TokenType::Characters || m_token == TokenType::Comment)) {
+        return m_xml->value;
     }
     return AsciiStringView();
 }
@@ -365,10 +732,9 @@ String XmlStreamReader::readText()
                 break;
             case EndElement:
                 return result;
-            case Comment:
-                break;
-            case StartElement:
-                break;
+            case Invalid:
+            case EndDocument:
+                return result;
             default:
                 break;
             }
@@ -384,14 +750,13 @@ AsciiStringView XmlStreamReader::readAsciiText()
         while (1) {
             switch (readNext()) {
             case Characters:
-                result = AsciiStringView(m_xml->node->Value());
+                result = AsciiStringView(m_xml->value);
                 break;
             case EndElement:
                 return result;
-            case Comment:
-                break;
-            case StartElement:
-                break;
+            case Invalid:
+            case EndDocument:
+                return result;
             default:
                 break;
             }
@@ -414,7 +779,7 @@ double XmlStreamReader::readDouble(bool* ok)
 
 int64_t XmlStreamReader::lineNumber() const
 {
-    return m_xml->doc.ErrorLineNum();
+    return m_xml->line;
 }
 
 int64_t XmlStreamReader::columnNumber() const
@@ -428,12 +793,7 @@ XmlStreamReader::Error XmlStreamReader::error() const
         return CustomError;
     }
 
-    XMLError err = m_xml->doc.ErrorID();
-    if (err == XML_SUCCESS) {
-        return NoError;
-    }
-
-    return NotWellFormedError;
+    return m_xml->err;
 }
 
 bool XmlStreamReader::isError() const
@@ -446,7 +806,7 @@ String XmlStreamReader::errorString() const
     if (!m_xml->customErr.empty()) {
         return m_xml->customErr;
     }
-    return String::fromUtf8(m_xml->doc.ErrorStr());
+    return m_xml->errStr;
 }
 
 void XmlStreamReader::raiseError(const String& message)
@@ -21,6 +21,9 @@
  */
 #include "xmlstreamwriter.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "containers.h"
 #include "textstream.h"
 
@@ -34,10 +37,59 @@ struct XmlStreamWriter::Impl {
 
     void putLevel()
     {
-        size_t level = stack.size();
-        for (size_t i = 0; i < level * 2; ++i) {
-            stream << ' ';
+        static constexpr char INDENT[] = "                                ";
+        static constexpr size_t INDENT_SIZE = sizeof(INDENT) - 1;
+
+        size_t count = stack.size() * 2;
+        while (count > 0) {
+            size_t n = std::min(count, INDENT_SIZE);
+            stream << AsciiStringView(INDENT, n);
+            count -= n;
+        }
+    }
+
+    //! NOTE Writes UTF-8 text escaped, copying runs of plain characters as is
+    void writeEscaped(const char* s, size_t size)
+    {
+        size_t runStart = 0;
+        for (size_t i = 0; i < size; ++i) {
+            const char* replacement = nullptr;
+            switch (s[i]) {
+            case '<': replacement = "&lt;";
+                break;
+            case '>': replacement = "&gt;";
+                break;
+            case '&': replacement = "&amp;";
+                break;
+            case '\"': replacement = "&quot;";
+                break;
+            default:
+                // ignore invalid characters in xml 1.0
+                if (static_cast<unsigned char>(s[i]) < 0x20 && s[i] != 0x09 && s[i] != 0x0A && s[i] != 0x0D) {
+                    replacement = "";
+                    break;
+                }
+                continue;
+            }
+
+            stream << AsciiStringView(s + runStart, i - runStart) << replacement;
+            runStart = i + 1;
+        }
+
+        stream << AsciiStringView(s + runStart, size - runStart);
+    }
+
+    void writeEscaped(const String& s)
+    {
+        for (size_t i = 0; i < s.size(); ++i) {
+            char16_t c = s.at(i).unicode();
+            if (c == u'<' || c == u'>' || c == u'&' || c == u'\"' || c < 0x0020) {
+                stream << String::toXmlEscaped(s);
+                return;
+            }
         }
+
+        stream << s;
     }
 };
 
@@ -114,11 +166,15 @@ void XmlStreamWriter::writeValue(const Value& v)
         break;
     case 7: m_impl->stream << std::get<double>(v);
         break;
-    case 8: m_impl->stream << escapeString(AsciiStringView(std::get<const char*>(v)));
-        break;
-    case 9: m_impl->stream << escapeString(std::get<AsciiStringView>(v));
-        break;
-    case 10: m_impl->stream << escapeString(std::get<String>(v));
+    case 8: {
+        const char* s = std::get<const char*>(v);
+        m_impl->writeEscaped(s, s ? std::strlen(s) : 0);
+    } break;
+    case 9: {
+        const AsciiStringView& s = std::get<AsciiStringView>(v);
+        m_impl->writeEscaped(s.ascii(), s.size());
+    } break;
+    case 10: m_impl->writeEscaped(std::get<String>(v));
         break;
     default:
         LOGI() << "index: " << v.index();
@@ -160,7 +216,12 @@ void XmlStreamWriter::endElement()
 {
     m_impl->putLevel();
     m_impl->stream << "</" << mu::takeLast(m_impl->stack) << '>' << '\n';
-    flush();
+
+    //! NOTE The stream flushes itself when its buffer is full,
+    //! so only make sure a finished document reaches the device
+    if (m_impl->stack.empty()) {
+        flush();
+    }
 }
 
 // <element attr="value" />
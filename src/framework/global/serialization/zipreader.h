@@ -53,6 +53,10 @@ public:
 
     std::vector<FileInfo> fileInfoList() const;
     ByteArray fileData(const std::string& fileName) const;
+    ByteArray fileDataHead(const std::string& fileName, size_t maxSize) const;
+
+    //! NOTE If true, fileData may be called from several threads at once
+    bool isConcurrentReadSupported() const;
 
 private:
     struct Impl;
@@ -23,6 +23,7 @@
 
 #include "internal/zipcontainer.h"
 #include "io/file.h"
+#include "io/mappedfile.h"
 
 #include "log.h"
 
@@ -32,6 +33,17 @@ struct ZipWriter::Impl
 {
     ZipContainer* zip = nullptr;
     bool isClosed = false;
+
+    io::IODevice* previousDevice = nullptr;
+    ZipContainer* previousZip = nullptr;
+
+    void closePrevious()
+    {
+        delete previousZip;
+        previousZip = nullptr;
+        delete previousDevice;
+        previousDevice = nullptr;
+    }
 };
 
 ZipWriter::ZipWriter(const io::path_t& filePath)
@@ -57,6 +69,7 @@ ZipWriter::~ZipWriter()
 {
     close();
     delete m_impl->zip;
+    m_impl->closePrevious();
     delete m_impl;
 
     if (m_selfDevice) {
@@ -81,6 +94,8 @@ void ZipWriter::close()
         m_device->close();
     }
 
+    m_impl->closePrevious();
+
     m_impl->isClosed = true;
 }
 
@@ -91,6 +106,29 @@ bool ZipWriter::hasError() const
 
 void ZipWriter::addFile(const std::string& fileName, const ByteArray& data)
 {
+    if (m_impl->previousZip && m_impl->zip->addFileFrom(*m_impl->previousZip, fileName, data)) {
+        flush();
+        return;
+    }
+
     m_impl->zip->addFile(fileName, data);
     flush();
 }
+
+void ZipWriter::setPreviousArchive(const io::path_t& filePath)
+{
+    m_impl->closePrevious();
+
+    if (filePath.empty() || !io::File::exists(filePath)) {
+        return;
+    }
+
+    m_impl->previousDevice = new io::MappedFile(filePath);
+    if (!m_impl->previousDevice->open(io::IODevice::ReadOnly)) {
+        LOGW() << "failed open previous archive: " << filePath;
+        m_impl->closePrevious();
+        return;
+    }
+
+    m_impl->previousZip = new ZipContainer(m_impl->previousDevice);
+}
@@ -39,6 +39,10 @@ public:
 
     void addFile(const std::string& fileName, const ByteArray& data);
 
+    //! NOTE Files, that are added with the same data as they have in the given archive,
+    //! are copied from it without compressing them again
+    void setPreviousArchive(const io::path_t& filePath);
+
 private:
 
     void flush();
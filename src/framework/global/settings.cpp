@@ -23,6 +23,9 @@
 #include "settings.h"
 #include "config.h"
 #include "log.h"
+#include "runtime.h"
+
+#include <algorithm>
 
 #include <QDateTime>
 #include <QSettings>
@@ -37,6 +40,11 @@ using namespace mu::async;
 
 static const std::string SETTINGS_RESOURCE_NAME("SETTINGS");
 
+//! NOTE The values are written when nothing has changed for WRITE_DELAY,
+//! but not later than WRITE_MAX_DELAY after the first change, e.g. while a panel is being resized
+static constexpr std::chrono::milliseconds WRITE_DELAY(1000);
+static constexpr std::chrono::milliseconds WRITE_MAX_DELAY(5000);
+
 Settings* Settings::instance()
 {
     static Settings s;
@@ -59,6 +67,9 @@ Settings::Settings()
 
 Settings::~Settings()
 {
+    stopWriter();
+    flush();
+
     delete m_settings;
 }
 
@@ -77,6 +88,8 @@ const Settings::Items& Settings::items() const
  */
 void Settings::reload()
 {
+    flush();
+
     Items items = readItems();
 
     for (auto it = items.cbegin(); it != items.cend(); ++it) {
@@ -91,7 +104,14 @@ void Settings::load()
 
 void Settings::reset(bool keepDefaultSettings, bool notifyAboutChanges)
 {
-    m_settings->clear();
+    {
+        std::lock_guard<std::mutex> writeLock(m_writeMutex);
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            m_pendingValues.clear();
+        }
+        m_settings->clear();
+    }
 
     m_isTransactionStarted = false;
     m_localSettings.clear();
@@ -200,10 +220,92 @@ void Settings::setLocalValue(const Key& key, const Val& value)
 
 void Settings::writeValue(const Key& key, const Val& value)
 {
-    mi::WriteResourceLockGuard resource_lock(multiInstancesProvider(), SETTINGS_RESOURCE_NAME);
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+
+    auto now = std::chrono::steady_clock::now();
+    if (m_pendingValues.empty()) {
+        m_firstPendingTime = now;
+    }
+    m_lastPendingTime = now;
 
     // TODO: implement writing/reading first part of key (module name)
-    m_settings->setValue(QString::fromStdString(key.key), value.toQVariant());
+    m_pendingValues[key.key] = value;
+
+    if (!m_writer && !m_writerStopped) {
+        m_writer = std::make_unique<std::thread>([this]() {
+            writerLoop();
+        });
+    }
+
+    m_pendingCv.notify_one();
+}
+
+void Settings::writerLoop()
+{
+    mu::runtime::setThreadName("settings_writer");
+
+    //! NOTE Its own object, so that the main one is not used by two threads at once
+    //! and does not sync the file on the main thread
+    QSettings settings;
+
+    std::unique_lock<std::mutex> lock(m_pendingMutex);
+    while (!m_writerStopped) {
+        if (m_pendingValues.empty()) {
+            m_pendingCv.wait(lock);
+            continue;
+        }
+
+        auto writeTime = std::min(m_lastPendingTime + WRITE_DELAY, m_firstPendingTime + WRITE_MAX_DELAY);
+        if (std::chrono::steady_clock::now() < writeTime) {
+            m_pendingCv.wait_until(lock, writeTime);
+            continue;
+        }
+
+        lock.unlock();
+        writePendingValues(&settings);
+        lock.lock();
+    }
+}
+
+void Settings::writePendingValues(QSettings* settings)
+{
+    //! NOTE Held while writing, so that an older batch is not written over a newer one
+    std::lock_guard<std::mutex> writeLock(m_writeMutex);
+
+    std::map<std::string, Val> values;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        values.swap(m_pendingValues);
+    }
+
+    if (values.empty()) {
+        return;
+    }
+
+    for (const auto& p : values) {
+        settings->setValue(QString::fromStdString(p.first), p.second.toQVariant());
+    }
+
+    settings->sync();
+}
+
+void Settings::flush()
+{
+    writePendingValues(m_settings);
+}
+
+void Settings::stopWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_writerStopped = true;
+    }
+    m_pendingCv.notify_one();
+
+    if (m_writer) {
+        m_writer->join();
+        m_writer.reset();
+    }
 }
 
 QString Settings::dataPath() const
@@ -24,6 +24,12 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
 
 #include "types/val.h"
 #include "async/channel.h"
@@ -96,6 +102,10 @@ public:
     void setCanBeManuallyEdited(const Settings::Key& key, bool canBeManuallyEdited, const Val& minValue = Val(),
                                 const Val& maxValue = Val());
 
+    //! NOTE The changed values are written to the storage in the background, a while after the last change.
+    //! Writes them right away
+    void flush();
+
     void beginTransaction(bool notifyToOtherInstances = true);
     void commitTransaction(bool notifyToOtherInstances = true);
     void rollbackTransaction(bool notifyToOtherInstances = true);
@@ -116,9 +126,23 @@ private:
     Items readItems() const;
     void writeValue(const Key& key, const Val& value);
 
+    void writerLoop();
+    void writePendingValues(QSettings* settings);
+    void stopWriter();
+
     QString dataPath() const;
 
     QSettings* m_settings = nullptr;
+
+    std::map<std::string, Val> m_pendingValues;
+    std::chrono::steady_clock::time_point m_firstPendingTime;
+    std::chrono::steady_clock::time_point m_lastPendingTime;
+    std::mutex m_pendingMutex;
+    std::condition_variable m_pendingCv;
+    std::mutex m_writeMutex;
+    std::unique_ptr<std::thread> m_writer;
+    bool m_writerStopped = false;
+
     mutable Items m_items;
     mutable Items m_localSettings;
     mutable bool m_isTransactionStarted = false;
@@ -21,6 +21,8 @@
  */
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "types/string.h"
 
 #ifdef CUSTOM_ALLOCATOR_DISABLED
@@ -202,3 +204,143 @@ TEST_F(Global_AllocatorTests, Many_NewCleanup)
     EXPECT_EQ(info.totalChunks, 12); // DEFAULT_BLOCK_SIZE * 3
     EXPECT_EQ(info.freeChunks, 12);
 }
+
+TEST_F(Global_AllocatorTests, Many_LiveAndPeak)
+{
+    //! DO Create 5 items and delete 3 of them
+    std::vector<ItemBase*> items;
+    for (size_t i = 0; i < 5; ++i) {
+        items.push_back(new Item13(static_cast<uint8_t>(i)));
+    }
+
+    for (size_t i = 0; i < 3; ++i) {
+        delete items.back();
+        items.pop_back();
+    }
+
+    //! CHECK The live count follows the deletions, the peak stays
+    ObjectAllocator::Info info = Item13::allocator().stateInfo();
+    EXPECT_EQ(info.liveCount, 2);
+    EXPECT_EQ(info.peakCount, 5);
+    EXPECT_EQ(info.liveBytes(), 2 * info.chunkSize);
+    EXPECT_EQ(info.peakBytes(), 5 * info.chunkSize);
+
+    //! DO Create one more item
+    items.push_back(new Item13(5));
+
+    //! CHECK
+    info = Item13::allocator().stateInfo();
+    EXPECT_EQ(info.liveCount, 3);
+    EXPECT_EQ(info.peakCount, 5);
+
+    //! DO Allocator cleanup
+    Item13::allocator().cleanup();
+
+    //! CHECK Nothing is alive after the cleanup
+    info = Item13::allocator().stateInfo();
+    EXPECT_EQ(info.liveCount, 0);
+    EXPECT_EQ(info.peakCount, 5);
+}
+
+TEST_F(Global_AllocatorTests, Many_ConcurrentNewDelete)
+{
+    //! GIVEN items created on one thread are also deleted on others
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t ITEMS_PER_THREAD = 1000;
+
+    std::vector<std::vector<ItemBase*> > created(THREAD_COUNT);
+
+    //! DO Create items on several threads at once
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&created, t]() {
+            for (size_t i = 0; i < ITEMS_PER_THREAD; ++i) {
+                created[t].push_back(new Item8(static_cast<uint8_t>(i)));
+            }
+        });
+    }
+    for (std::thread& th : threads) {
+        th.join();
+    }
+    threads.clear();
+
+    //! CHECK
+    ObjectAllocator::Info info = Item8::allocator().stateInfo();
+    EXPECT_EQ(info.liveCount, THREAD_COUNT * ITEMS_PER_THREAD);
+
+    //! DO Delete the items of each thread on the next one
+    for (size_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&created, t]() {
+            for (ItemBase* item : created[(t + 1) % THREAD_COUNT]) {
+                EXPECT_TRUE(item->alive());
+                delete item;
+            }
+        });
+    }
+    for (std::thread& th : threads) {
+        th.join();
+    }
+
+    //! CHECK Nothing is alive and the chunks cached by the exited threads are back
+    info = Item8::allocator().stateInfo();
+    EXPECT_EQ(info.liveCount, 0);
+    EXPECT_EQ(info.totalChunks, info.freeChunks);
+}
+
+namespace {
+struct ArenaItem
+{
+    ArenaItem(int v, double d)
+        : value(v), data(d) {}
+
+    int value = 0;
+    double data = 0.0;
+};
+}
+
+TEST_F(Global_AllocatorTests, Arena_CreateAndReset)
+{
+    //! GIVEN an arena with blocks smaller than all items together
+    ArenaAllocator arena(sizeof(ArenaItem) * 4);
+
+    //! DO Create items (more than one block size)
+    std::vector<ArenaItem*> items;
+    for (int i = 0; i < 10; ++i) {
+        items.push_back(arena.create<ArenaItem>(i, i * 0.5));
+    }
+
+    //! CHECK Items are aligned and do not overlap
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(items[i]) % alignof(ArenaItem), 0);
+        EXPECT_EQ(items[i]->value, i);
+        EXPECT_DOUBLE_EQ(items[i]->data, i * 0.5);
+    }
+
+    EXPECT_EQ(arena.usedBytes(), sizeof(ArenaItem) * 10);
+    EXPECT_GE(arena.reservedBytes(), arena.usedBytes());
+
+    //! DO Reset
+    arena.reset();
+
+    //! CHECK Nothing is used anymore
+    EXPECT_EQ(arena.usedBytes(), 0);
+}
+
+TEST_F(Global_AllocatorTests, Arena_StdContainer)
+{
+    //! GIVEN an arena with small blocks
+    ArenaAllocator arena(64);
+
+    //! DO Fill a vector that has to reallocate several times
+    std::vector<int, ArenaStdAllocator<int> > values { ArenaStdAllocator<int>(&arena) };
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+
+    //! CHECK
+    ASSERT_EQ(values.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+    EXPECT_GE(arena.usedBytes(), sizeof(int) * 100);
+}
@@ -24,6 +24,7 @@
 #include <cstring>
 
 #include "io/file.h"
+#include "io/mappedfile.h"
 
 using namespace mu;
 using namespace mu::io;
@@ -207,3 +208,30 @@ TEST_F(Global_IO_FileTests, FileTests_Exists_Append)
         EXPECT_EQ(refba, data);
     }
 }
+
+TEST_F(Global_IO_FileTests, FileTests_Mapped)
+{
+    path_t filePath("FileTests_Mapped.txt");
+    std::string ref = "Hello Mapped World!";
+    createFile(filePath, ref);
+
+    //! GIVEN mapped file
+    MappedFile f(filePath);
+
+    //! DO Open file
+    EXPECT_TRUE(f.open(IODevice::ReadOnly));
+
+    //! CHECK Data is the same as a regular read
+    EXPECT_EQ(f.size(), ref.size());
+    EXPECT_EQ(f.readAll(), ByteArray(reinterpret_cast<const uint8_t*>(ref.c_str()), ref.size()));
+
+    //! CHECK Random access
+    EXPECT_TRUE(f.seek(6));
+    EXPECT_EQ(f.read(6), ByteArray("Mapped"));
+
+    //! CHECK Writing is not supported
+    f.close();
+    EXPECT_FALSE(f.open(IODevice::WriteOnly));
+
+    File::remove(filePath);
+}
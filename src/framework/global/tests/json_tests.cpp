@@ -136,3 +136,27 @@ TEST_F(Global_Ser_Json, WriteRead)
         EXPECT_EQ(keys.at(1), "key2");
     }
 }
+
+TEST_F(Global_Ser_Json, ValuesOutliveChanges)
+{
+    JsonDocument doc = JsonDocument::fromJson(ByteArray("{\"s\":\"a \\\"quoted\\\" \\u263A\", \"o\":{\"a\":[1, 2]}}"));
+    JsonObject root = doc.rootObject();
+
+    EXPECT_EQ(root.value("s").toString(), String(u"a \"quoted\" ☺"));
+
+    JsonObject o = root.value("o").toObject();
+    JsonArray a = o.value("a").toArray();
+
+    //! NOTE Changing the parent does not change the values read from it
+    root["o"] = 1;
+    EXPECT_EQ(o.size(), 1);
+    EXPECT_EQ(a.at(1).toInt(), 2);
+
+    //! NOTE Changing a value does not change its parent
+    a.append(3);
+    o["b"] = true;
+    EXPECT_EQ(a.size(), 3);
+    EXPECT_EQ(o.size(), 2);
+    EXPECT_EQ(o.value("a").toArray().size(), 2);
+    EXPECT_EQ(root.value("o").toInt(), 1);
+}
@@ -46,6 +46,10 @@ public:
 
     MOCK_METHOD(RetVal<io::paths_t>, scanFiles, (const io::path_t&, const std::vector<std::string>&, ScanMode), (const, override));
 
+    MOCK_METHOD(async::Promise<io::paths_t>, scanFilesAsync,
+                (const io::path_t&, const std::vector<std::string>&, ScanMode, const async::CancellationPtr&), (const, override));
+    MOCK_METHOD(async::Promise<ByteArray>, readFileAsync, (const io::path_t&, const async::CancellationPtr&), (const, override));
+
     MOCK_METHOD(void, setAttribute, (const io::path_t& path, Attribute attribute), (const, override));
     MOCK_METHOD(bool, setPermissionsAllowedForAll, (const io::path_t& path), (const, override));
 
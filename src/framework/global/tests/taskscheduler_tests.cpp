@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "concurrency/taskscheduler.h"
+
+using namespace mu;
+
+class Global_Concurrency_TaskScheduler : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Concurrency_TaskScheduler, Submit)
+{
+    TaskScheduler scheduler(4);
+
+    //! DO Submit tasks with and without arguments and priorities
+    std::future<int> sum = scheduler.submit([](int a, int b) { return a + b; }, 2, 3);
+    std::future<int> high = scheduler.submit(TaskPriority::High, []() { return 42; });
+
+    std::atomic<int> pushed = 0;
+    for (int i = 0; i < 100; ++i) {
+        scheduler.push([&pushed]() { ++pushed; });
+    }
+
+    //! CHECK All of them are done
+    EXPECT_EQ(sum.get(), 5);
+    EXPECT_EQ(high.get(), 42);
+
+    scheduler.waitForAllTasksComplete();
+    EXPECT_EQ(pushed.load(), 100);
+}
+
+TEST_F(Global_Concurrency_TaskScheduler, Exception)
+{
+    TaskScheduler scheduler(2);
+
+    std::future<int> result = scheduler.submit([]() -> int { throw std::runtime_error("error"); });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST_F(Global_Concurrency_TaskScheduler, ParallelFor)
+{
+    TaskScheduler scheduler(4);
+
+    //! DO Visit every index of a range with different grain sizes
+    for (size_t grain : { 1, 7, 1000 }) {
+        std::vector<std::atomic<int> > visits(1000);
+        scheduler.parallelFor(size_t(0), visits.size(), [&visits](size_t i) { ++visits[i]; }, grain);
+
+        //! CHECK Every index has been visited exactly once
+        for (const std::atomic<int>& v : visits) {
+            EXPECT_EQ(v.load(), 1);
+        }
+    }
+}
+
+TEST_F(Global_Concurrency_TaskScheduler, NestedTaskGroups)
+{
+    TaskScheduler scheduler(2);
+
+    //! DO Wait for groups from inside tasks of the same scheduler,
+    //! with more waiting tasks than there are threads
+    std::atomic<int> leaves = 0;
+    TaskGroup outer(&scheduler);
+    for (int i = 0; i < 8; ++i) {
+        outer.run([&scheduler, &leaves]() {
+            TaskGroup inner(&scheduler);
+            for (int j = 0; j < 8; ++j) {
+                inner.run([&leaves]() { ++leaves; });
+            }
+            inner.wait();
+        });
+    }
+    outer.wait();
+
+    //! CHECK No deadlock and all the tasks are done
+    EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST_F(Global_Concurrency_TaskScheduler, TaskGroupException)
+{
+    TaskScheduler scheduler(2);
+
+    TaskGroup group(&scheduler);
+    group.run([]() { throw std::runtime_error("error"); });
+    group.run([]() {});
+
+    EXPECT_THROW(group.wait(), std::runtime_error);
+}
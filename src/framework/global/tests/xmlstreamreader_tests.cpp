@@ -0,0 +1,148 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "serialization/xmlstreamreader.h"
+
+using namespace mu;
+
+class Global_Ser_XmlStreamReader : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Ser_XmlStreamReader, Tokens)
+{
+    ByteArray data("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                   "<museScore version=\"4.00\">\n"
+                   "  <!-- comment -->\n"
+                   "  <Score>\n"
+                   "    <Division>480</Division>\n"
+                   "    <Empty/>\n"
+                   "    <metaTag name=\"title\">A &amp; B &#x263A;</metaTag>\n"
+                   "  </Score>\n"
+                   "</museScore>\n");
+
+    XmlStreamReader xml(data);
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::StartDocument);
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "museScore");
+    EXPECT_EQ(xml.asciiAttribute("version"), "4.00");
+    EXPECT_DOUBLE_EQ(xml.doubleAttribute("version"), 4.0);
+    EXPECT_FALSE(xml.hasAttribute("other"));
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::Comment);
+    EXPECT_EQ(xml.text(), u" comment ");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Score");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Division");
+    EXPECT_EQ(xml.readInt(), 480);
+    EXPECT_TRUE(xml.isEndElement());
+    EXPECT_EQ(xml.name(), "Division");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Empty");
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndElement);
+    EXPECT_EQ(xml.name(), "Empty");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "metaTag");
+    EXPECT_EQ(xml.attribute("name"), u"title");
+    EXPECT_EQ(xml.readText(), String(u"A & B ☺"));
+
+    EXPECT_FALSE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Score");
+    EXPECT_FALSE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "museScore");
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::EndDocument);
+    EXPECT_TRUE(xml.atEnd());
+    EXPECT_FALSE(xml.isError());
+}
+
+TEST_F(Global_Ser_XmlStreamReader, ViewsOutliveTokens)
+{
+    ByteArray data("<a x=\"1\"><b>text</b><c y=\"&lt;2&gt;\"/></a>");
+
+    XmlStreamReader xml(data);
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    AsciiStringView a = xml.name();
+    AsciiStringView x = xml.asciiAttribute("x");
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    AsciiStringView text = xml.readAsciiText();
+
+    EXPECT_TRUE(xml.readNextStartElement());
+    AsciiStringView y = xml.asciiAttribute("y");
+    xml.skipCurrentElement();
+    xml.skipCurrentElement();
+
+    EXPECT_EQ(a, "a");
+    EXPECT_EQ(x.toInt(), 1);
+    EXPECT_EQ(text, "text");
+    EXPECT_EQ(y, "<2>");
+    EXPECT_FALSE(xml.isError());
+}
+
+TEST_F(Global_Ser_XmlStreamReader, Entities)
+{
+    ByteArray data("<!ENTITY foo \"bar\">\n"
+                   "<a><![CDATA[<raw> &foo;]]></a>");
+
+    XmlStreamReader xml(data);
+
+    EXPECT_EQ(xml.readNext(), XmlStreamReader::DTD);
+    EXPECT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.readText(), u"<raw> bar");
+}
+
+TEST_F(Global_Ser_XmlStreamReader, Errors)
+{
+    {
+        ByteArray data("<a>\n<b></a>");
+        XmlStreamReader xml(data);
+        while (xml.readNext() != XmlStreamReader::Invalid) {
+        }
+        EXPECT_EQ(xml.error(), XmlStreamReader::NotWellFormedError);
+        EXPECT_EQ(xml.lineNumber(), 2);
+    }
+
+    {
+        ByteArray data("<a><b/>");
+        XmlStreamReader xml(data);
+        while (xml.readNext() != XmlStreamReader::Invalid) {
+        }
+        EXPECT_EQ(xml.error(), XmlStreamReader::PrematureEndOfDocumentError);
+    }
+
+    {
+        XmlStreamReader xml(ByteArray(""));
+        EXPECT_EQ(xml.readNext(), XmlStreamReader::Invalid);
+        EXPECT_TRUE(xml.isError());
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "serialization/xmlstreamwriter.h"
+#include "io/buffer.h"
+
+using namespace mu;
+using namespace mu::io;
+
+class Global_Ser_XmlStreamWriter : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Ser_XmlStreamWriter, Write)
+{
+    Buffer buf;
+    buf.open(IODevice::WriteOnly);
+
+    {
+        XmlStreamWriter xml(&buf);
+        xml.startDocument();
+        xml.startElement("museScore", { { "version", "4.00" } });
+        xml.element("int", -42);
+        xml.element("uint", 42u);
+        xml.element("long", 1234567890123ll);
+        xml.element("double", 0.1 + 0.2);
+        xml.element("small", 1.5e-7);
+        xml.element("ascii", "a < b & \"c\"");
+        xml.element("utf", String(u"A & B ☺ \U0001D11E"));
+        xml.element("point", { { "x", 1.25 }, { "y", -3 } });
+        xml.endElement();
+
+        //! NOTE Written to the device as soon as the document is finished
+        EXPECT_FALSE(buf.data().empty());
+    }
+
+    String expected = u"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                      u"<museScore version=\"4.00\">\n"
+                      u"  <int>-42</int>\n"
+                      u"  <uint>42</uint>\n"
+                      u"  <long>1234567890123</long>\n"
+                      u"  <double>0.3</double>\n"
+                      u"  <small>1.5e-07</small>\n"
+                      u"  <ascii>a &lt; b &amp; &quot;c&quot;</ascii>\n"
+                      u"  <utf>A &amp; B ☺ \U0001D11E</utf>\n"
+                      u"  <point x=\"1.25\" y=\"-3\"/>\n"
+                      u"  </museScore>\n";
+
+    EXPECT_EQ(String::fromUtf8(buf.data().constChar()), expected);
+}
+
+TEST_F(Global_Ser_XmlStreamWriter, Indent)
+{
+    Buffer buf;
+    buf.open(IODevice::WriteOnly);
+
+    {
+        XmlStreamWriter xml(&buf);
+        for (int i = 0; i < 20; ++i) {
+            xml.startElement("e");
+        }
+        xml.element("leaf", "\x01text\t");
+        for (int i = 0; i < 20; ++i) {
+            xml.endElement();
+        }
+    }
+
+    String data = String::fromUtf8(buf.data().constChar());
+    EXPECT_TRUE(data.contains(String::fromStdString(std::string(40, ' ') + "<leaf>text\t</leaf>\n")));
+}
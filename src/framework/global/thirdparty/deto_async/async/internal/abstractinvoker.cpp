@@ -77,6 +77,11 @@ void AbstractInvoker::onMainThreadInvoke(const std::function<void(const std::fun
     QueuedInvoker::instance()->onMainThreadInvoke(f);
 }
 
+void AbstractInvoker::onThreadInvoke(const std::thread::id& th, const std::function<void()>& f)
+{
+    QueuedInvoker::instance()->onThreadInvoke(th, f);
+}
+
 bool AbstractInvoker::isConnected() const
 {
     for (auto it = m_callbacks.cbegin(); it != m_callbacks.cend(); ++it) {
@@ -76,6 +76,7 @@ public:
 
     static void processEvents();
     static void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f);
+    static void onThreadInvoke(const std::thread::id& th, const std::function<void()>& f);
 
 protected:
     explicit AbstractInvoker();
@@ -168,6 +169,13 @@ inline void onMainThreadInvoke(const std::function<void(const std::function<void
 {
     AbstractInvoker::onMainThreadInvoke(f);
 }
+
+//! f is called (on the sending thread) every time a call is queued for the thread th,
+//! so that a thread waiting for work can be woken up to process its events
+inline void onThreadInvoke(const std::thread::id& th, const std::function<void()>& f)
+{
+    AbstractInvoker::onThreadInvoke(th, f);
+}
 }
 }
 
@@ -16,8 +16,20 @@ void QueuedInvoker::invoke(const std::thread::id& th, const Functor& f, bool isA
         }
     }
 
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    m_queues[th].push(f);
+    Functor onThreadInvoke;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        m_queues[th].push(f);
+
+        auto it = m_onThreadInvoke.find(th);
+        if (it != m_onThreadInvoke.end()) {
+            onThreadInvoke = it->second;
+        }
+    }
+
+    if (onThreadInvoke) {
+        onThreadInvoke();
+    }
 }
 
 void QueuedInvoker::processEvents()
@@ -44,3 +56,13 @@ void QueuedInvoker::onMainThreadInvoke(const std::function<void(const std::funct
     m_onMainThreadInvoke = f;
     m_mainThreadID = std::this_thread::get_id();
 }
+
+void QueuedInvoker::onThreadInvoke(const std::thread::id& th, const Functor& f)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (f) {
+        m_onThreadInvoke[th] = f;
+    } else {
+        m_onThreadInvoke.erase(th);
+    }
+}
@@ -22,7 +22,13 @@
 #define LOG_TAG CLASSNAME(FUNC_INFO)
 #endif
 
-#define IF_LOGLEVEL(level)  if (haw::logger::Logger::instance()->isLevel(level))
+//! NOTE The levels above this one are compiled out,
+//! e.g. with -DHAW_LOGGER_MAX_LEVEL=1 LOGD costs nothing and cannot be turned on at runtime
+#ifndef HAW_LOGGER_MAX_LEVEL
+#define HAW_LOGGER_MAX_LEVEL 3
+#endif
+
+#define IF_LOGLEVEL(level)  if ((level) <= HAW_LOGGER_MAX_LEVEL && haw::logger::Logger::instance()->isLevel(level))
 
 #define LOG_STREAM(type, tag, funcInfo) haw::logger::LogInput(type, tag, funcInfo).stream
 #define LOG(type, tag)  LOG_STREAM(type, tag, FUNCNAME(FUNC_INFO) + ": ")
@@ -4,6 +4,7 @@ set(HAW_LOGGER_SRC
     ${CMAKE_CURRENT_LIST_DIR}/logstream.h
     ${CMAKE_CURRENT_LIST_DIR}/logger.cpp
     ${CMAKE_CURRENT_LIST_DIR}/logger.h
+    ${CMAKE_CURRENT_LIST_DIR}/logqueue.h
     ${CMAKE_CURRENT_LIST_DIR}/logdefdest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/logdefdest.h
     ${CMAKE_CURRENT_LIST_DIR}/helpful.cpp
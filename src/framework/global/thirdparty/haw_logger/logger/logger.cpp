@@ -7,6 +7,7 @@
 #include <cstdarg>
 
 #include "logdefdest.h"
+#include "logqueue.h"
 #include "helpful.h"
 
 using namespace haw::logger;
@@ -33,6 +34,10 @@ static const char T('T');
 
 static const std::string MAIN_THREAD("main_thread");
 
+//! NOTE The writer is woken up by the first message queued after it has drained the queue.
+//! A wakeup lost in the race with going to sleep only delays the messages by this time
+static constexpr std::chrono::milliseconds WRITER_MAX_WAIT_TIME(50);
+
 static std::string leftJustified(const std::string& in, size_t width)
 {
     std::string out = in;
@@ -48,19 +53,25 @@ DateTime DateTime::now()
     milliseconds ms_d = duration_cast< milliseconds >(system_clock::now().time_since_epoch());
 
     std::time_t sec = static_cast<std::time_t>(ms_d.count() / 1000);
-    std::tm* tm = std::localtime(&sec);
-    assert(tm);
-    if (!tm) {
+    //! NOTE std::localtime uses a shared buffer, the messages are made on any thread
+    std::tm tm {};
+#ifdef _WIN32
+    bool ok = localtime_s(&tm, &sec) == 0;
+#else
+    bool ok = localtime_r(&sec, &tm) != nullptr;
+#endif
+    assert(ok);
+    if (!ok) {
         return DateTime();
     }
 
     DateTime dt;
-    dt.date.year = tm->tm_year + 1900;
-    dt.date.mon = tm->tm_mon + 1;
-    dt.date.day = tm->tm_mday;
-    dt.time.hour = tm->tm_hour;
-    dt.time.min = tm->tm_min;
-    dt.time.sec = tm->tm_sec;
+    dt.date.year = tm.tm_year + 1900;
+    dt.date.mon = tm.tm_mon + 1;
+    dt.date.day = tm.tm_mday;
+    dt.time.hour = tm.tm_hour;
+    dt.time.min = tm.tm_min;
+    dt.time.sec = tm.tm_sec;
     dt.time.msec = static_cast<int>(ms_d.count() - (sec * 1000LL));
 
     return dt;
@@ -280,6 +291,7 @@ Logger* Logger::instance()
 }
 
 Logger::Logger()
+    : m_queue(std::make_unique<LogQueue>())
 {
     setupDefault();
 }
@@ -289,6 +301,8 @@ Logger::~Logger()
 #ifdef HAW_LOGGER_QT_SUPPORT
     setIsCatchQtMsg(false);
 #endif
+    stopWriter();
+    flush();
     clearDests();
 }
 
@@ -312,7 +326,21 @@ void Logger::setupDefault()
 
 void Logger::write(const LogMsg& logMsg)
 {
+    if (m_isAsync.load(std::memory_order_relaxed) && logMsg.type != ERRR) {
+        m_queue->push(logMsg);
+        if (!m_hasQueued.exchange(true, std::memory_order_acq_rel)) {
+            m_writerCv.notify_one();
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> locker(m_mutex);
+    writeQueued();
+    writeToDests(logMsg);
+}
+
+void Logger::writeToDests(const LogMsg& logMsg)
+{
     if (isAsseptMsg(logMsg.type)) {
         for (LogDest* dest : m_dests) {
             dest->write(logMsg);
@@ -320,6 +348,74 @@ void Logger::write(const LogMsg& logMsg)
     }
 }
 
+void Logger::writeQueued()
+{
+    //! NOTE Called with m_mutex locked, so there is one consumer of the queue at a time
+    LogMsg logMsg;
+    while (m_queue->pop(logMsg)) {
+        writeToDests(logMsg);
+    }
+}
+
+void Logger::flush()
+{
+    std::lock_guard<std::mutex> locker(m_mutex);
+    writeQueued();
+}
+
+void Logger::setIsAsync(bool arg)
+{
+    if (m_isAsync == arg) {
+        return;
+    }
+
+    if (arg) {
+        m_isAsync = true;
+        m_writerRunning = true;
+        m_writer = std::make_unique<std::thread>([this]() {
+            writerLoop();
+        });
+    } else {
+        m_isAsync = false;
+        stopWriter();
+        flush();
+    }
+}
+
+bool Logger::isAsync() const
+{
+    return m_isAsync;
+}
+
+void Logger::writerLoop()
+{
+    while (m_writerRunning.load(std::memory_order_acquire)) {
+        m_hasQueued.store(false, std::memory_order_release);
+        flush();
+
+        std::unique_lock<std::mutex> lock(m_writerMutex);
+        m_writerCv.wait_for(lock, WRITER_MAX_WAIT_TIME, [this]() {
+            return m_hasQueued.load(std::memory_order_acquire) || !m_writerRunning.load(std::memory_order_acquire);
+        });
+    }
+}
+
+void Logger::stopWriter()
+{
+    if (!m_writer) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        m_writerRunning = false;
+    }
+    m_writerCv.notify_one();
+
+    m_writer->join();
+    m_writer.reset();
+}
+
 bool Logger::isAsseptMsg(const Type& type) const
 {
     return m_level == Full || m_level == Normal || isType(type);
@@ -336,6 +432,7 @@ bool Logger::isType(const Type& type) const
 void Logger::addDest(LogDest* dest)
 {
     assert(dest);
+    std::lock_guard<std::mutex> locker(m_mutex);
     m_dests.push_back(dest);
 }
 
@@ -346,6 +443,8 @@ std::vector<LogDest*> Logger::dests() const
 
 void Logger::clearDests()
 {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    writeQueued();
     for (LogDest* d : m_dests) {
         delete d;
     }
@@ -5,6 +5,9 @@
 #include <thread>
 #include <vector>
 #include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
 
 #include "logstream.h"
 
@@ -128,6 +131,7 @@ protected:
 };
 
 //! Logger ---------------------------------
+class LogQueue;
 class Logger
 {
 public:
@@ -143,7 +147,16 @@ public:
 
     void setLevel(Level level);
     Level level() const;
-    inline bool isLevel(Level level) const { return level <= m_level && level != Off; }
+    inline bool isLevel(Level level) const { return level <= m_level.load(std::memory_order_relaxed) && level != Off; }
+
+    //! NOTE In the async mode the messages are queued without locks and written to the destinations
+    //! by a separate thread. Errors are still written right away, with everything queued before them,
+    //! so that they are not lost on a crash
+    void setIsAsync(bool arg);
+    bool isAsync() const;
+
+    //! NOTE Writes the queued messages
+    void flush();
 
     std::vector<Type> types() const;
     void setTypes(const std::vector<Type>& types);
@@ -166,15 +179,28 @@ private:
     Logger();
     ~Logger();
 
+    void writeToDests(const LogMsg& logMsg);
+    void writeQueued();
+    void writerLoop();
+    void stopWriter();
+
 #ifdef HAW_LOGGER_QT_SUPPORT
     static void logMsgHandler(QtMsgType, const QMessageLogContext&, const QString&);
     static Type qtMsgTypeToString(enum QtMsgType defType);
 #endif
 
-    Level m_level = Normal;
+    std::atomic<Level> m_level = Normal;
     std::vector<LogDest*> m_dests;
     std::vector<Type> m_types;
     std::mutex m_mutex;
+
+    std::atomic<bool> m_isAsync = false;
+    std::unique_ptr<LogQueue> m_queue;
+    std::atomic<bool> m_hasQueued = false;
+    std::mutex m_writerMutex;
+    std::condition_variable m_writerCv;
+    std::unique_ptr<std::thread> m_writer;
+    std::atomic<bool> m_writerRunning = false;
 };
 
 //! LogInput ---------------------------------
@@ -0,0 +1,101 @@
+#ifndef HAW_LOGQUEUE_H
+#define HAW_LOGQUEUE_H
+
+#include <atomic>
+
+#include "logger.h"
+
+namespace haw::logger {
+//! NOTE Multiple producers, single consumer, intrusive queue (D. Vyukov).
+//! Pushing is one atomic exchange, so logging threads never wait for each other or for the writer.
+//! pop() must be called by one thread at a time
+class LogQueue
+{
+public:
+    LogQueue()
+        : m_head(&m_stub), m_tail(&m_stub) {}
+
+    ~LogQueue()
+    {
+        while (Node* n = popNode()) {
+            delete n;
+        }
+    }
+
+    void push(const LogMsg& msg)
+    {
+        pushNode(new Node(msg));
+    }
+
+    bool pop(LogMsg& msg)
+    {
+        Node* n = popNode();
+        if (!n) {
+            return false;
+        }
+
+        msg = std::move(n->msg);
+        delete n;
+        return true;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next = nullptr;
+        LogMsg msg;
+
+        Node() = default;
+        explicit Node(const LogMsg& m)
+            : msg(m) {}
+    };
+
+    void pushNode(Node* n)
+    {
+        n->next.store(nullptr, std::memory_order_relaxed);
+        Node* prev = m_head.exchange(n, std::memory_order_acq_rel);
+        prev->next.store(n, std::memory_order_release);
+    }
+
+    Node* popNode()
+    {
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &m_stub) {
+            if (!next) {
+                return nullptr;
+            }
+
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+
+        //! NOTE A push is in progress, its node will be linked in a moment
+        if (tail != m_head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        pushNode(&m_stub);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    std::atomic<Node*> m_head;
+    Node* m_tail = nullptr;
+    Node m_stub;
+};
+}
+
+#endif // HAW_LOGQUEUE_H
@@ -53,6 +53,11 @@ const Profiler::Options& Profiler::options()
     return m_options;
 }
 
+void Profiler::setFuncsEventsEnabled(bool enabled)
+{
+    m_options.funcsEventsEnabled = enabled;
+}
+
 Profiler::Printer* Profiler::printer() const
 {
     return m_printer;
@@ -170,6 +175,118 @@ void Profiler::clear()
         }
         m_steps.timers.clear();
     }
+    {
+        //! NOTE The buffers stay, the threads keep pointers to them
+        std::lock_guard<std::mutex> lock(m_events.mutex);
+        for (auto& buf : m_events.buffers) {
+            buf->count.store(0, std::memory_order_release);
+        }
+    }
+}
+
+thread_local Profiler::EventsBuffer* Profiler::s_threadEvents = nullptr;
+
+Profiler::EventsBuffer* Profiler::addEventsBuffer()
+{
+    auto buf = std::make_unique<EventsBuffer>();
+    buf->thread = std::this_thread::get_id();
+    buf->events.resize(std::max(m_options.funcsEventsMaxCount, size_t(1)));
+
+    std::lock_guard<std::mutex> lock(m_events.mutex);
+    m_events.buffers.push_back(std::move(buf));
+    return m_events.buffers.back().get();
+}
+
+void Profiler::addFuncEvent(const std::string& func, EventClock::time_point begin)
+{
+    const EventClock::time_point end = EventClock::now();
+
+    EventsBuffer* buf = s_threadEvents;
+    if (!buf) {
+        buf = addEventsBuffer();
+        s_threadEvents = buf;
+    }
+
+    const size_t count = buf->count.load(std::memory_order_relaxed);
+    FuncEvent& ev = buf->events[count % buf->events.size()];
+    ev.func = &func;
+    ev.beginNs = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - m_eventsStart).count();
+    ev.durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+
+    buf->count.store(count + 1, std::memory_order_release);
+}
+
+static void jsonEscapeToStream(std::stringstream& stream, const std::string& str)
+{
+    for (char c : str) {
+        switch (c) {
+        case '"': stream << "\\\""; break;
+        case '\\': stream << "\\\\"; break;
+        case '\n': stream << "\\n"; break;
+        case '\t': stream << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) >= 0x20) {
+                stream << c;
+            }
+        }
+    }
+}
+
+std::string Profiler::funcsEventsToTraceJson() const
+{
+    std::thread::id mainThread;
+    {
+        std::lock_guard<std::mutex> lock(m_funcs.mutex);
+        mainThread = m_funcs.threads[MAIN_THREAD_INDEX];
+    }
+
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    auto separator = [&first, &stream]() {
+        if (!first) {
+            stream << ",\n";
+        }
+        first = false;
+    };
+
+    std::lock_guard<std::mutex> lock(m_events.mutex);
+    for (size_t tid = 0; tid < m_events.buffers.size(); ++tid) {
+        const EventsBuffer& buf = *m_events.buffers[tid];
+
+        const std::string threadName = buf.thread == mainThread ? std::string("main") : "thread " + std::to_string(tid);
+
+        separator();
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << tid
+               << ",\"args\":{\"name\":\"" << threadName << "\"}}";
+
+        const size_t count = buf.count.load(std::memory_order_acquire);
+        const size_t size = buf.events.size();
+        const size_t from = count > size ? count - size : 0;
+        for (size_t i = from; i < count; ++i) {
+            const FuncEvent& ev = buf.events[i % size];
+            if (!ev.func) {
+                continue;
+            }
+
+            separator();
+            stream << "{\"name\":\"";
+            jsonEscapeToStream(stream, *ev.func);
+            stream << "\",\"cat\":\"func\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+                   << ",\"ts\":" << (ev.beginNs / 1000.0)
+                   << ",\"dur\":" << (ev.durationNs / 1000.0) << "}";
+        }
+    }
+
+    stream << "]}\n";
+    return stream.str();
+}
+
+bool Profiler::saveFuncsEvents(const std::string& filePath)
+{
+    return save_file(filePath, funcsEventsToTraceJson());
 }
 
 Profiler::Data Profiler::threadsData(Data::Mode mode) const
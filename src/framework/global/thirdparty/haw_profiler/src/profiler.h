@@ -8,6 +8,8 @@
 #include <unordered_map>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <chrono>
 #include <sstream>
 
@@ -77,6 +79,8 @@ public:
         bool funcsTraceEnabled{ false };
         size_t funcsMaxThreadCount{ 100 };
         int dataTopCount{ 150 };
+        bool funcsEventsEnabled{ false };      // record every call, for the Trace Event Format
+        size_t funcsEventsMaxCount{ 100000 };  // per thread, the oldest events are overwritten
         Options() {}
     };
 
@@ -141,6 +145,7 @@ public:
     void setup(const Options& opt = Options(), Printer* printer = nullptr);
 
     static const Options& options();
+    static void setFuncsEventsEnabled(bool enabled);
     Printer* printer() const;
 
     void stepTime(const std::string& tag, const std::string& info, bool isRestart = false);
@@ -161,6 +166,11 @@ public:
 
     bool save(const std::string& filePath);
 
+    //! NOTE Trace Event Format (chrome://tracing, Perfetto).
+    //! Meant to be called when the traced work is done, the events being recorded at this time may be torn
+    std::string funcsEventsToTraceJson() const;
+    bool saveFuncsEvents(const std::string& filePath);
+
 private:
     Profiler();
     ~Profiler();
@@ -197,6 +207,31 @@ private:
         int addThread(std::thread::id th);
     };
 
+    using EventClock = std::chrono::steady_clock;
+
+    struct FuncEvent {
+        const std::string* func{ nullptr };
+        int64_t beginNs{ 0 };
+        int64_t durationNs{ 0 };
+    };
+
+    //! NOTE Written only by its own thread without locking, the ring is allocated on the first event
+    struct EventsBuffer {
+        std::thread::id thread;
+        std::vector<FuncEvent> events;
+        std::atomic<size_t> count{ 0 }; // since the last clear, the next slot is count % events.size()
+    };
+
+    struct EventsData {
+        mutable std::mutex mutex; // only for adding a thread and for reading
+        std::vector<std::unique_ptr<EventsBuffer> > buffers;
+    };
+
+    void addFuncEvent(const std::string& func, EventClock::time_point begin);
+    EventsBuffer* addEventsBuffer();
+
+    static thread_local EventsBuffer* s_threadEvents;
+
     bool save_file(const std::string& path, const std::string& content);
 
     Printer* m_printer{ nullptr };
@@ -204,6 +239,9 @@ private:
     StepsData m_steps;
     mutable FuncsData m_funcs;
 
+    EventsData m_events;
+    const EventClock::time_point m_eventsStart{ EventClock::now() };
+
     size_t m_stackCounter{ 0 };
 };
 
@@ -215,6 +253,11 @@ struct FuncMarker
         if (Profiler::m_options.funcsTimeEnabled) {
             timer = Profiler::instance()->beginFunc(fn);
         }
+
+        if (Profiler::m_options.funcsEventsEnabled) {
+            eventBegin = Profiler::EventClock::now();
+            eventStarted = true;
+        }
     }
 
     ~FuncMarker()
@@ -222,12 +265,18 @@ struct FuncMarker
         if (Profiler::m_options.funcsTimeEnabled) {
             Profiler::instance()->endFunc(timer, func);
         }
+
+        if (eventStarted) {
+            Profiler::instance()->addFuncEvent(func, eventBegin);
+        }
     }
 
     static std::string formatSig(const std::string& sig);
 
     Profiler::FuncTimer* timer{ nullptr };
     const std::string& func;
+    Profiler::EventClock::time_point eventBegin;
+    bool eventStarted{ false };
 };
 }
 
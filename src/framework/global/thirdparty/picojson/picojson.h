@@ -744,6 +744,18 @@ inline std::string value::_serialize(int indent) const
     return s;
 }
 
+template<typename String, typename Iter> inline void _append_range(String& out, Iter first, Iter last)
+{
+    for (; first != last; ++first) {
+        out.push_back(*first);
+    }
+}
+
+template<typename Iter> inline void _append_range(std::string& out, Iter first, Iter last)
+{
+    out.append(first, last);
+}
+
 template<typename Iter> class input
 {
 protected:
@@ -793,6 +805,23 @@ public:
         return line_;
     }
 
+    // appends the characters of a string up to the next one that needs a check
+    // (a quote, a backslash or a control character), at once instead of one getc each
+    template<typename String> void take_plain(String& out)
+    {
+        Iter begin = cur();
+        Iter it = begin;
+        while (it != end_) {
+            const int ch = *it & 0xff;
+            if (ch < ' ' || ch == '"' || ch == '\\') {
+                break;
+            }
+            ++it;
+        }
+        _append_range(out, begin, it);
+        cur_ = it;
+    }
+
     void skip_ws()
     {
         while (1) {
@@ -893,6 +922,7 @@ template<typename String, typename Iter> inline bool _parse_codepoint(String& ou
 template<typename String, typename Iter> inline bool _parse_string(String& out, input<Iter>& in)
 {
     while (1) {
+        in.take_plain(out);
         int ch = in.getc();
         if (ch < ' ') {
             in.ungetc();
@@ -22,6 +22,9 @@
 #include "translation.h"
 
 #ifndef NO_QT_SUPPORT
+#include <mutex>
+#include <unordered_map>
+
 #include <QCoreApplication>
 #endif
 
@@ -29,10 +32,67 @@
 
 using namespace mu;
 
+#ifndef NO_QT_SUPPORT
+//! NOTE QCoreApplication::translate looks the string up in every installed translator,
+//! while the UI asks for the same strings (action titles etc.) over and over again
+struct TranslationCache
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, QString> strings;
+};
+
+static TranslationCache& translationCache()
+{
+    static TranslationCache cache;
+    return cache;
+}
+
+static QString cachedTranslate(const char* context, const char* key, const char* disambiguation, int n)
+{
+    //! NOTE The plural forms contain the number, so they are not cached
+    if (n >= 0) {
+        return QCoreApplication::translate(context, key, disambiguation, n);
+    }
+
+    std::string cacheKey = context ? context : "";
+    cacheKey += '\x04';
+    cacheKey += key ? key : "";
+    if (disambiguation) {
+        cacheKey += '\x04';
+        cacheKey += disambiguation;
+    }
+
+    TranslationCache& cache = translationCache();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto it = cache.strings.find(cacheKey);
+        if (it != cache.strings.end()) {
+            return it->second;
+        }
+    }
+
+    QString result = QCoreApplication::translate(context, key, disambiguation, n);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.strings.emplace(std::move(cacheKey), result);
+
+    return result;
+}
+#endif
+
+void mu::clearTranslationCache()
+{
+#ifndef NO_QT_SUPPORT
+    TranslationCache& cache = translationCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.strings.clear();
+#endif
+}
+
 static String translate(const char* context, const char* key, const char* disambiguation, int n)
 {
 #ifndef NO_QT_SUPPORT
-    return String::fromQString(QCoreApplication::translate(context, key, disambiguation, n));
+    return String::fromQString(cachedTranslate(context, key, disambiguation, n));
 #else
     UNUSED(context);
     UNUSED(disambiguation);
@@ -49,20 +109,20 @@ std::string mu::trc(const char* context, const char* key, const char* disambigua
 #ifndef NO_QT_SUPPORT
 QString mu::qtrc(const char* context, const char* key, const char* disambiguation, int n)
 {
-    return QCoreApplication::translate(context, key, disambiguation, n);
+    return cachedTranslate(context, key, disambiguation, n);
 }
 
 QString mu::qtrc(const char* context, const String& key, const char* disambiguation, int n)
 {
     ByteArray utf8 = key.toUtf8();
-    return QCoreApplication::translate(context, utf8.constChar(), disambiguation, n);
+    return cachedTranslate(context, utf8.constChar(), disambiguation, n);
 }
 
 QString mu::qtrc(const char* context, const String& key, const String& disambiguation, int n)
 {
     ByteArray keyutf8 = key.toUtf8();
     ByteArray disutf8 = disambiguation.toUtf8();
-    return QCoreApplication::translate(context, keyutf8.constChar(), disutf8.empty() ? nullptr : disutf8.constChar(), n);
+    return cachedTranslate(context, keyutf8.constChar(), disutf8.empty() ? nullptr : disutf8.constChar(), n);
 }
 
 #endif
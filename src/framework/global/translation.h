@@ -41,6 +41,9 @@ QString qtrc(const char* context, const String& key, const char* disambiguation
 QString qtrc(const char* context, const String& key, const String& disambiguation, int n = -1);
 #endif
 
+//! NOTE Translations are cached, the cache must be cleared when the translators change
+void clearTranslationCache();
+
 #ifdef NO_QT_SUPPORT
 #define QT_TRANSLATE_NOOP(ctx, msg) msg
 #endif
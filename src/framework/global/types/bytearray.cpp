@@ -70,6 +70,11 @@ ByteArray ByteArray::fromRawData(const char* data, size_t size)
     return fromRawData(reinterpret_cast<const uint8_t*>(data), size);
 }
 
+bool ByteArray::isRawData() const
+{
+    return m_raw.data != nullptr;
+}
+
 uint8_t* ByteArray::data()
 {
     detach();
@@ -192,8 +197,8 @@ void ByteArray::push_back(const uint8_t* b, size_t len)
     Data& data = *m_data.get();
     data.resize(nsize + 1);
     m_data->operator [](nsize) = 0;
-    for (size_t i = 0; i < len; ++i) {
-        data[start + i] = b[i];
+    if (len > 0) {
+        std::memcpy(&data[start], b, len);
     }
 }
 
@@ -44,6 +44,7 @@ public:
     //! NOTE Not coped!!!
     static ByteArray fromRawData(const uint8_t* data, size_t size);
     static ByteArray fromRawData(const char* data, size_t size);
+    bool isRawData() const;
 
     bool operator==(const ByteArray& other) const;
     bool operator!=(const ByteArray& other) const { return !operator==(other); }
@@ -201,7 +201,7 @@ public:
 
     bool operator ==(const SharedHashMap& another) const noexcept
     {
-        return *m_dataPtr == *another.m_dataPtr;
+        return m_dataPtr == another.m_dataPtr || *m_dataPtr == *another.m_dataPtr;
     }
 
     bool operator !=(const SharedHashMap& another) const noexcept
@@ -206,7 +206,7 @@ public:
 
     bool operator ==(const SharedMap& another) const noexcept
     {
-        return *m_dataPtr == *another.m_dataPtr;
+        return m_dataPtr == another.m_dataPtr || *m_dataPtr == *another.m_dataPtr;
     }
 
     bool operator !=(const SharedMap& another) const noexcept
@@ -226,14 +226,22 @@ void UtfCodec::utf32to8(std::u32string_view src, std::string& dst)
 // String
 // ============================
 
+//! NOTE All empty strings share one buffer, so default constructed strings don't allocate.
+//! The buffer is never changed, as it is always shared and so detached before a change
+static const std::shared_ptr<std::u16string>& emptyData()
+{
+    static const std::shared_ptr<std::u16string> data = std::make_shared<std::u16string>();
+    return data;
+}
+
 String::String()
+    : m_data(emptyData())
 {
-    m_data = std::make_shared<std::u16string>();
 }
 
 String::String(const char16_t* str)
 {
-    m_data = std::make_shared<std::u16string>(str ? str : u"");
+    m_data = (str && str[0]) ? std::make_shared<std::u16string>(str) : emptyData();
 #ifdef STRING_DEBUG_HACK
     updateDebugView();
 #endif
@@ -250,8 +258,8 @@ String::String(const Char& ch)
 
 String::String(const Char* unicode, size_t size)
 {
-    if (!unicode) {
-        m_data = std::make_shared<std::u16string>();
+    if (!unicode || size == 0) {
+        m_data = emptyData();
         return;
     }
 
@@ -405,15 +413,55 @@ String String::fromUtf8(const char* str)
 ByteArray String::toUtf8() const
 {
     ByteArray ba;
-    std::u16string_view v(constStr());
-    try {
-        utf8::utf16to8(v.begin(), v.end(), std::back_inserter(ba));
-    } catch (const std::exception& e) {
-        LOGE() << e.what();
-    }
+    appendUtf8To(ba);
     return ba;
 }
 
+void String::appendUtf8To(ByteArray& dest) const
+{
+    //! NOTE Encoded straight into dest, byte by byte appending is much slower
+    const std::u16string& v = constStr();
+
+    const size_t start = dest.size();
+    dest.resize(start + v.size() * 3);
+    uint8_t* begin = dest.data();
+    uint8_t* out = begin + start;
+
+    for (size_t i = 0; i < v.size(); ++i) {
+        char32_t c = v[i];
+        if (c < 0x80) {
+            *out++ = static_cast<uint8_t>(c);
+            continue;
+        }
+
+        if (c < 0x800) {
+            *out++ = static_cast<uint8_t>(0xC0 | (c >> 6));
+            *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+            continue;
+        }
+
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            if (c <= 0xDBFF && i + 1 < v.size() && v[i + 1] >= 0xDC00 && v[i + 1] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (v[++i] - 0xDC00);
+                *out++ = static_cast<uint8_t>(0xF0 | (c >> 18));
+                *out++ = static_cast<uint8_t>(0x80 | ((c >> 12) & 0x3F));
+                *out++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+                *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+                continue;
+            }
+
+            LOGE() << "invalid utf-16, unpaired surrogate";
+            c = 0xFFFD;
+        }
+
+        *out++ = static_cast<uint8_t>(0xE0 | (c >> 12));
+        *out++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+        *out++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+    }
+
+    dest.resize(out - begin);
+}
+
 String String::fromAscii(const char* str, size_t size)
 {
     if (!str) {
@@ -496,23 +544,31 @@ std::u32string String::toStdU32String() const
 }
 
 #ifndef NO_QT_SUPPORT
+//! NOTE QString and std::u16string can't share a buffer, so the conversions copy the characters once,
+//! straight into the new buffer, and the empty strings are converted without allocating
 String String::fromQString(const QString& str)
 {
-    const QChar* qu = str.unicode();
-    static_assert(sizeof(QChar) == sizeof(char16_t));
-    const char16_t* u = reinterpret_cast<const char16_t*>(qu);
-
-    String s;
-    s.mutStr() = std::u16string(u, u + str.size());
-    return s;
+    static_assert(sizeof(QChar) == sizeof(Char));
+    return String(reinterpret_cast<const Char*>(str.unicode()), static_cast<size_t>(str.size()));
 }
 
 QString String::toQString() const
 {
+    if (empty()) {
+        return QString();
+    }
+
     static_assert(sizeof(QChar) == sizeof(char16_t));
     return QString(reinterpret_cast<const QChar*>(constStr().data()), static_cast<int>(size()));
 }
 
+bool String::operator ==(const QString& s) const
+{
+    static_assert(sizeof(QChar) == sizeof(char16_t));
+    std::u16string_view view(reinterpret_cast<const char16_t*>(s.unicode()), static_cast<size_t>(s.size()));
+    return constStr() == view;
+}
+
 #endif
 
 size_t String::size() const
@@ -992,10 +1048,30 @@ String String::toXmlEscaped(char16_t c)
 String String::toXmlEscaped(const String& s)
 {
     String escaped;
-    escaped.reserve(s.size());
-    for (size_t i = 0; i < s.size(); ++i) {
-        char16_t c = s.at(i).unicode();
-        escaped += toXmlEscaped(c);
+    Mutator out = escaped.mutStr();
+    out.reserve(s.size());
+    for (char16_t c : s.constStr()) {
+        switch (c) {
+        case u'<':
+            out += u"&lt;";
+            break;
+        case u'>':
+            out += u"&gt;";
+            break;
+        case u'&':
+            out += u"&amp;";
+            break;
+        case u'\"':
+            out += u"&quot;";
+            break;
+        default:
+            // ignore invalid characters in xml 1.0
+            if ((c < 0x0020 && c != 0x0009 && c != 0x000A && c != 0x000D)) {
+                break;
+            }
+            out += c;
+            break;
+        }
     }
     return escaped;
 }
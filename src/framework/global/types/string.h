@@ -207,14 +207,14 @@ public:
     static String fromQString(const QString& str);
     QString toQString() const;
 
-    inline bool operator ==(const QString& s) const { return toQString() == s; }
+    bool operator ==(const QString& s) const;
     inline bool operator !=(const QString& s) const { return !operator ==(s); }
 #endif
 
     String& operator=(const char16_t* str);
     void reserve(size_t i);
 
-    inline bool operator ==(const String& s) const { return constStr() == s.constStr(); }
+    inline bool operator ==(const String& s) const { return m_data == s.m_data || constStr() == s.constStr(); }
     inline bool operator !=(const String& s) const { return !operator ==(s); }
 
     bool operator ==(const AsciiStringView& s) const;
@@ -246,6 +246,7 @@ public:
 
     static String fromUtf8(const char* str);
     ByteArray toUtf8() const;
+    void appendUtf8To(ByteArray& dest) const;
 
     static String fromAscii(const char* str, size_t size = mu::nidx);
     ByteArray toAscii(bool* ok = nullptr) const;
@@ -0,0 +1,126 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_MPE_CURVESCACHE_H
+#define MU_MPE_CURVESCACHE_H
+
+#include <array>
+#include <functional>
+
+#include "mpetypes.h"
+
+namespace mu::mpe {
+//! NOTE Remembers the curves calculated for the latest notes, so that the notes with the same
+//!      articulations and dynamics share a single curve instead of calculating and storing their own copies.
+//!      There is one cache per thread, so the events of different tracks can be rendered in parallel
+template<typename KeyT, typename CurveT, size_t CAPACITY = 256>
+class CurvesCache
+{
+public:
+    static CurvesCache& instance()
+    {
+        thread_local CurvesCache cache;
+        return cache;
+    }
+
+    template<typename CalculateF>
+    const CurveT& resolve(const KeyT& key, const CalculateF& calculate)
+    {
+        Entry& entry = m_entries[key.hash() % CAPACITY];
+
+        if (!entry.isValid || !(entry.key == key)) {
+            entry.key = key;
+            entry.curve = calculate();
+            entry.isValid = true;
+        }
+
+        return entry.curve;
+    }
+
+private:
+    CurvesCache() = default;
+
+    struct Entry {
+        KeyT key;
+        CurveT curve;
+        bool isValid = false;
+    };
+
+    std::array<Entry, CAPACITY> m_entries;
+};
+
+template<typename T>
+inline size_t curveHash(const ValuesCurve<T>& curve, size_t seed = 0)
+{
+    for (const auto& pair : curve) {
+        seed = seed * 31 + std::hash<duration_percentage_t>()(pair.first);
+        seed = seed * 31 + std::hash<T>()(pair.second);
+    }
+
+    return seed;
+}
+
+struct PitchCurveKey {
+    PitchCurve offsetMap;
+    pitch_level_t pitchRange = 0;
+
+    size_t hash() const
+    {
+        return curveHash(offsetMap, std::hash<pitch_level_t>()(pitchRange));
+    }
+
+    bool operator==(const PitchCurveKey& other) const
+    {
+        return pitchRange == other.pitchRange
+               && offsetMap == other.offsetMap;
+    }
+};
+
+struct ExpressionCurveKey {
+    ExpressionCurve offsetMap;
+    dynamic_level_t actualDynamicLevel = 0;
+    dynamic_level_t articulationDynamicLevel = 0;
+    float requiredVelocityFraction = 0.f;
+
+    size_t hash() const
+    {
+        size_t seed = std::hash<dynamic_level_t>()(actualDynamicLevel);
+        seed = seed * 31 + std::hash<dynamic_level_t>()(articulationDynamicLevel);
+        seed = seed * 31 + std::hash<float>()(requiredVelocityFraction);
+
+        return curveHash(offsetMap, seed);
+    }
+
+    bool operator==(const ExpressionCurveKey& other) const
+    {
+        return actualDynamicLevel == other.actualDynamicLevel
+               && articulationDynamicLevel == other.articulationDynamicLevel
+               && requiredVelocityFraction == other.requiredVelocityFraction
+               && offsetMap == other.offsetMap;
+    }
+};
+
+using PitchCurvesCache = CurvesCache<PitchCurveKey, PitchCurve>;
+using ExpressionCurvesCache = CurvesCache<ExpressionCurveKey, ExpressionCurve>;
+}
+
+#endif // MU_MPE_CURVESCACHE_H
@@ -26,11 +26,13 @@
 #include <variant>
 #include <vector>
 #include <optional>
+#include <limits>
 
 #include "async/channel.h"
 #include "realfn.h"
 
 #include "mpetypes.h"
+#include "curvescache.h"
 #include "soundid.h"
 
 namespace mu::mpe {
@@ -190,19 +192,27 @@ private:
     void calculatePitchCurve(const ArticulationMap& articulationsApplied)
     {
         const PitchPattern::PitchOffsetMap& appliedOffsetMap = articulationsApplied.averagePitchOffsetMap();
+        pitch_level_t pitchRange = articulationsApplied.averagePitchRange();
 
-        m_pitchCtx.pitchCurve = appliedOffsetMap;
-
-        if (articulationsApplied.averagePitchRange() == 0 || articulationsApplied.averagePitchRange() == PITCH_LEVEL_STEP) {
+        if (pitchRange == 0 || pitchRange == PITCH_LEVEL_STEP) {
+            m_pitchCtx.pitchCurve = appliedOffsetMap;
             return;
         }
 
-        float ratio = static_cast<float>(articulationsApplied.averagePitchRange()) / static_cast<float>(PITCH_LEVEL_STEP);
-        float patternUnitRatio = PITCH_LEVEL_STEP / static_cast<float>(ONE_PERCENT);
+        PitchCurveKey key { appliedOffsetMap, pitchRange };
 
-        for (auto& pair : m_pitchCtx.pitchCurve) {
-            pair.second = static_cast<pitch_level_t>(RealRound(static_cast<float>(pair.second) * ratio * patternUnitRatio, 0));
-        }
+        m_pitchCtx.pitchCurve = PitchCurvesCache::instance().resolve(key, [&appliedOffsetMap, pitchRange]() {
+            PitchCurve result = appliedOffsetMap;
+
+            float ratio = static_cast<float>(pitchRange) / static_cast<float>(PITCH_LEVEL_STEP);
+            float patternUnitRatio = PITCH_LEVEL_STEP / static_cast<float>(ONE_PERCENT);
+
+            for (auto& pair : result) {
+                pair.second = static_cast<pitch_level_t>(RealRound(static_cast<float>(pair.second) * ratio * patternUnitRatio, 0));
+            }
+
+            return result;
+        });
     }
 
     void calculateExpressionCurve(const ArticulationMap& articulationsApplied, const float requiredVelocityFraction)
@@ -227,15 +237,23 @@ private:
             return;
         }
 
-        float ratio = static_cast<float>(actualDynamicLevel) / static_cast<float>(articulationDynamicLevel);
+        ExpressionCurveKey key { appliedOffsetMap, actualDynamicLevel, articulationDynamicLevel, requiredVelocityFraction };
 
-        for (auto& pair : m_expressionCtx.expressionCurve) {
-            pair.second = static_cast<dynamic_level_t>(RealRound(pair.second * ratio, 0));
-        }
+        m_expressionCtx.expressionCurve = ExpressionCurvesCache::instance().resolve(key, [&]() {
+            ExpressionCurve result = appliedOffsetMap;
 
-        if (!RealIsNull(requiredVelocityFraction)) {
-            m_expressionCtx.expressionCurve.amplifyVelocity(requiredVelocityFraction);
-        }
+            float ratio = static_cast<float>(actualDynamicLevel) / static_cast<float>(articulationDynamicLevel);
+
+            for (auto& pair : result) {
+                pair.second = static_cast<dynamic_level_t>(RealRound(pair.second * ratio, 0));
+            }
+
+            if (!RealIsNull(requiredVelocityFraction)) {
+                result.amplifyVelocity(requiredVelocityFraction);
+            }
+
+            return result;
+        });
     }
 
     ArrangementContext m_arrangementCtx;
@@ -369,10 +387,77 @@ static const PlaybackSetupData GENERIC_SETUP_DATA = {
 
 static const String GENERIC_SETUP_DATA_STRING = GENERIC_SETUP_DATA.toString();
 
+//! NOTE A change of the events of a track, so only the edited part of the track has to be sent.
+//!      The events in the removed ranges (both bounds included) are replaced with the inserted ones
+struct PlaybackEventsDelta {
+    struct Range {
+        timestamp_t from = std::numeric_limits<timestamp_t>::min();
+        timestamp_t to = std::numeric_limits<timestamp_t>::max();
+    };
+
+    std::vector<Range> removedRanges;
+    PlaybackEventsMap insertedEvents;
+
+    //! NOTE All the previous events have been removed
+    bool isReset = false;
+
+    static PlaybackEventsDelta reset(const PlaybackEventsMap& events)
+    {
+        PlaybackEventsDelta result;
+        result.insertedEvents = events;
+        result.isReset = true;
+
+        return result;
+    }
+
+    //! NOTE The events replaced by the delta are moved to `removedEvents`, if it's provided
+    void applyTo(PlaybackEventsMap& events, PlaybackEventsMap* removedEvents = nullptr) const
+    {
+        if (isReset) {
+            if (removedEvents) {
+                *removedEvents = std::move(events);
+            }
+
+            events = insertedEvents;
+            return;
+        }
+
+        for (const Range& range : removedRanges) {
+            auto first = events.lower_bound(range.from);
+            auto last = events.upper_bound(range.to);
+
+            if (removedEvents) {
+                for (auto it = first; it != last; ++it) {
+                    (*removedEvents)[it->first] = std::move(it->second);
+                }
+            }
+
+            events.erase(first, last);
+        }
+
+        for (const auto& pair : insertedEvents) {
+            auto search = events.find(pair.first);
+
+            if (search == events.end()) {
+                events.emplace(pair.first, pair.second);
+                continue;
+            }
+
+            if (removedEvents) {
+                (*removedEvents)[pair.first] = std::move(search->second);
+            }
+
+            search->second = pair.second;
+        }
+    }
+};
+
+using PlaybackEventsDeltaChanges = async::Channel<PlaybackEventsDelta>;
+
 struct PlaybackData {
     PlaybackEventsMap originEvents;
     PlaybackSetupData setupData;
-    PlaybackEventsChanges mainStream;
+    PlaybackEventsDeltaChanges mainStream;
     PlaybackEventsChanges offStream;
     DynamicLevelMap dynamicLevelMap;
     DynamicLevelChanges dynamicLevelChanges;
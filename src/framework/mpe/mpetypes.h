@@ -26,9 +26,11 @@
 #include <stdint.h>
 #include <math.h>
 #include <algorithm>
+#include <array>
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -533,24 +535,32 @@ struct ArticulationsProfile
 
     const ArticulationPattern& pattern(const ArticulationType type) const
     {
-        auto search = m_patterns.find(type);
+        const std::optional<ArticulationPattern>* search = patternSlot(type);
 
-        if (search == m_patterns.cend()) {
+        if (!search || !search->has_value()) {
             static ArticulationPattern emptyPattern;
             return emptyPattern;
         }
 
-        return search->second;
+        return search->value();
     }
 
     void setPattern(const ArticulationType type, const ArticulationPattern& scope)
     {
         m_patterns.insert_or_assign(type, scope);
+
+        if (std::optional<ArticulationPattern>* slot = patternSlot(type)) {
+            *slot = scope;
+        }
     }
 
     void removePattern(const ArticulationType type)
     {
         m_patterns.erase(type);
+
+        if (std::optional<ArticulationPattern>* slot = patternSlot(type)) {
+            slot->reset();
+        }
     }
 
     const SharedHashMap<ArticulationType, ArticulationPattern>& data() const
@@ -560,7 +570,8 @@ struct ArticulationsProfile
 
     bool contains(const ArticulationType type) const
     {
-        return m_patterns.find(type) != m_patterns.cend();
+        const std::optional<ArticulationPattern>* search = patternSlot(type);
+        return search && search->has_value();
     }
 
     bool isValid() const
@@ -574,7 +585,24 @@ struct ArticulationsProfile
     }
 
 private:
+    //! NOTE pattern() is called for every articulation of every note during playback rendering,
+    //! so the patterns are also kept in a flat array indexed by the articulation type
+    using PatternSlots = std::array<std::optional<ArticulationPattern>, static_cast<size_t>(ArticulationType::Last)>;
+
+    const std::optional<ArticulationPattern>* patternSlot(const ArticulationType type) const
+    {
+        const size_t idx = static_cast<size_t>(type);
+        return idx < m_patternSlots.size() ? &m_patternSlots[idx] : nullptr;
+    }
+
+    std::optional<ArticulationPattern>* patternSlot(const ArticulationType type)
+    {
+        const size_t idx = static_cast<size_t>(type);
+        return idx < m_patternSlots.size() ? &m_patternSlots[idx] : nullptr;
+    }
+
     SharedHashMap<ArticulationType, ArticulationPattern> m_patterns;
+    PatternSlots m_patternSlots;
 };
 
 using ArticulationsProfilePtr = std::shared_ptr<ArticulationsProfile>;
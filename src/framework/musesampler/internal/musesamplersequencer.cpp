@@ -87,8 +87,7 @@ void MuseSamplerSequencer::init(MuseSamplerLibHandlerPtr samplerLib, ms_MuseSamp
 
 void MuseSamplerSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
-    m_offStreamEvents.clear();
-    m_offStreamFlushed.notify();
+    Timeline events;
 
     for (const auto& pair : changes) {
         for (const auto& event : pair.second) {
@@ -105,13 +104,15 @@ void MuseSamplerSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& c
             ms_NoteArticulation articulationFlag = noteArticulationTypes(noteEvent);
 
             ms_AuditionStartNoteEvent noteOn = { pitch, articulationFlag, 0.5 };
-            m_offStreamEvents[timestampFrom].emplace(std::move(noteOn));
+            events.add(timestampFrom, std::move(noteOn));
 
             ms_AuditionStopNoteEvent noteOff = { pitch };
-            m_offStreamEvents[timestampTo].emplace(std::move(noteOff));
+            events.add(timestampTo, std::move(noteOff));
         }
     }
 
+    m_offStreamEvents = std::move(events);
+    m_offStreamFlushed.notify();
     updateOffSequenceIterator();
 }
 
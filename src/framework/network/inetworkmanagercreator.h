@@ -34,6 +34,11 @@ public:
     virtual ~INetworkManagerCreator() = default;
 
     virtual INetworkManagerPtr makeNetworkManager() const = 0;
+
+    //! NOTE GET replies are kept in a disk cache: they are revalidated with conditional requests
+    //! and the cached data is used when the network can't be reached.
+    //! Only for public data, e.g. not for requests with user credentials
+    virtual INetworkManagerPtr makeCachingNetworkManager() const = 0;
 };
 }
 
@@ -22,6 +22,7 @@
 #include "networkmanager.h"
 
 #include <QNetworkAccessManager>
+#include <QNetworkDiskCache>
 #include <QNetworkReply>
 #include <QTimer>
 #include <QEventLoop>
@@ -49,6 +50,13 @@ NetworkManager::~NetworkManager()
     }
 }
 
+void NetworkManager::setDiskCachePath(const io::path_t& path)
+{
+    QNetworkDiskCache* cache = new QNetworkDiskCache(m_manager);
+    cache->setCacheDirectory(path.toQString());
+    m_manager->setCache(cache);
+}
+
 Ret NetworkManager::get(const QUrl& url, IncomingDevice* incomingData, const RequestHeaders& headers)
 {
     return execRequest(GET_REQUEST, url, incomingData, nullptr, headers);
@@ -114,6 +122,18 @@ Ret NetworkManager::execRequest(RequestType requestType, const QUrl& url, Incomi
     }
 
     Ret ret = waitForReplyFinished(reply, NET_TIMEOUT_MS);
+
+    if (canLoadFromCache(requestType, request, ret)) {
+        LOGI() << "failed to reach " << url.toString() << ", will use the cached data";
+
+        request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysCache);
+        openDevice(m_incomingData, QIODevice::WriteOnly);
+
+        reply = receiveReply(requestType, request);
+        prepareReplyReceive(reply, m_incomingData);
+        ret = waitForReplyFinished(reply, NET_TIMEOUT_MS);
+    }
+
     if (!ret) {
         LOGE() << ret.toString();
     }
@@ -226,6 +246,21 @@ void NetworkManager::prepareReplyTransmit(QNetworkReply* reply)
     });
 }
 
+bool NetworkManager::canLoadFromCache(RequestType requestType, const QNetworkRequest& request, const Ret& ret) const
+{
+    if (ret || requestType != GET_REQUEST || !m_incomingData || ret.code() == static_cast<int>(Err::Abort)) {
+        return false;
+    }
+
+    //! NOTE Only when the server didn't answer, an error answer is up to date
+    if (ret.data("status").has_value()) {
+        return false;
+    }
+
+    QAbstractNetworkCache* cache = m_manager->cache();
+    return cache && cache->metaData(request.url()).isValid();
+}
+
 Ret NetworkManager::waitForReplyFinished(QNetworkReply* reply, int timeoutMs)
 {
     QTimer timeoutTimer;
@@ -24,6 +24,8 @@
 
 #include "inetworkmanager.h"
 
+#include "io/path.h"
+
 class QNetworkAccessManager;
 class QNetworkRequest;
 class QNetworkReply;
@@ -37,6 +39,8 @@ public:
     explicit NetworkManager(QObject* parent = nullptr);
     ~NetworkManager() override;
 
+    void setDiskCachePath(const io::path_t& path);
+
     Ret get(const QUrl& url, IncomingDevice* incomingData, const RequestHeaders& headers = RequestHeaders()) override;
     Ret head(const QUrl& url, const RequestHeaders& headers = RequestHeaders()) override;
     Ret post(const QUrl& url, OutgoingDevice* outgoingData, IncomingDevice* incomingData,
@@ -71,6 +75,8 @@ private:
     void prepareReplyReceive(QNetworkReply* reply, IncomingDevice* incomingData);
     void prepareReplyTransmit(QNetworkReply* reply);
 
+    bool canLoadFromCache(RequestType requestType, const QNetworkRequest& request, const Ret& ret) const;
+
     Ret waitForReplyFinished(QNetworkReply* reply, int timeoutMs);
     Ret errorFromReply(const QNetworkReply* reply) const;
 
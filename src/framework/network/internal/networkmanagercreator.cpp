@@ -29,3 +29,10 @@ INetworkManagerPtr NetworkManagerCreator::makeNetworkManager() const
 {
     return std::make_shared<NetworkManager>();
 }
+
+INetworkManagerPtr NetworkManagerCreator::makeCachingNetworkManager() const
+{
+    auto manager = std::make_shared<NetworkManager>();
+    manager->setDiskCachePath(globalConfiguration()->userAppDataPath() + "/network_cache");
+    return manager;
+}
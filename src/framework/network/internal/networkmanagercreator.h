@@ -24,11 +24,17 @@
 
 #include "inetworkmanagercreator.h"
 
+#include "modularity/ioc.h"
+#include "iglobalconfiguration.h"
+
 namespace mu::network {
 class NetworkManagerCreator : public INetworkManagerCreator
 {
+    INJECT(network, framework::IGlobalConfiguration, globalConfiguration)
+
 public:
     INetworkManagerPtr makeNetworkManager() const override;
+    INetworkManagerPtr makeCachingNetworkManager() const override;
 };
 }
 
@@ -22,6 +22,9 @@
 
 #include "environment.h"
 
+#include <future>
+#include <vector>
+
 #include "framework/global/globalmodule.h"
 
 using namespace mu::testing;
@@ -81,8 +84,17 @@ void Environment::setup()
     }
 
     globalModule.onInit(runMode);
+
+    std::vector<std::future<void> > concurrentInits;
     for (mu::modularity::IModuleSetup* m : m_dependencyModules) {
         m->onInit(runMode);
+        concurrentInits.push_back(std::async(std::launch::async, [m, runMode]() {
+            m->onInitConcurrent(runMode);
+        }));
+    }
+
+    for (std::future<void>& init : concurrentInits) {
+        init.get();
     }
 
     globalModule.onAllInited(runMode);
@@ -96,3 +96,12 @@ void VstFxProcessor::process(float* buffer, unsigned int sampleCount)
     m_vstAudioClient->setBlockSize(sampleCount);
     m_vstAudioClient->process(buffer, sampleCount);
 }
+
+mu::audio::samples_t VstFxProcessor::latency() const
+{
+    if (!m_inited) {
+        return 0;
+    }
+
+    return m_vstAudioClient->latency();
+}
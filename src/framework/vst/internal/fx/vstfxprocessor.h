@@ -25,6 +25,7 @@ public:
     bool active() const override;
     void setActive(bool active) override;
     void process(float* buffer, unsigned int sampleCount) override;
+    audio::samples_t latency() const override;
 
 private:
     bool m_inited = false;
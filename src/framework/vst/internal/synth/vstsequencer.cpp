@@ -43,26 +43,47 @@ void VstSequencer::init(ParamsMapping&& mapping)
 
 void VstSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
-    m_offStreamEvents.clear();
+    Timeline events;
+    updatePlaybackEvents(events, changes);
+
+    m_offStreamEvents = std::move(events);
     m_offStreamFlushed.notify();
-    updatePlaybackEvents(m_offStreamEvents, changes);
     updateOffSequenceIterator();
 }
 
 void VstSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
-    m_mainStreamEvents.clear();
+    Timeline events;
+    updatePlaybackEvents(events, changes);
+
+    m_mainStreamEvents = std::move(events);
     m_mainStreamFlushed.notify();
-    updatePlaybackEvents(m_mainStreamEvents, changes);
+    updateMainSequenceIterator();
+}
+
+void VstSequencer::applyMainStreamDelta(const mpe::PlaybackEventsMap& removedEvents, const mpe::PlaybackEventsMap& insertedEvents)
+{
+    if (!removedEvents.empty()) {
+        Timeline expiredEvents;
+        updatePlaybackEvents(expiredEvents, removedEvents);
+        m_mainStreamEvents.remove(expiredEvents);
+        m_mainStreamFlushed.notify();
+    }
+
+    Timeline newEvents;
+    updatePlaybackEvents(newEvents, insertedEvents);
+    m_mainStreamEvents.merge(newEvents);
+
     updateMainSequenceIterator();
 }
 
 void VstSequencer::updateDynamicChanges(const mpe::DynamicLevelMap& changes)
 {
     m_dynamicEvents.clear();
+    m_dynamicEvents.reserve(changes.size());
 
     for (const auto& pair : changes) {
-        m_dynamicEvents[pair.first].emplace(expressionLevel(pair.second));
+        m_dynamicEvents.add(pair.first, expressionLevel(pair.second));
     }
 
     updateDynamicChangesIterator();
@@ -74,8 +95,16 @@ audio::gain_t VstSequencer::currentGain() const
     return expressionLevel(currentDynamicLevel);
 }
 
-void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
+void VstSequencer::updatePlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& changes)
 {
+    size_t eventsCount = 0;
+    for (const auto& pair : changes) {
+        eventsCount += pair.second.size();
+    }
+
+    //! NOTE Note on, note off and the controllers of every note
+    destination.reserve(destination.size() + eventsCount * 3);
+
     for (const auto& pair : changes) {
         for (const mpe::PlaybackEvent& event : pair.second) {
             if (!std::holds_alternative<mpe::NoteEvent>(event)) {
@@ -91,15 +120,17 @@ void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe
             float velocityFraction = noteVelocityFraction(noteEvent);
             float tuning = noteTuning(noteEvent, noteId);
 
-            destination[timestampFrom].emplace(buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
-            destination[timestampTo].emplace(buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampFrom, buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampTo, buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
 
             appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, SUSTAIN_IDX);
         }
     }
+
+    destination.finalize();
 }
 
-void VstSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void VstSequencer::appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                        const mpe::ArticulationTypeSet& appliableTypes, const ControllIdx controlIdx)
 {
     auto controlIt = m_mapping.find(controlIdx);
@@ -120,10 +151,10 @@ void VstSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe:
         const mpe::ArticulationAppliedData& articulationData = noteEvent.expressionCtx().articulations.at(currentType);
         const mpe::ArticulationMeta& articulationMeta = articulationData.meta;
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(buildParamInfo(controlIt->second, 1 /*on*/));
-        destination[articulationMeta.timestamp + articulationMeta.overallDuration].emplace(buildParamInfo(controlIt->second, 0 /*off*/));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, buildParamInfo(controlIt->second, 1 /*on*/));
+        destination.add(articulationMeta.timestamp + articulationMeta.overallDuration, buildParamInfo(controlIt->second, 0 /*off*/));
     } else {
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(buildParamInfo(controlIt->second, 0 /*off*/));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, buildParamInfo(controlIt->second, 0 /*off*/));
     }
 }
 
@@ -135,6 +135,16 @@ void VstAudioClient::flush()
     m_paramChanges.clearQueue();
 }
 
+audio::samples_t VstAudioClient::latency() const
+{
+    IAudioProcessorPtr processor = pluginProcessor();
+    if (!processor) {
+        return 0;
+    }
+
+    return processor->getLatencySamples();
+}
+
 void VstAudioClient::setBlockSize(unsigned int samples)
 {
     if (m_samplesInfo.samplesPerBlock == samples) {
@@ -44,6 +44,8 @@ public:
     audio::samples_t process(float* output, audio::samples_t samplesPerChannel);
     void flush();
 
+    audio::samples_t latency() const;
+
     void setBlockSize(unsigned int samples);
     void setSampleRate(unsigned int sampleRate);
 
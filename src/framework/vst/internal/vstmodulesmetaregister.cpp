@@ -24,6 +24,7 @@
 
 #include <QJsonDocument>
 
+#include "containers.h"
 #include "io/file.h"
 #include "mpe/events.h"
 
@@ -51,13 +52,20 @@ void VstModulesMetaRegister::registerPath(const audio::AudioResourceId& resource
     io::File file(m_knownPluginsDir + "/" + resourceId + ".json");
     file.open(io::IODevice::WriteOnly);
 
+    //! NOTE The plugin is registered again when its bundle has changed, so the old meta is dropped
+    removeMeta(resourceId);
+
+    QString modified = lastModified(path);
+
     QJsonObject obj;
     obj.insert(QStringLiteral("enabled"), false);
     obj.insert(QStringLiteral("type"), "");
     obj.insert(QStringLiteral("meta"), "");
     obj.insert(QStringLiteral("path"), path.toQString());
+    obj.insert(QStringLiteral("modified"), modified);
 
-    m_paths.emplace(resourceId, path);
+    m_paths.insert_or_assign(resourceId, path);
+    m_modified.insert_or_assign(resourceId, std::move(modified));
 
     file.write(QJsonDocument(obj).toJson());
     file.close();
@@ -105,6 +113,7 @@ void VstModulesMetaRegister::registerPlugin(const audio::AudioResourceId& resour
             obj.insert(QStringLiteral("type"), pluginTypeToString(currentType));
             obj.insert(QStringLiteral("meta"), metaToJson(meta));
             obj.insert(QStringLiteral("path"), pluginPath->second.toQString());
+            obj.insert(QStringLiteral("modified"), mu::value(m_modified, resourceId));
 
             m_metaMap[currentType].insert(std::move(meta));
 
@@ -119,9 +128,30 @@ void VstModulesMetaRegister::registerPlugin(const audio::AudioResourceId& resour
 void VstModulesMetaRegister::clear()
 {
     m_paths.clear();
+    m_modified.clear();
     m_metaMap.clear();
 }
 
+void VstModulesMetaRegister::removeMeta(const audio::AudioResourceId& resourceId)
+{
+    for (auto& pair : m_metaMap) {
+        audio::AudioResourceMetaSet& metaSet = pair.second;
+
+        for (auto it = metaSet.begin(); it != metaSet.end();) {
+            if (it->id == resourceId) {
+                it = metaSet.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+QString VstModulesMetaRegister::lastModified(const io::path_t& path) const
+{
+    return fileSystem()->lastModified(path).toString().toQString();
+}
+
 const io::path_t& VstModulesMetaRegister::pluginPath(const audio::AudioResourceId& resourceId) const
 {
     auto search = m_paths.find(resourceId);
@@ -159,6 +189,13 @@ bool VstModulesMetaRegister::exists(const io::path_t& path) const
     return !pluginPath(io::basename(path).toStdString()).empty();
 }
 
+bool VstModulesMetaRegister::isModified(const io::path_t& path) const
+{
+    //! NOTE The plugins registered before the modification time was stored are scanned once again
+    audio::AudioResourceId resourceId = io::basename(path).toStdString();
+    return mu::value(m_modified, resourceId) != lastModified(path);
+}
+
 bool VstModulesMetaRegister::isEmpty() const
 {
     return m_metaMap.empty() && m_paths.empty();
@@ -189,7 +226,9 @@ void VstModulesMetaRegister::load()
         }
 
         io::path_t pluginPath(object.value(QStringLiteral("path")).toString().toStdString());
-        m_paths.emplace(io::basename(pluginPath).toStdString(), std::move(pluginPath));
+        audio::AudioResourceId resourceId = io::basename(pluginPath).toStdString();
+        m_modified.emplace(resourceId, object.value(QStringLiteral("modified")).toString());
+        m_paths.emplace(std::move(resourceId), std::move(pluginPath));
 
         file.close();
     }
@@ -44,6 +44,7 @@ public:
 
     using ModulesMap = std::unordered_map<audio::AudioResourceId, PluginModulePtr>;
     using PathMap = std::unordered_map<audio::AudioResourceId, io::path_t>;
+    using ModifiedMap = std::unordered_map<audio::AudioResourceId, QString>;
 
     void init();
     void registerPath(const audio::AudioResourceId& resourceId, const io::path_t& path);
@@ -54,6 +55,7 @@ public:
 
     bool exists(const audio::AudioResourceId& resourceId) const;
     bool exists(const io::path_t& path) const;
+    bool isModified(const io::path_t& path) const;
     bool isEmpty() const;
 
 private:
@@ -62,6 +64,9 @@ private:
     void load();
     void save();
 
+    void removeMeta(const audio::AudioResourceId& resourceId);
+    QString lastModified(const io::path_t& path) const;
+
     QJsonObject metaToJson(const audio::AudioResourceMeta& meta) const;
     audio::AudioResourceMeta metaFromJson(const QJsonObject& object) const;
     VstPluginType pluginTypeFromString(const QString& string) const;
@@ -73,6 +78,7 @@ private:
 
     std::map<VstPluginType, audio::AudioResourceMetaSet> m_metaMap;
     PathMap m_paths;
+    ModifiedMap m_modified;
 };
 }
 
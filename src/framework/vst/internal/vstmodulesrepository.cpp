@@ -143,14 +143,20 @@ void VstModulesRepository::refresh()
 
     m_modules.clear();
 
+    //! NOTE Only the new and the changed bundles are loaded here,
+    //! the known ones are loaded on demand (see addPluginModule)
+    auto needScan = [this](const io::path_t& pluginPath) {
+        return !m_knownPlugins.exists(pluginPath) || m_knownPlugins.isModified(pluginPath);
+    };
+
     for (const std::string& pluginPath : pluginPathsFromDefaultLocation()) {
-        if (!m_knownPlugins.exists(io::path_t(pluginPath))) {
+        if (needScan(io::path_t(pluginPath))) {
             addModule(io::path_t(pluginPath));
         }
     }
 
     for (const io::path_t& pluginPath : pluginPathsFromCustomLocations(configuration()->userVstDirectories())) {
-        if (!m_knownPlugins.exists(pluginPath)) {
+        if (needScan(pluginPath)) {
             addModule(pluginPath);
         }
     }
@@ -340,10 +340,9 @@ class TextToUEBBraille
     const QString ASCII_END_OF_CAPITALISATION = QString(",");
     const QString ASCII_END_OF_NUMBER = QString(";");
 
-    QMap<QString, QString> textToBrailleASCII;
-public:
-    TextToUEBBraille()
+    static QMap<QString, QString> makeTextToBrailleASCII()
     {
+        QMap<QString, QString> textToBrailleASCII;
         textToBrailleASCII["a"] = 'a';
         textToBrailleASCII["b"] = 'b';
         textToBrailleASCII["c"] = 'c';
@@ -459,8 +458,17 @@ public:
         textToBrailleASCII[QChar(0xE524)] = "s";
         textToBrailleASCII[QChar(0xE525)] = "z";
         textToBrailleASCII[QChar(0xE526)] = "n";
+        return textToBrailleASCII;
+    }
+
+    // a converter is created for each text, the table is only built once
+    static const QMap<QString, QString>& textToBrailleASCII()
+    {
+        static const QMap<QString, QString> table = makeTextToBrailleASCII();
+        return table;
     }
 
+public:
     QString braille(QChar c);
     QString braille(QString text);
 };
@@ -660,7 +668,7 @@ bool ExportBrailleImpl::write(QIODevice& device)
         for (size_t i = 0; i < nrStaves; ++i) {
             LOGD() << "Measure " << mb->no() + 1 << " Staff " << i;
 
-            measureBraille[i] = brailleMeasure(m, static_cast<int>(i)).toUtf8();
+            measureBraille[i] = brailleMeasure(m, static_cast<int>(i));
 
             if (measureBraille[i].size() > currentMeasureMaxLength) {
                 currentMeasureMaxLength = measureBraille[i].size();
@@ -1241,99 +1249,47 @@ QString ExportBrailleImpl::brailleAccidentalType(AccidentalType accidental)
 
 QString ExportBrailleImpl::brailleNote(const QString& pitchName, DurationType durationType, int dots)
 {
-    QString noteBraille = QString();
-    static QMap<DurationType, QMap<QString, QString> > noteToBraille;
-    if (noteToBraille.isEmpty()) {
-        //8th and 128th notes have the same representation in Braille
-        noteToBraille[DurationType::V_128TH]["C"] = noteToBraille[DurationType::V_EIGHTH]["C"] = BRAILLE_C_8TH_128TH;
-        noteToBraille[DurationType::V_128TH]["D"] = noteToBraille[DurationType::V_EIGHTH]["D"] = BRAILLE_D_8TH_128TH;
-        noteToBraille[DurationType::V_128TH]["E"] = noteToBraille[DurationType::V_EIGHTH]["E"] = BRAILLE_E_8TH_128TH;
-        noteToBraille[DurationType::V_128TH]["F"] = noteToBraille[DurationType::V_EIGHTH]["F"] = BRAILLE_F_8TH_128TH;
-        noteToBraille[DurationType::V_128TH]["G"] = noteToBraille[DurationType::V_EIGHTH]["G"] = BRAILLE_G_8TH_128TH;
-        noteToBraille[DurationType::V_128TH]["A"] = noteToBraille[DurationType::V_EIGHTH]["A"] = BRAILLE_A_8TH_128TH;
-        noteToBraille[DurationType::V_128TH]["B"] = noteToBraille[DurationType::V_EIGHTH]["B"] = BRAILLE_B_8TH_128TH;
-
-        //64th and quarter notes have the same representation in Braille
-        noteToBraille[DurationType::V_64TH]["C"] = noteToBraille[DurationType::V_QUARTER]["C"]
-                                                       = BRAILLE_C_64TH_QUARTER;
-        noteToBraille[DurationType::V_64TH]["D"] = noteToBraille[DurationType::V_QUARTER]["D"]
-                                                       = BRAILLE_D_64TH_QUARTER;
-        noteToBraille[DurationType::V_64TH]["E"] = noteToBraille[DurationType::V_QUARTER]["E"]
-                                                       = BRAILLE_E_64TH_QUARTER;
-        noteToBraille[DurationType::V_64TH]["F"] = noteToBraille[DurationType::V_QUARTER]["F"]
-                                                       = BRAILLE_F_64TH_QUARTER;
-        noteToBraille[DurationType::V_64TH]["G"] = noteToBraille[DurationType::V_QUARTER]["G"]
-                                                       = BRAILLE_G_64TH_QUARTER;
-        noteToBraille[DurationType::V_64TH]["A"] = noteToBraille[DurationType::V_QUARTER]["A"]
-                                                       = BRAILLE_A_64TH_QUARTER;
-        noteToBraille[DurationType::V_64TH]["B"] = noteToBraille[DurationType::V_QUARTER]["B"]
-                                                       = BRAILLE_B_64TH_QUARTER;
-
-        //32nd and half notes have the same representation in Braille
-        noteToBraille[DurationType::V_32ND]["C"] = noteToBraille[DurationType::V_HALF]["C"] = BRAILLE_C_32ND_HALF;
-        noteToBraille[DurationType::V_32ND]["D"] = noteToBraille[DurationType::V_HALF]["D"] = BRAILLE_D_32ND_HALF;
-        noteToBraille[DurationType::V_32ND]["E"] = noteToBraille[DurationType::V_HALF]["E"] = BRAILLE_E_32ND_HALF;
-        noteToBraille[DurationType::V_32ND]["F"] = noteToBraille[DurationType::V_HALF]["F"] = BRAILLE_F_32ND_HALF;
-        noteToBraille[DurationType::V_32ND]["G"] = noteToBraille[DurationType::V_HALF]["G"] = BRAILLE_G_32ND_HALF;
-        noteToBraille[DurationType::V_32ND]["A"] = noteToBraille[DurationType::V_HALF]["A"] = BRAILLE_A_32ND_HALF;
-        noteToBraille[DurationType::V_32ND]["B"] = noteToBraille[DurationType::V_HALF]["B"] = BRAILLE_B_32ND_HALF;
-
-        //16th and whole notes have the same representation in Braille.
-        // Breve has the same representation, but with an extra suffix;
-        // 256th has the same representation, but with an extra prefix;
-        noteToBraille[DurationType::V_256TH]["C"] = noteToBraille[DurationType::V_16TH]["C"]
-                                                        =noteToBraille[DurationType::V_WHOLE]["C"]
-                                                          = noteToBraille[DurationType::V_BREVE]["C"]
-                                                            = BRAILLE_C_16TH_WHOLE;
-
-        noteToBraille[DurationType::V_256TH]["D"] = noteToBraille[DurationType::V_16TH]["D"]
-                                                        =noteToBraille[DurationType::V_WHOLE]["D"]
-                                                          = noteToBraille[DurationType::V_BREVE]["D"]
-                                                            = BRAILLE_D_16TH_WHOLE;
-
-        noteToBraille[DurationType::V_256TH]["E"] = noteToBraille[DurationType::V_16TH]["E"]
-                                                        =noteToBraille[DurationType::V_WHOLE]["E"]
-                                                          = noteToBraille[DurationType::V_BREVE]["E"]
-                                                            = BRAILLE_E_16TH_WHOLE;
-
-        noteToBraille[DurationType::V_256TH]["F"] = noteToBraille[DurationType::V_16TH]["F"]
-                                                        =noteToBraille[DurationType::V_WHOLE]["F"]
-                                                          = noteToBraille[DurationType::V_BREVE]["F"]
-                                                            = BRAILLE_F_16TH_WHOLE;
-
-        noteToBraille[DurationType::V_256TH]["G"] = noteToBraille[DurationType::V_16TH]["G"]
-                                                        =noteToBraille[DurationType::V_WHOLE]["G"]
-                                                          = noteToBraille[DurationType::V_BREVE]["G"]
-                                                            = BRAILLE_G_16TH_WHOLE;
-
-        noteToBraille[DurationType::V_256TH]["A"] = noteToBraille[DurationType::V_16TH]["A"]
-                                                        =noteToBraille[DurationType::V_WHOLE]["A"]
-                                                          = noteToBraille[DurationType::V_BREVE]["A"]
-                                                            = BRAILLE_A_16TH_WHOLE;
-
-        noteToBraille[DurationType::V_256TH]["B"] = noteToBraille[DurationType::V_16TH]["B"]
-                                                        =noteToBraille[DurationType::V_WHOLE]["B"]
-                                                          = noteToBraille[DurationType::V_BREVE]["B"]
-                                                            = BRAILLE_B_16TH_WHOLE;
-    }
-
+    // The cells of the notes C to B, durations that have the same representation in Braille share a row
+    static const char NOTES_8TH_128TH[] = {
+        BRAILLE_C_8TH_128TH, BRAILLE_D_8TH_128TH, BRAILLE_E_8TH_128TH, BRAILLE_F_8TH_128TH,
+        BRAILLE_G_8TH_128TH, BRAILLE_A_8TH_128TH, BRAILLE_B_8TH_128TH
+    };
+    static const char NOTES_64TH_QUARTER[] = {
+        BRAILLE_C_64TH_QUARTER, BRAILLE_D_64TH_QUARTER, BRAILLE_E_64TH_QUARTER, BRAILLE_F_64TH_QUARTER,
+        BRAILLE_G_64TH_QUARTER, BRAILLE_A_64TH_QUARTER, BRAILLE_B_64TH_QUARTER
+    };
+    static const char NOTES_32ND_HALF[] = {
+        BRAILLE_C_32ND_HALF, BRAILLE_D_32ND_HALF, BRAILLE_E_32ND_HALF, BRAILLE_F_32ND_HALF,
+        BRAILLE_G_32ND_HALF, BRAILLE_A_32ND_HALF, BRAILLE_B_32ND_HALF
+    };
+    // Breve has the same representation, but with an extra suffix;
+    // 256th has the same representation, but with an extra prefix;
+    static const char NOTES_16TH_WHOLE[] = {
+        BRAILLE_C_16TH_WHOLE, BRAILLE_D_16TH_WHOLE, BRAILLE_E_16TH_WHOLE, BRAILLE_F_16TH_WHOLE,
+        BRAILLE_G_16TH_WHOLE, BRAILLE_A_16TH_WHOLE, BRAILLE_B_16TH_WHOLE
+    };
+    static const QString STEP_NAMES("CDEFGAB");
+
+    const char* notes = nullptr;
     switch (durationType) {
     case DurationType::V_LONG:      break;     //TODO
     case DurationType::V_BREVE:
-        noteBraille = noteToBraille[DurationType::V_BREVE][pitchName] + BRAILLE_BREVE_SUFFIX;
-        break;
     case DurationType::V_WHOLE:
-    case DurationType::V_HALF:
-    case DurationType::V_QUARTER:
-    case DurationType::V_EIGHTH:
     case DurationType::V_16TH:
+    case DurationType::V_256TH:
+        notes = NOTES_16TH_WHOLE;
+        break;
+    case DurationType::V_HALF:
     case DurationType::V_32ND:
+        notes = NOTES_32ND_HALF;
+        break;
+    case DurationType::V_QUARTER:
     case DurationType::V_64TH:
-    case DurationType::V_128TH:
-        noteBraille = QString(noteToBraille[durationType][pitchName]);
+        notes = NOTES_64TH_QUARTER;
         break;
-    case DurationType::V_256TH:
-        noteBraille = BRAILLE_256TH_PREFIX + QString(noteToBraille[DurationType::V_256TH][pitchName]);
+    case DurationType::V_EIGHTH:
+    case DurationType::V_128TH:
+        notes = NOTES_8TH_128TH;
         break;
     case DurationType::V_512TH:     break;     //TODO not supported in braille?
     case DurationType::V_1024TH:    break;     //TODO not supported in braille?
@@ -1342,6 +1298,18 @@ QString ExportBrailleImpl::brailleNote(const QString& pitchName, DurationType du
     case DurationType::V_INVALID:   break;
     }
 
+    QString noteBraille = QString();
+    const int step = pitchName.size() == 1 ? STEP_NAMES.indexOf(pitchName.at(0)) : -1;
+    if (notes && step >= 0) {
+        noteBraille = QString(QLatin1Char(notes[step]));
+    }
+
+    if (durationType == DurationType::V_BREVE) {
+        noteBraille += BRAILLE_BREVE_SUFFIX;
+    } else if (durationType == DurationType::V_256TH) {
+        noteBraille.prepend(BRAILLE_256TH_PREFIX);
+    }
+
     for (int i = 0; i < dots; ++i) {
         noteBraille += BRAILLE_DURATION_DOT;
     }
@@ -2522,8 +2490,9 @@ QString ExportBrailleImpl::brailleJump(Jump* jump)
 
 QString TextToUEBBraille::braille(QChar c)
 {
-    if (textToBrailleASCII[c] != nullptr) {
-        return QString(textToBrailleASCII[c]);
+    auto it = textToBrailleASCII().constFind(QString(c));
+    if (it != textToBrailleASCII().cend()) {
+        return it.value();
     }
     return QString(c);
 }
@@ -54,12 +54,18 @@ void GP67DomBuilder::buildGPDomModel(XmlDomElement* domElem)
         assignMap(current);
     }
 
+    //! NOTE Each level is built from the previous one, whose lookup table isn't needed after that
     buildGPRhythms(&rhythms);
     buildGPNotes(&notes);
     buildGPBeats(&beats);
+    _rhythms.clear();
+    _notes.clear();
     buildGPVoices(&voices);
+    _beats.clear();
     buildGPBars(&bars);
+    _voices.clear();
     buildGPMasterBars(&masterBars);
+    _bars.clear();
 
     buildGPScore(&scoreNode);
     buildGPMasterTracks(&masterTrack);
@@ -372,14 +372,23 @@ XmlDomNode GuitarPro6::getNode(const String& id, XmlDomNode currentDomNode)
 
 void GuitarPro6::readGpif(ByteArray* data)
 {
-    XmlDomDocument domDoc;
-    domDoc.setContent(*data);
-    XmlDomElement domElem = domDoc.rootElement();
+    std::unique_ptr<GPDomModel> gpDom;
 
-    auto builder = createGPDomBuilder();
-    builder->buildGPDomModel(&domElem);
+    //! NOTE The xml tree of a large file takes much more memory than the model,
+    //! so it's released before the score is built from the model
+    {
+        XmlDomDocument domDoc;
+        domDoc.setContent(*data);
+        *data = ByteArray();
 
-    GPConverter scoreBuilder(score, builder->getGPDomModel());
+        XmlDomElement domElem = domDoc.rootElement();
+
+        auto builder = createGPDomBuilder();
+        builder->buildGPDomModel(&domElem);
+        gpDom = builder->getGPDomModel();
+    }
+
+    GPConverter scoreBuilder(score, std::move(gpDom));
     scoreBuilder.convertGP();
 }
 
@@ -455,13 +464,19 @@ void GuitarPro6::readGPX(ByteArray* buffer)
                 }
                 // get file information and read the file
                 size_t fileSize = readInteger(buffer, indexFileSize);
-                if (fileBytes->size() >= fileSize) {
+                bool hasFile = fileBytes->size() >= fileSize;
+                ByteArray data;
+                if (hasFile) {
+                    data = getBytes(fileBytes, 0, static_cast<int>(fileSize));
+                }
+                // the blocks aren't needed while the file is read
+                delete fileBytes;
+
+                if (hasFile) {
                     ByteArray filenameBytes = readString(buffer, indexFileName, 127);
                     const char* filename = filenameBytes.constChar();
-                    ByteArray data = getBytes(fileBytes, 0, static_cast<int>(fileSize));
                     parseFile(filename, &data);
                 }
-                delete fileBytes;
             }
         }
     }
@@ -47,6 +47,10 @@ public:
     virtual bool exportPngWithTransparentBackground() const = 0;
     virtual void setExportPngWithTransparentBackground(bool transparent) = 0;
 
+    // Svg
+    virtual bool exportSvgWithGlyphDefs() const = 0;
+    virtual void setExportSvgWithGlyphDefs(bool useGlyphDefs) = 0;
+
     virtual int trimMarginPixelSize() const = 0;
     virtual void setTrimMarginPixelSize(std::optional<int> pixelSize) = 0;
 };
@@ -31,12 +31,14 @@ using namespace mu::iex::imagesexport;
 static const Settings::Key EXPORT_PDF_DPI_RESOLUTION_KEY("iex_imagesexport", "export/pdf/dpi");
 static const Settings::Key EXPORT_PNG_DPI_RESOLUTION_KEY("iex_imagesexport", "export/png/resolution");
 static const Settings::Key EXPORT_PNG_USE_TRANSPARENCY_KEY("iex_imagesexport", "export/png/useTransparency");
+static const Settings::Key EXPORT_SVG_USE_GLYPH_DEFS_KEY("iex_imagesexport", "export/svg/useGlyphDefs");
 
 void ImagesExportConfiguration::init()
 {
     settings()->setDefaultValue(EXPORT_PNG_DPI_RESOLUTION_KEY, Val(mu::engraving::DPI));
     settings()->setDefaultValue(EXPORT_PNG_USE_TRANSPARENCY_KEY, Val(false));
     settings()->setDefaultValue(EXPORT_PDF_DPI_RESOLUTION_KEY, Val(mu::engraving::DPI));
+    settings()->setDefaultValue(EXPORT_SVG_USE_GLYPH_DEFS_KEY, Val(false));
 }
 
 int ImagesExportConfiguration::exportPdfDpiResolution() const
@@ -73,6 +75,16 @@ void ImagesExportConfiguration::setExportPngWithTransparentBackground(bool trans
     settings()->setSharedValue(EXPORT_PNG_USE_TRANSPARENCY_KEY, Val(transparent));
 }
 
+bool ImagesExportConfiguration::exportSvgWithGlyphDefs() const
+{
+    return settings()->value(EXPORT_SVG_USE_GLYPH_DEFS_KEY).toBool();
+}
+
+void ImagesExportConfiguration::setExportSvgWithGlyphDefs(bool useGlyphDefs)
+{
+    settings()->setSharedValue(EXPORT_SVG_USE_GLYPH_DEFS_KEY, Val(useGlyphDefs));
+}
+
 int ImagesExportConfiguration::trimMarginPixelSize() const
 {
     return m_trimMarginPixelSize ? m_trimMarginPixelSize.value() : -1;
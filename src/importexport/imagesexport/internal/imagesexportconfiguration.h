@@ -39,6 +39,9 @@ public:
     bool exportPngWithTransparentBackground() const override;
     void setExportPngWithTransparentBackground(bool transparent) override;
 
+    bool exportSvgWithGlyphDefs() const override;
+    void setExportSvgWithGlyphDefs(bool useGlyphDefs) override;
+
     int trimMarginPixelSize() const override;
     void setTrimMarginPixelSize(std::optional<int> pixelSize) override;
 
@@ -24,6 +24,7 @@
 
 #include <QPdfWriter>
 
+#include "draw/multipaintprovider.h"
 #include "libmscore/masterscore.h"
 
 #include "log.h"
@@ -117,6 +118,72 @@ mu::Ret PdfWriter::writeList(const INotationPtrList& notations, QIODevice& desti
     return true;
 }
 
+mu::Ret PdfWriter::writeEachAndList(const INotationPtrList& notations, const std::vector<QIODevice*>& devices, QIODevice& listDevice,
+                                    const Options&)
+{
+    IF_ASSERT_FAILED(!notations.empty() && notations.size() == devices.size()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    INotationPtr firstNotation = notations.front();
+    IF_ASSERT_FAILED(firstNotation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    QPdfWriter listPdfWriter(&listDevice);
+    preparePdfWriter(listPdfWriter, firstNotation->projectWorkTitle(), firstNotation->painting()->pageSizeInch().toQSizeF());
+
+    Painter listPainter(&listPdfWriter, "pdfwriter");
+    if (!listPainter.isActive()) {
+        return false;
+    }
+
+    //! NOTE Every notation is painted once, to its own PDF and to the PDF of all of them at the same time,
+    //! instead of painting the parts again for the list
+    for (size_t i = 0; i < notations.size(); ++i) {
+        INotationPtr notation = notations.at(i);
+        IF_ASSERT_FAILED(notation) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+
+        QSizeF size = notation->painting()->pageSizeInch().toQSizeF();
+        if (notation != firstNotation) {
+            listPdfWriter.setPageSize(QPageSize(size, QPageSize::Inch));
+            listPdfWriter.newPage();
+        }
+
+        QPdfWriter pdfWriter(devices.at(i));
+        preparePdfWriter(pdfWriter, notation->projectWorkTitleAndPartName(), size);
+
+        Painter partPainter(&pdfWriter, "pdfwriter");
+        if (!partPainter.isActive()) {
+            return false;
+        }
+
+        {
+            auto provider = std::make_shared<MultiPaintProvider>(std::vector<IPaintProviderPtr> {
+                partPainter.provider(), listPainter.provider()
+            });
+            Painter painter(provider, "pdfwriter");
+
+            INotationPainting::Options opt;
+            opt.deviceDpi = pdfWriter.logicalDpiX();
+            opt.onNewPage = [&pdfWriter, &listPdfWriter]() {
+                pdfWriter.newPage();
+                listPdfWriter.newPage();
+            };
+
+            notation->painting()->paintPdf(&painter, opt);
+        }
+
+        partPainter.endDraw();
+    }
+
+    listPainter.endDraw();
+
+    return true;
+}
+
 void PdfWriter::preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const
 {
     pdfWriter.setResolution(configuration()->exportPdfDpiResolution());
@@ -39,6 +39,8 @@ public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
     Ret writeList(const notation::INotationPtrList& notations, QIODevice& destinationDevice, const Options& options = Options()) override;
+    Ret writeEachAndList(const notation::INotationPtrList& notations, const std::vector<QIODevice*>& devices, QIODevice& listDevice,
+                         const Options& options = Options()) override;
 
 private:
     void preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const;
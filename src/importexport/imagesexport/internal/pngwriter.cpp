@@ -23,7 +23,12 @@
 #include "pngwriter.h"
 
 #include <cmath>
+#include <deque>
+
+#include <QBuffer>
 #include <QImage>
+#include <QThread>
+#include <QtConcurrent>
 
 #include "libmscore/masterscore.h"
 #include "libmscore/page.h"
@@ -47,6 +52,75 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
+    QImage image = renderPage(notation, options);
+    image.save(&destinationDevice, "png");
+
+    return true;
+}
+
+static QByteArray encodePng(const QImage& image)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "png");
+
+    return data;
+}
+
+mu::Ret PngWriter::writePages(INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options)
+{
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    //! NOTE Drawing the score isn't thread safe (fonts and images keep state while drawing),
+    //! so the pages are rendered here one by one, and only the PNG compression,
+    //! which takes about as long as the rendering, runs concurrently.
+    //! The number of pending pages is limited, every page image takes tens of megabytes
+    const size_t maxPendingPages = std::max(1, QThread::idealThreadCount());
+
+    struct PendingPage {
+        QIODevice* device = nullptr;
+        QFuture<QByteArray> data;
+    };
+
+    std::deque<PendingPage> pendingPages;
+    Ret ret = make_ret(Ret::Code::Ok);
+
+    auto writeFirstPendingPage = [&pendingPages, &ret]() {
+        PendingPage& page = pendingPages.front();
+        QByteArray data = page.data.result();
+        if (data.isEmpty() || page.device->write(data) != data.size()) {
+            ret = make_ret(Ret::Code::UnknownError);
+        }
+
+        pendingPages.pop_front();
+    };
+
+    Options pageOptions = options;
+    for (size_t i = 0; i < devices.size(); ++i) {
+        pageOptions[OptionKey::PAGE_NUMBER] = Val(static_cast<int>(i));
+        QImage image = renderPage(notation, pageOptions);
+
+        if (pendingPages.size() >= maxPendingPages) {
+            writeFirstPendingPage();
+        }
+
+        pendingPages.push_back({ devices[i], QtConcurrent::run([image]() {
+                return encodePng(image);
+            }) });
+    }
+
+    while (!pendingPages.empty()) {
+        writeFirstPendingPage();
+    }
+
+    return ret;
+}
+
+QImage PngWriter::renderPage(INotationPtr notation, const Options& options) const
+{
     const float CANVAS_DPI = configuration()->exportPngDpiResolution();
     const SizeF pageSizeInch = notation->painting()->pageSizeInch();
 
@@ -60,18 +134,18 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     const bool TRANSPARENT_BACKGROUND = options.value(OptionKey::TRANSPARENT_BACKGROUND, Val(false)).toBool();
     image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
 
-    mu::draw::Painter painter(&image, "pngwriter");
-
-    INotationPainting::Options opt;
-    opt.fromPage = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
-    opt.toPage = opt.fromPage;
-    opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
-    opt.deviceDpi = CANVAS_DPI;
-    opt.printPageBackground = false; //Already printed
+    {
+        mu::draw::Painter painter(&image, "pngwriter");
 
-    notation->painting()->paintPng(&painter, opt);
+        INotationPainting::Options opt;
+        opt.fromPage = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
+        opt.toPage = opt.fromPage;
+        opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
+        opt.deviceDpi = CANVAS_DPI;
+        opt.printPageBackground = false; //Already printed
 
-    image.save(&destinationDevice, "png");
+        notation->painting()->paintPng(&painter, opt);
+    }
 
-    return true;
+    return image;
 }
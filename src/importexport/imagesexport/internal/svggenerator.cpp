@@ -27,6 +27,8 @@
 #include <QMimeType>
 #include <QMimeDatabase>
 #include <QPaintEngine>
+#include <QRawFont>
+#include <QHash>
 
 #include "svggenerator.h"
 #include "types/bytearray.h"
@@ -153,7 +155,9 @@ public:
         size = QSize();
         viewBox = QRectF();
         outputDevice = 0;
+        stream = nullptr;
         resolution = mu::engraving::DPI;
+        glyphDefsEnabled = false;
 
         attributes.title = QLatin1String("MuseScore SVG Document");
         attributes.description = QString("Generated by MuseScore %1").arg(VERSION);
@@ -172,9 +176,9 @@ public:
     QTextStream* stream;
     int resolution;
 
-    QString header;
-//    QString defs; // NEEDED FOR GRADIENTS
-    QString body;
+    // the glyphs are written once as <defs> and drawn with <use>
+    bool glyphDefsEnabled;
+    QHash<QString, QString> glyphIds;
 
     QBrush brush;
     QPen pen;
@@ -224,6 +228,7 @@ class SvgPaintEngine : public QPaintEngine
 private:
     QString stateString;
     QTextStream stateStream;
+    QString transformString;
     SvgPaintEnginePrivate* d_ptr;
 
 // Qt translates everything. These help avoid SVG transform="translate()".
@@ -235,6 +240,8 @@ protected:
     const mu::engraving::EngravingItem* _element = NULL;
 
     void writeImage(const QRectF& r, const QByteArray& imageData, const QString& mimeFormat);
+    void writePathData(const QPainterPath& path, qreal dx, qreal dy);
+    QString glyphId(const QRawFont& rawFont, quint32 glyphIndex);
 
 // SVG strings as constants
 #define SVG_SPACE    ' '
@@ -280,6 +287,11 @@ protected:
 
 #define SVG_IMAGE       "<image"
 #define SVG_PATH        "<path"
+#define SVG_USE         "<use"
+#define SVG_DEFS_BEGIN  "<defs>"
+#define SVG_DEFS_END    "</defs>"
+#define SVG_ID          " id=\""
+#define SVG_HREF        " xlink:href=\"#"
 #define SVG_POLYLINE    "<polyline"
 
 #define SVG_PRESERVE_ASPECT " preserveAspectRatio=\""
@@ -320,6 +332,7 @@ public:
     void popGroup();
 
     void drawPath(const QPainterPath& path);
+    void drawTextItem(const QPointF& p, const QTextItem& textItem);
     void drawPixmap(const QRectF& r, const QPixmap& pm, const QRectF& sr);
     void drawPolygon(const QPoint* points, int pointCount, PolygonDrawMode mode) { QPaintEngine::drawPolygon(points, pointCount, mode); }
     void drawPolygon(const QPointF* points, int pointCount, PolygonDrawMode mode);
@@ -367,6 +380,13 @@ public:
         d_func()->resolution = resolution;
     }
 
+    bool glyphDefsEnabled() const { return d_func()->glyphDefsEnabled; }
+    void setGlyphDefsEnabled(bool enabled)
+    {
+        Q_ASSERT(!isActive());
+        d_func()->glyphDefsEnabled = enabled;
+    }
+
 ///////////////////////////////////////////////////////////////////////////////
 // UNUSED GRADIENT CODE:
 //    void saveLinearGradientBrush(const QGradient *g)
@@ -951,6 +971,26 @@ void SvgGenerator::setResolution(int dpi)
     d->engine->setResolution(dpi);
 }
 
+/*!
+    \property SvgGenerator::glyphDefsEnabled
+    \brief whether each glyph of the text is written once
+
+    If enabled, the outline of a glyph is written once as a <defs> entry,
+    and every text item of a single glyph (as the SMuFL symbols) refers
+    to it with <use>. Otherwise every glyph is written as a <path>.
+*/
+bool SvgGenerator::glyphDefsEnabled() const
+{
+    Q_D(const SvgGenerator);
+    return d->engine->glyphDefsEnabled();
+}
+
+void SvgGenerator::setGlyphDefsEnabled(bool enabled)
+{
+    Q_D(SvgGenerator);
+    d->engine->setGlyphDefsEnabled(enabled);
+}
+
 /*!
     Returns the paint engine used to render graphics to be converted to SVG
     format information.
@@ -1033,8 +1073,13 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         return false;
     }
 
-    // Stream the headers
-    d->stream = new QTextStream(&d->header);
+    // Stream everything straight to the output device
+    d->stream = new QTextStream(d->outputDevice);
+#ifndef QT_NO_TEXTCODEC
+    d->stream->setCodec(QTextCodec::codecForName("UTF-8"));
+#endif
+    d->glyphIds.clear();
+
     stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << Qt::endl << SVG_BEGIN;
     if (d->viewBox.isValid()) {
         // viewBox has floating point values, size width/height is integer
@@ -1056,12 +1101,6 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << Qt::endl;
     }
 
-// <defs> is currently empty. It's necessary for gradients.
-//    d->stream->setString(&d->defs);
-//    *d->stream << "<defs>\n";
-
-    // Point the stream at the body string, for other functions to populate
-    d->stream->setString(&d->body);
     return true;
 }
 
@@ -1069,24 +1108,10 @@ bool SvgPaintEngine::end()
 {
     Q_D(SvgPaintEngine);
 
-// <defs> is currently empty
-//    d->stream->setString(&d->defs);
-//    stream() << "</defs>\n";
-
-    // Point the stream at the real output device (the .svg file)
-    d->stream->setDevice(d->outputDevice);
-
-#ifndef QT_NO_TEXTCODEC
-    d->stream->setCodec(QTextCodec::codecForName("UTF-8"));
-#endif
-
-    // Stream our strings out to the device, in order
-    stream() << d->header;
-//    stream() << d->defs;
-    stream() << d->body;
     stream() << SVG_END << Qt::endl;
 
     delete d->stream;
+    d->stream = nullptr;
     return true;
 }
 
@@ -1152,6 +1177,7 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
 {
     // Always start fresh
     stateString.clear();
+    transformString.clear();
 
     // stateString = Attribute Settings
 
@@ -1191,12 +1217,14 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
         // Other transformations are more straightforward with a full matrix
         _dx = 0;
         _dy = 0;
-        stateStream << SVG_MATRIX << t.m11() << SVG_COMMA
-                    << t.m12() << SVG_COMMA
-                    << t.m21() << SVG_COMMA
-                    << t.m22() << SVG_COMMA
-                    << t.m31() << SVG_COMMA
-                    << t.m32() << SVG_RPAREN_QUOTE;
+        QTextStream transformStream(&transformString);
+        transformStream << SVG_MATRIX << t.m11() << SVG_COMMA
+                        << t.m12() << SVG_COMMA
+                        << t.m21() << SVG_COMMA
+                        << t.m22() << SVG_COMMA
+                        << t.m31() << SVG_COMMA
+                        << t.m32() << SVG_RPAREN_QUOTE;
+        stateStream << transformString;
     }
 }
 
@@ -1210,12 +1238,17 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
         stream() << SVG_FILL_RULE;
     }
 
-    // Path data
+    writePathData(p, _dx, _dy);
+    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+}
+
+void SvgPaintEngine::writePathData(const QPainterPath& path, qreal dx, qreal dy)
+{
     stream() << SVG_D;
-    for (int i = 0; i < p.elementCount(); ++i) {
-        const QPainterPath::Element& e = p.elementAt(i);
-        qreal x = e.x + _dx;
-        qreal y = e.y + _dy;
+    for (int i = 0; i < path.elementCount(); ++i) {
+        const QPainterPath::Element& e = path.elementAt(i);
+        qreal x = e.x + dx;
+        qreal y = e.y + dy;
         switch (e.type) {
         case QPainterPath::MoveToElement:
             stream() << SVG_MOVE << x << SVG_COMMA << y;
@@ -1226,11 +1259,11 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
         case QPainterPath::CurveToElement:
             stream() << SVG_CURVE << x << SVG_COMMA << y;
             ++i;
-            while (i < p.elementCount()) {
-                const QPainterPath::Element& ee = p.elementAt(i);
+            while (i < path.elementCount()) {
+                const QPainterPath::Element& ee = path.elementAt(i);
                 if (ee.type == QPainterPath::CurveToDataElement) {
-                    stream() << SVG_SPACE << ee.x + _dx
-                             << SVG_COMMA << ee.y + _dy;
+                    stream() << SVG_SPACE << ee.x + dx
+                             << SVG_COMMA << ee.y + dy;
                     ++i;
                 } else {
                     --i;
@@ -1241,11 +1274,77 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
         default:
             break;
         }
-        if (i <= p.elementCount() - 1) {
+        if (i <= path.elementCount() - 1) {
             stream() << SVG_SPACE;
         }
     }
-    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+}
+
+void SvgPaintEngine::drawTextItem(const QPointF& p, const QTextItem& textItem)
+{
+    Q_D(SvgPaintEngine);
+
+    if (!d->glyphDefsEnabled) {
+        QPaintEngine::drawTextItem(p, textItem);
+        return;
+    }
+
+    // Only single glyphs are drawn with <use>, longer text may be shaped
+    // (kerning, ligatures) and is drawn as a path
+    QRawFont rawFont = QRawFont::fromFont(textItem.font());
+    QVector<quint32> glyphIndexes = rawFont.glyphIndexesForString(textItem.text());
+    if (glyphIndexes.size() != 1 || glyphIndexes.front() == 0) {
+        QPaintEngine::drawTextItem(p, textItem);
+        return;
+    }
+
+    const QString id = glyphId(rawFont, glyphIndexes.front());
+
+    // Like QPaintEngine::drawTextItem(), the glyph is filled with the pen
+    QString color, colorOpacity;
+    translate_color(state->pen().color(), &color, &colorOpacity);
+
+    stream() << SVG_USE << SVG_HREF << id << SVG_QUOTE
+             << SVG_CLASS << getClass(_element) << SVG_QUOTE
+             << SVG_FILL << color << SVG_QUOTE;
+
+    if (colorOpacity != SVG_ONE) {
+        stream() << SVG_FILL_OPACITY << colorOpacity << SVG_QUOTE;
+    }
+
+    if (!qFuzzyIsNull(state->opacity() - 1)) {
+        stream() << SVG_OPACITY << state->opacity() << SVG_QUOTE;
+    }
+
+    stream() << transformString
+             << SVG_X << SVG_QUOTE << p.x() + _dx << SVG_QUOTE
+             << SVG_Y << SVG_QUOTE << p.y() + _dy << SVG_QUOTE
+             << SVG_ELEMENT_END << Qt::endl;
+}
+
+QString SvgPaintEngine::glyphId(const QRawFont& rawFont, quint32 glyphIndex)
+{
+    Q_D(SvgPaintEngine);
+
+    const QString key = QString("%1|%2|%3|%4")
+                        .arg(rawFont.familyName(), rawFont.styleName())
+                        .arg(rawFont.pixelSize())
+                        .arg(glyphIndex);
+
+    auto it = d->glyphIds.constFind(key);
+    if (it != d->glyphIds.constEnd()) {
+        return it.value();
+    }
+
+    const QString id = QString("glyph%1").arg(d->glyphIds.size() + 1);
+    d->glyphIds.insert(key, id);
+
+    // The definition is written before its first use, so the output is still streamed
+    stream() << SVG_DEFS_BEGIN << SVG_PATH << SVG_ID << id << SVG_QUOTE;
+    writePathData(rawFont.pathForGlyph(glyphIndex), 0, 0);
+    stream() << SVG_QUOTE << SVG_ELEMENT_END << SVG_DEFS_END << Qt::endl;
+
+    return id;
 }
 
 void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
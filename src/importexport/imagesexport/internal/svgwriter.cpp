@@ -77,6 +77,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     QString title(score->name());
     printer.setTitle(pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(PAGE_NUMBER + 1) : title);
     printer.setOutputDevice(&destinationDevice);
+    printer.setGlyphDefsEnabled(configuration()->exportSvgWithGlyphDefs());
 
     const int TRIM_MARGIN_SIZE = configuration()->trimMarginPixelSize();
 
@@ -231,6 +231,25 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
     EventMap events;
     m_score->renderMidi(&events, false, midiExpandRepeats, synthState);
 
+    //! NOTE A track only takes the events of its staff and the note-offs it has to restrike,
+    //! so the events are shared out among the staves once instead of being walked for each channel of each staff
+    std::vector<std::vector<EventMap::const_iterator> > staffEvents(tracks.size());
+    for (auto i = events.cbegin(); i != events.cend(); ++i) {
+        const NPlayEvent& event = i->second;
+        if (event.isMuted()) {
+            continue;
+        }
+
+        const size_t origStaffIdx = event.getOriginatingStaff();
+        const size_t restrikeStaffIdx = event.discard() - 1;
+        if (event.discard() > 0 && event.velo() > 0 && restrikeStaffIdx < staffEvents.size()) {
+            staffEvents[restrikeStaffIdx].push_back(i);
+        }
+        if (origStaffIdx < staffEvents.size() && !(event.discard() > 0 && event.velo() > 0 && origStaffIdx == restrikeStaffIdx)) {
+            staffEvents[origStaffIdx].push_back(i);
+        }
+    }
+
     m_pauseMap.calculate(m_score);
     writeHeader();
 
@@ -294,12 +313,9 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                     track.insert(0, ev);
                 }
 
-                for (auto i = events.begin(); i != events.end(); ++i) {
+                for (EventMap::const_iterator i : staffEvents[staffIdx]) {
                     const NPlayEvent& event = i->second;
 
-                    if (event.isMuted()) {
-                        continue;
-                    }
                     if (event.discard() == staffIdx + 1 && event.velo() > 0) {
                         // turn note off so we can restrike it in another track
                         track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_NOTEON, channel,
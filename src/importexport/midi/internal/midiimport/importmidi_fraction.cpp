@@ -110,6 +110,25 @@ static unsigned lcm(int a, int b)
     const int l = (a / g) * b;   // Divide first to minimize overflow risk
     return l >= 0 ? l : -l;
 }
+
+//---------------------------------------------------------
+//   compare
+//    sign of n1/d1 - n2/d2, the cross products fit into
+//    64 bits, so no lcm (and gcd) is needed
+//---------------------------------------------------------
+
+static int compare(int n1, int d1, int n2, int d2)
+{
+    if (d1 == d2) {
+        const int diff = (n1 > n2) - (n1 < n2);
+        return d1 > 0 ? diff : -diff;
+    }
+
+    const qint64 l = static_cast<qint64>(n1) * d2;
+    const qint64 r = static_cast<qint64>(n2) * d1;
+    const int diff = (l > r) - (l < r);
+    return (d1 > 0) == (d2 > 0) ? diff : -diff;
+}
 }
 
 //-----------------------------------------------------------------------------
@@ -228,6 +247,12 @@ ReducedFraction& ReducedFraction::operator+=(const ReducedFraction& val)
     ReducedFraction value = val;
     value.preventOverflow();
 
+    // the ticks mostly share the denominator, then the lcm is the denominator itself
+    if (denominator_ == val.denominator_ && denominator_ > 0) {
+        numerator_ += val.numerator_;
+        return *this;
+    }
+
     const int tmp = lcm(denominator_, val.denominator_);
     numerator_ = fractionPart(tmp, numerator_, denominator_)
                  + fractionPart(tmp, val.numerator_, val.denominator_);
@@ -241,6 +266,12 @@ ReducedFraction& ReducedFraction::operator-=(const ReducedFraction& val)
     ReducedFraction value = val;
     value.preventOverflow();
 
+    // the ticks mostly share the denominator, then the lcm is the denominator itself
+    if (denominator_ == val.denominator_ && denominator_ > 0) {
+        numerator_ -= val.numerator_;
+        return *this;
+    }
+
     const int tmp = lcm(denominator_, val.denominator_);
     numerator_ = fractionPart(tmp, numerator_, denominator_)
                  - fractionPart(tmp, val.numerator_, val.denominator_);
@@ -305,44 +336,32 @@ ReducedFraction& ReducedFraction::operator/=(int val)
 
 bool ReducedFraction::operator<(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           < fractionPart(v, val.numerator_, val.denominator_);
+    return compare(numerator_, denominator_, val.numerator_, val.denominator_) < 0;
 }
 
 bool ReducedFraction::operator<=(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           <= fractionPart(v, val.numerator_, val.denominator_);
+    return compare(numerator_, denominator_, val.numerator_, val.denominator_) <= 0;
 }
 
 bool ReducedFraction::operator>(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           > fractionPart(v, val.numerator_, val.denominator_);
+    return compare(numerator_, denominator_, val.numerator_, val.denominator_) > 0;
 }
 
 bool ReducedFraction::operator>=(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           >= fractionPart(v, val.numerator_, val.denominator_);
+    return compare(numerator_, denominator_, val.numerator_, val.denominator_) >= 0;
 }
 
 bool ReducedFraction::operator==(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           == fractionPart(v, val.numerator_, val.denominator_);
+    return compare(numerator_, denominator_, val.numerator_, val.denominator_) == 0;
 }
 
 bool ReducedFraction::operator!=(const ReducedFraction& val) const
 {
-    const int v = lcm(denominator_, val.denominator_);
-    return fractionPart(v, numerator_, denominator_)
-           != fractionPart(v, val.numerator_, val.denominator_);
+    return compare(numerator_, denominator_, val.numerator_, val.denominator_) != 0;
 }
 
 //-------------------------------------------------------------------------
@@ -39,6 +39,7 @@
 
 #include "exportxml.h"
 
+#include <functional>
 #include <math.h>
 #include <QBuffer>
 #include <QDate>
@@ -7321,6 +7322,38 @@ void ExportMusicXml::write(mu::io::IODevice* dev)
     }
 }
 
+//---------------------------------------------------------
+//   StreamDevice
+//---------------------------------------------------------
+
+/**
+ Write-only device passing the data on to \a sink as it is written,
+ so the exported document is never held in memory as a whole.
+ */
+
+class StreamDevice : public mu::io::IODevice
+{
+public:
+    explicit StreamDevice(const std::function<bool(const uint8_t* data, size_t len)>& sink)
+        : m_sink(sink) {}
+
+protected:
+    bool doOpen(OpenMode m) override { return m == WriteOnly; }
+    size_t dataSize() const override { return m_size; }
+    const uint8_t* rawData() const override { return nullptr; }
+    bool resizeData(size_t size) override
+    {
+        m_size = size;
+        return true;
+    }
+
+    size_t writeData(const uint8_t* data, size_t len) override { return m_sink(data, len) ? len : 0; }
+
+private:
+    std::function<bool(const uint8_t* data, size_t len)> m_sink;
+    size_t m_size = 0;
+};
+
 //---------------------------------------------------------
 //   saveXml
 //    return false on error
@@ -7334,12 +7367,16 @@ void ExportMusicXml::write(mu::io::IODevice* dev)
 
 bool saveXml(Score* score, QIODevice* device)
 {
-    mu::io::Buffer buf;
-    buf.open(mu::io::IODevice::WriteOnly);
+    bool ok = true;
+    StreamDevice dev([device, &ok](const uint8_t* data, size_t len) {
+        ok = ok && device->write(reinterpret_cast<const char*>(data), len) == static_cast<qint64>(len);
+        return ok;
+    });
+    dev.open(mu::io::IODevice::WriteOnly);
+
     ExportMusicXml em(score);
-    em.write(&buf);
-    device->write(buf.data().toQByteArrayNoCopy());
-    return true;
+    em.write(&dev);
+    return ok;
 }
 
 bool saveXml(Score* score, const QString& name)
@@ -7391,12 +7428,20 @@ static void writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString&
 
     zipwriter.addFile("META-INF/container.xml", cbuf.data().toQByteArrayNoCopy());
 
-    mu::io::Buffer dbuf;
-    dbuf.open(mu::io::IODevice::ReadWrite);
+    // the document is compressed as it is written
+    if (!zipwriter.startFile(filename)) {
+        return;
+    }
+
+    StreamDevice dev([&zipwriter](const uint8_t* data, size_t len) {
+        zipwriter.writeFileData(reinterpret_cast<const char*>(data), len);
+        return true;
+    });
+    dev.open(mu::io::IODevice::WriteOnly);
+
     ExportMusicXml em(score);
-    em.write(&dbuf);
-    dbuf.seek(0);
-    zipwriter.addFile(filename, dbuf.data().toQByteArrayNoCopy());
+    em.write(&dev);
+    zipwriter.endFile();
 }
 
 bool saveMxl(Score* score, QIODevice* device)
@@ -1807,14 +1807,14 @@ void MusicXMLParserPass2::part()
 
 /**
  In Score \a score find the measure starting at \a tick.
+ Uses the score's measure index, as this is done for every measure of every part.
  */
 
 static Measure* findMeasure(Score* score, const Fraction& tick)
 {
-    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
-        if (m->tick() == tick) {
-            return m;
-        }
+    Measure* m = score->tick2measure(tick);
+    if (m && m->tick() == tick) {
+        return m;
     }
     return 0;
 }
@@ -29,6 +29,7 @@
 #include <QMessageBox>
 #include <QXmlSchema>
 #include <QXmlSchemaValidator>
+#include <QtConcurrent>
 
 #include "importmxml.h"
 #include "musicxmlsupport.h"
@@ -182,42 +183,47 @@ static bool extractRootfile(QFile* qf, QByteArray& data)
 }
 
 //---------------------------------------------------------
-//   doValidate
+//   ValidationResult
+//---------------------------------------------------------
+
+struct ValidationResult {
+    bool schemaLoaded = false;
+    bool valid = false;
+    QString errors;
+};
+
+//---------------------------------------------------------
+//   validate
 //---------------------------------------------------------
 
 /**
- Validate MusicXML data from file \a name contained in QIODevice \a dev.
+ Validate MusicXML \a data from file \a name.
+ Uses its own schema and validator, so it can run on any thread.
  */
 
-static Err doValidate(const QString& name, QIODevice* dev)
+static ValidationResult validate(const QString& name, const QByteArray& data)
 {
     //QElapsedTimer t;
     //t.start();
 
+    ValidationResult result;
+
     // initialize the schema
     ValidatorMessageHandler messageHandler;
     QXmlSchema schema;
     schema.setMessageHandler(&messageHandler);
     if (!initMusicXmlSchema(schema)) {
-        return Err::FileBadFormat;      // appropriate error message has been printed by initMusicXmlSchema
+        return result;      // appropriate error message has been printed by initMusicXmlSchema
     }
+    result.schemaLoaded = true;
+
     // validate the data
     QXmlSchemaValidator validator(schema);
-    bool valid = validator.validate(dev, QUrl::fromLocalFile(name));
+    result.valid = validator.validate(data, QUrl::fromLocalFile(name));
+    result.errors = messageHandler.getErrors();
     //LOGD("Validation time elapsed: %d ms", t.elapsed());
 
-    if (!valid) {
-        LOGD("importMusicXml() file '%s' is not a valid MusicXML file", qPrintable(name));
-        QString strErr = qtrc("iex_musicxml", "File '%1' is not a valid MusicXML file.").arg(name);
-        if (MScore::noGui) {
-            return Err::NoError;         // might as well try anyhow in converter mode
-        }
-        if (musicXMLValidationErrorDialog(strErr, messageHandler.getErrors()) != QMessageBox::Yes) {
-            return Err::UserAbort;
-        }
-    }
-
-    return Err::NoError;
+    return result;
 }
 
 //---------------------------------------------------------
@@ -226,20 +232,49 @@ static Err doValidate(const QString& name, QIODevice* dev)
 
 /**
  Validate and import MusicXML data from file \a name contained in QIODevice \a dev into score \a score.
+ The validation runs on a worker thread during the import and is only reported when it fails.
+ In converter mode an invalid file is imported anyhow, so it is not validated at all.
  */
 
 static Err doValidateAndImport(Score* score, const QString& name, QIODevice* dev)
 {
-    // validate the file
-    Err res = doValidate(name, dev);
-    if (res != Err::NoError) {
-        return res;
+    dev->seek(0);
+    const QByteArray data = dev->readAll();
+
+    QFuture<ValidationResult> validation;
+    if (!MScore::noGui) {
+        validation = QtConcurrent::run(validate, name, data);
     }
 
     // actually do the import
-    res = importMusicXMLfromBuffer(score, name, dev);
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    Err res = importMusicXMLfromBuffer(score, name, &buffer);
     //LOGD("res %d", static_cast<int>(res));
-    return res;
+
+    if (MScore::noGui) {
+        return res;
+    }
+
+    const ValidationResult validationResult = validation.result();
+    if (!validationResult.schemaLoaded) {
+        return Err::FileBadFormat;
+    }
+
+    if (res != Err::NoError) {
+        return res;
+    }
+
+    if (!validationResult.valid) {
+        LOGD("importMusicXml() file '%s' is not a valid MusicXML file", qPrintable(name));
+        QString strErr = qtrc("iex_musicxml", "File '%1' is not a valid MusicXML file.").arg(name);
+        if (musicXMLValidationErrorDialog(strErr, validationResult.errors) != QMessageBox::Yes) {
+            return Err::UserAbort;
+        }
+    }
+
+    return Err::NoError;
 }
 
 //---------------------------------------------------------
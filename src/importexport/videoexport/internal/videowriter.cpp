@@ -21,6 +21,11 @@
  */
 #include "videowriter.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "videoencoder.h"
 
 #include "engraving/libmscore/page.h"
@@ -37,6 +42,54 @@ using namespace mu::iex::videoexport;
 using namespace mu::project;
 using namespace mu::notation;
 
+//! NOTE The frames are encoded on a thread of their own while the next ones are painted.
+//! The queue is bounded, so the painting doesn't run far ahead of the encoder
+class FrameQueue
+{
+public:
+    explicit FrameQueue(size_t capacity)
+        : m_capacity(capacity) {}
+
+    void push(QImage frame)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notFull.wait(lock, [this]() { return m_frames.size() < m_capacity; });
+        m_frames.push_back(std::move(frame));
+        m_notEmpty.notify_one();
+    }
+
+    bool pop(QImage& frame)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notEmpty.wait(lock, [this]() { return !m_frames.empty() || m_closed; });
+        if (m_frames.empty()) {
+            return false;
+        }
+
+        frame = std::move(m_frames.front());
+        m_frames.pop_front();
+        m_notFull.notify_one();
+        return true;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_notEmpty.notify_all();
+    }
+
+private:
+    const size_t m_capacity = 0;
+    std::deque<QImage> m_frames;
+    bool m_closed = false;
+    std::mutex m_mutex;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+};
+
+static constexpr size_t FRAME_QUEUE_CAPACITY = 8;
+
 std::vector<IProjectWriter::UnitType> VideoWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PART };
@@ -155,16 +208,15 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     score->update();
 
     // Setup painting
-    QImage frame(config.width, config.height, QImage::Format_RGB32);
-    frame.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-    frame.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-
-    QPainter qp(&frame);
-    qp.setRenderHint(QPainter::Antialiasing, true);
-    qp.setRenderHint(QPainter::TextAntialiasing, true);
-    RectF frameRect = RectF::fromQRectF(QRectF(frame.rect()));
+    //! NOTE The page only changes on a page turn, so it's painted once into the background
+    //! and each frame is a copy of it with the cursor on top
+    QImage background(config.width, config.height, QImage::Format_RGB32);
+    background.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+    background.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+    const Page* backgroundPage = nullptr;
 
-    draw::Painter painter(&qp, "video_writer");
+    RectF frameRect = RectF::fromQRectF(QRectF(background.rect()));
+    RectF windowRect(0.0, 0.0, config.width * engraving::DPI / CANVAS_DPI, config.height * engraving::DPI / CANVAS_DPI);
 
     auto painting = masterNotation->notation()->painting();
 
@@ -190,6 +242,14 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     PlaybackCursor cursor;
     cursor.setNotation(masterNotation->notation());
 
+    FrameQueue frames(FRAME_QUEUE_CAPACITY);
+    std::thread encoderThread([&encoder, &frames]() {
+        QImage frame;
+        while (frames.pop(frame)) {
+            encoder.encodeImage(frame);
+        }
+    });
+
     for (int f = 0; f < frameCount; f++) {
         float currentTimeSec = (qreal)f / config.fps;
         currentTimeSec -= config.leadingSec;
@@ -207,14 +267,24 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
             break;
         }
 
-        INotationPainting::Options opt;
-        opt.fromPage = page->no();
-        opt.toPage = opt.fromPage;
-        opt.deviceDpi = CANVAS_DPI;
+        if (page != backgroundPage) {
+            QPainter qp(&background);
+            qp.setRenderHint(QPainter::Antialiasing, true);
+            qp.setRenderHint(QPainter::TextAntialiasing, true);
+
+            draw::Painter painter(&qp, "video_writer");
+
+            INotationPainting::Options opt;
+            opt.fromPage = page->no();
+            opt.toPage = opt.fromPage;
+            opt.deviceDpi = CANVAS_DPI;
 
-        painter.fillRect(frameRect, draw::Color::white);
+            painter.fillRect(frameRect, draw::Color::white);
 
-        painting->paintPrint(&painter, opt);
+            painting->paintPrint(&painter, opt);
+
+            backgroundPage = page;
+        }
 
         cursor.move(tick);
 
@@ -222,11 +292,23 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
         PointF pagePos = page->pos();
         RectF cursorAbsRect = cursorRect.translated(-pagePos);
 
-        painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        QImage frame = background.copy();
+        {
+            QPainter qp(&frame);
+            draw::Painter painter(&qp, "video_writer");
 
-        encoder.encodeImage(frame);
+            // the same mapping as the page painting uses
+            painter.setViewport(frameRect);
+            painter.setWindow(windowRect);
+            painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        }
+
+        frames.push(std::move(frame));
     }
 
+    frames.close();
+    encoderThread.join();
+
     encoder.close();
 
     return make_ok();
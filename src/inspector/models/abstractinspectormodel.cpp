@@ -535,7 +535,6 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem,
         }
 
         QVariant elementCurrentValue = valueFromElementUnits(pid, element->getProperty(pid), element);
-        QVariant elementDefaultValue = valueFromElementUnits(pid, element->propertyDefault(pid), element);
 
         bool isPropertySupportedByElement = elementCurrentValue.isValid();
 
@@ -545,10 +544,16 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem,
 
         if (convertElementPropertyValueFunc) {
             elementCurrentValue = convertElementPropertyValueFunc(elementCurrentValue);
-            elementDefaultValue = convertElementPropertyValueFunc(elementDefaultValue);
         }
 
+        //! NOTE The default value is only taken from the first element, so it isn't computed
+        //! for each of the others (a selection may contain thousands of elements)
         if (!(propertyValue.isValid() && defaultPropertyValue.isValid())) {
+            QVariant elementDefaultValue = valueFromElementUnits(pid, element->propertyDefault(pid), element);
+            if (convertElementPropertyValueFunc) {
+                elementDefaultValue = convertElementPropertyValueFunc(elementDefaultValue);
+            }
+
             propertyValue = elementCurrentValue;
             defaultPropertyValue = elementDefaultValue;
         }
@@ -193,6 +193,8 @@ void LanguagesService::setCurrentLanguage(const QString& languageCode)
         }
     }
 
+    clearTranslationCache();
+
     QLocale locale(lang.code);
     QLocale::setDefault(locale);
     qApp->setLayoutDirection(locale.textDirection());
@@ -125,7 +125,7 @@ void LearnService::th_requestPlaylist(const QUrl& playlistUrl, std::function<voi
 {
     TRACEFUNC;
 
-    network::INetworkManagerPtr networkManager = networkManagerCreator()->makeNetworkManager();
+    network::INetworkManagerPtr networkManager = networkManagerCreator()->makeCachingNetworkManager();
     RequestHeaders headers = configuration()->headers();
 
     QBuffer playlistItemsData;
@@ -214,7 +214,7 @@ int main(int argc, char** argv)
     app.addModule(new mu::musesampler::MuseSamplerModule());
 #endif
 
-    app.addModule(new mu::learn::LearnModule());
+    app.addModule(new mu::learn::LearnModule(), true);
 
     app.addModule(new mu::engraving::EngravingModule());
     app.addModule(new mu::notation::NotationModule());
@@ -241,7 +241,7 @@ int main(int argc, char** argv)
 
     app.addModule(new mu::inspector::InspectorModule());
 #ifdef BUILD_PALETTE_MODULE
-    app.addModule(new mu::palette::PaletteModule());
+    app.addModule(new mu::palette::PaletteModule(), true);
 #else
     app.addModule(new mu::palette::PaletteStubModule());
 #endif
@@ -265,7 +265,7 @@ int main(int argc, char** argv)
 #endif
 
 #ifdef BUILD_WORKSPACE_MODULE
-    app.addModule(new mu::workspace::WorkspaceModule());
+    app.addModule(new mu::workspace::WorkspaceModule(), true);
 #else
     app.addModule(new mu::workspace::WorkspaceStubModule());
 #endif
@@ -275,7 +275,7 @@ int main(int argc, char** argv)
     app.addModule(new mu::plugins::PluginsStubModule());
 #endif
 #ifdef BUILD_CLOUD_MODULE
-    app.addModule(new mu::cloud::CloudModule());
+    app.addModule(new mu::cloud::CloudModule(), true);
 #else
     app.addModule(new mu::cloud::CloudStubModule());
 #endif
@@ -285,16 +285,16 @@ int main(int argc, char** argv)
     app.addModule(new mu::languages::LanguagesStubModule());
 #endif
 
-    app.addModule(new mu::mi::MultiInstancesModule());
+    app.addModule(new mu::mi::MultiInstancesModule(), true);
 
 #ifdef BUILD_UPDATE_MODULE
-    app.addModule(new mu::update::UpdateModule());
+    app.addModule(new mu::update::UpdateModule(), true);
 #else
     app.addModule(new mu::update::UpdateStubModule());
 #endif
 
 #ifdef BUILD_AUTOBOT_MODULE
-    app.addModule(new mu::autobot::AutobotModule());
+    app.addModule(new mu::autobot::AutobotModule(), true);
 #endif
 
 #else
@@ -98,10 +98,16 @@ Code IpcChannel::syncRequestToAll(const QString& method, const QStringList& args
     msg.method = method;
     msg.args = args;
 
-    IpcLoop loop;
-
     int total = m_selfSocket->instances().count();
     total -= 1; //! NOTE Exclude itself
+
+    //! NOTE If this is the only instance, nobody can answer, so don't wait for the timeout.
+    //! Until the server has sent the instances list (total < 0), the request is sent anyway
+    if (total == 0) {
+        return Code::AllAnswered;
+    }
+
+    IpcLoop loop;
     int received = 0;
 
     m_msgCallback = [method, total, &received, &loop, onReceived](const Msg& msg) {
@@ -23,9 +23,8 @@
 
 #include <QProcess>
 #include <QCoreApplication>
-#include <QTimer>
-#include <QEventLoop>
 
+#include "ipc/ipcloop.h"
 #include "types/uri.h"
 #include "settings.h"
 #include "log.h"
@@ -39,6 +38,7 @@ static const QString METHOD_PROJECT_IS_OPENED("PROJECT_IS_OPENED");
 static const QString METHOD_ACTIVATE_WINDOW_WITH_PROJECT("ACTIVATE_WINDOW_WITH_PROJECT");
 static const QString METHOD_IS_WITHOUT_PROJECT("IS_WITHOUT_PROJECT");
 static const QString METHOD_ACTIVATE_WINDOW_WITHOUT_PROJECT("METHOD_ACTIVATE_WINDOW_WITHOUT_PROJECT");
+static const QString METHOD_OPEN_PROJECT("METHOD_OPEN_PROJECT");
 
 static const mu::Uri PREFERENCES_URI("musescore://preferences");
 static const QString METHOD_PREFERENCES_IS_OPENED("PREFERENCES_IS_OPENED");
@@ -101,12 +101,17 @@ void MultiInstancesProvider::onMsg(const Msg& msg)
         }
     } else if (msg.type == MsgType::Request && msg.method == METHOD_IS_WITHOUT_PROJECT) {
         bool isAnyOpened = projectFilesController()->isAnyProjectOpened();
-        m_ipcChannel->response(METHOD_IS_WITHOUT_PROJECT, { QString::number(!isAnyOpened) }, msg.srcID);
+        m_ipcChannel->response(METHOD_IS_WITHOUT_PROJECT, { QString::number(!isAnyOpened), QString::fromStdString(m_selfID) }, msg.srcID);
     } else if (msg.method == METHOD_ACTIVATE_WINDOW_WITHOUT_PROJECT) {
         bool isAnyOpened = projectFilesController()->isAnyProjectOpened();
         if (!isAnyOpened) {
             mainWindow()->requestShowOnFront();
         }
+    } else if (msg.method == METHOD_OPEN_PROJECT) {
+        CHECK_ARGS_COUNT(1);
+        //! NOTE If a project was opened here meanwhile, opening creates a new instance as usual
+        mainWindow()->requestShowOnFront();
+        dispatcher()->dispatch("file-open", actions::ActionData::make_arg1<io::path_t>(io::path_t(msg.args.at(0))));
     }
     // Settings
     else if (msg.type == MsgType::Request && msg.method == METHOD_PREFERENCES_IS_OPENED) {
@@ -204,6 +209,41 @@ void MultiInstancesProvider::activateWindowWithoutProject()
     m_ipcChannel->broadcast(METHOD_ACTIVATE_WINDOW_WITHOUT_PROJECT, {});
 }
 
+bool MultiInstancesProvider::openProjectInAppInstanceWithoutProject(const io::path_t& projectPath)
+{
+    if (!isInited()) {
+        return false;
+    }
+
+    //! NOTE An instance without a project already has its fonts, templates and sound fonts loaded,
+    //! so the project is opened there rather than in a new process
+    QString instanceID;
+    m_ipcChannel->syncRequestToAll(METHOD_IS_WITHOUT_PROJECT, {}, [&instanceID](const QStringList& args) {
+        IF_ASSERT_FAILED(!args.empty()) {
+            return false;
+        }
+        if (args.at(0).toInt() && args.size() > 1) {
+            instanceID = args.at(1);
+            return true;
+        }
+
+        return false;
+    });
+
+    if (instanceID.isEmpty()) {
+        return false;
+    }
+
+    Msg msg;
+    msg.destID = instanceID;
+    msg.type = MsgType::Notify;
+    msg.method = METHOD_OPEN_PROJECT;
+    msg.args = { projectPath.toQString() };
+
+    mainWindow()->requestShowOnBack();
+    return m_ipcChannel->send(msg);
+}
+
 bool MultiInstancesProvider::openNewAppInstance(const QStringList& args)
 {
     if (!isInited()) {
@@ -221,30 +261,30 @@ bool MultiInstancesProvider::openNewAppInstance(const QStringList& args)
         return ok;
     }
 
-    auto sleep = [](int msec) {
-        QTimer timer;
-        QEventLoop loop;
-        QObject::connect(&timer, &QTimer::timeout, &loop, &QEventLoop::quit);
-        timer.start(msec);
-        loop.exec();
-    };
-
-    auto waitNewInstance = [this, sleep, currentApps](int waitMs, int count) {
-        for (int i = 0; i < count; ++i) {
-            sleep(waitMs);
-            QList<ID> apps = m_ipcChannel->instances();
-            for (const ID& id : apps) {
-                if (!currentApps.contains(id)) {
-                    LOGI() << "created new instance with ID: " << id;
-                    return true;
-                }
+    auto isNewInstanceRegistered = [this, currentApps]() {
+        for (const ID& id : m_ipcChannel->instances()) {
+            if (!currentApps.contains(id)) {
+                LOGI() << "created new instance with ID: " << id;
+                return true;
             }
         }
         return false;
     };
 
-    //! NOTE Waiting for a new instance to be created
-    ok = waitNewInstance(100, 50);
+    //! NOTE Waiting for a new instance to be created, the instances list changes when it registers
+    ok = isNewInstanceRegistered();
+    if (!ok) {
+        mu::async::Asyncable waiter;
+        IpcLoop loop;
+        m_instancesChanged.onNotify(&waiter, [&loop, isNewInstanceRegistered]() {
+            if (isNewInstanceRegistered()) {
+                loop.exit(Code::Success);
+            }
+        });
+
+        ok = loop.exec(5000) == Code::Success;
+    }
+
     if (!ok) {
         LOGE() << "we didn't wait for registration and response from the new instance";
     }
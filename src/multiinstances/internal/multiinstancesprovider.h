@@ -56,6 +56,7 @@ public:
     void activateWindowWithProject(const io::path_t& projectPath) override;
     bool isHasAppInstanceWithoutProject() const override;
     void activateWindowWithoutProject() override;
+    bool openProjectInAppInstanceWithoutProject(const io::path_t& projectPath) override;
     bool openNewAppInstance(const QStringList& args) override;
 
     // Settings
@@ -96,6 +96,10 @@ public:
 
     // notify
     virtual async::Notification notationChanged() const = 0;
+
+    //! NOTE The canvas areas changed along with the last notationChanged(),
+    //! empty if the whole canvas has to be repainted
+    virtual const std::vector<RectF>& changedArea() const = 0;
 };
 }
 
@@ -85,6 +85,9 @@ public:
     virtual int selectionProximity() const = 0;
     virtual void setSelectionProximity(int proximity) = 0;
 
+    virtual int undoHistoryMemoryBudgetMb() const = 0;
+    virtual void setUndoHistoryMemoryBudgetMb(int megabytes) = 0;
+
     virtual ZoomType defaultZoomType() const = 0;
     virtual void setDefaultZoomType(ZoomType zoomType) = 0;
 
@@ -142,6 +145,10 @@ public:
     virtual void setIsLimitCanvasScrollArea(bool limited) = 0;
     virtual async::Notification isLimitCanvasScrollAreaChanged() const = 0;
 
+    virtual bool isCanvasHardwareAccelerated() const = 0;
+    virtual void setIsCanvasHardwareAccelerated(bool accelerated) = 0;
+    virtual async::Notification isCanvasHardwareAcceleratedChanged() const = 0;
+
     virtual bool colorNotesOutsideOfUsablePitchRange() const = 0;
     virtual void setColorNotesOutsideOfUsablePitchRange(bool value) = 0;
 
@@ -55,7 +55,14 @@ public:
     virtual int pageCount() const = 0;
     virtual SizeF pageSizeInch() const = 0;
 
+    //! NOTE Paints the pages only, the interaction (selection range, drop anchors, edit grips etc.)
+    //! is painted over them separately, so the pages can be cached by the view
     virtual void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewInteraction(draw::Painter* painter) = 0;
+
+    //! NOTE The elements painted with paintView are recorded and replayed on the next paints, the records are
+    //! dropped on any change of the notation. Rect marks a change (like selection) of only the elements in it
+    virtual void invalidateView(const RectF& rect) = 0;
     virtual void paintPdf(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(draw::Painter* painter, const Options& opt) = 0;
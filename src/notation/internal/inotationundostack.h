@@ -51,6 +51,13 @@ public:
     virtual void rollbackChanges() = 0;
     virtual void commitChanges() = 0;
 
+    //! NOTE Changes made between beginBatch() and commitBatch() form one undo step,
+    //! the score is laid out and the change notifications are sent once in commitBatch()
+    virtual void beginBatch() = 0;
+    virtual void rollbackBatch() = 0;
+    virtual void commitBatch() = 0;
+    virtual bool isBatchActive() const = 0;
+
     virtual void lock() = 0;
     virtual void unlock() = 0;
     virtual bool isLocked() const = 0;
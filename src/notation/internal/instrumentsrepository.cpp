@@ -34,7 +34,10 @@ void InstrumentsRepository::init()
         load();
     });
 
-    load();
+    //! NOTE The templates are loaded by loadTemplates, on a worker thread at startup,
+    //! so the paths are read here
+    m_instrumentListPath = configuration()->instrumentListPath();
+    m_scoreOrderListPaths = configuration()->scoreOrderListPaths();
 }
 
 const InstrumentTemplateList& InstrumentsRepository::instrumentTemplates() const
@@ -91,6 +94,14 @@ const InstrumentGroupList& InstrumentsRepository::groups() const
 }
 
 void InstrumentsRepository::load()
+{
+    m_instrumentListPath = configuration()->instrumentListPath();
+    m_scoreOrderListPaths = configuration()->scoreOrderListPaths();
+
+    loadTemplates();
+}
+
+void InstrumentsRepository::loadTemplates()
 {
     TRACEFUNC;
 
@@ -99,12 +110,11 @@ void InstrumentsRepository::load()
     m_groups.clear();
     mu::engraving::clearInstrumentTemplates();
 
-    io::path_t instrumentsPath = configuration()->instrumentListPath();
-    if (!mu::engraving::loadInstrumentTemplates(instrumentsPath)) {
-        LOGE() << "Could not load instruments from " << instrumentsPath << "!";
+    if (!mu::engraving::loadInstrumentTemplates(m_instrumentListPath)) {
+        LOGE() << "Could not load instruments from " << m_instrumentListPath << "!";
     }
 
-    for (const io::path_t& ordersPath : configuration()->scoreOrderListPaths()) {
+    for (const io::path_t& ordersPath : m_scoreOrderListPaths) {
         if (!mu::engraving::loadInstrumentTemplates(ordersPath)) {
             LOGE() << "Could not load orders from " << ordersPath << "!";
         }
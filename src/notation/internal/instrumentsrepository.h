@@ -37,6 +37,7 @@ class InstrumentsRepository : public IInstrumentsRepository, public async::Async
 
 public:
     void init();
+    void loadTemplates();
 
     const InstrumentTemplateList& instrumentTemplates() const override;
     const InstrumentTemplate& instrumentTemplate(const std::string& instrumentId) const override;
@@ -51,6 +52,9 @@ private:
     void load();
     void clear();
 
+    io::path_t m_instrumentListPath;
+    io::paths_t m_scoreOrderListPaths;
+
     InstrumentTemplateList m_instrumentTemplates;
     InstrumentGroupList m_groups;
     InstrumentGenreList m_genres;
@@ -26,6 +26,7 @@
 
 #include "log.h"
 #include "translation.h"
+#include "async/async.h"
 
 #include "engraving/style/defaultstyle.h"
 #include "engraving/style/pagestyle.h"
@@ -51,6 +52,8 @@ using namespace mu::notation;
 using namespace mu::async;
 using namespace mu::engraving;
 
+static constexpr size_t BACKGROUND_LAYOUT_PAGE_CHUNK = 4;
+
 static ExcerptNotation* get_impl(const IExcerptNotationPtr& excerpt)
 {
     return static_cast<ExcerptNotation*>(excerpt.get());
@@ -120,8 +123,37 @@ void MasterNotation::setMasterScore(mu::engraving::MasterScore* score)
 
     setScore(score);
     score->updateSwing();
+
+    //! NOTE 0 or negative means unlimited history
+    int undoBudgetMb = configuration()->undoHistoryMemoryBudgetMb();
+    score->undoStack()->setMemoryBudget(undoBudgetMb > 0 ? static_cast<size_t>(undoBudgetMb) * 1024 * 1024 : 0);
     m_notationPlayback->init(m_undoStack);
     initExcerptNotations(masterScore()->excerpts());
+
+    continueLayoutInBackground();
+}
+
+//! NOTE A large score may have been laid out only up to the first pages on load
+//! (see NotationProject::doLoad), lay out the rest in chunks from the event loop
+//! so the UI stays responsive and the already visible pages can be painted
+void MasterNotation::continueLayoutInBackground()
+{
+    mu::engraving::MasterScore* score = masterScore();
+    if (!score || score->isLayoutComplete()) {
+        return;
+    }
+
+    Async::call(this, [this]() {
+        mu::engraving::MasterScore* score = masterScore();
+        if (!score || score->isLayoutComplete()) {
+            return;
+        }
+
+        score->continueLayout(BACKGROUND_LAYOUT_PAGE_CHUNK);
+        notifyAboutNotationChanged();
+
+        continueLayoutInBackground();
+    });
 }
 
 mu::engraving::MasterScore* MasterNotation::masterScore() const
@@ -502,7 +534,8 @@ void MasterNotation::addExcerpts(const ExcerptNotationList& excerpts)
         }
 
         ExcerptNotation* excerptNotationImpl = get_impl(excerptNotation);
-        masterScore()->initAndAddExcerpt(excerptNotationImpl->excerpt(), false);
+        //! NOTE The part is laid out when it is opened
+        masterScore()->initAndAddExcerpt(excerptNotationImpl->excerpt(), false, false);
         excerptNotationImpl->init();
 
         result.push_back(excerptNotation);
@@ -774,7 +807,7 @@ void MasterNotation::addExcerptsToMasterScore(const std::vector<mu::engraving::E
     TRACEFUNC;
 
     for (mu::engraving::Excerpt* excerpt : excerpts) {
-        masterScore()->initAndAddExcerpt(excerpt, false);
+        masterScore()->initAndAddExcerpt(excerpt, false, false);
     }
 
     masterScore()->setExcerptsChanged(false);
@@ -78,6 +78,8 @@ private:
 
     mu::engraving::MasterScore* masterScore() const;
 
+    void continueLayoutInBackground();
+
     void initExcerptNotations(const std::vector<mu::engraving::Excerpt*>& excerpts);
     void addExcerptsToMasterScore(const std::vector<mu::engraving::Excerpt*>& excerpts);
     void doSetExcerpts(ExcerptNotationList excerpts);
@@ -48,6 +48,17 @@ using namespace mu::notation;
 
 Notation::Notation(mu::engraving::Score* score)
 {
+    //! NOTE Subscribed first, so the changed area is up to date for all the other subscribers
+    m_notationChanged.onNotify(this, [this]() {
+        if (m_keepChangedArea) {
+            return;
+        }
+
+        if (!m_score || !m_score->takeDamage(m_changedArea)) {
+            m_changedArea.clear();
+        }
+    });
+
     m_painting = std::make_shared<NotationPainting>(this);
     m_viewState = std::make_shared<NotationViewState>(this);
     m_undoStack = std::make_shared<NotationUndoStack>(this, m_notationChanged);
@@ -56,10 +67,14 @@ Notation::Notation(mu::engraving::Score* score)
     m_accessibility = std::make_shared<NotationAccessibility>(this);
     m_parts = std::make_shared<NotationParts>(this, m_interaction, m_undoStack);
     m_style = std::make_shared<NotationStyle>(this, m_undoStack);
-    m_elements = std::make_shared<NotationElements>(this);
+    m_elements = std::make_shared<NotationElements>(this, m_notationChanged);
 
     m_interaction->noteInput()->noteAdded().onNotify(this, [this]() {
+        //! NOTE The added note was laid out and notified along with the undo stack commit,
+        //! so the changed area stays the same
+        m_keepChangedArea = true;
         notifyAboutNotationChanged();
+        m_keepChangedArea = false;
     });
 
     m_interaction->dragChanged().onNotify(this, [this]() {
@@ -231,6 +246,11 @@ mu::async::Notification Notation::openChanged() const
 
 void Notation::notifyAboutNotationChanged()
 {
+    //! NOTE Sent once when the batch is committed
+    if (m_undoStack && m_undoStack->isBatchActive()) {
+        return;
+    }
+
     m_notationChanged.notify();
 }
 
@@ -284,6 +304,11 @@ mu::async::Notification Notation::notationChanged() const
     return m_notationChanged;
 }
 
+const std::vector<mu::RectF>& Notation::changedArea() const
+{
+    return m_changedArea;
+}
+
 INotationAccessibilityPtr Notation::accessibility() const
 {
     return m_accessibility;
@@ -74,6 +74,7 @@ public:
     INotationPartsPtr parts() const override;
 
     async::Notification notationChanged() const override;
+    const std::vector<RectF>& changedArea() const override;
 
 protected:
     mu::engraving::Score* score() const override;
@@ -85,6 +86,8 @@ protected:
     INotationPartsPtr m_parts = nullptr;
     INotationUndoStackPtr m_undoStack = nullptr;
     async::Notification m_notationChanged;
+    std::vector<RectF> m_changedArea;
+    bool m_keepChangedArea = false;
 
 private:
     friend class NotationInteraction;
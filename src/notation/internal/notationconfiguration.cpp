@@ -50,6 +50,8 @@ static const Settings::Key FOREGROUND_USE_COLOR(module_name, "ui/canvas/foregrou
 
 static const Settings::Key SELECTION_PROXIMITY(module_name, "ui/canvas/misc/selectionProximity");
 
+static const Settings::Key UNDO_HISTORY_MEMORY_BUDGET(module_name, "application/undo/memoryBudgetMb");
+
 static const Settings::Key DEFAULT_ZOOM_TYPE(module_name, "ui/canvas/zoomDefaultType");
 static const Settings::Key DEFAULT_ZOOM(module_name, "ui/canvas/zoomDefaultLevel");
 static const Settings::Key KEYBOARD_ZOOM_PRECISION(module_name, "ui/canvas/zoomPrecisionKeyboard");
@@ -68,6 +70,7 @@ static const Settings::Key TOOLBAR_KEY(module_name, "ui/toolbar/");
 
 static const Settings::Key IS_CANVAS_ORIENTATION_VERTICAL_KEY(module_name, "ui/canvas/scroll/verticalOrientation");
 static const Settings::Key IS_LIMIT_CANVAS_SCROLL_AREA_KEY(module_name, "ui/canvas/scroll/limitScrollArea");
+static const Settings::Key IS_CANVAS_HARDWARE_ACCELERATED_KEY(module_name, "ui/canvas/hardwareAccelerated");
 
 static const Settings::Key COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE(module_name, "score/note/warnPitchRange");
 static const Settings::Key REALTIME_DELAY(module_name, "io/midi/realtimeDelay");
@@ -154,6 +157,7 @@ void NotationConfiguration::init()
     fileSystem()->makePath(userStylesPath());
 
     settings()->setDefaultValue(SELECTION_PROXIMITY, Val(2));
+    settings()->setDefaultValue(UNDO_HISTORY_MEMORY_BUDGET, Val(256));
     settings()->setDefaultValue(IS_MIDI_INPUT_ENABLED, Val(true));
     settings()->setDefaultValue(IS_AUTOMATICALLY_PAN_ENABLED, Val(true));
     settings()->setDefaultValue(IS_PLAY_REPEATS_ENABLED, Val(true));
@@ -175,6 +179,12 @@ void NotationConfiguration::init()
         m_isLimitCanvasScrollAreaChanged.notify();
     });
 
+    settings()->setDefaultValue(IS_CANVAS_HARDWARE_ACCELERATED_KEY, Val(true));
+    settings()->setCanBeManuallyEdited(IS_CANVAS_HARDWARE_ACCELERATED_KEY, true);
+    settings()->valueChanged(IS_CANVAS_HARDWARE_ACCELERATED_KEY).onReceive(this, [this](const Val&) {
+        m_isCanvasHardwareAcceleratedChanged.notify();
+    });
+
     settings()->setDefaultValue(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE, Val(true));
     settings()->setDefaultValue(REALTIME_DELAY, Val(750));
     settings()->setDefaultValue(NOTE_DEFAULT_PLAY_DURATION, Val(500));
@@ -425,6 +435,16 @@ void NotationConfiguration::setSelectionProximity(int proximity)
     settings()->setSharedValue(SELECTION_PROXIMITY, Val(proximity));
 }
 
+int NotationConfiguration::undoHistoryMemoryBudgetMb() const
+{
+    return settings()->value(UNDO_HISTORY_MEMORY_BUDGET).toInt();
+}
+
+void NotationConfiguration::setUndoHistoryMemoryBudgetMb(int megabytes)
+{
+    settings()->setSharedValue(UNDO_HISTORY_MEMORY_BUDGET, Val(megabytes));
+}
+
 ZoomType NotationConfiguration::defaultZoomType() const
 {
     return settings()->value(DEFAULT_ZOOM_TYPE).toEnum<ZoomType>();
@@ -632,6 +652,21 @@ Notification NotationConfiguration::isLimitCanvasScrollAreaChanged() const
     return m_isLimitCanvasScrollAreaChanged;
 }
 
+bool NotationConfiguration::isCanvasHardwareAccelerated() const
+{
+    return settings()->value(IS_CANVAS_HARDWARE_ACCELERATED_KEY).toBool();
+}
+
+void NotationConfiguration::setIsCanvasHardwareAccelerated(bool accelerated)
+{
+    settings()->setSharedValue(IS_CANVAS_HARDWARE_ACCELERATED_KEY, Val(accelerated));
+}
+
+Notification NotationConfiguration::isCanvasHardwareAcceleratedChanged() const
+{
+    return m_isCanvasHardwareAcceleratedChanged;
+}
+
 bool NotationConfiguration::colorNotesOutsideOfUsablePitchRange() const
 {
     return settings()->value(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE).toBool();
@@ -89,6 +89,9 @@ public:
     int selectionProximity() const override;
     void setSelectionProximity(int proximity) override;
 
+    int undoHistoryMemoryBudgetMb() const override;
+    void setUndoHistoryMemoryBudgetMb(int megabytes) override;
+
     ZoomType defaultZoomType() const override;
     void setDefaultZoomType(ZoomType zoomType) override;
 
@@ -146,6 +149,10 @@ public:
     void setIsLimitCanvasScrollArea(bool limited) override;
     async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool isCanvasHardwareAccelerated() const override;
+    void setIsCanvasHardwareAccelerated(bool accelerated) override;
+    async::Notification isCanvasHardwareAcceleratedChanged() const override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value) override;
 
@@ -200,6 +207,7 @@ private:
     async::Channel<io::path_t> m_userStylesPathChanged;
     async::Notification m_scoreOrderListPathsChanged;
     async::Notification m_isLimitCanvasScrollAreaChanged;
+    async::Notification m_isCanvasHardwareAcceleratedChanged;
     async::Notification m_isPlayRepeatsChanged;
     async::Notification m_isPlayChordSymbolsChanged;
     ValCh<int> m_pianoKeyboardNumberOfKeys;
@@ -32,9 +32,12 @@
 
 using namespace mu::notation;
 
-NotationElements::NotationElements(IGetScore* getScore)
+NotationElements::NotationElements(IGetScore* getScore, async::Notification notationChanged)
     : m_getScore(getScore)
 {
+    notationChanged.onNotify(this, [this]() {
+        m_indicesValid = false;
+    });
 }
 
 mu::engraving::Score* NotationElements::msScore() const
@@ -95,11 +98,29 @@ std::vector<EngravingItem*> NotationElements::elements(const FilterElementsOptio
     return result;
 }
 
-mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string& name) const
+void NotationElements::buildIndicesIfNeed() const
 {
-    QString qname = QString::fromStdString(name).toLower();
+    const mu::engraving::Score* score = this->score();
+    if (m_indicesValid && m_indexedScore == score) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    m_indexedScore = score;
+    m_indicesValid = true;
+    m_measures.clear();
+    m_rehearsalMarks.clear();
+
+    if (!score) {
+        return;
+    }
+
+    for (mu::engraving::Measure* measure = score->firstMeasure(); measure; measure = measure->nextMeasure()) {
+        m_measures.push_back(measure);
+    }
 
-    for (mu::engraving::Segment* segment = score()->firstSegment(mu::engraving::SegmentType::ChordRest); segment;
+    for (mu::engraving::Segment* segment = score->firstSegment(mu::engraving::SegmentType::ChordRest); segment;
          segment = segment->next1(mu::engraving::SegmentType::ChordRest)) {
         for (EngravingItem* element: segment->annotations()) {
             if (element->type() != ElementType::REHEARSAL_MARK) {
@@ -107,10 +128,20 @@ mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string&
             }
 
             mu::engraving::RehearsalMark* rehearsalMark = static_cast<mu::engraving::RehearsalMark*>(element);
-            QString rehearsalMarkName = rehearsalMark->plainText().toQString().toLower();
-            if (rehearsalMarkName.startsWith(qname)) {
-                return rehearsalMark;
-            }
+            m_rehearsalMarks.push_back({ rehearsalMark->plainText().toQString().toLower(), rehearsalMark });
+        }
+    }
+}
+
+mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string& name) const
+{
+    buildIndicesIfNeed();
+
+    QString qname = QString::fromStdString(name).toLower();
+
+    for (const RehearsalMarkEntry& entry : m_rehearsalMarks) {
+        if (entry.name.startsWith(qname)) {
+            return entry.mark;
         }
     }
 
@@ -119,7 +150,13 @@ mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string&
 
 mu::engraving::Measure* NotationElements::measure(const int measureIndex) const
 {
-    return score()->crMeasure(measureIndex);
+    buildIndicesIfNeed();
+
+    if (measureIndex < 0 || size_t(measureIndex) >= m_measures.size()) {
+        return nullptr;
+    }
+
+    return m_measures.at(measureIndex);
 }
 
 PageList NotationElements::pages() const
@@ -22,14 +22,21 @@
 #ifndef MU_NOTATION_NOTATIONELEMENTS_H
 #define MU_NOTATION_NOTATIONELEMENTS_H
 
+#include <vector>
+
+#include <QString>
+
+#include "async/asyncable.h"
+#include "async/notification.h"
+
 #include "inotationelements.h"
 #include "igetscore.h"
 
 namespace mu::notation {
-class NotationElements : public INotationElements
+class NotationElements : public INotationElements, public async::Asyncable
 {
 public:
-    NotationElements(IGetScore* getScore);
+    NotationElements(IGetScore* getScore, async::Notification notationChanged);
 
     mu::engraving::Score* msScore() const override;
 
@@ -54,7 +61,20 @@ private:
     ElementPattern* constructElementPattern(const FilterElementsOptions* elementsOptions) const;
     mu::engraving::NotePattern* constructNotePattern(const FilterNotesOptions* notesOptions) const;
 
+    //! NOTE The lookup indices are built on the first search after a change of the score
+    void buildIndicesIfNeed() const;
+
+    struct RehearsalMarkEntry {
+        QString name;
+        mu::engraving::RehearsalMark* mark = nullptr;
+    };
+
     IGetScore* m_getScore = nullptr;
+
+    mutable const mu::engraving::Score* m_indexedScore = nullptr;
+    mutable bool m_indicesValid = false;
+    mutable std::vector<Measure*> m_measures;
+    mutable std::vector<RehearsalMarkEntry> m_rehearsalMarks;
 };
 }
 
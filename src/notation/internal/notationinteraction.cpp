@@ -3628,7 +3628,9 @@ void NotationInteraction::swapSelection()
     QString mimeType = selection.mimeType();
 
     if (mimeType == mu::engraving::mimeStaffListFormat) { // determine size of clipboard selection
-        const QMimeData* mimeData = this->selection()->mimeData();
+        //! NOTE Only the attributes of the root element are needed, so the clipboard is not parsed further,
+        //! and the selection is serialized only once, for the backup below
+        const QMimeData* mimeData = QApplication::clipboard()->mimeData();
         QByteArray data = mimeData ? mimeData->data(mu::engraving::mimeStaffListFormat) : QByteArray();
         mu::engraving::XmlReader reader(data);
         reader.readNextStartElement();
@@ -23,6 +23,7 @@
 
 #include <QGuiApplication>
 
+#include "libmscore/chord.h"
 #include "libmscore/masterscore.h"
 #include "libmscore/segment.h"
 #include "libmscore/tie.h"
@@ -64,7 +65,14 @@ void NotationMidiInput::onMidiEventReceived(const midi::Event& event)
     }
 
     if (event.opcode() == midi::Event::Opcode::NoteOn || event.opcode() == midi::Event::Opcode::NoteOff) {
+        if (event.opcode() == midi::Event::Opcode::NoteOn) {
+            if (auto latency = inputLatencyRegister()) {
+                latency->beginInput("midi input");
+            }
+        }
+
         m_eventsQueue.push_back(event);
+        m_previewedEvents.push_back(playPreview(event));
 
         if (!m_processTimer.isActive()) {
             m_processTimer.start(PROCESS_INTERVAL);
@@ -116,12 +124,17 @@ void NotationMidiInput::doProcessEvents()
     }
 
     std::vector<const Note*> notes;
+    std::vector<const EngravingItem*> notesItems;
 
     for (size_t i = 0; i < m_eventsQueue.size(); ++i) {
         const midi::Event& event = m_eventsQueue.at(i);
         Note* note = isNoteInputMode() ? addNoteToScore(event) : makeNote(event);
         if (note) {
             notes.push_back(note);
+
+            if (!m_previewedEvents.at(i)) {
+                notesItems.push_back(note);
+            }
         }
 
         bool chord = i != 0;
@@ -133,17 +146,16 @@ void NotationMidiInput::doProcessEvents()
         }
     }
 
-    if (!notes.empty()) {
-        std::vector<const EngravingItem*> notesItems;
-        for (const Note* note : notes) {
-            notesItems.push_back(note);
-        }
-
+    if (!notesItems.empty()) {
         playbackController()->playElements(notesItems);
+    }
+
+    if (!notes.empty()) {
         m_notesReceivedChannel.send(notes);
     }
 
     m_eventsQueue.clear();
+    m_previewedEvents.clear();
     m_processTimer.stop();
 }
 
@@ -244,6 +256,25 @@ Note* NotationMidiInput::makeNote(const midi::Event& e)
     return note;
 }
 
+//! NOTE Plays the note as soon as it's received, the note input and the layout of the score
+//! are done later by doProcessEvents, so on big scores the preview doesn't wait for them.
+//! The note is only made for the playback, it's the same as the one makeNote makes for doProcessEvents
+bool NotationMidiInput::playPreview(const midi::Event& e)
+{
+    Note* note = makeNote(e);
+    if (!note) {
+        return false;
+    }
+
+    playbackController()->playElements({ note });
+
+    Chord* chord = note->chord();
+    delete note;
+    delete chord;
+
+    return true;
+}
+
 void NotationMidiInput::enableMetronome()
 {
     bool metronomeEnabled = configuration()->isMetronomeEnabled();
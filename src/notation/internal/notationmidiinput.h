@@ -28,6 +28,7 @@
 #include "playback/iplaybackcontroller.h"
 #include "inotationconfiguration.h"
 #include "actions/iactionsdispatcher.h"
+#include "diagnostics/iinputlatencyregister.h"
 
 #include "../inotationmidiinput.h"
 #include "igetscore.h"
@@ -44,6 +45,7 @@ class NotationMidiInput : public INotationMidiInput
     INJECT(notation, playback::IPlaybackController, playbackController)
     INJECT(notation, actions::IActionsDispatcher, dispatcher)
     INJECT(notation, INotationConfiguration, configuration)
+    INJECT(notation, diagnostics::IInputLatencyRegister, inputLatencyRegister)
 
 public:
     NotationMidiInput(IGetScore* getScore, INotationInteractionPtr notationInteraction, INotationUndoStackPtr undoStack);
@@ -59,6 +61,7 @@ private:
     void doProcessEvents();
     Note* addNoteToScore(const midi::Event& e);
     Note* makeNote(const midi::Event& e);
+    bool playPreview(const midi::Event& e);
 
     void enableMetronome();
     void disableMetronome();
@@ -83,6 +86,7 @@ private:
 
     QTimer m_processTimer;
     std::vector<midi::Event> m_eventsQueue;
+    std::vector<bool> m_previewedEvents; // for each event of the queue, true if playPreview played it
 
     QTimer m_realtimeTimer;
     QTimer m_extendNoteTimer;
@@ -325,6 +325,8 @@ void NotationNoteInput::addNote(NoteName noteName, NoteAddingMode addingMode)
 {
     TRACEFUNC;
 
+    beginInputLatency();
+
     mu::engraving::EditData editData(m_scoreCallbacks);
 
     startEdit();
@@ -342,6 +344,8 @@ void NotationNoteInput::padNote(const Pad& pad)
 {
     TRACEFUNC;
 
+    beginInputLatency();
+
     mu::engraving::EditData editData(m_scoreCallbacks);
 
     startEdit();
@@ -355,6 +359,8 @@ mu::Ret NotationNoteInput::putNote(const PointF& pos, bool replace, bool insert)
 {
     TRACEFUNC;
 
+    beginInputLatency();
+
     startEdit();
     Ret ret = score()->putNote(pos, replace, insert);
     apply();
@@ -611,6 +617,13 @@ mu::engraving::Score* NotationNoteInput::score() const
     return m_getScore->score();
 }
 
+void NotationNoteInput::beginInputLatency()
+{
+    if (auto latency = inputLatencyRegister()) {
+        latency->beginInput("note input");
+    }
+}
+
 void NotationNoteInput::startEdit()
 {
     m_undoStack->prepareChanges();
@@ -29,6 +29,7 @@
 #include "igetscore.h"
 #include "inotationinteraction.h"
 #include "inotationundostack.h"
+#include "diagnostics/iinputlatencyregister.h"
 
 #include "draw/types/geometry.h"
 
@@ -41,6 +42,7 @@ class ScoreCallbacks;
 class NotationNoteInput : public INotationNoteInput, public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, configuration)
+    INJECT(notation, diagnostics::IInputLatencyRegister, inputLatencyRegister)
 
 public:
     NotationNoteInput(const IGetScore* getScore, INotationInteraction* interaction, INotationUndoStackPtr undoStack);
@@ -85,6 +87,8 @@ public:
     void setGetViewRectFunc(const std::function<RectF()>& func);
 
 private:
+    void beginInputLatency();
+
     mu::engraving::Score* score() const;
 
     EngravingItem* resolveNoteInputStartPosition() const;
@@ -21,12 +21,20 @@
  */
 #include "notationpainting.h"
 
+#include <set>
+
 #include <QScreen>
 
 #include "engraving/libmscore/score.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/system.h"
 #include "engraving/infrastructure/paint.h"
 #include "engraving/infrastructure/debugpaint.h"
 
+#include "draw/utils/drawdatapaint.h"
+#include "containers.h"
+#include "realfn.h"
+
 #include "notation.h"
 #include "notationinteraction.h"
 
@@ -37,9 +45,25 @@ using namespace mu::notation;
 using namespace mu::engraving;
 using namespace mu::draw;
 
+//! NOTE Below this height (in device pixels) the staff lines merge, so the staves are drawn as bands
+static constexpr double SIMPLIFIED_STAFF_MAX_HEIGHT = 4.0;
+
 NotationPainting::NotationPainting(Notation* notation)
     : m_notation(notation)
 {
+    m_recorder = std::make_shared<BufferedPaintProvider>();
+
+    m_notation->notationChanged().onNotify(this, [this]() {
+        const std::vector<RectF>& changedArea = m_notation->changedArea();
+        if (changedArea.empty()) {
+            m_pageDisplayLists.clear();
+            return;
+        }
+
+        for (const RectF& rect : changedArea) {
+            invalidateView(rect);
+        }
+    });
 }
 
 mu::engraving::Score* NotationPainting::score() const
@@ -112,13 +136,18 @@ bool NotationPainting::isPaintPageBorder() const
     return false;
 }
 
-void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
+void NotationPainting::doPaint(draw::Painter* painter, const Options& opt, bool useDisplayLists)
 {
     TRACEFUNC;
     if (!score()) {
         return;
     }
 
+    //! NOTE Printing and export need all pages, don't wait for the background layout
+    if (opt.isPrinting && !score()->isLayoutComplete()) {
+        score()->continueLayout();
+    }
+
     const std::vector<mu::engraving::Page*>& pages = score()->pages();
     if (pages.empty()) {
         return;
@@ -202,8 +231,12 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
             // Draw page elements
             painter->setClipping(true);
             painter->setClipRect(pageRect);
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            engraving::Paint::paintElements(*painter, elements, opt.isPrinting);
+            if (useDisplayLists) {
+                paintPageElements(painter, page, drawRect.translated(-pagePos), opt.isPrinting);
+            } else {
+                std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
+                engraving::Paint::paintElements(*painter, elements, opt.isPrinting);
+            }
             painter->setClipping(false);
 
 #ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
@@ -224,10 +257,6 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
                 }
             }
         }
-
-        if (!opt.isPrinting) {
-            static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
-        }
     }
 }
 
@@ -286,7 +315,258 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
-    doPaint(painter, opt);
+    doPaint(painter, opt, true);
+}
+
+void NotationPainting::paintViewInteraction(Painter* painter)
+{
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+}
+
+void NotationPainting::invalidateView(const RectF& rect)
+{
+    if (!rect.isValid() || !score()) {
+        return;
+    }
+
+    for (const mu::engraving::Page* page : score()->pages()) {
+        auto it = m_pageDisplayLists.find(page);
+        if (it == m_pageDisplayLists.end() || !it->second.isRecorded) {
+            continue;
+        }
+
+        RectF pageRect = rect.translated(-page->pos()).intersected(page->bbox());
+        if (pageRect.isValid()) {
+            it->second.invalidRects.push_back(pageRect);
+        }
+    }
+}
+
+void NotationPainting::paintPageElements(Painter* painter, const mu::engraving::Page* page, const RectF& rect, bool isPrinting)
+{
+    TRACEFUNC;
+
+    mu::engraving::Page* mpage = const_cast<mu::engraving::Page*>(page);
+
+    //! NOTE Another provider gets all the draw calls (ex autobot), so the elements have to be drawn
+    if (Painter::extended) {
+        engraving::Paint::paintElements(*painter, mpage->items(rect), isPrinting);
+        return;
+    }
+
+    //! NOTE The elements are drawn depending on the scaling (ex raster images are resampled for the screen),
+    //! so the list is recorded for one scaling. While it changes (zooming), the elements are drawn directly,
+    //! and the list is recorded when the page is painted again with the same scaling
+    double scaling = painter->worldTransform().m11();
+    PageDisplayList& list = m_pageDisplayLists[page];
+
+    //! NOTE The elements of the systems drawn simplified are too small to be seen, they are skipped
+    std::vector<RectF> simplifiedRects;
+    if (!isPrinting) {
+        simplifiedRects = paintSimplifiedSystems(painter, page, rect, scaling);
+    }
+
+    auto isSimplified = [&simplifiedRects](const RectF& bbox) {
+        for (const RectF& simplifiedRect : simplifiedRects) {
+            if (simplifiedRect.contains(bbox.center())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (!RealIsEqual(list.scaling, scaling) || list.isPrinting != isPrinting) {
+        list = PageDisplayList();
+        list.scaling = scaling;
+        list.isPrinting = isPrinting;
+
+        std::vector<EngravingItem*> elements = mpage->items(rect);
+        if (!simplifiedRects.empty()) {
+            mu::remove_if(elements, [&isSimplified](const EngravingItem* element) {
+                return isSimplified(element->pageBoundingRect());
+            });
+        }
+
+        engraving::Paint::paintElements(*painter, elements, isPrinting);
+        return;
+    }
+
+    if (!list.isRecorded) {
+        recordPageElements(list, mpage->items(page->bbox()));
+        list.isRecorded = true;
+    } else {
+        updatePageDisplayList(list, page);
+    }
+
+    IPaintProvider* provider = painter->provider().get();
+
+    Transform transform;
+    transform.scale(1.0 / scaling, 1.0 / scaling);
+    transform = transform * provider->transform();
+
+    provider->save();
+    for (const DisplayItem& item : list.items) {
+        if (item.bbox.intersects(rect) && !isSimplified(item.bbox)) {
+            DrawDataPaint::paintObject(provider, item.object, transform);
+        }
+    }
+    provider->restore();
+
+#ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
+    if (!isPrinting) {
+        engraving::DebugPaint::paintElementsDebug(*painter, mpage->items(rect));
+    }
+#endif
+}
+
+std::vector<RectF> NotationPainting::paintSimplifiedSystems(Painter* painter, const mu::engraving::Page* page, const RectF& rect,
+                                                           double scaling) const
+{
+    std::vector<RectF> simplifiedRects;
+
+    //! NOTE Five lines in a band of this height cover about the half of it
+    Color color = engravingConfiguration()->scoreInversionEnabled()
+                  ? engravingConfiguration()->scoreInversionColor()
+                  : engravingConfiguration()->defaultColor();
+    color.setAlpha(128);
+
+    for (const mu::engraving::System* system : page->systems()) {
+        if (system->vbox() || system->staves().empty()) {
+            continue;
+        }
+
+        RectF systemRect = system->bbox().translated(system->pos());
+        if (!systemRect.intersects(rect)) {
+            continue;
+        }
+
+        bool isSmall = true;
+        for (const mu::engraving::SysStaff* staff : system->staves()) {
+            if (staff->show() && staff->bbox().height() * scaling >= SIMPLIFIED_STAFF_MAX_HEIGHT) {
+                isSmall = false;
+                break;
+            }
+        }
+
+        if (!isSmall) {
+            continue;
+        }
+
+        double left = systemRect.left() + system->leftMargin();
+        for (const mu::engraving::SysStaff* staff : system->staves()) {
+            if (!staff->show()) {
+                continue;
+            }
+
+            RectF staffRect = staff->bbox().translated(system->pos());
+            painter->fillRect(RectF(left, staffRect.top(), systemRect.right() - left, staffRect.height()), color);
+        }
+
+        simplifiedRects.push_back(systemRect);
+    }
+
+    return simplifiedRects;
+}
+
+void NotationPainting::recordPageElements(PageDisplayList& list, const std::vector<EngravingItem*>& elements)
+{
+    TRACEFUNC;
+
+    std::vector<EngravingItem*> sortedElements(elements.begin(), elements.end());
+    std::sort(sortedElements.begin(), sortedElements.end(), mu::engraving::elementLessThan);
+
+    std::vector<const EngravingItem*> recordedElements;
+    recordedElements.reserve(sortedElements.size());
+
+    {
+        Painter painter(m_recorder, "notationview_record");
+        painter.setAntialiasing(true);
+
+        Transform transform;
+        transform.scale(list.scaling, list.scaling);
+        painter.setWorldTransform(transform);
+
+        for (const EngravingItem* element : sortedElements) {
+            if (!element->isInteractionAvailable() || element->skipDraw()) {
+                continue;
+            }
+
+            painter.beginObject(element->typeName(), element->pagePos());
+            engraving::Paint::paintElement(painter, element);
+            painter.endObject();
+
+            recordedElements.push_back(element);
+        }
+    }
+
+    //! NOTE The objects are in the order of ending, the default object of the painter is the last
+    DrawData data = m_recorder->takeDrawData();
+    IF_ASSERT_FAILED(data.objects.size() == recordedElements.size() + 1) {
+        return;
+    }
+
+    for (size_t i = 0; i < recordedElements.size(); ++i) {
+        const EngravingItem* element = recordedElements.at(i);
+
+        DisplayItem item;
+        item.bbox = element->pageBoundingRect();
+        item.z = element->z();
+        item.selected = element->selected();
+        item.visible = element->visible();
+        item.track = element->track();
+        item.object = std::move(data.objects.at(i));
+
+        list.items.push_back(std::move(item));
+    }
+}
+
+void NotationPainting::updatePageDisplayList(PageDisplayList& list, const mu::engraving::Page* page)
+{
+    if (list.invalidRects.empty()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    auto isInvalid = [&list](const RectF& bbox) {
+        for (const RectF& rect : list.invalidRects) {
+            if (bbox.intersects(rect)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    mu::remove_if(list.items, [&isInvalid](const DisplayItem& item) {
+        return isInvalid(item.bbox);
+    });
+
+    //! NOTE The same check as for the removed items, so every changed element is recorded exactly once
+    std::set<EngravingItem*> changedElements;
+    for (const RectF& rect : list.invalidRects) {
+        for (EngravingItem* element : const_cast<mu::engraving::Page*>(page)->items(rect)) {
+            if (isInvalid(element->pageBoundingRect())) {
+                changedElements.insert(element);
+            }
+        }
+    }
+
+    list.invalidRects.clear();
+    recordPageElements(list, std::vector<EngravingItem*>(changedElements.begin(), changedElements.end()));
+
+    //! NOTE The same order as elementLessThan, by the states at the moment of recording
+    std::stable_sort(list.items.begin(), list.items.end(), [](const DisplayItem& i1, const DisplayItem& i2) {
+        if (i1.z != i2.z) {
+            return i1.z < i2.z;
+        }
+        if (i1.selected != i2.selected) {
+            return !i1.selected;
+        }
+        if (i1.visible != i2.visible) {
+            return !i1.visible;
+        }
+        return i1.track < i2.track;
+    });
 }
 
 void NotationPainting::paintPdf(draw::Painter* painter, const Options& opt)
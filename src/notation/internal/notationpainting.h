@@ -25,7 +25,11 @@
 #include "../inotationpainting.h"
 #include "igetscore.h"
 
+#include <map>
+
 #include "modularity/ioc.h"
+#include "async/asyncable.h"
+#include "draw/bufferedpaintprovider.h"
 #include "../inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
 #include "ui/iuiconfiguration.h"
@@ -33,11 +37,12 @@
 namespace mu::engraving {
 class Score;
 class Page;
+class EngravingItem;
 }
 
 namespace mu::notation {
 class Notation;
-class NotationPainting : public INotationPainting
+class NotationPainting : public INotationPainting, public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, configuration)
     INJECT(notation, engraving::IEngravingConfiguration, engravingConfiguration)
@@ -53,6 +58,8 @@ public:
     SizeF pageSizeInch() const override;
 
     void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void paintViewInteraction(draw::Painter* painter) override;
+    void invalidateView(const RectF& rect) override;
     void paintPdf(draw::Painter* painter, const Options& opt) override;
     void paintPrint(draw::Painter* painter, const Options& opt) override;
     void paintPng(draw::Painter* painter, const Options& opt) override;
@@ -61,12 +68,39 @@ private:
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
-    void doPaint(draw::Painter* painter, const Options& opt);
+    void doPaint(draw::Painter* painter, const Options& opt, bool useDisplayLists = false);
     void paintPageBorder(draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(mu::draw::Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd,
                         bool printPageBackground) const;
 
+    //! NOTE The elements of a page recorded for the view, replayed instead of drawing the elements again
+    struct DisplayItem {
+        RectF bbox;
+        int z = 0;
+        bool selected = false;
+        bool visible = true;
+        engraving::track_idx_t track = 0;
+        draw::DrawData::Object object;
+    };
+
+    struct PageDisplayList {
+        std::vector<DisplayItem> items;
+        std::vector<RectF> invalidRects;
+        double scaling = 0.0;
+        bool isPrinting = false;
+        bool isRecorded = false;
+    };
+
+    void paintPageElements(draw::Painter* painter, const mu::engraving::Page* page, const RectF& rect, bool isPrinting);
+    std::vector<RectF> paintSimplifiedSystems(draw::Painter* painter, const mu::engraving::Page* page, const RectF& rect,
+                                              double scaling) const;
+    void recordPageElements(PageDisplayList& list, const std::vector<mu::engraving::EngravingItem*>& elements);
+    void updatePageDisplayList(PageDisplayList& list, const mu::engraving::Page* page);
+
     Notation* m_notation = nullptr;
+
+    std::map<const mu::engraving::Page*, PageDisplayList> m_pageDisplayLists;
+    std::shared_ptr<draw::BufferedPaintProvider> m_recorder;
 };
 }
 
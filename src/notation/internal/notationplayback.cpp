@@ -75,7 +75,7 @@ void NotationPlayback::init(INotationUndoStackPtr undoStack)
     m_playbackModel.setPlayRepeats(configuration()->isPlayRepeatsEnabled());
     m_playbackModel.setPlayChordSymbols(configuration()->isPlayChordSymbolsEnabled());
 
-    m_playbackModel.load(score());
+    m_playbackModel.load(score(), true /*progressively*/);
 
     updateTotalPlayTime();
     m_playbackModel.dataChanged().onNotify(this, [this]() {
@@ -130,6 +130,10 @@ const mpe::PlaybackData& NotationPlayback::trackPlaybackData(const engraving::In
 void NotationPlayback::triggerEventsForItems(const std::vector<const EngravingItem*>& items)
 {
     m_playbackModel.triggerEventsForItems(items);
+
+    if (auto latency = inputLatencyRegister()) {
+        latency->markStage("playback preview");
+    }
 }
 
 void NotationPlayback::triggerMetronome(int tick)
@@ -32,6 +32,7 @@
 #include "igetscore.h"
 #include "inotationundostack.h"
 #include "inotationconfiguration.h"
+#include "diagnostics/iinputlatencyregister.h"
 
 namespace mu::engraving {
 class Score;
@@ -41,6 +42,7 @@ namespace mu::notation {
 class NotationPlayback : public INotationPlayback, public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, configuration)
+    INJECT(notation, diagnostics::IInputLatencyRegister, inputLatencyRegister)
 
 public:
     NotationPlayback(IGetScore* getScore, async::Notification notationChanged);
@@ -129,11 +129,82 @@ void NotationUndoStack::commitChanges()
     }
 
     score()->endCmd();
+
+    if (auto latency = inputLatencyRegister()) {
+        latency->markStage("command and layout");
+    }
+
+    if (isBatchActive()) {
+        return;
+    }
+
+    masterScore()->setSaved(isStackClean());
+
+    notifyAboutStateChanged();
+}
+
+void NotationUndoStack::beginBatch()
+{
+    IF_ASSERT_FAILED(score()) {
+        return;
+    }
+
+    if (isLocked()) {
+        return;
+    }
+
+    score()->startBatch();
+}
+
+void NotationUndoStack::rollbackBatch()
+{
+    IF_ASSERT_FAILED(score()) {
+        return;
+    }
+
+    if (isLocked()) {
+        return;
+    }
+
+    score()->endBatch(true);
+
+    if (isBatchActive()) {
+        return;
+    }
+
     masterScore()->setSaved(isStackClean());
 
+    notifyAboutNotationChanged();
     notifyAboutStateChanged();
 }
 
+void NotationUndoStack::commitBatch()
+{
+    IF_ASSERT_FAILED(score()) {
+        return;
+    }
+
+    if (isLocked()) {
+        return;
+    }
+
+    score()->endBatch();
+
+    if (isBatchActive()) {
+        return;
+    }
+
+    masterScore()->setSaved(isStackClean());
+
+    notifyAboutNotationChanged();
+    notifyAboutStateChanged();
+}
+
+bool NotationUndoStack::isBatchActive() const
+{
+    return score() && score()->isBatchActive();
+}
+
 void NotationUndoStack::lock()
 {
     IF_ASSERT_FAILED(undoStack()) {
@@ -23,6 +23,9 @@
 #ifndef MU_NOTATION_UNDOSTACK
 #define MU_NOTATION_UNDOSTACK
 
+#include "modularity/ioc.h"
+#include "diagnostics/iinputlatencyregister.h"
+
 #include "inotationundostack.h"
 #include "igetscore.h"
 
@@ -36,6 +39,8 @@ class EditData;
 namespace mu::notation {
 class NotationUndoStack : public INotationUndoStack
 {
+    INJECT(notation, diagnostics::IInputLatencyRegister, inputLatencyRegister)
+
 public:
     NotationUndoStack(IGetScore* getScore, async::Notification notationChanged);
 
@@ -51,6 +56,11 @@ public:
     void rollbackChanges() override;
     void commitChanges() override;
 
+    void beginBatch() override;
+    void rollbackBatch() override;
+    void commitBatch() override;
+    bool isBatchActive() const override;
+
     void lock() override;
     void unlock() override;
     bool isLocked() const override;
@@ -30,51 +30,48 @@
 
 #include "engraving/types/types.h"
 
+#include "io/buffer.h"
+#include "serialization/xmlstreamwriter.h"
+
 #include "log.h"
-#include "global/deprecated/xmlwriter.h"
 
 using namespace mu::project;
 using namespace mu::notation;
 using namespace mu::engraving;
 using namespace mu::io;
-using namespace mu::framework;
 
-constexpr std::string_view SCORE_TAG("score");
-constexpr std::string_view ELEMENTS_TAG("elements");
-constexpr std::string_view ELEMENT_TAG("element");
-constexpr std::string_view EVENTS_TAG("events");
-constexpr std::string_view EVENT_TAG("event");
+static constexpr mu::AsciiStringView SCORE_TAG("score");
+static constexpr mu::AsciiStringView ELEMENTS_TAG("elements");
+static constexpr mu::AsciiStringView ELEMENT_TAG("element");
+static constexpr mu::AsciiStringView EVENTS_TAG("events");
+static constexpr mu::AsciiStringView EVENT_TAG("event");
 
-static void writeElementPosition(mu::framework::XmlWriter& writer, const std::string& id, const mu::PointF& pos, const mu::PointF& sPos,
+static void writeElementPosition(mu::XmlStreamWriter& writer, int id, const mu::PointF& pos, const mu::PointF& sPos,
                                  page_idx_t pageIndex)
 {
-    writer.writeStartElement(ELEMENT_TAG);
-    writer.writeAttribute("id", id);
-    writer.writeAttribute("x", std::to_string(pos.x()));
-    writer.writeAttribute("y", std::to_string(pos.y()));
-    writer.writeAttribute("sx", std::to_string(sPos.x()));
-    writer.writeAttribute("sy", std::to_string(sPos.y()));
-    writer.writeAttribute("page", std::to_string(pageIndex));
-    writer.writeEndElement();
+    const std::string x = std::to_string(pos.x());
+    const std::string y = std::to_string(pos.y());
+    const std::string sx = std::to_string(sPos.x());
+    const std::string sy = std::to_string(sPos.y());
+
+    writer.element(ELEMENT_TAG, { { "id", id }, { "x", mu::AsciiStringView(x) }, { "y", mu::AsciiStringView(y) },
+                       { "sx", mu::AsciiStringView(sx) }, { "sy", mu::AsciiStringView(sy) }, { "page", pageIndex } });
 }
 
-static void writeEventPosition(mu::framework::XmlWriter& writer, const std::string& id, int time)
+static void writeEventPosition(mu::XmlStreamWriter& writer, int id, int time)
 {
-    writer.writeStartElement(EVENT_TAG);
-    writer.writeAttribute("elid", id);
-    writer.writeAttribute("position", std::to_string(time));
-    writer.writeEndElement();
+    writer.element(EVENT_TAG, { { "elid", id }, { "position", time } });
 }
 
-static void writeMeasureEvents(mu::framework::XmlWriter& writer, Measure* m, int offset, const QHash<void*, int>& segments)
+static void writeMeasureEvents(mu::XmlStreamWriter& writer, Measure* m, int offset, const std::unordered_map<const void*, int>& segments)
 {
     for (mu::engraving::Segment* s = m->first(mu::engraving::SegmentType::ChordRest); s;
          s = s->next(mu::engraving::SegmentType::ChordRest)) {
         int tick = s->tick().ticks() + offset;
-        int id = segments[(void*)s];
+        auto id = segments.find(s);
         int time = lrint(m->score()->repeatList().utick2utime(tick) * 1000);
 
-        writeEventPosition(writer, std::to_string(id), time);
+        writeEventPosition(writer, id != segments.end() ? id->second : 0, time);
     }
 }
 
@@ -106,16 +103,28 @@ mu::Ret PositionsWriter::write(INotationPtr notation, QIODevice& destinationDevi
         return make_ret(Ret::Code::UnknownError);
     }
 
-    mu::framework::XmlWriter writer(&destinationDevice);
+    mu::ByteArray data;
+    Buffer buf(&data);
+    buf.open(IODevice::WriteOnly);
 
-    writer.writeStartDocument();
-    writer.writeStartElement(SCORE_TAG);
+    {
+        mu::XmlStreamWriter writer(&buf);
 
-    writeElementsPositions(writer, score);
-    writeEventsPositions(writer, score);
+        writer.startDocument();
+        writer.startElement(SCORE_TAG);
 
-    writer.writeEndElement();
-    writer.writeEndDocument();
+        //! NOTE The ids are collected while the positions are written, the events refer to them
+        std::unordered_map<const void*, int> elementIds;
+        writeElementsPositions(writer, score, elementIds);
+        writeEventsPositions(writer, score, elementIds);
+
+        writer.endElement();
+        writer.flush();
+    }
+
+    if (destinationDevice.write(data.toQByteArrayNoCopy()) != static_cast<qint64>(data.size())) {
+        return make_ret(Ret::Code::UnknownError);
+    }
 
     return true;
 }
@@ -131,52 +140,34 @@ qreal PositionsWriter::pngDpiResolution() const
     return (imagesExportConfiguration()->exportPngDpiResolution() / mu::engraving::DPI) * 12.0;
 }
 
-QHash<void*, int> PositionsWriter::elementIds(const mu::engraving::Score* score) const
+void PositionsWriter::writeElementsPositions(mu::XmlStreamWriter& writer, const mu::engraving::Score* score,
+                                             std::unordered_map<const void*, int>& elementIds) const
 {
-    QHash<void*, int> elementIds;
-
-    int id = 0;
-    if (m_elementType == ElementType::SEGMENT) {
-        Measure* m = score->firstMeasureMM();
-        for (mu::engraving::Segment* s = (m ? m->first(mu::engraving::SegmentType::ChordRest) : nullptr);
-             s; s = s->next1MM(mu::engraving::SegmentType::ChordRest)) {
-            elementIds[(void*)s] = id++;
-        }
-    } else {
-        for (Measure* m = score->firstMeasureMM(); m; m = m->nextMeasureMM()) {
-            elementIds[(void*)m] = id++;
-        }
-    }
-
-    return elementIds;
-}
-
-void PositionsWriter::writeElementsPositions(mu::framework::XmlWriter& writer, const mu::engraving::Score* score) const
-{
-    writer.writeStartElement(ELEMENTS_TAG);
+    writer.startElement(ELEMENTS_TAG);
 
     switch (m_elementType) {
     case ElementType::SEGMENT:
-        writeSegmentsPositions(writer, score);
+        writeSegmentsPositions(writer, score, elementIds);
         break;
     case ElementType::MEASURE:
-        writeMeasuresPositions(writer, score);
+        writeMeasuresPositions(writer, score, elementIds);
         break;
     }
 
-    writer.writeEndElement();
+    writer.endElement();
 }
 
-void PositionsWriter::writeSegmentsPositions(mu::framework::XmlWriter& writer, const mu::engraving::Score* score) const
+void PositionsWriter::writeSegmentsPositions(mu::XmlStreamWriter& writer, const mu::engraving::Score* score,
+                                             std::unordered_map<const void*, int>& elementIds) const
 {
     int id = 0;
     qreal ndpi = pngDpiResolution();
+    size_t tracks = score->nstaves() * mu::engraving::VOICES;
 
     Measure* measure = score->firstMeasureMM();
     for (mu::engraving::Segment* segment = (measure ? measure->first(mu::engraving::SegmentType::ChordRest) : nullptr);
          segment; segment = segment->next1MM(mu::engraving::SegmentType::ChordRest)) {
         qreal sx = 0;
-        size_t tracks = score->nstaves() * mu::engraving::VOICES;
         for (size_t track = 0; track < tracks; track++) {
             EngravingItem* e = segment->element(static_cast<int>(track));
             if (e) {
@@ -193,13 +184,15 @@ void PositionsWriter::writeSegmentsPositions(mu::framework::XmlWriter& writer, c
         Page* page = segment->measure()->system()->page();
         page_idx_t pageIndex = score->pageIdx(page);
 
-        writeElementPosition(writer, std::to_string(id), PointF(x, y), PointF(sx, sy), pageIndex);
+        writeElementPosition(writer, id, PointF(x, y), PointF(sx, sy), pageIndex);
 
+        elementIds.emplace(segment, id);
         id++;
     }
 }
 
-void PositionsWriter::writeMeasuresPositions(mu::framework::XmlWriter& writer, const mu::engraving::Score* score) const
+void PositionsWriter::writeMeasuresPositions(mu::XmlStreamWriter& writer, const mu::engraving::Score* score,
+                                             std::unordered_map<const void*, int>& elementIds) const
 {
     int id = 0;
     qreal ndpi = pngDpiResolution();
@@ -213,17 +206,17 @@ void PositionsWriter::writeMeasuresPositions(mu::framework::XmlWriter& writer, c
         Page* page = measure->system()->page();
         page_idx_t pageIndex = score->pageIdx(page);
 
-        writeElementPosition(writer, std::to_string(id), PointF(x, y), PointF(sx, sy), pageIndex);
+        writeElementPosition(writer, id, PointF(x, y), PointF(sx, sy), pageIndex);
 
+        elementIds.emplace(measure, id);
         id++;
     }
 }
 
-void PositionsWriter::writeEventsPositions(mu::framework::XmlWriter& writer, const mu::engraving::Score* score) const
+void PositionsWriter::writeEventsPositions(mu::XmlStreamWriter& writer, const mu::engraving::Score* score,
+                                           const std::unordered_map<const void*, int>& elementIds) const
 {
-    QHash<void*, int> elementIds = this->elementIds(score);
-
-    writer.writeStartElement(EVENTS_TAG);
+    writer.startElement(EVENTS_TAG);
 
     score->masterScore()->setExpandRepeats(true);
 
@@ -236,10 +229,10 @@ void PositionsWriter::writeEventsPositions(mu::framework::XmlWriter& writer, con
                 writeMeasureEvents(writer, measure, tickOffset, elementIds);
             } else {
                 int tick = measure->tick().ticks() + tickOffset;
-                int id = elementIds[(void*)measure];
+                auto id = elementIds.find(measure);
                 int time = std::lrint(measure->score()->repeatList().utick2utime(tick) * 1000);
 
-                writeEventPosition(writer, std::to_string(id), time);
+                writeEventPosition(writer, id != elementIds.end() ? id->second : 0, time);
             }
 
             if (measure->endTick().ticks() >= endTick) {
@@ -248,5 +241,5 @@ void PositionsWriter::writeEventsPositions(mu::framework::XmlWriter& writer, con
         }
     }
 
-    writer.writeEndElement();
+    writer.endElement();
 }
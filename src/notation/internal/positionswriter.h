@@ -23,12 +23,14 @@
 #ifndef MU_NOTATION_POSITIONSWRITER_H
 #define MU_NOTATION_POSITIONSWRITER_H
 
+#include <unordered_map>
+
 #include "modularity/ioc.h"
 #include "importexport/imagesexport/iimagesexportconfiguration.h"
 #include "project/inotationwriter.h"
 
-namespace mu::framework {
-class XmlWriter;
+namespace mu {
+class XmlStreamWriter;
 }
 
 namespace mu::engraving {
@@ -57,13 +59,16 @@ public:
 
 private:
     qreal pngDpiResolution() const;
-    QHash<void*, int> elementIds(const mu::engraving::Score* score) const;
 
-    void writeElementsPositions(framework::XmlWriter& writer, const mu::engraving::Score* score) const;
-    void writeSegmentsPositions(framework::XmlWriter& writer, const mu::engraving::Score* score) const;
-    void writeMeasuresPositions(framework::XmlWriter& writer, const mu::engraving::Score* score) const;
+    void writeElementsPositions(XmlStreamWriter& writer, const mu::engraving::Score* score,
+                                std::unordered_map<const void*, int>& elementIds) const;
+    void writeSegmentsPositions(XmlStreamWriter& writer, const mu::engraving::Score* score,
+                                std::unordered_map<const void*, int>& elementIds) const;
+    void writeMeasuresPositions(XmlStreamWriter& writer, const mu::engraving::Score* score,
+                                std::unordered_map<const void*, int>& elementIds) const;
 
-    void writeEventsPositions(framework::XmlWriter& writer, const mu::engraving::Score* score) const;
+    void writeEventsPositions(XmlStreamWriter& writer, const mu::engraving::Score* score,
+                              const std::unordered_map<const void*, int>& elementIds) const;
 
     ElementType m_elementType = ElementType::SEGMENT;
 };
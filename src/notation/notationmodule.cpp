@@ -236,3 +236,8 @@ void NotationModule::onInit(const framework::IApplication::RunMode& mode)
         }
     }
 }
+
+void NotationModule::onInitConcurrent(const framework::IApplication::RunMode&)
+{
+    s_instrumentsRepository->loadTemplates();
+}
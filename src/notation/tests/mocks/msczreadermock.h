@@ -31,6 +31,7 @@ class MsczReaderMock : public project::IMscMetaReader
 {
 public:
     MOCK_METHOD(RetVal<project::ProjectMeta>, readMeta, (const io::path_t& filePath), (const, override));
+    MOCK_METHOD(std::vector<RetVal<project::ProjectMeta> >, readMetaList, (const io::paths_t& filePaths), (const, override));
 };
 }
 
@@ -66,6 +66,7 @@ AbstractNotationPaintView::AbstractNotationPaintView(QQuickItem* parent)
 
     //! NOTE For diagnostic tools
     dispatcher()->reg(this, "diagnostic-notationview-redraw", [this]() {
+        invalidateTiles();
         update();
     });
 
@@ -92,6 +93,7 @@ void AbstractNotationPaintView::load()
     onNotationSetup();
 
     initBackground();
+    initRenderTarget();
     initNavigatorOrientation();
 
     configuration()->isLimitCanvasScrollAreaChanged().onNotify(this, [this]() {
@@ -113,6 +115,22 @@ void AbstractNotationPaintView::initBackground()
     });
 }
 
+//! NOTE The pages are rendered to the cached tiles on the CPU anyway (see NotationTileCache).
+//! With the framebuffer target, the tiles are kept as textures and composited on the GPU
+//! together with the overlays, instead of rasterizing the whole view and uploading it on every update
+void AbstractNotationPaintView::initRenderTarget()
+{
+    auto updateRenderTarget = [this]() {
+        bool accelerated = configuration()->isCanvasHardwareAccelerated();
+        setRenderTarget(accelerated ? QQuickPaintedItem::FramebufferObject : QQuickPaintedItem::Image);
+        update();
+    };
+
+    updateRenderTarget();
+
+    configuration()->isCanvasHardwareAcceleratedChanged().onNotify(this, updateRenderTarget);
+}
+
 void AbstractNotationPaintView::initNavigatorOrientation()
 {
     configuration()->canvasOrientation().ch.onReceive(this, [this](framework::Orientation) {
@@ -232,6 +250,8 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
 
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
         interaction->hideShadowNote();
+        m_playbackCursor->invalidate();
+        invalidateChangedTiles();
         update();
     });
 
@@ -241,9 +261,20 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->selectionChanged().onNotify(this, [this]() {
+        invalidateSelectionTiles();
         update();
     });
 
+    interaction->dragChanged().onNotify(this, [this]() {
+        if (!isPrinting()) {
+            invalidateTiles();
+        }
+    });
+
+    interaction->textEditingChanged().onNotify(this, [this]() {
+        invalidateSelectionTiles();
+    });
+
     interaction->showItemRequested().onReceive(this, [this](const INotationInteraction::ShowItemRequest& request) {
         onShowItemRequested(request);
     });
@@ -302,6 +333,10 @@ void AbstractNotationPaintView::onUnloadNotation(INotationPtr)
     INotationInteractionPtr interaction = m_notation->interaction();
     interaction->noteInput()->stateChanged().resetOnNotify(this);
     interaction->selectionChanged().resetOnNotify(this);
+    interaction->dragChanged().resetOnNotify(this);
+    interaction->textEditingChanged().resetOnNotify(this);
+
+    m_tileCache.clear();
 
     if (isMainView()) {
         m_notation->accessibility()->setMapToScreenFunc(nullptr);
@@ -508,10 +543,24 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
+    Transform matrix = m_matrix * guiScalingCompensation;
 
-    bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    bool isPrinting = this->isPrinting();
+    if (isPrinting != m_tilesPrinting) {
+        m_tileCache.clear();
+        m_tilesPrinting = isPrinting;
+    }
+
+    INotationPaintingPtr painting = notation()->painting();
+    m_tileCache.paint(qp, matrix, rect, [painting, isPrinting](draw::Painter* tilePainter, const RectF& logicRect) {
+        painting->paintView(tilePainter, logicRect, isPrinting);
+    });
+
+    painter->setWorldTransform(matrix);
+
+    if (!isPrinting) {
+        painting->paintViewInteraction(painter);
+    }
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -526,6 +575,12 @@ void AbstractNotationPaintView::paint(QPainter* qp)
         ctx.fromLogical = [this](const PointF& pos) -> PointF { return fromLogical(pos); };
         m_continuousPanel->paint(*painter, ctx);
     }
+
+    if (isMainView()) {
+        if (auto latency = inputLatencyRegister()) {
+            latency->endInput();
+        }
+    }
 }
 
 void AbstractNotationPaintView::onNotationSetup()
@@ -547,14 +602,17 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        invalidateTiles();
         update();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        invalidateTiles();
         update();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        invalidateTiles();
         update();
     });
 }
@@ -572,6 +630,73 @@ void AbstractNotationPaintView::paintBackground(const RectF& rect, draw::Painter
     }
 }
 
+void AbstractNotationPaintView::invalidateTiles()
+{
+    m_tileCache.clear();
+    m_selectionRect = selectionBoundingRect();
+}
+
+//! NOTE Only the tiles over the area changed by the layout are rendered again,
+//! all of them if the notation doesn't know that area
+void AbstractNotationPaintView::invalidateChangedTiles()
+{
+    const std::vector<RectF>& changedArea = m_notation->changedArea();
+    if (changedArea.empty()) {
+        invalidateTiles();
+        return;
+    }
+
+    for (const RectF& rect : changedArea) {
+        m_tileCache.invalidate(rect);
+    }
+
+    m_selectionRect = selectionBoundingRect();
+}
+
+bool AbstractNotationPaintView::isPrinting() const
+{
+    return publishMode() || m_inputController->readonly();
+}
+
+//! NOTE Selecting only changes the colors of the selected elements,
+//! so only the tiles under the previous and the new selection are rendered again.
+//! The printed views (e.g. the navigator) don't show the selection, so nothing is rendered again for them
+void AbstractNotationPaintView::invalidateSelectionTiles()
+{
+    if (isPrinting()) {
+        return;
+    }
+
+    INotationPaintingPtr painting = notation() ? notation()->painting() : nullptr;
+
+    m_tileCache.invalidate(m_selectionRect);
+    if (painting) {
+        painting->invalidateView(m_selectionRect);
+    }
+
+    m_selectionRect = selectionBoundingRect();
+
+    m_tileCache.invalidate(m_selectionRect);
+    if (painting) {
+        painting->invalidateView(m_selectionRect);
+    }
+}
+
+RectF AbstractNotationPaintView::selectionBoundingRect() const
+{
+    INotationSelectionPtr selection = notationSelection();
+    if (!selection || selection->isNone()) {
+        return RectF();
+    }
+
+    RectF rect;
+    for (const EngravingItem* element : selection->elements()) {
+        rect.unite(element->canvasBoundingRect());
+    }
+
+    return rect;
+}
+
 PointF AbstractNotationPaintView::canvasCenter() const
 {
     TRACEFUNC;
@@ -640,10 +765,25 @@ RectF AbstractNotationPaintView::notationContentRect() const
     }
 
     RectF result;
-    for (const Page* page: notationElements()->pages()) {
+    PageList pages = notationElements()->pages();
+    for (const Page* page: pages) {
         result.unite(page->bbox().translated(page->pos()));
     }
 
+    //! NOTE While the score is still being laid out in background,
+    //! reserve room for the estimated remaining pages to keep the scrollbars stable
+    const mu::engraving::Score* score = notationElements()->msScore();
+    size_t estimatedPageCount = score ? score->estimatedPageCount() : 0;
+    if (!pages.empty() && estimatedPageCount > pages.size()) {
+        const Page* lastPage = pages.back();
+        PointF step = pages.size() > 1
+                      ? lastPage->pos() - pages[pages.size() - 2]->pos()
+                      : PointF(lastPage->width(), 0.0);
+
+        double remaining = static_cast<double>(estimatedPageCount - pages.size());
+        result.unite(lastPage->bbox().translated(lastPage->pos() + step * remaining));
+    }
+
     return result;
 }
 
@@ -1123,6 +1263,7 @@ void AbstractNotationPaintView::setReadonly(bool readonly)
 
 void AbstractNotationPaintView::clear()
 {
+    m_tileCache.clear();
     m_matrix = Transform();
     m_previousHorizontalScrollPosition = 0;
     m_previousVerticalScrollPosition = 0;
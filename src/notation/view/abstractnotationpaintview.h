@@ -37,6 +37,7 @@
 #include "ui/iuicontextresolver.h"
 #include "ui/imainwindow.h"
 #include "ui/iuiactionsregister.h"
+#include "diagnostics/iinputlatencyregister.h"
 #include "uicomponents/view/abstractmenumodel.h"
 #include "uicomponents/view/quickpaintedview.h"
 
@@ -45,6 +46,7 @@
 #include "playbackcursor.h"
 #include "loopmarker.h"
 #include "continuouspanel.h"
+#include "notationtilecache.h"
 
 namespace mu::notation {
 class AbstractNotationPaintView : public uicomponents::QuickPaintedView, public IControlledView, public async::Asyncable,
@@ -61,6 +63,7 @@ class AbstractNotationPaintView : public uicomponents::QuickPaintedView, public
     INJECT(notation, ui::IUiContextResolver, uiContextResolver)
     INJECT(notation, ui::IMainWindow, mainWindow)
     INJECT(notation, ui::IUiActionsRegister, actionsRegister)
+    INJECT(notation, diagnostics::IInputLatencyRegister, inputLatencyRegister)
 
     Q_PROPERTY(qreal startHorizontalScrollPosition READ startHorizontalScrollPosition NOTIFY horizontalScrollChanged)
     Q_PROPERTY(qreal horizontalScrollbarSize READ horizontalScrollbarSize NOTIFY horizontalScrollChanged)
@@ -182,6 +185,7 @@ private:
 
     void clear();
     void initBackground();
+    void initRenderTarget();
     void initNavigatorOrientation();
 
     bool canReceiveAction(const actions::ActionCode& actionCode) const override;
@@ -231,6 +235,13 @@ private:
 
     void paintBackground(const RectF& rect, draw::Painter* painter);
 
+    bool isPrinting() const;
+
+    void invalidateTiles();
+    void invalidateChangedTiles();
+    void invalidateSelectionTiles();
+    RectF selectionBoundingRect() const;
+
     PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
 
@@ -244,6 +255,10 @@ private:
     std::unique_ptr<LoopMarker> m_loopOutMarker;
     std::unique_ptr<ContinuousPanel> m_continuousPanel;
 
+    NotationTileCache m_tileCache;
+    bool m_tilesPrinting = false;
+    RectF m_selectionRect;
+
     qreal m_previousVerticalScrollPosition = 0;
     qreal m_previousHorizontalScrollPosition = 0;
 
@@ -0,0 +1,171 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <cmath>
+
+#include <QPainter>
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::draw;
+
+static constexpr int TILE_SIZE = 256;
+
+//! NOTE Tiles around the visible ones are kept, so small scrolling back and forth doesn't rerender
+static constexpr int KEPT_TILES_MARGIN = 1;
+
+//! NOTE Antialiasing may touch pixels just outside of the bounding box of an element
+static constexpr qreal INVALIDATE_MARGIN_PX = 2.0;
+
+static int tileIndexAt(qreal px)
+{
+    return static_cast<int>(std::floor(px / TILE_SIZE));
+}
+
+void NotationTileCache::clear()
+{
+    m_tiles.clear();
+}
+
+void NotationTileCache::invalidate(const RectF& logicRect)
+{
+    if (m_tiles.empty() || !logicRect.isValid()) {
+        return;
+    }
+
+    qreal margin = INVALIDATE_MARGIN_PX / m_scaling;
+    RectF rect = logicRect.adjusted(-margin, -margin, margin, margin);
+
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        if (tileRect(it->first).intersects(rect)) {
+            it = m_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+RectF NotationTileCache::tileRect(const TileIndex& index) const
+{
+    qreal size = TILE_SIZE / m_scaling;
+    return RectF(index.first * size, index.second * size, size, size);
+}
+
+void NotationTileCache::paint(QPainter* painter, const Transform& matrix, const RectF& viewRect, const PaintFunc& paintContent)
+{
+    TRACEFUNC;
+
+    qreal scaling = matrix.m11();
+    if (scaling <= 0.0) {
+        return;
+    }
+
+    if (!qFuzzyCompare(scaling, m_scaling)) {
+        clear();
+        m_scaling = scaling;
+    }
+
+    //! NOTE The tiles are aligned to the logical origin, so they stay valid while scrolling.
+    //! The origin is rounded to whole pixels, so the tiles are drawn without resampling
+    PointF origin = matrix.map(PointF(0.0, 0.0));
+    qreal originX = std::round(origin.x());
+    qreal originY = std::round(origin.y());
+
+    TileIndex topLeft(tileIndexAt(viewRect.left() - originX), tileIndexAt(viewRect.top() - originY));
+    TileIndex bottomRight(tileIndexAt(viewRect.right() - originX - 1.0), tileIndexAt(viewRect.bottom() - originY - 1.0));
+
+    TileIndex missingTopLeft(bottomRight.first + 1, bottomRight.second + 1);
+    TileIndex missingBottomRight(topLeft.first - 1, topLeft.second - 1);
+
+    for (int row = topLeft.second; row <= bottomRight.second; ++row) {
+        for (int col = topLeft.first; col <= bottomRight.first; ++col) {
+            if (m_tiles.find({ col, row }) != m_tiles.end()) {
+                continue;
+            }
+
+            missingTopLeft = { std::min(missingTopLeft.first, col), std::min(missingTopLeft.second, row) };
+            missingBottomRight = { std::max(missingBottomRight.first, col), std::max(missingBottomRight.second, row) };
+        }
+    }
+
+    if (missingTopLeft.first <= missingBottomRight.first) {
+        renderTiles(missingTopLeft, missingBottomRight, paintContent);
+    }
+
+    for (int row = topLeft.second; row <= bottomRight.second; ++row) {
+        for (int col = topLeft.first; col <= bottomRight.first; ++col) {
+            painter->drawImage(QPointF(originX + col * TILE_SIZE, originY + row * TILE_SIZE), m_tiles.at({ col, row }));
+        }
+    }
+
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        const TileIndex& index = it->first;
+        bool kept = index.first >= topLeft.first - KEPT_TILES_MARGIN && index.first <= bottomRight.first + KEPT_TILES_MARGIN
+                    && index.second >= topLeft.second - KEPT_TILES_MARGIN && index.second <= bottomRight.second + KEPT_TILES_MARGIN;
+
+        if (kept) {
+            ++it;
+        } else {
+            it = m_tiles.erase(it);
+        }
+    }
+}
+
+void NotationTileCache::renderTiles(const TileIndex& topLeft, const TileIndex& bottomRight, const PaintFunc& paintContent)
+{
+    TRACEFUNC;
+
+    //! NOTE The missing tiles are rendered in one pass, then cut, so the elements
+    //! on the borders of the tiles are not looked up and painted once for every tile
+    int columns = bottomRight.first - topLeft.first + 1;
+    int rows = bottomRight.second - topLeft.second + 1;
+
+    QSize size(columns * TILE_SIZE, rows * TILE_SIZE);
+    if (m_renderBuffer.size() != size) {
+        m_renderBuffer = QImage(size, QImage::Format_ARGB32_Premultiplied);
+    }
+
+    m_renderBuffer.fill(Qt::transparent);
+
+    {
+        QPainter qp(&m_renderBuffer);
+        Painter painter(&qp, "notationtiles");
+
+        Transform transform;
+        transform.translate(-topLeft.first * TILE_SIZE, -topLeft.second * TILE_SIZE);
+        transform.scale(m_scaling, m_scaling);
+        painter.setWorldTransform(transform);
+
+        RectF rect = tileRect(topLeft).united(tileRect(bottomRight));
+        paintContent(&painter, rect);
+    }
+
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < columns; ++col) {
+            QRect sourceRect(col * TILE_SIZE, row * TILE_SIZE, TILE_SIZE, TILE_SIZE);
+            m_tiles[{ topLeft.first + col, topLeft.second + row }] = m_renderBuffer.copy(sourceRect);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <functional>
+#include <map>
+
+#include <QImage>
+
+#include "draw/painter.h"
+#include "draw/types/geometry.h"
+#include "draw/types/transform.h"
+
+class QPainter;
+
+namespace mu::notation {
+//! NOTE Keeps the rendered pages in tiles of a fixed size in pixels, at the current scaling.
+//! While scrolling only the cached tiles are composited, and a change only rerenders the tiles it intersects
+class NotationTileCache
+{
+public:
+    using PaintFunc = std::function<void (draw::Painter* painter, const RectF& logicRect)>;
+
+    NotationTileCache() = default;
+
+    void clear();
+    void invalidate(const RectF& logicRect);
+
+    //! NOTE matrix maps logical coordinates to the pixels of the painter, viewRect is in these pixels
+    void paint(QPainter* painter, const draw::Transform& matrix, const RectF& viewRect, const PaintFunc& paintContent);
+
+private:
+    using TileIndex = std::pair<int, int>; // column, row
+
+    RectF tileRect(const TileIndex& index) const;
+    void renderTiles(const TileIndex& topLeft, const TileIndex& bottomRight, const PaintFunc& paintContent);
+
+    std::map<TileIndex, QImage> m_tiles;
+    qreal m_scaling = 0.0;
+    QImage m_renderBuffer;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
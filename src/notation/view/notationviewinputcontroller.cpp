@@ -494,6 +494,8 @@ void NotationViewInputController::wheelEvent(QWheelEvent* event)
 
 void NotationViewInputController::mousePressEvent(QMouseEvent* event)
 {
+    flushPendingDrag();
+
     PointF logicPos = PointF(m_view->toLogical(event->pos()));
     Qt::KeyboardModifiers keyState = event->modifiers();
     Qt::MouseButton button = event->button();
@@ -703,14 +705,14 @@ void NotationViewInputController::mouseMoveEvent(QMouseEvent* event)
                 mode = DragMode::OnlyX;
             }
 
-            viewInteraction()->drag(m_beginPoint, logicPos, mode);
+            scheduleDrag(logicPos, mode);
 
             return;
         } else if (hitElement == nullptr && (keyState & Qt::ShiftModifier)) {
             if (!viewInteraction()->isDragStarted()) {
                 viewInteraction()->startDrag(std::vector<EngravingItem*>(), PointF(), [](const EngravingItem*) { return false; });
             }
-            viewInteraction()->drag(m_beginPoint, logicPos, DragMode::BothXY);
+            scheduleDrag(logicPos, DragMode::BothXY);
 
             return;
         }
@@ -723,6 +725,35 @@ void NotationViewInputController::mouseMoveEvent(QMouseEvent* event)
     }
 }
 
+void NotationViewInputController::scheduleDrag(const PointF& toPos, DragMode mode)
+{
+    m_pendingDrag = PendingDrag { toPos, mode };
+
+    if (m_isDragFlushScheduled) {
+        return;
+    }
+
+    //! NOTE Runs once the queued input events are handled, so only the last position of those is dragged to
+    m_isDragFlushScheduled = true;
+    QTimer::singleShot(0, m_view->asItem(), [this]() {
+        flushPendingDrag();
+    });
+}
+
+void NotationViewInputController::flushPendingDrag()
+{
+    m_isDragFlushScheduled = false;
+
+    if (!m_pendingDrag) {
+        return;
+    }
+
+    PendingDrag drag = *m_pendingDrag;
+    m_pendingDrag.reset();
+
+    viewInteraction()->drag(m_beginPoint, drag.toPos, drag.mode);
+}
+
 void NotationViewInputController::startDragElements(ElementType elementsType, const PointF& elementsOffset)
 {
     if (elementsType == ElementType::INVALID) {
@@ -744,6 +775,9 @@ void NotationViewInputController::startDragElements(ElementType elementsType, co
 
 void NotationViewInputController::mouseReleaseEvent(QMouseEvent* event)
 {
+    //! NOTE The drag must reach the release position before it ends
+    flushPendingDrag();
+
     INotationInteractionPtr interaction = viewInteraction();
     INotationNoteInputPtr noteInput = interaction->noteInput();
     const EngravingItem* hitElement = hitElementContext().element;
@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_NOTATIONVIEWINPUTCONTROLLER_H
 #define MU_NOTATION_NOTATIONVIEWINPUTCONTROLLER_H
 
+#include <optional>
+
 #include <QtEvents>
 
 #include "modularity/ioc.h"
@@ -152,6 +154,8 @@ private:
     void setViewMode(const ViewMode& viewMode);
 
     void startDragElements(ElementType elementsType, const PointF& elementsOffset);
+    void scheduleDrag(const PointF& toPos, DragMode mode);
+    void flushPendingDrag();
 
     float hitWidth() const;
 
@@ -180,6 +184,15 @@ private:
 
     PointF m_beginPoint;
 
+    //! NOTE The mouse moves that arrive while a drag step is being laid out are coalesced into one step
+    struct PendingDrag {
+        PointF toPos;
+        DragMode mode = DragMode::BothXY;
+    };
+
+    std::optional<PendingDrag> m_pendingDrag;
+    bool m_isDragFlushScheduled = false;
+
     mu::engraving::EngravingItem* m_prevHitElement = nullptr;
 };
 }
@@ -21,7 +21,6 @@
  */
 #include "pianokeyboardcontroller.h"
 
-#include "defer.h"
 #include "log.h"
 
 using namespace mu::notation;
@@ -121,22 +120,26 @@ void PianoKeyboardController::updateNotesKeys(const std::vector<const Note*>& re
     std::unordered_set<piano_key_t> newKeys;
     std::unordered_set<piano_key_t> newOtherNotesInChord;
 
-    DEFER {
-        if (newKeys != m_keys
-            || newOtherNotesInChord != m_otherNotesInChord) {
-            m_keys = newKeys;
-            m_otherNotesInChord = newOtherNotesInChord;
-        }
-
-        m_keyStatesChanged.notify();
-    };
-
     for (const mu::engraving::Note* note : receivedNotes) {
         newKeys.insert(static_cast<piano_key_t>(note->epitch()));
         for (const mu::engraving::Note* otherNote : note->chord()->notes()) {
             newOtherNotesInChord.insert(static_cast<piano_key_t>(otherNote->epitch()));
         }
     }
+
+    //! NOTE The view repaints the changed keys on every notification,
+    //! so don't notify when the selection moves between notes of the same keys
+    if (newKeys == m_keys
+        && newOtherNotesInChord == m_otherNotesInChord
+        && m_isFromMidi == m_notifiedIsFromMidi) {
+        return;
+    }
+
+    m_keys = std::move(newKeys);
+    m_otherNotesInChord = std::move(newOtherNotesInChord);
+    m_notifiedIsFromMidi = m_isFromMidi;
+
+    m_keyStatesChanged.notify();
 }
 
 void PianoKeyboardController::sendNoteOn(piano_key_t key)
@@ -61,6 +61,7 @@ private:
     std::unordered_set<piano_key_t> m_otherNotesInChord;
 
     bool m_isFromMidi = false;
+    bool m_notifiedIsFromMidi = false;
 
     async::Notification m_keyStatesChanged;
 };
@@ -72,10 +72,10 @@ PianoKeyboardView::PianoKeyboardView(QQuickItem* parent)
     });
 
     m_controller->init();
+    updateKeyStates();
 
     m_controller->keyStatesChanged().onNotify(this, [this]() {
-        updateKeyStateColors();
-        update();
+        onKeyStatesChanged();
     });
 
     setAcceptedMouseButtons(Qt::LeftButton);
@@ -156,12 +156,56 @@ void PianoKeyboardView::determineOctaveLabelsFont()
     m_octaveLabelsFont.setPixelSize(uiConfiguration()->fontSize() * std::min(m_keyWidthScaling, 1.5));
 }
 
+void PianoKeyboardView::onKeyStatesChanged()
+{
+    TRACEFUNC;
+
+    if (m_keyStateColorsFromMidi != m_controller->isFromMidi()) {
+        updateKeyStateColors();
+        updateKeyStates();
+        update();
+        return;
+    }
+
+    //! NOTE Only repaint the keys whose state has changed
+    QRectF dirtyRect;
+
+    for (piano_key_t key = 0; key < MAX_NUM_KEYS; ++key) {
+        KeyState state = m_controller->keyState(key);
+        if (m_keyStates[key] == state) {
+            continue;
+        }
+
+        m_keyStates[key] = state;
+
+        const std::map<piano_key_t, QRectF>& rects = isBlackKey(key) ? m_blackKeyRects : m_whiteKeyRects;
+        auto it = rects.find(key);
+        if (it != rects.cend()) {
+            dirtyRect |= it->second;
+        }
+    }
+
+    if (dirtyRect.isNull()) {
+        return;
+    }
+
+    update(dirtyRect.translated(m_keysAreaRect.topLeft()).toAlignedRect());
+}
+
+void PianoKeyboardView::updateKeyStates()
+{
+    for (piano_key_t key = 0; key < MAX_NUM_KEYS; ++key) {
+        m_keyStates[key] = m_controller->keyState(key);
+    }
+}
+
 void PianoKeyboardView::updateKeyStateColors()
 {
     auto themeValues = uiConfiguration()->currentTheme().values;
 
     QColor accentColor = themeValues[ui::ACCENT_COLOR].toString();
     bool isKeysFromMidiInput = m_controller->isFromMidi();
+    m_keyStateColorsFromMidi = isKeysFromMidiInput;
 
     m_whiteKeyStateColors[KeyState::None] = Qt::white;
     m_whiteKeyStateColors[KeyState::OtherInSelectedChord] = mixedColors(Qt::white, accentColor, 0.25);
@@ -193,6 +237,9 @@ void PianoKeyboardView::paint(QPainter* painter)
     painter->translate(pos);
 
     QRectF viewport = QRectF(0.0, 0.0, width(), height()).translated(-pos);
+    if (painter->hasClipping()) {
+        viewport &= painter->clipBoundingRect();
+    }
     paintWhiteKeys(painter, viewport);
     paintBlackKeys(painter, viewport);
 }
@@ -230,7 +277,7 @@ void PianoKeyboardView::paintWhiteKeys(QPainter* painter, const QRectF& viewport
 
         painter->translate(rect.topLeft());
 
-        QColor fillColor = m_whiteKeyStateColors[m_controller->keyState(key)];
+        QColor fillColor = m_whiteKeyStateColors[m_keyStates[key]];
 
         painter->fillPath(path, fillColor);
 
@@ -325,8 +372,9 @@ void PianoKeyboardView::paintBlackKeys(QPainter* painter, const QRectF& viewport
             bottomPieceGradient.setFinalStop(0.0, bottom);
         }
 
-        topPieceGradient.setColorAt(1.0, m_blackKeyTopPieceStateColors[m_controller->keyState(key)]);
-        bottomPieceGradient.setColorAt(0.0, m_blackKeyBottomPieceStateColors[m_controller->keyState(key)]);
+        KeyState state = m_keyStates[key];
+        topPieceGradient.setColorAt(1.0, m_blackKeyTopPieceStateColors[state]);
+        bottomPieceGradient.setColorAt(0.0, m_blackKeyBottomPieceStateColors[state]);
 
         painter->translate(rect.topLeft());
         painter->fillRect(backgroundRect, backgroundColor);
@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_PIANOKEYBOARDVIEW_H
 #define MU_NOTATION_PIANOKEYBOARDVIEW_H
 
+#include <array>
+
 #include "async/asyncable.h"
 
 #include "uicomponents/view/quickpaintedview.h"
@@ -75,6 +77,9 @@ private:
     void determineOctaveLabelsFont();
     void updateKeyStateColors();
 
+    void onKeyStatesChanged();
+    void updateKeyStates();
+
     void paintBackground(QPainter* painter);
 
     void paintWhiteKeys(QPainter* painter, const QRectF& viewport);
@@ -105,6 +110,9 @@ private:
 
     QFont m_octaveLabelsFont;
 
+    std::array<KeyState, MAX_NUM_KEYS> m_keyStates {};
+    bool m_keyStateColorsFromMidi = false;
+
     std::map<KeyState, QColor> m_whiteKeyStateColors;
     std::map<KeyState, QColor> m_blackKeyTopPieceStateColors;
     std::map<KeyState, QColor> m_blackKeyBottomPieceStateColors;
@@ -21,6 +21,9 @@
  */
 #include "playbackcursor.h"
 
+#include <algorithm>
+
+#include "engraving/libmscore/measure.h"
 #include "engraving/libmscore/system.h"
 
 using namespace mu::notation;
@@ -37,6 +40,7 @@ void PlaybackCursor::paint(mu::draw::Painter* painter)
 void PlaybackCursor::setNotation(INotationPtr notation)
 {
     m_notation = notation;
+    invalidate();
 }
 
 void PlaybackCursor::move(midi::tick_t tick)
@@ -44,36 +48,110 @@ void PlaybackCursor::move(midi::tick_t tick)
     m_rect = resolveCursorRectByTick(tick);
 }
 
-//! NOTE Copied from ScoreView::moveCursor(const Fraction& tick)
+void PlaybackCursor::invalidate()
+{
+    m_spans.clear();
+    m_spansValid = false;
+}
+
+//! NOTE The spans are built once per layout, so moving the cursor
+//! during the playback is only a binary search and an interpolation
 mu::RectF PlaybackCursor::resolveCursorRectByTick(midi::tick_t _tick) const
 {
     if (!m_notation) {
         return RectF();
     }
 
-    const mu::engraving::Score* score = m_notation->elements()->msScore();
+    if (!m_spansValid) {
+        buildSpans();
+    }
 
     Fraction tick = Fraction::fromTicks(_tick);
 
-    Measure* measure = score->tick2measureMM(tick);
-    if (!measure) {
+    auto it = std::upper_bound(m_spans.cbegin(), m_spans.cend(), tick, [](const Fraction& t, const CursorSpan& span) {
+        return t < span.tick1;
+    });
+
+    if (it == m_spans.cbegin()) {
         return RectF();
     }
 
-    mu::engraving::System* system = measure->system();
-    if (!system) {
+    const CursorSpan& span = *std::prev(it);
+    if (tick >= span.tick2) {
         return RectF();
     }
 
-    qreal x = 0.0;
-    mu::engraving::Segment* s = nullptr;
-    for (s = measure->first(mu::engraving::SegmentType::ChordRest); s;) {
+    const mu::engraving::Score* score = m_notation->elements()->msScore();
+    double _spatium = score->spatium();
+
+    Fraction dt = span.tick2 - span.tick1;
+    qreal dx = span.x2 - span.x1;
+    qreal x = span.x1 + dx * (tick - span.tick1).ticks() / dt.ticks();
+
+    double w = 8;
+    x -= _spatium;
+
+    return RectF(x, span.y, w, span.h);
+}
+
+void PlaybackCursor::buildSpans() const
+{
+    m_spans.clear();
+    m_spansValid = true;
+
+    const mu::engraving::Score* score = m_notation->elements()->msScore();
+    if (!score) {
+        return;
+    }
+
+    double _spatium = score->spatium();
+
+    const mu::engraving::System* lastSystem = nullptr;
+    double y = 0.0;
+    double h = 0.0;
+
+    for (const Measure* measure = score->firstMeasureMM(); measure; measure = measure->nextMeasureMM()) {
+        const mu::engraving::System* system = measure->system();
+        if (!system) {
+            continue;
+        }
+
+        if (system != lastSystem) {
+            lastSystem = system;
+
+            y = system->staffYpage(0) + system->page()->pos().y();
+            h = 6 * _spatium;
+            //
+            // set cursor height for whole system
+            //
+            double y2 = 0.0;
+
+            for (size_t i = 0; i < score->nstaves(); ++i) {
+                const mu::engraving::SysStaff* ss = system->staff(i);
+                if (!ss->show() || !score->staff(i)->show()) {
+                    continue;
+                }
+                y2 = ss->bbox().bottom();
+            }
+
+            h += y2;
+            y -= 3 * _spatium;
+        }
+
+        appendMeasureSpans(measure, y, h);
+    }
+}
+
+//! NOTE Copied from ScoreView::moveCursor(const Fraction& tick)
+void PlaybackCursor::appendMeasureSpans(const Measure* measure, double y, double h) const
+{
+    for (const mu::engraving::Segment* s = measure->first(mu::engraving::SegmentType::ChordRest); s;) {
         Fraction t1 = s->tick();
         int x1 = s->canvasPos().x();
         qreal x2 = 0.0;
         Fraction t2;
 
-        mu::engraving::Segment* ns = s->next(mu::engraving::SegmentType::ChordRest);
+        const mu::engraving::Segment* ns = s->next(mu::engraving::SegmentType::ChordRest);
         while (ns && !ns->visible()) {
             ns = ns->next(mu::engraving::SegmentType::ChordRest);
         }
@@ -84,7 +162,8 @@ mu::RectF PlaybackCursor::resolveCursorRectByTick(midi::tick_t _tick) const
         } else {
             t2 = measure->endTick();
             // measure->width is not good enough because of courtesy keysig, timesig
-            mu::engraving::Segment* seg = measure->findSegment(mu::engraving::SegmentType::EndBarLine, measure->tick() + measure->ticks());
+            const mu::engraving::Segment* seg = measure->findSegment(mu::engraving::SegmentType::EndBarLine,
+                                                                     measure->tick() + measure->ticks());
             if (seg) {
                 x2 = seg->canvasPos().x();
             } else {
@@ -92,42 +171,12 @@ mu::RectF PlaybackCursor::resolveCursorRectByTick(midi::tick_t _tick) const
             }
         }
 
-        if (tick >= t1 && tick < t2) {
-            Fraction dt = t2 - t1;
-            qreal dx = x2 - x1;
-            x = x1 + dx * (tick - t1).ticks() / dt.ticks();
-            break;
+        if (t1 < t2) {
+            m_spans.push_back({ t1, t2, double(x1), x2, y, h });
         }
-        s = ns;
-    }
 
-    if (!s) {
-        return RectF();
-    }
-
-    double y = system->staffYpage(0) + system->page()->pos().y();
-    double _spatium = score->spatium();
-
-    double w  = 8;
-    double h  = 6 * _spatium;
-    //
-    // set cursor height for whole system
-    //
-    double y2 = 0.0;
-
-    for (size_t i = 0; i < score->nstaves(); ++i) {
-        mu::engraving::SysStaff* ss = system->staff(i);
-        if (!ss->show() || !score->staff(i)->show()) {
-            continue;
-        }
-        y2 = ss->bbox().bottom();
+        s = ns;
     }
-
-    h += y2;
-    x -= _spatium;
-    y -= 3 * _spatium;
-
-    return RectF(x, y, w, h);
 }
 
 bool PlaybackCursor::visible() const
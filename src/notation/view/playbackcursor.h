@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_PLAYBACKCURSOR_H
 #define MU_NOTATION_PLAYBACKCURSOR_H
 
+#include <vector>
+
 #include "modularity/ioc.h"
 #include "notation/inotationconfiguration.h"
 #include "draw/types/geometry.h"
@@ -43,18 +45,37 @@ public:
     void setNotation(INotationPtr notation);
     void move(midi::tick_t tick);
 
+    //! NOTE Must be called whenever the layout of the notation changes
+    void invalidate();
+
     bool visible() const;
     void setVisible(bool arg);
 
     const RectF& rect() const;
 
 private:
+    //! NOTE The cursor moves linearly from x1 to x2 while the tick goes from tick1 to tick2
+    struct CursorSpan {
+        Fraction tick1;
+        Fraction tick2;
+        double x1 = 0.0;
+        double x2 = 0.0;
+        double y = 0.0;
+        double h = 0.0;
+    };
+
     QColor color() const;
     RectF resolveCursorRectByTick(midi::tick_t tick) const;
 
+    void buildSpans() const;
+    void appendMeasureSpans(const Measure* measure, double y, double h) const;
+
     bool m_visible = false;
     RectF m_rect;
 
+    mutable std::vector<CursorSpan> m_spans;
+    mutable bool m_spansValid = false;
+
     INotationPtr m_notation;
 };
 }
@@ -828,9 +828,13 @@ EditStyle::EditStyle(QWidget* parent)
             resetSignalMapper->setMapping(sw.reset, static_cast<int>(sw.idx));
         }
 
+        const StyleId idx = sw.idx;
+
         if (auto spinBox = qobject_cast<QSpinBox*>(sw.widget)) {
+            connect(spinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this, idx]() { schedulePreview(idx); });
             connect(spinBox, QOverload<>::of(&QSpinBox::editingFinished), setSignalMapper, mapFunction);
         } else if (auto doubleSpinBox = qobject_cast<QDoubleSpinBox*>(sw.widget)) {
+            connect(doubleSpinBox, QOverload<double>::of(&QDoubleSpinBox::valueChanged), this, [this, idx]() { schedulePreview(idx); });
             connect(doubleSpinBox, QOverload<>::of(&QDoubleSpinBox::editingFinished), setSignalMapper, mapFunction);
         } else if (auto fontComboBox = qobject_cast<QFontComboBox*>(sw.widget)) {
             connect(fontComboBox, &QFontComboBox::currentFontChanged, setSignalMapper, mapFunction);
@@ -845,7 +849,7 @@ EditStyle::EditStyle(QWidget* parent)
         } else if (auto groupBox = qobject_cast<QGroupBox*>(sw.widget)) {
             connect(groupBox, &QGroupBox::toggled, setSignalMapper, mapFunction);
         } else if (auto textEdit = qobject_cast<QTextEdit*>(sw.widget)) {
-            connect(textEdit, &QTextEdit::textChanged, setSignalMapper, mapFunction);
+            connect(textEdit, &QTextEdit::textChanged, this, [this, idx]() { schedulePreview(idx); });
         } else if (auto buttonGroup = qobject_cast<QButtonGroup*>(sw.widget)) {
             connect(buttonGroup, QOverload<QAbstractButton*>::of(&QButtonGroup::buttonClicked), setSignalMapper, mapFunction);
         } else if (auto alignSelect = qobject_cast<AlignSelect*>(sw.widget)) {
@@ -860,6 +864,12 @@ EditStyle::EditStyle(QWidget* parent)
     }
 
     connect(setSignalMapper, &QSignalMapper::mappedInt, this, &EditStyle::valueChanged);
+
+    //! NOTE Every applied value relayouts the whole score,
+    //! so the values typed or stepped in quick succession are applied together once the user pauses
+    m_previewTimer.setSingleShot(true);
+    m_previewTimer.setInterval(PREVIEW_DELAY_MS);
+    connect(&m_previewTimer, &QTimer::timeout, this, &EditStyle::applyPendingPreview);
     connect(resetSignalMapper, &QSignalMapper::mappedInt, this, &EditStyle::resetStyleValue);
 
     Score* score = globalContext()->currentNotation()->elements()->msScore();
@@ -1380,6 +1390,8 @@ void EditStyle::setCurrentSubPageCode(const QString& code)
 
 void EditStyle::buttonClicked(QAbstractButton* b)
 {
+    applyPendingPreview();
+
     switch (buttonBox->standardButton(b)) {
     case QDialogButtonBox::Ok:
         accept();
@@ -1401,6 +1413,8 @@ void EditStyle::buttonClicked(QAbstractButton* b)
 
 void EditStyle::accept()
 {
+    applyPendingPreview();
+
     globalContext()->currentNotation()->undoStack()->commitChanges();
     globalContext()->currentNotation()->style()->styleChanged().notify();
 
@@ -1413,6 +1427,9 @@ void EditStyle::accept()
 
 void EditStyle::reject()
 {
+    m_previewTimer.stop();
+    m_pendingPreviewIds.clear();
+
     globalContext()->currentNotation()->undoStack()->rollbackChanges();
     globalContext()->currentNotation()->style()->styleChanged().notify();
 
@@ -2034,6 +2051,8 @@ const EditStyle::StyleWidget& EditStyle::styleWidget(StyleId idx) const
 void EditStyle::valueChanged(int i)
 {
     StyleId idx       = (StyleId)i;
+    m_pendingPreviewIds.erase(idx);
+
     PropertyValue val  = getValue(idx);
     bool setValue = false;
     if (idx == StyleId::MusicalSymbolFont && optimizeStyleCheckbox->isChecked()) {
@@ -2057,6 +2076,32 @@ void EditStyle::valueChanged(int i)
     }
 }
 
+//---------------------------------------------------------
+//   schedulePreview
+//---------------------------------------------------------
+
+void EditStyle::schedulePreview(StyleId idx)
+{
+    m_pendingPreviewIds.insert(idx);
+    m_previewTimer.start();
+}
+
+//---------------------------------------------------------
+//   applyPendingPreview
+//---------------------------------------------------------
+
+void EditStyle::applyPendingPreview()
+{
+    m_previewTimer.stop();
+
+    std::set<StyleId> ids;
+    ids.swap(m_pendingPreviewIds);
+
+    for (StyleId idx : ids) {
+        valueChanged(static_cast<int>(idx));
+    }
+}
+
 //---------------------------------------------------------
 //   resetStyleValue
 //---------------------------------------------------------
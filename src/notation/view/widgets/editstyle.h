@@ -22,6 +22,10 @@
 #ifndef MU_NOTATION_EDITSTYLE_H
 #define MU_NOTATION_EDITSTYLE_H
 
+#include <set>
+
+#include <QTimer>
+
 #include "ui_editstyle.h"
 
 #include "modularity/ioc.h"
@@ -108,6 +112,9 @@ private:
     void setStyleQVariantValue(StyleId id, const QVariant& value);
     void setStyleValue(StyleId id, const PropertyValue& value);
 
+    void schedulePreview(StyleId idx);
+    void applyPendingPreview();
+
 private slots:
     void selectChordDescriptionFile();
     void setChordStyle(bool);
@@ -137,8 +144,13 @@ private slots:
     void resetUserStyleName();
 
 private:
+    static constexpr int PREVIEW_DELAY_MS = 300;
+
     QString m_currentPageCode;
     QString m_currentSubPageCode;
+
+    QTimer m_previewTimer;
+    std::set<StyleId> m_pendingPreviewIds;
 };
 }
 
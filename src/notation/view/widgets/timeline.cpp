@@ -1015,6 +1015,29 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
 
     QList<Part*> partList = getParts();
 
+    //! NOTE The names are the same in every column, and a QTextDocument is expensive to create,
+    //! so the tooltip parts are computed once per row rather than once per cell
+    const QString translateMeasure = qtrc("notation/timeline", "Measure");
+    const QString measurePrefix = translateMeasure.left(1) + QString(" ");
+
+    QStringList partNames;
+    QTextDocument doc;
+    for (int row = 0; row < globalRows; row++) {
+        QString partName = "";
+        if (partList.size() > row) {
+            doc.setHtml(partList.at(row)->longName());
+            partName = doc.toPlainText();
+            if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
+                doc.setHtml(partList.at(row)->partName());
+                partName = doc.toPlainText();
+            }
+            if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
+                partName = partList.at(row)->instrumentName();
+            }
+        }
+        partNames << partName;
+    }
+
     for (int col = startMeasure; col < endMeasure; col++) {
         for (int row = 0; row < globalRows; row++) {
             QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
@@ -1022,23 +1045,7 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
 
             setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
 
-            QString translateMeasure = qtrc("notation/timeline", "Measure");
-            QChar initialLetter = translateMeasure[0];
-            QTextDocument doc;
-            QString partName = "";
-            if (partList.size() > row) {
-                doc.setHtml(partList.at(row)->longName());
-                partName = doc.toPlainText();
-                if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
-                    doc.setHtml(partList.at(row)->partName());
-                    partName = doc.toPlainText();
-                }
-                if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
-                    partName = partList.at(row)->instrumentName();
-                }
-            }
-
-            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
+            graphicsRectItem->setToolTip(measurePrefix + QString::number(currMeasure->no() + 1) + QString(", ") + partNames.at(row));
             graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
             graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
             graphicsRectItem->setZValue(-3);
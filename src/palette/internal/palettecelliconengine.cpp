@@ -21,6 +21,9 @@
  */
 #include "palettecelliconengine.h"
 
+#include <QCache>
+#include <QImage>
+#include <QMutex>
 #include <QPainter>
 
 #include "draw/types/geometry.h"
@@ -37,6 +40,11 @@ using namespace mu::palette;
 using namespace mu::draw;
 using namespace mu::engraving;
 
+//! NOTE The icons are painted by the scene graph (render thread), so QPixmapCache can't be used there
+static constexpr int CELL_IMAGE_CACHE_SIZE = 64 * 1024 * 1024; // bytes
+static QCache<QString, QImage> s_cellImageCache(CELL_IMAGE_CACHE_SIZE);
+static QMutex s_cellImageCacheMutex;
+
 PaletteCellIconEngine::PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag)
     : QIconEngine(), m_cell(cell), m_extraMag(extraMag)
 {
@@ -50,26 +58,65 @@ QIconEngine* PaletteCellIconEngine::clone() const
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
     qreal dpi = qp->device()->logicalDpiX();
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On, dpi);
-    p.restore();
-}
-
-void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const
-{
-    paintBackground(painter, rect, selected, current);
+    {
+        Painter p(qp, "palettecell");
+        p.save();
+        p.setAntialiasing(true);
+        paintBackground(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
+        p.restore();
+    }
 
-    if (!m_cell) {
+    if (!m_cell || !m_cell->element || rect.isEmpty()) {
         return;
     }
 
-    EngravingItem* element = m_cell->element.get();
-    if (!element) {
+    //! NOTE The palette cells are painted again on every update of the view (scrolling, hovering, expanding),
+    //! laying out and drawing the element each time is expensive, so the element is drawn once into an image
+    qreal dpr = qp->device()->devicePixelRatioF();
+    QString key = cacheKey(rect.size(), dpi, dpr);
+
+    QMutexLocker lock(&s_cellImageCacheMutex);
+
+    if (const QImage* image = s_cellImageCache.object(key)) {
+        qp->drawImage(rect.topLeft(), *image);
         return;
     }
 
+    QImage* image = new QImage(rect.size() * dpr, QImage::Format_ARGB32_Premultiplied);
+    image->setDevicePixelRatio(dpr);
+    image->setDotsPerMeterX(qRound((dpi * 1000) / mu::engraving::INCH));
+    image->setDotsPerMeterY(qRound((dpi * 1000) / mu::engraving::INCH));
+    image->fill(Qt::transparent);
+
+    {
+        QPainter imagePainter(image);
+        Painter p(&imagePainter, "palettecell");
+        p.setAntialiasing(true);
+        paintCell(p, RectF(0, 0, rect.width(), rect.height()), dpi);
+    }
+
+    qp->drawImage(rect.topLeft(), *image);
+    s_cellImageCache.insert(key, image, static_cast<int>(image->sizeInBytes()));
+}
+
+QString PaletteCellIconEngine::cacheKey(const QSize& size, qreal dpi, qreal dpr) const
+{
+    return QString("palettecell_%1_%2_%3_%4_%5_%6_%7_%8_%9")
+           .arg(m_cell->id)
+           .arg(reinterpret_cast<quintptr>(m_cell->element.get()))
+           .arg(m_cell->mag * m_extraMag)
+           .arg(m_cell->xoffset)
+           .arg(m_cell->yoffset)
+           .arg(m_cell->drawStaff)
+           .arg(QString("%1x%2").arg(size.width()).arg(size.height()))
+           .arg(QString("%1@%2").arg(dpi).arg(dpr))
+           .arg(configuration()->elementsColor().name(QColor::HexArgb));
+}
+
+void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, qreal dpi) const
+{
+    EngravingItem* element = m_cell->element.get();
+
     painter.setPen(configuration()->elementsColor());
 
     if (element->isActionIcon()) {
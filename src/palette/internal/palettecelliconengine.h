@@ -55,7 +55,8 @@ public:
     static void paintPaletteElement(void* context, mu::engraving::EngravingItem* element);
 
 private:
-    void paintCell(draw::Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const;
+    QString cacheKey(const QSize& size, qreal dpi, qreal dpr) const;
+    void paintCell(draw::Painter& painter, const RectF& rect, qreal dpi) const;
     void paintBackground(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintActionIcon(draw::Painter& painter, const RectF& rect, mu::engraving::EngravingItem* element) const;
     qreal paintStaff(draw::Painter& painter, const RectF& rect, qreal spatium) const;
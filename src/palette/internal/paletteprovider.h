@@ -254,7 +254,9 @@ public:
     void retranslate()
     {
         m_userPaletteModel->retranslate();
-        m_masterPaletteModel->retranslate();
+        if (m_masterPaletteModel) {
+            m_masterPaletteModel->retranslate();
+        }
         m_defaultPaletteModel->retranslate();
     }
 
@@ -281,6 +283,8 @@ private:
         PaletteIndexRole
     };
 
+    PaletteTreeModel* masterPaletteModel() const;
+
     QAbstractItemModel* mainPaletteModel();
     AbstractPaletteController* mainPaletteController();
 
@@ -290,7 +294,7 @@ private:
     QString getPaletteFilename(bool open, const QString& name = "") const;
 
     PaletteTreeModel* m_userPaletteModel;
-    PaletteTreeModel* m_masterPaletteModel;
+    mutable PaletteTreeModel* m_masterPaletteModel = nullptr;
     PaletteTreeModel* m_defaultPaletteModel; // palette used by "Reset palette" action
 
     async::Notification m_userPaletteChanged;
@@ -80,11 +80,20 @@ void PaletteWorkspaceSetup::setup()
         QByteArray newData;
         writePalette(tree, newData);
 
+        m_appliedData = newData;
         workspacesDataProvider()->setRawData(DataKey::Palettes, newData);
     });
 
     auto loadData = [this]() {
         RetVal<QByteArray> data = workspacesDataProvider()->rawData(DataKey::Palettes);
+
+        //! NOTE Rebuilding the palettes is expensive, workspaces often have the same ones
+        if (m_appliedData && data.ret && data.val == m_appliedData.value()) {
+            return;
+        }
+
+        m_appliedData = data.ret ? data.val : QByteArray();
+
         PaletteTreePtr tree;
         if (data.ret && !data.val.isEmpty()) {
             LOGD() << "there is palette data in the workspace, we will use it";
@@ -22,6 +22,10 @@
 #ifndef MU_PALETTE_PALETTEWORKSPACESETUP_H
 #define MU_PALETTE_PALETTEWORKSPACESETUP_H
 
+#include <optional>
+
+#include <QByteArray>
+
 #include "modularity/ioc.h"
 #include "workspace/iworkspacesdataprovider.h"
 #include "ipaletteprovider.h"
@@ -35,6 +39,10 @@ class PaletteWorkspaceSetup : public async::Asyncable
 
 public:
     void setup();
+
+private:
+    //! NOTE The workspace data of the current palettes
+    std::optional<QByteArray> m_appliedData;
 };
 }
 
@@ -38,10 +38,23 @@ void SoundProfilesRepository::refresh()
         SoundProfile& basicProfile = m_profilesMap[basicProfileName];
         basicProfile.type = SoundProfileType::Basic;
         basicProfile.name = basicProfileName;
+        basicProfile.data.clear();
 
         SoundProfile& museProfile = m_profilesMap[museProfileName];
         museProfile.type = SoundProfileType::Muse;
         museProfile.name = museProfileName;
+        museProfile.data.clear();
+
+        //! NOTE Many resources share the same setup data (e.g. all soundfonts have the generic one),
+        //! so each distinct string is parsed once
+        std::map<String, mpe::PlaybackSetupData> parsedSetups;
+        auto setupData = [&parsedSetups](const String& str) -> const mpe::PlaybackSetupData& {
+            auto it = parsedSetups.find(str);
+            if (it == parsedSetups.end()) {
+                it = parsedSetups.emplace(str, mpe::PlaybackSetupData::fromString(str)).first;
+            }
+            return it->second;
+        };
 
         for (const AudioResourceMeta& resource : availableResources) {
             auto setup = resource.attributes.find(u"playbackSetupData");
@@ -51,11 +64,11 @@ void SoundProfilesRepository::refresh()
             }
 
             if (resource.type == AudioResourceType::FluidSoundfont) {
-                basicProfile.data.emplace(mpe::PlaybackSetupData::fromString(setup->second), resource);
+                basicProfile.data.emplace(setupData(setup->second), resource);
             }
 
             if (resource.type == AudioResourceType::MuseSamplerSoundPack) {
-                museProfile.data.emplace(mpe::PlaybackSetupData::fromString(setup->second), resource);
+                museProfile.data.emplace(setupData(setup->second), resource);
             }
         }
     })
@@ -48,5 +48,40 @@ MixerPanelSection {
 
             text: channelItem.title
         }
+
+        Rectangle {
+            id: cpuLoadIndicator
+
+            anchors.left: parent.left
+            anchors.bottom: parent.bottom
+            anchors.margins: parent.border.width
+
+            readonly property real load: Math.min(Math.max(channelItem.cpuLoad, 0), 1)
+
+            width: (parent.width - 2 * parent.border.width) * load
+            height: 2
+
+            visible: load > 0
+            color: load > 0.5 ? ui.theme.accentColor : ui.theme.fontPrimaryColor
+            opacity: 0.7
+        }
+
+        MouseArea {
+            id: titleMouseArea
+
+            anchors.fill: parent
+
+            hoverEnabled: true
+            acceptedButtons: Qt.NoButton
+
+            onContainsMouseChanged: {
+                if (containsMouse) {
+                    ui.tooltip.show(this, channelItem.title,
+                                    qsTrc("playback", "CPU load: %1%").arg(Math.round(channelItem.cpuLoad * 100)))
+                } else {
+                    ui.tooltip.hide(this)
+                }
+            }
+        }
     }
 }
@@ -66,6 +66,7 @@ MixerChannelItem::MixerChannelItem(QObject* parent, audio::TrackId trackId, bool
 MixerChannelItem::~MixerChannelItem()
 {
     m_audioSignalChanges.resetOnReceive(this);
+    m_cpuLoadChanges.resetOnReceive(this);
 }
 
 TrackId MixerChannelItem::trackId() const
@@ -98,6 +99,11 @@ float MixerChannelItem::rightChannelPressure() const
     return m_rightChannelPressure;
 }
 
+float MixerChannelItem::cpuLoad() const
+{
+    return m_cpuLoad;
+}
+
 float MixerChannelItem::volumeLevel() const
 {
     return m_outParams.volume;
@@ -230,6 +236,16 @@ void MixerChannelItem::subscribeOnAudioSignalChanges(AudioSignalChanges&& audioS
     });
 }
 
+void MixerChannelItem::subscribeOnCpuLoadChanges(AudioCpuLoadChanges&& cpuLoadChanges)
+{
+    m_cpuLoadChanges = cpuLoadChanges;
+
+    m_cpuLoadChanges.onReceive(this, [this](const cpu_load_t newValue) {
+        m_cpuLoad = newValue;
+        emit cpuLoadChanged(m_cpuLoad);
+    });
+}
+
 void MixerChannelItem::setTitle(QString title)
 {
     if (m_title == title) {
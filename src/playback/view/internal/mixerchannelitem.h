@@ -49,6 +49,8 @@ class MixerChannelItem : public QObject, public async::Asyncable
     Q_PROPERTY(float leftChannelPressure READ leftChannelPressure NOTIFY leftChannelPressureChanged)
     Q_PROPERTY(float rightChannelPressure READ rightChannelPressure NOTIFY rightChannelPressureChanged)
 
+    Q_PROPERTY(float cpuLoad READ cpuLoad NOTIFY cpuLoadChanged)
+
     Q_PROPERTY(float volumeLevel READ volumeLevel WRITE setVolumeLevel NOTIFY volumeLevelChanged)
     Q_PROPERTY(int balance READ balance WRITE setBalance NOTIFY balanceChanged)
 
@@ -74,6 +76,8 @@ public:
     float leftChannelPressure() const;
     float rightChannelPressure() const;
 
+    float cpuLoad() const;
+
     float volumeLevel() const;
     int balance() const;
 
@@ -89,6 +93,7 @@ public:
     void loadSoloMuteState(project::IProjectAudioSettings::SoloMuteState&& newState);
 
     void subscribeOnAudioSignalChanges(audio::AudioSignalChanges&& audioSignalChanges);
+    void subscribeOnCpuLoadChanges(audio::AudioCpuLoadChanges&& cpuLoadChanges);
 
     bool outputOnly() const;
 
@@ -112,6 +117,8 @@ signals:
     void leftChannelPressureChanged(float leftChannelPressure);
     void rightChannelPressureChanged(float rightChannelPressure);
 
+    void cpuLoadChanged(float cpuLoad);
+
     void volumeLevelChanged(float volumeLevel);
     void balanceChanged(int balance);
 
@@ -150,6 +157,7 @@ protected:
     QMap<audio::AudioFxChainOrder, OutputResourceItem*> m_outputResourceItems;
 
     audio::AudioSignalChanges m_audioSignalChanges;
+    audio::AudioCpuLoadChanges m_cpuLoadChanges;
 
     QString m_title;
     bool m_isPrimary = true;
@@ -157,6 +165,8 @@ protected:
     float m_leftChannelPressure = 0.0;
     float m_rightChannelPressure = 0.0;
 
+    float m_cpuLoad = 0.0;
+
     ui::NavigationPanel* m_panel = nullptr;
 };
 
@@ -375,6 +375,17 @@ MixerChannelItem* MixerPanelModel::buildTrackChannelItem(const audio::TrackId tr
                << ", " << text;
     });
 
+    playback()->audioOutput()->cpuLoadChanges(m_currentTrackSequenceId, trackId)
+    .onResolve(this, [this, trackId](AudioCpuLoadChanges cpuLoadChanges) {
+        if (TrackMixerChannelItem* item = trackChannelItem(trackId)) {
+            item->subscribeOnCpuLoadChanges(std::move(cpuLoadChanges));
+        }
+    })
+    .onReject(this, [](int errCode, std::string text) {
+        LOGE() << "unable to subscribe on cpu load changes from mixer channel, error code: " << errCode
+               << ", " << text;
+    });
+
     connect(item, &TrackMixerChannelItem::inputParamsChanged, this, [this, trackId](const AudioInputParams& params) {
         playback()->tracks()->setInputParams(m_currentTrackSequenceId, trackId, params);
     });
@@ -35,6 +35,7 @@
 #include "instrument.h"
 #include "part.h"
 #include "score.h"
+#include "scriptworker.h"
 #include "selection.h"
 #include "tie.h"
 #include "util.h"
@@ -364,6 +365,7 @@ void PluginAPI::registerQmlTypes()
     qmlRegisterUncreatableType<Enum>("MuseScore", 3, 0, "MuseScoreEnum", "Cannot create an enumeration");
 
     qmlRegisterType<ScoreView>("MuseScore", 3, 0, "ScoreView");
+    qmlRegisterType<ScriptWorker>("MuseScore", 3, 0, "ScriptWorker");
 
     qmlRegisterType<Cursor>("MuseScore", 3, 0, "Cursor");
     qmlRegisterAnonymousType<ScoreElement>("MuseScore", 3);
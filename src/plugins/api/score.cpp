@@ -24,10 +24,13 @@
 #include "cursor.h"
 #include "elements.h"
 
+#include "libmscore/chord.h"
 #include "libmscore/factory.h"
 #include "libmscore/instrtemplate.h"
 #include "libmscore/measure.h"
 #include "libmscore/masterscore.h"
+#include "libmscore/note.h"
+#include "libmscore/scorediff.h"
 #include "libmscore/segment.h"
 #include "libmscore/text.h"
 
@@ -218,6 +221,66 @@ QQmlListProperty<Staff> Score::staves()
     return wrapContainerProperty<Staff>(this, score()->staves());
 }
 
+//---------------------------------------------------------
+//   Score::notesData
+//---------------------------------------------------------
+
+QVariantMap Score::notesData(int startTick, int endTick)
+{
+    const mu::engraving::Fraction start = mu::engraving::Fraction::fromTicks(startTick);
+    const mu::engraving::Fraction end = endTick < 0 ? score()->endTick() : mu::engraving::Fraction::fromTicks(endTick);
+
+    QList<int> ticks;
+    QList<int> durations;
+    QList<int> pitches;
+    QList<int> tpcs;
+    QList<int> tracks;
+    QList<bool> tieBacks;
+
+    const mu::engraving::SegmentType type = mu::engraving::SegmentType::ChordRest;
+    for (mu::engraving::Segment* s = score()->tick2rightSegment(start); s && s->tick() < end; s = s->next1(type)) {
+        for (mu::engraving::EngravingItem* e : s->elist()) {
+            if (!e || !e->isChord()) {
+                continue;
+            }
+            const mu::engraving::Chord* chord = mu::engraving::toChord(e);
+            const int duration = chord->actualTicks().ticks();
+            for (const mu::engraving::Note* note : chord->notes()) {
+                ticks.append(s->tick().ticks());
+                durations.append(duration);
+                pitches.append(note->pitch());
+                tpcs.append(note->tpc());
+                tracks.append(static_cast<int>(note->track()));
+                tieBacks.append(note->tieBack() != nullptr);
+            }
+        }
+    }
+
+    QVariantMap data;
+    data["tick"] = QVariant::fromValue(ticks);
+    data["duration"] = QVariant::fromValue(durations);
+    data["pitch"] = QVariant::fromValue(pitches);
+    data["tpc"] = QVariant::fromValue(tpcs);
+    data["track"] = QVariant::fromValue(tracks);
+    data["tieBack"] = QVariant::fromValue(tieBacks);
+    return data;
+}
+
+//---------------------------------------------------------
+//   Score::diff
+//---------------------------------------------------------
+
+QString Score::diff(Score* other)
+{
+    if (!other || !other->score()) {
+        return QString();
+    }
+
+    ScoreDiff scoreDiff(score(), other->score());
+    scoreDiff.update();
+    return scoreDiff.report().toQString();
+}
+
 //---------------------------------------------------------
 //   Score::startCmd
 //---------------------------------------------------------
@@ -243,7 +306,41 @@ void Score::endCmd(bool rollback)
         undoStack()->commitChanges();
     }
 
+    if (undoStack()->isBatchActive()) {
+        return;
+    }
+
     notation()->notationChanged().notify();
 }
+
+//---------------------------------------------------------
+//   Score::startBatch
+//---------------------------------------------------------
+
+void Score::startBatch()
+{
+    IF_ASSERT_FAILED(undoStack()) {
+        return;
+    }
+
+    undoStack()->beginBatch();
+}
+
+//---------------------------------------------------------
+//   Score::endBatch
+//---------------------------------------------------------
+
+void Score::endBatch(bool rollback)
+{
+    IF_ASSERT_FAILED(undoStack()) {
+        return;
+    }
+
+    if (rollback) {
+        undoStack()->rollbackBatch();
+    } else {
+        undoStack()->commitBatch();
+    }
+}
 }
 }
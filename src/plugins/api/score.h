@@ -203,6 +203,33 @@ public:
 
     Q_INVOKABLE QString extractLyrics() { return score()->extractLyrics(); }
 
+    /**
+     * Reads all notes in a tick range at once, without creating
+     * an element wrapper for each of them. Much faster than
+     * visiting the notes with a Cursor for analysis plugins.
+     * \param startTick First tick of the range.
+     * \param endTick End tick of the range (exclusive), -1 for the end of the score.
+     * \returns An object with the arrays \p tick, \p duration, \p pitch,
+     * \p tpc, \p track and \p tieBack. The values with the same index
+     * describe one note, in score order. Durations are in ticks,
+     * \p tieBack is true if the note is tied to the previous one.
+     * Grace notes are not included.
+     * \since MuseScore 4.1
+     */
+    Q_INVOKABLE QVariantMap notesData(int startTick = 0, int endTick = -1);
+
+    /**
+     * Compares this score with the other one measure by measure.
+     * Identical measures are matched by a hash of their content,
+     * so only the changed measures are compared in detail.
+     * \param other The score to compare with.
+     * \returns A text report of the inserted, removed and changed
+     * measures, one line per measure followed by the changed lines
+     * of each staff. Empty if the scores are equal.
+     * \since MuseScore 4.1
+     */
+    Q_INVOKABLE QString diff(mu::engraving::PluginAPI::Score* other);
+
 //      //@ ??
 //      Q_INVOKABLE void updateRepeatList(bool expandRepeats) { score()->updateRepeatList(); } // TODO: needed?
 
@@ -233,6 +260,24 @@ public:
      */
     Q_INVOKABLE void endCmd(bool rollback = false);
 
+    /**
+     * Starts a batch of commands. All commands until the
+     * matching endBatch() call form a single undo step and
+     * the score is laid out only once, in endBatch().
+     * Use it around scripts that make many small changes.
+     * startCmd() / endCmd() may still be used inside a batch,
+     * endCmd(true) then reverts only that command.
+     * \since MuseScore 4.1
+     */
+    Q_INVOKABLE void startBatch();
+    /**
+     * Ends a batch started with startBatch().
+     * \param rollback If true, reverts all the changes
+     * made since the startBatch() invocation.
+     * \since MuseScore 4.1
+     */
+    Q_INVOKABLE void endBatch(bool rollback = false);
+
     /**
      * Create PlayEvents for all notes based on ornamentation.
      * You need to call this if you are manipulating PlayEvent's
@@ -0,0 +1,192 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "scriptworker.h"
+
+#include <QFile>
+#include <QJSEngine>
+#include <QQmlContext>
+#include <QQmlEngine>
+
+#include "log.h"
+
+using namespace mu::engraving::PluginAPI;
+
+//---------------------------------------------------------
+//   ScriptWorkerContext
+//---------------------------------------------------------
+
+ScriptWorkerContext::ScriptWorkerContext(ScriptWorker* worker)
+    : m_worker(worker)
+{
+}
+
+void ScriptWorkerContext::progress(const QVariant& value)
+{
+    ScriptWorker* worker = m_worker;
+    QMetaObject::invokeMethod(worker, [worker, value]() {
+        emit worker->progress(value);
+    }, Qt::QueuedConnection);
+}
+
+bool ScriptWorkerContext::isCancelled() const
+{
+    return m_worker->m_cancelled;
+}
+
+//---------------------------------------------------------
+//   ScriptWorker
+//---------------------------------------------------------
+
+ScriptWorker::ScriptWorker(QObject* parent)
+    : QObject(parent)
+{
+}
+
+ScriptWorker::~ScriptWorker()
+{
+    cancel();
+    join();
+}
+
+//---------------------------------------------------------
+//   start
+//---------------------------------------------------------
+
+bool ScriptWorker::start(const QString& scriptUrl, const QVariant& data)
+{
+    if (m_running) {
+        LOGW() << "the worker is already running";
+        return false;
+    }
+
+    QUrl url(scriptUrl);
+    if (QQmlContext* context = qmlContext(this)) {
+        url = context->resolvedUrl(url);
+    }
+
+    QString fileName = url.isLocalFile() ? url.toLocalFile() : scriptUrl;
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        LOGW() << "failed to open the script: " << fileName;
+        return false;
+    }
+
+    QString program = QString::fromUtf8(file.readAll());
+
+    //! NOTE The previous run has already reported its result, so this doesn't block
+    join();
+
+    m_cancelled = false;
+    setRunning(true);
+
+    m_thread = std::thread([this, program, fileName, data]() {
+        exec(program, fileName, data);
+    });
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   cancel
+//---------------------------------------------------------
+
+void ScriptWorker::cancel()
+{
+    std::lock_guard<std::mutex> lock(m_engineMutex);
+    m_cancelled = true;
+    if (m_engine) {
+        m_engine->setInterrupted(true);
+    }
+}
+
+//---------------------------------------------------------
+//   exec
+//    runs in the worker thread
+//---------------------------------------------------------
+
+void ScriptWorker::exec(const QString& program, const QString& fileName, const QVariant& data)
+{
+    //! NOTE Declared before the engine so that it outlives it
+    ScriptWorkerContext context(this);
+    QJSEngine::setObjectOwnership(&context, QJSEngine::CppOwnership);
+
+    QJSEngine engine;
+    engine.installExtensions(QJSEngine::ConsoleExtension);
+    engine.globalObject().setProperty("worker", engine.newQObject(&context));
+
+    {
+        std::lock_guard<std::mutex> lock(m_engineMutex);
+        m_engine = &engine;
+        engine.setInterrupted(m_cancelled);
+    }
+
+    QJSValue result = engine.evaluate(program, fileName);
+    if (!result.isError()) {
+        QJSValue run = engine.globalObject().property("run");
+        if (run.isCallable()) {
+            result = run.call({ engine.toScriptValue(data) });
+        } else {
+            result = engine.newErrorObject(QJSValue::ReferenceError, "run(data) is not defined");
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_engineMutex);
+        m_engine = nullptr;
+    }
+
+    if (m_cancelled) {
+        QMetaObject::invokeMethod(this, [this]() {
+            setRunning(false);
+            emit failed("cancelled");
+        }, Qt::QueuedConnection);
+    } else if (result.isError()) {
+        QString message = QString("%1:%2: %3").arg(fileName, result.property("lineNumber").toString(), result.toString());
+        QMetaObject::invokeMethod(this, [this, message]() {
+            setRunning(false);
+            emit failed(message);
+        }, Qt::QueuedConnection);
+    } else {
+        QVariant value = result.toVariant();
+        QMetaObject::invokeMethod(this, [this, value]() {
+            setRunning(false);
+            emit finished(value);
+        }, Qt::QueuedConnection);
+    }
+}
+
+void ScriptWorker::join()
+{
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void ScriptWorker::setRunning(bool running)
+{
+    if (m_running == running) {
+        return;
+    }
+
+    m_running = running;
+    emit runningChanged();
+}
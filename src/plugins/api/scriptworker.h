@@ -0,0 +1,146 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef __PLUGIN_API_SCRIPTWORKER_H__
+#define __PLUGIN_API_SCRIPTWORKER_H__
+
+#include <QObject>
+#include <QVariant>
+#include <QUrl>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+class QJSEngine;
+
+namespace mu::engraving {
+namespace PluginAPI {
+class ScriptWorker;
+
+/// \cond MS_INTERNAL
+//---------------------------------------------------------
+//   ScriptWorkerContext
+//    The global "worker" object of a script run by ScriptWorker,
+//    lives in the worker thread
+//---------------------------------------------------------
+
+class ScriptWorkerContext : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ScriptWorkerContext(ScriptWorker* worker);
+
+    Q_INVOKABLE void progress(const QVariant& value);
+    Q_INVOKABLE bool isCancelled() const;
+
+private:
+    ScriptWorker* m_worker = nullptr;
+};
+/// \endcond
+
+//---------------------------------------------------------
+///   \class ScriptWorker
+///   Runs a JavaScript file in a separate thread, so that
+///   long read-only computations do not block the UI.
+///   The script gets its own engine and has no access to
+///   the score objects: pass it a plain data snapshot
+///   instead (e.g. the result of Score::notesData()).
+///   The script must define a function \p run(data)
+///   and may use the global \p worker object:
+///   \p worker.progress(value) reports progress and
+///   \p worker.isCancelled() tells whether cancel() was called.
+///   \code
+///   import MuseScore 3.0
+///   MuseScore {
+///       ScriptWorker {
+///           id: analyzer
+///           onProgress: console.log("progress: " + value)
+///           onFinished: console.log("result: " + JSON.stringify(result))
+///           onFailed: console.log("error: " + message)
+///       }
+///       onRun: analyzer.start("analyze.js", curScore.notesData())
+///   }
+///   \endcode
+///   \since MuseScore 4.1
+//---------------------------------------------------------
+
+class ScriptWorker : public QObject
+{
+    Q_OBJECT
+
+    /** Whether the script is being run now */
+    Q_PROPERTY(bool running READ running NOTIFY runningChanged)
+
+public:
+    /// \cond MS_INTERNAL
+    explicit ScriptWorker(QObject* parent = nullptr);
+    ~ScriptWorker() override;
+
+    bool running() const { return m_running; }
+    /// \endcond
+
+    /**
+     * Starts running \p run(data) of the script \p scriptUrl
+     * in a separate thread. A relative url is resolved against
+     * the plugin file.
+     * \returns `false` if the worker is already running
+     * or the script can't be read.
+     */
+    Q_INVOKABLE bool start(const QString& scriptUrl, const QVariant& data = QVariant());
+    /**
+     * Interrupts the running script, failed() is emitted
+     * once it has stopped.
+     */
+    Q_INVOKABLE void cancel();
+
+signals:
+    /// \cond MS_INTERNAL
+    void runningChanged();
+    /// \endcond
+    /** Emitted when the script calls \p worker.progress(value) */
+    void progress(const QVariant& value);
+    /** Emitted with the value returned by \p run(data) */
+    void finished(const QVariant& result);
+    /** Emitted when the script throws or is cancelled */
+    void failed(const QString& message);
+
+private:
+    /// \cond MS_INTERNAL
+    void exec(const QString& program, const QString& fileName, const QVariant& data);
+    void join();
+
+    void setRunning(bool running);
+    /// \endcond
+
+    friend class ScriptWorkerContext;
+
+    std::thread m_thread;
+    std::mutex m_engineMutex;
+    QJSEngine* m_engine = nullptr;
+    std::atomic<bool> m_cancelled = false;
+    bool m_running = false;
+};
+}
+}
+
+#endif // __PLUGIN_API_SCRIPTWORKER_H__
@@ -38,6 +38,9 @@ public:
     virtual ~IMscMetaReader() = default;
 
     virtual RetVal<ProjectMeta> readMeta(const io::path_t& filePath) const = 0;
+
+    //! NOTE Reads the files in parallel, the results are in the order of the paths
+    virtual std::vector<RetVal<ProjectMeta> > readMetaList(const io::paths_t& filePaths) const = 0;
 };
 }
 
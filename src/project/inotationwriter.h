@@ -58,6 +58,40 @@ public:
     virtual Ret write(notation::INotationPtr notation, QIODevice& device, const Options& options = Options()) = 0;
     virtual Ret writeList(const notation::INotationPtrList& notations, QIODevice& device, const Options& options = Options()) = 0;
 
+    //! NOTE Writes the page i to devices[i], a writer may process several pages at a time
+    virtual Ret writePages(notation::INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options = Options())
+    {
+        Options pageOptions = options;
+        for (size_t i = 0; i < devices.size(); ++i) {
+            pageOptions[OptionKey::PAGE_NUMBER] = Val(static_cast<int>(i));
+
+            Ret ret = write(notation, *devices[i], pageOptions);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return make_ret(Ret::Code::Ok);
+    }
+
+    //! NOTE Writes notations[i] to devices[i] and all of them to listDevice, a writer may paint every notation only once for both
+    virtual Ret writeEachAndList(const notation::INotationPtrList& notations, const std::vector<QIODevice*>& devices, QIODevice& listDevice,
+                                 const Options& options = Options())
+    {
+        Options partOptions = options;
+        partOptions[OptionKey::UNIT_TYPE] = Val(UnitType::PER_PART);
+        for (size_t i = 0; i < notations.size() && i < devices.size(); ++i) {
+            Ret ret = write(notations[i], *devices[i], partOptions);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        Options listOptions = options;
+        listOptions[OptionKey::UNIT_TYPE] = Val(UnitType::MULTI_PART);
+        return writeList(notations, listDevice, listOptions);
+    }
+
     virtual bool supportsProgressNotifications() const { return false; }
     virtual framework::Progress progress() const { return framework::Progress(); }
 
@@ -106,12 +106,14 @@ bool ExportProjectScenario::exportScores(const notation::INotationPtrList& notat
     }
 
     // Scores that are closed may have never been laid out, so we lay them out now
+    std::vector<mu::engraving::Score*> closedScores;
     for (INotationPtr notation : notations) {
         mu::engraving::Score* score = notation->elements()->msScore();
         if (!score->isOpen()) {
-            score->doLayout();
+            closedScores.push_back(score);
         }
     }
+    mu::engraving::Score::doLayoutScores(closedScores);
 
     bool isCreatingOnlyOneFile = this->isCreatingOnlyOneFile(notations, unitType);
 
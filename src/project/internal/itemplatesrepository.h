@@ -27,6 +27,8 @@
 #include "project/projecttypes.h"
 
 #include "types/retval.h"
+#include "async/promise.h"
+#include "async/cancellation.h"
 
 namespace mu::project {
 class ITemplatesRepository : MODULE_EXPORT_INTERFACE
@@ -37,6 +39,9 @@ public:
     virtual ~ITemplatesRepository() = default;
 
     virtual RetVal<Templates> templates() const = 0;
+
+    //! NOTE Reads the templates on the I/O thread pool and resolves on the calling thread
+    virtual async::Promise<Templates> templatesAsync(const async::CancellationPtr& cancellation = nullptr) const = 0;
 };
 }
 
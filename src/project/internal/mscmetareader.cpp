@@ -24,6 +24,7 @@
 #include <sstream>
 
 #include "io/buffer.h"
+#include "concurrency/taskscheduler.h"
 
 #include "stringutils.h"
 #include "global/deprecated/xmlreader.h"
@@ -36,6 +37,35 @@ using namespace mu::project;
 using namespace mu::framework;
 using namespace mu::engraving;
 
+static constexpr size_t SCORE_HEAD_SIZE = 64 * 1024;
+
+std::vector<mu::RetVal<ProjectMeta> > MscMetaReader::readMetaList(const io::paths_t& filePaths) const
+{
+    TRACEFUNC;
+
+    std::vector<RetVal<ProjectMeta> > result(filePaths.size());
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    if (filePaths.size() < 2 || scheduler->containsThread(std::this_thread::get_id())) {
+        for (size_t i = 0; i < filePaths.size(); ++i) {
+            result[i] = readMeta(filePaths.at(i));
+        }
+        return result;
+    }
+
+    std::vector<std::future<RetVal<ProjectMeta> > > futures;
+    futures.reserve(filePaths.size());
+    for (const io::path_t& path : filePaths) {
+        futures.push_back(scheduler->submit([this, path]() { return readMeta(path); }));
+    }
+
+    for (size_t i = 0; i < futures.size(); ++i) {
+        result[i] = futures[i].get();
+    }
+
+    return result;
+}
+
 mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) const
 {
     RetVal<ProjectMeta> meta;
@@ -59,9 +89,21 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) cons
     }
 
     // Read score meta
-    ByteArray scoreData = msczReader.readScoreFile();
-    framework::XmlReader xmlReader(scoreData.toQByteArray());
-    doReadMeta(xmlReader, meta.val);
+    //! NOTE Everything needed is at the top of the score file,
+    //! so only its head is read, and it's extended only if the header doesn't fit
+    size_t headSize = SCORE_HEAD_SIZE;
+    while (true) {
+        ByteArray scoreData = msczReader.readScoreFileHead(headSize);
+        framework::XmlReader xmlReader(scoreData.toQByteArray());
+
+        meta.val = ProjectMeta();
+        bool isHeaderRead = doReadMeta(xmlReader, meta.val);
+        if (isHeaderRead || scoreData.size() < headSize) {
+            break;
+        }
+
+        headSize *= 4;
+    }
 
     // Read thumbnail
     ByteArray thumbnailData = msczReader.readThumbnailFile();
@@ -194,6 +236,10 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(framework::XmlReader& xmlRea
             } else {
                 xmlReader.skipCurrentElement();
             }
+
+            //! NOTE The parts and the frames with the title come before and in the first staff,
+            //! there is nothing more to read
+            break;
         } else if (tag == "Part") {
             meta.partsCount++;
             xmlReader.skipCurrentElement();
@@ -205,21 +251,25 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(framework::XmlReader& xmlRea
     return meta;
 }
 
-void MscMetaReader::doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const
+bool MscMetaReader::doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const
 {
     RawMeta rawMeta;
+    bool isRead = false;
 
-    while (xmlReader.readNextStartElement()) {
+    while (!isRead && xmlReader.readNextStartElement()) {
         if (xmlReader.tagName() == "museScore") {
             std::string version = xmlReader.attribute("version");
             bool suitedVersion = version.rfind("1", 0) == 0;
 
             if (suitedVersion) {
                 rawMeta = doReadRawMeta(xmlReader);
+                isRead = true;
             } else {
                 while (xmlReader.readNextStartElement()) {
                     if (xmlReader.tagName() == "Score") {
                         rawMeta = doReadRawMeta(xmlReader);
+                        isRead = true;
+                        break;
                     } else {
                         xmlReader.skipCurrentElement();
                     }
@@ -267,6 +317,9 @@ void MscMetaReader::doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& met
     meta.arranger = simplified(rawMeta.arranger);
     meta.partsCount = rawMeta.partsCount;
     meta.creationDate = QDate::fromString(rawMeta.creationDate, "yyyy-MM-dd");
+
+    //! NOTE If the data ends before the header does, the parser reports an error
+    return xmlReader.success();
 }
 
 QString MscMetaReader::formatFromXml(const std::string& xml) const
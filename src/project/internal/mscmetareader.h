@@ -37,7 +37,8 @@ class MscMetaReader : public IMscMetaReader
     INJECT(project, io::IFileSystem, fileSystem)
 
 public:
-    RetVal<ProjectMeta> readMeta(const io::path_t& filePath) const;
+    RetVal<ProjectMeta> readMeta(const io::path_t& filePath) const override;
+    std::vector<RetVal<ProjectMeta> > readMetaList(const io::paths_t& filePaths) const override;
 
 private:
 
@@ -67,7 +68,7 @@ private:
         size_t partsCount = 0;
     };
 
-    void doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const;
+    bool doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const;
     RawMeta doReadBox(framework::XmlReader& xmlReader) const;
     RawMeta doReadRawMeta(framework::XmlReader& xmlReader) const;
     QString formatFromXml(const std::string& xml) const;
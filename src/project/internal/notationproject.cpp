@@ -24,8 +24,10 @@
 #include <QBuffer>
 #include <QDir>
 #include <QFile>
+#include <QSaveFile>
 
 #include "io/buffer.h"
+#include "io/ioretcodes.h"
 
 #include "engraving/engravingproject.h"
 #include "engraving/compat/scoreaccess.h"
@@ -50,6 +52,9 @@ using namespace mu::engraving;
 using namespace mu::notation;
 using namespace mu::project;
 
+//! NOTE Pages covering the viewport plus a lookahead
+static constexpr size_t INITIAL_LAYOUT_PAGE_LIMIT = 5;
+
 static const QString WORK_TITLE_TAG("workTitle");
 static const QString WORK_NUMBER_TAG("workNumber");
 static const QString SUBTITLE_TAG("subtitle");
@@ -220,6 +225,13 @@ mu::Ret NotationProject::doLoad(engraving::MscReader& reader, const io::path_t&
 
     masterScore->lockUpdates(false);
     masterScore->setLayoutAll();
+
+    //! NOTE In the editor only lay out the first pages so they can be shown right away,
+    //! MasterNotation continues the layout of the rest of the score in background
+    if (application()->runMode() == framework::IApplication::RunMode::Editor && masterScore->pageMode()) {
+        masterScore->setLayoutPageLimit(INITIAL_LAYOUT_PAGE_LIMIT);
+    }
+
     masterScore->update();
 
     // Load other stuff from the project file
@@ -421,6 +433,21 @@ void NotationProject::setCloudInfo(const CloudProjectInfo& info)
     m_masterNotation->masterScore()->setMetaTag(SOURCE_TAG, info.sourceUrl.toString());
 }
 
+static std::string autoSaveSuffix(const io::path_t& path)
+{
+    std::string suffix = io::suffix(path);
+    if (suffix == IProjectAutoSaver::AUTOSAVE_SUFFIX) {
+        suffix = io::suffix(io::completeBasename(path));
+    }
+
+    if (suffix.empty()) {
+        // Then it must be a MSCX folder
+        suffix = engraving::MSCX;
+    }
+
+    return suffix;
+}
+
 mu::Ret NotationProject::save(const io::path_t& path, SaveMode saveMode)
 {
     TRACEFUNC;
@@ -455,17 +482,7 @@ mu::Ret NotationProject::save(const io::path_t& path, SaveMode saveMode)
         return ret;
     }
     case SaveMode::AutoSave:
-        std::string suffix = io::suffix(path);
-        if (suffix == IProjectAutoSaver::AUTOSAVE_SUFFIX) {
-            suffix = io::suffix(io::completeBasename(path));
-        }
-
-        if (suffix.empty()) {
-            // Then it must be a MSCX folder
-            suffix = engraving::MSCX;
-        }
-
-        return saveScore(path, suffix);
+        return saveScore(path, autoSaveSuffix(path));
     }
 
     return make_ret(notation::Err::UnknownError);
@@ -500,6 +517,63 @@ mu::Ret NotationProject::writeToDevice(QIODevice* device)
     return ret;
 }
 
+mu::RetVal<AutoSaveTask> NotationProject::prepareAutoSave(const io::path_t& path)
+{
+    TRACEFUNC;
+
+    RetVal<AutoSaveTask> result;
+
+    //! NOTE Only a MSCZ is written to one file, that can be replaced atomically
+    if (mscIoModeBySuffix(autoSaveSuffix(path)) != MscIoMode::Zip) {
+        result.ret = save(path, SaveMode::AutoSave);
+        return result;
+    }
+
+    std::shared_ptr<Buffer> buf = std::make_shared<Buffer>();
+    buf->open(IODevice::OpenMode::WriteOnly);
+
+    MscWriter::Params params;
+    params.device = buf.get();
+    params.filePath = path;
+    params.mainFileName = engraving::mainFileName(path).toQString();
+    params.mode = MscIoMode::Zip;
+    params.previousFilePath = path;
+
+    //! NOTE Serialization happens here, on the main thread,
+    //! while the entries are compressed on the task scheduler, that the returned task waits for
+    std::shared_ptr<MscWriter> msczWriter = std::make_shared<MscWriter>(params);
+    result.ret = writeProject(*msczWriter, false);
+    if (!result.ret) {
+        LOGE() << "failed write project to buffer";
+        return result;
+    }
+
+    QString targetContainerPath = engraving::containerPath(path).toQString();
+
+    result.val = [buf, msczWriter, targetContainerPath]() -> Ret {
+        msczWriter->close();
+
+        //! NOTE QSaveFile writes to a temporary file and renames it over the target on commit,
+        //! so an interrupted autosave never leaves a truncated file behind
+        QSaveFile file(targetContainerPath);
+        if (!file.open(QIODevice::WriteOnly)) {
+            LOGE() << "failed open file: " << targetContainerPath;
+            return make_ret(io::Err::FSWriteError);
+        }
+
+        const ByteArray& data = buf->data();
+        file.write(reinterpret_cast<const char*>(data.constData()), static_cast<qint64>(data.size()));
+        if (!file.commit()) {
+            LOGE() << "failed save file: " << targetContainerPath << ", err: " << file.errorString();
+            return make_ret(io::Err::FSWriteError);
+        }
+
+        return make_ret(Ret::Code::Ok);
+    };
+
+    return result;
+}
+
 mu::Ret NotationProject::saveScore(const io::path_t& path, const std::string& fileSuffix)
 {
     if (!isMuseScoreFile(fileSuffix) && !fileSuffix.empty()) {
@@ -541,6 +615,7 @@ mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, eng
         params.filePath = savePath;
         params.mainFileName = targetMainFileName.toQString();
         params.mode = ioMode;
+        params.previousFilePath = targetContainerPath;
         IF_ASSERT_FAILED(params.mode != MscIoMode::Unknown) {
             return make_ret(Ret::Code::InternalError);
         }
@@ -28,6 +28,7 @@
 
 #include "modularity/ioc.h"
 #include "io/ifilesystem.h"
+#include "iapplication.h"
 #include "iprojectconfiguration.h"
 #include "inotationreadersregister.h"
 #include "inotationwritersregister.h"
@@ -53,6 +54,7 @@ class NotationProject : public INotationProject, public async::Asyncable
     INJECT(project, INotationReadersRegister, readers)
     INJECT(project, INotationWritersRegister, writers)
     INJECT(project, IProjectMigrator, migrator)
+    INJECT(project, framework::IApplication, application)
 
 public:
     ~NotationProject() override;
@@ -83,6 +85,7 @@ public:
 
     Ret save(const io::path_t& path = io::path_t(), SaveMode saveMode = SaveMode::Save) override;
     Ret writeToDevice(QIODevice* device) override;
+    RetVal<AutoSaveTask> prepareAutoSave(const io::path_t& path) override;
 
     ProjectMeta metaInfo() const override;
     void setMetaInfo(const ProjectMeta& meta, bool undoable = false) override;
@@ -21,7 +21,6 @@
  */
 #include "projectactionscontroller.h"
 
-#include <QBuffer>
 #include <QTemporaryFile>
 #include <QFileInfo>
 
@@ -171,8 +170,12 @@ Ret ProjectActionsController::openProject(const io::path_t& projectPath_)
     }
 
     //! Step 4. Check, if a any project is already open in the current window,
-    //! then create a new instance
+    //! then open the project in an instance without a project or create a new instance
     if (globalContext()->currentProject()) {
+        if (multiInstancesProvider()->openProjectInAppInstanceWithoutProject(projectPath)) {
+            return make_ret(Ret::Code::Ok);
+        }
+
         QStringList args;
         args << projectPath.toQString();
         multiInstancesProvider()->openNewAppInstance(args);
@@ -183,6 +186,35 @@ Ret ProjectActionsController::openProject(const io::path_t& projectPath_)
     return doOpenProject(projectPath);
 }
 
+Ret ProjectActionsController::openProjects(const std::vector<io::path_t>& projectPaths)
+{
+    if (projectPaths.empty()) {
+        return make_ret(Ret::Code::Ok);
+    }
+
+    //! NOTE Every project gets its own app instance, which loads it in its own process.
+    //! So the other projects are handed over first, and they load in parallel
+    //! while the first one is loaded here (or handed over too, if this window already has a project).
+    //! New instances are used rather than the ones without a project,
+    //! since an instance accepts only one project at a time
+    for (size_t i = 1; i < projectPaths.size(); ++i) {
+        io::path_t projectPath = fileSystem()->absoluteFilePath(projectPaths[i]);
+        if (projectPath.empty() || isProjectOpened(projectPath)) {
+            continue;
+        }
+
+        if (multiInstancesProvider()->isProjectAlreadyOpened(projectPath)) {
+            continue;
+        }
+
+        QStringList args;
+        args << projectPath.toQString();
+        multiInstancesProvider()->openNewAppInstance(args);
+    }
+
+    return openProject(projectPaths.front());
+}
+
 Ret ProjectActionsController::doOpenProject(const io::path_t& filePath)
 {
     TRACEFUNC;
@@ -735,8 +767,13 @@ void ProjectActionsController::uploadProject(const CloudProjectInfo& info, const
         return;
     }
 
-    QBuffer* projectData = new QBuffer();
-    projectData->open(QIODevice::WriteOnly);
+    //! NOTE The upload streams the project from a temporary file, so large projects are not kept in memory twice
+    QTemporaryFile* projectData = new QTemporaryFile(configuration()->temporaryUploadProjectFilePathTemplate().toQString());
+    if (!projectData->open()) {
+        LOGE() << "Could not open a temp file";
+        delete projectData;
+        return;
+    }
 
     Ret ret = project->writeToDevice(projectData);
     if (!ret) {
@@ -745,8 +782,7 @@ void ProjectActionsController::uploadProject(const CloudProjectInfo& info, const
         return;
     }
 
-    projectData->close();
-    projectData->open(QIODevice::ReadOnly);
+    projectData->seek(0);
 
     bool isFirstSave = info.sourceUrl.isEmpty();
 
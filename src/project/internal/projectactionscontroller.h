@@ -76,6 +76,7 @@ public:
 
     bool isFileSupported(const io::path_t& path) const override;
     Ret openProject(const io::path_t& projectPath) override;
+    Ret openProjects(const std::vector<io::path_t>& projectPaths) override;
     bool closeOpenedProject(bool quitApp = false) override;
     bool isProjectOpened(const io::path_t& scorePath) const override;
     bool isAnyProjectOpened() const override;
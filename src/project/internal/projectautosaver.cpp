@@ -21,12 +21,19 @@
  */
 #include "projectautosaver.h"
 
+#include <QtConcurrent>
+
 #include "engraving/infrastructure/mscio.h"
 
 #include "log.h"
 
 using namespace mu::project;
 
+ProjectAutoSaver::~ProjectAutoSaver()
+{
+    waitForSaveFinished();
+}
+
 void ProjectAutoSaver::init()
 {
     QObject::connect(&m_timer, &QTimer::timeout, [this]() { onTrySave(); });
@@ -69,10 +76,12 @@ void ProjectAutoSaver::init()
             });
 
             project->needSave().notification.onNotify(this, [this]() {
+                m_changedSinceLastAutoSave = true;
                 update();
             });
         }
 
+        m_changedSinceLastAutoSave = true;
         update();
     });
 }
@@ -85,6 +94,9 @@ bool ProjectAutoSaver::projectHasUnsavedChanges(const io::path_t& projectPath) c
 
 void ProjectAutoSaver::removeProjectUnsavedChanges(const io::path_t& projectPath)
 {
+    //! NOTE Otherwise the running autosave would bring the file back
+    waitForSaveFinished();
+
     io::path_t path = projectPath;
     if (!isAutosaveOfNewlyCreatedProject(projectPath)) {
         path = projectAutoSavePath(projectPath);
@@ -149,21 +161,54 @@ void ProjectAutoSaver::onTrySave()
         return;
     }
 
+    //! NOTE needSave stays true until the user saves,
+    //! so without this every interval would write the same score again
+    if (!m_changedSinceLastAutoSave) {
+        LOGD() << "[autosave] project has not changed since the last autosave";
+        return;
+    }
+
     if (!project->canSave()) {
         LOGD() << "[autosave] project could not be saved";
         return;
     }
 
+    if (m_saveFuture.isRunning()) {
+        LOGD() << "[autosave] previous autosave is still being written";
+        return;
+    }
+
     io::path_t projectPath = this->projectPath(project);
     io::path_t savePath = project->isNewlyCreated() ? projectPath : projectAutoSavePath(projectPath);
 
-    Ret ret = project->save(savePath, SaveMode::AutoSave);
-    if (!ret) {
-        LOGE() << "[autosave] failed to save project, err: " << ret.toString();
+    RetVal<AutoSaveTask> task = project->prepareAutoSave(savePath);
+    if (!task.ret) {
+        LOGE() << "[autosave] failed to save project, err: " << task.ret.toString();
         return;
     }
 
-    LOGD() << "[autosave] successfully saved project";
+    m_changedSinceLastAutoSave = false;
+
+    if (!task.val) {
+        LOGD() << "[autosave] successfully saved project";
+        return;
+    }
+
+    //! NOTE The snapshot is taken, compressing and writing to the disk don't block the main thread
+    m_saveFuture = QtConcurrent::run([task = std::move(task.val)]() {
+        Ret ret = task();
+        if (!ret) {
+            LOGE() << "[autosave] failed to save project, err: " << ret.toString();
+            return;
+        }
+
+        LOGD() << "[autosave] successfully saved project";
+    });
+}
+
+void ProjectAutoSaver::waitForSaveFinished()
+{
+    m_saveFuture.waitForFinished();
 }
 
 mu::io::path_t ProjectAutoSaver::projectPath(INotationProjectPtr project) const
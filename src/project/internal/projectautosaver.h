@@ -22,6 +22,7 @@
 #ifndef MU_PROJECT_PROJECTAUTOSAVER_H
 #define MU_PROJECT_PROJECTAUTOSAVER_H
 
+#include <QFuture>
 #include <QTimer>
 
 #include "async/asyncable.h"
@@ -42,6 +43,7 @@ class ProjectAutoSaver : public IProjectAutoSaver, public async::Asyncable
 
 public:
     ProjectAutoSaver() = default;
+    ~ProjectAutoSaver() override;
 
     void init();
 
@@ -59,11 +61,14 @@ private:
     void update();
 
     void onTrySave();
+    void waitForSaveFinished();
 
     io::path_t projectPath(INotationProjectPtr project) const;
 
     QTimer m_timer;
+    QFuture<void> m_saveFuture;
     io::path_t m_lastProjectPathNeedingAutosave;
+    bool m_changedSinceLastAutoSave = true;
 };
 }
 
@@ -656,6 +656,11 @@ io::path_t ProjectConfiguration::temporaryMp3FilePathTemplate() const
     return globalConfiguration()->userAppDataPath() + "/audioFile_XXXXXX.mp3";
 }
 
+io::path_t ProjectConfiguration::temporaryUploadProjectFilePathTemplate() const
+{
+    return globalConfiguration()->userAppDataPath() + "/uploadProject_XXXXXX.mscz";
+}
+
 io::path_t ProjectConfiguration::projectBackupPath(const io::path_t& projectPath) const
 {
     io::path_t projectDir = io::absoluteDirpath(projectPath);
@@ -130,6 +130,7 @@ public:
     void setNumberOfSavesToGenerateAudio(int number) override;
 
     io::path_t temporaryMp3FilePathTemplate() const override;
+    io::path_t temporaryUploadProjectFilePathTemplate() const override;
 
     io::path_t projectBackupPath(const io::path_t& projectPath) const override;
 
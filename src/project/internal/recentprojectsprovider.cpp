@@ -41,11 +41,22 @@ ProjectMetaList RecentProjectsProvider::recentProjectList() const
 {
     if (m_dirty) {
         io::paths_t paths = configuration()->recentProjectPaths();
+
+        io::paths_t msczPaths;
+        for (const io::path_t& path : paths) {
+            if (engraving::isMuseScoreFile(io::suffix(path))) {
+                msczPaths.push_back(path);
+            }
+        }
+
+        std::vector<RetVal<ProjectMeta> > metaList = mscMetaReader()->readMetaList(msczPaths);
+
         m_recentList.clear();
+        size_t msczIndex = 0;
         for (const io::path_t& path : paths) {
             ProjectMeta meta;
             if (engraving::isMuseScoreFile(io::suffix(path))) {
-                RetVal<ProjectMeta> rv = mscMetaReader()->readMeta(path);
+                RetVal<ProjectMeta>& rv = metaList.at(msczIndex++);
                 if (!rv.ret) {
                     LOGE() << "failed read meta, path: " << path;
                     continue;
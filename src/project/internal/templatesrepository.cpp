@@ -23,6 +23,7 @@
 #include "templatesrepository.h"
 
 #include "io/path.h"
+#include "concurrency/taskscheduler.h"
 #include "translation.h"
 #include "log.h"
 
@@ -31,21 +32,51 @@
 #include <QJsonArray>
 
 using namespace mu::project;
+using namespace mu::async;
 
 mu::RetVal<Templates> TemplatesRepository::templates() const
 {
     TRACEFUNC;
 
+    return RetVal<Templates>::make_ok(readAllTemplates(configuration()->availableTemplateDirs(), nullptr));
+}
+
+Promise<Templates> TemplatesRepository::templatesAsync(const CancellationPtr& cancellation) const
+{
+    io::paths_t dirs = configuration()->availableTemplateDirs();
+
+    return Promise<Templates>([this, dirs, cancellation](auto resolve, auto reject) {
+        //! NOTE The template folders can be on a network share, so they are read off the main thread
+        TaskScheduler::ioInstance()->push([this, dirs, cancellation, resolve, reject]() {
+            Templates templates = readAllTemplates(dirs, cancellation);
+
+            if (isCancelled(cancellation)) {
+                (void)reject(static_cast<int>(Ret::Code::Cancel), "cancelled");
+            } else {
+                (void)resolve(templates);
+            }
+        });
+
+        return Promise<Templates>::Result::unchecked();
+    });
+}
+
+Templates TemplatesRepository::readAllTemplates(const io::paths_t& dirs, const CancellationPtr& cancellation) const
+{
     Templates templates;
 
-    for (const io::path_t& dir : configuration()->availableTemplateDirs()) {
-        templates << readTemplates(dir);
+    for (const io::path_t& dir : dirs) {
+        if (isCancelled(cancellation)) {
+            break;
+        }
+
+        templates << readTemplates(dir, cancellation);
     }
 
-    return RetVal<Templates>::make_ok(templates);
+    return templates;
 }
 
-Templates TemplatesRepository::readTemplates(const io::path_t& dirPath) const
+Templates TemplatesRepository::readTemplates(const io::path_t& dirPath, const CancellationPtr& cancellation) const
 {
     TRACEFUNC;
 
@@ -58,7 +89,7 @@ Templates TemplatesRepository::readTemplates(const io::path_t& dirPath) const
             return Templates();
         }
 
-        return readTemplates(files.val, qtrc("project", "My templates"));
+        return readTemplates(files.val, qtrc("project", "My templates"), io::path_t(), cancellation);
     }
 
     RetVal<ByteArray> categoriesJson = fileSystem()->readFile(categoriesJsonPath);
@@ -82,19 +113,24 @@ Templates TemplatesRepository::readTemplates(const io::path_t& dirPath) const
             paths.push_back(path);
         }
 
-        templates << readTemplates(paths, categoryTitle, dirPath);
+        templates << readTemplates(paths, categoryTitle, dirPath, cancellation);
     }
 
     return templates;
 }
 
-Templates TemplatesRepository::readTemplates(const io::paths_t& files, const QString& category, const io::path_t& dirPath) const
+Templates TemplatesRepository::readTemplates(const io::paths_t& files, const QString& category, const io::path_t& dirPath,
+                                             const CancellationPtr& cancellation) const
 {
     TRACEFUNC;
 
     Templates templates;
 
     for (const io::path_t& file : files) {
+        if (isCancelled(cancellation)) {
+            break;
+        }
+
         io::path_t path = dirPath.empty() ? file : dirPath + "/" + file;
         RetVal<ProjectMeta> meta = mscReader()->readMeta(path);
         if (!meta.ret) {
@@ -39,10 +39,13 @@ class TemplatesRepository : public ITemplatesRepository
 
 public:
     RetVal<Templates> templates() const override;
+    async::Promise<Templates> templatesAsync(const async::CancellationPtr& cancellation = nullptr) const override;
 
 private:
-    Templates readTemplates(const io::path_t& dirPath) const;
-    Templates readTemplates(const io::paths_t& files, const QString& category, const io::path_t& dirPath = io::path_t()) const;
+    Templates readAllTemplates(const io::paths_t& dirs, const async::CancellationPtr& cancellation) const;
+    Templates readTemplates(const io::path_t& dirPath, const async::CancellationPtr& cancellation) const;
+    Templates readTemplates(const io::paths_t& files, const QString& category, const io::path_t& dirPath,
+                            const async::CancellationPtr& cancellation) const;
 };
 }
 
@@ -129,6 +129,7 @@ public:
     virtual void setNumberOfSavesToGenerateAudio(int number) = 0;
 
     virtual io::path_t temporaryMp3FilePathTemplate() const = 0;
+    virtual io::path_t temporaryUploadProjectFilePathTemplate() const = 0;
 
     virtual io::path_t projectBackupPath(const io::path_t& projectPath) const = 0;
 
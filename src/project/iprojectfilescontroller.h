@@ -22,6 +22,8 @@
 #ifndef MU_PROJECT_IPROJECTFILESCONTROLLER_H
 #define MU_PROJECT_IPROJECTFILESCONTROLLER_H
 
+#include <vector>
+
 #include "modularity/imoduleexport.h"
 #include "types/ret.h"
 #include "io/path.h"
@@ -36,6 +38,7 @@ public:
 
     virtual bool isFileSupported(const io::path_t& path) const = 0;
     virtual Ret openProject(const io::path_t& path) = 0;
+    virtual Ret openProjects(const std::vector<io::path_t>& paths) = 0;
     virtual bool closeOpenedProject(bool quitApp = false) = 0;
     virtual bool isProjectOpened(const io::path_t& path) const = 0;
     virtual bool isAnyProjectOpened() const = 0;
@@ -22,12 +22,14 @@
 #ifndef MU_PROJECT_PROJECTTYPES_H
 #define MU_PROJECT_PROJECTTYPES_H
 
+#include <functional>
 #include <variant>
 
 #include <QString>
 #include <QUrl>
 
 #include "io/path.h"
+#include "types/ret.h"
 #include "log.h"
 
 #include "cloud/cloudtypes.h"
@@ -69,6 +71,10 @@ enum class SaveMode
     AutoSave
 };
 
+//! NOTE Finishes an autosave prepared on the main thread: compresses the data and writes the file.
+//! Doesn't access the score, so can be run on any thread
+using AutoSaveTask = std::function<Ret()>;
+
 enum class SaveLocationType
 {
     Undefined,
@@ -38,22 +38,38 @@ TemplatesModel::TemplatesModel(QObject* parent)
 {
 }
 
+TemplatesModel::~TemplatesModel()
+{
+    if (m_loadCancellation) {
+        m_loadCancellation->cancel();
+    }
+}
+
 void TemplatesModel::load()
 {
     TRACEFUNC;
 
-    RetVal<Templates> templates = repository()->templates();
-    if (!templates.ret) {
-        LOGE() << templates.ret.toString();
+    if (m_loadCancellation) {
+        m_loadCancellation->cancel();
     }
 
-    for (const Template& templ : templates.val) {
-        if (!templ.meta.title.isEmpty()) {
-            m_allTemplates << templ;
+    m_loadCancellation = std::make_shared<async::Cancellation>();
+
+    repository()->templatesAsync(m_loadCancellation).onResolve(this, [this](const Templates& templates) {
+        m_allTemplates.clear();
+
+        for (const Template& templ : templates) {
+            if (!templ.meta.title.isEmpty()) {
+                m_allTemplates << templ;
+            }
         }
-    }
 
-    loadAllCategories();
+        loadAllCategories();
+    }).onReject(this, [](int code, const std::string& msg) {
+        if (code != static_cast<int>(Ret::Code::Cancel)) {
+            LOGE() << msg;
+        }
+    });
 }
 
 void TemplatesModel::loadAllCategories()
@@ -23,10 +23,11 @@
 #define MU_PROJECT_TEMPLATESMODEL_H
 
 #include "modularity/ioc.h"
+#include "async/asyncable.h"
 #include "internal/itemplatesrepository.h"
 
 namespace mu::project {
-class TemplatesModel : public QObject
+class TemplatesModel : public QObject, public async::Asyncable
 {
     Q_OBJECT
 
@@ -42,6 +43,7 @@ class TemplatesModel : public QObject
 
 public:
     TemplatesModel(QObject* parent = nullptr);
+    ~TemplatesModel() override;
 
     QStringList categoriesTitles() const;
     QStringList templatesTitles() const;
@@ -92,6 +94,8 @@ private:
     Template m_currentTemplate;
 
     bool m_saveCurrentCategory = false;
+
+    async::CancellationPtr m_loadCancellation;
 };
 }
 
@@ -29,3 +29,8 @@ INetworkManagerPtr NetworkManagerCreatorStub::makeNetworkManager() const
 {
     return std::make_shared<NetworkManagerStub>();
 }
+
+INetworkManagerPtr NetworkManagerCreatorStub::makeCachingNetworkManager() const
+{
+    return std::make_shared<NetworkManagerStub>();
+}
@@ -29,6 +29,7 @@ class NetworkManagerCreatorStub : public INetworkManagerCreator
 {
 public:
     INetworkManagerPtr makeNetworkManager() const override;
+    INetworkManagerPtr makeCachingNetworkManager() const override;
 };
 }
 
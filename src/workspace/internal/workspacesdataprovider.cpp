@@ -21,6 +21,8 @@
  */
 #include "workspacesdataprovider.h"
 
+#include <vector>
+
 #include "log.h"
 
 using namespace mu::workspace;
@@ -28,9 +30,21 @@ using namespace mu::workspace;
 void WorkspacesDataProvider::init()
 {
     manager()->currentWorkspaceChanged().onNotify(this, [this]() {
+        //! NOTE Workspaces often share most of the data (through the default workspace),
+        //! so only notify about the data that the switch actually changed.
+        //! Compare before notifying, the listeners read the new data
+        std::vector<DataKey> changedKeys;
+        for (const auto& n : m_dataNotifications) {
+            QByteArray known = m_knownData[n.first];
+            if (rawData(n.first).val != known) {
+                changedKeys.push_back(n.first);
+            }
+        }
+
         m_workspaceChanged.notify();
-        for (auto& n : m_dataNotifications) {
-            n.second.notify();
+
+        for (DataKey key : changedKeys) {
+            m_dataNotifications[key].notify();
         }
     });
 }
@@ -44,7 +58,9 @@ mu::RetVal<QByteArray> WorkspacesDataProvider::rawData(DataKey key) const
 
     if (current->isManaged(key)) {
         LOGD() << "get data from current workspace, key: " << key_to_string(key);
-        return current->rawData(key);
+        RetVal<QByteArray> data = current->rawData(key);
+        m_knownData[key] = data.val;
+        return data;
     }
 
     IWorkspacePtr def = manager()->defaultWorkspace();
@@ -53,7 +69,9 @@ mu::RetVal<QByteArray> WorkspacesDataProvider::rawData(DataKey key) const
     }
 
     LOGD() << "get data from default workspace, key: " << key_to_string(key);
-    return def->rawData(key);
+    RetVal<QByteArray> data = def->rawData(key);
+    m_knownData[key] = data.val;
+    return data;
 }
 
 mu::Ret WorkspacesDataProvider::setRawData(DataKey key, const QByteArray& data)
@@ -80,6 +98,8 @@ mu::Ret WorkspacesDataProvider::setRawData(DataKey key, const QByteArray& data)
     }
 
     if (ret) {
+        m_knownData[key] = data;
+
         auto n = m_dataNotifications.find(key);
         if (n != m_dataNotifications.end()) {
             n->second.notify();
@@ -49,6 +49,10 @@ public:
 private:
 
     mutable std::map<DataKey, async::Notification> m_dataNotifications;
+
+    //! NOTE The last data given out or set for each key
+    mutable std::map<DataKey, QByteArray> m_knownData;
+
     async::Notification m_workspaceChanged;
 };
 }
@@ -15,7 +15,9 @@
 #include "Item_p.h"
 #include "MultiSplitterConfig.h"
 
+#include <QElapsedTimer>
 #include <QGuiApplication>
+#include <QTimer>
 
 #ifdef Q_OS_WIN
 #include <windows.h>
@@ -28,6 +30,10 @@ Separator *Separator::s_separatorBeingDragged = nullptr;
 /// @brief internal counter just for unit-tests
 static int s_numSeparators = 0;
 
+/// @brief Separator drags are applied at most once per this interval (about one frame at 60Hz).
+/// Each applied move resizes and relayouts every item on both sides of the separator.
+static const int s_minMoveIntervalMs = 16;
+
 struct Separator::Private
 {
     // Only set when anchor is moved through mouse. Side1 if going towards left or top, Side2 otherwise.
@@ -46,6 +52,11 @@ struct Separator::Private
     Layouting::Side lastMoveDirection = Side1;
     const bool usesLazyResize = Config::self().flags() & Config::Flag::LazyResize;
     Widget *const m_hostWidget;
+
+    // Throttling of the non-lazy drag, see s_minMoveIntervalMs
+    QElapsedTimer lastMoveTimer;
+    QPoint pendingMovePos;
+    bool moveIsPending = false;
 };
 
 Separator::Separator(Widget *hostWidget)
@@ -125,6 +136,40 @@ void Separator::onMouseMove(QPoint pos)
     }
 #endif
 
+    if (!d->lazyResizeRubberBand) {
+        const qint64 elapsed = d->lastMoveTimer.isValid() ? d->lastMoveTimer.elapsed() : s_minMoveIntervalMs;
+        if (elapsed < s_minMoveIntervalMs) {
+            // Coalesce the moves that arrive faster than the layout can be repainted,
+            // the latest position is applied when the interval is over
+            d->pendingMovePos = pos;
+            if (!d->moveIsPending) {
+                d->moveIsPending = true;
+                QTimer::singleShot(int(s_minMoveIntervalMs - elapsed), asWidget()->asQObject(), [this] {
+                    applyPendingMove();
+                });
+            }
+            return;
+        }
+
+        d->moveIsPending = false;
+        d->lastMoveTimer.start();
+    }
+
+    moveTo(pos);
+}
+
+void Separator::applyPendingMove()
+{
+    if (!d->moveIsPending || !isBeingDragged())
+        return;
+
+    d->moveIsPending = false;
+    d->lastMoveTimer.start();
+    moveTo(d->pendingMovePos);
+}
+
+void Separator::moveTo(QPoint pos)
+{
     const int positionToGoTo = Layouting::pos(pos, d->orientation);
     const int minPos = d->parentContainer->minPosForSeparator_global(this);
     const int maxPos = d->parentContainer->maxPosForSeparator_global(this);
@@ -152,6 +197,9 @@ void Separator::onMouseMove(QPoint pos)
 
 void Separator::onMouseReleased()
 {
+    applyPendingMove();
+    d->lastMoveTimer.invalidate();
+
     if (d->lazyResizeRubberBand) {
         d->lazyResizeRubberBand->hide();
         d->parentContainer->requestSeparatorMove(this, d->lazyPosition - position());
@@ -68,6 +68,8 @@ private:
 
     Q_DISABLE_COPY(Separator)
     void setLazyPosition(int);
+    void moveTo(QPoint pos);
+    void applyPendingMove();
     bool isBeingDragged() const;
     bool usesLazyResize() const;
     static bool s_isResizing;
@@ -54,11 +54,17 @@ struct _fluid_samplecache_entry_t
 
     int num_references;
     int mlocked;
+
+    /* MuseScore patch: set when the sample data comes from the storage callbacks */
+    void *storage_handle;
 };
 
 static fluid_list_t *samplecache_list = NULL;
 static fluid_mutex_t samplecache_mutex = FLUID_MUTEX_INIT;
 
+static fluid_samplecache_provide_t samplecache_provide = NULL;
+static fluid_samplecache_release_t samplecache_release = NULL;
+
 static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf, unsigned int sample_start,
         unsigned int sample_end, int sample_type, time_t mtime);
 static fluid_samplecache_entry_t *get_samplecache_entry(SFData *sf, unsigned int sample_start,
@@ -183,6 +189,15 @@ unlock_exit:
 }
 
 
+void fluid_samplecache_set_storage(fluid_samplecache_provide_t provide, fluid_samplecache_release_t release)
+{
+    fluid_mutex_lock(samplecache_mutex);
+    samplecache_provide = provide;
+    samplecache_release = release;
+    fluid_mutex_unlock(samplecache_mutex);
+}
+
+
 /* Private functions */
 static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf,
         unsigned int sample_start,
@@ -219,8 +234,24 @@ static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf,
     entry->sample_type = sample_type;
     entry->modification_time = mtime;
 
-    entry->sample_count = fluid_sffile_read_sample_data(sf, sample_start, sample_end, sample_type,
-                          &entry->sample_data, &entry->sample_data24);
+    entry->sample_count = -1;
+
+    if(samplecache_provide != NULL)
+    {
+        entry->sample_count = samplecache_provide(sf, sample_start, sample_end, sample_type,
+                              &entry->sample_data, &entry->sample_data24, &entry->storage_handle);
+
+        if(entry->sample_count < 0)
+        {
+            entry->storage_handle = NULL;
+        }
+    }
+
+    if(entry->sample_count < 0)
+    {
+        entry->sample_count = fluid_sffile_read_sample_data(sf, sample_start, sample_end, sample_type,
+                              &entry->sample_data, &entry->sample_data24);
+    }
 
     if(entry->sample_count < 0)
     {
@@ -239,8 +270,20 @@ static void delete_samplecache_entry(fluid_samplecache_entry_t *entry)
     fluid_return_if_fail(entry != NULL);
 
     FLUID_FREE(entry->filename);
-    FLUID_FREE(entry->sample_data);
-    FLUID_FREE(entry->sample_data24);
+
+    if(entry->storage_handle != NULL)
+    {
+        if(samplecache_release != NULL)
+        {
+            samplecache_release(entry->storage_handle);
+        }
+    }
+    else
+    {
+        FLUID_FREE(entry->sample_data);
+        FLUID_FREE(entry->sample_data24);
+    }
+
     FLUID_FREE(entry);
 }
 
@@ -31,4 +31,14 @@ int fluid_samplecache_load(SFData *sf,
 
 int fluid_samplecache_unload(const short *sample_data);
 
+/* MuseScore patch: lets the application provide the sample data instead of reading it into
+ * a heap buffer, e.g. mapped from a file and shared between processes. The provide callback
+ * returns the number of samples, or -1 to let the cache read the data as usual. The release
+ * callback is called with the same handle when the cached entry is deleted. */
+typedef int (*fluid_samplecache_provide_t)(SFData *sf, unsigned int sample_start, unsigned int sample_end,
+        int sample_type, short **data, char **data24, void **handle);
+typedef void (*fluid_samplecache_release_t)(void *handle);
+
+void fluid_samplecache_set_storage(fluid_samplecache_provide_t provide, fluid_samplecache_release_t release);
+
 #endif /* _FLUID_SAMPLECACHE_H */
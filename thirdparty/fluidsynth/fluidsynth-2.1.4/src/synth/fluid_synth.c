@@ -4381,6 +4381,78 @@ fluid_synth_free_voice_by_kill_LOCAL(fluid_synth_t *synth)
     return voice;
 }
 
+/**
+ * MuseScore patch: kill up to \a count playing voices, choosing them the same way
+ * as when the polyphony limit is reached (see the synth.overflow.* settings).
+ * @param synth FluidSynth instance
+ * @param count Number of voices to kill
+ * @return Number of killed voices or #FLUID_FAILED
+ */
+int
+fluid_synth_kill_voices_by_priority(fluid_synth_t *synth, int count)
+{
+    int i;
+    int killed = 0;
+    int best_voice_index;
+    int last_voice_index = -1;
+    float best_prio;
+    float last_prio = 0;
+    float this_voice_prio;
+    fluid_voice_t *voice;
+    unsigned int ticks;
+
+    fluid_return_val_if_fail(synth != NULL, FLUID_FAILED);
+    fluid_synth_api_enter(synth);
+
+    ticks = fluid_synth_get_ticks(synth);
+
+    /* fluid_voice_off() only queues the request for the rvoice mixer, the voice
+     * status changes on the next rendering. So every pass picks the next voice in
+     * the (priority, index) order instead of looking at the status. */
+    for(; killed < count; killed++)
+    {
+        best_prio = OVERFLOW_PRIO_CANNOT_KILL - 1;
+        best_voice_index = -1;
+
+        for(i = 0; i < synth->polyphony; i++)
+        {
+            voice = synth->voice[i];
+
+            if(_AVAILABLE(voice))
+            {
+                continue;
+            }
+
+            this_voice_prio = fluid_voice_get_overflow_prio(voice, &synth->overflow, ticks);
+
+            if(last_voice_index >= 0
+                    && (this_voice_prio < last_prio
+                        || (this_voice_prio == last_prio && i <= last_voice_index)))
+            {
+                continue;
+            }
+
+            if(this_voice_prio < best_prio)
+            {
+                best_voice_index = i;
+                best_prio = this_voice_prio;
+            }
+        }
+
+        if(best_voice_index < 0)
+        {
+            break;
+        }
+
+        fluid_voice_off(synth->voice[best_voice_index]);
+
+        last_prio = best_prio;
+        last_voice_index = best_voice_index;
+    }
+
+    FLUID_API_RETURN(killed);
+}
+
 
 /**
  * Allocate a synthesis voice.